@@ -367,6 +367,10 @@ void common_hal_bleio_connection_set_connection_interval(bleio_connection_intern
     // check_nrf_error(status);
 }
 
+void common_hal_bleio_connection_request_high_throughput(bleio_connection_internal_t *self) {
+    // The HCI implementation keeps the default PHY, data length and MTU.
+}
+
 // service_uuid may be NULL, to discover all services.
 // static bool discover_next_services(bleio_connection_internal_t* connection, uint16_t start_handle, ble_uuid_t *service_uuid) {
 //     m_discovery_successful = false;
@@ -61,7 +61,7 @@ void bleio_packet_buffer_update(bleio_packet_buffer_obj_t *self, mp_buffer_info_
 
 void common_hal_bleio_packet_buffer_construct(
     bleio_packet_buffer_obj_t *self, bleio_characteristic_obj_t *characteristic,
-    size_t buffer_size, size_t max_packet_size) {
+    size_t buffer_size, size_t max_packet_size, size_t max_queued_packets) {
 
     self->characteristic = characteristic;
     self->client = self->characteristic->service->is_remote;
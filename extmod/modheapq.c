@@ -31,6 +31,19 @@
 
 // the algorithm here is modelled on CPython's heapq.py
 
+// CIRCUITPY-CHANGE: compare small ints and floats without going through mp_binary_op
+static bool heapq_less(mp_obj_t a, mp_obj_t b) {
+    if (mp_obj_is_small_int(a) && mp_obj_is_small_int(b)) {
+        return MP_OBJ_SMALL_INT_VALUE(a) < MP_OBJ_SMALL_INT_VALUE(b);
+    }
+    #if MICROPY_PY_BUILTINS_FLOAT && !MICROPY_ENABLE_DYNRUNTIME
+    if (mp_obj_is_float(a) && mp_obj_is_float(b)) {
+        return mp_obj_float_get(a) < mp_obj_float_get(b);
+    }
+    #endif
+    return mp_obj_is_true(mp_binary_op(MP_BINARY_OP_LESS, a, b));
+}
+
 static mp_obj_list_t *heapq_get_heap(mp_obj_t heap_in) {
     if (!mp_obj_is_type(heap_in, &mp_type_list)) {
         mp_raise_TypeError(MP_ERROR_TEXT("heap must be a list"));
@@ -43,7 +56,8 @@ static void heapq_heap_siftdown(mp_obj_list_t *heap, mp_uint_t start_pos, mp_uin
     while (pos > start_pos) {
         mp_uint_t parent_pos = (pos - 1) >> 1;
         mp_obj_t parent = heap->items[parent_pos];
-        if (mp_binary_op(MP_BINARY_OP_LESS, item, parent) == mp_const_true) {
+        // CIRCUITPY-CHANGE
+        if (heapq_less(item, parent)) {
             heap->items[pos] = parent;
             pos = parent_pos;
         } else {
@@ -59,7 +73,8 @@ static void heapq_heap_siftup(mp_obj_list_t *heap, mp_uint_t pos) {
     mp_obj_t item = heap->items[pos];
     for (mp_uint_t child_pos = 2 * pos + 1; child_pos < end_pos; child_pos = 2 * pos + 1) {
         // choose right child if it's <= left child
-        if (child_pos + 1 < end_pos && mp_binary_op(MP_BINARY_OP_LESS, heap->items[child_pos], heap->items[child_pos + 1]) == mp_const_false) {
+        // CIRCUITPY-CHANGE
+        if (child_pos + 1 < end_pos && !heapq_less(heap->items[child_pos], heap->items[child_pos + 1])) {
             child_pos += 1;
         }
         // bubble up the smaller child
@@ -103,12 +118,181 @@ static mp_obj_t mod_heapq_heapify(mp_obj_t heap_in) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(mod_heapq_heapify_obj, mod_heapq_heapify);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_HEAPQ_PRIORITYQUEUE && !MICROPY_ENABLE_DYNRUNTIME
+
+// A priority queue keeps (priority, item) pairs in a binary heap in a single
+// array, so pushing and popping don't allocate once the array is big enough and
+// the items themselves are never compared.  Items with equal priorities come out
+// in the order they were pushed.
+
+typedef struct _heapq_entry_t {
+    mp_obj_t priority;
+    mp_obj_t item;
+    size_t seq;
+} heapq_entry_t;
+
+typedef struct _mp_obj_priorityqueue_t {
+    mp_obj_base_t base;
+    size_t len;
+    size_t alloc;
+    size_t seq;
+    heapq_entry_t *entries;
+} mp_obj_priorityqueue_t;
+
+static bool priorityqueue_less(const heapq_entry_t *a, const heapq_entry_t *b) {
+    if (heapq_less(a->priority, b->priority)) {
+        return true;
+    }
+    if (heapq_less(b->priority, a->priority)) {
+        return false;
+    }
+    return a->seq < b->seq;
+}
+
+static void priorityqueue_siftdown(mp_obj_priorityqueue_t *self, size_t pos) {
+    heapq_entry_t entry = self->entries[pos];
+    while (pos > 0) {
+        size_t parent_pos = (pos - 1) >> 1;
+        if (!priorityqueue_less(&entry, &self->entries[parent_pos])) {
+            break;
+        }
+        self->entries[pos] = self->entries[parent_pos];
+        pos = parent_pos;
+    }
+    self->entries[pos] = entry;
+}
+
+static void priorityqueue_siftup(mp_obj_priorityqueue_t *self, size_t pos) {
+    size_t end_pos = self->len;
+    heapq_entry_t entry = self->entries[pos];
+    for (size_t child_pos = 2 * pos + 1; child_pos < end_pos; child_pos = 2 * pos + 1) {
+        // choose right child if it's smaller than the left child
+        if (child_pos + 1 < end_pos && priorityqueue_less(&self->entries[child_pos + 1], &self->entries[child_pos])) {
+            child_pos += 1;
+        }
+        if (!priorityqueue_less(&self->entries[child_pos], &entry)) {
+            break;
+        }
+        self->entries[pos] = self->entries[child_pos];
+        pos = child_pos;
+    }
+    self->entries[pos] = entry;
+}
+
+static mp_obj_priorityqueue_t *priorityqueue_get_nonempty(mp_obj_t self_in) {
+    mp_obj_priorityqueue_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->len == 0) {
+        mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("empty heap"));
+    }
+    return self;
+}
+
+static mp_obj_t priorityqueue_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 0, 1, false);
+    mp_int_t alloc = n_args > 0 ? mp_obj_get_int(args[0]) : 0;
+    if (alloc < 0) {
+        mp_raise_ValueError(NULL);
+    }
+    mp_obj_priorityqueue_t *self = mp_obj_malloc(mp_obj_priorityqueue_t, type);
+    self->len = 0;
+    self->alloc = alloc;
+    self->seq = 0;
+    self->entries = alloc > 0 ? m_new(heapq_entry_t, alloc) : NULL;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static mp_obj_t priorityqueue_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
+    mp_obj_priorityqueue_t *self = MP_OBJ_TO_PTR(self_in);
+    switch (op) {
+        case MP_UNARY_OP_BOOL:
+            return mp_obj_new_bool(self->len != 0);
+        case MP_UNARY_OP_LEN:
+            return MP_OBJ_NEW_SMALL_INT(self->len);
+        default:
+            return MP_OBJ_NULL; // op not supported
+    }
+}
+
+static mp_obj_t priorityqueue_push(mp_obj_t self_in, mp_obj_t priority, mp_obj_t item) {
+    mp_obj_priorityqueue_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->len == self->alloc) {
+        size_t new_alloc = self->alloc < 4 ? 4 : self->alloc * 2;
+        self->entries = m_renew(heapq_entry_t, self->entries, self->alloc, new_alloc);
+        self->alloc = new_alloc;
+    }
+    heapq_entry_t *entry = &self->entries[self->len++];
+    entry->priority = priority;
+    entry->item = item;
+    entry->seq = self->seq++;
+    priorityqueue_siftdown(self, self->len - 1);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(priorityqueue_push_obj, priorityqueue_push);
+
+static mp_obj_t priorityqueue_pop(mp_obj_t self_in) {
+    mp_obj_priorityqueue_t *self = priorityqueue_get_nonempty(self_in);
+    mp_obj_t item = self->entries[0].item;
+    self->len -= 1;
+    self->entries[0] = self->entries[self->len];
+    // so we don't retain pointers
+    self->entries[self->len].priority = MP_OBJ_NULL;
+    self->entries[self->len].item = MP_OBJ_NULL;
+    if (self->len) {
+        priorityqueue_siftup(self, 0);
+    }
+    return item;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(priorityqueue_pop_obj, priorityqueue_pop);
+
+static mp_obj_t priorityqueue_peek(mp_obj_t self_in) {
+    return priorityqueue_get_nonempty(self_in)->entries[0].item;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(priorityqueue_peek_obj, priorityqueue_peek);
+
+static mp_obj_t priorityqueue_peek_priority(mp_obj_t self_in) {
+    return priorityqueue_get_nonempty(self_in)->entries[0].priority;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(priorityqueue_peek_priority_obj, priorityqueue_peek_priority);
+
+static mp_obj_t priorityqueue_clear(mp_obj_t self_in) {
+    mp_obj_priorityqueue_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_seq_clear(self->entries, 0, self->len, sizeof(*self->entries));
+    self->len = 0;
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(priorityqueue_clear_obj, priorityqueue_clear);
+
+static const mp_rom_map_elem_t priorityqueue_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_push), MP_ROM_PTR(&priorityqueue_push_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pop), MP_ROM_PTR(&priorityqueue_pop_obj) },
+    { MP_ROM_QSTR(MP_QSTR_peek), MP_ROM_PTR(&priorityqueue_peek_obj) },
+    { MP_ROM_QSTR(MP_QSTR_peek_priority), MP_ROM_PTR(&priorityqueue_peek_priority_obj) },
+    { MP_ROM_QSTR(MP_QSTR_clear), MP_ROM_PTR(&priorityqueue_clear_obj) },
+};
+static MP_DEFINE_CONST_DICT(priorityqueue_locals_dict, priorityqueue_locals_dict_table);
+
+static MP_DEFINE_CONST_OBJ_TYPE(
+    mp_type_heapq_priorityqueue,
+    MP_QSTR_PriorityQueue,
+    MP_TYPE_FLAG_NONE,
+    make_new, priorityqueue_make_new,
+    unary_op, priorityqueue_unary_op,
+    locals_dict, &priorityqueue_locals_dict
+    );
+
+#endif
+
 #if !MICROPY_ENABLE_DYNRUNTIME
 static const mp_rom_map_elem_t mp_module_heapq_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_heapq) },
     { MP_ROM_QSTR(MP_QSTR_heappush), MP_ROM_PTR(&mod_heapq_heappush_obj) },
     { MP_ROM_QSTR(MP_QSTR_heappop), MP_ROM_PTR(&mod_heapq_heappop_obj) },
     { MP_ROM_QSTR(MP_QSTR_heapify), MP_ROM_PTR(&mod_heapq_heapify_obj) },
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_HEAPQ_PRIORITYQUEUE
+    { MP_ROM_QSTR(MP_QSTR_PriorityQueue), MP_ROM_PTR(&mp_type_heapq_priorityqueue) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(mp_module_heapq_globals, mp_module_heapq_globals_table);
@@ -25,6 +25,8 @@
  */
 
 #include <stdio.h>
+// CIRCUITPY-CHANGE
+#include <string.h>
 
 // CIRCUITPY-CHANGE
 #include "py/binary.h"
@@ -169,7 +171,7 @@ static byte json_stream_next(json_stream_t *s) {
 
 static mp_uint_t json_python_readinto(mp_obj_t obj, void *buf, mp_uint_t size, int *errcode) {
     (void)size;  // Ignore size because we know it's always 1.
-    json_stream_t *s = obj;
+    json_stream_t *s = MP_OBJ_TO_PTR(obj);
 
     if (s->start == s->end) {
         *errcode = 0;
@@ -190,49 +192,75 @@ static mp_uint_t json_python_readinto(mp_obj_t obj, void *buf, mp_uint_t size, i
     return 1;
 }
 
-static mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
-    const mp_stream_p_t *stream_p = mp_proto_get(0, stream_obj);
-    json_stream_t s;
-    uint8_t character_buffer[CIRCUITPY_JSON_READ_CHUNK_SIZE];
-    if (stream_p == NULL) {
-        s.start = 0;
-        s.end = 0;
-        mp_load_method(stream_obj, MP_QSTR_readinto, s.python_readinto);
-        s.bytearray_obj.base.type = &mp_type_bytearray;
-        s.bytearray_obj.typecode = BYTEARRAY_TYPECODE;
-        s.bytearray_obj.len = CIRCUITPY_JSON_READ_CHUNK_SIZE;
-        s.bytearray_obj.free = 0;
-        s.bytearray_obj.items = character_buffer;
-        s.python_readinto[2] = MP_OBJ_FROM_PTR(&s.bytearray_obj);
-        s.stream_obj = &s;
-        s.read = json_python_readinto;
-    } else {
-        stream_p = mp_get_stream_raise(stream_obj, MP_STREAM_OP_READ);
-        s.stream_obj = stream_obj;
-        s.read = stream_p->read;
-        s.errcode = 0;
-        s.cur = 0;
+// CIRCUITPY-CHANGE
+static NORETURN void json_syntax_error(void) {
+    mp_raise_ValueError(MP_ERROR_TEXT("syntax error in JSON"));
+}
+
+// Reads the rest of a string, after its opening quote, into vstr.
+static void json_parse_string(json_stream_t *s, vstr_t *vstr) {
+    vstr_reset(vstr);
+    for (; !S_END(*s) && S_CUR(*s) != '"';) {
+        byte c = S_CUR(*s);
+        if (c == '\\') {
+            c = S_NEXT(*s);
+            switch (c) {
+                case 'b':
+                    c = 0x08;
+                    break;
+                case 'f':
+                    c = 0x0c;
+                    break;
+                case 'n':
+                    c = 0x0a;
+                    break;
+                case 'r':
+                    c = 0x0d;
+                    break;
+                case 't':
+                    c = 0x09;
+                    break;
+                case 'u': {
+                    mp_uint_t num = 0;
+                    for (int i = 0; i < 4; i++) {
+                        c = (S_NEXT(*s) | 0x20) - '0';
+                        if (c > 9) {
+                            c -= ('a' - ('9' + 1));
+                        }
+                        num = (num << 4) | c;
+                    }
+                    vstr_add_char(vstr, num);
+                    goto str_cont;
+                }
+            }
+        }
+        vstr_add_byte(vstr, c);
+    str_cont:
+        S_NEXT(*s);
+    }
+    if (S_END(*s)) {
+        json_syntax_error();
     }
+    S_NEXT(*s);
+}
 
-    JSON_DEBUG("got JSON stream\n");
-    vstr_t vstr;
-    vstr_init(&vstr, 8);
+// Parses the value at the stream's current character, leaving the stream just after it.
+static mp_obj_t json_parse_value(json_stream_t *s, vstr_t *vstr) {
     mp_obj_list_t stack; // we use a list as a simple stack for nested JSON
     stack.len = 0;
     stack.items = NULL;
     mp_obj_t stack_top = MP_OBJ_NULL;
     const mp_obj_type_t *stack_top_type = NULL;
     mp_obj_t stack_key = MP_OBJ_NULL;
-    S_NEXT(s);
     for (;;) {
     cont:
-        if (S_END(s)) {
+        if (S_END(*s)) {
             break;
         }
         mp_obj_t next = MP_OBJ_NULL;
         bool enter = false;
-        byte cur = S_CUR(s);
-        S_NEXT(s);
+        byte cur = S_CUR(*s);
+        S_NEXT(*s);
         switch (cur) {
             case ',':
             case ':':
@@ -242,74 +270,33 @@ static mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
             case '\r':
                 goto cont;
             case 'n':
-                if (S_CUR(s) == 'u' && S_NEXT(s) == 'l' && S_NEXT(s) == 'l') {
-                    S_NEXT(s);
+                if (S_CUR(*s) == 'u' && S_NEXT(*s) == 'l' && S_NEXT(*s) == 'l') {
+                    S_NEXT(*s);
                     next = mp_const_none;
                 } else {
                     goto fail;
                 }
                 break;
             case 'f':
-                if (S_CUR(s) == 'a' && S_NEXT(s) == 'l' && S_NEXT(s) == 's' && S_NEXT(s) == 'e') {
-                    S_NEXT(s);
+                if (S_CUR(*s) == 'a' && S_NEXT(*s) == 'l' && S_NEXT(*s) == 's' && S_NEXT(*s) == 'e') {
+                    S_NEXT(*s);
                     next = mp_const_false;
                 } else {
                     goto fail;
                 }
                 break;
             case 't':
-                if (S_CUR(s) == 'r' && S_NEXT(s) == 'u' && S_NEXT(s) == 'e') {
-                    S_NEXT(s);
+                if (S_CUR(*s) == 'r' && S_NEXT(*s) == 'u' && S_NEXT(*s) == 'e') {
+                    S_NEXT(*s);
                     next = mp_const_true;
                 } else {
                     goto fail;
                 }
                 break;
             case '"':
-                vstr_reset(&vstr);
-                for (; !S_END(s) && S_CUR(s) != '"';) {
-                    byte c = S_CUR(s);
-                    if (c == '\\') {
-                        c = S_NEXT(s);
-                        switch (c) {
-                            case 'b':
-                                c = 0x08;
-                                break;
-                            case 'f':
-                                c = 0x0c;
-                                break;
-                            case 'n':
-                                c = 0x0a;
-                                break;
-                            case 'r':
-                                c = 0x0d;
-                                break;
-                            case 't':
-                                c = 0x09;
-                                break;
-                            case 'u': {
-                                mp_uint_t num = 0;
-                                for (int i = 0; i < 4; i++) {
-                                    c = (S_NEXT(s) | 0x20) - '0';
-                                    if (c > 9) {
-                                        c -= ('a' - ('9' + 1));
-                                    }
-                                    num = (num << 4) | c;
-                                }
-                                vstr_add_char(&vstr, num);
-                                goto str_cont;
-                            }
-                        }
-                    }
-                    vstr_add_byte(&vstr, c);
-                str_cont:
-                    S_NEXT(s);
-                }
-                if (S_END(s)) {
-                    goto fail;
-                }
-                S_NEXT(s);
-                next = mp_obj_new_str(vstr.buf, vstr.len);
+                // CIRCUITPY-CHANGE
+                json_parse_string(s, vstr);
+                next = mp_obj_new_str(vstr->buf, vstr->len);
                 break;
             case '-':
             case '0':
@@ -323,10 +310,10 @@ static mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
             case '8':
             case '9': {
                 bool flt = false;
-                vstr_reset(&vstr);
+                vstr_reset(vstr);
                 for (;;) {
-                    vstr_add_byte(&vstr, cur);
-                    cur = S_CUR(s);
+                    vstr_add_byte(vstr, cur);
+                    cur = S_CUR(*s);
                     if (cur == '.' || cur == 'E' || cur == 'e') {
                         flt = true;
                     } else if (cur == '+' || cur == '-' || unichar_isdigit(cur)) {
@@ -334,12 +321,12 @@ static mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
                     } else {
                         break;
                     }
-                    S_NEXT(s);
+                    S_NEXT(*s);
                 }
                 if (flt) {
-                    next = mp_parse_num_float(vstr.buf, vstr.len, false, NULL);
+                    next = mp_parse_num_float(vstr->buf, vstr->len, false, NULL);
                 } else {
-                    next = mp_parse_num_integer(vstr.buf, vstr.len, 10, NULL);
+                    next = mp_parse_num_integer(vstr->buf, vstr->len, 10, NULL);
                 }
                 break;
             }
@@ -404,7 +391,347 @@ static mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
         }
     }
 success:
+    if (stack_top == MP_OBJ_NULL || stack.len != 0) {
+        // not exactly 1 object
+        goto fail;
+    }
+    return stack_top;
+
+fail:
+    json_syntax_error();
+}
+
+#if MICROPY_PY_JSON_SELECT
+// load() and loads() with select=(path, ...) build only the values at those paths, and skip
+// everything else without allocating, so a large document costs only as much heap as the parts
+// of it wanted. A path is keys separated by dots, and list indexes in brackets, like "a.b[0].c".
+// The result is a dict from each path to its value, without the paths that weren't found.
+
+#define JSON_SELECT_MAX (32)
+
+typedef struct _json_select_t {
+    json_stream_t *s;
+    vstr_t *vstr;
+    mp_obj_t result;
+    // The path strings, and each as a tuple of str keys and small int indexes.
+    size_t len;
+    mp_obj_t *paths;
+    mp_obj_tuple_t *parts[JSON_SELECT_MAX];
+} json_select_t;
+
+static mp_obj_t json_select_parse_path(mp_obj_t path_obj) {
+    size_t len;
+    const char *path = mp_obj_str_get_data(path_obj, &len);
+    const char *end = path + len;
+    mp_obj_t parts = mp_obj_new_list(0, NULL);
+    while (path < end) {
+        if (*path == '[') {
+            const char *close = memchr(path, ']', end - path);
+            if (close == NULL) {
+                goto fail;
+            }
+            mp_obj_t index = mp_parse_num_integer(path + 1, close - path - 1, 10, NULL);
+            if (!mp_obj_is_small_int(index) || MP_OBJ_SMALL_INT_VALUE(index) < 0) {
+                goto fail;
+            }
+            mp_obj_list_append(parts, index);
+            path = close + 1;
+        } else {
+            const char *key_end = path;
+            while (key_end < end && *key_end != '.' && *key_end != '[') {
+                key_end++;
+            }
+            if (key_end == path) {
+                goto fail;
+            }
+            mp_obj_list_append(parts, mp_obj_new_str(path, key_end - path));
+            path = key_end;
+        }
+        if (path < end && *path == '.') {
+            path++;
+            if (path == end) {
+                goto fail;
+            }
+        }
+    }
+    size_t parts_len;
+    mp_obj_t *parts_items;
+    mp_obj_list_get(parts, &parts_len, &parts_items);
+    return mp_obj_new_tuple(parts_len, parts_items);
+
+fail:
+    mp_raise_ValueError_varg(MP_ERROR_TEXT("invalid %q"), MP_QSTR_select);
+}
+
+static void json_skip_separators(json_stream_t *s) {
+    for (;;) {
+        switch (S_CUR(*s)) {
+            case ',':
+            case ':':
+            case ' ':
+            case '\t':
+            case '\n':
+            case '\r':
+                S_NEXT(*s);
+                break;
+            default:
+                return;
+        }
+    }
+}
+
+// Passes over the rest of a true, false or null whose first character has been read.
+static void json_skip_literal(json_stream_t *s, const char *rest) {
+    for (; *rest != '\0'; rest++) {
+        if (S_CUR(*s) != (byte)*rest) {
+            json_syntax_error();
+        }
+        S_NEXT(*s);
+    }
+}
+
+static bool json_skip_digits(json_stream_t *s) {
+    bool any = false;
+    while (unichar_isdigit(S_CUR(*s))) {
+        S_NEXT(*s);
+        any = true;
+    }
+    return any;
+}
+
+// Passes over a number that json_parse_value() would accept.
+static void json_skip_number(json_stream_t *s) {
+    if (S_CUR(*s) == '-') {
+        S_NEXT(*s);
+    }
+    if (!json_skip_digits(s)) {
+        json_syntax_error();
+    }
+    if (S_CUR(*s) == '.') {
+        S_NEXT(*s);
+        json_skip_digits(s);
+    }
+    if (S_CUR(*s) == 'e' || S_CUR(*s) == 'E') {
+        S_NEXT(*s);
+        if (S_CUR(*s) == '+' || S_CUR(*s) == '-') {
+            S_NEXT(*s);
+        }
+        if (!json_skip_digits(s)) {
+            json_syntax_error();
+        }
+    }
+    byte c = S_CUR(*s);
+    if (c == '.' || c == 'e' || c == 'E' || c == '+' || c == '-') {
+        json_syntax_error();
+    }
+}
+
+// Passes over the value at the stream's current character without building it.
+static void json_skip_value(json_stream_t *s) {
+    size_t depth = 0;
+    do {
+        json_skip_separators(s);
+        byte c = S_CUR(*s);
+        if (c == '"') {
+            S_NEXT(*s);
+            while (!S_END(*s) && S_CUR(*s) != '"') {
+                if (S_CUR(*s) == '\\') {
+                    S_NEXT(*s);
+                }
+                S_NEXT(*s);
+            }
+            if (S_END(*s)) {
+                json_syntax_error();
+            }
+            S_NEXT(*s);
+        } else if (c == '[' || c == '{') {
+            depth++;
+            S_NEXT(*s);
+        } else if ((c == ']' || c == '}') && depth > 0) {
+            depth--;
+            S_NEXT(*s);
+        } else if (c == '-' || unichar_isdigit(c)) {
+            json_skip_number(s);
+        } else if (c == 't') {
+            S_NEXT(*s);
+            json_skip_literal(s, "rue");
+        } else if (c == 'f') {
+            S_NEXT(*s);
+            json_skip_literal(s, "alse");
+        } else if (c == 'n') {
+            S_NEXT(*s);
+            json_skip_literal(s, "ull");
+        } else {
+            json_syntax_error();
+        }
+    } while (depth > 0);
+}
+
+// Finds value inside the selected value at path parts up to depth, for a path that goes further.
+static bool json_select_lookup(mp_obj_t value, mp_obj_tuple_t *parts, size_t depth, mp_obj_t *found) {
+    for (; depth < parts->len; depth++) {
+        mp_obj_t part = parts->items[depth];
+        if (mp_obj_is_type(value, &mp_type_dict) && mp_obj_is_str(part)) {
+            mp_map_elem_t *elem = mp_map_lookup(mp_obj_dict_get_map(value), part, MP_MAP_LOOKUP);
+            if (elem == NULL) {
+                return false;
+            }
+            value = elem->value;
+        } else if (mp_obj_is_type(value, &mp_type_list) && mp_obj_is_small_int(part)) {
+            size_t len;
+            mp_obj_t *items;
+            mp_obj_list_get(value, &len, &items);
+            if ((size_t)MP_OBJ_SMALL_INT_VALUE(part) >= len) {
+                return false;
+            }
+            value = items[MP_OBJ_SMALL_INT_VALUE(part)];
+        } else {
+            return false;
+        }
+    }
+    *found = value;
+    return true;
+}
+
+// Each bit of mask is a path that matches as far as depth. Returns the ones whose next part is the
+// key in key, or the index when key is NULL, without making an object for the key.
+static mp_uint_t json_select_match(json_select_t *sel, mp_uint_t mask, size_t depth, const vstr_t *key, mp_int_t index) {
+    mp_uint_t matches = 0;
+    for (size_t i = 0; i < sel->len; i++) {
+        if (!(mask & (1u << i)) || sel->parts[i]->len <= depth) {
+            continue;
+        }
+        mp_obj_t part = sel->parts[i]->items[depth];
+        bool match;
+        if (key != NULL) {
+            size_t len;
+            const char *str = mp_obj_is_str(part) ? mp_obj_str_get_data(part, &len) : NULL;
+            match = str != NULL && len == key->len && memcmp(str, key->buf, len) == 0;
+        } else {
+            match = part == MP_OBJ_NEW_SMALL_INT(index);
+        }
+        if (match) {
+            matches |= 1u << i;
+        }
+    }
+    return matches;
+}
+
+// Handles the value at the stream's current character, which is depth parts down the paths in mask.
+// Recursion only goes as deep as the longest path.
+static void json_select_value(json_select_t *sel, mp_uint_t mask, size_t depth) {
+    json_stream_t *s = sel->s;
+    json_skip_separators(s);
+
+    bool ends_here = false;
+    for (size_t i = 0; i < sel->len; i++) {
+        if ((mask & (1u << i)) && sel->parts[i]->len == depth) {
+            ends_here = true;
+        }
+    }
+    if (ends_here) {
+        // Build this value whole, and find any longer paths inside it.
+        mp_obj_t value = json_parse_value(s, sel->vstr);
+        for (size_t i = 0; i < sel->len; i++) {
+            mp_obj_t found;
+            if ((mask & (1u << i)) && json_select_lookup(value, sel->parts[i], depth, &found)) {
+                mp_obj_dict_store(sel->result, sel->paths[i], found);
+            }
+        }
+        return;
+    }
+
+    byte open = S_CUR(*s);
+    if (open != '{' && open != '[') {
+        json_skip_value(s);
+        return;
+    }
+    byte close = open == '{' ? '}' : ']';
+    S_NEXT(*s);
+    mp_int_t index = 0;
+    for (;;) {
+        json_skip_separators(s);
+        if (S_CUR(*s) == close) {
+            S_NEXT(*s);
+            return;
+        }
+        mp_uint_t matches;
+        if (open == '{') {
+            if (S_CUR(*s) != '"') {
+                json_syntax_error();
+            }
+            S_NEXT(*s);
+            json_parse_string(s, sel->vstr);
+            matches = json_select_match(sel, mask, depth, sel->vstr, 0);
+        } else {
+            matches = json_select_match(sel, mask, depth, NULL, index);
+            index++;
+        }
+        if (matches != 0) {
+            json_select_value(sel, matches, depth + 1);
+        } else {
+            json_skip_value(s);
+        }
+    }
+}
+
+static mp_obj_t json_select(json_stream_t *s, vstr_t *vstr, mp_obj_t select) {
+    json_select_t sel;
+    sel.s = s;
+    sel.vstr = vstr;
+    sel.result = mp_obj_new_dict(0);
+    mp_obj_get_array(select, &sel.len, &sel.paths);
+    mp_arg_validate_length_max(sel.len, JSON_SELECT_MAX, MP_QSTR_select);
+    for (size_t i = 0; i < sel.len; i++) {
+        sel.parts[i] = MP_OBJ_TO_PTR(json_select_parse_path(sel.paths[i]));
+    }
+    if (sel.len > 0) {
+        json_select_value(&sel, (sel.len == JSON_SELECT_MAX ? 0 : (1u << sel.len)) - 1, 0);
+    } else {
+        json_skip_value(s);
+    }
+    return sel.result;
+}
+#endif
+
+static mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json, mp_obj_t select) {
+    const mp_stream_p_t *stream_p = mp_proto_get(0, stream_obj);
+    json_stream_t s;
+    uint8_t character_buffer[CIRCUITPY_JSON_READ_CHUNK_SIZE];
+    if (stream_p == NULL) {
+        s.start = 0;
+        s.end = 0;
+        mp_load_method(stream_obj, MP_QSTR_readinto, s.python_readinto);
+        s.bytearray_obj.base.type = &mp_type_bytearray;
+        s.bytearray_obj.typecode = BYTEARRAY_TYPECODE;
+        s.bytearray_obj.len = CIRCUITPY_JSON_READ_CHUNK_SIZE;
+        s.bytearray_obj.free = 0;
+        s.bytearray_obj.items = character_buffer;
+        s.python_readinto[2] = MP_OBJ_FROM_PTR(&s.bytearray_obj);
+        s.stream_obj = MP_OBJ_FROM_PTR(&s);
+        s.read = json_python_readinto;
+    } else {
+        stream_p = mp_get_stream_raise(stream_obj, MP_STREAM_OP_READ);
+        s.stream_obj = stream_obj;
+        s.read = stream_p->read;
+        s.errcode = 0;
+        s.cur = 0;
+    }
+
+    JSON_DEBUG("got JSON stream\n");
+    vstr_t vstr;
+    vstr_init(&vstr, 8);
+    S_NEXT(s);
     // CIRCUITPY-CHANGE
+    mp_obj_t result;
+    #if MICROPY_PY_JSON_SELECT
+    if (select != mp_const_none) {
+        result = json_select(&s, &vstr, select);
+    } else
+    #endif
+    {
+        result = json_parse_value(&s, &vstr);
+    }
 
     // It is legal for a stream to have contents after JSON.
     // E.g., A UART is not closed after receiving an object; in load() we will
@@ -416,35 +743,42 @@ success:
         }
         if (!S_END(s)) {
             // unexpected chars
-            goto fail;
+            json_syntax_error();
         }
     }
-    if (stack_top == MP_OBJ_NULL || stack.len != 0) {
-        // not exactly 1 object
-        goto fail;
-    }
     vstr_clear(&vstr);
-    return stack_top;
-
-fail:
-    mp_raise_ValueError(MP_ERROR_TEXT("syntax error in JSON"));
+    return result;
 }
 
 // CIRCUITPY-CHANGE
-static mp_obj_t mod_json_load(mp_obj_t stream_obj) {
-    return _mod_json_load(stream_obj, true);
+static const mp_arg_t json_load_allowed_args[] = {
+    { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+    #if MICROPY_PY_JSON_SELECT
+    { MP_QSTR_select, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    #endif
+};
+
+static mp_obj_t mod_json_load(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    mp_arg_val_t args[MP_ARRAY_SIZE(json_load_allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(json_load_allowed_args), json_load_allowed_args, args);
+    mp_obj_t select = MP_ARRAY_SIZE(args) > 1 ? args[MP_ARRAY_SIZE(args) - 1].u_obj : mp_const_none;
+    return _mod_json_load(args[0].u_obj, true, select);
 }
-static MP_DEFINE_CONST_FUN_OBJ_1(mod_json_load_obj, mod_json_load);
+static MP_DEFINE_CONST_FUN_OBJ_KW(mod_json_load_obj, 1, mod_json_load);
 
-static mp_obj_t mod_json_loads(mp_obj_t obj) {
+static mp_obj_t mod_json_loads(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    // CIRCUITPY-CHANGE
+    mp_arg_val_t args[MP_ARRAY_SIZE(json_load_allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(json_load_allowed_args), json_load_allowed_args, args);
+    mp_obj_t select = MP_ARRAY_SIZE(args) > 1 ? args[MP_ARRAY_SIZE(args) - 1].u_obj : mp_const_none;
     mp_buffer_info_t bufinfo;
-    mp_get_buffer_raise(obj, &bufinfo, MP_BUFFER_READ);
+    mp_get_buffer_raise(args[0].u_obj, &bufinfo, MP_BUFFER_READ);
     vstr_t vstr = {bufinfo.len, bufinfo.len, (char *)bufinfo.buf, true};
     mp_obj_stringio_t sio = {{&mp_type_stringio}, &vstr, 0, MP_OBJ_NULL};
     // CIRCUITPY-CHANGE
-    return _mod_json_load(MP_OBJ_FROM_PTR(&sio), false);
+    return _mod_json_load(MP_OBJ_FROM_PTR(&sio), false, select);
 }
-static MP_DEFINE_CONST_FUN_OBJ_1(mod_json_loads_obj, mod_json_loads);
+static MP_DEFINE_CONST_FUN_OBJ_KW(mod_json_loads_obj, 1, mod_json_loads);
 
 static const mp_rom_map_elem_t mp_module_json_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_json) },
@@ -28,6 +28,9 @@
 #include <string.h>
 
 #include "py/runtime.h"
+// CIRCUITPY-CHANGE
+#include "py/binary.h"
+#include "py/objarray.h"
 
 #if MICROPY_PY_RANDOM
 
@@ -213,6 +216,94 @@ static MP_DEFINE_CONST_FUN_OBJ_2(mod_random_uniform_obj, mod_random_uniform);
 
 #endif
 
+// CIRCUITPY-CHANGE: fill a buffer with random numbers in one call
+#if !MICROPY_ENABLE_DYNRUNTIME
+static mp_obj_t mod_random_fill(size_t n_args, const mp_obj_t *args) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[0], &bufinfo, MP_BUFFER_WRITE);
+    char typecode = bufinfo.typecode == BYTEARRAY_TYPECODE ? 'B' : bufinfo.typecode;
+    size_t itemsize = mp_binary_get_size('@', typecode, NULL);
+    size_t len = bufinfo.len / itemsize;
+
+    #if MICROPY_PY_BUILTINS_FLOAT
+    if (typecode == 'f' || typecode == 'd') {
+        mp_float_t lo = n_args > 1 ? mp_obj_get_float(args[1]) : MICROPY_FLOAT_CONST(0.0);
+        mp_float_t scale = (n_args > 2 ? mp_obj_get_float(args[2]) : MICROPY_FLOAT_CONST(1.0)) - lo;
+        for (size_t i = 0; i < len; i++) {
+            mp_float_t f = lo + scale * yasmarang_float();
+            if (typecode == 'd') {
+                ((double *)bufinfo.buf)[i] = f;
+            } else {
+                ((float *)bufinfo.buf)[i] = (float)f;
+            }
+        }
+        return mp_const_none;
+    }
+    #endif
+
+    if (typecode == 0 || strchr("bBhHiIlLqQ", typecode) == NULL) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("unsupported %q type"), MP_QSTR_buffer);
+    }
+    size_t bits = itemsize * 8;
+    bool is_signed = typecode >= 'a';
+    int64_t type_min = is_signed ? -((int64_t)1 << (bits - 1)) : 0;
+    int64_t type_max = (bits == 64 || is_signed) ? (int64_t)(UINT64_MAX >> (65 - bits)) : ((int64_t)1 << bits) - 1;
+    int64_t lo = n_args > 1 ? mp_obj_get_int(args[1]) : type_min;
+    int64_t hi_max = n_args > 2 ? mp_obj_get_int(args[2]) - 1 : type_max;
+    if (lo < type_min || lo > type_max) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q out of range"), MP_QSTR_lo);
+    }
+    if (hi_max < lo || hi_max > type_max) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q out of range"), MP_QSTR_hi);
+    }
+
+    // span 0 means the whole type, so just fill in random bits
+    uint32_t span = 0;
+    if (lo != type_min || hi_max != type_max) {
+        if ((uint64_t)(hi_max - lo) >= UINT32_MAX) {
+            mp_raise_ValueError_varg(MP_ERROR_TEXT("%q out of range"), MP_QSTR_hi);
+        }
+        span = hi_max - lo + 1;
+    }
+    // The mask is worked out once for the whole buffer rather than per item.
+    uint32_t mask = 1;
+    while ((span & mask) < span) {
+        mask = (mask << 1) | 1;
+    }
+    for (size_t i = 0; i < len; i++) {
+        uint64_t v;
+        if (span == 0) {
+            v = yasmarang();
+            if (itemsize == 8) {
+                v = (v << 32) | yasmarang();
+            }
+        } else {
+            uint32_t r;
+            do {
+                r = yasmarang() & mask;
+            } while (r >= span);
+            v = (uint64_t)lo + r;
+        }
+        switch (itemsize) {
+            case 1:
+                ((uint8_t *)bufinfo.buf)[i] = v;
+                break;
+            case 2:
+                ((uint16_t *)bufinfo.buf)[i] = v;
+                break;
+            case 4:
+                ((uint32_t *)bufinfo.buf)[i] = v;
+                break;
+            default:
+                ((uint64_t *)bufinfo.buf)[i] = v;
+                break;
+        }
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_random_fill_obj, 1, 3, mod_random_fill);
+#endif
+
 #endif // MICROPY_PY_RANDOM_EXTRA_FUNCS
 
 #if SEED_ON_IMPORT
@@ -245,6 +336,8 @@ static const mp_rom_map_elem_t mp_module_random_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_random), MP_ROM_PTR(&mod_random_random_obj) },
     { MP_ROM_QSTR(MP_QSTR_uniform), MP_ROM_PTR(&mod_random_uniform_obj) },
     #endif
+    // CIRCUITPY-CHANGE
+    { MP_ROM_QSTR(MP_QSTR_fill), MP_ROM_PTR(&mod_random_fill_obj) },
     #endif
 };
 
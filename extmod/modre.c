@@ -45,6 +45,18 @@
 
 #define FLAG_DEBUG 0x1000
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_RE_PIKEVM
+// Shorter subjects are matched by backtracking, which is quicker for them and needs no memory.
+#define PIKEVM_MIN_SUBJECT_LEN (32)
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_ENABLE_DYNRUNTIME
+#undef MICROPY_PY_RE_CACHE_SIZE
+#define MICROPY_PY_RE_CACHE_SIZE (0)
+#endif
+
 typedef struct _mp_obj_re_t {
     mp_obj_base_t base;
     ByteProg re;
@@ -62,6 +74,50 @@ static mp_obj_t mod_re_compile(size_t n_args, const mp_obj_t *args);
 static const mp_obj_type_t re_type;
 #endif
 
+// CIRCUITPY-CHANGE
+static int re_exec_prog(ByteProg *prog, Subject *subj, const char **caps, int caps_num, bool is_anchored) {
+    #if MICROPY_PY_RE_PIKEVM
+    if (subj->end - subj->begin >= PIKEVM_MIN_SUBJECT_LEN) {
+        return re1_5_pikevm(prog, subj, caps, caps_num, is_anchored);
+    }
+    #endif
+    return re1_5_recursiveloopprog(prog, subj, caps, caps_num, is_anchored);
+}
+
+// CIRCUITPY-CHANGE
+// Returns the compiled form of a pattern given to a module level function, reusing the most
+// recently used ones so that calling re.match() and friends in a loop doesn't compile each time.
+static mp_obj_re_t *re_get_compiled(mp_obj_t pattern) {
+    if (mp_obj_is_type(pattern, (mp_obj_type_t *)&re_type)) {
+        return MP_OBJ_TO_PTR(pattern);
+    }
+    #if MICROPY_PY_RE_CACHE_SIZE
+    // Pairs of pattern and compiled pattern, most recently used first.
+    mp_obj_t *cache = MP_STATE_VM(re_cache);
+    size_t i = 0;
+    while (i < MICROPY_PY_RE_CACHE_SIZE && cache[i * 2] != MP_OBJ_NULL
+           && !(mp_obj_get_type(cache[i * 2]) == mp_obj_get_type(pattern) && mp_obj_equal(cache[i * 2], pattern))) {
+        i++;
+    }
+    mp_obj_t compiled;
+    if (i < MICROPY_PY_RE_CACHE_SIZE && cache[i * 2] != MP_OBJ_NULL) {
+        compiled = cache[i * 2 + 1];
+    } else {
+        compiled = mod_re_compile(1, &pattern);
+        if (i == MICROPY_PY_RE_CACHE_SIZE) {
+            // Drop the least recently used.
+            i--;
+        }
+    }
+    memmove(&cache[2], &cache[0], i * 2 * sizeof(mp_obj_t));
+    cache[0] = pattern;
+    cache[1] = compiled;
+    return MP_OBJ_TO_PTR(compiled);
+    #else
+    return MP_OBJ_TO_PTR(mod_re_compile(1, &pattern));
+    #endif
+}
+
 static void match_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
     (void)kind;
     mp_obj_match_t *self = MP_OBJ_TO_PTR(self_in);
@@ -196,12 +252,8 @@ static void re_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t
 
 static mp_obj_t re_exec(bool is_anchored, uint n_args, const mp_obj_t *args) {
     (void)n_args;
-    mp_obj_re_t *self;
-    if (mp_obj_is_type(args[0], (mp_obj_type_t *)&re_type)) {
-        self = MP_OBJ_TO_PTR(args[0]);
-    } else {
-        self = MP_OBJ_TO_PTR(mod_re_compile(1, args));
-    }
+    // CIRCUITPY-CHANGE
+    mp_obj_re_t *self = re_get_compiled(args[0]);
     Subject subj;
     size_t len;
     subj.begin_line = subj.begin = mp_obj_str_get_data(args[1], &len);
@@ -241,7 +293,8 @@ static mp_obj_t re_exec(bool is_anchored, uint n_args, const mp_obj_t *args) {
     mp_obj_match_t *match = m_new_obj_var(mp_obj_match_t, caps, char *, caps_num);
     // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
     memset((char *)match->caps, 0, caps_num * sizeof(char *));
-    int res = re1_5_recursiveloopprog(&self->re, &subj, match->caps, caps_num, is_anchored);
+    // CIRCUITPY-CHANGE
+    int res = re_exec_prog(&self->re, &subj, match->caps, caps_num, is_anchored);
     if (res == 0) {
         m_del_var(mp_obj_match_t, caps, char *, caps_num, match);
         return mp_const_none;
@@ -282,7 +335,8 @@ static mp_obj_t re_split(size_t n_args, const mp_obj_t *args) {
     while (true) {
         // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
         memset((char **)caps, 0, caps_num * sizeof(char *));
-        int res = re1_5_recursiveloopprog(&self->re, &subj, caps, caps_num, false);
+        // CIRCUITPY-CHANGE
+        int res = re_exec_prog(&self->re, &subj, caps, caps_num, false);
 
         // if we didn't have a match, or had an empty match, it's time to stop
         if (!res || caps[0] == caps[1]) {
@@ -311,12 +365,8 @@ MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(re_split_obj, 2, 3, re_split);
 #if MICROPY_PY_RE_SUB
 
 static mp_obj_t re_sub_helper(size_t n_args, const mp_obj_t *args) {
-    mp_obj_re_t *self;
-    if (mp_obj_is_type(args[0], (mp_obj_type_t *)&re_type)) {
-        self = MP_OBJ_TO_PTR(args[0]);
-    } else {
-        self = MP_OBJ_TO_PTR(mod_re_compile(1, args));
-    }
+    // CIRCUITPY-CHANGE
+    mp_obj_re_t *self = re_get_compiled(args[0]);
     mp_obj_t replace = args[1];
     mp_obj_t where = args[2];
     mp_int_t count = 0;
@@ -342,7 +392,8 @@ static mp_obj_t re_sub_helper(size_t n_args, const mp_obj_t *args) {
     for (;;) {
         // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
         memset((char *)match->caps, 0, caps_num * sizeof(char *));
-        int res = re1_5_recursiveloopprog(&self->re, &subj, match->caps, caps_num, false);
+        // CIRCUITPY-CHANGE
+        int res = re_exec_prog(&self->re, &subj, match->caps, caps_num, false);
 
         // If we didn't have a match, or had an empty match, it's time to stop
         if (!res || match->caps[0] == match->caps[1]) {
@@ -502,6 +553,11 @@ const mp_obj_module_t mp_module_re = {
 };
 
 MP_REGISTER_EXTENSIBLE_MODULE(MP_QSTR_re, mp_module_re);
+
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_RE_CACHE_SIZE
+MP_REGISTER_ROOT_POINTER(mp_obj_t re_cache[MICROPY_PY_RE_CACHE_SIZE * 2]);
+#endif
 #endif
 
 // Source files #include'd here to make sure they're compiled in
@@ -512,6 +568,12 @@ MP_REGISTER_EXTENSIBLE_MODULE(MP_QSTR_re, mp_module_re);
 #include "lib/re1.5/compilecode.c"
 #include "lib/re1.5/recursiveloop.c"
 #include "lib/re1.5/charclass.c"
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_RE_PIKEVM
+#define re1_5_malloc(n) m_new(char, n)
+#define re1_5_free(p, n) m_del(char, p, n)
+#include "lib/re1.5/pike.c"
+#endif
 
 #if MICROPY_PY_RE_DEBUG
 // Make sure the output print statements go to the same output as other Python output.
@@ -60,6 +60,10 @@
 #define MP_BLOCKDEV_IOCTL_BLOCK_COUNT   (4)
 #define MP_BLOCKDEV_IOCTL_BLOCK_SIZE    (5)
 #define MP_BLOCKDEV_IOCTL_BLOCK_ERASE   (6)
+// CIRCUITPY-CHANGE: memory-mapped address of block arg, for native block devices only
+#define MP_BLOCKDEV_IOCTL_BLOCK_ADDR    (7)
+// CIRCUITPY-CHANGE: non-zero while the device is still finishing a write, so the next access would wait
+#define MP_BLOCKDEV_IOCTL_BUSY          (8)
 
 // At the moment the VFS protocol just has import_stat, but could be extended to other methods
 typedef struct _mp_vfs_proto_t {
@@ -100,6 +104,8 @@ int mp_vfs_blockdev_read_ext(mp_vfs_blockdev_t *self, size_t block_num, size_t b
 int mp_vfs_blockdev_write(mp_vfs_blockdev_t *self, size_t block_num, size_t num_blocks, const uint8_t *buf);
 int mp_vfs_blockdev_write_ext(mp_vfs_blockdev_t *self, size_t block_num, size_t block_off, size_t len, const uint8_t *buf);
 mp_obj_t mp_vfs_blockdev_ioctl(mp_vfs_blockdev_t *self, uintptr_t cmd, uintptr_t arg);
+// CIRCUITPY-CHANGE
+const void *mp_vfs_blockdev_get_addr(mp_vfs_blockdev_t *self, size_t block_num);
 
 mp_vfs_mount_t *mp_vfs_lookup_path(const char *path, const char **path_out);
 mp_import_stat_t mp_vfs_import_stat(const char *path);
@@ -24,6 +24,9 @@
  * THE SOFTWARE.
  */
 
+// CIRCUITPY-CHANGE
+#include <string.h>
+
 #include "py/runtime.h"
 #include "py/binary.h"
 #include "py/objarray.h"
@@ -92,7 +95,73 @@ int mp_vfs_blockdev_read(mp_vfs_blockdev_t *self, size_t block_num, size_t num_b
     }
 }
 
+// CIRCUITPY-CHANGE: Native block devices only move whole blocks, so part of a block goes through
+// a copy of the whole block.
+#define NATIVE_BLOCK_SIZE (512)
+
+static int native_read_ext(mp_vfs_blockdev_t *self, size_t block_num, size_t block_off, size_t len, uint8_t *buf) {
+    mp_uint_t (*f)(mp_obj_t self, uint8_t *, uint32_t, uint32_t) = (void *)(uintptr_t)self->readblocks[2];
+    block_num += block_off / NATIVE_BLOCK_SIZE;
+    block_off %= NATIVE_BLOCK_SIZE;
+    while (len > 0) {
+        size_t n;
+        if (block_off == 0 && len >= NATIVE_BLOCK_SIZE) {
+            n = len / NATIVE_BLOCK_SIZE * NATIVE_BLOCK_SIZE;
+            if (f(self->readblocks[1], buf, block_num, n / NATIVE_BLOCK_SIZE) != 0) {
+                return -MP_EIO;
+            }
+        } else {
+            uint8_t block[NATIVE_BLOCK_SIZE];
+            n = MIN(len, NATIVE_BLOCK_SIZE - block_off);
+            if (f(self->readblocks[1], block, block_num, 1) != 0) {
+                return -MP_EIO;
+            }
+            memcpy(buf, block + block_off, n);
+        }
+        buf += n;
+        len -= n;
+        block_num += (block_off + n) / NATIVE_BLOCK_SIZE;
+        block_off = 0;
+    }
+    return 0;
+}
+
+static int native_write_ext(mp_vfs_blockdev_t *self, size_t block_num, size_t block_off, size_t len, const uint8_t *buf) {
+    mp_uint_t (*read)(mp_obj_t self, uint8_t *, uint32_t, uint32_t) = (void *)(uintptr_t)self->readblocks[2];
+    mp_uint_t (*write)(mp_obj_t self, const uint8_t *, uint32_t, uint32_t) = (void *)(uintptr_t)self->writeblocks[2];
+    block_num += block_off / NATIVE_BLOCK_SIZE;
+    block_off %= NATIVE_BLOCK_SIZE;
+    while (len > 0) {
+        size_t n;
+        if (block_off == 0 && len >= NATIVE_BLOCK_SIZE) {
+            n = len / NATIVE_BLOCK_SIZE * NATIVE_BLOCK_SIZE;
+            if (write(self->writeblocks[1], buf, block_num, n / NATIVE_BLOCK_SIZE) != 0) {
+                return -MP_EIO;
+            }
+        } else {
+            uint8_t block[NATIVE_BLOCK_SIZE];
+            n = MIN(len, NATIVE_BLOCK_SIZE - block_off);
+            if (read(self->readblocks[1], block, block_num, 1) != 0) {
+                return -MP_EIO;
+            }
+            memcpy(block + block_off, buf, n);
+            if (write(self->writeblocks[1], block, block_num, 1) != 0) {
+                return -MP_EIO;
+            }
+        }
+        buf += n;
+        len -= n;
+        block_num += (block_off + n) / NATIVE_BLOCK_SIZE;
+        block_off = 0;
+    }
+    return 0;
+}
+
 int mp_vfs_blockdev_read_ext(mp_vfs_blockdev_t *self, size_t block_num, size_t block_off, size_t len, uint8_t *buf) {
+    // CIRCUITPY-CHANGE
+    if (self->flags & MP_BLOCKDEV_FLAG_NATIVE) {
+        return native_read_ext(self, block_num * self->block_size / NATIVE_BLOCK_SIZE, block_off, len, buf);
+    }
     mp_obj_array_t ar = {{&mp_type_bytearray}, BYTEARRAY_TYPECODE, 0, len, buf};
     self->readblocks[2] = MP_OBJ_NEW_SMALL_INT(block_num);
     self->readblocks[3] = MP_OBJ_FROM_PTR(&ar);
@@ -132,6 +201,11 @@ int mp_vfs_blockdev_write_ext(mp_vfs_blockdev_t *self, size_t block_num, size_t
         return -MP_EROFS;
     }
 
+    // CIRCUITPY-CHANGE
+    if (self->flags & MP_BLOCKDEV_FLAG_NATIVE) {
+        return native_write_ext(self, block_num * self->block_size / NATIVE_BLOCK_SIZE, block_off, len, buf);
+    }
+
     mp_obj_array_t ar = {{&mp_type_bytearray}, BYTEARRAY_TYPECODE, 0, len, (void *)buf};
     self->writeblocks[2] = MP_OBJ_NEW_SMALL_INT(block_num);
     self->writeblocks[3] = MP_OBJ_FROM_PTR(&ar);
@@ -184,4 +258,19 @@ mp_obj_t mp_vfs_blockdev_ioctl(mp_vfs_blockdev_t *self, uintptr_t cmd, uintptr_t
     }
 }
 
+// CIRCUITPY-CHANGE: where a native block device maps block_num into memory, or
+// NULL. Blocks after it in the same file are mapped after it.
+const void *mp_vfs_blockdev_get_addr(mp_vfs_blockdev_t *self, size_t block_num) {
+    if ((self->flags & (MP_BLOCKDEV_FLAG_HAVE_IOCTL | MP_BLOCKDEV_FLAG_NATIVE)) != (MP_BLOCKDEV_FLAG_HAVE_IOCTL | MP_BLOCKDEV_FLAG_NATIVE)) {
+        return NULL;
+    }
+    // Call the native ioctl directly, as an address may not fit in a small int.
+    size_t out_value;
+    bool (*f)(mp_obj_t self, uint32_t, uint32_t, size_t *) = (void *)(uintptr_t)self->u.ioctl[2];
+    if (!f(self->u.ioctl[1], MP_BLOCKDEV_IOCTL_BLOCK_ADDR, block_num, &out_value)) {
+        return NULL;
+    }
+    return (const void *)out_value;
+}
+
 #endif // MICROPY_VFS
@@ -143,9 +143,14 @@ typedef struct _mp_vfs_fat_ilistdir_it_t {
     mp_fun_1_t iternext;
     mp_fun_1_t finaliser;
     bool is_str;
+    // CIRCUITPY-CHANGE: yield (name, stat) for os.scandir
+    bool with_stat;
     FF_DIR dir;
 } mp_vfs_fat_ilistdir_it_t;
 
+// CIRCUITPY-CHANGE
+static mp_obj_t fat_vfs_make_stat(const FILINFO *fno);
+
 static mp_obj_t mp_vfs_fat_ilistdir_it_iternext(mp_obj_t self_in) {
     mp_vfs_fat_ilistdir_it_t *self = MP_OBJ_TO_PTR(self_in);
 
@@ -160,6 +165,12 @@ static mp_obj_t mp_vfs_fat_ilistdir_it_iternext(mp_obj_t self_in) {
 
         // Note that FatFS already filters . and .., so we don't need to
 
+        // CIRCUITPY-CHANGE: everything stat would give, from the same directory entry
+        if (self->with_stat) {
+            mp_obj_t items[2] = { mp_obj_new_str(fn, strlen(fn)), fat_vfs_make_stat(&fno) };
+            return mp_obj_new_tuple(2, items);
+        }
+
         // make 4-tuple with info about this entry
         mp_obj_tuple_t *t = MP_OBJ_TO_PTR(mp_obj_new_tuple(4, NULL));
         if (self->is_str) {
@@ -211,6 +222,8 @@ static mp_obj_t fat_vfs_ilistdir_func(size_t n_args, const mp_obj_t *args) {
     iter->iternext = mp_vfs_fat_ilistdir_it_iternext;
     iter->finaliser = mp_vfs_fat_ilistdir_it_del;
     iter->is_str = is_str_type;
+    // CIRCUITPY-CHANGE
+    iter->with_stat = false;
     FRESULT res = f_opendir(&self->fatfs, &iter->dir, path);
     if (res != FR_OK) {
         // CIRCUITPY-CHANGE
@@ -221,6 +234,14 @@ static mp_obj_t fat_vfs_ilistdir_func(size_t n_args, const mp_obj_t *args) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(fat_vfs_ilistdir_obj, 1, 2, fat_vfs_ilistdir_func);
 
+// CIRCUITPY-CHANGE
+mp_obj_t mp_vfs_fat_ilistdir_stat(mp_obj_t vfs_in, mp_obj_t path_in) {
+    mp_obj_t args[2] = { vfs_in, path_in };
+    mp_vfs_fat_ilistdir_it_t *iter = MP_OBJ_TO_PTR(fat_vfs_ilistdir_func(2, args));
+    iter->with_stat = true;
+    return MP_OBJ_FROM_PTR(iter);
+}
+
 static mp_obj_t fat_vfs_remove_internal(mp_obj_t vfs_in, mp_obj_t path_in, mp_int_t attr) {
     mp_obj_fat_vfs_t *self = MP_OBJ_TO_PTR(vfs_in);
     // CIRCUITPY-CHANGE
@@ -346,9 +367,15 @@ static mp_obj_t fat_vfs_stat(mp_obj_t vfs_in, mp_obj_t path_in) {
         }
     }
 
+    // CIRCUITPY-CHANGE: shared with os.scandir
+    return fat_vfs_make_stat(&fno);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(fat_vfs_stat_obj, fat_vfs_stat);
+
+static mp_obj_t fat_vfs_make_stat(const FILINFO *fno) {
     mp_obj_tuple_t *t = MP_OBJ_TO_PTR(mp_obj_new_tuple(10, NULL));
     mp_int_t mode = 0;
-    if (fno.fattrib & AM_DIR) {
+    if (fno->fattrib & AM_DIR) {
         mode |= MP_S_IFDIR;
     } else {
         mode |= MP_S_IFREG;
@@ -361,12 +388,12 @@ static mp_obj_t fat_vfs_stat(mp_obj_t vfs_in, mp_obj_t path_in) {
     #else
     mp_obj_t seconds_obj = mp_obj_new_int_from_uint(
         timeutils_seconds_since_epoch(
-            1980 + ((fno.fdate >> 9) & 0x7f),
-            (fno.fdate >> 5) & 0x0f,
-            fno.fdate & 0x1f,
-            (fno.ftime >> 11) & 0x1f,
-            (fno.ftime >> 5) & 0x3f,
-            2 * (fno.ftime & 0x1f)
+            1980 + ((fno->fdate >> 9) & 0x7f),
+            (fno->fdate >> 5) & 0x0f,
+            fno->fdate & 0x1f,
+            (fno->ftime >> 11) & 0x1f,
+            (fno->ftime >> 5) & 0x3f,
+            2 * (fno->ftime & 0x1f)
             ));
     #endif
     t->items[0] = MP_OBJ_NEW_SMALL_INT(mode); // st_mode
@@ -375,7 +402,7 @@ static mp_obj_t fat_vfs_stat(mp_obj_t vfs_in, mp_obj_t path_in) {
     t->items[3] = MP_OBJ_NEW_SMALL_INT(0); // st_nlink
     t->items[4] = MP_OBJ_NEW_SMALL_INT(0); // st_uid
     t->items[5] = MP_OBJ_NEW_SMALL_INT(0); // st_gid
-    t->items[6] = mp_obj_new_int_from_uint(fno.fsize); // st_size
+    t->items[6] = mp_obj_new_int_from_uint(fno->fsize); // st_size
     // CIRCUITPY-CHANGE: already converted to obj
     t->items[7] = seconds_obj; // st_atime
     t->items[8] = seconds_obj; // st_mtime
@@ -383,7 +410,6 @@ static mp_obj_t fat_vfs_stat(mp_obj_t vfs_in, mp_obj_t path_in) {
 
     return MP_OBJ_FROM_PTR(t);
 }
-static MP_DEFINE_CONST_FUN_OBJ_2(fat_vfs_stat_obj, fat_vfs_stat);
 
 // Get the status of a VFS.
 static mp_obj_t fat_vfs_statvfs(mp_obj_t vfs_in, mp_obj_t path_in) {
@@ -47,6 +47,22 @@ extern const mp_obj_type_t mp_type_vfs_fat_textio;
 
 MP_DECLARE_CONST_FUN_OBJ_3(fat_vfs_open_obj);
 
+// CIRCUITPY-CHANGE: where an open file's contents can be read in memory, when it is in one run of
+// clusters on a block device that is memory mapped. NULL otherwise.
+#if MICROPY_PERSISTENT_CODE_LOAD_IN_PLACE || (defined(CIRCUITPY_STORAGE_MAP_FILE) && CIRCUITPY_STORAGE_MAP_FILE)
+#define MICROPY_VFS_FAT_FILE_DATA (1)
+const uint8_t *mp_vfs_fat_file_data(FIL *fp);
+#else
+#define MICROPY_VFS_FAT_FILE_DATA (0)
+#endif
+
+// CIRCUITPY-CHANGE: counts the writes to FAT block devices, so that what's cached from a file can
+// be checked for being current
+extern uint32_t mp_vfs_fat_write_count;
+
+// CIRCUITPY-CHANGE: like ilistdir, but yields (name, stat result) for each entry of path
+mp_obj_t mp_vfs_fat_ilistdir_stat(mp_obj_t vfs_in, mp_obj_t path_in);
+
 // CIRCUITPY-CHANGE
 typedef struct _pyb_file_obj_t {
     mp_obj_base_t base;
@@ -68,6 +68,9 @@ DRESULT disk_read(
     return ret == 0 ? RES_OK : RES_ERROR;
 }
 
+// CIRCUITPY-CHANGE
+uint32_t mp_vfs_fat_write_count;
+
 /*-----------------------------------------------------------------------*/
 /* Write Sector(s)                                                       */
 /*-----------------------------------------------------------------------*/
@@ -83,6 +86,9 @@ DRESULT disk_write(
         return RES_PARERR;
     }
 
+    // CIRCUITPY-CHANGE
+    mp_vfs_fat_write_count++;
+
     int ret = mp_vfs_blockdev_write(&vfs->blockdev, sector, count, buff);
 
     if (ret == -MP_EROFS) {
@@ -162,6 +168,18 @@ DRESULT disk_ioctl(
             return RES_OK;
         }
 
+        // CIRCUITPY-CHANGE: pass freed sectors on to native block devices. Python block devices
+        // may erase more than the block they are given, so they aren't told.
+        case CTRL_TRIM: {
+            if (vfs->blockdev.flags & MP_BLOCKDEV_FLAG_NATIVE) {
+                DWORD *range = buff;
+                for (DWORD block = range[0]; block <= range[1]; block++) {
+                    mp_vfs_blockdev_ioctl(&vfs->blockdev, MP_BLOCKDEV_IOCTL_BLOCK_ERASE, block);
+                }
+            }
+            return RES_OK;
+        }
+
         default:
             return RES_PARERR;
     }
@@ -95,6 +95,23 @@ static mp_uint_t file_obj_write(mp_obj_t self_in, const void *buf, mp_uint_t siz
     return sz_out;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_VFS_FAT_FILE_DATA
+const uint8_t *mp_vfs_fat_file_data(FIL *fp) {
+    FATFS *fs = fp->obj.fs;
+    // Room for a single fragment: table size, cluster count, first cluster, terminator.
+    DWORD clmt[4] = { MP_ARRAY_SIZE(clmt) };
+    fp->cltbl = clmt;
+    FRESULT res = f_lseek(fp, CREATE_LINKMAP);
+    fp->cltbl = NULL;
+    if (res != FR_OK || f_size(fp) == 0) {
+        return NULL;
+    }
+    DWORD sector = fs->database + (clmt[2] - 2) * fs->csize;
+    return mp_vfs_blockdev_get_addr(&((fs_user_mount_t *)fs->drv)->blockdev, sector);
+}
+#endif
+
 static mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg, int *errcode) {
     pyb_file_obj_t *self = MP_OBJ_TO_PTR(o_in);
 
@@ -126,6 +143,36 @@ static mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg,
         }
         return 0;
 
+    // CIRCUITPY-CHANGE: poll as not ready while the block device is busy, so asyncio tasks can
+    // wait for it instead of blocking in the next read or write
+    #if MICROPY_PY_SELECT
+    } else if (request == MP_STREAM_POLL) {
+        if (self->fp.obj.fs == NULL) {
+            return MP_STREAM_POLL_NVAL;
+        }
+        fs_user_mount_t *vfs = (fs_user_mount_t *)self->fp.obj.fs->drv;
+        mp_obj_t busy = mp_vfs_blockdev_ioctl(&vfs->blockdev, MP_BLOCKDEV_IOCTL_BUSY, 0);
+        if (busy != mp_const_none && mp_obj_is_true(busy)) {
+            return 0;
+        }
+        return arg & (MP_STREAM_POLL_RD | MP_STREAM_POLL_WR);
+    #endif
+
+    // CIRCUITPY-CHANGE: a file in one run of clusters on memory-mapped flash can be read in place
+    #if MICROPY_VFS_FAT_FILE_DATA
+    } else if (request == MP_STREAM_GET_DATA_PTR) {
+        const void *data = mp_vfs_fat_file_data(&self->fp);
+        if (data == NULL) {
+            *errcode = MP_EINVAL;
+            return MP_STREAM_ERROR;
+        }
+        struct mp_stream_data_ptr_t *ptr = (struct mp_stream_data_ptr_t *)arg;
+        ptr->data = data;
+        // The flash stays mapped.
+        ptr->persistent = true;
+        return f_size(&self->fp);
+    #endif
+
     } else if (request == MP_STREAM_CLOSE) {
         // if fs==NULL then the file is closed and in that case this method is a no-op
         if (self->fp.obj.fs != NULL) {
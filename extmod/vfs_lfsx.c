@@ -93,13 +93,25 @@ static void MP_VFS_LFSx(init_config)(MP_OBJ_VFS_LFSx * self, mp_obj_t bdev, size
     config->block_count = bc;
 
     #if LFS_BUILD_VERSION == 1
-    config->lookahead = lookahead;
+    // CIRCUITPY-CHANGE: 0 picks the lookahead, as for littlefs v2.
+    config->lookahead = lookahead != 0 ? lookahead : 32;
     config->read_buffer = m_new(uint8_t, config->read_size);
     config->prog_buffer = m_new(uint8_t, config->prog_size);
     config->lookahead_buffer = m_new(uint8_t, config->lookahead / 8);
     #else
     config->block_cycles = 100;
-    config->cache_size = MIN(config->block_size, (4 * MAX(read_size, prog_size)));
+    // CIRCUITPY-CHANGE: Size the caches from the device. Native block devices only move whole
+    // blocks, so they are cached whole and each one written once when the cache is flushed. A
+    // lookahead of 0 covers every block, up to 2048 of them, so free blocks are found in one pass
+    // over the filesystem.
+    if (self->blockdev.flags & MP_BLOCKDEV_FLAG_NATIVE) {
+        config->cache_size = config->block_size;
+    } else {
+        config->cache_size = MIN(config->block_size, (4 * MAX(read_size, prog_size)));
+    }
+    if (lookahead == 0) {
+        lookahead = MIN((bc + 63) / 64 * 8, 256);
+    }
     config->lookahead_size = lookahead;
     config->read_buffer = m_new(uint8_t, config->cache_size);
     config->prog_buffer = m_new(uint8_t, config->cache_size);
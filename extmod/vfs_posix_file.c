@@ -39,11 +39,26 @@
 #define fsync _commit
 #else
 #include <poll.h>
+// CIRCUITPY-CHANGE
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_PERSISTENT_CODE_LOAD_IN_PLACE && !defined(_WIN32)
+#define VFS_POSIX_FILE_MAP (1)
+#else
+#define VFS_POSIX_FILE_MAP (0)
 #endif
 
 typedef struct _mp_obj_vfs_posix_file_t {
     mp_obj_base_t base;
     int fd;
+    // CIRCUITPY-CHANGE: mapping made by MP_STREAM_GET_DATA_PTR, removed on close
+    #if VFS_POSIX_FILE_MAP
+    void *map;
+    size_t map_len;
+    #endif
 } mp_obj_vfs_posix_file_t;
 
 #if MICROPY_CPYTHON_COMPAT
@@ -93,6 +108,10 @@ mp_obj_t mp_vfs_posix_file_open(const mp_obj_type_t *type, mp_obj_t file_in, mp_
 
     mp_obj_vfs_posix_file_t *o = mp_obj_malloc_with_finaliser(mp_obj_vfs_posix_file_t, type);
     o->fd = -1; // In case open() fails below, initialise this as a "closed" file object.
+    // CIRCUITPY-CHANGE
+    #if VFS_POSIX_FILE_MAP
+    o->map = NULL;
+    #endif
 
     mp_obj_t fid = file_in;
 
@@ -187,6 +206,13 @@ static mp_uint_t vfs_posix_file_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_
             return 0;
         }
         case MP_STREAM_CLOSE:
+            // CIRCUITPY-CHANGE
+            #if VFS_POSIX_FILE_MAP
+            if (o->map != NULL) {
+                munmap(o->map, o->map_len);
+                o->map = NULL;
+            }
+            #endif
             if (o->fd >= 0) {
                 MP_THREAD_GIL_EXIT();
                 close(o->fd);
@@ -196,6 +222,31 @@ static mp_uint_t vfs_posix_file_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_
             return 0;
         case MP_STREAM_GET_FILENO:
             return o->fd;
+        // CIRCUITPY-CHANGE: map the file so code can be run from it in place
+        #if VFS_POSIX_FILE_MAP
+        case MP_STREAM_GET_DATA_PTR: {
+            // The mapping goes when the file is closed, so code loaded from it
+            // is copied.  Another process can still change the file under it.
+            struct mp_stream_data_ptr_t *ptr = (struct mp_stream_data_ptr_t *)arg;
+            if (o->map == NULL) {
+                struct stat st;
+                if (fstat(o->fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+                    *errcode = MP_EINVAL;
+                    return MP_STREAM_ERROR;
+                }
+                void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, o->fd, 0);
+                if (data == MAP_FAILED) {
+                    *errcode = errno;
+                    return MP_STREAM_ERROR;
+                }
+                o->map = data;
+                o->map_len = st.st_size;
+            }
+            ptr->data = o->map;
+            ptr->persistent = false;
+            return o->map_len;
+        }
+        #endif
         #if MICROPY_PY_SELECT && !MICROPY_PY_SELECT_POSIX_OPTIMISATIONS
         case MP_STREAM_POLL: {
             #ifdef _WIN32
@@ -279,9 +330,10 @@ static const mp_stream_p_t vfs_posix_textio_stream_p = {
 
 #if MICROPY_PY_SYS_STDIO_BUFFER
 
-mp_obj_vfs_posix_file_t mp_sys_stdin_buffer_obj = {{&mp_type_vfs_posix_fileio}, STDIN_FILENO};
-mp_obj_vfs_posix_file_t mp_sys_stdout_buffer_obj = {{&mp_type_vfs_posix_fileio}, STDOUT_FILENO};
-mp_obj_vfs_posix_file_t mp_sys_stderr_buffer_obj = {{&mp_type_vfs_posix_fileio}, STDERR_FILENO};
+// CIRCUITPY-CHANGE: designated, so the fields for mapping are left out
+mp_obj_vfs_posix_file_t mp_sys_stdin_buffer_obj = {.base = {&mp_type_vfs_posix_fileio}, .fd = STDIN_FILENO};
+mp_obj_vfs_posix_file_t mp_sys_stdout_buffer_obj = {.base = {&mp_type_vfs_posix_fileio}, .fd = STDOUT_FILENO};
+mp_obj_vfs_posix_file_t mp_sys_stderr_buffer_obj = {.base = {&mp_type_vfs_posix_fileio}, .fd = STDERR_FILENO};
 
 // Forward declarations.
 mp_obj_vfs_posix_file_t mp_sys_stdin_obj;
@@ -332,8 +384,9 @@ MP_DEFINE_CONST_OBJ_TYPE(
     locals_dict, &vfs_posix_rawfile_locals_dict
     );
 
-mp_obj_vfs_posix_file_t mp_sys_stdin_obj = {{&mp_type_vfs_posix_textio}, STDIN_FILENO};
-mp_obj_vfs_posix_file_t mp_sys_stdout_obj = {{&mp_type_vfs_posix_textio}, STDOUT_FILENO};
-mp_obj_vfs_posix_file_t mp_sys_stderr_obj = {{&mp_type_vfs_posix_textio}, STDERR_FILENO};
+// CIRCUITPY-CHANGE: designated, so the fields for mapping are left out
+mp_obj_vfs_posix_file_t mp_sys_stdin_obj = {.base = {&mp_type_vfs_posix_textio}, .fd = STDIN_FILENO};
+mp_obj_vfs_posix_file_t mp_sys_stdout_obj = {.base = {&mp_type_vfs_posix_textio}, .fd = STDOUT_FILENO};
+mp_obj_vfs_posix_file_t mp_sys_stderr_obj = {.base = {&mp_type_vfs_posix_textio}, .fd = STDERR_FILENO};
 
 #endif // MICROPY_VFS_POSIX
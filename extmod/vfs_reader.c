@@ -76,13 +76,16 @@ static void mp_reader_vfs_close(void *data) {
     m_del_obj(mp_reader_vfs_t, reader);
 }
 
-void mp_reader_new_file(mp_reader_t *reader, qstr filename) {
+// CIRCUITPY-CHANGE: split up so that mp_reader_new_file_rom can read the file it opened
+static mp_obj_t mp_reader_vfs_open(qstr filename) {
     mp_obj_t args[2] = {
         MP_OBJ_NEW_QSTR(filename),
         MP_OBJ_NEW_QSTR(MP_QSTR_rb),
     };
-    mp_obj_t file = mp_vfs_open(MP_ARRAY_SIZE(args), &args[0], (mp_map_t *)&mp_const_empty_map);
+    return mp_vfs_open(MP_ARRAY_SIZE(args), &args[0], (mp_map_t *)&mp_const_empty_map);
+}
 
+static void mp_reader_new_vfs_file(mp_reader_t *reader, mp_obj_t file) {
     const mp_stream_p_t *stream_p = mp_get_stream(file);
     int errcode = 0;
     mp_uint_t bufsize = stream_p->ioctl(file, MP_STREAM_GET_BUFFER_SIZE, 0, &errcode);
@@ -107,4 +110,58 @@ void mp_reader_new_file(mp_reader_t *reader, qstr filename) {
     reader->close = mp_reader_vfs_close;
 }
 
+void mp_reader_new_file(mp_reader_t *reader, qstr filename) {
+    mp_reader_new_vfs_file(reader, mp_reader_vfs_open(filename));
+}
+
+// CIRCUITPY-CHANGE
+#if MICROPY_PERSISTENT_CODE_LOAD_IN_PLACE
+// Reads a mapping that is only valid while its file is open.
+typedef struct _mp_reader_vfs_mapped_t {
+    mp_obj_t file;
+    const byte *cur;
+    const byte *end;
+} mp_reader_vfs_mapped_t;
+
+static mp_uint_t mp_reader_vfs_mapped_readbyte(void *data) {
+    mp_reader_vfs_mapped_t *reader = (mp_reader_vfs_mapped_t *)data;
+    if (reader->cur < reader->end) {
+        return *reader->cur++;
+    } else {
+        return MP_READER_EOF;
+    }
+}
+
+static void mp_reader_vfs_mapped_close(void *data) {
+    mp_reader_vfs_mapped_t *reader = (mp_reader_vfs_mapped_t *)data;
+    // This removes the mapping.
+    mp_stream_close(reader->file);
+    m_del_obj(mp_reader_vfs_mapped_t, reader);
+}
+
+void mp_reader_new_file_rom(mp_reader_t *reader, qstr filename) {
+    mp_obj_t file = mp_reader_vfs_open(filename);
+
+    const mp_stream_p_t *stream_p = mp_get_stream(file);
+    int errcode = 0;
+    struct mp_stream_data_ptr_t ptr = { NULL, false };
+    mp_uint_t len = stream_p->ioctl(file, MP_STREAM_GET_DATA_PTR, (uintptr_t)&ptr, &errcode);
+    if (len == MP_STREAM_ERROR || len == 0 || ptr.data == NULL) {
+        // Streams that don't know the request may return 0.
+        mp_reader_new_vfs_file(reader, file);
+    } else if (ptr.persistent) {
+        mp_stream_close(file);
+        mp_reader_new_mem(reader, ptr.data, len, MP_READER_IS_ROM);
+    } else {
+        mp_reader_vfs_mapped_t *rm = m_new_obj(mp_reader_vfs_mapped_t);
+        rm->file = file;
+        rm->cur = ptr.data;
+        rm->end = ptr.data + len;
+        reader->data = rm;
+        reader->readbyte = mp_reader_vfs_mapped_readbyte;
+        reader->close = mp_reader_vfs_mapped_close;
+    }
+}
+#endif
+
 #endif // MICROPY_READER_VFS
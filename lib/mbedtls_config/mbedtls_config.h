@@ -67,6 +67,8 @@
 #define MBEDTLS_SSL_PROTO_TLS1_1
 #define MBEDTLS_SSL_PROTO_TLS1_2
 #define MBEDTLS_SSL_SERVER_NAME_INDICATION
+// Lets clients resume sessions with servers that keep no session state.
+#define MBEDTLS_SSL_SESSION_TICKETS
 
 // Use a smaller output buffer to reduce size of SSL context
 #define MBEDTLS_SSL_MAX_CONTENT_LEN (16384)
@@ -123,6 +125,12 @@ void m_tracked_free(void *ptr);
 time_t rp2_rtctime_seconds(time_t *timer);
 #define MBEDTLS_PLATFORM_TIME_MACRO rp2_rtctime_seconds
 
+// A port with crypto hardware can define MBEDTLS_PORT_ALT_CONFIG as a header that turns on the
+// matching MBEDTLS_*_ALT options, so that ssl and hashlib both use the hardware.
+#ifdef MBEDTLS_PORT_ALT_CONFIG
+#include MBEDTLS_PORT_ALT_CONFIG
+#endif
+
 #include "mbedtls/check_config.h"
 
 #endif /* MICROPY_INCLUDED_MBEDTLS_CONFIG_H */
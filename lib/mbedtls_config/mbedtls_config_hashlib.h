@@ -54,6 +54,12 @@ void m_tracked_free(void *ptr);
 #define MBEDTLS_PLATFORM_STD_FREE m_tracked_free
 #define MBEDTLS_PLATFORM_SNPRINTF_MACRO snprintf
 
+// A port with crypto hardware can define MBEDTLS_PORT_ALT_CONFIG as a header that turns on the
+// matching MBEDTLS_*_ALT options, so that ssl and hashlib both use the hardware.
+#ifdef MBEDTLS_PORT_ALT_CONFIG
+#include MBEDTLS_PORT_ALT_CONFIG
+#endif
+
 #include "mbedtls/check_config.h"
 
 #endif /* MICROPY_INCLUDED_MBEDTLS_CONFIG_H */
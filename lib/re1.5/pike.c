@@ -0,0 +1,168 @@
+// Copyright 2007-2009 Russ Cox.  All Rights Reserved.
+// Copyright 2014 Paul Sokolovsky.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+// CIRCUITPY-CHANGE: Pike VM working directly on the bytecode of compilecode.c
+
+#include "re1.5.h"
+
+#ifndef re1_5_malloc
+#define re1_5_malloc(n) malloc(n)
+#define re1_5_free(p, n) free(p)
+#endif
+
+// Runs every alternative at once, one input character at a time, so the time taken grows with
+// the length of the input times the length of the program, and the stack used only with the
+// length of the program. Threads are kept in priority order and a match stops the lower
+// priority ones, so the result is the same as that of the backtracking matcher.
+
+typedef struct {
+	int n;
+	int *pcs;
+	const char **subs;
+} ThreadList;
+
+typedef struct {
+	ByteProg *prog;
+	Subject *input;
+	int nsubp;
+	int gen;
+	int *marks;
+} PikeState;
+
+static void
+addthread(PikeState *st, ThreadList *l, int pc, const char *sp, const char **sub)
+{
+	char *code = st->prog->insts;
+	int off;
+	const char *old;
+
+	re1_5_stack_chk();
+
+	for(;;) {
+		if(st->marks[pc] == st->gen)
+			return;
+		st->marks[pc] = st->gen;
+		switch(code[pc]) {
+		case Jmp:
+			pc = pc + 2 + (signed char)code[pc + 1];
+			continue;
+		case Split:
+			off = (signed char)code[pc + 1];
+			addthread(st, l, pc + 2, sp, sub);
+			pc = pc + 2 + off;
+			continue;
+		case RSplit:
+			off = (signed char)code[pc + 1];
+			addthread(st, l, pc + 2 + off, sp, sub);
+			pc = pc + 2;
+			continue;
+		case Save:
+			off = (unsigned char)code[pc + 1];
+			if(off >= st->nsubp) {
+				pc += 2;
+				continue;
+			}
+			old = sub[off];
+			sub[off] = sp;
+			addthread(st, l, pc + 2, sp, sub);
+			sub[off] = old;
+			return;
+		case Bol:
+			if(sp != st->input->begin_line)
+				return;
+			pc++;
+			continue;
+		case Eol:
+			if(sp != st->input->end)
+				return;
+			pc++;
+			continue;
+		}
+		// A consumer or Match waits in the list for the next character.
+		l->pcs[l->n] = pc;
+		memcpy(l->subs + l->n * st->nsubp, sub, st->nsubp * sizeof(*sub));
+		l->n++;
+		return;
+	}
+}
+
+int
+re1_5_pikevm(ByteProg *prog, Subject *input, const char **subp, int nsubp, int is_anchored)
+{
+	// No more threads than instructions can be waiting, as each pc is added once per step.
+	int nthreads = prog->len;
+	size_t size = 2 * nthreads * (nsubp * sizeof(*subp) + sizeof(int))
+		+ prog->bytelen * sizeof(int);
+	char *mem = re1_5_malloc(size);
+	const char **subs = (const char **)mem;
+	int *pcs = (int *)(subs + 2 * nthreads * nsubp);
+	PikeState st = {
+		.prog = prog,
+		.input = input,
+		.nsubp = nsubp,
+		.gen = 0,
+		.marks = pcs + 2 * nthreads,
+	};
+	ThreadList lists[2];
+	ThreadList *clist = &lists[0];
+	ThreadList *nlist = &lists[1];
+	for(int i = 0; i < 2; i++) {
+		lists[i].n = 0;
+		lists[i].pcs = pcs + i * nthreads;
+		lists[i].subs = subs + i * nthreads * nsubp;
+	}
+	for(int i = 0; i < prog->bytelen; i++)
+		st.marks[i] = -1;
+
+	char *code = prog->insts;
+	int matched = 0;
+	addthread(&st, clist, HANDLE_ANCHORED(code, is_anchored) - code, input->begin, subp);
+	for(const char *sp = input->begin; clist->n > 0; sp++) {
+		st.gen++;
+		nlist->n = 0;
+		for(int i = 0; i < clist->n; i++) {
+			int pc = clist->pcs[i];
+			const char **sub = clist->subs + i * nsubp;
+			if(code[pc] == Match) {
+				memcpy(subp, sub, nsubp * sizeof(*subp));
+				matched = 1;
+				// Threads after this one have lower priority.
+				break;
+			}
+			if(sp >= input->end)
+				continue;
+			switch(code[pc]) {
+			case Char:
+				if(*sp != code[pc + 1])
+					continue;
+				pc += 2;
+				break;
+			case Any:
+				pc++;
+				break;
+			case Class:
+			case ClassNot:
+				if(!_re1_5_classmatch(code + pc + 1, sp))
+					continue;
+				pc += (unsigned char)code[pc + 1] * 2 + 2;
+				break;
+			case NamedClass:
+				if(!_re1_5_namedclassmatch(code + pc + 1, sp))
+					continue;
+				pc += 2;
+				break;
+			default:
+				re1_5_fatal("pikevm");
+			}
+			addthread(&st, nlist, pc, sp + 1, sub);
+		}
+		ThreadList *t = clist;
+		clist = nlist;
+		nlist = t;
+	}
+
+	re1_5_free(mem, size);
+	return matched;
+}
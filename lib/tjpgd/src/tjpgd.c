@@ -700,7 +700,9 @@ static void block_idct (
 /*-----------------------------------------------------------------------*/
 
 static JRESULT mcu_load (
-	JDEC* jd		/* Pointer to the decompressor object */
+	JDEC* jd,		/* Pointer to the decompressor object */
+	// CIRCUITPY-CHANGE: only advance through the stream for MCUs that won't be output
+	int skip		/* Decode the huffman data without producing the blocks */
 )
 {
 	int32_t *tmp = (int32_t*)jd->workbuf;	/* Block working buffer for de-quantize and IDCT */
@@ -758,7 +760,8 @@ static JRESULT mcu_load (
 				}
 			} while (++z < 64);		/* Next AC element */
 
-			if (JD_FORMAT != 2 || !cmp) {	/* C components may not be processed if in grayscale output */
+			// CIRCUITPY-CHANGE: skip
+			if (!skip && (JD_FORMAT != 2 || !cmp)) {	/* C components may not be processed if in grayscale output */
 				if (z == 1 || (JD_USE_SCALE && jd->scale == 3)) {	/* If no AC element or scale ratio is 1/8, IDCT can be ommited and the block is filled with DC value */
 					d = (jd_yuv_t)((*tmp / 256) + 128);
 					if (JD_FASTDECODE >= 1) {
@@ -1088,6 +1091,10 @@ JRESULT jd_prepare (
 			}
 			jd->dptr = seg + ofs - (JD_FASTDECODE ? 0 : 1);
 
+			// CIRCUITPY-CHANGE
+			jd->roi.left = jd->roi.top = 0;
+			jd->roi.right = jd->roi.bottom = 0xFFFF;
+
 			return JDR_OK;		/* Initialization succeeded. Ready to decompress the JPEG image. */
 
 		case 0xC1:	/* SOF1 */
@@ -1140,14 +1147,20 @@ JRESULT jd_decomp (
 
 	rc = JDR_OK;
 	for (y = 0; y < jd->height; y += my) {		/* Vertical loop of MCUs */
+		// CIRCUITPY-CHANGE: nothing more is wanted once below the area of interest
+		if ((y >> scale) > jd->roi.bottom) break;
+		int skip_row = ((y + my - 1) >> scale) < jd->roi.top;
 		for (x = 0; x < jd->width; x += mx) {	/* Horizontal loop of MCUs */
 			if (jd->nrst && rst++ == jd->nrst) {	/* Process restart interval if enabled */
 				rc = restart(jd, rsc++);
 				if (rc != JDR_OK) return rc;
 				rst = 1;
 			}
-			rc = mcu_load(jd);					/* Load an MCU (decompress huffman coded stream, dequantize and apply IDCT) */
+			// CIRCUITPY-CHANGE: MCUs outside the area of interest skip IDCT and output
+			int skip = skip_row || ((x + mx - 1) >> scale) < jd->roi.left || (x >> scale) > jd->roi.right;
+			rc = mcu_load(jd, skip);			/* Load an MCU (decompress huffman coded stream, dequantize and apply IDCT) */
 			if (rc != JDR_OK) return rc;
+			if (skip) continue;
 			rc = mcu_output(jd, outfunc, x, y);	/* Output the MCU (YCbCr to RGB, scaling and output) */
 			if (rc != JDR_OK) return rc;
 		}
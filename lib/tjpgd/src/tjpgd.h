@@ -86,6 +86,9 @@ struct JDEC {
 	size_t sz_pool;				/* Size of momory pool (bytes available) */
 	size_t (*infunc)(JDEC*, uint8_t*, size_t);	/* Pointer to jpeg stream input function */
 	void* device;				/* Pointer to I/O device identifiler for the session */
+	// CIRCUITPY-CHANGE: MCUs that don't overlap this area of the output image are only entropy
+	// decoded, and decoding stops below it. jd_prepare sets it to the whole image.
+	JRECT roi;
 };
 
 
@@ -18,6 +18,7 @@
 #include "py/runtime.h"
 #include "py/repl.h"
 #include "py/gc.h"
+#include "py/profile.h"
 #include "py/stackctrl.h"
 
 #include "shared/readline/readline.h"
@@ -30,6 +31,7 @@
 #include "supervisor/cpu.h"
 #include "supervisor/filesystem.h"
 #include "supervisor/port.h"
+#include "supervisor/shared/offload.h"
 #include "supervisor/shared/reload.h"
 #include "supervisor/shared/safe_mode.h"
 #include "supervisor/shared/serial.h"
@@ -65,6 +67,14 @@
 #include "shared-module/board/__init__.h"
 #endif
 
+#if CIRCUITPY_BUSIO
+#include "shared-bindings/busio/__init__.h"
+#endif
+
+#if CIRCUITPY_NEOPIXEL_WRITE
+#include "shared-bindings/neopixel_write/__init__.h"
+#endif
+
 #if CIRCUITPY_CANIO
 #include "common-hal/canio/CAN.h"
 #endif
@@ -82,6 +92,10 @@
 #include "shared-module/keypad/__init__.h"
 #endif
 
+#if CIRCUITPY_MDNS
+#include "shared-bindings/mdns/__init__.h"
+#endif
+
 #if CIRCUITPY_MEMORYMONITOR
 #include "shared-module/memorymonitor/__init__.h"
 #endif
@@ -123,6 +137,9 @@ static void reset_devices(void) {
 
 static uint8_t *_heap;
 static uint8_t *_pystack;
+#if MICROPY_GC_FAST_AREA_MAX_BLOCKS
+static uint8_t *_gc_fast_area;
+#endif
 
 static const char line_clear[] = "\x1b[2K\x1b[0G";
 
@@ -192,6 +209,14 @@ static void start_mp(safe_mode_t safe_mode) {
     size_t heap_size = 0;
     _heap = _allocate_memory(safe_mode, "CIRCUITPY_HEAP_START_SIZE", CIRCUITPY_HEAP_START_SIZE, &heap_size);
     gc_init(_heap, _heap + heap_size);
+
+    #if MICROPY_GC_FAST_AREA_MAX_BLOCKS
+    // The fast area is optional so carry on without it if it doesn't fit.
+    _gc_fast_area = port_malloc_fast(CIRCUITPY_GC_FAST_AREA_SIZE);
+    if (_gc_fast_area != NULL) {
+        gc_add_fast_area(_gc_fast_area, _gc_fast_area + CIRCUITPY_GC_FAST_AREA_SIZE);
+    }
+    #endif
     #endif
     mp_init();
     mp_obj_list_init((mp_obj_list_t *)mp_sys_path, 0);
@@ -206,6 +231,11 @@ static void start_mp(safe_mode_t safe_mode) {
 }
 
 static void stop_mp(void) {
+    #if MICROPY_PY_MICROPYTHON_PROFILE
+    // Stop sampling into the table on the heap that is about to go away.
+    mp_prof_sample_stop();
+    #endif
+
     #if MICROPY_VFS
     mp_vfs_mount_t *vfs = MP_STATE_VM(vfs_mount_table);
 
@@ -234,6 +264,10 @@ static void stop_mp(void) {
     gc_deinit();
     port_free(_heap);
     _heap = NULL;
+    #if MICROPY_GC_FAST_AREA_MAX_BLOCKS
+    port_free(_gc_fast_area);
+    _gc_fast_area = NULL;
+    #endif
 
     #if MICROPY_ENABLE_PYSTACK
     port_free(_pystack);
@@ -348,6 +382,9 @@ static void cleanup_after_vm(mp_obj_t exception) {
         }
     }
 
+    // Finish work on the second core first, as it may use buffers on the heap.
+    supervisor_offload_stop();
+
     // Reset port-independent devices, like CIRCUITPY_BLEIO_HCI.
     reset_devices();
 
@@ -377,6 +414,18 @@ static void cleanup_after_vm(mp_obj_t exception) {
     keypad_reset();
     #endif
 
+    #if CIRCUITPY_BUSIO
+    busio_async_reset();
+    #endif
+
+    #if CIRCUITPY_NEOPIXEL_WRITE
+    neopixel_write_reset();
+    #endif
+
+    #if CIRCUITPY_MDNS
+    mdns_user_reset();
+    #endif
+
     // Close user-initiated sockets.
     #if CIRCUITPY_SOCKETPOOL
     socketpool_user_reset();
@@ -416,6 +465,17 @@ static void print_code_py_status_message(safe_mode_t safe_mode) {
     }
 }
 
+// Limits an idle of ticks (zero for until an interrupt) so that a pending autoreload isn't delayed.
+static uint32_t idle_ticks_until_reload(uint32_t ticks) {
+    uint32_t ms = autoreload_ms_until_ready();
+    if (ms == UINT32_MAX) {
+        return ticks;
+    }
+    // autoreload_ready() needs a little more than the delay to have passed.
+    ms += 1;
+    return (ticks == 0 || ms < ticks) ? ms : ticks;
+}
+
 static bool __attribute__((noinline)) run_code_py(safe_mode_t safe_mode, bool *simulate_reset) {
     bool serial_connected_at_start = serial_connected();
     bool printed_safe_mode_message = false;
@@ -457,6 +517,8 @@ static bool __attribute__((noinline)) run_code_py(safe_mode_t safe_mode, bool *s
         usb_setup_with_vm();
         #endif
 
+        supervisor_mark_boot_complete();
+
         // Check if a different run file has been allocated
         if (next_code_configuration != NULL) {
             next_code_configuration->options &= ~SUPERVISOR_NEXT_CODE_OPT_NEWLY_SET;
@@ -673,6 +735,7 @@ static bool __attribute__((noinline)) run_code_py(safe_mode_t safe_mode, bool *s
                 if (awoke_from_true_deep_sleep || !supervisor_workflow_active()) {
                     // Enter true deep sleep. When we wake up we'll be back at the
                     // top of main(), not in this loop.
+                    serial_flush_output();
                     common_hal_alarm_enter_deep_sleep();
                     // Does not return.
                 } else {
@@ -694,10 +757,6 @@ static bool __attribute__((noinline)) run_code_py(safe_mode_t safe_mode, bool *s
             if (time_to_epaper_refresh > 0 && !autoreload_pending()) {
                 time_to_epaper_refresh = maybe_refresh_epaperdisplay();
             }
-
-            #if !CIRCUITPY_STATUS_LED
-            port_interrupt_after_ticks(time_to_epaper_refresh);
-            #endif
             #endif
 
             #if CIRCUITPY_STATUS_LED
@@ -741,13 +800,16 @@ static bool __attribute__((noinline)) run_code_py(safe_mode_t safe_mode, bool *s
             // time_to_next_change is in ms and ticks are slightly shorter so
             // we'll undersleep just a little. It shouldn't matter.
             if (time_to_next_change > 0) {
-                port_interrupt_after_ticks(time_to_next_change);
-                port_idle_until_interrupt();
+                supervisor_idle_until_interrupt(idle_ticks_until_reload(time_to_next_change));
             }
+            #elif CIRCUITPY_EPAPERDISPLAY
+            // No status LED can we sleep until we are interrupted by some
+            // interaction or the ePaper display is due.
+            supervisor_idle_until_interrupt(idle_ticks_until_reload(time_to_epaper_refresh));
             #else
             // No status LED can we sleep until we are interrupted by some
             // interaction.
-            port_idle_until_interrupt();
+            supervisor_idle_until_interrupt(idle_ticks_until_reload(0));
             #endif
         }
     }
@@ -993,6 +1055,9 @@ int __attribute__((used)) main(void) {
     set_safe_mode(port_init());
 
     port_heap_init();
+    #if CIRCUITPY_PORT_HEAP_POOLS
+    port_heap_pool_init();
+    #endif
 
     // Turn on RX and TX LEDs if we have them.
     init_rxtx_leds();
@@ -1171,6 +1236,10 @@ void gc_collect(void) {
     common_hal_wifi_gc_collect();
     #endif
 
+    #if CIRCUITPY_MDNS
+    mdns_gc_collect();
+    #endif
+
     // This naively collects all object references from an approximate stack
     // range.
     gc_collect_root((void **)sp, ((mp_uint_t)port_stack_get_top() - sp) / sizeof(mp_uint_t));
@@ -131,6 +131,8 @@ static int usage(char **argv) {
         "Target specific options:\n"
         "-msmall-int-bits=number : set the maximum bits used to encode a small-int\n"
         "-march=<arch> : set architecture for native emitter; x86, x64, armv6, armv6m, armv7m, armv7em, armv7emsp, armv7emdp, xtensa, xtensawin\n"
+        // CIRCUITPY-CHANGE
+        "-mfused-ops : fuse common opcode sequences; needs a target built with MICROPY_BC_FUSED_OPS\n"
         "\n"
         "Implementation specific options:\n", argv[0]
         );
@@ -236,6 +238,8 @@ MP_NOINLINE int main_(int argc, char **argv) {
     // don't support native emitter unless -march is specified
     mp_dynamic_compiler.native_arch = MP_NATIVE_ARCH_NONE;
     mp_dynamic_compiler.nlr_buf_num_regs = 0;
+    // CIRCUITPY-CHANGE
+    mp_dynamic_compiler.bc_fused_ops = false;
 
     const char *input_file = NULL;
     const char *output_file = NULL;
@@ -331,6 +335,9 @@ MP_NOINLINE int main_(int argc, char **argv) {
                 } else {
                     return usage(argv);
                 }
+            // CIRCUITPY-CHANGE
+            } else if (strcmp(argv[a], "-mfused-ops") == 0) {
+                mp_dynamic_compiler.bc_fused_ops = true;
             } else if (strcmp(argv[a], "--") == 0) {
                 option_parsing_active = false;
             } else {
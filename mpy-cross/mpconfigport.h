@@ -53,6 +53,8 @@
 
 #define MICROPY_DYNAMIC_COMPILER    (1)
 #define MICROPY_COMP_CONST_FOLDING  (1)
+// CIRCUITPY-CHANGE
+#define MICROPY_COMP_CONST_FOLDING_FLOAT_STR (1)
 #define MICROPY_COMP_MODULE_CONST   (1)
 #define MICROPY_COMP_CONST          (1)
 #define MICROPY_COMP_DOUBLE_TUPLE_ASSIGN (1)
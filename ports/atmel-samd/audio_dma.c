@@ -178,6 +178,7 @@ audio_dma_result audio_dma_setup_playback(audio_dma_t *dma,
 
     dma->sample = sample;
     dma->loop = loop;
+    dma->underruns = 0;
     dma->single_channel_output = single_channel_output;
     dma->audio_channel = audio_channel;
     dma->dma_channel = dma_channel;
@@ -340,6 +341,10 @@ void audio_dma_reset(void) {
     }
 }
 
+uint32_t audio_dma_get_underruns(audio_dma_t *dma) {
+    return dma->underruns;
+}
+
 bool audio_dma_get_playing(audio_dma_t *dma) {
     if (dma->dma_channel >= AUDIO_DMA_CHANNEL_COUNT) {
         return false;
@@ -389,6 +394,10 @@ void audio_dma_evsys_handler(void) {
         // of which buffer to fill here appears correct.
         DmacDescriptor *next_descriptor =
             (DmacDescriptor *)dma_write_back_descriptor(dma->dma_channel)->DESCADDR.reg;
+        // The previous block wasn't loaded before the DMA came back around to it.
+        if (dma->buffer_to_load != NO_BUFFER_TO_LOAD) {
+            dma->underruns++;
+        }
         if (next_descriptor == dma->descriptor[0]) {
             dma->buffer_to_load = 0;
         } else if (next_descriptor == dma->descriptor[1]) {
@@ -399,7 +408,7 @@ void audio_dma_evsys_handler(void) {
             continue;
         }
 
-        background_callback_add(&dma->callback, dma_callback_fun, (void *)dma);
+        background_callback_add_with_priority(&dma->callback, dma_callback_fun, (void *)dma, BACKGROUND_CALLBACK_PRIORITY_REALTIME);
     }
 }
 
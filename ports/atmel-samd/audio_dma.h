@@ -20,6 +20,7 @@ typedef struct {
     DmacDescriptor *descriptor[2];
     DmacDescriptor second_descriptor;
     background_callback_t callback;
+    uint32_t underruns; // buffers played before they were reloaded
     uint8_t dma_channel;
     uint8_t event_channel;
     uint8_t audio_channel;
@@ -69,6 +70,7 @@ bool audio_dma_get_playing(audio_dma_t *dma);
 void audio_dma_pause(audio_dma_t *dma);
 void audio_dma_resume(audio_dma_t *dma);
 bool audio_dma_get_paused(audio_dma_t *dma);
+uint32_t audio_dma_get_underruns(audio_dma_t *dma);
 
 void audio_dma_background(void);
 
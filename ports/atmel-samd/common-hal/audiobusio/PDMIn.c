@@ -17,6 +17,7 @@
 #include "shared-bindings/audiobusio/PDMIn.h"
 #include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/microcontroller/Pin.h"
+#include "shared-module/audiobusio/pdm_filter.h"
 
 #include "atmel_start_pins.h"
 #include "hal/include/hal_gpio.h"
@@ -313,16 +314,14 @@ static void setup_dma(audiobusio_pdmin_obj_t *self, uint32_t length,
     }
 }
 
+#ifdef SAMD21
 // a windowed sinc filter for 44 khz, 64 samples
 //
 // This filter is good enough to use for lower sample rates as
 // well. It does not increase the noise enough to be a problem.
 //
-// In the long run we could use a fast filter like this to do the
-// decimation and initial filtering in real time, filtering to a
-// higher sample rate than specified.  Then after the audio is
-// recorded, a more expensive filter non-real-time filter could be
-// used to down-sample and low-pass.
+// This is the same filter as audiobusio_pdm_filter_table, applied a
+// bit at a time because the SAMD21 doesn't have room for the table.
 const uint16_t sinc_filter[OVERSAMPLING] = {
     0, 2, 9, 21, 39, 63, 94, 132,
     179, 236, 302, 379, 467, 565, 674, 792,
@@ -334,11 +333,7 @@ const uint16_t sinc_filter[OVERSAMPLING] = {
     94, 63, 39, 21, 9, 2, 0, 0
 };
 
-#ifdef SAMD21
 #define REPEAT_16_TIMES(X) do { for (uint8_t j = 0; j < 4; j++) { X X X X } } while (0)
-#else
-#define REPEAT_16_TIMES(X) do { X X X X X X X X X X X X X X X X } while (0)
-#endif
 
 static uint16_t filter_sample(uint32_t pdm_samples[4]) {
     uint16_t running_sum = 0;
@@ -359,6 +354,14 @@ static uint16_t filter_sample(uint32_t pdm_samples[4]) {
     }
     return running_sum;
 }
+#else
+static uint16_t filter_sample(uint32_t pdm_samples[4]) {
+    // Each word holds 16 bits of the left channel in its lower two bytes,
+    // earliest bit first. The upper bytes are a phantom right channel.
+    return audiobusio_pdm_filter(pdm_samples[0] >> 8, pdm_samples[0], pdm_samples[1] >> 8, pdm_samples[1],
+        pdm_samples[2] >> 8, pdm_samples[2], pdm_samples[3] >> 8, pdm_samples[3]);
+}
+#endif
 
 // output_buffer may be a byte buffer or a halfword buffer.
 // output_buffer_length is the number of slots, not the number of bytes.
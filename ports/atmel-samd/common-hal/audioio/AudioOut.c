@@ -435,6 +435,14 @@ bool common_hal_audioio_audioout_get_paused(audioio_audioout_obj_t *self) {
     return audio_dma_get_paused(&self->left_dma);
 }
 
+uint32_t common_hal_audioio_audioout_get_underruns(audioio_audioout_obj_t *self) {
+    uint32_t underruns = audio_dma_get_underruns(&self->left_dma);
+    #ifdef SAM_D5X_E5X
+    underruns = MAX(underruns, audio_dma_get_underruns(&self->right_dma));
+    #endif
+    return underruns;
+}
+
 void common_hal_audioio_audioout_stop(audioio_audioout_obj_t *self) {
     // Do not stop the timer here. There are occasional audible artifacts if the DMA-triggering timer
     // is stopped between audio plays. (Heard this only on PyPortal with one particular 32kHz sample.)
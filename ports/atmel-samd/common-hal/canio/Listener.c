@@ -331,25 +331,32 @@ int common_hal_canio_listener_in_waiting(canio_listener_obj_t *self) {
     return self->hw->RXFS.bit.F0FL;
 }
 
-mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+// Waits up to the timeout for a message, returning whether there is one.
+static bool wait_for_message(canio_listener_obj_t *self) {
     if (!common_hal_canio_listener_in_waiting(self)) {
         uint64_t deadline = supervisor_ticks_ms64() + self->timeout_ms;
         do {
             if (supervisor_ticks_ms64() > deadline) {
-                return NULL;
+                return false;
             }
             RUN_BACKGROUND_TASKS;
             // Allow user to break out of a timeout with a KeyboardInterrupt.
             if (mp_hal_is_interrupted()) {
-                return NULL;
+                return false;
             }
         } while (!common_hal_canio_listener_in_waiting(self));
     }
+    return true;
+}
+
+bool common_hal_canio_listener_receive_into(canio_listener_obj_t *self, canio_message_obj_t *message, bool wait) {
+    if (wait ? !wait_for_message(self) : !common_hal_canio_listener_in_waiting(self)) {
+        return false;
+    }
     int index = self->hw->RXFS.bit.F0GI;
     canio_can_rx_fifo_t *hw_message = &self->fifo[index];
     bool rtr = hw_message->rxf0.bit.RTR;
-    canio_message_obj_t *message =
-        mp_obj_malloc(canio_message_obj_t, rtr ? &canio_remote_transmission_request_type : &canio_message_type);
+    message->base.type = rtr ? &canio_remote_transmission_request_type : &canio_message_type;
     message->extended = hw_message->rxf0.bit.XTD;
     if (message->extended) {
         message->id = hw_message->rxf0.bit.ID;
@@ -361,7 +368,7 @@ mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
         memcpy(message->data, hw_message->data, message->size);
     }
     self->hw->RXFA.bit.F0AI = index;
-    return message;
+    return true;
 }
 
 void common_hal_canio_listener_deinit(canio_listener_obj_t *self) {
@@ -107,7 +107,8 @@ void frequencyin_interrupt_handler(uint8_t index) {
                     // ms difference will not need 64 bits. If we use 64 bits,
                     // double-precision float routines are required, and we don't
                     // want to include them because they're very large.
-                    self->factor = (uint32_t) (current_ns - self->last_ns) / 1000000.0;
+                    uint32_t elapsed_ns = (uint32_t) (current_ns - self->last_ns);
+                    self->factor = elapsed_ns / 1000000.0;
                     self->last_ns = current_ns;
 
                     #ifdef SAM_D5X_E5X
@@ -124,6 +125,16 @@ void frequencyin_interrupt_handler(uint8_t index) {
                     }
                     self->frequency = new_freq;
 
+                    if (self->windows == 0 || new_freq < self->min_count) {
+                        self->min_count = new_freq;
+                    }
+                    if (self->windows == 0 || new_freq > self->max_count) {
+                        self->max_count = new_freq;
+                    }
+                    self->total_count += new_freq;
+                    self->total_ms += elapsed_ns / 1000000;
+                    self->windows++;
+
                     #ifdef SAM_D5X_E5X
                     tc->COUNT16.CTRLBSET.bit.CMD = TC_CTRLBSET_CMD_RETRIGGER_Val;
                     while ((tc->COUNT16.SYNCBUSY.bit.COUNT == 1) ||
@@ -289,6 +300,9 @@ void common_hal_frequencyio_frequencyin_construct(frequencyio_frequencyin_obj_t*
     self->channel = pin->extint_channel;
     self->errored_too_fast = false;
     self->last_ns = 0;
+    self->windows = 0;
+    self->total_count = 0;
+    self->total_ms = 0;
     self->capture_period = capture_period;
     #ifdef SAMD21
     self->TC_IRQ = TC3_IRQn + timer_index;
@@ -446,7 +460,7 @@ void common_hal_frequencyio_frequencyin_deinit(frequencyio_frequencyin_obj_t* se
     }
 }
 
-uint32_t common_hal_frequencyio_frequencyin_get_item(frequencyio_frequencyin_obj_t* self) {
+static void disable_capture_interrupts(frequencyio_frequencyin_obj_t *self) {
     NVIC_DisableIRQ(self->TC_IRQ);
     #ifdef SAMD21
     NVIC_DisableIRQ(EIC_IRQn);
@@ -454,6 +468,23 @@ uint32_t common_hal_frequencyio_frequencyin_get_item(frequencyio_frequencyin_obj
     #ifdef SAM_D5X_E5X
     NVIC_DisableIRQ(EIC_0_IRQn + self->channel);
     #endif
+}
+
+static void enable_capture_interrupts(frequencyio_frequencyin_obj_t *self) {
+    NVIC_ClearPendingIRQ(self->TC_IRQ);
+    NVIC_EnableIRQ(self->TC_IRQ);
+    #ifdef SAMD21
+    NVIC_ClearPendingIRQ(EIC_IRQn);
+    NVIC_EnableIRQ(EIC_IRQn);
+    #endif
+    #ifdef SAM_D5X_E5X
+    NVIC_ClearPendingIRQ(EIC_0_IRQn + self->channel);
+    NVIC_EnableIRQ(EIC_0_IRQn + self->channel);
+    #endif
+}
+
+uint32_t common_hal_frequencyio_frequencyin_get_item(frequencyio_frequencyin_obj_t* self) {
+    disable_capture_interrupts(self);
 
     // adjust for actual capture period vs base `capture_period`
     float frequency_adjustment = 0.0;
@@ -469,16 +500,7 @@ uint32_t common_hal_frequencyio_frequencyin_get_item(frequencyio_frequencyin_obj
 
     float value = 1000 / (self->capture_period / (self->frequency + frequency_adjustment));
 
-    NVIC_ClearPendingIRQ(self->TC_IRQ);
-    NVIC_EnableIRQ(self->TC_IRQ);
-    #ifdef SAMD21
-    NVIC_ClearPendingIRQ(EIC_IRQn);
-    NVIC_EnableIRQ(EIC_IRQn);
-    #endif
-    #ifdef SAM_D5X_E5X
-    NVIC_ClearPendingIRQ(EIC_0_IRQn + self->channel);
-    NVIC_EnableIRQ(EIC_0_IRQn + self->channel);
-    #endif
+    enable_capture_interrupts(self);
 
     return value;
 }
@@ -521,29 +543,39 @@ void common_hal_frequencyio_frequencyin_resume(frequencyio_frequencyin_obj_t* se
 }
 
 void common_hal_frequencyio_frequencyin_clear(frequencyio_frequencyin_obj_t* self) {
-    NVIC_DisableIRQ(self->TC_IRQ);
-    #ifdef SAMD21
-    NVIC_DisableIRQ(EIC_IRQn);
-    #endif
-    #ifdef SAM_D5X_E5X
-    NVIC_DisableIRQ(EIC_0_IRQn + self->channel);
-    #endif
+    disable_capture_interrupts(self);
 
     self->frequency = 0;
+    self->windows = 0;
+    self->total_count = 0;
+    self->total_ms = 0;
 
-    NVIC_ClearPendingIRQ(self->TC_IRQ);
-    NVIC_EnableIRQ(self->TC_IRQ);
-    #ifdef SAMD21
-    NVIC_ClearPendingIRQ(EIC_IRQn);
-    NVIC_EnableIRQ(EIC_IRQn);
-    #endif
-    #ifdef SAM_D5X_E5X
-    NVIC_ClearPendingIRQ(EIC_0_IRQn + self->channel);
-    NVIC_EnableIRQ(EIC_0_IRQn + self->channel);
-    #endif
+    enable_capture_interrupts(self);
     return;
 }
 
+void common_hal_frequencyio_frequencyin_get_statistics(frequencyio_frequencyin_obj_t *self, frequencyio_statistics_t *stats) {
+    disable_capture_interrupts(self);
+    uint32_t windows = self->windows;
+    uint32_t min_count = self->min_count;
+    uint32_t max_count = self->max_count;
+    uint64_t total_count = self->total_count;
+    uint32_t total_ms = self->total_ms;
+    self->windows = 0;
+    self->total_count = 0;
+    self->total_ms = 0;
+    enable_capture_interrupts(self);
+
+    stats->windows = windows;
+    if (windows == 0 || total_ms == 0) {
+        stats->min = stats->max = stats->mean = 0;
+        return;
+    }
+    stats->min = min_count * 1000 / self->capture_period;
+    stats->max = max_count * 1000 / self->capture_period;
+    stats->mean = total_count * 1000 / total_ms;
+}
+
 uint16_t common_hal_frequencyio_frequencyin_get_capture_period(frequencyio_frequencyin_obj_t *self) {
     return self->capture_period;
 }
@@ -20,6 +20,12 @@ typedef struct {
     volatile uint64_t last_ns;
     float factor;
     uint32_t capture_period;
+    // Statistics of the counts of each capture period.
+    uint32_t windows;
+    uint32_t min_count;
+    uint32_t max_count;
+    uint64_t total_count;
+    uint32_t total_ms;
     uint8_t TC_IRQ;
     volatile bool errored_too_fast;
 } frequencyio_frequencyin_obj_t;
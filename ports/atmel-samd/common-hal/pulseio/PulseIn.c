@@ -302,6 +302,26 @@ uint16_t common_hal_pulseio_pulsein_popleft(pulseio_pulsein_obj_t *self) {
     return value;
 }
 
+size_t common_hal_pulseio_pulsein_readinto(pulseio_pulsein_obj_t *self, uint16_t *buffer, size_t len) {
+    if (self->errored_too_fast) {
+        self->errored_too_fast = 0;
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Input taking too long"));
+    }
+    common_hal_mcu_disable_interrupts();
+    size_t count = MIN(len, self->len);
+    size_t start = self->start;
+    for (size_t i = 0; i < count; i++) {
+        buffer[i] = self->buffer[start];
+        if (++start == self->maxlen) {
+            start = 0;
+        }
+    }
+    self->start = start;
+    self->len -= count;
+    common_hal_mcu_enable_interrupts();
+    return count;
+}
+
 uint16_t common_hal_pulseio_pulsein_get_maxlen(pulseio_pulsein_obj_t *self) {
     return self->maxlen;
 }
@@ -116,6 +116,23 @@
 // Smallest unit of flash that can be erased.
 #define FLASH_ERASE_SIZE NVMCTRL_ROW_SIZE
 
+#ifndef SPI_FLASH_CACHE_SECTORS
+// Each cached sector takes 4kB of the heap, which SAMD21 can't spare.
+#define SPI_FLASH_CACHE_SECTORS (1)
+#endif
+
+#ifndef SPI_FLASH_TRACK_DISCARDS
+#define SPI_FLASH_TRACK_DISCARDS (0)
+#endif
+
+#ifndef CIRCUITPY_USB_MSC_WRITE_QUEUE_LENGTH
+#define CIRCUITPY_USB_MSC_WRITE_QUEUE_LENGTH (0)
+#endif
+
+#ifndef CIRCUITPY_USB_MSC_READ_AHEAD
+#define CIRCUITPY_USB_MSC_READ_AHEAD (0)
+#endif
+
 #endif // SAMD21
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
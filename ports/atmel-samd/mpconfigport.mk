@@ -21,6 +21,8 @@ ifeq ($(CHIP_FAMILY),samd21)
 
 # The ?='s allow overriding in mpconfigboard.mk.
 
+CIRCUITPY_FROZEN_NATIVE_ARCH ?= armv6m
+
 # Some of these are on by default with CIRCUITPY_FULL_BUILD, but don't
 # fit in 256kB of flash
 
@@ -97,6 +99,8 @@ endif # samd21
 
 ifeq ($(CHIP_FAMILY),samd51)
 
+CIRCUITPY_FROZEN_NATIVE_ARCH ?= armv7emsp
+
 # No native touchio on SAMD51.
 CIRCUITPY_TOUCHIO_USE_NATIVE = 0
 
@@ -141,6 +145,8 @@ endif # samd51
 
 ifeq ($(CHIP_FAMILY),same51)
 
+CIRCUITPY_FROZEN_NATIVE_ARCH ?= armv7emsp
+
 # No native touchio on SAME51.
 CIRCUITPY_TOUCHIO_USE_NATIVE = 0
 
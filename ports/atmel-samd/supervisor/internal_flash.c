@@ -78,6 +78,14 @@ static bool supervisor_flash_read_block(uint8_t *dest, uint32_t block) {
     return error_code == ERR_NONE;
 }
 
+const void *supervisor_flash_get_block_address(uint32_t block) {
+    int32_t addr = convert_block_to_flash_addr(block);
+    if (addr == -1) {
+        return NULL;
+    }
+    return (const void *)(uintptr_t)addr;
+}
+
 static bool supervisor_flash_write_block(const uint8_t *src, uint32_t block) {
     // non-MBR block, copy to cache
     int32_t dest = convert_block_to_flash_addr(block);
@@ -8,6 +8,7 @@
 
 #include "py/mphal.h"
 #include "py/obj.h"
+#include "py/objarray.h"
 #include "py/objproperty.h"
 #include "py/runtime.h"
 
@@ -68,7 +69,7 @@
 //|         :param pixel_format: The pixel format of the captured image
 //|         :param frame_size: The size of captured image
 //|         :param jpeg_quality: For `PixelFormat.JPEG`, the quality. Higher numbers increase quality. If the quality is too high, the JPEG data will be larger than the available buffer size and the image will be unusable or truncated. The exact range of appropriate values depends on the sensor and must be determined empirically.
-//|         :param framebuffer_count: The number of framebuffers (1 for single-buffered and 2 for double-buffered)
+//|         :param framebuffer_count: The number of framebuffers, 1 to 4. With more than one, frames keep being captured while earlier ones are held with `take`'s ``hold`` argument, or are still being processed.
 //|         :param grab_mode: When to grab a new frame
 //|         """
 //|
@@ -120,7 +121,7 @@ static mp_obj_t espcamera_camera_make_new(const mp_obj_type_t *type, size_t n_ar
     framesize_t frame_size = validate_frame_size(args[ARG_frame_size].u_obj, MP_QSTR_frame_size);
     pixformat_t pixel_format = validate_pixel_format(args[ARG_pixel_format].u_obj, MP_QSTR_pixel_format);
     mp_int_t jpeg_quality = mp_arg_validate_int_range(args[ARG_jpeg_quality].u_int, 2, 55, MP_QSTR_jpeg_quality);
-    mp_int_t framebuffer_count = mp_arg_validate_int_range(args[ARG_framebuffer_count].u_int, 1, 2, MP_QSTR_framebuffer_count);
+    mp_int_t framebuffer_count = mp_arg_validate_int_range(args[ARG_framebuffer_count].u_int, 1, ESPCAMERA_MAX_FRAMEBUFFERS, MP_QSTR_framebuffer_count);
 
     espcamera_camera_obj_t *self = mp_obj_malloc_with_finaliser(espcamera_camera_obj_t, &espcamera_camera_type);
     common_hal_espcamera_camera_construct(
@@ -187,20 +188,36 @@ MP_PROPERTY_GETTER(espcamera_camera_frame_available_obj,
     (mp_obj_t)&espcamera_camera_frame_available_get_obj);
 
 //|     def take(
-//|         self, timeout: Optional[float] = 0.25
+//|         self, timeout: Optional[float] = 0.25, *, hold: bool = False
 //|     ) -> Optional[displayio.Bitmap | ReadableBuffer]:
 //|         """Record a frame. Wait up to 'timeout' seconds for a frame to be captured.
 //|
 //|         In the case of timeout, `None` is returned.
 //|         If `pixel_format` is `PixelFormat.JPEG`, the returned value is a read-only `memoryview`.
 //|         Otherwise, the returned value is a read-only `displayio.Bitmap`.
+//|
+//|         Either way the frame is not copied: it uses the camera's own frame buffer. Normally
+//|         that buffer goes back to the camera at the next call to `take`, and the camera may
+//|         then capture into it while the frame is still in use.
+//|
+//|         With ``hold=True`` the buffer stays with the frame until it is passed to `release`,
+//|         so it can be displayed or decoded while the camera goes on capturing into its other
+//|         buffers. Up to `framebuffer_count` frames can be held at once.
 //|         """
 //|
-static mp_obj_t espcamera_camera_take(size_t n_args, const mp_obj_t *args) {
-    espcamera_camera_obj_t *self = MP_OBJ_TO_PTR(args[0]);
-    mp_float_t timeout = n_args < 2 ? MICROPY_FLOAT_CONST(0.25) : mp_obj_get_float(args[1]);
+static mp_obj_t espcamera_camera_take(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_timeout, ARG_hold };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_timeout, MP_ARG_OBJ, {.u_obj = MP_ROM_NONE} },
+        { MP_QSTR_hold, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+    };
+    espcamera_camera_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_float_t timeout = args[ARG_timeout].u_obj == MP_ROM_NONE ? MICROPY_FLOAT_CONST(0.25) : mp_obj_get_float(args[ARG_timeout].u_obj);
     check_for_deinit(self);
-    camera_fb_t *result = common_hal_espcamera_camera_take(self, (int)MICROPY_FLOAT_C_FUN(round)(timeout * 1000));
+    camera_fb_t *result = common_hal_espcamera_camera_take(self, (int)MICROPY_FLOAT_C_FUN(round)(timeout * 1000), args[ARG_hold].u_bool);
     if (!result) {
         return mp_const_none;
     }
@@ -216,7 +233,32 @@ static mp_obj_t espcamera_camera_take(size_t n_args, const mp_obj_t *args) {
         return bitmap;
     }
 }
-static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(espcamera_camera_take_obj, 1, 2, espcamera_camera_take);
+static MP_DEFINE_CONST_FUN_OBJ_KW(espcamera_camera_take_obj, 1, espcamera_camera_take);
+
+//|     def release(self, frame: displayio.Bitmap | ReadableBuffer) -> None:
+//|         """Give the buffer of a frame taken with ``hold=True`` back to the camera. The frame
+//|         is emptied, to a 0x0 `displayio.Bitmap` or a zero length `memoryview`, so that it
+//|         can't show later captures."""
+//|
+static mp_obj_t espcamera_camera_release(mp_obj_t self_in, mp_obj_t frame) {
+    espcamera_camera_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(frame, &bufinfo, MP_BUFFER_READ);
+    if (!common_hal_espcamera_camera_release(self, bufinfo.buf)) {
+        mp_arg_error_invalid(MP_QSTR_frame);
+    }
+    if (mp_obj_is_type(frame, &displayio_bitmap_type)) {
+        displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(frame);
+        bitmap->width = 0;
+        bitmap->height = 0;
+    } else if (mp_obj_is_type(frame, &mp_type_memoryview)) {
+        mp_obj_array_t *view = MP_OBJ_TO_PTR(frame);
+        view->len = 0;
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(espcamera_camera_release_obj, espcamera_camera_release);
 
 
 //|     def reconfigure(
@@ -231,7 +273,10 @@ static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(espcamera_camera_take_obj, 1, 2, espc
 //|         Because these settings interact in complex ways, and take longer than
 //|         the other properties to set, they are set together in a single function call.
 //|
-//|         If an argument is unspecified or None, then the setting is unchanged."""
+//|         If an argument is unspecified or None, then the setting is unchanged.
+//|
+//|         The camera's frame buffers are reallocated, so frames taken before, including held
+//|         ones, must not be used afterwards."""
 //|
 
 static mp_obj_t espcamera_camera_reconfigure(mp_uint_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
@@ -261,9 +306,9 @@ static mp_obj_t espcamera_camera_reconfigure(mp_uint_t n_args, const mp_obj_t *p
         args[ARG_grab_mode].u_obj != MP_ROM_NONE
         ?  validate_grab_mode(args[ARG_grab_mode].u_obj, MP_QSTR_grab_mode)
         : common_hal_espcamera_camera_get_grab_mode(self);
-    bool framebuffer_count =
+    mp_int_t framebuffer_count =
         args[ARG_framebuffer_count].u_obj != MP_ROM_NONE
-        ?  mp_obj_get_int(args[ARG_framebuffer_count].u_obj)
+        ?  mp_arg_validate_int_range(mp_obj_get_int(args[ARG_framebuffer_count].u_obj), 1, ESPCAMERA_MAX_FRAMEBUFFERS, MP_QSTR_framebuffer_count)
         : common_hal_espcamera_camera_get_framebuffer_count(self);
 
     common_hal_espcamera_camera_reconfigure(self, frame_size, pixel_format, grab_mode, framebuffer_count);
@@ -966,6 +1011,7 @@ static const mp_rom_map_elem_t espcamera_camera_locals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_special_effect), MP_ROM_PTR(&espcamera_camera_special_effect_obj) },
     { MP_ROM_QSTR(MP_QSTR_supports_jpeg), MP_ROM_PTR(&espcamera_camera_supports_jpeg_obj) },
     { MP_ROM_QSTR(MP_QSTR_take), MP_ROM_PTR(&espcamera_camera_take_obj) },
+    { MP_ROM_QSTR(MP_QSTR_release), MP_ROM_PTR(&espcamera_camera_release_obj) },
     { MP_ROM_QSTR(MP_QSTR_vflip), MP_ROM_PTR(&espcamera_camera_vflip_obj) },
     { MP_ROM_QSTR(MP_QSTR_wb_mode), MP_ROM_PTR(&espcamera_camera_wb_mode_obj) },
     { MP_ROM_QSTR(MP_QSTR_whitebal), MP_ROM_PTR(&espcamera_camera_whitebal_obj) },
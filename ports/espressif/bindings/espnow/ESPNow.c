@@ -154,6 +154,36 @@ static mp_obj_t espnow_read(mp_obj_t self_in) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(espnow_read_obj, espnow_read);
 
+//|     def read_into(self, buffer: WriteableBuffer, records: WriteableBuffer) -> int:
+//|         """Read as many packets as fit from the receive buffer without allocating anything.
+//|
+//|         The messages are written back to back into ``buffer``, and a 12 byte record for each
+//|         packet into ``records``: the sender's mac address, rssi, message length and receive
+//|         time, which unpack with ``struct.unpack_from("<6sbBI", records, 12 * i)``.
+//|
+//|         This is non-blocking, the packets are received asynchronously from the peer(s).
+//|
+//|         :param WriteableBuffer buffer: Receives the messages. Must hold at least 250 bytes.
+//|         :param WriteableBuffer records: Receives the packet records. Must hold at least 12 bytes.
+//|         :returns: The number of packets read, which may be zero."""
+//|         ...
+//|
+static mp_obj_t espnow_read_into(mp_obj_t self_in, mp_obj_t buffer_in, mp_obj_t records_in) {
+    espnow_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    espnow_check_for_deinit(self);
+
+    mp_buffer_info_t buffer;
+    mp_get_buffer_raise(buffer_in, &buffer, MP_BUFFER_WRITE);
+    mp_arg_validate_length_min(buffer.len, ESP_NOW_MAX_DATA_LEN, MP_QSTR_buffer);
+
+    mp_buffer_info_t records;
+    mp_get_buffer_raise(records_in, &records, MP_BUFFER_WRITE);
+    mp_arg_validate_length_min(records.len, ESPNOW_RECORD_LEN, MP_QSTR_records);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_espnow_read_into(self, buffer.buf, buffer.len, records.buf, records.len));
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(espnow_read_into_obj, espnow_read_into);
+
 //|     send_success: int
 //|     """The number of tx packets received by the peer(s) ``ESP_NOW_SEND_SUCCESS``. (read-only)"""
 //|
@@ -280,6 +310,7 @@ static const mp_rom_map_elem_t espnow_locals_dict_table[] = {
 
     // Read messages
     { MP_ROM_QSTR(MP_QSTR_read),         MP_ROM_PTR(&espnow_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_read_into),    MP_ROM_PTR(&espnow_read_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_read_success), MP_ROM_PTR(&espnow_read_success_obj)},
     { MP_ROM_QSTR(MP_QSTR_read_failure), MP_ROM_PTR(&espnow_read_failure_obj)},
 
@@ -304,7 +335,7 @@ static mp_uint_t espnow_stream_ioctl(mp_obj_t self_in, mp_uint_t request, uintpt
         case MP_STREAM_POLL: {
             mp_uint_t flags = arg;
             mp_uint_t ret = 0;
-            if ((flags & MP_STREAM_POLL_RD) && ringbuf_num_filled(self->recv_buffer) > 0) {
+            if ((flags & MP_STREAM_POLL_RD) && common_hal_espnow_get_available(self) > 0) {
                 ret |= MP_STREAM_POLL_RD;
             }
             return ret;
@@ -333,7 +364,7 @@ static const mp_stream_p_t espnow_stream_p = {
 static mp_obj_t espnow_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
     espnow_obj_t *self = MP_OBJ_TO_PTR(self_in);
     espnow_check_for_deinit(self);
-    size_t len = ringbuf_num_filled(self->recv_buffer);
+    size_t len = common_hal_espnow_get_available(self);
     switch (op) {
         case MP_UNARY_OP_BOOL:
             return mp_obj_new_bool(len != 0);
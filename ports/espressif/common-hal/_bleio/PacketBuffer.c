@@ -223,7 +223,7 @@ void _common_hal_bleio_packet_buffer_construct(
 
 void common_hal_bleio_packet_buffer_construct(
     bleio_packet_buffer_obj_t *self, bleio_characteristic_obj_t *characteristic,
-    size_t buffer_size, size_t max_packet_size) {
+    size_t buffer_size, size_t max_packet_size, size_t max_queued_packets) {
 
     // Cap the packet size to our implementation limits.
     max_packet_size = MIN(max_packet_size, BLE_ATT_ATTR_MAX_LEN - 3);
@@ -112,6 +112,7 @@ void common_hal_canio_can_construct(canio_can_obj_t *self, const mcu_pin_obj_t *
     twai_general_config_t g_config = TWAI_GENERAL_CONFIG_DEFAULT(-1, -1, TWAI_MODE_NORMAL);
     g_config.tx_io = tx->number;
     g_config.rx_io = rx->number;
+    g_config.rx_queue_len = CIRCUITPY_CANIO_RX_QUEUE_LENGTH;
     if (loopback) {
         g_config.mode = TWAI_MODE_NO_ACK;
     }
@@ -41,6 +41,17 @@ static void install_extended_filter(canio_listener_obj_t *self, canio_match_obj_
     self->standard = false;
 }
 
+// In dual filter mode each of the two filters checks a standard id. The first is in bits
+// 31-21 of the code and mask, and the second in bits 15-5. The bits between are left as
+// don't cares.
+static void install_dual_standard_filter(canio_listener_obj_t *self, canio_match_obj_t *first, canio_match_obj_t *second) {
+    uint32_t code = (first->id << 21) | ((second->id & 0x7ff) << 5);
+    uint32_t mask = ((first->mask & 0x7ff) << 21) | ((second->mask & 0x7ff) << 5);
+    twai_ll_set_acc_filter(&TWAI, code, ~mask, false);
+    self->extended = false;
+    self->standard = true;
+}
+
 static void install_all_match_filter(canio_listener_obj_t *self) {
     twai_ll_set_acc_filter(&TWAI, 0u, ~0u, true);
     self->extended = true;
@@ -53,6 +64,8 @@ static void set_filters(canio_listener_obj_t *self, size_t nmatch, canio_match_o
 
     if (!nmatch) {
         install_all_match_filter(self);
+    } else if (nmatch == 2) {
+        install_dual_standard_filter(self, matches[0], matches[1]);
     } else {
         canio_match_obj_t *match = matches[0];
         if (match->extended) {
@@ -70,7 +83,8 @@ void common_hal_canio_listener_construct(canio_listener_obj_t *self, canio_can_o
     if (can->fifo_in_use) {
         mp_raise_ValueError(MP_ERROR_TEXT("All RX FIFOs in use"));
     }
-    if (nmatch > 1) {
+    // Two matches fit in the hardware filter only if both are for standard ids.
+    if (nmatch > 2 || (nmatch == 2 && (matches[0]->extended || matches[1]->extended))) {
         mp_raise_ValueError(MP_ERROR_TEXT("Filters too complex"));
     }
 
@@ -80,7 +94,6 @@ void common_hal_canio_listener_construct(canio_listener_obj_t *self, canio_can_o
     self->pending = false;
 
     set_filters(self, nmatch, matches);
-    self->extended = self->standard = true;
 
     common_hal_canio_listener_set_timeout(self, timeout);
 }
@@ -114,26 +127,33 @@ int common_hal_canio_listener_in_waiting(canio_listener_obj_t *self) {
     return self->pending;
 }
 
-mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+// Waits up to the timeout for a message, returning whether there is one.
+static bool wait_for_message(canio_listener_obj_t *self) {
     if (!common_hal_canio_listener_in_waiting(self)) {
         uint64_t deadline = supervisor_ticks_ms64() + self->timeout_ms;
         do {
             if (supervisor_ticks_ms64() > deadline) {
-                return NULL;
+                return false;
             }
             RUN_BACKGROUND_TASKS;
             // Allow user to break out of a timeout with a KeyboardInterrupt.
             if (mp_hal_is_interrupted()) {
-                return NULL;
+                return false;
             }
         } while (!common_hal_canio_listener_in_waiting(self));
     }
+    return true;
+}
+
+bool common_hal_canio_listener_receive_into(canio_listener_obj_t *self, canio_message_obj_t *message, bool wait) {
+    if (wait ? !wait_for_message(self) : !common_hal_canio_listener_in_waiting(self)) {
+        return false;
+    }
 
     bool rtr = self->message_in.rtr;
 
     int dlc = self->message_in.data_length_code;
-    canio_message_obj_t *message =
-        mp_obj_malloc(canio_message_obj_t, rtr ? &canio_remote_transmission_request_type : &canio_message_type);
+    message->base.type = rtr ? &canio_remote_transmission_request_type : &canio_message_type;
     message->extended = self->message_in.extd;
     message->id = self->message_in.identifier;
     message->size = dlc;
@@ -145,7 +165,7 @@ mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
 
     self->pending = false;
 
-    return message;
+    return true;
 }
 
 void common_hal_canio_listener_deinit(canio_listener_obj_t *self) {
@@ -207,6 +207,26 @@ void common_hal_dotclockframebuffer_framebuffer_refresh(dotclockframebuffer_fram
     Cache_WriteBack_Addr((uint32_t)(self->bufinfo.buf), self->bufinfo.len);
 }
 
+// Only write back the cache lines that hold the area. Rows that are next to each other in
+// memory are done in one go.
+void common_hal_dotclockframebuffer_framebuffer_refresh_area(dotclockframebuffer_framebuffer_obj_t *self, const displayio_area_t *area) {
+    enum { bytes_per_pixel = 2, line_size = 64 };
+    uint8_t *buf = (uint8_t *)self->bufinfo.buf + self->first_pixel_offset;
+    size_t row_size = (area->x2 - area->x1) * bytes_per_pixel;
+    uint16_t rows = area->y2 - area->y1;
+    if (row_size == (size_t)self->row_stride) {
+        row_size *= rows;
+        rows = 1;
+    }
+    uint8_t *row = buf + area->y1 * self->row_stride + area->x1 * bytes_per_pixel;
+    for (uint16_t i = 0; i < rows; i++) {
+        uint32_t start = (uint32_t)row & ~(line_size - 1);
+        uint32_t end = ((uint32_t)row + row_size + line_size - 1) & ~(line_size - 1);
+        Cache_WriteBack_Addr(start, end - start);
+        row += self->row_stride;
+    }
+}
+
 mp_int_t common_hal_dotclockframebuffer_framebuffer_get_refresh_rate(dotclockframebuffer_framebuffer_obj_t *self) {
     return self->refresh_rate;
 }
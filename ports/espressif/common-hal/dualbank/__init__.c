@@ -12,10 +12,17 @@
 #include "esp_log.h"
 #include "esp_ota_ops.h"
 #include "esp_app_format.h"
+#include "mbedtls/sha256.h"
 
 static const esp_partition_t *update_partition = NULL;
 static esp_ota_handle_t update_handle = 0;
 
+// The image is hashed as it is written, so it doesn't have to be read back to check it. This
+// uses the SHA hardware through IDF's mbedtls.
+static mbedtls_sha256_context update_sha256;
+static bool update_sha256_valid = false;
+static size_t update_hashed_len = 0;
+
 static const char *TAG = "dualbank";
 
 void dualbank_reset(void) {
@@ -23,6 +30,10 @@ void dualbank_reset(void) {
         update_handle = 0;
         update_partition = NULL;
     }
+    if (update_sha256_valid) {
+        mbedtls_sha256_free(&update_sha256);
+        update_sha256_valid = false;
+    }
 }
 
 static void __attribute__((noreturn)) task_fatal_error(void) {
@@ -82,6 +93,14 @@ void common_hal_dualbank_flash(const void *buf, const size_t len, const size_t o
                 ESP_LOGE(TAG, "esp_ota_begin failed (%s)", esp_err_to_name(err));
                 task_fatal_error();
             }
+
+            if (update_sha256_valid) {
+                mbedtls_sha256_free(&update_sha256);
+            }
+            mbedtls_sha256_init(&update_sha256);
+            mbedtls_sha256_starts(&update_sha256, 0);
+            update_sha256_valid = true;
+            update_hashed_len = 0;
         } else {
             ESP_LOGE(TAG, "received package is not fit len");
             mp_raise_RuntimeError(MP_ERROR_TEXT("Firmware is too big"));
@@ -97,6 +116,30 @@ void common_hal_dualbank_flash(const void *buf, const size_t len, const size_t o
         ESP_LOGE(TAG, "esp_ota_write failed (%s)", esp_err_to_name(err));
         task_fatal_error();
     }
+
+    // An offset of 0 appends. Anything written out of order can't be hashed as it goes.
+    if (update_sha256_valid) {
+        if (offset == 0 || offset == update_hashed_len) {
+            mbedtls_sha256_update(&update_sha256, buf, len);
+            update_hashed_len += len;
+        } else {
+            mbedtls_sha256_free(&update_sha256);
+            update_sha256_valid = false;
+        }
+    }
+}
+
+bool common_hal_dualbank_get_sha256(uint8_t digest[32]) {
+    if (!update_sha256_valid) {
+        return false;
+    }
+    // Finish a copy so that more can still be written.
+    mbedtls_sha256_context copy;
+    mbedtls_sha256_init(&copy);
+    mbedtls_sha256_clone(&copy, &update_sha256);
+    mbedtls_sha256_finish(&copy, digest);
+    mbedtls_sha256_free(&copy);
+    return true;
 }
 
 void common_hal_dualbank_switch(void) {
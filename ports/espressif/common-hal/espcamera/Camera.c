@@ -40,6 +40,14 @@ static void maybe_claim_pin(const mcu_pin_obj_t *pin) {
     }
 }
 
+// The driver frees the frame buffers when it stops, so forget the ones we have.
+static void forget_buffers(espcamera_camera_obj_t *self) {
+    self->buffer_to_return = NULL;
+    for (int i = 0; i < ESPCAMERA_MAX_FRAMEBUFFERS; i++) {
+        self->held_buffers[i] = NULL;
+    }
+}
+
 void common_hal_espcamera_camera_construct(
     espcamera_camera_obj_t *self,
     uint8_t data_pins[8],
@@ -76,6 +84,7 @@ void common_hal_espcamera_camera_construct(
     }
 
     self->i2c = i2c;
+    forget_buffers(self);
 
     // These pins might be NULL because they were not specified.
     // Note that common_hal_mcu_pin_number() returns NO_PIN (- =1) if pass NULL, but as a `uint8_t`,
@@ -140,6 +149,7 @@ extern void common_hal_espcamera_camera_deinit(espcamera_camera_obj_t *self) {
     reset_pin_number(self->camera_config.pin_d0);
 
     esp_camera_deinit();
+    forget_buffers(self);
 
     reset_pin_number(self->camera_config.pin_pclk);
     reset_pin_number(self->camera_config.pin_vsync);
@@ -156,12 +166,32 @@ bool common_hal_espcamera_camera_available(espcamera_camera_obj_t *self) {
     return esp_camera_fb_available();
 }
 
-camera_fb_t *common_hal_espcamera_camera_take(espcamera_camera_obj_t *self, int timeout_ms) {
+camera_fb_t *common_hal_espcamera_camera_take(espcamera_camera_obj_t *self, int timeout_ms, bool hold) {
     if (self->buffer_to_return) {
         esp_camera_fb_return(self->buffer_to_return);
         self->buffer_to_return = NULL;
     }
-    return self->buffer_to_return = esp_camera_fb_get_timeout(timeout_ms);
+    if (!hold) {
+        return self->buffer_to_return = esp_camera_fb_get_timeout(timeout_ms);
+    }
+    for (int i = 0; i < (int)self->camera_config.fb_count; i++) {
+        if (self->held_buffers[i] == NULL) {
+            return self->held_buffers[i] = esp_camera_fb_get_timeout(timeout_ms);
+        }
+    }
+    mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q in use"), MP_QSTR_framebuffer_count);
+}
+
+bool common_hal_espcamera_camera_release(espcamera_camera_obj_t *self, const void *buf) {
+    for (int i = 0; i < ESPCAMERA_MAX_FRAMEBUFFERS; i++) {
+        camera_fb_t *fb = self->held_buffers[i];
+        if (fb != NULL && fb->buf == buf) {
+            esp_camera_fb_return(fb);
+            self->held_buffers[i] = NULL;
+            return true;
+        }
+    }
+    return false;
 }
 
 #define SENSOR_GETSET(type, name, field_name, setter_function_name) \
@@ -217,6 +247,7 @@ void common_hal_espcamera_camera_reconfigure(espcamera_camera_obj_t *self, frame
 
     i2c_lock(self);
     cam_deinit();
+    forget_buffers(self);
     self->camera_config.pixel_format = pixel_format;
     self->camera_config.frame_size = frame_size;
     self->camera_config.grab_mode = grab_mode;
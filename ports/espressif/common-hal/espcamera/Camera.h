@@ -11,10 +11,14 @@
 #include "shared-bindings/pwmio/PWMOut.h"
 #include "common-hal/busio/I2C.h"
 
+#define ESPCAMERA_MAX_FRAMEBUFFERS (4)
+
 typedef struct espcamera_camera_obj {
     mp_obj_base_t base;
     camera_config_t camera_config;
     camera_fb_t *buffer_to_return;
+    // Frames taken with hold=True, which stay out of the driver's queue until released.
+    camera_fb_t *held_buffers[ESPCAMERA_MAX_FRAMEBUFFERS];
     pwmio_pwmout_obj_t pwm;
     busio_i2c_obj_t *i2c;
 } espcamera_obj_t;
@@ -7,6 +7,8 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <string.h>
+
 #include "py/mperrno.h"
 #include "py/runtime.h"
 
@@ -65,14 +67,43 @@ static void send_cb(const uint8_t *mac, esp_now_send_status_t status) {
     }
 }
 
+// --- The receive ring ---
+
+// The WiFi task is the only writer of recv_head and the VM the only writer of recv_tail, so
+// packets go in and out without a lock, even with the two on different cores. The head is only
+// published once the packet under it is complete, and the tail once the packet is copied out.
+
+static size_t ring_filled(espnow_obj_t *self, uint32_t head, uint32_t tail) {
+    return head >= tail ? head - tail : head + self->recv_buffer_size + 1 - tail;
+}
+
+static uint32_t ring_put(espnow_obj_t *self, uint32_t head, const void *data, size_t len) {
+    size_t capacity = self->recv_buffer_size + 1;
+    size_t first = MIN(len, capacity - head);
+    memcpy(self->recv_buffer + head, data, first);
+    memcpy(self->recv_buffer, (const uint8_t *)data + first, len - first);
+    head += len;
+    return head >= capacity ? head - capacity : head;
+}
+
+static uint32_t ring_get(espnow_obj_t *self, uint32_t tail, void *data, size_t len) {
+    size_t capacity = self->recv_buffer_size + 1;
+    size_t first = MIN(len, capacity - tail);
+    memcpy(data, self->recv_buffer + tail, first);
+    memcpy((uint8_t *)data + first, self->recv_buffer, len - first);
+    tail += len;
+    return tail >= capacity ? tail - capacity : tail;
+}
+
 // Callback triggered when an ESP-NOW packet is received.
 // Write the peer MAC address and the message into the recv_buffer as an ESPNow packet.
 // If the buffer is full, drop the message and increment the dropped count.
 static void recv_cb(const esp_now_recv_info_t *esp_now_info, const uint8_t *msg, int msg_len) {
     espnow_obj_t *self = MP_STATE_PORT(espnow_singleton);
-    ringbuf_t *buf = self->recv_buffer;
 
-    if (sizeof(espnow_packet_t) + msg_len > ringbuf_num_empty(buf)) {
+    uint32_t head = self->recv_head;
+    uint32_t tail = __atomic_load_n(&self->recv_tail, __ATOMIC_ACQUIRE);
+    if (sizeof(espnow_packet_t) + msg_len > self->recv_buffer_size - ring_filled(self, head, tail)) {
         self->read_failure++;
         return;
     }
@@ -83,9 +114,10 @@ static void recv_cb(const esp_now_recv_info_t *esp_now_info, const uint8_t *msg,
     header.rssi = esp_now_info->rx_ctrl->rssi;
     header.time_ms = mp_hal_ticks_ms();
 
-    ringbuf_put_n(buf, (uint8_t *)&header, sizeof(header));
-    ringbuf_put_n(buf, esp_now_info->src_addr, ESP_NOW_ETH_ALEN);
-    ringbuf_put_n(buf, msg, msg_len);
+    head = ring_put(self, head, &header, sizeof(header));
+    head = ring_put(self, head, esp_now_info->src_addr, ESP_NOW_ETH_ALEN);
+    head = ring_put(self, head, msg, msg_len);
+    __atomic_store_n(&self->recv_head, head, __ATOMIC_RELEASE);
 
     self->read_success++;
 }
@@ -109,10 +141,9 @@ void common_hal_espnow_init(espnow_obj_t *self) {
         return;
     }
 
-    self->recv_buffer = m_new_obj(ringbuf_t);
-    if (!ringbuf_alloc(self->recv_buffer, self->recv_buffer_size /*, true*/)) {
-        m_malloc_fail(self->recv_buffer_size);
-    }
+    self->recv_head = 0;
+    self->recv_tail = 0;
+    self->recv_buffer = m_malloc(self->recv_buffer_size + 1);
 
     if (!common_hal_wifi_radio_get_enabled(&common_hal_wifi_radio_obj)) {
         common_hal_wifi_init(false);
@@ -138,7 +169,6 @@ void common_hal_espnow_deinit(espnow_obj_t *self) {
     CHECK_ESP_RESULT(esp_now_unregister_recv_cb());
     CHECK_ESP_RESULT(esp_now_deinit());
 
-    self->recv_buffer->buf = NULL;
     self->recv_buffer = NULL;
 }
 
@@ -172,36 +202,75 @@ mp_obj_t common_hal_espnow_send(espnow_obj_t *self, const mp_buffer_info_t *mess
     return mp_const_none;
 }
 
-mp_obj_t common_hal_espnow_read(espnow_obj_t *self) {
-    if (!ringbuf_num_filled(self->recv_buffer)) {
-        return mp_const_none;
-    }
+size_t common_hal_espnow_get_available(espnow_obj_t *self) {
+    return ring_filled(self, __atomic_load_n(&self->recv_head, __ATOMIC_ACQUIRE), self->recv_tail);
+}
 
-    // Read the packet header from the incoming buffer
-    espnow_header_t header;
-    if (ringbuf_get_n(self->recv_buffer, (uint8_t *)&header, sizeof(header)) != sizeof(header)) {
+// Copy the header and sender of the next packet out of the ring, checking its format, and return
+// where its message starts. Nothing is consumed until the caller publishes a new tail.
+static uint32_t read_packet_header(espnow_obj_t *self, uint32_t tail, espnow_packet_t *packet) {
+    tail = ring_get(self, tail, packet, sizeof(espnow_packet_t));
+    if (packet->header.magic != ESPNOW_MAGIC || packet->header.msg_len > ESP_NOW_MAX_DATA_LEN) {
         mp_arg_error_invalid(MP_QSTR_buffer);
     }
+    return tail;
+}
 
-    uint8_t msg_len = header.msg_len;
+mp_obj_t common_hal_espnow_read(espnow_obj_t *self) {
+    if (common_hal_espnow_get_available(self) == 0) {
+        return mp_const_none;
+    }
 
-    uint8_t mac_buf[ESP_NOW_ETH_ALEN];
-    uint8_t msg_buf[msg_len];
+    espnow_packet_t packet;
+    uint32_t tail = read_packet_header(self, self->recv_tail, &packet);
 
-    // Check the message packet header format and read the message data
-    if (header.magic != ESPNOW_MAGIC ||
-        msg_len > ESP_NOW_MAX_DATA_LEN ||
-        ringbuf_get_n(self->recv_buffer, mac_buf, ESP_NOW_ETH_ALEN) != ESP_NOW_ETH_ALEN ||
-        ringbuf_get_n(self->recv_buffer, msg_buf, msg_len) != msg_len) {
-        mp_arg_error_invalid(MP_QSTR_buffer);
-    }
+    uint8_t msg_len = packet.header.msg_len;
+    uint8_t msg_buf[msg_len];
+    tail = ring_get(self, tail, msg_buf, msg_len);
+    __atomic_store_n(&self->recv_tail, tail, __ATOMIC_RELEASE);
 
     mp_obj_t elems[4] = {
-        mp_obj_new_bytes(mac_buf, ESP_NOW_ETH_ALEN),
+        mp_obj_new_bytes(packet.peer, ESP_NOW_ETH_ALEN),
         mp_obj_new_bytes(msg_buf, msg_len),
-        MP_OBJ_NEW_SMALL_INT(header.rssi),
-        mp_obj_new_int(header.time_ms),
+        MP_OBJ_NEW_SMALL_INT(packet.header.rssi),
+        mp_obj_new_int(packet.header.time_ms),
     };
 
     return namedtuple_make_new((const mp_obj_type_t *)&espnow_packet_type_obj, 4, 0, elems);
 }
+
+// Move as many whole packets as fit out of the ring: their messages back to back into buf and
+// one ESPNOW_RECORD_LEN record for each into records. Nothing is allocated on the heap.
+// Returns the number of packets read.
+size_t common_hal_espnow_read_into(espnow_obj_t *self, uint8_t *buf, size_t buf_len, uint8_t *records, size_t records_len) {
+    uint32_t head = __atomic_load_n(&self->recv_head, __ATOMIC_ACQUIRE);
+    uint32_t tail = self->recv_tail;
+    size_t count = 0;
+
+    while (tail != head && records_len >= ESPNOW_RECORD_LEN) {
+        espnow_packet_t packet;
+        uint32_t msg_start = read_packet_header(self, tail, &packet);
+        uint8_t msg_len = packet.header.msg_len;
+        if (msg_len > buf_len) {
+            break;
+        }
+        tail = ring_get(self, msg_start, buf, msg_len);
+        buf += msg_len;
+        buf_len -= msg_len;
+
+        memcpy(records, packet.peer, ESP_NOW_ETH_ALEN);
+        records[6] = packet.header.rssi;
+        records[7] = msg_len;
+        uint32_t time_ms = packet.header.time_ms;
+        for (size_t i = 0; i < 4; i++) {
+            records[8 + i] = time_ms >> (8 * i);
+        }
+        records += ESPNOW_RECORD_LEN;
+        records_len -= ESPNOW_RECORD_LEN;
+        count++;
+    }
+
+    // Give the space back to the WiFi task all at once.
+    __atomic_store_n(&self->recv_tail, tail, __ATOMIC_RELEASE);
+    return count;
+}
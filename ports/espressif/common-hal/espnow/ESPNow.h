@@ -7,7 +7,6 @@
 #pragma once
 
 #include "py/obj.h"
-#include "py/ringbuf.h"
 
 #include "bindings/espnow/Peers.h"
 
@@ -15,8 +14,12 @@
 
 typedef struct _espnow_obj_t {
     mp_obj_base_t base;
-    ringbuf_t *recv_buffer;
+    // Received packets, written by the WiFi task and read by the VM. Each side only moves its own
+    // index so the two never need a lock. One byte is always left free to tell full from empty.
+    uint8_t *recv_buffer;
     size_t recv_buffer_size;
+    volatile uint32_t recv_head;
+    volatile uint32_t recv_tail;
     wifi_phy_rate_t phy_rate;
     espnow_peers_obj_t *peers;
     volatile size_t send_success;
@@ -25,6 +28,10 @@ typedef struct _espnow_obj_t {
     volatile size_t read_failure;
 } espnow_obj_t;
 
+// The size of each packet record filled in by common_hal_espnow_read_into():
+// the mac address (6 bytes), rssi (int8), message length (uint8) and receive time (uint32, little-endian).
+#define ESPNOW_RECORD_LEN (12)
+
 extern void espnow_reset(void);
 
 extern void common_hal_espnow_construct(espnow_obj_t *self, mp_int_t buffer_size, mp_int_t phy_rate);
@@ -37,3 +44,5 @@ extern void common_hal_espnow_set_pmk(espnow_obj_t *self, const uint8_t *key);
 
 extern mp_obj_t common_hal_espnow_send(espnow_obj_t *self, const mp_buffer_info_t *message, const uint8_t *mac);
 extern mp_obj_t common_hal_espnow_read(espnow_obj_t *self);
+extern size_t common_hal_espnow_read_into(espnow_obj_t *self, uint8_t *buf, size_t buf_len, uint8_t *records, size_t records_len);
+extern size_t common_hal_espnow_get_available(espnow_obj_t *self);
@@ -7,6 +7,7 @@
 #include "shared-bindings/frequencyio/FrequencyIn.h"
 
 #include "bindings/espidf/__init__.h"
+#include "shared-bindings/microcontroller/__init__.h"
 #include "py/runtime.h"
 
 #include "driver/pulse_cnt.h"
@@ -24,6 +25,16 @@ static IRAM_ATTR bool timer_interrupt_handler(gptimer_handle_t timer,
 
     // reset counter
     pcnt_unit_clear_count(internal_data->unit);
+
+    int count = internal_data->pulse_count;
+    if (internal_data->windows == 0 || count < internal_data->min_count) {
+        internal_data->min_count = count;
+    }
+    if (internal_data->windows == 0 || count > internal_data->max_count) {
+        internal_data->max_count = count;
+    }
+    internal_data->total_count += count;
+    internal_data->windows++;
     return false;
 }
 
@@ -122,6 +133,8 @@ void common_hal_frequencyio_frequencyin_construct(frequencyio_frequencyin_obj_t
         raise_esp_error(ESP_ERR_NO_MEM);
     }
     self->internal_data->pulse_count = 0;
+    self->internal_data->windows = 0;
+    self->internal_data->total_count = 0;
 
     // initialize pcnt and timer
     esp_err_t result = init_pcnt(self);
@@ -181,10 +194,34 @@ void common_hal_frequencyio_frequencyin_resume(frequencyio_frequencyin_obj_t *se
 
 void common_hal_frequencyio_frequencyin_clear(frequencyio_frequencyin_obj_t *self) {
     self->internal_data->pulse_count = 0;
+    self->internal_data->windows = 0;
+    self->internal_data->total_count = 0;
     pcnt_unit_clear_count(self->internal_data->unit);
     gptimer_set_raw_count(self->timer, 0);
 }
 
+void common_hal_frequencyio_frequencyin_get_statistics(frequencyio_frequencyin_obj_t *self, frequencyio_statistics_t *stats) {
+    _internal_data_t *internal_data = self->internal_data;
+    common_hal_mcu_disable_interrupts();
+    uint32_t windows = internal_data->windows;
+    int min_count = internal_data->min_count;
+    int max_count = internal_data->max_count;
+    uint64_t total_count = internal_data->total_count;
+    internal_data->windows = 0;
+    internal_data->total_count = 0;
+    common_hal_mcu_enable_interrupts();
+
+    // Counts are of both edges so * 500 instead of * 1000 / 2, as in get_item().
+    stats->windows = windows;
+    if (windows == 0) {
+        stats->min = stats->max = stats->mean = 0;
+        return;
+    }
+    stats->min = min_count * 500 / self->capture_period_ms;
+    stats->max = max_count * 500 / self->capture_period_ms;
+    stats->mean = total_count * 500 / ((uint64_t)windows * self->capture_period_ms);
+}
+
 uint16_t common_hal_frequencyio_frequencyin_get_capture_period(frequencyio_frequencyin_obj_t *self) {
     return self->capture_period_ms;
 }
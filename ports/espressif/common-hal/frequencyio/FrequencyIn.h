@@ -14,6 +14,11 @@
 typedef struct {
     pcnt_unit_handle_t unit;
     int pulse_count;
+    // Statistics of the pulse counts of each capture period.
+    uint32_t windows;
+    int min_count;
+    int max_count;
+    uint64_t total_count;
 } _internal_data_t;
 
 typedef struct {
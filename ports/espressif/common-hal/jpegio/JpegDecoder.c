@@ -0,0 +1,87 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "py/runtime.h"
+
+#include "shared-module/jpegio/JpegDecoder.h"
+
+#include "driver/jpeg_decode.h"
+
+// The engine is created on first use and kept for the life of the VM; it holds no Python
+// objects, so it survives soft reloads.
+static jpeg_decoder_handle_t jpeg_engine;
+
+static bool ensure_engine(void) {
+    if (jpeg_engine != NULL) {
+        return true;
+    }
+    jpeg_decode_engine_cfg_t engine_cfg = {
+        .intr_priority = 0,
+        .timeout_ms = 100,
+    };
+    return jpeg_new_decoder_engine(&engine_cfg, &jpeg_engine) == ESP_OK;
+}
+
+// The codec writes whole MCUs, so its output is padded out to the MCU size.
+static void mcu_size(jpeg_down_sampling_type_t sample_method, int *mcu_w, int *mcu_h) {
+    switch (sample_method) {
+        case JPEG_DOWN_SAMPLING_YUV420:
+            *mcu_w = *mcu_h = 16;
+            break;
+        case JPEG_DOWN_SAMPLING_YUV422:
+            *mcu_w = 16;
+            *mcu_h = 8;
+            break;
+        default:
+            *mcu_w = *mcu_h = 8;
+            break;
+    }
+}
+
+bool jpegio_jpegdecoder_port_decode(jpegio_jpegdecoder_obj_t *self, const uint8_t *data, size_t len, int scale) {
+    // The codec doesn't scale.
+    if (scale != 0 || !ensure_engine()) {
+        return false;
+    }
+
+    jpeg_decode_picture_info_t info;
+    if (jpeg_decoder_get_info(data, len, &info) != ESP_OK) {
+        return false;
+    }
+    int mcu_w, mcu_h;
+    mcu_size(info.sample_method, &mcu_w, &mcu_h);
+    int padded_w = (info.width + mcu_w - 1) / mcu_w * mcu_w;
+    int padded_h = (info.height + mcu_h - 1) / mcu_h * mcu_h;
+
+    // Both buffers must be DMA capable and cache aligned, so the source is copied even when it
+    // is already in PSRAM.
+    jpeg_decode_memory_alloc_cfg_t in_cfg = { .buffer_direction = JPEG_DEC_ALLOC_INPUT_BUFFER };
+    jpeg_decode_memory_alloc_cfg_t out_cfg = { .buffer_direction = JPEG_DEC_ALLOC_OUTPUT_BUFFER };
+    size_t in_size, out_size;
+    uint8_t *in_buf = jpeg_alloc_decoder_mem(len, &in_cfg, &in_size);
+    uint8_t *out_buf = jpeg_alloc_decoder_mem(padded_w * padded_h * sizeof(uint16_t), &out_cfg, &out_size);
+    bool ok = in_buf != NULL && out_buf != NULL;
+    if (ok) {
+        memcpy(in_buf, data, len);
+        // BGR element order gives little-endian RGB565, the same as tjpgd produces.
+        jpeg_decode_cfg_t decode_cfg = {
+            .output_format = JPEG_DECODE_OUT_FORMAT_RGB565,
+            .rgb_order = JPEG_DEC_RGB_ELEMENT_ORDER_BGR,
+            .conv_std = JPEG_YUV_RGB_CONV_STD_BT601,
+        };
+        uint32_t decoded_size;
+        ok = jpeg_decoder_process(jpeg_engine, &decode_cfg, in_buf, len, out_buf, out_size, &decoded_size) == ESP_OK;
+    }
+    if (ok) {
+        JRECT rect = { .left = 0, .right = info.width - 1, .top = 0, .bottom = info.height - 1 };
+        jpegio_jpegdecoder_output_block(self, out_buf, padded_w, &rect);
+    }
+    free(in_buf);
+    free(out_buf);
+    return ok;
+}
@@ -7,9 +7,11 @@
 #include "shared-bindings/mdns/Server.h"
 
 #include "py/gc.h"
+#include "py/objlist.h"
 #include "py/runtime.h"
 #include "shared-bindings/mdns/RemoteService.h"
 #include "shared-bindings/wifi/__init__.h"
+#include "supervisor/shared/tick.h"
 
 #include "mdns.h"
 
@@ -18,6 +20,8 @@
 // could be created.)
 static mdns_server_obj_t *_active_object = NULL;
 
+static void browse_stop(void);
+
 void mdns_server_construct(mdns_server_obj_t *self, bool workflow) {
     if (_active_object != NULL) {
         if (self == _active_object) {
@@ -72,6 +76,7 @@ void common_hal_mdns_server_deinit(mdns_server_obj_t *self) {
     }
     self->inited = false;
     _active_object = NULL;
+    browse_stop();
     mdns_free();
 }
 
@@ -143,50 +148,225 @@ size_t mdns_server_find(mdns_server_obj_t *self, const char *service_type, const
     return num_results;
 }
 
-mp_obj_t common_hal_mdns_server_find(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_float_t timeout) {
-    mdns_search_once_t *search = mdns_query_async_new(NULL, service_type, protocol, MDNS_TYPE_PTR, timeout * 1000, 255, NULL);
-    if (search == NULL) {
-        mp_raise_RuntimeError(MP_ERROR_TEXT("Unable to start mDNS query"));
+// Results of the most recent search, reused until the shortest TTL among them
+// runs out. This is kept outside of the server object because the web
+// workflow's server is statically allocated and isn't scanned by the GC.
+static struct {
+    qstr service_type;
+    qstr protocol;
+    mp_obj_t results;
+    uint64_t expires_ms;
+} find_cache;
+
+// A search started by browse() that runs in the background. The IDF only
+// hands out the results of a query once it completes, so they arrive in a
+// single batch after any remembered ones.
+static struct {
+    qstr service_type;
+    qstr protocol;
+    mdns_search_once_t *search;
+    // List of everything returned so far, used to skip duplicates and to
+    // refresh the cache when the browse finishes.
+    mp_obj_t found;
+    // Remembered results still to be returned by browse_results().
+    mp_obj_t cached;
+    bool active;
+} browse_state;
+
+static mp_obj_t cache_lookup(qstr service_type, qstr protocol) {
+    if (find_cache.results == MP_OBJ_NULL ||
+        find_cache.service_type != service_type ||
+        find_cache.protocol != protocol ||
+        supervisor_ticks_ms64() >= find_cache.expires_ms) {
+        return MP_OBJ_NULL;
     }
-    uint8_t num_results;
-    mdns_result_t *results;
-    while (!mdns_query_async_get_results(search, 1, &results, &num_results)) {
-        RUN_BACKGROUND_TASKS;
+    return find_cache.results;
+}
+
+static void cache_store(qstr service_type, qstr protocol, size_t len, mp_obj_t *items) {
+    if (len == 0) {
+        return;
     }
-    mdns_query_async_delete(search);
+    uint32_t ttl = UINT32_MAX;
+    for (size_t i = 0; i < len; i++) {
+        mdns_remoteservice_obj_t *service = MP_OBJ_TO_PTR(items[i]);
+        if (service->result != NULL) {
+            ttl = MIN(ttl, service->result->ttl);
+        }
+    }
+    find_cache.results = mp_obj_new_tuple(len, items);
+    find_cache.service_type = service_type;
+    find_cache.protocol = protocol;
+    find_cache.expires_ms = supervisor_ticks_ms64() + (uint64_t)ttl * 1000;
+}
+
+static const char *str_or_empty(const char *str) {
+    return str == NULL ? "" : str;
+}
+
+// Wraps each result in a RemoteService. Results already in `skip` are freed
+// instead.
+static mp_obj_t new_remote_services(mdns_result_t *results, uint8_t num_results, mp_obj_t skip) {
     mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(mp_obj_new_tuple(num_results, NULL));
     // The empty tuple object is shared and stored in flash so return early if
     // we got it. Without this we'll crash when trying to set len below.
     if (num_results == 0) {
         return MP_OBJ_FROM_PTR(tuple);
     }
+    size_t skip_len = 0;
+    mp_obj_t *skip_items = NULL;
+    if (skip != MP_OBJ_NULL) {
+        mp_obj_list_get(skip, &skip_len, &skip_items);
+    }
     mdns_result_t *next = results;
     // Don't error if we're out of memory. Instead, truncate the tuple.
     uint8_t added = 0;
     while (next != NULL) {
+        mdns_result_t *result = next;
+        next = result->next;
+        bool duplicate = false;
+        for (size_t i = 0; i < skip_len && !duplicate; i++) {
+            mdns_remoteservice_obj_t *other = MP_OBJ_TO_PTR(skip_items[i]);
+            duplicate = other->result != NULL &&
+                strcmp(str_or_empty(other->result->instance_name), str_or_empty(result->instance_name)) == 0 &&
+                strcmp(str_or_empty(other->result->hostname), str_or_empty(result->hostname)) == 0;
+        }
+        if (duplicate) {
+            result->next = NULL;
+            mdns_query_results_free(result);
+            continue;
+        }
         mdns_remoteservice_obj_t *service = gc_alloc(sizeof(mdns_remoteservice_obj_t), GC_ALLOC_FLAG_HAS_FINALISER);
         if (service == NULL) {
+            // Free the remaining results from the IDF because we don't have
+            // enough space in Python.
+            result->next = next;
+            mdns_query_results_free(result);
             if (added == 0) {
                 m_malloc_fail(sizeof(mdns_remoteservice_obj_t));
             }
-            // Free the remaining results from the IDF because we don't have
-            // enough space in Python.
-            mdns_query_results_free(next);
             break;
         }
-        service->result = next;
+        service->result = result;
         service->base.type = &mdns_remoteservice_type;
-        next = next->next;
         // Break the linked list so we free each result separately.
         service->result->next = NULL;
         tuple->items[added] = MP_OBJ_FROM_PTR(service);
         added++;
     }
+    if (added == 0) {
+        return mp_const_empty_tuple;
+    }
     tuple->len = added;
 
     return MP_OBJ_FROM_PTR(tuple);
 }
 
+mp_obj_t common_hal_mdns_server_find(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_float_t timeout, bool cached) {
+    qstr service_type_qstr = qstr_from_str(service_type);
+    qstr protocol_qstr = qstr_from_str(protocol);
+    if (cached) {
+        mp_obj_t results = cache_lookup(service_type_qstr, protocol_qstr);
+        if (results != MP_OBJ_NULL) {
+            return results;
+        }
+    }
+
+    mdns_search_once_t *search = mdns_query_async_new(NULL, service_type, protocol, MDNS_TYPE_PTR, timeout * 1000, 255, NULL);
+    if (search == NULL) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Unable to start mDNS query"));
+    }
+    uint8_t num_results;
+    mdns_result_t *results;
+    while (!mdns_query_async_get_results(search, 1, &results, &num_results)) {
+        RUN_BACKGROUND_TASKS;
+    }
+    mdns_query_async_delete(search);
+    mp_obj_t tuple = new_remote_services(results, num_results, MP_OBJ_NULL);
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_tuple_get(tuple, &len, &items);
+    cache_store(service_type_qstr, protocol_qstr, len, items);
+    return tuple;
+}
+
+static void browse_stop(void) {
+    if (browse_state.search != NULL) {
+        mdns_query_async_delete(browse_state.search);
+        browse_state.search = NULL;
+    }
+    browse_state.active = false;
+    browse_state.found = MP_OBJ_NULL;
+    browse_state.cached = MP_OBJ_NULL;
+}
+
+void common_hal_mdns_server_browse(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_float_t timeout) {
+    browse_stop();
+
+    browse_state.service_type = qstr_from_str(service_type);
+    browse_state.protocol = qstr_from_str(protocol);
+    browse_state.found = mp_obj_new_list(0, NULL);
+    browse_state.cached = cache_lookup(browse_state.service_type, browse_state.protocol);
+
+    browse_state.search = mdns_query_async_new(NULL, service_type, protocol, MDNS_TYPE_PTR, timeout * 1000, 255, NULL);
+    if (browse_state.search == NULL) {
+        browse_stop();
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Unable to start mDNS query"));
+    }
+    browse_state.active = true;
+}
+
+mp_obj_t common_hal_mdns_server_browse_results(mdns_server_obj_t *self) {
+    if (!browse_state.active) {
+        return mp_const_none;
+    }
+    if (browse_state.cached != MP_OBJ_NULL) {
+        mp_obj_t cached = browse_state.cached;
+        browse_state.cached = MP_OBJ_NULL;
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_tuple_get(cached, &len, &items);
+        for (size_t i = 0; i < len; i++) {
+            mp_obj_list_append(browse_state.found, items[i]);
+        }
+        return cached;
+    }
+    if (browse_state.search == NULL) {
+        // Everything has been returned.
+        mp_obj_list_t *found = MP_OBJ_TO_PTR(browse_state.found);
+        cache_store(browse_state.service_type, browse_state.protocol, found->len, found->items);
+        browse_stop();
+        return mp_const_none;
+    }
+
+    uint8_t num_results;
+    mdns_result_t *results;
+    if (!mdns_query_async_get_results(browse_state.search, 0, &results, &num_results)) {
+        return mp_const_empty_tuple;
+    }
+    mdns_query_async_delete(browse_state.search);
+    browse_state.search = NULL;
+    mp_obj_t tuple = new_remote_services(results, num_results, browse_state.found);
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_tuple_get(tuple, &len, &items);
+    for (size_t i = 0; i < len; i++) {
+        mp_obj_list_append(browse_state.found, items[i]);
+    }
+    return tuple;
+}
+
+void mdns_user_reset(void) {
+    browse_stop();
+    find_cache.results = MP_OBJ_NULL;
+}
+
+void mdns_gc_collect(void) {
+    gc_collect_ptr(MP_OBJ_TO_PTR(find_cache.results));
+    gc_collect_ptr(MP_OBJ_TO_PTR(browse_state.found));
+    gc_collect_ptr(MP_OBJ_TO_PTR(browse_state.cached));
+}
+
 void common_hal_mdns_server_advertise_service(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_int_t port, const char *txt_records[], size_t num_txt_records) {
     if (mdns_service_exists(service_type, protocol, NULL)) {
         mdns_service_port_set(service_type, protocol, port);
@@ -49,13 +49,18 @@ uint32_t common_hal_mcu_processor_get_frequency(void) {
     #if CIRCUITPY_SETTABLE_PROCESSOR_FREQUENCY
     esp_pm_config_t pm;
     CHECK_ESP_RESULT(esp_pm_get_configuration(&pm));
-    return pm.min_freq_mhz * 1000000;
+    return pm.max_freq_mhz * 1000000;
     #else
     return CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ * 1000000;
     #endif
 }
 
 #if CIRCUITPY_SETTABLE_PROCESSOR_FREQUENCY // Don't need a NotImplementedError here if this is false, as that is handled in shared-bindings
+#if CIRCUITPY_PROCESSOR_IDLE_FREQUENCY
+// 0 when not scaling.
+static uint32_t idle_frequency_mhz;
+#endif
+
 // If the requested frequency is not supported by the hardware, return the next lower supported frequency
 static uint32_t get_valid_cpu_frequency(uint32_t requested_freq_mhz) {
 
@@ -102,6 +107,39 @@ void common_hal_mcu_processor_set_frequency(mcu_processor_obj_t *self, uint32_t
     esp_pm_config_t pm;
     pm.max_freq_mhz = frequency;
     pm.min_freq_mhz = frequency;
+    #if CIRCUITPY_PROCESSOR_IDLE_FREQUENCY
+    if (idle_frequency_mhz != 0) {
+        pm.min_freq_mhz = MIN(idle_frequency_mhz, frequency);
+    }
+    #endif
+    pm.light_sleep_enable = false;
+    CHECK_ESP_RESULT(esp_pm_configure(&pm));
+}
+#endif
+
+#if CIRCUITPY_PROCESSOR_IDLE_FREQUENCY
+// ESP-IDF's dynamic frequency scaling does the governing: the CPU runs at
+// max_freq_mhz whenever a task or ISR is running and drops to min_freq_mhz
+// when every core is in the idle task. Drivers that need a fixed APB clock
+// (UART, I2S, SPI, Wi-Fi, and PWMOut here) hold a PM lock that stops it
+// dropping while they are active.
+uint32_t common_hal_mcu_processor_get_idle_frequency(void) {
+    return idle_frequency_mhz * 1000000;
+}
+
+void common_hal_mcu_processor_set_idle_frequency(mcu_processor_obj_t *self, uint32_t frequency) {
+    esp_pm_config_t pm;
+    CHECK_ESP_RESULT(esp_pm_get_configuration(&pm));
+
+    if (frequency == 0) {
+        idle_frequency_mhz = 0;
+        pm.min_freq_mhz = pm.max_freq_mhz;
+    } else {
+        uint32_t frequency_mhz = get_valid_cpu_frequency(frequency / 1000000);
+        mp_arg_validate_int_max(frequency_mhz, pm.max_freq_mhz, MP_QSTR_idle_frequency);
+        idle_frequency_mhz = frequency_mhz;
+        pm.min_freq_mhz = frequency_mhz;
+    }
     pm.light_sleep_enable = false;
     CHECK_ESP_RESULT(esp_pm_configure(&pm));
 }
@@ -4,6 +4,7 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <stdio.h>
 #include <string.h>
 
 #include "common-hal/nvm/ByteArray.h"
@@ -11,118 +12,168 @@
 #include "bindings/espidf/__init__.h"
 
 #include "py/runtime.h"
-#include "py/gc.h"
 #include "nvs_flash.h"
+#include "supervisor/port_heap.h"
 
 uint32_t common_hal_nvm_bytearray_get_length(const nvm_bytearray_obj_t *self) {
     return self->len;
 }
 
-static void get_nvs_handle(nvs_handle_t *nvs_handle) {
-    // Initialize NVS
-    esp_err_t err = nvs_flash_init();
-    if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
-        // NVS partition was truncated and needs to be erased
-        // Retry nvs_flash_init
-        ESP_ERROR_CHECK(nvs_flash_erase());
-        err = nvs_flash_init();
+// The contents are stored as one NVS blob per fixed-size chunk, so a write
+// only appends new records for the chunks it actually changes, instead of
+// erasing and rewriting the whole array. NVS itself spreads the records over
+// its pages and compacts them as they fill. Chunks that are all zeros aren't
+// stored at all, which keeps room in the NVS partition it shares with WiFi.
+#define NVM_CHUNK_SIZE (256)
+#define NVM_CHUNK_KEY_FORMAT "d%03u"
+// Earlier releases kept everything in a single blob under this key.
+#define NVM_LEGACY_KEY "data"
+
+static nvs_handle_t nvm_handle;
+static bool nvm_handle_open;
+
+static void chunk_key(char *key, size_t key_len, uint32_t chunk) {
+    snprintf(key, key_len, NVM_CHUNK_KEY_FORMAT, (unsigned int)chunk);
+}
+
+// Chunks that were never written read back as zeros.
+static esp_err_t read_chunk(uint32_t chunk, uint8_t *buf) {
+    char key[NVS_KEY_NAME_MAX_SIZE];
+    chunk_key(key, sizeof(key), chunk);
+    size_t size = NVM_CHUNK_SIZE;
+    esp_err_t result = nvs_get_blob(nvm_handle, key, buf, &size);
+    if (result == ESP_ERR_NVS_NOT_FOUND) {
+        size = 0;
+        result = ESP_OK;
     }
-    ESP_ERROR_CHECK(err);
+    if (result == ESP_OK) {
+        memset(buf + size, 0, NVM_CHUNK_SIZE - size);
+    }
+    return result;
+}
 
-    // Open NVS handle
-    if (nvs_open("CPY", NVS_READWRITE, nvs_handle) != ESP_OK) {
-        mp_raise_RuntimeError(MP_ERROR_TEXT("NVS Error"));
+static bool chunk_is_zero(const uint8_t *buf) {
+    for (size_t i = 0; i < NVM_CHUNK_SIZE; i++) {
+        if (buf[i] != 0) {
+            return false;
+        }
     }
+    return true;
 }
 
-// Get a copy of the nvm data, or an array initialized to all 0 bytes if it is not present
-static esp_err_t get_bytes(nvs_handle_t handle, uint8_t **buf_out) {
+static esp_err_t write_chunk(uint32_t chunk, const uint8_t *buf) {
+    char key[NVS_KEY_NAME_MAX_SIZE];
+    chunk_key(key, sizeof(key), chunk);
+    if (chunk_is_zero(buf)) {
+        esp_err_t result = nvs_erase_key(nvm_handle, key);
+        return result == ESP_ERR_NVS_NOT_FOUND ? ESP_OK : result;
+    }
+    return nvs_set_blob(nvm_handle, key, buf, NVM_CHUNK_SIZE);
+}
+
+// Split a single legacy blob into chunks. Every board that used nvm before
+// has a full size legacy blob, and NVS has no room for it and the chunks at
+// once, so it is copied to RAM and dropped before the chunks are written.
+static esp_err_t migrate_legacy_blob(void) {
     size_t size;
-    void *buf;
-    esp_err_t result = nvs_get_blob(handle, "data", NULL, &size);
+    esp_err_t result = nvs_get_blob(nvm_handle, NVM_LEGACY_KEY, NULL, &size);
     if (result == ESP_ERR_NVS_NOT_FOUND) {
-        size = CIRCUITPY_INTERNAL_NVM_SIZE;
-    } else if (result != ESP_OK) {
-        *buf_out = NULL;
+        return ESP_OK;
+    }
+    if (result != ESP_OK) {
         return result;
     }
-    buf = m_malloc(size); // this SHOULD be the same as
+    uint8_t *buf = port_malloc(size, false);
+    if (buf == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    result = nvs_get_blob(nvm_handle, NVM_LEGACY_KEY, buf, &size);
     if (result == ESP_OK) {
-        result = nvs_get_blob(handle, "data", buf, &size);
-    } else {
-        result = ESP_OK;
+        result = nvs_erase_key(nvm_handle, NVM_LEGACY_KEY);
+    }
+    if (result == ESP_OK) {
+        result = nvs_commit(nvm_handle);
+    }
+    size = MIN(size, (size_t)CIRCUITPY_INTERNAL_NVM_SIZE);
+    for (uint32_t offset = 0; result == ESP_OK && offset < size; offset += NVM_CHUNK_SIZE) {
+        uint8_t chunk[NVM_CHUNK_SIZE] = {0};
+        memcpy(chunk, buf + offset, MIN((size_t)NVM_CHUNK_SIZE, size - offset));
+        result = write_chunk(offset / NVM_CHUNK_SIZE, chunk);
+    }
+    port_free(buf);
+    if (result == ESP_OK) {
+        result = nvs_commit(nvm_handle);
     }
-    *buf_out = buf;
     return result;
 }
 
-bool common_hal_nvm_bytearray_set_bytes(const nvm_bytearray_obj_t *self,
-    uint32_t start_index, uint8_t *values, uint32_t len) {
-
-    // start nvs
-    nvs_handle_t handle;
-    get_nvs_handle(&handle);
-
-    // get from flash
-    uint8_t *buf = NULL;
-    esp_err_t result = get_bytes(handle, &buf);
-    if (result != ESP_OK) {
-        gc_free(buf);
-        nvs_close(handle);
-        raise_esp_error(result);
+// The handle stays open for the life of the firmware.
+static void open_nvm(void) {
+    if (nvm_handle_open) {
+        return;
+    }
+    esp_err_t err = nvs_flash_init();
+    if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+        // NVS partition was truncated and needs to be erased
+        // Retry nvs_flash_init
+        ESP_ERROR_CHECK(nvs_flash_erase());
+        err = nvs_flash_init();
     }
+    ESP_ERROR_CHECK(err);
 
-    // erase old data, including 6.3.x incompatible data
-    result = nvs_erase_all(handle);
-    if (result != ESP_OK) {
-        gc_free(buf);
-        nvs_close(handle);
-        raise_esp_error(result);
+    if (nvs_open("CPY", NVS_READWRITE, &nvm_handle) != ESP_OK) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("NVS Error"));
     }
+    nvm_handle_open = true;
 
-    // make our modification
-    memcpy(buf + start_index, values, len);
+    CHECK_ESP_RESULT(migrate_legacy_blob());
+}
 
-    result = nvs_set_blob(handle, "data", buf, CIRCUITPY_INTERNAL_NVM_SIZE);
-    if (result != ESP_OK) {
-        gc_free(buf);
-        nvs_close(handle);
-        raise_esp_error(result);
+bool common_hal_nvm_bytearray_set_bytes(const nvm_bytearray_obj_t *self,
+    uint32_t start_index, uint8_t *values, uint32_t len) {
+    open_nvm();
+
+    bool changed = false;
+    uint8_t chunk[NVM_CHUNK_SIZE];
+    while (len > 0) {
+        uint32_t index = start_index / NVM_CHUNK_SIZE;
+        uint32_t offset = start_index % NVM_CHUNK_SIZE;
+        uint32_t count = MIN(len, NVM_CHUNK_SIZE - offset);
+
+        CHECK_ESP_RESULT(read_chunk(index, chunk));
+        // Unchanged chunks cost nothing, so rewriting the same value is free.
+        if (memcmp(chunk + offset, values, count) != 0) {
+            memcpy(chunk + offset, values, count);
+            CHECK_ESP_RESULT(write_chunk(index, chunk));
+            changed = true;
+        }
+
+        start_index += count;
+        values += count;
+        len -= count;
     }
 
-    result = nvs_commit(handle);
-    if (result != ESP_OK) {
-        gc_free(buf);
-        nvs_close(handle);
-        raise_esp_error(result);
+    // One commit for the whole slice.
+    if (changed) {
+        CHECK_ESP_RESULT(nvs_commit(nvm_handle));
     }
-
-    // close nvs
-    gc_free(buf);
-    nvs_close(handle);
     return true;
 }
 
 void common_hal_nvm_bytearray_get_bytes(const nvm_bytearray_obj_t *self,
     uint32_t start_index, uint32_t len, uint8_t *values) {
+    open_nvm();
 
-    // start nvs
-    nvs_handle_t handle;
-    get_nvs_handle(&handle);
-
-    // get from flash
-    uint8_t *buf;
-    esp_err_t result = get_bytes(handle, &buf);
-    if (result != ESP_OK) {
-        gc_free(buf);
-        nvs_close(handle);
-        raise_esp_error(result);
-    }
+    uint8_t chunk[NVM_CHUNK_SIZE];
+    while (len > 0) {
+        uint32_t offset = start_index % NVM_CHUNK_SIZE;
+        uint32_t count = MIN(len, NVM_CHUNK_SIZE - offset);
 
-    // copy the subset of data requested
-    memcpy(values, buf + start_index, len);
+        CHECK_ESP_RESULT(read_chunk(start_index / NVM_CHUNK_SIZE, chunk));
+        memcpy(values, chunk + offset, count);
 
-    // close nvs
-    gc_free(buf);
-    nvs_close(handle);
+        start_index += count;
+        values += count;
+        len -= count;
+    }
 }
@@ -9,6 +9,7 @@
 #include "shared-bindings/pwmio/PWMOut.h"
 #include "py/runtime.h"
 #include "driver/ledc.h"
+#include "esp_pm.h"
 #include "soc/soc.h"
 
 #define INDEX_EMPTY 0xFF
@@ -17,6 +18,13 @@ static uint32_t reserved_timer_freq[LEDC_TIMER_MAX];
 static bool varfreq_timers[LEDC_TIMER_MAX];
 static uint8_t reserved_channels[LEDC_CHANNEL_MAX] = { [0 ... LEDC_CHANNEL_MAX - 1] = INDEX_EMPTY};
 
+#if CONFIG_PM_ENABLE
+// Duty cycle resolution is computed from APB_CLK_FREQ, so keep APB from being
+// scaled down by microcontroller.cpu.idle_frequency while any PWMOut is active.
+// PM locks are counted, so each PWMOut acquires it once.
+static esp_pm_lock_handle_t apb_lock;
+#endif
+
 static uint32_t calculate_duty_cycle(uint32_t frequency) {
     uint32_t duty_bits = 0;
     uint32_t interval = APB_CLK_FREQ / frequency;
@@ -114,6 +122,12 @@ pwmout_result_t common_hal_pwmio_pwmout_construct(pwmio_pwmout_obj_t *self,
     self->duty_resolution = duty_bits;
     claim_pin(pin);
 
+    #if CONFIG_PM_ENABLE
+    if (apb_lock != NULL || esp_pm_lock_create(ESP_PM_APB_FREQ_MAX, 0, "pwmio", &apb_lock) == ESP_OK) {
+        esp_pm_lock_acquire(apb_lock);
+    }
+    #endif
+
     // Set initial duty
     common_hal_pwmio_pwmout_set_duty_cycle(self, duty);
 
@@ -154,6 +168,11 @@ void common_hal_pwmio_pwmout_deinit(pwmio_pwmout_obj_t *self) {
         varfreq_timers[self->tim_handle.timer_num] = false;
     }
     common_hal_reset_pin(self->pin);
+    #if CONFIG_PM_ENABLE
+    if (apb_lock != NULL) {
+        esp_pm_lock_release(apb_lock);
+    }
+    #endif
     self->deinited = true;
 }
 
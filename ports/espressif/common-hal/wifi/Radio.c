@@ -24,6 +24,7 @@
 
 #include "components/esp_netif/include/esp_netif_net_stack.h"
 #include "components/esp_wifi/include/esp_wifi.h"
+#include "esp_attr.h"
 #include "components/lwip/include/apps/ping/ping_sock.h"
 #include "lwip/sockets.h"
 
@@ -296,57 +297,46 @@ mp_obj_t common_hal_wifi_radio_get_stations_ap(wifi_radio_obj_t *self) {
     return mp_sta_list;
 }
 
-wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, mp_float_t timeout, uint8_t *bssid, size_t bssid_len) {
-    if (!common_hal_wifi_radio_get_enabled(self)) {
-        mp_raise_RuntimeError(MP_ERROR_TEXT("wifi is not enabled"));
-    }
-    wifi_config_t *config = &self->sta_config;
+// The access point and channel of the last successful connection, kept in RTC
+// memory so that waking from deep sleep can join directly instead of scanning.
+#define LAST_NETWORK_MAGIC (0x57494649)
 
-    size_t timeout_ms = timeout * 1000;
-    uint32_t start_time = common_hal_time_monotonic_ms();
-    uint32_t end_time = start_time + timeout_ms;
+typedef struct {
+    uint32_t magic;
+    uint8_t ssid[32];
+    uint8_t ssid_len;
+    uint8_t bssid[MAC_ADDRESS_LENGTH];
+    uint8_t channel;
+} last_network_t;
 
-    EventBits_t bits;
-    // can't block since both bits are false after wifi_init
-    // both bits are true after an existing connection stops
-    bits = xEventGroupWaitBits(self->event_group_handle,
-        WIFI_CONNECTED_BIT | WIFI_DISCONNECTED_BIT,
-        pdTRUE,
-        pdTRUE,
-        0);
-    bool connected = ((bits & WIFI_CONNECTED_BIT) != 0) &&
-        !((bits & WIFI_DISCONNECTED_BIT) != 0);
-    if (connected) {
-        // SSIDs are up to 32 bytes. Assume it is null terminated if it is less.
-        if (memcmp(ssid, config->sta.ssid, ssid_len) == 0 &&
-            (ssid_len == 32 || strlen((const char *)config->sta.ssid) == ssid_len)) {
-            // Already connected to the desired network.
-            return WIFI_RADIO_ERROR_NONE;
-        } else {
-            xEventGroupClearBits(self->event_group_handle, WIFI_DISCONNECTED_BIT);
-            // Trying to switch networks so disconnect first.
-            esp_wifi_disconnect();
-            do {
-                RUN_BACKGROUND_TASKS;
-                bits = xEventGroupWaitBits(self->event_group_handle,
-                    WIFI_DISCONNECTED_BIT,
-                    pdTRUE,
-                    pdTRUE,
-                    0);
-            } while ((bits & WIFI_DISCONNECTED_BIT) == 0 && !mp_hal_is_interrupted());
-        }
+static RTC_DATA_ATTR last_network_t _last_network;
+
+static bool recall_last_network(const uint8_t *ssid, size_t ssid_len) {
+    return _last_network.magic == LAST_NETWORK_MAGIC &&
+           _last_network.ssid_len == ssid_len &&
+           memcmp(_last_network.ssid, ssid, ssid_len) == 0;
+}
+
+static void remember_last_network(const uint8_t *ssid, size_t ssid_len) {
+    wifi_ap_record_t ap;
+    if (esp_wifi_sta_get_ap_info(&ap) != ESP_OK) {
+        _last_network.magic = 0;
+        return;
     }
+    memcpy(_last_network.ssid, ssid, ssid_len);
+    _last_network.ssid_len = ssid_len;
+    memcpy(_last_network.bssid, ap.bssid, MAC_ADDRESS_LENGTH);
+    _last_network.channel = ap.primary;
+    _last_network.magic = LAST_NETWORK_MAGIC;
+}
+
+static wifi_radio_error_t connect_station(wifi_radio_obj_t *self, uint8_t channel, const uint8_t *bssid, size_t bssid_len, uint8_t retries, uint32_t end_time) {
+    wifi_config_t *config = &self->sta_config;
+    EventBits_t bits;
     // explicitly clear bits since xEventGroupWaitBits may have timed out
     xEventGroupClearBits(self->event_group_handle, WIFI_CONNECTED_BIT);
     xEventGroupClearBits(self->event_group_handle, WIFI_DISCONNECTED_BIT);
-    set_mode_station(self, true);
 
-    memcpy(&config->sta.ssid, ssid, ssid_len);
-    if (ssid_len < 32) {
-        config->sta.ssid[ssid_len] = 0;
-    }
-    memcpy(&config->sta.password, password, password_len);
-    config->sta.password[password_len] = 0;
     config->sta.channel = channel;
     // From esp_wifi_types.h:
     //   Generally, station_config.bssid_set needs to be 0; and it needs
@@ -366,8 +356,8 @@ wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t
         config->sta.scan_method = WIFI_FAST_SCAN;
     }
     esp_wifi_set_config(ESP_IF_WIFI_STA, config);
-    self->starting_retries = 5;
-    self->retries_left = 5;
+    self->starting_retries = retries;
+    self->retries_left = retries;
     esp_wifi_connect();
 
     do {
@@ -395,13 +385,87 @@ wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t
             return WIFI_RADIO_ERROR_NO_AP_FOUND;
         }
         return self->last_disconnect_reason;
-    } else {
-        // We're connected, allow us to retry if we get disconnected.
-        self->retries_left = self->starting_retries;
+    } else if ((bits & WIFI_CONNECTED_BIT) == 0) {
+        // Interrupted.
+        return WIFI_RADIO_ERROR_UNSPECIFIED;
     }
     return WIFI_RADIO_ERROR_NONE;
 }
 
+wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, mp_float_t timeout, uint8_t *bssid, size_t bssid_len) {
+    if (!common_hal_wifi_radio_get_enabled(self)) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("wifi is not enabled"));
+    }
+    wifi_config_t *config = &self->sta_config;
+
+    size_t timeout_ms = timeout * 1000;
+    uint32_t start_time = common_hal_time_monotonic_ms();
+    uint32_t end_time = start_time + timeout_ms;
+
+    EventBits_t bits;
+    // can't block since both bits are false after wifi_init
+    // both bits are true after an existing connection stops
+    bits = xEventGroupWaitBits(self->event_group_handle,
+        WIFI_CONNECTED_BIT | WIFI_DISCONNECTED_BIT,
+        pdTRUE,
+        pdTRUE,
+        0);
+    bool connected = ((bits & WIFI_CONNECTED_BIT) != 0) &&
+        !((bits & WIFI_DISCONNECTED_BIT) != 0);
+    if (connected) {
+        // SSIDs are up to 32 bytes. Assume it is null terminated if it is less.
+        if (memcmp(ssid, config->sta.ssid, ssid_len) == 0 &&
+            (ssid_len == 32 || strlen((const char *)config->sta.ssid) == ssid_len)) {
+            // Already connected to the desired network.
+            return WIFI_RADIO_ERROR_NONE;
+        } else {
+            xEventGroupClearBits(self->event_group_handle, WIFI_DISCONNECTED_BIT);
+            // Trying to switch networks so disconnect first.
+            esp_wifi_disconnect();
+            do {
+                RUN_BACKGROUND_TASKS;
+                bits = xEventGroupWaitBits(self->event_group_handle,
+                    WIFI_DISCONNECTED_BIT,
+                    pdTRUE,
+                    pdTRUE,
+                    0);
+            } while ((bits & WIFI_DISCONNECTED_BIT) == 0 && !mp_hal_is_interrupted());
+        }
+    }
+    set_mode_station(self, true);
+
+    memcpy(&config->sta.ssid, ssid, ssid_len);
+    if (ssid_len < 32) {
+        config->sta.ssid[ssid_len] = 0;
+    }
+    memcpy(&config->sta.password, password, password_len);
+    config->sta.password[password_len] = 0;
+
+    wifi_radio_error_t error = WIFI_RADIO_ERROR_UNSPECIFIED;
+    // Without a channel or BSSID, first try to join the access point that
+    // worked last time directly. A single attempt is enough to tell whether
+    // it's still there.
+    bool fast = channel == 0 && bssid_len == 0 && recall_last_network(ssid, ssid_len);
+    if (fast) {
+        error = connect_station(self, _last_network.channel, _last_network.bssid, MAC_ADDRESS_LENGTH, 0, end_time);
+        if (error != WIFI_RADIO_ERROR_NONE && error != WIFI_RADIO_ERROR_AUTH_FAIL && !mp_hal_is_interrupted()) {
+            _last_network.magic = 0;
+            fast = false;
+        }
+    }
+    if (!fast) {
+        error = connect_station(self, channel, bssid, bssid_len, 5, end_time);
+    }
+    if (error != WIFI_RADIO_ERROR_NONE) {
+        return error;
+    }
+    remember_last_network(ssid, ssid_len);
+    // We're connected, allow us to retry if we get disconnected.
+    self->starting_retries = 5;
+    self->retries_left = self->starting_retries;
+    return WIFI_RADIO_ERROR_NONE;
+}
+
 bool common_hal_wifi_radio_get_connected(wifi_radio_obj_t *self) {
     return self->sta_mode && esp_netif_is_netif_up(self->netif);
 }
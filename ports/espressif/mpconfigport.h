@@ -53,6 +53,12 @@
 #define CIRCUITPY_I2C_ALLOW_INTERNAL_PULL_UP (0)
 #endif
 
+// Messages the TWAI driver can hold before canio reads them. IDF's default of 5 is about
+// half a millisecond of back to back frames at 1 Mbit/s.
+#ifndef CIRCUITPY_CANIO_RX_QUEUE_LENGTH
+#define CIRCUITPY_CANIO_RX_QUEUE_LENGTH (64)
+#endif
+
 // Protect the background queue with a lock because both cores may modify it.
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -60,6 +66,10 @@ extern portMUX_TYPE background_task_mutex;
 #define CALLBACK_CRITICAL_BEGIN (taskENTER_CRITICAL(&background_task_mutex))
 #define CALLBACK_CRITICAL_END (taskEXIT_CRITICAL(&background_task_mutex))
 
+// TinyUSB runs in its own task here, so the main task must not read or write disks for USB.
+#define CIRCUITPY_USB_MSC_WRITE_QUEUE_LENGTH (0)
+#define CIRCUITPY_USB_MSC_READ_AHEAD (0)
+
 // 20 dBm is the default and the highest max tx power.
 // Allow a different value to be specified for boards that have trouble with using the maximum power.
 #ifndef CIRCUITPY_WIFI_DEFAULT_TX_POWER
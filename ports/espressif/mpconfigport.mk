@@ -30,6 +30,12 @@ LONGINT_IMPL = MPZ
 # Default to no-psram
 CIRCUITPY_ESP_PSRAM_SIZE ?= 0
 
+# With PSRAM most of the VM heap ends up there, so keep a fast area in internal
+# SRAM for the small objects that are used most.
+ifneq ($(CIRCUITPY_ESP_PSRAM_SIZE),0)
+CIRCUITPY_GC_FAST_AREA_SIZE ?= 32768
+endif
+
 # New 4MB boards will not have OTA support but more room for alarm, ble and other
 # newer features.
 CIRCUITPY_LEGACY_4MB_FLASH_LAYOUT ?= 0
@@ -292,6 +298,7 @@ CIRCUITPY_SETTABLE_PROCESSOR_FREQUENCY = 0
 else
 CIRCUITPY_SETTABLE_PROCESSOR_FREQUENCY = 1
 endif
+CIRCUITPY_PROCESSOR_IDLE_FREQUENCY ?= $(CIRCUITPY_SETTABLE_PROCESSOR_FREQUENCY)
 
 # No room for dualbank or mp3 on boards with 2MB flash
 ifeq ($(CIRCUITPY_ESP_FLASH_SIZE),2MB)
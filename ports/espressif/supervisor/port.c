@@ -304,6 +304,12 @@ void port_heap_init(void) {
 }
 
 void *port_malloc(size_t size, bool dma_capable) {
+    #if CIRCUITPY_PORT_HEAP_POOLS
+    void *pooled = port_heap_pool_malloc(size);
+    if (pooled != NULL) {
+        return pooled;
+    }
+    #endif
     size_t caps = MALLOC_CAP_8BIT;
     if (dma_capable) {
         caps |= MALLOC_CAP_DMA;
@@ -320,11 +326,25 @@ void *port_malloc(size_t size, bool dma_capable) {
     return ptr;
 }
 
+void *port_malloc_fast(size_t size) {
+    return heap_caps_malloc(size, MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL);
+}
+
 void port_free(void *ptr) {
+    #if CIRCUITPY_PORT_HEAP_POOLS
+    if (port_heap_pool_free(ptr)) {
+        return;
+    }
+    #endif
     heap_caps_free(ptr);
 }
 
 void *port_realloc(void *ptr, size_t size, bool dma_capable) {
+    #if CIRCUITPY_PORT_HEAP_POOLS
+    if (port_heap_pool_realloc(&ptr, size, dma_capable)) {
+        return ptr;
+    }
+    #endif
     size_t caps = MALLOC_CAP_8BIT;
     if (dma_capable) {
         caps |= MALLOC_CAP_DMA;
@@ -337,6 +357,10 @@ size_t port_heap_get_largest_free_size(void) {
     return free_size;
 }
 
+size_t port_heap_get_free_size(void) {
+    return heap_caps_get_free_size(MALLOC_CAP_8BIT);
+}
+
 void reset_port(void) {
     // TODO deinit for esp32-camera
     #if CIRCUITPY_ESPCAMERA
@@ -477,6 +501,48 @@ void port_yield() {
     vTaskDelay(4);
 }
 
+#if !(defined(CONFIG_FREERTOS_UNICORE) && CONFIG_FREERTOS_UNICORE)
+// Offloaded work runs in a task on the core that CircuitPython isn't on, below the priority of
+// the wifi and bluetooth tasks that share it.
+static TaskHandle_t _offload_task = NULL;
+static volatile bool _offload_task_done;
+
+static void offload_task_main(void *arg) {
+    void (*core_main)(void) = arg;
+    core_main();
+    _offload_task_done = true;
+    vTaskDelete(NULL);
+}
+
+bool port_offload_start(void (*core_main)(void)) {
+    _offload_task_done = false;
+    BaseType_t result = xTaskCreatePinnedToCore(offload_task_main, "offload", 4096, core_main,
+        tskIDLE_PRIORITY + 1, &_offload_task, CONFIG_ESP_MAIN_TASK_AFFINITY ? 0 : 1);
+    if (result != pdPASS) {
+        _offload_task = NULL;
+        return false;
+    }
+    return true;
+}
+
+void port_offload_stop(void) {
+    while (_offload_task != NULL && !_offload_task_done) {
+        vTaskDelay(1);
+    }
+    _offload_task = NULL;
+}
+
+void port_offload_wake(void) {
+    if (_offload_task != NULL) {
+        xTaskNotifyGive(_offload_task);
+    }
+}
+
+void port_offload_idle(void) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+}
+#endif
+
 void sleep_timer_cb(void *arg) {
     port_wake_main_task();
 }
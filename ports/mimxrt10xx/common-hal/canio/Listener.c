@@ -99,20 +99,28 @@ int common_hal_canio_listener_in_waiting(canio_listener_obj_t *self) {
     return 0;
 }
 
-mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+// Waits up to the timeout for a message, returning whether there is one.
+static bool wait_for_message(canio_listener_obj_t *self) {
     if (!common_hal_canio_listener_in_waiting(self)) {
         uint64_t deadline = supervisor_ticks_ms64() + self->timeout_ms;
         do {
             if (supervisor_ticks_ms64() > deadline) {
-                return NULL;
+                return false;
             }
             RUN_BACKGROUND_TASKS;
             // Allow user to break out of a timeout with a KeyboardInterrupt.
             if (mp_hal_is_interrupted()) {
-                return NULL;
+                return false;
             }
         } while (!common_hal_canio_listener_in_waiting(self));
     }
+    return true;
+}
+
+bool common_hal_canio_listener_receive_into(canio_listener_obj_t *self, canio_message_obj_t *message, bool wait) {
+    if (wait ? !wait_for_message(self) : !common_hal_canio_listener_in_waiting(self)) {
+        return false;
+    }
 
     flexcan_frame_t rx_frame;
     if (FLEXCAN_ReadRxFifo(self->can->data->base, &rx_frame) != kStatus_Success) {
@@ -123,7 +131,6 @@ mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
     // allows the CPU to serve the next FIFO entry
     FLEXCAN_ClearMbStatusFlags(self->can->data->base, (uint32_t)kFLEXCAN_RxFifoFrameAvlFlag);
 
-    canio_message_obj_t *message = m_new_obj(canio_message_obj_t);
     memset(message, 0, sizeof(canio_message_obj_t));
 
     if (rx_frame.format == kFLEXCAN_FrameFormatExtend) {
@@ -153,7 +160,7 @@ mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
     message->data[6] = rx_frame.dataByte6;
     message->data[7] = rx_frame.dataByte7;
 
-    return message;
+    return true;
 }
 
 void common_hal_canio_listener_deinit(canio_listener_obj_t *self) {
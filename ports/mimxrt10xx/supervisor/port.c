@@ -83,6 +83,9 @@ extern uint32_t _ld_dtcm_data_flash_copy;
 extern uint32_t _ld_itcm_destination;
 extern uint32_t _ld_itcm_size;
 extern uint32_t _ld_itcm_flash_copy;
+extern uint32_t _ld_itcm_profiled_destination;
+extern uint32_t _ld_itcm_profiled_size;
+extern uint32_t _ld_itcm_profiled_flash_copy;
 extern uint32_t _ld_isr_destination;
 extern uint32_t _ld_isr_size;
 extern uint32_t _ld_isr_flash_copy;
@@ -192,6 +195,9 @@ __attribute__((used, naked, no_instrument_function, optimize("no-tree-loop-distr
     for (uint32_t i = 0; i < ((size_t)&_ld_itcm_size) / 4; i++) {
         (&_ld_itcm_destination)[i] = (&_ld_itcm_flash_copy)[i];
     }
+    for (uint32_t i = 0; i < ((size_t)&_ld_itcm_profiled_size) / 4; i++) {
+        (&_ld_itcm_profiled_destination)[i] = (&_ld_itcm_profiled_flash_copy)[i];
+    }
 
     for (uint32_t i = 0; i < ((size_t)&_ld_isr_size) / 4; i++) {
         (&_ld_isr_destination)[i] = (&_ld_isr_flash_copy)[i];
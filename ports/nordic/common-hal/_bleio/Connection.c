@@ -382,6 +382,40 @@ void common_hal_bleio_connection_set_connection_interval(bleio_connection_intern
     check_nrf_error(status);
 }
 
+void common_hal_bleio_connection_request_high_throughput(bleio_connection_internal_t *self) {
+    ble_gap_phys_t const phys = {
+        .rx_phys = BLE_GAP_PHY_2MBPS,
+        .tx_phys = BLE_GAP_PHY_2MBPS,
+    };
+    check_nrf_error(sd_ble_gap_phy_update(self->conn_handle, &phys));
+
+    // Ask for full 251 byte link layer packets. When the configured event length can't fit them,
+    // let the SoftDevice pick the largest it can instead. BUSY means the peer started a data
+    // length update of its own, which connection_on_ble_evt() answers the same way.
+    ble_gap_data_length_params_t const dl_params = {
+        .max_tx_octets = 251,
+        .max_rx_octets = 251,
+        .max_tx_time_us = BLE_GAP_DATA_LENGTH_AUTO,
+        .max_rx_time_us = BLE_GAP_DATA_LENGTH_AUTO,
+    };
+    uint32_t status = sd_ble_gap_data_length_update(self->conn_handle, &dl_params, NULL);
+    if (status == NRF_ERROR_RESOURCES || status == NRF_ERROR_NOT_SUPPORTED) {
+        status = sd_ble_gap_data_length_update(self->conn_handle, NULL, NULL);
+    }
+    if (status != NRF_ERROR_BUSY) {
+        check_nrf_error(status);
+    }
+
+    // The ATT MTU can only be exchanged once per connection, and a central has already asked.
+    // The size has to match the one given to sd_ble_gatts_exchange_mtu_reply().
+    if (self->mtu == 0) {
+        status = sd_ble_gattc_exchange_mtu_request(self->conn_handle, BLE_GATTS_VAR_ATTR_LEN_MAX);
+        if (status != NRF_ERROR_INVALID_STATE && status != NRF_ERROR_BUSY) {
+            check_nrf_error(status);
+        }
+    }
+}
+
 // service_uuid may be NULL, to discover all services.
 static bool discover_next_services(bleio_connection_internal_t *connection, uint16_t start_handle, ble_uuid_t *service_uuid) {
     m_discovery_successful = false;
@@ -45,13 +45,20 @@ static void write_to_ringbuf(bleio_packet_buffer_obj_t *self, uint8_t *data, uin
     sd_nvic_critical_region_exit(is_nested_critical_region);
 }
 
+// The SD reports sent packets per connection, not per characteristic, so with more than one
+// PacketBuffer on a connection this can count another's packets as ours. That only lets the next
+// packet be handed over early, which the SD refuses if its queue is full.
+static void packets_sent(bleio_packet_buffer_obj_t *self, uint8_t count) {
+    self->packets_queued -= MIN(count, self->packets_queued);
+}
+
 static uint32_t queue_next_write(bleio_packet_buffer_obj_t *self) {
     // Queue up the next outgoing buffer. We use two, one that has been passed to the SD for
-    // transmission (when packet_queued is true) and the other is `pending` and can still be
+    // transmission (when packets_queued is non-zero) and the other is `pending` and can still be
     // modified. By primarily appending to the `pending` buffer we can reduce the protocol overhead
-    // of the lower level link and ATT layers.
-    self->packet_queued = false;
-    if (self->pending_size > 0) {
+    // of the lower level link and ATT layers. With max_queued_packets above one, several packets go
+    // to the SD at once so that it can send them all in the same connection event.
+    if (self->pending_size > 0 && self->packets_queued < self->max_queued_packets) {
         uint16_t conn_handle = self->conn_handle;
         uint32_t err_code;
         if (self->client) {
@@ -82,7 +89,7 @@ static uint32_t queue_next_write(bleio_packet_buffer_obj_t *self) {
         }
         self->pending_size = 0;
         self->pending_index = (self->pending_index + 1) % 2;
-        self->packet_queued = true;
+        self->packets_queued++;
     }
     return NRF_SUCCESS;
 }
@@ -92,6 +99,7 @@ static bool packet_buffer_on_ble_client_evt(ble_evt_t *ble_evt, void *param) {
     bleio_packet_buffer_obj_t *self = (bleio_packet_buffer_obj_t *)param;
     if (evt_id == BLE_GAP_EVT_DISCONNECTED && self->conn_handle == ble_evt->evt.gap_evt.conn_handle) {
         self->conn_handle = BLE_CONN_HANDLE_INVALID;
+        self->packets_queued = 0;
     }
     // Check if this is a GATTC event so we can make sure the conn_handle is valid.
     if (evt_id < BLE_GATTC_EVT_BASE || evt_id > BLE_GATTC_EVT_LAST) {
@@ -116,9 +124,11 @@ static bool packet_buffer_on_ble_client_evt(ble_evt_t *ble_evt, void *param) {
             break;
         }
         case BLE_GATTC_EVT_WRITE_CMD_TX_COMPLETE:
+            packets_sent(self, ble_evt->evt.gattc_evt.params.write_cmd_tx_complete.count);
             queue_next_write(self);
             break;
         case BLE_GATTC_EVT_WRITE_RSP:
+            packets_sent(self, 1);
             queue_next_write(self);
             break;
         default:
@@ -177,9 +187,22 @@ static bool packet_buffer_on_ble_server_evt(ble_evt_t *ble_evt, void *param) {
         case BLE_GAP_EVT_DISCONNECTED:
             if (self->conn_handle == ble_evt->evt.gap_evt.conn_handle) {
                 self->conn_handle = BLE_CONN_HANDLE_INVALID;
+                self->packets_queued = 0;
             }
             break;
         case BLE_GATTS_EVT_HVN_TX_COMPLETE:
+            if (self->conn_handle != ble_evt->evt.gatts_evt.conn_handle) {
+                return false;
+            }
+            packets_sent(self, ble_evt->evt.gatts_evt.params.hvn_tx_complete.count);
+            queue_next_write(self);
+            break;
+        case BLE_GATTS_EVT_HVC:
+            if (self->conn_handle != ble_evt->evt.gatts_evt.conn_handle ||
+                ble_evt->evt.gatts_evt.params.hvc.handle != self->characteristic->handle) {
+                return false;
+            }
+            packets_sent(self, 1);
             queue_next_write(self);
             break;
         default:
@@ -216,7 +239,8 @@ void _common_hal_bleio_packet_buffer_construct(
         ringbuf_init(&self->ringbuf, (uint8_t *)incoming_buffer, incoming_buffer_size);
     }
 
-    self->packet_queued = false;
+    self->packets_queued = 0;
+    self->max_queued_packets = 1;
     self->pending_index = 0;
     self->pending_size = 0;
     self->outgoing[0] = outgoing_buffer1;
@@ -261,7 +285,7 @@ void _common_hal_bleio_packet_buffer_construct(
 
 void common_hal_bleio_packet_buffer_construct(
     bleio_packet_buffer_obj_t *self, bleio_characteristic_obj_t *characteristic,
-    size_t buffer_size, size_t max_packet_size) {
+    size_t buffer_size, size_t max_packet_size, size_t max_queued_packets) {
 
     // Cap the packet size to our implementation limits.
     max_packet_size = MIN(max_packet_size, BLE_GATTS_VAR_ATTR_LEN_MAX - 3);
@@ -291,6 +315,12 @@ void common_hal_bleio_packet_buffer_construct(
         incoming_buffer, incoming_buffer_size,
         outgoing1, outgoing2, max_packet_size,
         NULL);
+
+    // The SD copies notifications and writes without response into its own queue, so several can
+    // be handed over at once. Indications and writes with response wait for the peer one at a time.
+    if (self->client ? self->write_type == BLE_GATT_OP_WRITE_CMD : self->write_type == BLE_GATT_HVX_NOTIFICATION) {
+        self->max_queued_packets = MIN(max_queued_packets, UINT8_MAX);
+    }
 }
 
 mp_int_t common_hal_bleio_packet_buffer_readinto(bleio_packet_buffer_obj_t *self, uint8_t *data, size_t len) {
@@ -383,8 +413,8 @@ mp_int_t common_hal_bleio_packet_buffer_write(bleio_packet_buffer_obj_t *self, c
 
     sd_nvic_critical_region_exit(is_nested_critical_region);
 
-    // If no writes are queued then sneak in this data.
-    if (!self->packet_queued) {
+    // If the SD can take another packet then sneak in this data.
+    if (self->packets_queued < self->max_queued_packets) {
         queue_next_write(self);
     }
     return num_bytes_written;
@@ -467,7 +497,7 @@ mp_int_t common_hal_bleio_packet_buffer_get_outgoing_packet_length(bleio_packet_
 
 void common_hal_bleio_packet_buffer_flush(bleio_packet_buffer_obj_t *self) {
     while ((self->pending_size != 0 ||
-            self->packet_queued) &&
+            self->packets_queued != 0) &&
            self->conn_handle != BLE_CONN_HANDLE_INVALID &&
            !mp_hal_is_interrupted()) {
         RUN_BACKGROUND_TASKS;
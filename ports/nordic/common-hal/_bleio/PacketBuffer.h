@@ -19,7 +19,8 @@ typedef struct {
     // Ring buffer storing consecutive incoming values.
     ringbuf_t ringbuf;
     // Two outgoing buffers to alternate between. One will be queued for transmission by the SD and
-    // the other is waiting to be queued and can be extended.
+    // the other is waiting to be queued and can be extended. When more than one packet may be
+    // queued, the SD has copied them so the buffers can be reused straight away.
     uint32_t *outgoing[2];
     volatile uint16_t pending_size;
     // We remember the conn_handle so we can do a NOTIFY/INDICATE to a client.
@@ -28,8 +29,10 @@ typedef struct {
     uint16_t max_packet_size;
     uint8_t pending_index;
     uint8_t write_type;
+    // Packets handed to the SD and not yet reported sent, and how many there may be.
+    volatile uint8_t packets_queued;
+    uint8_t max_queued_packets;
     bool client;
-    bool packet_queued;
 } bleio_packet_buffer_obj_t;
 
 typedef ble_drv_evt_handler_entry_t ble_event_handler_t;
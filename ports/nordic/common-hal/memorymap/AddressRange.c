@@ -112,3 +112,65 @@ void common_hal_memorymap_addressrange_get_bytes(const memorymap_addressrange_ob
     }
     #pragma GCC diagnostic pop
 }
+
+void common_hal_memorymap_addressrange_write(const memorymap_addressrange_obj_t *self,
+    size_t start_index, size_t width, const uint8_t *values, size_t len) {
+    uint8_t *address = self->start_address + start_index;
+    if (((size_t)address) % width != 0) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Unable to access unaligned IO register"));
+    }
+    // Each element is a single volatile store of exactly `width` bytes. The
+    // buffer itself may not be aligned so elements are copied out of it.
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wcast-align"
+    if (width == sizeof(uint32_t)) {
+        volatile uint32_t *dest = (volatile uint32_t *)address;
+        for (size_t i = 0; i < len; i += sizeof(uint32_t)) {
+            uint32_t value;
+            memcpy(&value, values + i, sizeof(value));
+            *dest++ = value;
+        }
+    } else if (width == sizeof(uint16_t)) {
+        volatile uint16_t *dest = (volatile uint16_t *)address;
+        for (size_t i = 0; i < len; i += sizeof(uint16_t)) {
+            uint16_t value;
+            memcpy(&value, values + i, sizeof(value));
+            *dest++ = value;
+        }
+    } else {
+        volatile uint8_t *dest = address;
+        for (size_t i = 0; i < len; i++) {
+            *dest++ = values[i];
+        }
+    }
+    #pragma GCC diagnostic pop
+}
+
+void common_hal_memorymap_addressrange_readinto(const memorymap_addressrange_obj_t *self,
+    size_t start_index, size_t width, uint8_t *values, size_t len) {
+    uint8_t *address = self->start_address + start_index;
+    if (((size_t)address) % width != 0) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Unable to access unaligned IO register"));
+    }
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wcast-align"
+    if (width == sizeof(uint32_t)) {
+        const volatile uint32_t *src = (const volatile uint32_t *)address;
+        for (size_t i = 0; i < len; i += sizeof(uint32_t)) {
+            uint32_t value = *src++;
+            memcpy(values + i, &value, sizeof(value));
+        }
+    } else if (width == sizeof(uint16_t)) {
+        const volatile uint16_t *src = (const volatile uint16_t *)address;
+        for (size_t i = 0; i < len; i += sizeof(uint16_t)) {
+            uint16_t value = *src++;
+            memcpy(values + i, &value, sizeof(value));
+        }
+    } else {
+        const volatile uint8_t *src = address;
+        for (size_t i = 0; i < len; i++) {
+            values[i] = *src++;
+        }
+    }
+    #pragma GCC diagnostic pop
+}
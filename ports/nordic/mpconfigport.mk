@@ -6,6 +6,9 @@ INTERNAL_LIBM = 1
 
 CIRCUITPY_BUILD_EXTENSIONS ?= uf2
 
+# All supported chips are Cortex-M4F.
+CIRCUITPY_FROZEN_NATIVE_ARCH ?= armv7emsp
+
 # Number of USB endpoint pairs.
 USB_NUM_ENDPOINT_PAIRS = 8
 
@@ -10,6 +10,9 @@
 #include "shared-bindings/audiocore/WaveFile.h"
 #include "shared-bindings/microcontroller/__init__.h"
 #include "bindings/rp2pio/StateMachine.h"
+#if CIRCUITPY_ANALOGBUFIO
+#include "common-hal/analogbufio/BufferedIn.h"
+#endif
 #include "supervisor/background_callback.h"
 
 #include "py/mpstate.h"
@@ -32,6 +35,52 @@ void audio_dma_reset(void) {
 }
 
 
+// The converters are inlined with constant flags so each format pair gets its own loop
+// without per-sample branches.
+static inline __attribute__((always_inline)) uint32_t convert_8_to_16(uint16_t *restrict output,
+    const uint8_t *restrict input, uint32_t input_length, uint8_t spacing,
+    bool signed_to_unsigned, bool unsigned_to_signed, uint16_t mul, uint16_t offset) {
+    uint32_t out_i = 0;
+    for (uint32_t i = 0; i < input_length; i += spacing) {
+        if (signed_to_unsigned) {
+            output[out_i] = (uint16_t)(((int8_t)input[i] + 0x80) * mul);
+        } else if (unsigned_to_signed) {
+            output[out_i] = (uint16_t)(int16_t)(input[i] * mul - offset);
+        } else {
+            output[out_i] = (uint16_t)(input[i] * mul);
+        }
+        out_i += 1;
+    }
+    return out_i;
+}
+
+static inline __attribute__((always_inline)) uint32_t convert_8_to_8(uint8_t *restrict output,
+    const uint8_t *restrict input, uint32_t input_length, uint8_t spacing, bool convert_sign) {
+    uint32_t out_i = 0;
+    for (uint32_t i = 0; i < input_length; i += spacing) {
+        // Flipping the top bit converts either way between signed and unsigned.
+        output[out_i] = convert_sign ? input[i] ^ 0x80 : input[i];
+        out_i += 1;
+    }
+    return out_i;
+}
+
+static inline __attribute__((always_inline)) uint32_t convert_16_to_16(uint16_t *restrict output,
+    const uint16_t *restrict input, uint32_t input_length, uint8_t spacing,
+    bool convert_sign, bool output_signed, size_t shift) {
+    uint32_t out_i = 0;
+    for (uint32_t i = 0; i < input_length / 2; i += spacing) {
+        uint16_t value = convert_sign ? input[i] ^ 0x8000 : input[i];
+        if (output_signed) {
+            output[out_i] = (uint16_t)((int16_t)value >> shift);
+        } else {
+            output[out_i] = value >> shift;
+        }
+        out_i += 1;
+    }
+    return out_i;
+}
+
 static size_t audio_dma_convert_samples(audio_dma_t *dma, uint8_t *input, uint32_t input_length, uint8_t *output, uint32_t output_length) {
     #pragma GCC diagnostic push
     #pragma GCC diagnostic ignored "-Wcast-align"
@@ -42,6 +91,7 @@ static size_t audio_dma_convert_samples(audio_dma_t *dma, uint8_t *input, uint32
         mp_raise_RuntimeError(MP_ERROR_TEXT("Internal audio buffer too small"));
     }
 
+    uint8_t spacing = dma->sample_spacing;
     uint32_t out_i = 0;
     if (dma->sample_resolution <= 8 && dma->output_resolution > 8) {
         // reading bytes, writing 16-bit words, so output buffer will be bigger.
@@ -59,45 +109,37 @@ static size_t audio_dma_convert_samples(audio_dma_t *dma, uint8_t *input, uint32
         uint16_t mul = ((1 << dma->output_resolution) - 1) / ((1 << dma->sample_resolution) - 1);
         uint16_t offset = (1 << dma->output_resolution) / 2;
 
-        for (uint32_t i = 0; i < input_length; i += dma->sample_spacing) {
-            if (dma->signed_to_unsigned) {
-                ((uint16_t *)output)[out_i] = (uint16_t)((((int8_t *)input)[i] + 0x80) * mul);
-            } else if (dma->unsigned_to_signed) {
-                ((int16_t *)output)[out_i] = (int16_t)(((uint8_t *)input)[i] * mul - offset);
-            } else {
-                ((uint16_t *)output)[out_i] = (uint16_t)(((uint8_t *)input)[i] * mul);
-            }
-            out_i += 1;
+        uint16_t *output16 = (uint16_t *)output;
+        if (dma->signed_to_unsigned) {
+            out_i = convert_8_to_16(output16, input, input_length, spacing, true, false, mul, offset);
+        } else if (dma->unsigned_to_signed) {
+            out_i = convert_8_to_16(output16, input, input_length, spacing, false, true, mul, offset);
+        } else {
+            out_i = convert_8_to_16(output16, input, input_length, spacing, false, false, mul, offset);
         }
     } else if (dma->sample_resolution <= 8 && dma->output_resolution <= 8) {
-        for (uint32_t i = 0; i < input_length; i += dma->sample_spacing) {
-            if (dma->signed_to_unsigned) {
-                ((uint8_t *)output)[out_i] = ((int8_t *)input)[i] + 0x80;
-            } else if (dma->unsigned_to_signed) {
-                ((int8_t *)output)[out_i] = ((uint8_t *)input)[i] - 0x80;
-            } else {
-                ((uint8_t *)output)[out_i] = ((uint8_t *)input)[i];
-            }
-            out_i += 1;
+        if (dma->signed_to_unsigned || dma->unsigned_to_signed) {
+            out_i = convert_8_to_8(output, input, input_length, spacing, true);
+        } else {
+            out_i = convert_8_to_8(output, input, input_length, spacing, false);
         }
     } else if (dma->sample_resolution > 8 && dma->output_resolution > 8) {
         size_t shift = 16 - dma->output_resolution;
-        for (uint32_t i = 0; i < input_length / 2; i += dma->sample_spacing) {
-            if (dma->signed_to_unsigned) {
-                ((uint16_t *)output)[out_i] = ((int16_t *)input)[i] + 0x8000;
-            } else if (dma->unsigned_to_signed) {
-                ((int16_t *)output)[out_i] = ((uint16_t *)input)[i] - 0x8000;
+        uint16_t *output16 = (uint16_t *)output;
+        const uint16_t *input16 = (const uint16_t *)input;
+        bool convert_sign = dma->signed_to_unsigned || dma->unsigned_to_signed;
+        if (dma->output_signed) {
+            if (convert_sign) {
+                out_i = convert_16_to_16(output16, input16, input_length, spacing, true, true, shift);
             } else {
-                ((uint16_t *)output)[out_i] = ((uint16_t *)input)[i];
+                out_i = convert_16_to_16(output16, input16, input_length, spacing, false, true, shift);
             }
-            if (dma->output_resolution < 16) {
-                if (dma->output_signed) {
-                    ((int16_t *)output)[out_i] = ((int16_t *)output)[out_i] >> shift;
-                } else {
-                    ((uint16_t *)output)[out_i] = ((uint16_t *)output)[out_i] >> shift;
-                }
+        } else {
+            if (convert_sign) {
+                out_i = convert_16_to_16(output16, input16, input_length, spacing, true, false, shift);
+            } else {
+                out_i = convert_16_to_16(output16, input16, input_length, spacing, false, false, shift);
             }
-            out_i += 1;
         }
     } else {
         // (dma->sample_resolution > 8 && dma->output_resolution <= 8)
@@ -116,6 +158,16 @@ static size_t audio_dma_convert_samples(audio_dma_t *dma, uint8_t *input, uint32
     return output_length_used;
 }
 
+// The DMA can read the sample's own buffer when it is in SRAM and aligned for the transfer
+// size. Flash and PSRAM are avoided because XIP may be disabled or cached when the DMA reads.
+static bool audio_dma_can_read_directly(audio_dma_t *dma, uint8_t *sample_buffer) {
+    uintptr_t address = (uintptr_t)sample_buffer;
+    if (!dma->zero_copy || address < SRAM_BASE || address >= SRAM_END) {
+        return false;
+    }
+    return (address & (dma->output_size - 1)) == 0;
+}
+
 // buffer_idx is 0 or 1.
 static void audio_dma_load_next_block(audio_dma_t *dma, size_t buffer_idx) {
     assert(dma->channel[buffer_idx] < NUM_DMA_CHANNELS);
@@ -133,15 +185,23 @@ static void audio_dma_load_next_block(audio_dma_t *dma, size_t buffer_idx) {
         return;
     }
 
-    // Convert the sample format resolution and signedness, as necessary.
-    // The input sample buffer is what was read from a file, Mixer, or a raw sample buffer.
-    // The output buffer is one of the DMA buffers (passed in).
-
-    size_t output_length_used = audio_dma_convert_samples(
-        dma, sample_buffer, sample_buffer_length,
-        dma->buffer[buffer_idx], dma->buffer_length[buffer_idx]);
+    size_t output_length_used;
+    if (audio_dma_can_read_directly(dma, sample_buffer)) {
+        // Samples double buffer, so this block isn't overwritten until this channel asks for
+        // its next one. The sample stays referenced from dma->sample until playback stops.
+        dma->read_addr[buffer_idx] = sample_buffer;
+        output_length_used = sample_buffer_length;
+    } else {
+        // Convert the sample format resolution and signedness, as necessary.
+        // The input sample buffer is what was read from a file, Mixer, or a raw sample buffer.
+        // The output buffer is one of the DMA buffers (passed in).
+        dma->read_addr[buffer_idx] = dma->buffer[buffer_idx];
+        output_length_used = audio_dma_convert_samples(
+            dma, sample_buffer, sample_buffer_length,
+            dma->buffer[buffer_idx], dma->buffer_length[buffer_idx]);
+    }
 
-    dma_channel_set_read_addr(dma_channel, dma->buffer[buffer_idx], false /* trigger */);
+    dma_channel_set_read_addr(dma_channel, dma->read_addr[buffer_idx], false /* trigger */);
     dma_channel_set_trans_count(dma_channel, output_length_used / dma->output_size, false /* trigger */);
 
     if (get_buffer_result == GET_BUFFER_DONE) {
@@ -196,6 +256,7 @@ audio_dma_result audio_dma_setup_playback(
 
     dma->sample = sample;
     dma->loop = loop;
+    dma->underruns = 0;
     dma->single_channel_output = single_channel_output;
     dma->audio_channel = audio_channel;
     dma->signed_to_unsigned = false;
@@ -245,6 +306,11 @@ audio_dma_result audio_dma_setup_playback(
 
     dma->signed_to_unsigned = !output_signed && samples_signed;
     dma->unsigned_to_signed = output_signed && !samples_signed;
+    // Samples already in the output format are played straight from their own buffers.
+    dma->zero_copy = output_signed == samples_signed &&
+        dma->sample_spacing == 1 &&
+        dma->sample_resolution == dma->output_resolution &&
+        !swap_channel;
 
     if (output_resolution > 8) {
         dma->output_size = 2;
@@ -307,7 +373,7 @@ audio_dma_result audio_dma_setup_playback(
         channel_config_set_chain_to(&c, dma->channel[1]); // Chain to ourselves so we stop.
         dma_channel_configure(dma->channel[1], &c,
             &dma_hw->ch[dma->channel[0]].al3_read_addr_trig, // write address
-            &dma->buffer[0], // read address
+            &dma->read_addr[0], // read address
             1, // transaction count
             false); // trigger
     } else {
@@ -438,6 +504,10 @@ void audio_dma_deinit(audio_dma_t *dma) {
     dma->buffer_length[1] = 0;
 }
 
+uint32_t audio_dma_get_underruns(audio_dma_t *dma) {
+    return dma->underruns;
+}
+
 bool audio_dma_get_playing(audio_dma_t *dma) {
     if (dma->channel[0] == NUM_DMA_CHANNELS) {
         return false;
@@ -489,9 +559,15 @@ void __not_in_flash_func(isr_dma_0)(void) {
         dma_hw->ints0 = mask;
         if (MP_STATE_PORT(playing_audio)[i] != NULL) {
             audio_dma_t *dma = MP_STATE_PORT(playing_audio)[i];
+            // The other channel is now playing. If it still hasn't been loaded, it
+            // repeats stale data.
+            uint8_t other = dma->channel[0] == i ? dma->channel[1] : dma->channel[0];
+            if (dma->channels_to_load_mask & (1 << other)) {
+                dma->underruns++;
+            }
             // Record all channels whose DMA has completed; they need loading.
             dma->channels_to_load_mask |= mask;
-            background_callback_add(&dma->callback, dma_callback_fun, (void *)dma);
+            background_callback_add_with_priority(&dma->callback, dma_callback_fun, (void *)dma, BACKGROUND_CALLBACK_PRIORITY_REALTIME);
         }
         if (MP_STATE_PORT(background_pio_read)[i] != NULL) {
             rp2pio_statemachine_obj_t *pio = MP_STATE_PORT(background_pio_read)[i];
@@ -501,6 +577,12 @@ void __not_in_flash_func(isr_dma_0)(void) {
             rp2pio_statemachine_obj_t *pio = MP_STATE_PORT(background_pio_write)[i];
             rp2pio_statemachine_dma_complete_write(pio, i);
         }
+        #if CIRCUITPY_ANALOGBUFIO
+        analogbufio_bufferedin_obj_t *adc = MP_STATE_PORT(background_adc_read);
+        if (adc != NULL && adc->dma_chan[0] == i) {
+            analogbufio_bufferedin_dma_complete(adc);
+        }
+        #endif
     }
 }
 
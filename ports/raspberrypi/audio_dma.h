@@ -22,7 +22,9 @@ typedef struct {
     mp_obj_t sample;
     uint8_t *buffer[2]; // Allocated through port_malloc so they are dma-able
     size_t buffer_length[2];
+    uint8_t *read_addr[2]; // What each channel plays: its buffer or the sample's own
     uint32_t channels_to_load_mask;
+    uint32_t underruns; // buffers played before they were reloaded
     uint32_t output_register_address;
     background_callback_t callback;
     uint8_t channel[2];
@@ -39,6 +41,7 @@ typedef struct {
     bool output_signed;
     bool playing_in_progress;
     bool swap_channel;
+    bool zero_copy; // the sample's output needs no conversion
 } audio_dma_t;
 
 void audio_dma_init(audio_dma_t *dma);
@@ -70,6 +73,7 @@ bool audio_dma_get_playing(audio_dma_t *dma);
 void audio_dma_pause(audio_dma_t *dma);
 void audio_dma_resume(audio_dma_t *dma);
 bool audio_dma_get_paused(audio_dma_t *dma);
+uint32_t audio_dma_get_underruns(audio_dma_t *dma);
 
 uint32_t audio_dma_pause_all(void);
 void audio_dma_unpause_mask(uint32_t channel_mask);
@@ -400,6 +400,92 @@ static mp_obj_t rp2pio_statemachine_restart(mp_obj_t self_obj) {
 }
 MP_DEFINE_CONST_FUN_OBJ_1(rp2pio_statemachine_restart_obj, rp2pio_statemachine_restart);
 
+//|     def reconfigure(
+//|         self,
+//|         *,
+//|         program: Optional[ReadableBuffer] = None,
+//|         frequency: Optional[int] = None,
+//|         init: Optional[ReadableBuffer] = None,
+//|         wrap_target: int = 0,
+//|         wrap: int = -1,
+//|     ) -> None:
+//|         """Switches this state machine to another program, clock or wrap range without
+//|         releasing it, which is much faster than deinitializing and constructing a new one.
+//|
+//|         Background reads and writes are stopped, the FIFOs are cleared and the state machine
+//|         restarts at the start of the program after running ``init``. A program that another
+//|         state machine on the same PIO is already running is shared instead of loaded again,
+//|         and the old program's instruction memory is freed once nothing uses it.
+//|
+//|         The pins, shift settings and FIFO joining stay as they were constructed, and the pins
+//|         keep their current state. A new program is not checked against them, so it must use
+//|         the same pins in the same way.
+//|
+//|         :param ReadableBuffer program: the program to run instead, or `None` to keep the current one
+//|         :param int frequency: the new clock frequency, or `None` to keep the current one
+//|         :param ReadableBuffer init: a program to run instead of the original ``init`` now and on later restarts, or `None` to keep it
+//|         :param int wrap_target: The target instruction number of automatic wrap, relative to the start of the program
+//|         :param int wrap: The instruction after which to wrap to the ``wrap_target``. -1 wraps after the last instruction
+//|
+//|         Alternating between two programs that drive the same pin::
+//|
+//|           import array
+//|           import board
+//|           import rp2pio
+//|
+//|           blink = array.array("H", [0xFF01, 0xBF42, 0xFF00, 0xBF42])  # set pins 1 [31]; nop [31]; set pins 0 [31]; nop [31]
+//|           steady = array.array("H", [0xE001])  # set pins 1
+//|           sm = rp2pio.StateMachine(blink, frequency=2000, first_set_pin=board.LED, initial_set_pin_direction=1)
+//|           sm.reconfigure(program=steady)
+//|           sm.reconfigure(program=blink, frequency=4000)"""
+//|         ...
+//|
+static mp_obj_t rp2pio_statemachine_reconfigure(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_program, ARG_frequency, ARG_init, ARG_wrap_target, ARG_wrap };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_program, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_frequency, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_init, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_wrap_target, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+        { MP_QSTR_wrap, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = -1} },
+    };
+    rp2pio_statemachine_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo = { .buf = NULL, .len = 0 };
+    if (args[ARG_program].u_obj != mp_const_none) {
+        mp_get_buffer_raise(args[ARG_program].u_obj, &bufinfo, MP_BUFFER_READ);
+        mp_arg_validate_length_range(bufinfo.len, 2, 64, MP_QSTR_program);
+        if (bufinfo.len % 2 != 0) {
+            mp_raise_ValueError(MP_ERROR_TEXT("Program size invalid"));
+        }
+    }
+
+    mp_buffer_info_t init_bufinfo = { .buf = NULL, .len = 0 };
+    if (args[ARG_init].u_obj != mp_const_none) {
+        mp_get_buffer_raise(args[ARG_init].u_obj, &init_bufinfo, MP_BUFFER_READ);
+        mp_arg_validate_length_range(init_bufinfo.len, 0, 64, MP_QSTR_init);
+        if (init_bufinfo.len % 2 != 0) {
+            mp_raise_ValueError(MP_ERROR_TEXT("Init program size invalid"));
+        }
+    }
+
+    mp_int_t frequency = -1;
+    if (args[ARG_frequency].u_obj != mp_const_none) {
+        frequency = mp_arg_validate_int_min(mp_obj_get_int(args[ARG_frequency].u_obj), 0, MP_QSTR_frequency);
+    }
+
+    common_hal_rp2pio_statemachine_reconfigure(self,
+        bufinfo.buf, bufinfo.len / 2,
+        frequency,
+        init_bufinfo.buf, init_bufinfo.len / 2,
+        args[ARG_wrap_target].u_int, args[ARG_wrap].u_int);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(rp2pio_statemachine_reconfigure_obj, 1, rp2pio_statemachine_reconfigure);
+
 
 //|     def run(self, instructions: ReadableBuffer) -> None:
 //|         """Runs all given instructions. They will likely be interleaved with
@@ -654,6 +740,43 @@ MP_PROPERTY_GETTER(rp2pio_statemachine_pending_obj,
 MP_PROPERTY_GETTER(rp2pio_statemachine_pending_write_obj,
     (mp_obj_t)&rp2pio_statemachine_get_pending_write_obj);
 
+//|     write_position: int
+//|     """The number of elements background writes have sent since `background_write` started
+//|     them. It keeps counting across buffers and around loops.
+//|
+//|     Together with a single ``loop`` buffer this makes a ring buffer that DMA plays without
+//|     Python touching it: element ``write_position % len(loop)`` goes out next. Python fills
+//|     the ring ahead of it, staying less than ``len(loop)`` elements ahead, and DMA never
+//|     stops. If Python falls behind, old data is sent again rather than leaving a gap::
+//|
+//|         ring = array.array("L", [0] * 256)
+//|         sm.background_write(loop=ring)
+//|         produced = 0
+//|         while True:
+//|             while produced - sm.write_position < len(ring):
+//|                 ring[produced % len(ring)] = next_word()
+//|                 produced += 1
+//|     """
+//|
+
+// Positions are polled often, so only allocate once they outgrow a small int.
+static mp_obj_t position_obj(uint64_t position) {
+    if (position <= MP_SMALL_INT_MAX) {
+        return MP_OBJ_NEW_SMALL_INT(position);
+    }
+    return mp_obj_new_int_from_ull(position);
+}
+
+static mp_obj_t rp2pio_statemachine_obj_get_write_position(mp_obj_t self_in) {
+    rp2pio_statemachine_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return position_obj(common_hal_rp2pio_statemachine_get_write_position(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(rp2pio_statemachine_get_write_position_obj, rp2pio_statemachine_obj_get_write_position);
+
+MP_PROPERTY_GETTER(rp2pio_statemachine_write_position_obj,
+    (mp_obj_t)&rp2pio_statemachine_get_write_position_obj);
+
 
 // =================================================================================================================================
 
@@ -775,6 +898,34 @@ MP_DEFINE_CONST_FUN_OBJ_1(rp2pio_statemachine_get_pending_read_obj, rp2pio_state
 MP_PROPERTY_GETTER(rp2pio_statemachine_pending_read_obj,
     (mp_obj_t)&rp2pio_statemachine_get_pending_read_obj);
 
+//|     read_position: int
+//|     """The number of elements background reads have received since `background_read` started
+//|     them. It keeps counting across buffers and around loops.
+//|
+//|     With a single ``loop`` buffer, DMA fills it as a ring buffer forever: everything before
+//|     element ``read_position % len(loop)`` has arrived. Python reads the ring behind it and
+//|     has lost data if it falls ``len(loop)`` elements behind::
+//|
+//|         ring = array.array("L", [0] * 256)
+//|         sm.background_read(loop=ring)
+//|         consumed = 0
+//|         while True:
+//|             while consumed < sm.read_position:
+//|                 handle(ring[consumed % len(ring)])
+//|                 consumed += 1
+//|     """
+//|
+
+static mp_obj_t rp2pio_statemachine_obj_get_read_position(mp_obj_t self_in) {
+    rp2pio_statemachine_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return position_obj(common_hal_rp2pio_statemachine_get_read_position(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(rp2pio_statemachine_get_read_position_obj, rp2pio_statemachine_obj_get_read_position);
+
+MP_PROPERTY_GETTER(rp2pio_statemachine_read_position_obj,
+    (mp_obj_t)&rp2pio_statemachine_get_read_position_obj);
+
 
 // =================================================================================================================================
 
@@ -1124,6 +1275,7 @@ static const mp_rom_map_elem_t rp2pio_statemachine_locals_dict_table[] = {
 
     { MP_ROM_QSTR(MP_QSTR_stop), MP_ROM_PTR(&rp2pio_statemachine_stop_obj) },
     { MP_ROM_QSTR(MP_QSTR_restart), MP_ROM_PTR(&rp2pio_statemachine_restart_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reconfigure), MP_ROM_PTR(&rp2pio_statemachine_reconfigure_obj) },
     { MP_ROM_QSTR(MP_QSTR_run), MP_ROM_PTR(&rp2pio_statemachine_run_obj) },
     { MP_ROM_QSTR(MP_QSTR_clear_rxfifo), MP_ROM_PTR(&rp2pio_statemachine_clear_rxfifo_obj) },
     { MP_ROM_QSTR(MP_QSTR_clear_txstall), MP_ROM_PTR(&rp2pio_statemachine_clear_txstall_obj) },
@@ -1137,11 +1289,13 @@ static const mp_rom_map_elem_t rp2pio_statemachine_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_writing), MP_ROM_PTR(&rp2pio_statemachine_writing_obj) },
     { MP_ROM_QSTR(MP_QSTR_pending), MP_ROM_PTR(&rp2pio_statemachine_pending_write_obj) },
     { MP_ROM_QSTR(MP_QSTR_pending_write), MP_ROM_PTR(&rp2pio_statemachine_pending_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write_position), MP_ROM_PTR(&rp2pio_statemachine_write_position_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_background_read), MP_ROM_PTR(&rp2pio_statemachine_background_read_obj) },
     { MP_ROM_QSTR(MP_QSTR_stop_background_read), MP_ROM_PTR(&rp2pio_statemachine_stop_background_read_obj) },
     { MP_ROM_QSTR(MP_QSTR_reading), MP_ROM_PTR(&rp2pio_statemachine_reading_obj) },
     { MP_ROM_QSTR(MP_QSTR_pending_read), MP_ROM_PTR(&rp2pio_statemachine_pending_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_read_position), MP_ROM_PTR(&rp2pio_statemachine_read_position_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_frequency), MP_ROM_PTR(&rp2pio_statemachine_frequency_obj) },
     { MP_ROM_QSTR(MP_QSTR_rxstall), MP_ROM_PTR(&rp2pio_statemachine_rxstall_obj) },
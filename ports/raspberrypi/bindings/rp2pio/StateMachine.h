@@ -46,6 +46,12 @@ bool common_hal_rp2pio_statemachine_deinited(rp2pio_statemachine_obj_t *self);
 void common_hal_rp2pio_statemachine_never_reset(rp2pio_statemachine_obj_t *self);
 
 void common_hal_rp2pio_statemachine_restart(rp2pio_statemachine_obj_t *self);
+// program and init are NULL to keep the current ones and frequency is negative to keep it.
+void common_hal_rp2pio_statemachine_reconfigure(rp2pio_statemachine_obj_t *self,
+    const uint16_t *program, size_t program_len,
+    int32_t frequency,
+    const uint16_t *init, size_t init_len,
+    int wrap_target, int wrap);
 void common_hal_rp2pio_statemachine_stop(rp2pio_statemachine_obj_t *self);
 void common_hal_rp2pio_statemachine_run(rp2pio_statemachine_obj_t *self, const uint16_t *instructions, size_t len);
 
@@ -67,6 +73,10 @@ mp_int_t common_hal_rp2pio_statemachine_get_pending_read(rp2pio_statemachine_obj
 bool common_hal_rp2pio_statemachine_get_writing(rp2pio_statemachine_obj_t *self);
 bool common_hal_rp2pio_statemachine_get_reading(rp2pio_statemachine_obj_t *self);
 
+// The number of elements background DMA has moved since it started.
+uint64_t common_hal_rp2pio_statemachine_get_write_position(rp2pio_statemachine_obj_t *self);
+uint64_t common_hal_rp2pio_statemachine_get_read_position(rp2pio_statemachine_obj_t *self);
+
 bool common_hal_rp2pio_statemachine_readinto(rp2pio_statemachine_obj_t *self, uint8_t *data, size_t len, uint8_t stride_in_bytes, bool swap);
 bool common_hal_rp2pio_statemachine_write_readinto(rp2pio_statemachine_obj_t *self,
     const uint8_t *data_out, size_t out_len, uint8_t out_stride_in_bytes,
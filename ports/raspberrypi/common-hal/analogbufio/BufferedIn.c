@@ -9,10 +9,13 @@
 #include "common-hal/analogbufio/BufferedIn.h"
 #include "shared-bindings/analogbufio/BufferedIn.h"
 #include "shared-bindings/microcontroller/Pin.h"
+#include "shared-bindings/microcontroller/__init__.h"
 #include "shared/runtime/interrupt_char.h"
+#include "py/mpstate.h"
 #include "py/runtime.h"
 #include "hardware/adc.h"
 #include "hardware/dma.h"
+#include "hardware/irq.h"
 #include "pico/stdlib.h"
 
 #define ADC_CLOCK_INPUT 48000000
@@ -89,16 +92,57 @@ void common_hal_analogbufio_bufferedin_construct(analogbufio_bufferedin_obj_t *s
     channel_config_set_transfer_data_size(&(self->cfg[1]), DMA_SIZE_32);
     // Run as fast as possible
     channel_config_set_dreq(&(self->cfg[1]), 0x3F);
-    // set ring to read one 32-bit value (the starting write address) over and over
-    channel_config_set_ring(&(self->cfg[1]), false, 2); // ring is 1<<2 = 4 bytes
+    // set ring to read the two 32-bit starting write addresses in turn
+    channel_config_set_ring(&(self->cfg[1]), false, 3); // ring is 1<<3 = 8 bytes
     // Chain to adc channel
     channel_config_set_chain_to(&(self->cfg[1]), self->dma_chan[0]);
 
+    self->loop_buffer = NULL;
+    self->halves_filled = 0;
+
     // clear any previous activity
     adc_fifo_drain();
     adc_run(false);
 }
 
+static void stop_loop(analogbufio_bufferedin_obj_t *self) {
+    if (self->loop_buffer == NULL) {
+        return;
+    }
+    adc_run(false);
+
+    common_hal_mcu_disable_interrupts();
+    uint32_t channel_mask = 1u << self->dma_chan[0];
+    dma_hw->inte0 &= ~channel_mask;
+    if (!dma_hw->inte0) {
+        irq_set_mask_enabled(1 << DMA_IRQ_0, false);
+    }
+    MP_STATE_PORT(background_adc_read) = NULL;
+    common_hal_mcu_enable_interrupts();
+
+    // Break the chain first so that channel 1 can't restart channel 0.
+    channel_config_set_chain_to(&(self->cfg[0]), self->dma_chan[0]);
+    channel_config_set_chain_to(&(self->cfg[1]), self->dma_chan[1]);
+    dma_channel_set_config(self->dma_chan[0], &(self->cfg[0]), false);
+    dma_channel_set_config(self->dma_chan[1], &(self->cfg[1]), false);
+    dma_channel_abort(self->dma_chan[0]);
+    dma_channel_abort(self->dma_chan[1]);
+    channel_config_set_chain_to(&(self->cfg[1]), self->dma_chan[0]);
+    dma_hw->ints0 = channel_mask;
+
+    adc_fifo_drain();
+    self->loop_buffer = NULL;
+}
+
+// Called from the DMA interrupt each time channel 0 has filled half of the looping buffer.
+void __not_in_flash_func(analogbufio_bufferedin_dma_complete)(analogbufio_bufferedin_obj_t *self) {
+    self->halves_filled++;
+}
+
+uint32_t common_hal_analogbufio_bufferedin_get_halves_filled(analogbufio_bufferedin_obj_t *self) {
+    return self->halves_filled;
+}
+
 bool common_hal_analogbufio_bufferedin_deinited(analogbufio_bufferedin_obj_t *self) {
     return self->pin == NULL;
 }
@@ -108,6 +152,8 @@ void common_hal_analogbufio_bufferedin_deinit(analogbufio_bufferedin_obj_t *self
         return;
     }
 
+    stop_loop(self);
+
     // stop DMA
     dma_channel_abort(self->dma_chan[0]);
     dma_channel_abort(self->dma_chan[1]);
@@ -121,8 +167,6 @@ void common_hal_analogbufio_bufferedin_deinit(analogbufio_bufferedin_obj_t *self
     dma_channel_unclaim(self->dma_chan[1]);
 }
 
-uint8_t *active_buffer;
-
 uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t *self, uint8_t *buffer, uint32_t len, uint8_t bytes_per_sample, bool loop) {
     // RP2040 Implementation Detail
     // Fills the supplied buffer with ADC values using DMA transfer.
@@ -132,6 +176,8 @@ uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t
     // samples at the first sample with the error bit set.
     // Number of transfers is always the number of samples which is the array
     // byte length divided by the bytes_per_sample.
+    stop_loop(self);
+
     uint dma_size = DMA_SIZE_8;
     bool show_error_bit = false;
     if (bytes_per_sample == 2) {
@@ -196,26 +242,44 @@ uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t
             }
         }
         return captured_count;
-    } else { // Set DMA to repeat transfers indefinitely
+    } else { // Set DMA to repeat transfers indefinitely, half of the buffer at a time
+        if (sample_count < 2 || sample_count % 2 != 0) {
+            mp_raise_ValueError_varg(MP_ERROR_TEXT("%q length must be an even number of samples"), MP_QSTR_buffer);
+        }
+        uint32_t half_count = sample_count / 2;
+
+        // Channel 1 hands channel 0 the start of whichever half comes next. Channel 0 starts on
+        // the first half itself, so the second is first in the ring.
+        self->half_start[0] = buffer + half_count * bytes_per_sample;
+        self->half_start[1] = buffer;
+        self->loop_buffer = buffer;
+        self->halves_filled = 0;
+
         dma_channel_configure(self->dma_chan[1], &(self->cfg[1]),
             &dma_hw->ch[self->dma_chan[0]].al2_write_addr_trig,      // write address
-            &active_buffer,                                          // read address
+            self->half_start,                                        // read address
             1,                                                       // transfer count
             false                                                    // don't start yet
             );
 
-        // put the buffer start address into a global so that it can be read by DMA
-        // and written into channel 0's write address
-        active_buffer = buffer;
-
         channel_config_set_chain_to(&(self->cfg[0]), self->dma_chan[1]);
         dma_channel_configure(self->dma_chan[0], &(self->cfg[0]),
             buffer,                                                  // write address
             &adc_hw->fifo,                                           // read address
-            sample_count,                                            // transfer count
-            true                                                     // start immediately
+            half_count,                                              // transfer count
+            false                                                    // don't start yet
             );
 
+        common_hal_mcu_disable_interrupts();
+        uint32_t channel_mask = 1u << self->dma_chan[0];
+        // Acknowledge any previous pending interrupt
+        dma_hw->ints0 = channel_mask;
+        MP_STATE_PORT(background_adc_read) = self;
+        dma_hw->inte0 |= channel_mask;
+        irq_set_mask_enabled(1 << DMA_IRQ_0, true);
+        dma_channel_start(self->dma_chan[0]);
+        common_hal_mcu_enable_interrupts();
+
         // Start the ADC
         adc_run(true);
 
@@ -223,3 +287,5 @@ uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t
 
     }
 }
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t background_adc_read);
@@ -19,4 +19,12 @@ typedef struct {
     uint8_t chan;
     uint dma_chan[2];
     dma_channel_config cfg[2];
+    // While looping, channel 0 fills one half of the buffer at a time and channel 1 reloads its
+    // write address from here, alternating between the halves. A ring read needs the alignment.
+    uint8_t *half_start[2] __attribute__((aligned(8)));
+    // Also keeps the looping buffer from being collected.
+    uint8_t *loop_buffer;
+    volatile uint32_t halves_filled;
 } analogbufio_bufferedin_obj_t;
+
+void analogbufio_bufferedin_dma_complete(analogbufio_bufferedin_obj_t *self);
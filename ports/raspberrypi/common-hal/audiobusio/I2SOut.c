@@ -296,6 +296,10 @@ bool common_hal_audiobusio_i2sout_get_paused(audiobusio_i2sout_obj_t *self) {
     return audio_dma_get_paused(&self->dma);
 }
 
+uint32_t common_hal_audiobusio_i2sout_get_underruns(audiobusio_i2sout_obj_t *self) {
+    return audio_dma_get_underruns(&self->dma);
+}
+
 void common_hal_audiobusio_i2sout_stop(audiobusio_i2sout_obj_t *self) {
     audio_dma_stop(&self->dma);
 
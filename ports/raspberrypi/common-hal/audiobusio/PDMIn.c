@@ -12,6 +12,7 @@
 #include "py/runtime.h"
 #include "shared-bindings/audiobusio/PDMIn.h"
 #include "shared-bindings/microcontroller/Pin.h"
+#include "shared-module/audiobusio/pdm_filter.h"
 
 #include "audio_dma.h"
 
@@ -57,7 +58,7 @@ void common_hal_audiobusio_pdmin_construct(audiobusio_pdmin_obj_t *self,
         true, // exclusive pin use
         false, 32, false, // out settings
         false, // Wait for txstall
-        false, 32, true, // in settings
+        false, 32, false, // in settings, earliest bit in the MSB
         false, // Not user-interruptible.
         0, -1, // wrap settings
         PIO_ANY_OFFSET,
@@ -91,44 +92,11 @@ uint32_t common_hal_audiobusio_pdmin_get_sample_rate(audiobusio_pdmin_obj_t *sel
     return self->sample_rate;
 }
 
-// a windowed sinc filter for 44 khz, 64 samples
-//
-// This filter is good enough to use for lower sample rates as
-// well. It does not increase the noise enough to be a problem.
-//
-// In the long run we could use a fast filter like this to do the
-// decimation and initial filtering in real time, filtering to a
-// higher sample rate than specified.  Then after the audio is
-// recorded, a more expensive filter non-real-time filter could be
-// used to down-sample and low-pass.
-const uint16_t sinc_filter[OVERSAMPLING] = {
-    0, 2, 9, 21, 39, 63, 94, 132,
-    179, 236, 302, 379, 467, 565, 674, 792,
-    920, 1055, 1196, 1341, 1487, 1633, 1776, 1913,
-    2042, 2159, 2263, 2352, 2422, 2474, 2506, 2516,
-    2506, 2474, 2422, 2352, 2263, 2159, 2042, 1913,
-    1776, 1633, 1487, 1341, 1196, 1055, 920, 792,
-    674, 565, 467, 379, 302, 236, 179, 132,
-    94, 63, 39, 21, 9, 2, 0, 0
-};
-
-#define REPEAT_32_TIMES(X) do { X X X X X X X X X X X X X X X X X X X X X X X X X X X X X X X X } while (0)
-
 static uint16_t filter_sample(uint32_t pdm_samples[2]) {
-    uint16_t running_sum = 0;
-    const uint16_t *filter_ptr = sinc_filter;
-    for (uint8_t i = 0; i < 2; i++) {
-        uint32_t pdm_sample = pdm_samples[i];
-        REPEAT_32_TIMES({
-            if (pdm_sample & 0x1) {
-                running_sum += *filter_ptr;
-            }
-            filter_ptr++;
-            pdm_sample >>= 1;
-        }
-            );
-    }
-    return running_sum;
+    uint32_t first = pdm_samples[0];
+    uint32_t second = pdm_samples[1];
+    return audiobusio_pdm_filter(first >> 24, first >> 16, first >> 8, first,
+        second >> 24, second >> 16, second >> 8, second);
 }
 
 // output_buffer may be a byte buffer or a halfword buffer.
@@ -259,3 +259,7 @@ void common_hal_audiopwmio_pwmaudioout_resume(audiopwmio_pwmaudioout_obj_t *self
 bool common_hal_audiopwmio_pwmaudioout_get_paused(audiopwmio_pwmaudioout_obj_t *self) {
     return audio_dma_get_paused(&self->dma);
 }
+
+uint32_t common_hal_audiopwmio_pwmaudioout_get_underruns(audiopwmio_pwmaudioout_obj_t *self) {
+    return audio_dma_get_underruns(&self->dma);
+}
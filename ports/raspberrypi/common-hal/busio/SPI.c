@@ -77,6 +77,7 @@ void common_hal_busio_spi_construct(busio_spi_obj_t *self,
 
     self->target_frequency = 250000;
     self->real_frequency = spi_init(self->peripheral, self->target_frequency);
+    self->async_pending = false;
 
     gpio_set_function(clock->number, GPIO_FUNC_SPI);
     claim_pin(clock);
@@ -111,6 +112,7 @@ void common_hal_busio_spi_deinit(busio_spi_obj_t *self) {
     if (common_hal_busio_spi_deinited(self)) {
         return;
     }
+    common_hal_busio_spi_wait_for_async(self);
     never_reset_spi[spi_get_index(self->peripheral)] = false;
     spi_deinit(self->peripheral);
 
@@ -129,6 +131,7 @@ bool common_hal_busio_spi_configure(busio_spi_obj_t *self,
         return true;
     }
 
+    common_hal_busio_spi_wait_for_async(self);
     spi_set_format(self->peripheral, bits, polarity, phase, SPI_MSB_FIRST);
 
     // Workaround to start with clock line high if polarity=1. The hw SPI peripheral does not do this
@@ -169,44 +172,52 @@ void common_hal_busio_spi_unlock(busio_spi_obj_t *self) {
     self->has_lock = false;
 }
 
+// Use DMA for large transfers if channels are available
+#define DMA_MIN_SIZE_THRESHOLD (32)
+
+static void _start_dma(busio_spi_obj_t *self, int chan_tx, int chan_rx,
+    const uint8_t *data_out, size_t out_len,
+    uint8_t *data_in, size_t in_len, size_t len) {
+    dma_channel_config c = dma_channel_get_default_config(chan_tx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, spi_get_index(self->peripheral) ? DREQ_SPI1_TX : DREQ_SPI0_TX);
+    channel_config_set_read_increment(&c, out_len == len);
+    channel_config_set_write_increment(&c, false);
+    dma_channel_configure(chan_tx, &c,
+        &spi_get_hw(self->peripheral)->dr,
+        data_out,
+        len,
+        false);
+
+    c = dma_channel_get_default_config(chan_rx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, spi_get_index(self->peripheral) ? DREQ_SPI1_RX : DREQ_SPI0_RX);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, in_len == len);
+    dma_channel_configure(chan_rx, &c,
+        data_in,
+        &spi_get_hw(self->peripheral)->dr,
+        len,
+        false);
+
+    dma_start_channel_mask((1u << chan_rx) | (1u << chan_tx));
+}
+
 static bool _transfer(busio_spi_obj_t *self,
     const uint8_t *data_out, size_t out_len,
     uint8_t *data_in, size_t in_len) {
-    // Use DMA for large transfers if channels are available
-    const size_t dma_min_size_threshold = 32;
+    common_hal_busio_spi_wait_for_async(self);
     int chan_tx = -1;
     int chan_rx = -1;
     size_t len = MAX(out_len, in_len);
-    if (len >= dma_min_size_threshold) {
+    if (len >= DMA_MIN_SIZE_THRESHOLD) {
         // Use two DMA channels to service the two FIFOs
         chan_tx = dma_claim_unused_channel(false);
         chan_rx = dma_claim_unused_channel(false);
     }
     bool use_dma = chan_rx >= 0 && chan_tx >= 0;
     if (use_dma) {
-        dma_channel_config c = dma_channel_get_default_config(chan_tx);
-        channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
-        channel_config_set_dreq(&c, spi_get_index(self->peripheral) ? DREQ_SPI1_TX : DREQ_SPI0_TX);
-        channel_config_set_read_increment(&c, out_len == len);
-        channel_config_set_write_increment(&c, false);
-        dma_channel_configure(chan_tx, &c,
-            &spi_get_hw(self->peripheral)->dr,
-            data_out,
-            len,
-            false);
-
-        c = dma_channel_get_default_config(chan_rx);
-        channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
-        channel_config_set_dreq(&c, spi_get_index(self->peripheral) ? DREQ_SPI1_RX : DREQ_SPI0_RX);
-        channel_config_set_read_increment(&c, false);
-        channel_config_set_write_increment(&c, in_len == len);
-        dma_channel_configure(chan_rx, &c,
-            data_in,
-            &spi_get_hw(self->peripheral)->dr,
-            len,
-            false);
-
-        dma_start_channel_mask((1u << chan_rx) | (1u << chan_tx));
+        _start_dma(self, chan_tx, chan_rx, data_out, out_len, data_in, in_len, len);
         while (dma_channel_is_busy(chan_rx) || dma_channel_is_busy(chan_tx)) {
             // TODO: We should idle here until we get a DMA interrupt or something else.
             RUN_BACKGROUND_TASKS;
@@ -259,6 +270,76 @@ bool common_hal_busio_spi_write(busio_spi_obj_t *self,
     return _transfer(self, data, len, (uint8_t *)&data_in, MIN(len, 4));
 }
 
+// Starts DMA for an asynchronous transfer, or returns false when the channels aren't free.
+static bool _start_async(busio_spi_obj_t *self,
+    const uint8_t *data_out, size_t out_len,
+    uint8_t *data_in, size_t in_len) {
+    common_hal_busio_spi_wait_for_async(self);
+    size_t len = MAX(out_len, in_len);
+    if (len < DMA_MIN_SIZE_THRESHOLD) {
+        return false;
+    }
+    int chan_tx = dma_claim_unused_channel(false);
+    int chan_rx = dma_claim_unused_channel(false);
+    if (chan_rx < 0 || chan_tx < 0) {
+        if (chan_rx >= 0) {
+            dma_channel_unclaim(chan_rx);
+        }
+        if (chan_tx >= 0) {
+            dma_channel_unclaim(chan_tx);
+        }
+        return false;
+    }
+    _start_dma(self, chan_tx, chan_rx, data_out, out_len, data_in, in_len, len);
+    self->async_chan_tx = chan_tx;
+    self->async_chan_rx = chan_rx;
+    self->async_pending = true;
+    return true;
+}
+
+bool common_hal_busio_spi_write_async(busio_spi_obj_t *self,
+    const uint8_t *data, size_t len) {
+    // The received bytes are thrown away into a word that outlives this call.
+    if (!_start_async(self, data, len, (uint8_t *)&self->async_data_in, MIN(len, 4))) {
+        return common_hal_busio_spi_write(self, data, len);
+    }
+    return true;
+}
+
+bool common_hal_busio_spi_read_async(busio_spi_obj_t *self,
+    uint8_t *data, size_t len, uint8_t write_value) {
+    // The previous transfer may still be writing out the old value.
+    common_hal_busio_spi_wait_for_async(self);
+    self->async_data_out = write_value << 24 | write_value << 16 | write_value << 8 | write_value;
+    if (!_start_async(self, (const uint8_t *)&self->async_data_out, MIN(4, len), data, len)) {
+        return common_hal_busio_spi_read(self, data, len, write_value);
+    }
+    return true;
+}
+
+bool common_hal_busio_spi_async_busy(busio_spi_obj_t *self) {
+    if (!self->async_pending) {
+        return false;
+    }
+    if (dma_channel_is_busy(self->async_chan_rx) || dma_channel_is_busy(self->async_chan_tx)) {
+        return true;
+    }
+    common_hal_busio_spi_wait_for_async(self);
+    return false;
+}
+
+void common_hal_busio_spi_wait_for_async(busio_spi_obj_t *self) {
+    if (!self->async_pending) {
+        return;
+    }
+    while (dma_channel_is_busy(self->async_chan_rx) || dma_channel_is_busy(self->async_chan_tx)) {
+        RUN_BACKGROUND_TASKS;
+    }
+    dma_channel_unclaim(self->async_chan_rx);
+    dma_channel_unclaim(self->async_chan_tx);
+    self->async_pending = false;
+}
+
 bool common_hal_busio_spi_read(busio_spi_obj_t *self,
     uint8_t *data, size_t len, uint8_t write_value) {
     uint32_t data_out = write_value << 24 | write_value << 16 | write_value << 8 | write_value;
@@ -24,6 +24,13 @@ typedef struct {
     uint8_t polarity;
     uint8_t phase;
     uint8_t bits;
+    // DMA channels of the transfer started by common_hal_busio_spi_write_async or
+    // common_hal_busio_spi_read_async, and the words the unused direction reads or writes.
+    bool async_pending;
+    uint8_t async_chan_tx;
+    uint8_t async_chan_rx;
+    uint32_t async_data_in;
+    uint32_t async_data_out;
 } busio_spi_obj_t;
 
 void reset_spi(void);
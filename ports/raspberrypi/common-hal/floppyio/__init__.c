@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "bindings/rp2pio/StateMachine.h"
+#include "hardware/dma.h"
 #include "py/runtime.h"
 #include "shared-bindings/digitalio/DigitalInOut.h"
 #include "shared-bindings/floppyio/__init__.h"
@@ -47,28 +48,65 @@ static const uint16_t fluxread_program[] = {
     0x0040, //     jmp x--, wait_one
 };
 
+// The state machine's RX FIFO is drained by DMA into a small ring buffer so
+// that interrupts can stay enabled during capture; the CPU loop below only
+// has to keep up on average, not within the FIFO's 8 word depth.
+#define FLOPPYIO_DMA_RING_BITS (11)
+#define FLOPPYIO_DMA_RING_WORDS ((1 << FLOPPYIO_DMA_RING_BITS) / sizeof(uint32_t))
+// Large enough to never run out during one revolution; the top bits of the
+// count register select the transfer mode on RP2350 so they are left clear.
+#define FLOPPYIO_DMA_TRANSFER_COUNT (0x0fffffff)
+
 typedef struct {
     PIO pio;
     uint8_t sm;
+    int dma_channel;
+    volatile uint32_t *ring;
+    uint32_t words_read;
     bool word_available;
     uint16_t half;
 } floppy_reader;
 
+static uint32_t words_written(floppy_reader *reader) {
+    return FLOPPYIO_DMA_TRANSFER_COUNT - dma_channel_hw_addr(reader->dma_channel)->transfer_count;
+}
+
 static bool data_available(floppy_reader *reader) {
-    return reader->word_available || !pio_sm_is_rx_fifo_empty(reader->pio, reader->sm);
+    return reader->word_available || words_written(reader) != reader->words_read;
 }
 
+// Only call when data_available() is true.
 static uint16_t read_fifo(floppy_reader *reader) {
     if (reader->word_available) {
         reader->word_available = false;
         return reader->half;
     }
-    uint32_t value = pio_sm_get_blocking(reader->pio, reader->sm);
+    uint32_t value = reader->ring[reader->words_read++ % FLOPPYIO_DMA_RING_WORDS];
     reader->half = value >> 16;
     reader->word_available = true;
     return value & 0xffff;
 }
 
+static void floppy_reader_start(floppy_reader *reader) {
+    reader->words_read = 0;
+    reader->word_available = false;
+    dma_channel_config c = dma_channel_get_default_config(reader->dma_channel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, FLOPPYIO_DMA_RING_BITS);
+    channel_config_set_dreq(&c, pio_get_dreq(reader->pio, reader->sm, false));
+    dma_channel_configure(reader->dma_channel, &c,
+        reader->ring, &reader->pio->rxf[reader->sm],
+        FLOPPYIO_DMA_TRANSFER_COUNT, true);
+}
+
+static void floppy_reader_deinit(floppy_reader *reader, rp2pio_statemachine_obj_t *state_machine, void *ring_alloc) {
+    dma_channel_abort(reader->dma_channel);
+    dma_channel_unclaim(reader->dma_channel);
+    m_free(ring_alloc);
+    common_hal_rp2pio_statemachine_deinit(state_machine);
+}
 
 int common_hal_floppyio_flux_readinto(void *buf, size_t len, digitalio_digitalinout_obj_t *data, digitalio_digitalinout_obj_t *index, mp_int_t index_wait_ms) {
 #define READ_INDEX() (!!(*index_port & index_mask))
@@ -77,6 +115,16 @@ int common_hal_floppyio_flux_readinto(void *buf, size_t len, digitalio_digitalin
 
     memset(buf, 0, len);
 
+    // The DMA ring wrap requires the buffer to be aligned to its own size.
+    const size_t ring_bytes = FLOPPYIO_DMA_RING_WORDS * sizeof(uint32_t);
+    void *ring_alloc = m_malloc(2 * ring_bytes);
+    volatile uint32_t *ring = (void *)(((uintptr_t)ring_alloc + ring_bytes - 1) & ~(uintptr_t)(ring_bytes - 1));
+
+    int dma_channel = dma_claim_unused_channel(false);
+    if (dma_channel < 0) {
+        m_free(ring_alloc);
+        mp_raise_RuntimeError(MP_ERROR_TEXT("All dma channels in use"));
+    }
 
     pio_pinmask_t pins_we_use = PIO_PINMASK_FROM_PIN(data->pin->number);
 
@@ -105,23 +153,27 @@ int common_hal_floppyio_flux_readinto(void *buf, size_t len, digitalio_digitalin
         PIO_MOV_STATUS_DEFAULT, PIO_MOV_N_DEFAULT
         );
     if (!ok) {
+        dma_channel_unclaim(dma_channel);
+        m_free(ring_alloc);
         mp_raise_RuntimeError(MP_ERROR_TEXT("All state machines in use"));
     }
 
-    floppy_reader reader = { .pio = state_machine.pio, .sm = state_machine.state_machine, };
+    floppy_reader reader = {
+        .pio = state_machine.pio,
+        .sm = state_machine.state_machine,
+        .dma_channel = dma_channel,
+        .ring = ring,
+    };
 
     uint8_t *ptr = buf, *end = ptr + len;
 
     uint64_t index_deadline_us = time_us_64() + index_wait_ms * 1000;
 
-    common_hal_mcu_disable_interrupts();
-
     // check if flux is arriving
     uint64_t flux_deadline_us = time_us_64() + 20;
     while (pio_sm_is_rx_fifo_empty(reader.pio, reader.sm)) {
         if (time_us_64() > flux_deadline_us) {
-            common_hal_mcu_enable_interrupts();
-            common_hal_rp2pio_statemachine_deinit(&state_machine);
+            floppy_reader_deinit(&reader, &state_machine, ring_alloc);
             mp_raise_RuntimeError(MP_ERROR_TEXT("timeout waiting for flux"));
         }
     }
@@ -129,17 +181,25 @@ int common_hal_floppyio_flux_readinto(void *buf, size_t len, digitalio_digitalin
     // wait for index pulse low
     while (READ_INDEX()) {
         if (time_us_64() > index_deadline_us) {
-            common_hal_mcu_enable_interrupts();
-            common_hal_rp2pio_statemachine_deinit(&state_machine);
+            floppy_reader_deinit(&reader, &state_machine, ring_alloc);
             mp_raise_RuntimeError(MP_ERROR_TEXT("timeout waiting for index pulse"));
         }
     }
 
     pio_sm_clear_fifos(reader.pio, reader.sm);
+    floppy_reader_start(&reader);
 
     // if another index doesn't show up ...
     index_deadline_us = time_us_64() + index_wait_ms * 1000;
 
+    while (!data_available(&reader)) {
+        if (time_us_64() > index_deadline_us) {
+            floppy_reader_deinit(&reader, &state_machine, ring_alloc);
+            mp_raise_RuntimeError(MP_ERROR_TEXT("timeout waiting for flux"));
+        }
+    }
+
+    bool overrun = false;
     int last = read_fifo(&reader);
     bool last_index = READ_INDEX();
     while (ptr != end) {
@@ -160,6 +220,12 @@ int common_hal_floppyio_flux_readinto(void *buf, size_t len, digitalio_digitalin
             continue;
         }
 
+        if (words_written(&reader) - reader.words_read > FLOPPYIO_DMA_RING_WORDS) {
+            // DMA lapped the reader, so the ring no longer holds contiguous data
+            overrun = true;
+            break;
+        }
+
         int timestamp = read_fifo(&reader);
         int delta = last - timestamp;
         if (delta < 0) {
@@ -171,8 +237,11 @@ int common_hal_floppyio_flux_readinto(void *buf, size_t len, digitalio_digitalin
         *ptr++ = delta > 255 ? 255 : delta;
     }
 
-    common_hal_mcu_enable_interrupts();
-    common_hal_rp2pio_statemachine_deinit(&state_machine);
+    floppy_reader_deinit(&reader, &state_machine, ring_alloc);
+
+    if (overrun) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("flux capture overrun"));
+    }
 
     return ptr - (uint8_t *)buf;
 }
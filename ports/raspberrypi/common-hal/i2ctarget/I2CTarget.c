@@ -15,8 +15,10 @@
 #include "py/runtime.h"
 
 #include "hardware/gpio.h"
+#include "hardware/irq.h"
 
 static i2c_inst_t *i2c[2] = {i2c0, i2c1};
+static i2ctarget_i2c_target_obj_t *register_targets[2];
 
 #define NO_PIN 0xff
 
@@ -46,6 +48,7 @@ void common_hal_i2ctarget_i2c_target_construct(i2ctarget_i2c_target_obj_t *self,
 
     self->addresses = addresses;
     self->num_addresses = num_addresses;
+    self->registers = NULL;
     self->scl_pin = scl->number;
     self->sda_pin = sda->number;
 
@@ -74,6 +77,7 @@ void common_hal_i2ctarget_i2c_target_deinit(i2ctarget_i2c_target_obj_t *self) {
         return;
     }
 
+    common_hal_i2ctarget_i2c_target_serve_registers(self, NULL, 0);
     i2c_deinit(self->peripheral);
 
     reset_pin_number(self->sda_pin);
@@ -130,3 +134,85 @@ void common_hal_i2ctarget_i2c_target_ack(i2ctarget_i2c_target_obj_t *self, bool
 void common_hal_i2ctarget_i2c_target_close(i2ctarget_i2c_target_obj_t *self) {
     return;
 }
+
+static void serve_registers(i2ctarget_i2c_target_obj_t *self) {
+    i2c_hw_t *hw = self->peripheral->hw;
+    uint32_t status = hw->intr_stat;
+    if (status & I2C_IC_INTR_STAT_R_TX_ABRT_BITS) {
+        hw->clr_tx_abrt;
+    }
+    if (status & I2C_IC_INTR_STAT_R_RX_FULL_BITS) {
+        while (hw->rxflr > 0) {
+            uint32_t data_cmd = hw->data_cmd;
+            uint8_t data = data_cmd & I2C_IC_DATA_CMD_DAT_BITS;
+            // The first byte of a write selects the register.
+            if (data_cmd & I2C_IC_DATA_CMD_FIRST_DATA_BYTE_BITS) {
+                self->register_index = data % self->registers_len;
+                continue;
+            }
+            size_t index = self->register_index;
+            self->registers[index] = data;
+            if (!self->registers_changed) {
+                self->changed_start = index;
+                self->changed_end = index + 1;
+                self->registers_changed = true;
+            } else if (index < self->changed_start) {
+                self->changed_start = index;
+            } else if (index >= self->changed_end) {
+                self->changed_end = index + 1;
+            }
+            self->register_index = (index + 1) % self->registers_len;
+        }
+    }
+    if (status & I2C_IC_INTR_STAT_R_RD_REQ_BITS) {
+        size_t index = self->register_index;
+        hw->data_cmd = self->registers[index];
+        self->register_index = (index + 1) % self->registers_len;
+        hw->clr_rd_req;
+    }
+}
+
+static void i2c0_register_handler(void) {
+    serve_registers(register_targets[0]);
+}
+
+static void i2c1_register_handler(void) {
+    serve_registers(register_targets[1]);
+}
+
+void common_hal_i2ctarget_i2c_target_serve_registers(i2ctarget_i2c_target_obj_t *self, uint8_t *registers, size_t len) {
+    size_t index = i2c_hw_index(self->peripheral);
+    uint irq = I2C0_IRQ + index;
+    if (self->registers != NULL) {
+        irq_set_enabled(irq, false);
+        irq_remove_handler(irq, index == 0 ? i2c0_register_handler : i2c1_register_handler);
+        self->peripheral->hw->intr_mask = I2C_IC_INTR_MASK_M_RESTART_DET_BITS;
+        register_targets[index] = NULL;
+    }
+    self->registers = registers;
+    if (registers == NULL) {
+        return;
+    }
+    self->registers_len = len;
+    self->register_index = 0;
+    self->registers_changed = false;
+    register_targets[index] = self;
+    irq_set_exclusive_handler(irq, index == 0 ? i2c0_register_handler : i2c1_register_handler);
+    self->peripheral->hw->intr_mask = I2C_IC_INTR_MASK_M_RX_FULL_BITS |
+        I2C_IC_INTR_MASK_M_RD_REQ_BITS | I2C_IC_INTR_MASK_M_TX_ABRT_BITS;
+    irq_set_enabled(irq, true);
+}
+
+bool common_hal_i2ctarget_i2c_target_registers_changed(i2ctarget_i2c_target_obj_t *self, size_t *start, size_t *end) {
+    if (self->registers == NULL) {
+        return false;
+    }
+    uint irq = I2C0_IRQ + i2c_hw_index(self->peripheral);
+    irq_set_enabled(irq, false);
+    bool changed = self->registers_changed;
+    *start = self->changed_start;
+    *end = self->changed_end;
+    self->registers_changed = false;
+    irq_set_enabled(irq, true);
+    return changed;
+}
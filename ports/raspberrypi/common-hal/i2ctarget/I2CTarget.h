@@ -20,4 +20,12 @@ typedef struct {
 
     uint8_t scl_pin;
     uint8_t sda_pin;
+
+    // Register file served from the interrupt handler, or NULL when using request().
+    uint8_t *registers;
+    size_t registers_len;
+    volatile size_t register_index;
+    volatile bool registers_changed;
+    volatile size_t changed_start;
+    volatile size_t changed_end;
 } i2ctarget_i2c_target_obj_t;
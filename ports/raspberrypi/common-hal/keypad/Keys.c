@@ -0,0 +1,74 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/keypad/Keys.h"
+#include "shared-bindings/digitalio/DigitalInOut.h"
+
+#include "hardware/gpio.h"
+#include "hardware/irq.h"
+
+#if CIRCUITPY_CYW43
+#include "bindings/cyw43/__init__.h"
+#endif
+
+// The Keys waiting for a press on each pin.
+static keypad_keys_obj_t *wakeup_keys[NUM_BANK0_GPIOS];
+static bool handler_added = false;
+
+static uint32_t pressed_event(keypad_keys_obj_t *self) {
+    return self->value_when_pressed ? GPIO_IRQ_LEVEL_HIGH : GPIO_IRQ_LEVEL_LOW;
+}
+
+static void keys_interrupt_handler(void) {
+    for (size_t pin_number = 0; pin_number < NUM_BANK0_GPIOS; pin_number++) {
+        keypad_keys_obj_t *keys = wakeup_keys[pin_number];
+        if (keys == NULL || (gpio_get_irq_event_mask(pin_number) & pressed_event(keys)) == 0) {
+            continue;
+        }
+        // Level interrupts keep firing while the key is held, so turn them all off.
+        common_hal_keypad_keys_disable_wakeup(keys);
+        keypad_wake((keypad_scanner_obj_t *)keys);
+    }
+}
+
+bool common_hal_keypad_keys_enable_wakeup(keypad_keys_obj_t *self) {
+    size_t key_count = self->digitalinouts->len;
+    for (size_t i = 0; i < key_count; i++) {
+        digitalio_digitalinout_obj_t *dio = self->digitalinouts->items[i];
+        #if CIRCUITPY_CYW43
+        if (dio->pin->base.type == &cyw43_pin_type) {
+            return false;
+        }
+        #endif
+        if (wakeup_keys[dio->pin->number] != NULL && wakeup_keys[dio->pin->number] != self) {
+            return false;
+        }
+    }
+
+    if (!handler_added) {
+        irq_add_shared_handler(IO_IRQ_BANK0, keys_interrupt_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+        handler_added = true;
+    }
+    irq_set_enabled(IO_IRQ_BANK0, true);
+
+    uint32_t event = pressed_event(self);
+    for (size_t i = 0; i < key_count; i++) {
+        digitalio_digitalinout_obj_t *dio = self->digitalinouts->items[i];
+        wakeup_keys[dio->pin->number] = self;
+        gpio_set_irq_enabled(dio->pin->number, event, true);
+    }
+    return true;
+}
+
+void common_hal_keypad_keys_disable_wakeup(keypad_keys_obj_t *self) {
+    uint32_t event = pressed_event(self);
+    for (size_t pin_number = 0; pin_number < NUM_BANK0_GPIOS; pin_number++) {
+        if (wakeup_keys[pin_number] == self) {
+            gpio_set_irq_enabled(pin_number, event, false);
+            wakeup_keys[pin_number] = NULL;
+        }
+    }
+}
@@ -11,6 +11,8 @@
 typedef struct {
     mp_obj_base_t base;
     uint32_t ipv4_address;
+    // Shortest time-to-live of the records that described this service, in seconds.
+    uint32_t ttl;
     uint16_t port;
     char protocol[5]; // RFC 6763 Section 7.2 - 4 bytes + 1 for NUL
     char service_name[17]; // RFC 6763 Section 7.2 - 16 bytes + 1 for NUL
@@ -7,6 +7,7 @@
 #include "shared-bindings/mdns/Server.h"
 
 #include "py/gc.h"
+#include "py/objlist.h"
 #include "py/runtime.h"
 #include "shared/runtime/interrupt_char.h"
 #include "shared-bindings/mdns/RemoteService.h"
@@ -24,6 +25,8 @@ static bool inited = false;
 // object at a time. (But ignores MDNS objects that are deinited.)
 static bool object_inited = false;
 
+static void browse_stop(void);
+
 #define NETIF_STA (&cyw43_state.netif[CYW43_ITF_STA])
 #define NETIF_AP (&cyw43_state.netif[CYW43_ITF_AP])
 
@@ -73,6 +76,7 @@ void common_hal_mdns_server_deinit(mdns_server_obj_t *self) {
     }
     self->inited = false;
     object_inited = false;
+    browse_stop();
     mdns_resp_remove_netif(NETIF_STA);
 }
 
@@ -109,7 +113,11 @@ typedef struct {
     size_t out_len;
 } nonalloc_search_state_t;
 
-static void copy_data_into_remote_service(struct mdns_answer *answer, const char *varpart, int varlen, mdns_remoteservice_obj_t *out) {
+static void copy_data_into_remote_service(struct mdns_answer *answer, const char *varpart, int varlen, int flags, mdns_remoteservice_obj_t *out) {
+    if ((flags & MDNS_SEARCH_RESULT_FIRST) != 0) {
+        out->ttl = UINT32_MAX;
+    }
+    out->ttl = MIN(out->ttl, answer->ttl);
     if (varlen > 0) {
         if (answer->info.type == DNS_RRTYPE_A) {
             char *hostname = out->hostname;
@@ -152,7 +160,7 @@ static void search_result_cb(struct mdns_answer *answer, const char *varpart, in
     nonalloc_search_state_t *state = arg;
     state->out[state->i].base.type = &mdns_remoteservice_type;
 
-    copy_data_into_remote_service(answer, varpart, varlen, &state->out[state->i]);
+    copy_data_into_remote_service(answer, varpart, varlen, flags, &state->out[state->i]);
 
     if ((flags & MDNS_SEARCH_RESULT_LAST) != 0) {
         state->i += 1;
@@ -227,10 +235,72 @@ static void alloc_search_result_cb(struct mdns_answer *answer, const char *varpa
         state->head = service;
     }
 
-    copy_data_into_remote_service(answer, varpart, varlen, state->head);
+    copy_data_into_remote_service(answer, varpart, varlen, flags, state->head);
+}
+
+// Results of the most recent search, reused until the shortest TTL among them
+// runs out. This is kept outside of the server object because the web
+// workflow's server is statically allocated and isn't scanned by the GC.
+static struct {
+    qstr service_type;
+    qstr protocol;
+    mp_obj_t results;
+    uint64_t expires_ms;
+} find_cache;
+
+// A search started by browse() that runs in the background.
+static struct {
+    qstr service_type;
+    qstr protocol;
+    uint64_t deadline_ms;
+    // Service currently being filled in by the answers to one response.
+    mdns_remoteservice_obj_t *partial;
+    // Completed services not yet returned by browse_results(), newest first.
+    mdns_remoteservice_obj_t *ready;
+    // List of everything returned so far, used to skip duplicates and to
+    // refresh the cache when the browse finishes.
+    mp_obj_t found;
+    // Remembered results still to be returned by browse_results().
+    mp_obj_t cached;
+    uint8_t request_id;
+    bool active;
+} browse_state;
+
+static mp_obj_t cache_lookup(qstr service_type, qstr protocol) {
+    if (find_cache.results == MP_OBJ_NULL ||
+        find_cache.service_type != service_type ||
+        find_cache.protocol != protocol ||
+        supervisor_ticks_ms64() >= find_cache.expires_ms) {
+        return MP_OBJ_NULL;
+    }
+    return find_cache.results;
+}
+
+static void cache_store(qstr service_type, qstr protocol, size_t len, mp_obj_t *items) {
+    if (len == 0) {
+        return;
+    }
+    uint32_t ttl = UINT32_MAX;
+    for (size_t i = 0; i < len; i++) {
+        mdns_remoteservice_obj_t *service = MP_OBJ_TO_PTR(items[i]);
+        ttl = MIN(ttl, service->ttl);
+    }
+    find_cache.results = mp_obj_new_tuple(len, items);
+    find_cache.service_type = service_type;
+    find_cache.protocol = protocol;
+    find_cache.expires_ms = supervisor_ticks_ms64() + (uint64_t)ttl * 1000;
 }
 
-mp_obj_t common_hal_mdns_server_find(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_float_t timeout) {
+mp_obj_t common_hal_mdns_server_find(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_float_t timeout, bool cached) {
+    qstr service_type_qstr = qstr_from_str(service_type);
+    qstr protocol_qstr = qstr_from_str(protocol);
+    if (cached) {
+        mp_obj_t results = cache_lookup(service_type_qstr, protocol_qstr);
+        if (results != MP_OBJ_NULL) {
+            return results;
+        }
+    }
+
     enum mdns_sd_proto proto = DNSSD_PROTO_UDP;
     if (strcmp(protocol, "_tcp") == 0) {
         proto = DNSSD_PROTO_TCP;
@@ -272,10 +342,160 @@ mp_obj_t common_hal_mdns_server_find(mdns_server_obj_t *self, const char *servic
         cur->next = NULL;
         added++;
     }
+    cache_store(service_type_qstr, protocol_qstr, tuple->len, tuple->items);
+
+    return MP_OBJ_FROM_PTR(tuple);
+}
+
+static void browse_result_cb(struct mdns_answer *answer, const char *varpart, int varlen, int flags, void *arg) {
+    if ((flags & MDNS_SEARCH_RESULT_FIRST) != 0) {
+        // This runs from a background task so it must not raise. Drop the
+        // service if there isn't room for it.
+        browse_state.partial = m_malloc_maybe(sizeof(mdns_remoteservice_obj_t));
+        if (browse_state.partial == NULL) {
+            return;
+        }
+        memset(browse_state.partial, 0, sizeof(mdns_remoteservice_obj_t));
+        browse_state.partial->base.type = &mdns_remoteservice_type;
+    }
+    if (browse_state.partial == NULL) {
+        return;
+    }
+
+    copy_data_into_remote_service(answer, varpart, varlen, flags, browse_state.partial);
+
+    if ((flags & MDNS_SEARCH_RESULT_LAST) != 0) {
+        browse_state.partial->next = browse_state.ready;
+        browse_state.ready = browse_state.partial;
+        browse_state.partial = NULL;
+    }
+}
+
+static void browse_stop(void) {
+    if (browse_state.active && browse_state.request_id < MDNS_MAX_REQUESTS) {
+        mdns_search_stop(browse_state.request_id);
+    }
+    browse_state.request_id = MDNS_MAX_REQUESTS;
+    browse_state.active = false;
+    browse_state.partial = NULL;
+    browse_state.ready = NULL;
+    browse_state.found = MP_OBJ_NULL;
+    browse_state.cached = MP_OBJ_NULL;
+}
+
+static bool browse_already_found(mdns_remoteservice_obj_t *service) {
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_list_get(browse_state.found, &len, &items);
+    for (size_t i = 0; i < len; i++) {
+        mdns_remoteservice_obj_t *other = MP_OBJ_TO_PTR(items[i]);
+        if (strcmp(other->instance_name, service->instance_name) == 0 &&
+            strcmp(other->hostname, service->hostname) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void common_hal_mdns_server_browse(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_float_t timeout) {
+    browse_stop();
+
+    // lwIP keeps pointers to the names for as long as the search runs, so
+    // use interned copies.
+    browse_state.service_type = qstr_from_str(service_type);
+    browse_state.protocol = qstr_from_str(protocol);
+    browse_state.found = mp_obj_new_list(0, NULL);
+    browse_state.cached = cache_lookup(browse_state.service_type, browse_state.protocol);
+
+    enum mdns_sd_proto proto = DNSSD_PROTO_UDP;
+    if (strcmp(protocol, "_tcp") == 0) {
+        proto = DNSSD_PROTO_TCP;
+    }
+
+    err_t err = mdns_search_service(NULL, qstr_str(browse_state.service_type), proto,
+        NETIF_STA, &browse_result_cb, NULL,
+        &browse_state.request_id);
+    if (err != ERR_OK) {
+        browse_stop();
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Unable to start mDNS query"));
+    }
+    browse_state.active = true;
+    browse_state.deadline_ms = supervisor_ticks_ms64() + (uint64_t)(timeout * 1000);
+}
+
+mp_obj_t common_hal_mdns_server_browse_results(mdns_server_obj_t *self) {
+    if (!browse_state.active) {
+        return mp_const_none;
+    }
+    if (browse_state.cached != MP_OBJ_NULL) {
+        mp_obj_t cached = browse_state.cached;
+        browse_state.cached = MP_OBJ_NULL;
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_tuple_get(cached, &len, &items);
+        for (size_t i = 0; i < len; i++) {
+            mp_obj_list_append(browse_state.found, items[i]);
+        }
+        return cached;
+    }
 
+    bool finished = supervisor_ticks_ms64() >= browse_state.deadline_ms;
+    if (finished && browse_state.request_id < MDNS_MAX_REQUESTS) {
+        mdns_search_stop(browse_state.request_id);
+        browse_state.request_id = MDNS_MAX_REQUESTS;
+        // Hand out whatever was learned about a service that didn't finish.
+        if (browse_state.partial != NULL) {
+            browse_state.partial->next = browse_state.ready;
+            browse_state.ready = browse_state.partial;
+            browse_state.partial = NULL;
+        }
+    }
+
+    mdns_remoteservice_obj_t *ready = browse_state.ready;
+    browse_state.ready = NULL;
+    size_t count = 0;
+    for (mdns_remoteservice_obj_t *next = ready; next != NULL; next = next->next) {
+        count++;
+    }
+    if (count == 0 && finished) {
+        mp_obj_list_t *found = MP_OBJ_TO_PTR(browse_state.found);
+        cache_store(browse_state.service_type, browse_state.protocol, found->len, found->items);
+        browse_stop();
+        return mp_const_none;
+    }
+
+    mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(mp_obj_new_tuple(count, NULL));
+    size_t added = 0;
+    mdns_remoteservice_obj_t *next = ready;
+    while (next != NULL) {
+        mdns_remoteservice_obj_t *cur = next;
+        next = cur->next;
+        cur->next = NULL;
+        if (!browse_already_found(cur)) {
+            mp_obj_list_append(browse_state.found, MP_OBJ_FROM_PTR(cur));
+            tuple->items[added++] = MP_OBJ_FROM_PTR(cur);
+        }
+    }
+    if (added == 0) {
+        return mp_const_empty_tuple;
+    }
+    tuple->len = added;
     return MP_OBJ_FROM_PTR(tuple);
 }
 
+void mdns_user_reset(void) {
+    browse_stop();
+    find_cache.results = MP_OBJ_NULL;
+}
+
+void mdns_gc_collect(void) {
+    gc_collect_ptr(MP_OBJ_TO_PTR(find_cache.results));
+    gc_collect_ptr(browse_state.partial);
+    gc_collect_ptr(browse_state.ready);
+    gc_collect_ptr(MP_OBJ_TO_PTR(browse_state.found));
+    gc_collect_ptr(MP_OBJ_TO_PTR(browse_state.cached));
+}
+
 static void srv_txt_cb(struct mdns_service *service, void *ptr) {
     mdns_server_obj_t *self = ptr;
     err_t res;
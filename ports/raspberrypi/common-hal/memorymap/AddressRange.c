@@ -137,3 +137,80 @@ void common_hal_memorymap_addressrange_get_bytes(const memorymap_addressrange_ob
             break;
     }
 }
+
+void common_hal_memorymap_addressrange_write(const memorymap_addressrange_obj_t *self,
+    size_t start_index, size_t width, const uint8_t *values, size_t len) {
+    uint8_t *dest_addr = self->start_address + start_index;
+    switch (self->type) {
+        case SRAM:
+            if ((size_t)dest_addr % width) {
+                mp_raise_RuntimeError(MP_ERROR_TEXT("Unable to access unaligned IO register"));
+            }
+            if (width == 4) {
+                volatile uint32_t *dest_addr32 = (volatile uint32_t *)dest_addr;
+                for (size_t i = 0; i < len; i += 4) {
+                    uint32_t value;
+                    memcpy(&value, values + i, sizeof(value));
+                    *dest_addr32++ = value;
+                }
+            } else if (width == 2) {
+                volatile uint16_t *dest_addr16 = (volatile uint16_t *)dest_addr;
+                for (size_t i = 0; i < len; i += 2) {
+                    uint16_t value;
+                    memcpy(&value, values + i, sizeof(value));
+                    *dest_addr16++ = value;
+                }
+            } else {
+                volatile uint8_t *dest_addr8 = dest_addr;
+                for (size_t i = 0; i < len; i++) {
+                    *dest_addr8++ = values[i];
+                }
+            }
+            break;
+        case IO:
+            if ((size_t)dest_addr & 0x03 || width != 4) {
+                // Only aligned 32-bit accesses are supported by RP2 for IO registers
+                mp_raise_RuntimeError(MP_ERROR_TEXT("Unable to access unaligned IO register"));
+            } else {
+                volatile uint32_t *dest_addr32 = (volatile uint32_t *)dest_addr;
+                for (size_t i = 0; i < len; i += 4) {
+                    uint32_t value;
+                    memcpy(&value, values + i, sizeof(value));
+                    *dest_addr32++ = value;
+                }
+            }
+            break;
+        case XIP:
+        case ROM:
+            // XIP and ROM are read-only
+            mp_raise_RuntimeError(MP_ERROR_TEXT("Unable to write to read-only memory"));
+            break;
+    }
+}
+
+void common_hal_memorymap_addressrange_readinto(const memorymap_addressrange_obj_t *self,
+    size_t start_index, size_t width, uint8_t *values, size_t len) {
+    uint8_t *src_addr = self->start_address + start_index;
+    if ((size_t)src_addr % width || (self->type == IO && width != 4)) {
+        // Only aligned 32-bit accesses are supported by RP2 for IO registers
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Unable to access unaligned IO register"));
+    }
+    if (width == 4) {
+        const volatile uint32_t *src_addr32 = (const volatile uint32_t *)src_addr;
+        for (size_t i = 0; i < len; i += 4) {
+            uint32_t value = *src_addr32++;
+            memcpy(values + i, &value, sizeof(value));
+        }
+    } else if (width == 2) {
+        const volatile uint16_t *src_addr16 = (const volatile uint16_t *)src_addr;
+        for (size_t i = 0; i < len; i += 2) {
+            uint16_t value = *src_addr16++;
+            memcpy(values + i, &value, sizeof(value));
+        }
+    } else {
+        const volatile uint8_t *src_addr8 = src_addr;
+        for (size_t i = 0; i < len; i++) {
+            values[i] = *src_addr8++;
+        }
+    }
+}
@@ -11,8 +11,12 @@
 #include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/digitalio/DigitalInOut.h"
 
+#include "py/runtime.h"
 #include "supervisor/port.h"
 
+#include "hardware/dma.h"
+#include "hardware/gpio.h"
+
 uint64_t next_start_raw_ticks = 0;
 
 // NeoPixels are 800khz bit streams. We are choosing zeros as <312ns hi, 936 lo> and ones
@@ -34,14 +38,31 @@ const uint16_t neopixel_program[] = {
     0xa442
 };
 
-void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout, uint8_t *pixels, uint32_t num_bytes) {
-    // Set everything up.
-    rp2pio_statemachine_obj_t state_machine;
+// Drives up to 32 strips on consecutive pins at once. Each bit takes 10 cycles at 8MHz: all pins
+// high for 375ns, then each pin's own bit for 375ns, then all low for 500ns. The out width is the
+// strip count rounded up to a power of two so that bit times pack evenly into 32 bit words.
+#define PARALLEL_PROGRAM(width) { \
+        0x6020 | ((width) & 0x1f), /* out x, <width>         */ \
+        0xa20b,                    /* mov pins, !null [2]    */ \
+        0xa201,                    /* mov pins, x     [2]    */ \
+        0xa203,                    /* mov pins, null  [2]    */ \
+}
+static const uint16_t neopixel_parallel_programs[6][4] = {
+    PARALLEL_PROGRAM(1), PARALLEL_PROGRAM(2), PARALLEL_PROGRAM(4),
+    PARALLEL_PROGRAM(8), PARALLEL_PROGRAM(16), PARALLEL_PROGRAM(32),
+};
+
+// The state machine and DMA channel of a background write, which outlive the call that started it.
+static rp2pio_statemachine_obj_t background_state_machine;
+static int background_dma_channel = -1;
+static uint8_t background_pin_number;
+static bool background_dma_done;
 
+static bool start_state_machine(rp2pio_statemachine_obj_t *state_machine, const digitalio_digitalinout_obj_t *digitalinout) {
     // TODO: Cache the state machine after we create it once. We'll need a way to
     // change the pins then though.
     pio_pinmask_t pins_we_use = PIO_PINMASK_FROM_PIN(digitalinout->pin->number);
-    bool ok = rp2pio_statemachine_construct(&state_machine,
+    bool ok = rp2pio_statemachine_construct(state_machine,
         neopixel_program, MP_ARRAY_SIZE(neopixel_program),
         12800000, // 12.8MHz, to get appropriate sub-bit times in PIO program.
         NULL, 0, // init program
@@ -64,24 +85,191 @@ void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout,
         PIO_FIFO_TYPE_DEFAULT,
         PIO_MOV_STATUS_DEFAULT, PIO_MOV_N_DEFAULT);
     if (!ok) {
-        // Do nothing. Maybe bitbang?
-        return;
+        return false;
     }
 
     // Wait to make sure we don't append onto the last transmission. This should only be a tick or
     // two.
     while (port_get_raw_ticks(NULL) < next_start_raw_ticks) {
     }
+    return true;
+}
 
-    common_hal_rp2pio_statemachine_write(&state_machine, pixels, num_bytes, 1 /* stride in bytes */, false);
+// Reset the pin and release it from the PIO, leaving it as a low output.
+static void release_pin(uint8_t pin_number) {
+    gpio_init(pin_number);
+    gpio_put(pin_number, false);
+    gpio_set_dir(pin_number, GPIO_OUT);
+}
 
+static void finish_state_machine(rp2pio_statemachine_obj_t *state_machine, uint8_t pin_number) {
     // Use a private deinit of the state machine that doesn't reset the pin.
-    rp2pio_statemachine_deinit(&state_machine, true);
+    rp2pio_statemachine_deinit(state_machine, true);
 
-    // Reset the pin and release it from the PIO
-    gpio_init(digitalinout->pin->number);
-    common_hal_digitalio_digitalinout_switch_to_output((digitalio_digitalinout_obj_t *)digitalinout, false, DRIVE_MODE_PUSH_PULL);
+    release_pin(pin_number);
 
     // Update the next start to +2 ticks. This ensures we give it at least 300us.
     next_start_raw_ticks = port_get_raw_ticks(NULL) + 2;
 }
+
+void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout, uint8_t *pixels, uint32_t num_bytes) {
+    common_hal_neopixel_write_wait();
+
+    // Set everything up.
+    rp2pio_statemachine_obj_t state_machine;
+    if (!start_state_machine(&state_machine, digitalinout)) {
+        // Do nothing. Maybe bitbang?
+        return;
+    }
+
+    common_hal_rp2pio_statemachine_write(&state_machine, pixels, num_bytes, 1 /* stride in bytes */, false);
+
+    finish_state_machine(&state_machine, digitalinout->pin->number);
+}
+
+void common_hal_neopixel_write_background(const digitalio_digitalinout_obj_t *digitalinout, uint8_t *pixels, uint32_t num_bytes) {
+    common_hal_neopixel_write_wait();
+
+    int channel = dma_claim_unused_channel(false);
+    if (channel < 0) {
+        common_hal_neopixel_write(digitalinout, pixels, num_bytes);
+        return;
+    }
+    if (!start_state_machine(&background_state_machine, digitalinout)) {
+        dma_channel_unclaim(channel);
+        return;
+    }
+    background_pin_number = digitalinout->pin->number;
+    background_dma_channel = channel;
+    background_dma_done = false;
+
+    // Feed the TX FIFO a byte at a time. The program shifts left, so bytes go to the top lane.
+    PIO pio = background_state_machine.pio;
+    uint sm = background_state_machine.state_machine;
+    dma_channel_config c = dma_channel_get_default_config(channel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, pio_get_dreq(pio, sm, true));
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    dma_channel_configure(channel, &c,
+        ((volatile uint8_t *)&pio->txf[sm]) + 3,
+        pixels,
+        num_bytes,
+        true);
+}
+
+bool common_hal_neopixel_write_busy(void) {
+    if (background_dma_channel < 0) {
+        return false;
+    }
+    PIO pio = background_state_machine.pio;
+    uint sm = background_state_machine.state_machine;
+    uint32_t stall_mask = 1 << (PIO_FDEBUG_TXSTALL_LSB + sm);
+    if (!background_dma_done) {
+        if (dma_channel_is_busy(background_dma_channel)) {
+            return true;
+        }
+        // Clear the stall bit so we can detect when the state machine is done transmitting.
+        pio->fdebug = stall_mask;
+        background_dma_done = true;
+    }
+    // The last bits are still shifting out until the state machine stalls on an empty FIFO.
+    if (!pio_sm_is_tx_fifo_empty(pio, sm) || (pio->fdebug & stall_mask) == 0) {
+        return true;
+    }
+    dma_channel_unclaim(background_dma_channel);
+    background_dma_channel = -1;
+    finish_state_machine(&background_state_machine, background_pin_number);
+    return false;
+}
+
+void common_hal_neopixel_write_wait(void) {
+    while (common_hal_neopixel_write_busy()) {
+        RUN_BACKGROUND_TASKS;
+    }
+}
+
+void common_hal_neopixel_write_parallel(const digitalio_digitalinout_obj_t **digitalinouts, uint8_t **pixels, const uint32_t *num_bytes, size_t count) {
+    uint8_t first_pin = digitalinouts[0]->pin->number;
+    bool consecutive = count > 1;
+    size_t max_len = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (digitalinouts[i]->pin->number != first_pin + i) {
+            consecutive = false;
+        }
+        max_len = MAX(max_len, num_bytes[i]);
+    }
+    if (!consecutive) {
+        for (size_t i = 0; i < count; i++) {
+            common_hal_neopixel_write(digitalinouts[i], pixels[i], num_bytes[i]);
+        }
+        return;
+    }
+    common_hal_neopixel_write_wait();
+
+    size_t program_index = 0;
+    while ((1u << program_index) < count) {
+        program_index++;
+    }
+    size_t width = 1u << program_index;
+
+    // Transpose the strips so that each bit time holds one bit of every strip, msb first. Shorter
+    // strips get zero bits past their end, which nothing receives.
+    size_t bit_count = max_len * 8;
+    size_t word_count = MP_CEIL_DIVIDE(bit_count * width, 32);
+    uint32_t *data = m_new0(uint32_t, word_count);
+    size_t bit_time = 0;
+    for (size_t j = 0; j < max_len; j++) {
+        for (int b = 7; b >= 0; b--, bit_time++) {
+            uint32_t value = 0;
+            for (size_t i = 0; i < count; i++) {
+                if (j < num_bytes[i]) {
+                    value |= ((uint32_t)(pixels[i][j] >> b) & 1) << i;
+                }
+            }
+            size_t bit_offset = bit_time * width;
+            data[bit_offset / 32] |= value << (bit_offset % 32);
+        }
+    }
+
+    pio_pinmask_t pins_we_use = PIO_PINMASK_NONE;
+    for (size_t i = 0; i < count; i++) {
+        PIO_PINMASK_SET(pins_we_use, first_pin + i);
+    }
+    rp2pio_statemachine_obj_t state_machine;
+    bool ok = rp2pio_statemachine_construct(&state_machine,
+        neopixel_parallel_programs[program_index], MP_ARRAY_SIZE(neopixel_parallel_programs[0]),
+        8000000, // 8MHz, for 10 cycles per bit.
+        NULL, 0, // init program
+        digitalinouts[0]->pin, count, // out
+        NULL, 1, // in
+        PIO_PINMASK_NONE, PIO_PINMASK_NONE, // gpio pulls
+        NULL, 1, // set
+        NULL, 0, false, // sideset
+        PIO_PINMASK_NONE, pins_we_use, // initial pin state
+        NULL, // jump pin
+        pins_we_use, true, false,
+        true, 32, true, // TX, auto pull every 32 bits. shift right to output the first bit time first
+        true, // Wait for txstall. If we don't, then we'll deinit too quickly.
+        false, 32, true, // RX setting we don't use
+        false, // claim pins
+        false, // Not user-interruptible.
+        false, // No sideset enable
+        0, -1, // wrap
+        PIO_ANY_OFFSET,  // offset
+        PIO_FIFO_TYPE_DEFAULT,
+        PIO_MOV_STATUS_DEFAULT, PIO_MOV_N_DEFAULT);
+    if (ok) {
+        while (port_get_raw_ticks(NULL) < next_start_raw_ticks) {
+        }
+
+        common_hal_rp2pio_statemachine_write(&state_machine, (uint8_t *)data, word_count * sizeof(uint32_t), 4 /* stride in bytes */, false);
+
+        rp2pio_statemachine_deinit(&state_machine, true);
+        for (size_t i = 0; i < count; i++) {
+            release_pin(first_pin + i);
+        }
+        next_start_raw_ticks = port_get_raw_ticks(NULL) + 2;
+    }
+    m_del(uint32_t, data, word_count);
+}
@@ -15,6 +15,8 @@
 #include "bindings/rp2pio/StateMachine.h"
 #include "common-hal/rp2pio/StateMachine.h"
 
+#include "hardware/dma.h"
+
 static const uint16_t parallel_program[] = {
 // .side_set 1
 // .wrap_target
@@ -97,9 +99,17 @@ void common_hal_paralleldisplaybus_parallelbus_construct(paralleldisplaybus_para
         PIO_MOV_STATUS_DEFAULT, PIO_MOV_N_DEFAULT);
 
     common_hal_rp2pio_statemachine_never_reset(&self->state_machine);
+    self->dma_channel = -1;
 }
 
 void common_hal_paralleldisplaybus_parallelbus_deinit(paralleldisplaybus_parallelbus_obj_t *self) {
+    #if CIRCUITPY_BUSDISPLAY_DOUBLE_BUFFER
+    if (self->dma_channel >= 0) {
+        dma_channel_abort(self->dma_channel);
+        dma_channel_unclaim(self->dma_channel);
+        self->dma_channel = -1;
+    }
+    #endif
     common_hal_rp2pio_statemachine_deinit(&self->state_machine);
 
     for (uint8_t i = 0; i < 8; i++) {
@@ -148,6 +158,53 @@ void common_hal_paralleldisplaybus_parallelbus_send(mp_obj_t obj, display_byte_t
     common_hal_rp2pio_statemachine_write(&self->state_machine, data, data_length, 1, false);
 }
 
+#if CIRCUITPY_BUSDISPLAY_DOUBLE_BUFFER
+void common_hal_paralleldisplaybus_parallelbus_send_async(mp_obj_t obj, const uint8_t *data, uint32_t data_length) {
+    paralleldisplaybus_parallelbus_obj_t *self = MP_OBJ_TO_PTR(obj);
+    common_hal_digitalio_digitalinout_set_value(&self->command, true);
+
+    int channel = dma_claim_unused_channel(false);
+    if (channel < 0) {
+        common_hal_rp2pio_statemachine_write(&self->state_machine, data, data_length, 1, false);
+        return;
+    }
+    self->dma_channel = channel;
+
+    PIO pio = self->state_machine.pio;
+    uint sm = self->state_machine.state_machine;
+    // The program shifts left, so byte writes go to the top byte of the FIFO word.
+    volatile uint8_t *tx_destination = (volatile uint8_t *)&pio->txf[sm] + 3;
+
+    dma_channel_config c = dma_channel_get_default_config(channel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, pio_get_dreq(pio, sm, true));
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    // Clear the stall bit so wait_for_send can tell when the last byte has been strobed out.
+    pio->fdebug = 1 << (PIO_FDEBUG_TXSTALL_LSB + sm);
+    dma_channel_configure(channel, &c, tx_destination, data, data_length, true);
+}
+
+void common_hal_paralleldisplaybus_parallelbus_wait_for_send(mp_obj_t obj) {
+    paralleldisplaybus_parallelbus_obj_t *self = MP_OBJ_TO_PTR(obj);
+    if (self->dma_channel < 0) {
+        return;
+    }
+    while (dma_channel_is_busy(self->dma_channel)) {
+        RUN_BACKGROUND_TASKS;
+    }
+    dma_channel_unclaim(self->dma_channel);
+    self->dma_channel = -1;
+
+    PIO pio = self->state_machine.pio;
+    uint sm = self->state_machine.state_machine;
+    uint32_t stall_mask = 1 << (PIO_FDEBUG_TXSTALL_LSB + sm);
+    while (!pio_sm_is_tx_fifo_empty(pio, sm) || (pio->fdebug & stall_mask) == 0) {
+        RUN_BACKGROUND_TASKS;
+    }
+}
+#endif
+
 void common_hal_paralleldisplaybus_parallelbus_end_transaction(mp_obj_t obj) {
     paralleldisplaybus_parallelbus_obj_t *self = MP_OBJ_TO_PTR(obj);
     common_hal_digitalio_digitalinout_set_value(&self->chip_select, true);
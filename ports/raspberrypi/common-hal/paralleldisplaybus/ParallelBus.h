@@ -19,4 +19,6 @@ typedef struct {
     uint8_t write;
     uint8_t data0_pin;
     rp2pio_statemachine_obj_t state_machine;
+    // DMA channel of an in-progress send_async, or -1.
+    int dma_channel;
 } paralleldisplaybus_parallelbus_obj_t;
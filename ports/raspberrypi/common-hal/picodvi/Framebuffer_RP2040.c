@@ -12,6 +12,7 @@
 #include "common-hal/pwmio/PWMOut.h"
 #include "common-hal/rp2pio/StateMachine.h"
 #include "supervisor/port.h"
+#include "supervisor/shared/offload.h"
 
 #include "pico/stdlib.h"
 #include "hardware/structs/mpu.h"
@@ -281,7 +282,8 @@ void common_hal_picodvi_framebuffer_construct(picodvi_framebuffer_obj_t *self,
     active_picodvi = self;
 
     // Core 1 will wait until it sees the first colour buffer, then start up the
-    // DVI signalling.
+    // DVI signalling. Offloaded work runs on the main core instead.
+    supervisor_offload_stop();
     multicore_launch_core1(core1_main);
 
     self->next_scanline = 0;
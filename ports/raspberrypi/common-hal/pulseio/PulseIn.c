@@ -4,6 +4,7 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include "hardware/dma.h"
 #include "hardware/gpio.h"
 
 #include <stdint.h>
@@ -14,31 +15,98 @@
 #include "shared-bindings/microcontroller/Pin.h"
 #include "bindings/rp2pio/StateMachine.h"
 #include "common-hal/pulseio/PulseIn.h"
+#include "supervisor/port_heap.h"
 
 #define NO_PIN 0xff
-#define MAX_PULSE 65535
-#define MIN_PULSE 0
+#define NO_DMA_CHANNEL (-1)
 
+// Extra ring entries beyond maxlen so that DMA doesn't overwrite pulses while we copy them out.
+#define RING_SLACK (32)
+// DMA can wrap at most 32kB.
+#define MAX_RING_BITS (15)
+// The largest transfer count that is a plain count on both the RP2040 and RP2350.
+#define DMA_COUNT (0x0fffffff)
+
+// The state machine times each pulse itself and pushes its length, so capture is done entirely
+// by PIO and DMA, without interrupts. Each phase counts x down from 0xffff (kept in osr) once per
+// microsecond until the pin changes, saturating at zero, and then pushes the low 16 bits of x.
+// The pulse length is therefore ~x.
 static const uint16_t pulsein_program[] = {
-    0x4001, //  1: in     pins, 1
+    // High phase
+    0xa027, //  0: mov    x, osr
+    0x00c3, //  1: jmp    pin, 3
+    0x0006, //  2: jmp    6
+    0x0041, //  3: jmp    x--, 1
+    0xa023, //  4: mov    x, null
+    0x2020, //  5: wait   0 pin, 0
+    0x4030, //  6: in     x, 16
+    // Low phase
+    0xa027, //  7: mov    x, osr
+    0x00cc, //  8: jmp    pin, 12
+    0x0048, //  9: jmp    x--, 8
+    0xa023, // 10: mov    x, null
+    0x20a0, // 11: wait   1 pin, 0
+    0x4030, // 12: in     x, 16
 };
+#define LOW_PHASE_OFFSET (7)
+
+static void start_dma(pulseio_pulsein_obj_t *self) {
+    const size_t ring_mask = (1 << (self->ring_bits - 1)) - 1;
+    dma_channel_config c = dma_channel_get_default_config(self->dma_channel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_dreq(&c, self->state_machine.rx_dreq);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, self->ring_bits);
+    dma_channel_configure(self->dma_channel, &c,
+        &self->buffer[self->written & ring_mask],
+        &self->state_machine.pio->rxf[self->state_machine.state_machine],
+        DMA_COUNT,
+        true);
+    self->last_remaining = DMA_COUNT;
+}
+
+static void count_written(pulseio_pulsein_obj_t *self) {
+    uint32_t remaining = dma_channel_hw_addr(self->dma_channel)->transfer_count & DMA_COUNT;
+    self->written += self->last_remaining - remaining;
+    self->last_remaining = remaining;
+}
+
+// Catch up with what DMA has captured. This is done whenever the pulses are looked at.
+static void update(pulseio_pulsein_obj_t *self) {
+    if (!self->paused) {
+        count_written(self);
+        // Restart well before the transfer count runs out. The FIFO holds any pulses meanwhile.
+        if (self->last_remaining < DMA_COUNT / 2) {
+            dma_channel_abort(self->dma_channel);
+            count_written(self);
+            start_dma(self);
+        }
+    }
+    if (self->written - self->read > self->maxlen) {
+        self->read = self->written - self->maxlen;
+    }
+}
+
+static inline uint16_t pulse_at(pulseio_pulsein_obj_t *self, uint32_t position) {
+    const size_t ring_mask = (1 << (self->ring_bits - 1)) - 1;
+    return ~self->buffer[position & ring_mask];
+}
 
 void common_hal_pulseio_pulsein_construct(pulseio_pulsein_obj_t *self,
     const mcu_pin_obj_t *pin, uint16_t maxlen, bool idle_state) {
+    mp_arg_validate_int_max(maxlen, (1 << (MAX_RING_BITS - 1)) - RING_SLACK, MP_QSTR_maxlen);
 
-    self->buffer = (uint16_t *)m_malloc(maxlen * sizeof(uint16_t));
-    if (self->buffer == NULL) {
-        m_malloc_fail(maxlen * sizeof(uint16_t));
-    }
     self->pin = pin->number;
     self->maxlen = maxlen;
     self->idle_state = idle_state;
-    self->start = 0;
-    self->len = 0;
+    self->written = 0;
+    self->read = 0;
+    self->paused = true;
 
     common_hal_rp2pio_statemachine_construct(&self->state_machine,
         pulsein_program, MP_ARRAY_SIZE(pulsein_program),
-        1000000, // frequency
+        2000000, // frequency, two cycles per microsecond count
         NULL, 0, // init, init_len
         NULL, 0, // may_exec
         NULL, 0, PIO_PINMASK32_NONE, PIO_PINMASK32_NONE, // first out pin, # out pins, initial_out_pin_state
@@ -46,21 +114,39 @@ void common_hal_pulseio_pulsein_construct(pulseio_pulsein_obj_t *self,
         NULL, 0, PIO_PINMASK32_NONE, PIO_PINMASK32_NONE, // first set pin
         NULL, 0, false, PIO_PINMASK32_NONE, PIO_PINMASK32_NONE, // first sideset pin
         false, // No sideset enable
-        NULL, PULL_NONE, // jump pin, jmp_pull
+        pin, PULL_NONE, // jump pin, jmp_pull
         PIO_PINMASK_NONE, // wait gpio pins
         true, // exclusive pin usage
-        false, 8, false, // TX, setting we don't use
+        false, 32, false, // TX, only used to set osr
         false, // wait for TX stall
-        true, 32, true, // RX auto pull every 32 bits. shift left to output msb first
+        true, 16, false, // RX auto push every pulse length
         false, // Not user-interruptible.
         0, -1, // wrap settings
         PIO_ANY_OFFSET,
         PIO_FIFO_TYPE_DEFAULT,
         PIO_MOV_STATUS_DEFAULT, PIO_MOV_N_DEFAULT);
 
-    common_hal_pulseio_pulsein_pause(self);
+    self->ring_bits = 1;
+    while ((1u << self->ring_bits) < (maxlen + RING_SLACK) * sizeof(uint16_t)) {
+        self->ring_bits++;
+    }
+    // DMA rings must be aligned to their size so allocate enough to align within.
+    size_t ring_size = 1 << self->ring_bits;
+    self->buffer_alloc = port_malloc(ring_size * 2, true);
+    if (self->buffer_alloc == NULL) {
+        common_hal_rp2pio_statemachine_deinit(&self->state_machine);
+        self->pin = NO_PIN;
+        m_malloc_fail(ring_size * 2);
+    }
+    self->buffer = (uint16_t *)(((uintptr_t)self->buffer_alloc + ring_size - 1) & ~(ring_size - 1));
 
-    common_hal_rp2pio_statemachine_set_interrupt_handler(&(self->state_machine), &common_hal_pulseio_pulsein_interrupt, self, PIO_IRQ0_INTE_SM0_RXNEMPTY_BITS);
+    self->dma_channel = dma_claim_unused_channel(false);
+    if (self->dma_channel == NO_DMA_CHANNEL) {
+        port_free(self->buffer_alloc);
+        common_hal_rp2pio_statemachine_deinit(&self->state_machine);
+        self->pin = NO_PIN;
+        mp_raise_RuntimeError(MP_ERROR_TEXT("All dma channels in use"));
+    }
 
     common_hal_pulseio_pulsein_resume(self, 0);
 }
@@ -73,57 +159,28 @@ void common_hal_pulseio_pulsein_deinit(pulseio_pulsein_obj_t *self) {
     if (common_hal_pulseio_pulsein_deinited(self)) {
         return;
     }
-    pio_sm_set_enabled(self->state_machine.pio, self->state_machine.state_machine, false);
+    common_hal_pulseio_pulsein_pause(self);
+    dma_channel_unclaim(self->dma_channel);
+    self->dma_channel = NO_DMA_CHANNEL;
     common_hal_rp2pio_statemachine_deinit(&self->state_machine);
-    m_free(self->buffer);
+    port_free(self->buffer_alloc);
+    self->buffer_alloc = NULL;
+    self->buffer = NULL;
     reset_pin_number(self->pin);
     self->pin = NO_PIN;
 }
 
 void common_hal_pulseio_pulsein_pause(pulseio_pulsein_obj_t *self) {
-    pio_sm_restart(self->state_machine.pio, self->state_machine.state_machine);
     pio_sm_set_enabled(self->state_machine.pio, self->state_machine.state_machine, false);
+    if (!self->paused) {
+        dma_channel_abort(self->dma_channel);
+        count_written(self);
+    }
+    pio_sm_restart(self->state_machine.pio, self->state_machine.state_machine);
     pio_sm_clear_fifos(self->state_machine.pio, self->state_machine.state_machine);
-    self->last_level = self->idle_state;
-    self->level_count = 0;
     self->paused = true;
 }
-void common_hal_pulseio_pulsein_interrupt(void *self_in) {
-    pulseio_pulsein_obj_t *self = self_in;
-
-    uint32_t rxfifo = 0;
 
-    rxfifo = pio_sm_get_blocking(self->state_machine.pio, self->state_machine.state_machine);
-    // translate from fifo to buffer
-    if ((rxfifo == 0 && self->last_level == false) || (rxfifo == 0xffffffff && self->last_level == true)) {
-        self->level_count = self->level_count + 32;
-    } else {
-        for (uint i = 0; i < 32; i++) {
-            bool level = (rxfifo & (1 << i)) >> i;
-            if (level == self->last_level) {
-                self->level_count++;
-            } else {
-                uint32_t result = self->level_count;
-                self->last_level = level;
-                self->level_count = 1;
-                // Pulses that are longer than MAX_PULSE will return MAX_PULSE
-                if (result > MAX_PULSE) {
-                    result = MAX_PULSE;
-                }
-                // return  pulses that are not too short
-                if (result > MIN_PULSE) {
-                    size_t buf_index = (self->start + self->len) % self->maxlen;
-                    self->buffer[buf_index] = (uint16_t)result;
-                    if (self->len < self->maxlen) {
-                        self->len++;
-                    } else {
-                        self->start = (self->start + 1) % self->maxlen;
-                    }
-                }
-            }
-        }
-    }
-}
 void common_hal_pulseio_pulsein_resume(pulseio_pulsein_obj_t *self,
     uint16_t trigger_duration) {
 
@@ -134,41 +191,58 @@ void common_hal_pulseio_pulsein_resume(pulseio_pulsein_obj_t *self,
         gpio_set_dir(self->pin, true);
         gpio_put(self->pin, !self->idle_state);
         common_hal_mcu_delay_us((uint32_t)trigger_duration);
-        gpio_set_function(self->pin, GPIO_FUNC_PIO0);
+        pio_gpio_init(self->state_machine.pio, self->pin);
     }
 
-    // exec a wait for the selected pin to change state
-    if (self->idle_state == true) {
-        pio_sm_exec(self->state_machine.pio, self->state_machine.state_machine, 0x2020);
+    PIO pio = self->state_machine.pio;
+    uint sm = self->state_machine.state_machine;
+    pio_sm_put(pio, sm, 0xffff);
+    pio_sm_exec(pio, sm, pio_encode_pull(false, true));
+    // Start in the phase of the first active pulse once the pin leaves its idle state.
+    if (self->idle_state) {
+        pio_sm_exec(pio, sm, pio_encode_jmp(self->state_machine.offset + LOW_PHASE_OFFSET));
+        pio_sm_exec(pio, sm, pio_encode_wait_pin(false, 0));
     } else {
-        pio_sm_exec(self->state_machine.pio, self->state_machine.state_machine, 0x20a0);
+        pio_sm_exec(pio, sm, pio_encode_jmp(self->state_machine.offset));
+        pio_sm_exec(pio, sm, pio_encode_wait_pin(true, 0));
     }
-    pio_sm_set_enabled(self->state_machine.pio, self->state_machine.state_machine, true);
+    start_dma(self);
+    pio_sm_set_enabled(pio, sm, true);
     self->paused = false;
 }
 
 void common_hal_pulseio_pulsein_clear(pulseio_pulsein_obj_t *self) {
-    self->len = 0;
+    update(self);
+    self->read = self->written;
 }
 
 uint16_t common_hal_pulseio_pulsein_popleft(pulseio_pulsein_obj_t *self) {
-    if (self->len == 0) {
+    update(self);
+    if (self->written == self->read) {
         mp_raise_IndexError_varg(MP_ERROR_TEXT("pop from empty %q"), MP_QSTR_PulseIn);
     }
-    uint16_t value = self->buffer[self->start];
-    common_hal_mcu_disable_interrupts();
-    self->start = (self->start + 1) % self->maxlen;
-    self->len--;
-    common_hal_mcu_enable_interrupts();
+    uint16_t value = pulse_at(self, self->read);
+    self->read++;
     return value;
 }
 
+size_t common_hal_pulseio_pulsein_readinto(pulseio_pulsein_obj_t *self, uint16_t *buffer, size_t len) {
+    update(self);
+    size_t count = MIN(len, self->written - self->read);
+    for (size_t i = 0; i < count; i++) {
+        buffer[i] = pulse_at(self, self->read + i);
+    }
+    self->read += count;
+    return count;
+}
+
 uint16_t common_hal_pulseio_pulsein_get_maxlen(pulseio_pulsein_obj_t *self) {
     return self->maxlen;
 }
 
 uint16_t common_hal_pulseio_pulsein_get_len(pulseio_pulsein_obj_t *self) {
-    return self->len;
+    update(self);
+    return self->written - self->read;
 }
 
 bool common_hal_pulseio_pulsein_get_paused(pulseio_pulsein_obj_t *self) {
@@ -177,12 +251,13 @@ bool common_hal_pulseio_pulsein_get_paused(pulseio_pulsein_obj_t *self) {
 
 uint16_t common_hal_pulseio_pulsein_get_item(pulseio_pulsein_obj_t *self,
     int16_t index) {
+    update(self);
+    int16_t len = self->written - self->read;
     if (index < 0) {
-        index += self->len;
+        index += len;
     }
-    if (index < 0 || index >= self->len) {
-        mp_arg_validate_index_range(index, 0, self->len, MP_QSTR_index);
+    if (index < 0 || index >= len) {
+        mp_arg_validate_index_range(index, 0, len, MP_QSTR_index);
     }
-    uint16_t value = self->buffer[(self->start + index) % self->maxlen];
-    return value;
+    return pulse_at(self, self->read + index);
 }
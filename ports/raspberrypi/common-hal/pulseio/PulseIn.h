@@ -18,12 +18,16 @@ typedef struct {
     bool idle_state;
     bool paused;
     uint16_t maxlen;
+    // DMA writes pulses into this ring. It is aligned to its size, which is 1 << ring_bits bytes,
+    // inside of buffer_alloc.
     uint16_t *buffer;
-    volatile bool last_level;
-    volatile uint32_t level_count;
-    volatile uint16_t len;
-    volatile uint16_t start;
+    void *buffer_alloc;
+    uint8_t ring_bits;
+    int dma_channel;
+    // Counts of pulses written by DMA and read by us. Only their difference matters.
+    uint32_t written;
+    uint32_t read;
+    // The DMA transfer count when written was last updated.
+    uint32_t last_remaining;
     rp2pio_statemachine_obj_t state_machine;
 } pulseio_pulsein_obj_t;
-
-void common_hal_pulseio_pulsein_interrupt(void *);
@@ -98,14 +98,11 @@ static void rp2pio_statemachine_clear_dma_read(int pio_index, int sm) {
     SM_DMA_CLEAR_CHANNEL_READ(pio_index, sm);
 }
 
-static void _reset_statemachine(PIO pio, uint8_t sm, bool leave_pins) {
+// Forget the state machine's program and free its instruction memory unless another state
+// machine in the same PIO still runs it.
+static void _release_program(PIO pio, uint8_t sm) {
     uint8_t pio_index = pio_get_index(pio);
-    rp2pio_statemachine_clear_dma_write(pio_index, sm);
-    rp2pio_statemachine_clear_dma_read(pio_index, sm);
     uint32_t program_id = _current_program_id[pio_index][sm];
-    if (program_id == 0) {
-        return;
-    }
     _current_program_id[pio_index][sm] = 0;
     bool program_in_use = false;
     for (size_t i = 0; i < NUM_PIO_STATE_MACHINES; i++) {
@@ -121,6 +118,16 @@ static void _reset_statemachine(PIO pio, uint8_t sm, bool leave_pins) {
         };
         pio_remove_program(pio, &program_struct, offset);
     }
+}
+
+static void _reset_statemachine(PIO pio, uint8_t sm, bool leave_pins) {
+    uint8_t pio_index = pio_get_index(pio);
+    rp2pio_statemachine_clear_dma_write(pio_index, sm);
+    rp2pio_statemachine_clear_dma_read(pio_index, sm);
+    if (_current_program_id[pio_index][sm] == 0) {
+        return;
+    }
+    _release_program(pio, sm);
 
     pio_pinmask_t pins = _current_sm_pins[pio_index][sm];
     for (size_t pin_number = 0; pin_number < NUM_BANK0_GPIOS; pin_number++) {
@@ -762,6 +769,78 @@ void common_hal_rp2pio_statemachine_restart(rp2pio_statemachine_obj_t *self) {
     pio_sm_set_enabled(self->pio, self->state_machine, true);
 }
 
+void common_hal_rp2pio_statemachine_reconfigure(rp2pio_statemachine_obj_t *self,
+    const uint16_t *program, size_t program_len,
+    int32_t frequency,
+    const uint16_t *init, size_t init_len,
+    int wrap_target, int wrap) {
+    PIO pio = self->pio;
+    uint8_t sm = self->state_machine;
+    uint8_t pio_index = pio_get_index(pio);
+
+    common_hal_rp2pio_statemachine_stop(self);
+    (void)common_hal_rp2pio_statemachine_stop_background_write(self);
+    (void)common_hal_rp2pio_statemachine_stop_background_read(self);
+
+    uint32_t program_id = ~((uint32_t)program);
+    if (program != NULL &&
+        (program_id != _current_program_id[pio_index][sm] || program_len != _current_program_len[pio_index][sm])) {
+        // Share the copy another state machine in this PIO already loaded, like construction does.
+        int offset = -1;
+        for (size_t i = 0; i < NUM_PIO_STATE_MACHINES; i++) {
+            if (_current_program_id[pio_index][i] == program_id &&
+                _current_program_len[pio_index][i] == program_len) {
+                offset = _current_program_offset[pio_index][i];
+                break;
+            }
+        }
+        if (offset == -1) {
+            pio_program_t program_struct = {
+                .instructions = (uint16_t *)program,
+                .length = program_len,
+                .origin = -1,
+            };
+            // The new program goes in before the old one comes out, so a failure leaves this
+            // state machine as it was.
+            if (!pio_can_add_program(pio, &program_struct)) {
+                mp_raise_ValueError(MP_ERROR_TEXT("Program too long"));
+            }
+            offset = pio_add_program(pio, &program_struct);
+        }
+        _release_program(pio, sm);
+        self->offset = offset;
+        _current_program_id[pio_index][sm] = program_id;
+        _current_program_len[pio_index][sm] = program_len;
+        _current_program_offset[pio_index][sm] = offset;
+    }
+
+    program_len = _current_program_len[pio_index][sm];
+    mp_arg_validate_int_range(wrap, -1, program_len - 1, MP_QSTR_wrap);
+    if (wrap == -1) {
+        wrap = program_len - 1;
+    }
+    mp_arg_validate_int_range(wrap_target, 0, program_len - 1, MP_QSTR_wrap_target);
+    wrap += self->offset;
+    wrap_target += self->offset;
+    sm_config_set_wrap(&self->sm_config, wrap_target, wrap);
+    pio_sm_set_wrap(pio, sm, wrap_target, wrap);
+
+    if (frequency >= 0) {
+        common_hal_rp2pio_statemachine_set_frequency(self, frequency);
+    }
+    if (init != NULL) {
+        self->init = init;
+        self->init_len = init_len;
+    }
+
+    // Unlike restart, the pins are left as they are so that switching programs doesn't glitch them.
+    pio_sm_clear_fifos(pio, sm);
+    pio_sm_restart(pio, sm);
+    pio_sm_exec(pio, sm, pio_encode_jmp(self->offset));
+    common_hal_rp2pio_statemachine_run(self, self->init, self->init_len);
+    pio_sm_set_enabled(pio, sm, true);
+}
+
 void common_hal_rp2pio_statemachine_stop(rp2pio_statemachine_obj_t *self) {
     pio_sm_set_enabled(self->pio, self->state_machine, false);
 }
@@ -1195,6 +1274,7 @@ bool common_hal_rp2pio_statemachine_background_write(rp2pio_statemachine_obj_t *
 
     self->pending_buffers_write = pending_buffers_write;
     self->dma_completed_write = false;
+    self->write_position_done = 0;
 
     self->background_stride_in_bytes = stride_in_bytes;
     self->byteswap = swap;
@@ -1226,6 +1306,7 @@ bool common_hal_rp2pio_statemachine_background_write(rp2pio_statemachine_obj_t *
 }
 
 void rp2pio_statemachine_dma_complete_write(rp2pio_statemachine_obj_t *self, int channel_write) {
+    self->write_position_done += self->current_write_buf.info.len / self->background_stride_in_bytes;
     self->current_write_buf = self->next_write_buf_1;
     self->next_write_buf_1 = self->next_write_buf_2;
     self->next_write_buf_2 = self->next_write_buf_3;
@@ -1265,6 +1346,33 @@ int common_hal_rp2pio_statemachine_get_pending_write(rp2pio_statemachine_obj_t *
     return self->pending_buffers_write;
 }
 
+// Adds how far DMA is into the current buffer to the elements of the buffers it has finished.
+static uint64_t _dma_position(int channel, uint64_t done, const sm_buf_info *current, bool completed, int stride_in_bytes) {
+    if (completed || current->info.len == 0) {
+        return done;
+    }
+    uint32_t remaining = dma_hw->ch[channel].transfer_count;
+    #ifdef DMA_CH0_TRANS_COUNT_COUNT_BITS
+    // The top bits hold the mode on the RP2350.
+    remaining &= DMA_CH0_TRANS_COUNT_COUNT_BITS;
+    #endif
+    return done + current->info.len / stride_in_bytes - remaining;
+}
+
+uint64_t common_hal_rp2pio_statemachine_get_write_position(rp2pio_statemachine_obj_t *self) {
+    uint8_t pio_index = pio_get_index(self->pio);
+    uint8_t sm = self->state_machine;
+    if (!SM_DMA_ALLOCATED_WRITE(pio_index, sm)) {
+        return self->write_position_done;
+    }
+    // Keep the DMA interrupt from switching buffers between the reads.
+    common_hal_mcu_disable_interrupts();
+    uint64_t position = _dma_position(SM_DMA_GET_CHANNEL_WRITE(pio_index, sm), self->write_position_done,
+        &self->current_write_buf, self->dma_completed_write, self->background_stride_in_bytes);
+    common_hal_mcu_enable_interrupts();
+    return position;
+}
+
 // =================================================================================
 
 bool common_hal_rp2pio_statemachine_background_read(rp2pio_statemachine_obj_t *self, uint8_t stride_in_bytes, bool swap) {
@@ -1360,6 +1468,7 @@ bool common_hal_rp2pio_statemachine_background_read(rp2pio_statemachine_obj_t *s
 
     self->pending_buffers_read = pending_buffers_read;
     self->dma_completed_read = false;
+    self->read_position_done = 0;
 
     self->background_stride_in_bytes = stride_in_bytes;
     self->byteswap = swap;
@@ -1389,7 +1498,7 @@ bool common_hal_rp2pio_statemachine_background_read(rp2pio_statemachine_obj_t *s
 }
 
 void rp2pio_statemachine_dma_complete_read(rp2pio_statemachine_obj_t *self, int channel_read) {
-
+    self->read_position_done += self->current_read_buf.info.len / self->background_stride_in_bytes;
     self->current_read_buf = self->next_read_buf_1;
     self->next_read_buf_1 = self->next_read_buf_2;
     self->next_read_buf_2 = self->next_read_buf_3;
@@ -1429,6 +1538,19 @@ int common_hal_rp2pio_statemachine_get_pending_read(rp2pio_statemachine_obj_t *s
     return self->pending_buffers_read;
 }
 
+uint64_t common_hal_rp2pio_statemachine_get_read_position(rp2pio_statemachine_obj_t *self) {
+    uint8_t pio_index = pio_get_index(self->pio);
+    uint8_t sm = self->state_machine;
+    if (!SM_DMA_ALLOCATED_READ(pio_index, sm)) {
+        return self->read_position_done;
+    }
+    common_hal_mcu_disable_interrupts();
+    uint64_t position = _dma_position(SM_DMA_GET_CHANNEL_READ(pio_index, sm), self->read_position_done,
+        &self->current_read_buf, self->dma_completed_read, self->background_stride_in_bytes);
+    common_hal_mcu_enable_interrupts();
+    return position;
+}
+
 int common_hal_rp2pio_statemachine_get_offset(rp2pio_statemachine_obj_t *self) {
     uint8_t pio_index = pio_get_index(self->pio);
     uint8_t sm = self->state_machine;
@@ -133,6 +133,8 @@ typedef struct {
     sm_buf_info current_write_buf, next_write_buf_1, next_write_buf_2, next_write_buf_3;
 
     bool switched_write_buffers, switched_read_buffers;
+    // Elements moved by the buffers background DMA has finished since it started.
+    uint64_t write_position_done, read_position_done;
 
     int background_stride_in_bytes;
     bool dma_completed_write, byteswap;
@@ -23,6 +23,7 @@
 #include "pico/multicore.h"
 
 #include "py/runtime.h"
+#include "supervisor/shared/offload.h"
 
 #include "tusb.h"
 
@@ -160,7 +161,8 @@ usb_host_port_obj_t *common_hal_usb_host_port_construct(const mcu_pin_obj_t *dp,
     common_hal_never_reset_pin(dp);
     common_hal_never_reset_pin(dm);
 
-    // Core 1 will run the SOF interrupt directly.
+    // Core 1 will run the SOF interrupt directly. Offloaded work runs on the main core instead.
+    supervisor_offload_stop();
     _core1_ready = false;
     multicore_launch_core1(core1_main);
     while (!_core1_ready) {
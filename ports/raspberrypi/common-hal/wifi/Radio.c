@@ -283,30 +283,48 @@ static bool connection_unchanged(wifi_radio_obj_t *self, const uint8_t *ssid, si
     return true;
 }
 
-wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, mp_float_t timeout, uint8_t *bssid, size_t bssid_len) {
-    if (!common_hal_wifi_radio_get_enabled(self)) {
-        mp_raise_RuntimeError(MP_ERROR_TEXT("Wifi is not enabled"));
-    }
-
-    if (ssid_len > 32) {
-        return WIFI_RADIO_ERROR_CONNECTION_FAIL;
-    }
-
-    size_t timeout_ms = timeout <= 0 ? 8000 : (size_t)MICROPY_FLOAT_C_FUN(ceil)(timeout * 1000);
-    uint64_t start = port_get_raw_ticks(NULL);
-    uint64_t deadline = start + timeout_ms;
-
-    if (connection_unchanged(self, ssid, ssid_len)) {
-        return WIFI_RADIO_ERROR_NONE;
-    }
-
-    // disconnect
-    common_hal_wifi_radio_stop_station(self);
-
-    // connect
+// The access point and channel of the last successful connection, kept in
+// RAM that survives a deep sleep reset so that the next connect can join
+// directly instead of scanning.
+#define LAST_NETWORK_MAGIC (0x57494649)
+
+typedef struct {
+    uint32_t magic;
+    uint8_t ssid[32];
+    uint8_t ssid_len;
+    uint8_t bssid[6];
+    uint8_t channel;
+} last_network_t;
+
+__attribute__((section(".uninitialized"))) static last_network_t _last_network;
+
+static bool recall_last_network(const uint8_t *ssid, size_t ssid_len) {
+    return _last_network.magic == LAST_NETWORK_MAGIC &&
+           _last_network.ssid_len == ssid_len &&
+           memcmp(_last_network.ssid, ssid, ssid_len) == 0;
+}
+
+static void remember_last_network(const uint8_t *ssid, size_t ssid_len) {
+    uint32_t channel_info[3] = { 0 };
+    if (cyw43_wifi_get_bssid(&cyw43_state, _last_network.bssid) != 0 ||
+        cyw43_ioctl(&cyw43_state, CYW43_IOCTL_GET_CHANNEL, sizeof(channel_info), (uint8_t *)channel_info, CYW43_ITF_STA) != 0) {
+        _last_network.magic = 0;
+        return;
+    }
+    memcpy(_last_network.ssid, ssid, ssid_len);
+    _last_network.ssid_len = ssid_len;
+    // The first word is the hardware channel.
+    _last_network.channel = channel_info[0];
+    _last_network.magic = LAST_NETWORK_MAGIC;
+}
+
+static wifi_radio_error_t connect_station(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, const uint8_t *bssid, uint64_t deadline) {
     int auth_mode = password_len ? CYW43_AUTH_WPA2_AES_PSK : CYW43_AUTH_OPEN;
-    cyw43_arch_wifi_connect_async((const char *)ssid, (const char *)password, auth_mode);
     // TODO: Implement authmode check like in espressif
+    if (cyw43_wifi_join(&cyw43_state, ssid_len, ssid, password_len, password, auth_mode,
+        bssid, channel == 0 ? CYW43_CHANNEL_NONE : channel) != 0) {
+        return WIFI_RADIO_ERROR_CONNECTION_FAIL;
+    }
 
     while (port_get_raw_ticks(NULL) < deadline) {
         RUN_BACKGROUND_TASKS;
@@ -318,9 +336,6 @@ wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t
 
         switch (result) {
             case CYW43_LINK_UP:
-                memcpy(self->connected_ssid, ssid, ssid_len);
-                self->connected_ssid_len = ssid_len;
-                bindings_cyw43_wifi_enforce_pm();
                 return WIFI_RADIO_ERROR_NONE;
             case CYW43_LINK_FAIL:
                 return WIFI_RADIO_ERROR_CONNECTION_FAIL;
@@ -335,6 +350,53 @@ wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t
     return WIFI_RADIO_ERROR_UNSPECIFIED;
 }
 
+wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, mp_float_t timeout, uint8_t *bssid, size_t bssid_len) {
+    if (!common_hal_wifi_radio_get_enabled(self)) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Wifi is not enabled"));
+    }
+
+    if (ssid_len > 32) {
+        return WIFI_RADIO_ERROR_CONNECTION_FAIL;
+    }
+
+    size_t timeout_ms = timeout <= 0 ? 8000 : (size_t)MICROPY_FLOAT_C_FUN(ceil)(timeout * 1000);
+    uint64_t start = port_get_raw_ticks(NULL);
+    uint64_t deadline = start + timeout_ms;
+
+    if (connection_unchanged(self, ssid, ssid_len)) {
+        return WIFI_RADIO_ERROR_NONE;
+    }
+
+    // disconnect
+    common_hal_wifi_radio_stop_station(self);
+
+    // Without a channel or BSSID, first try to join the access point that
+    // worked last time directly. Give it a short slice of the timeout so that
+    // a full scan can still follow if the access point has gone away.
+    wifi_radio_error_t error = WIFI_RADIO_ERROR_UNSPECIFIED;
+    bool fast = channel == 0 && bssid_len == 0 && recall_last_network(ssid, ssid_len);
+    if (fast) {
+        error = connect_station(self, ssid, ssid_len, password, password_len, _last_network.channel, _last_network.bssid,
+            MIN(deadline, port_get_raw_ticks(NULL) + 3000));
+        if (error != WIFI_RADIO_ERROR_NONE && error != WIFI_RADIO_ERROR_AUTH_FAIL && !mp_hal_is_interrupted()) {
+            _last_network.magic = 0;
+            common_hal_wifi_radio_stop_station(self);
+            fast = false;
+        }
+    }
+    if (!fast) {
+        error = connect_station(self, ssid, ssid_len, password, password_len, channel, bssid_len > 0 ? bssid : NULL, deadline);
+    }
+    if (error != WIFI_RADIO_ERROR_NONE) {
+        return error;
+    }
+    remember_last_network(ssid, ssid_len);
+    memcpy(self->connected_ssid, ssid, ssid_len);
+    self->connected_ssid_len = ssid_len;
+    bindings_cyw43_wifi_enforce_pm();
+    return WIFI_RADIO_ERROR_NONE;
+}
+
 bool common_hal_wifi_radio_get_connected(wifi_radio_obj_t *self) {
     return cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA) == CYW43_LINK_UP;
 }
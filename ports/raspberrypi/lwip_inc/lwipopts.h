@@ -98,6 +98,9 @@
 #define LWIP_UDP                    1
 #define LWIP_DNS                    1
 #define LWIP_DNS_SUPPORT_MDNS_QUERIES   1
+// lwIP caches lookups for their TTL. Keep more hosts than the default 4 so that clients
+// reconnecting to a few services don't resolve again each time.
+#define DNS_TABLE_SIZE              8
 #define LWIP_TCP_KEEPALIVE          1
 #define LWIP_NETIF_TX_SINGLE_PBUF   1
 #define DHCP_DOES_ARP_CHECK         0
@@ -17,11 +17,11 @@ CIRCUITPY_HASHLIB_MBEDTLS ?= 1
 CIRCUITPY_IMAGECAPTURE ?= 1
 CIRCUITPY_MAX3421E ?= 0
 CIRCUITPY_MEMORYMAP ?= 1
+CIRCUITPY_STORAGE_MAP_FILE ?= 1
 CIRCUITPY_PWMIO ?= 1
 CIRCUITPY_RGBMATRIX ?= $(CIRCUITPY_DISPLAYIO)
 CIRCUITPY_ROTARYIO ?= 1
 CIRCUITPY_ROTARYIO_SOFTENCODER = 1
-CIRCUITPY_SYNTHIO_MAX_CHANNELS = 24
 CIRCUITPY_USB_HOST ?= 1
 CIRCUITPY_USB_VIDEO ?= 1
 
@@ -49,11 +49,15 @@ CIRCUITPY_AUDIOMIXER ?= 1
 ifeq ($(CHIP_VARIANT),RP2040)
 CIRCUITPY_ALARM ?= 1
 
+CIRCUITPY_FROZEN_NATIVE_ARCH ?= armv6m
+
 # Default PICODVI off because it uses RAM to store code run on the second CPU for RP2040.
 CIRCUITPY_PICODVI ?= 0
 
 CIRCUITPY_TOUCHIO ?= 1
 
+CIRCUITPY_SYNTHIO_MAX_CHANNELS ?= 24
+
 # delay in ms before calling cyw43_arch_init_with_country
 CIRCUITPY_CYW43_INIT_DELAY ?= 1000
 endif
@@ -61,6 +65,9 @@ endif
 ifeq ($(CHIP_VARIANT),RP2350)
 # This needs to be implemented.
 CIRCUITPY_ALARM = 0
+
+# Cortex-M33 with a single-precision FPU runs ARMv7E-M code.
+CIRCUITPY_FROZEN_NATIVE_ARCH ?= armv7emsp
 # Default PICODVI on because it doesn't require much code in RAM to talk to HSTX.
 CIRCUITPY_PICODVI ?= 1
 
@@ -69,6 +76,9 @@ CIRCUITPY_CYW43_INIT_DELAY ?= 0
 
 # Audio effects
 CIRCUITPY_AUDIOEFFECTS ?= 1
+
+# Enough polyphony for pads; each voice costs about 30 bytes per Synthesizer.
+CIRCUITPY_SYNTHIO_MAX_CHANNELS ?= 32
 endif
 
 INTERNAL_LIBM = 1
@@ -21,6 +21,7 @@
 
 #include "audio_dma.h"
 #include "supervisor/flash.h"
+#include "supervisor/shared/offload.h"
 #include "supervisor/usb.h"
 
 #ifdef PICO_RP2350
@@ -45,6 +46,8 @@ static uint32_t _audio_channel_mask;
 #endif
 
 void supervisor_flash_pre_write(void) {
+    // Offloaded work may run from flash, so let it finish. Core 1 then waits in RAM.
+    supervisor_offload_wait_all();
     // Disable interrupts. XIP accesses will fault during flash writes.
     common_hal_mcu_disable_interrupts();
     #if CIRCUITPY_AUDIOCORE
@@ -117,6 +120,11 @@ mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block, uint32_t n
     return 0;
 }
 
+const void *supervisor_flash_get_block_address(uint32_t block) {
+    port_internal_flash_flush();
+    return (const void *)(XIP_BASE + CIRCUITPY_CIRCUITPY_DRIVE_START_ADDR + block * FILESYSTEM_BLOCK_SIZE);
+}
+
 mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t lba, uint32_t num_blocks) {
     uint32_t blocks_per_sector = SECTOR_SIZE / FILESYSTEM_BLOCK_SIZE;
     uint32_t block = 0;
@@ -31,6 +31,14 @@
 #include "common-hal/wifi/__init__.h"
 #endif
 
+#if CIRCUITPY_USB_HOST
+#include "shared-bindings/usb_host/Port.h"
+#endif
+
+#if CIRCUITPY_PICODVI
+#include "common-hal/picodvi/Framebuffer.h"
+#endif
+
 #include "common-hal/rtc/RTC.h"
 #include "common-hal/busio/UART.h"
 
@@ -51,6 +59,7 @@
 #include "pico/binary_info.h"
 
 #include "pico/bootrom.h"
+#include "pico/multicore.h"
 #include "hardware/watchdog.h"
 
 #ifdef PICO_RP2350
@@ -263,6 +272,12 @@ void port_heap_init(void) {
 }
 
 void *port_malloc(size_t size, bool dma_capable) {
+    #if CIRCUITPY_PORT_HEAP_POOLS
+    void *pooled = port_heap_pool_malloc(size);
+    if (pooled != NULL) {
+        return pooled;
+    }
+    #endif
     if (!dma_capable && _psram_size > 0) {
         void *block = tlsf_malloc(_psram_heap, size);
         if (block) {
@@ -273,7 +288,16 @@ void *port_malloc(size_t size, bool dma_capable) {
     return block;
 }
 
+void *port_malloc_fast(size_t size) {
+    return tlsf_malloc(_heap, size);
+}
+
 void port_free(void *ptr) {
+    #if CIRCUITPY_PORT_HEAP_POOLS
+    if (port_heap_pool_free(ptr)) {
+        return;
+    }
+    #endif
     if (((size_t)ptr) < SRAM_BASE) {
         tlsf_free(_psram_heap, ptr);
     } else {
@@ -282,6 +306,11 @@ void port_free(void *ptr) {
 }
 
 void *port_realloc(void *ptr, size_t size, bool dma_capable) {
+    #if CIRCUITPY_PORT_HEAP_POOLS
+    if (port_heap_pool_realloc(&ptr, size, dma_capable)) {
+        return ptr;
+    }
+    #endif
     if (_psram_size > 0 && ((ptr != NULL && ((size_t)ptr) < SRAM_BASE) || (ptr == NULL && !dma_capable))) {
         void *block = tlsf_realloc(_psram_heap, ptr, size);
         if (block) {
@@ -310,6 +339,23 @@ size_t port_heap_get_largest_free_size(void) {
     return max_size;
 }
 
+static bool free_size_walker(void *ptr, size_t size, int used, void *user) {
+    size_t *free_size = (size_t *)user;
+    if (!used) {
+        *free_size += size;
+    }
+    return true;
+}
+
+size_t port_heap_get_free_size(void) {
+    size_t free_size = 0;
+    tlsf_walk_pool(tlsf_get_pool(_heap), free_size_walker, &free_size);
+    if (_psram_heap != NULL) {
+        tlsf_walk_pool(tlsf_get_pool(_psram_heap), free_size_walker, &free_size);
+    }
+    return free_size;
+}
+
 safe_mode_t port_init(void) {
     _binary_info();
     // Set brown out.
@@ -590,6 +636,53 @@ void port_yield() {
     #endif
 }
 
+#if CIRCUITPY_USB_HOST
+extern usb_host_port_obj_t usb_host_instance;
+#endif
+#if CIRCUITPY_PICODVI && defined(PICO_RP2040)
+extern picodvi_framebuffer_obj_t *active_picodvi;
+#endif
+
+static void (*_offload_core_main)(void);
+
+static void __not_in_flash_func(offload_core1_main)(void) {
+    _offload_core_main();
+    // Wait here until port_offload_stop() resets the core.
+    while (true) {
+        __wfe();
+    }
+}
+
+bool port_offload_start(void (*core_main)(void)) {
+    // usb_host and, on the RP2040, picodvi run on core 1 too.
+    #if CIRCUITPY_USB_HOST
+    if (usb_host_instance.dp != NULL) {
+        return false;
+    }
+    #endif
+    #if CIRCUITPY_PICODVI && defined(PICO_RP2040)
+    if (active_picodvi != NULL) {
+        return false;
+    }
+    #endif
+    _offload_core_main = core_main;
+    multicore_reset_core1();
+    multicore_launch_core1(offload_core1_main);
+    return true;
+}
+
+void port_offload_stop(void) {
+    multicore_reset_core1();
+}
+
+void __not_in_flash_func(port_offload_wake)(void) {
+    __sev();
+}
+
+void __not_in_flash_func(port_offload_idle)(void) {
+    __wfe();
+}
+
 void port_boot_info(void) {
     #if CIRCUITPY_CYW43
     mp_printf(&mp_plat_print, "MAC");
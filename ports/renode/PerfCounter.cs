@@ -0,0 +1,55 @@
+//
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 CircuitPython contributors
+//
+// SPDX-License-Identifier: MIT
+//
+// Lets CircuitPython read how many instructions the emulated CPU has executed
+// so benchmarks can be measured without any timing noise. Reading the low word
+// latches the high word so the 64 bit count can be read in two accesses.
+using Antmicro.Renode.Core;
+using Antmicro.Renode.Logging;
+using Antmicro.Renode.Peripherals.Bus;
+using Antmicro.Renode.Peripherals.CPU;
+
+namespace Antmicro.Renode.Peripherals.Miscellaneous
+{
+    public class PerfCounter : IDoubleWordPeripheral, IKnownSize
+    {
+        public long Size { get { return 0x8; } }
+
+        public PerfCounter(ICPU cpu)
+        {
+            this.cpu = cpu;
+        }
+
+        public virtual uint ReadDoubleWord(long offset)
+        {
+            switch(offset)
+            {
+            case 0x0:
+                latched = cpu.ExecutedInstructions;
+                return (uint)latched;
+            case 0x4:
+                return (uint)(latched >> 32);
+            default:
+                this.LogUnhandledRead(offset);
+                return 0;
+            }
+        }
+
+        public virtual void WriteDoubleWord(long offset, uint value)
+        {
+            this.LogUnhandledWrite(offset, value);
+        }
+
+        public virtual void Reset()
+        {
+            latched = 0;
+        }
+
+        private readonly ICPU cpu;
+        private ulong latched;
+    }
+}
@@ -0,0 +1,50 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 CircuitPython contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "bindings/renode/__init__.h"
+
+//| """Access to the Renode emulator
+//|
+//| The `renode` module is only available on the renode port. Renode's timing is
+//| deterministic, so the counts it gives are exactly the same from run to run."""
+//|
+
+uint64_t common_hal_renode_get_instruction_count(void) {
+    volatile uint32_t *counter = ((volatile uint32_t *)RENODE_PERF_COUNTER_ADDRESS);
+    // Reading the low word latches the high word.
+    uint32_t low = counter[0];
+    uint32_t high = counter[1];
+    return ((uint64_t)high << 32) | low;
+}
+
+//| def instruction_count() -> int:
+//|     """Return the number of instructions the emulated CPU has executed since reset.
+//|     Renode retires one instruction per cycle so this is also the cycle count."""
+//|     ...
+//|
+//|
+static mp_obj_t renode_instruction_count(void) {
+    return mp_obj_new_int_from_ull(common_hal_renode_get_instruction_count());
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(renode_instruction_count_obj, renode_instruction_count);
+
+static const mp_rom_map_elem_t renode_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_renode) },
+    { MP_ROM_QSTR(MP_QSTR_instruction_count), MP_ROM_PTR(&renode_instruction_count_obj) },
+};
+static MP_DEFINE_CONST_DICT(renode_module_globals, renode_module_globals_table);
+
+const mp_obj_module_t renode_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&renode_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_renode, renode_module);
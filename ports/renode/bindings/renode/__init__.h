@@ -0,0 +1,14 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 CircuitPython contributors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdint.h>
+
+// Where PerfCounter.cs is mapped in boards/peripherals.repl.
+#define RENODE_PERF_COUNTER_ADDRESS (0x40002000)
+
+uint64_t common_hal_renode_get_instruction_count(void);
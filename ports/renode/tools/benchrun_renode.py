@@ -0,0 +1,24 @@
+# Appended to each benchmark by run_benchmarks.py in place of
+# tests/perf_bench/benchrun.py. It counts instructions instead of timing.
+def bm_run(N, M):
+    import renode
+
+    # Pick sensible parameters given N, M
+    cur_nm = (0, 0)
+    param = None
+    for nm, p in bm_params.items():
+        if 10 * nm[0] <= 12 * N and nm[1] <= M and nm > cur_nm:
+            cur_nm = nm
+            param = p
+    if param is None:
+        print("@bench", -1, -1, "SKIP: no matching params")
+        return
+
+    run, result = bm_setup(param)
+    # The difference between two back to back reads is the cost of reading.
+    i0 = renode.instruction_count()
+    i1 = renode.instruction_count()
+    run()
+    i2 = renode.instruction_count()
+    norm, out = result()
+    print("@bench", (i2 - i1) - (i1 - i0), norm, out)
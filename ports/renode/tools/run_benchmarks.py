@@ -0,0 +1,140 @@
+# Run tests/perf_bench under Renode and report how many instructions each
+# benchmark's run() executed. Renode retires one instruction per cycle, so the
+# counts are also cycle counts, and they are the same on every run.
+#
+# Build the port first with `make BOARD=renode_cortex_m0plus`, then from
+# ports/renode:
+#
+#   python3 tools/run_benchmarks.py [-N 100] [-M 25] [--output now.json] [--baseline before.json] [tests...]
+#
+# Comparing against a baseline shows the change in instructions per benchmark.
+# Needs renode, mkfs.fat and mtools on the path.
+
+import argparse
+import json
+import pathlib
+import subprocess
+import sys
+import tempfile
+import time
+
+PORT_DIR = pathlib.Path(__file__).resolve().parent.parent
+PERF_BENCH_DIR = PORT_DIR.parent.parent / "tests" / "perf_bench"
+END_OF_CODE = "Code done running."
+
+
+def make_image(path, code):
+    with open(path, "wb") as f:
+        f.truncate(512 * 1024)
+    subprocess.run(
+        ["mkfs.fat", "-n", "CIRCUITPY", "--offset=0", str(path)],
+        check=True,
+        stdout=subprocess.DEVNULL,
+    )
+    code_py = path.with_name("code.py")
+    code_py.write_bytes(code)
+    subprocess.run(["mcopy", "-i", str(path), str(code_py), "::"], check=True)
+
+
+def run_in_renode(args, image, output):
+    commands = "; ".join(
+        (
+            "$elf=@{}".format(args.build / "firmware.elf"),
+            "$image=@{}".format(image),
+            "$output=@{}".format(output),
+            "include @{}".format(PORT_DIR / "bench.resc"),
+            "start",
+        )
+    )
+    renode = subprocess.Popen(
+        [args.renode, "--disable-gui", "--console", "--hide-log", "-e", commands],
+        cwd=PORT_DIR,
+        stdin=subprocess.DEVNULL,
+        stdout=subprocess.DEVNULL,
+        stderr=subprocess.DEVNULL,
+    )
+    deadline = time.monotonic() + args.timeout
+    text = ""
+    try:
+        while time.monotonic() < deadline and renode.poll() is None:
+            time.sleep(0.2)
+            if output.exists():
+                text = output.read_text(errors="replace")
+                if END_OF_CODE in text:
+                    break
+        else:
+            text += "\nTIMEOUT"
+    finally:
+        renode.kill()
+        renode.wait()
+    return text
+
+
+def parse_result(text):
+    for line in text.splitlines():
+        line = line.strip()
+        if line.startswith("@bench "):
+            count, norm, result = line.split(None, 3)[1:]
+            if int(count) < 0:
+                return None, result
+            return int(count), result
+        if line == "SKIP":
+            return None, "SKIP"
+    lines = [line for line in text.splitlines() if line.strip()]
+    return None, "CRASH: " + " | ".join(lines[-3:])
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Count instructions for perf_bench under Renode")
+    parser.add_argument("-N", type=int, default=100, help="CPU speed parameter for bm_params")
+    parser.add_argument("-M", type=int, default=25, help="memory parameter for bm_params")
+    parser.add_argument(
+        "--build",
+        type=pathlib.Path,
+        default=PORT_DIR / "build-renode_cortex_m0plus",
+        help="build directory containing firmware.elf",
+    )
+    parser.add_argument("--renode", default="renode", help="renode executable")
+    parser.add_argument("--timeout", type=float, default=600, help="seconds to wait per test")
+    parser.add_argument("--output", type=pathlib.Path, help="write the counts as JSON")
+    parser.add_argument("--baseline", type=pathlib.Path, help="JSON from an earlier --output")
+    parser.add_argument("tests", nargs="*", type=pathlib.Path)
+    args = parser.parse_args()
+
+    tests = args.tests or sorted(
+        p for p in PERF_BENCH_DIR.glob("*.py") if p.name != "benchrun.py"
+    )
+    baseline = json.loads(args.baseline.read_text()) if args.baseline else {}
+    epilogue = (PORT_DIR / "tools" / "benchrun_renode.py").read_bytes()
+
+    counts = {}
+    failed = False
+    with tempfile.TemporaryDirectory() as tmp:
+        tmp = pathlib.Path(tmp)
+        for test in tests:
+            script = test.read_bytes() + b"\n" + epilogue + b"bm_run(%u, %u)\n" % (args.N, args.M)
+            image = tmp / "circuitpy.img"
+            output = tmp / "uart.txt"
+            output.unlink(missing_ok=True)
+            make_image(image, script)
+            count, result = parse_result(run_in_renode(args, image, output))
+
+            line = "{:<32}".format(test.stem)
+            if count is None:
+                print(line, result)
+                failed |= result.startswith("CRASH")
+                continue
+            counts[test.stem] = count
+            line += " {:>14}".format(count)
+            before = baseline.get(test.stem)
+            if before:
+                line += " {:>+14} {:>+8.2f}%".format(count - before, 100 * (count - before) / before)
+            print(line, result)
+
+    if args.output:
+        args.output.write_text(json.dumps(counts, indent=2, sort_keys=True) + "\n")
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -117,6 +117,12 @@ void common_hal_bleio_connection_set_connection_interval(
     // TODO: Implement this.
 }
 
+// Ask for the 2M PHY, data length extension and the largest MTU
+void common_hal_bleio_connection_request_high_throughput(
+    bleio_connection_internal_t *self) {
+    // TODO: Implement this.
+}
+
 // Do BLE discovery for all services
 mp_obj_tuple_t *common_hal_bleio_connection_discover_remote_services(
     bleio_connection_obj_t *self,
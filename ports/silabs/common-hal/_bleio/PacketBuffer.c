@@ -201,7 +201,7 @@ void _common_hal_bleio_packet_buffer_construct(
 // Init packet buffer
 void common_hal_bleio_packet_buffer_construct(
     bleio_packet_buffer_obj_t *self, bleio_characteristic_obj_t *characteristic,
-    size_t buffer_size, size_t max_packet_size) {
+    size_t buffer_size, size_t max_packet_size, size_t max_queued_packets) {
 
     size_t incoming_buffer_size = 0;
     uint32_t *incoming_buffer = NULL;
@@ -246,27 +246,34 @@ int common_hal_canio_listener_in_waiting(canio_listener_obj_t *self) {
     return *(self->rfr) & CAN_RF0R_FMP0;
 }
 
-mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+// Waits up to the timeout for a message, returning whether there is one.
+static bool wait_for_message(canio_listener_obj_t *self) {
     if (!common_hal_canio_listener_in_waiting(self)) {
         uint64_t deadline = supervisor_ticks_ms64() + self->timeout_ms;
         do {
             if (supervisor_ticks_ms64() > deadline) {
-                return NULL;
+                return false;
             }
             RUN_BACKGROUND_TASKS;
             // Allow user to break out of a timeout with a KeyboardInterrupt.
             if (mp_hal_is_interrupted()) {
-                return NULL;
+                return false;
             }
         } while (!common_hal_canio_listener_in_waiting(self));
     }
+    return true;
+}
+
+bool common_hal_canio_listener_receive_into(canio_listener_obj_t *self, canio_message_obj_t *message, bool wait) {
+    if (wait ? !wait_for_message(self) : !common_hal_canio_listener_in_waiting(self)) {
+        return false;
+    }
 
     uint32_t rir = self->mailbox->RIR;
     uint32_t rdtr = self->mailbox->RDTR;
 
     bool rtr = rir & CAN_RI0R_RTR;
-    canio_message_obj_t *message =
-        mp_obj_malloc(canio_message_obj_t, rtr ? &canio_remote_transmission_request_type : &canio_message_type);
+    message->base.type = rtr ? &canio_remote_transmission_request_type : &canio_message_type;
     message->extended = rir & CAN_RI0R_IDE;
     if (message->extended) {
         message->id = rir >> 3;
@@ -281,7 +288,7 @@ mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
     }
     // Release the mailbox
     SET_BIT(*self->rfr, CAN_RF0R_RFOM0);
-    return message;
+    return true;
 }
 
 void common_hal_canio_listener_deinit(canio_listener_obj_t *self) {
@@ -241,6 +241,22 @@ uint16_t common_hal_pulseio_pulsein_popleft(pulseio_pulsein_obj_t *self) {
     return value;
 }
 
+size_t common_hal_pulseio_pulsein_readinto(pulseio_pulsein_obj_t *self, uint16_t *buffer, size_t len) {
+    stm_peripherals_exti_disable(self->pin->number);
+    size_t count = MIN(len, self->len);
+    size_t start = self->start;
+    for (size_t i = 0; i < count; i++) {
+        buffer[i] = self->buffer[start];
+        if (++start == self->maxlen) {
+            start = 0;
+        }
+    }
+    self->start = start;
+    self->len -= count;
+    stm_peripherals_exti_enable(self->pin->number);
+    return count;
+}
+
 uint16_t common_hal_pulseio_pulsein_get_maxlen(pulseio_pulsein_obj_t *self) {
     return self->maxlen;
 }
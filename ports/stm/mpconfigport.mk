@@ -1,6 +1,9 @@
 LONGINT_IMPL ?= MPZ
 INTERNAL_LIBM ?= 1
 
+# All supported series are Cortex-M4F or Cortex-M7 with an FPU.
+CIRCUITPY_FROZEN_NATIVE_ARCH ?= armv7emsp
+
 ifeq ($(MCU_VARIANT),$(filter $(MCU_VARIANT),STM32F405xx STM32F407xx))
         CIRCUITPY_ALARM = 1
         CIRCUITPY_CANIO = 1
@@ -218,16 +218,50 @@ size_t port_heap_get_largest_free_size(void) {
     return tlsf_fit_size(_heap, max_size);
 }
 
+static bool free_size_walker(void *ptr, size_t size, int used, void *user) {
+    size_t *free_size = (size_t *)user;
+    if (!used) {
+        *free_size += size;
+    }
+    return true;
+}
+
+size_t port_heap_get_free_size(void) {
+    size_t free_size = 0;
+    for (size_t i = 0; i < CIRCUITPY_RAM_DEVICE_COUNT; i++) {
+        if (pools[i]) {
+            tlsf_walk_pool(pools[i], free_size_walker, &free_size);
+        }
+    }
+    return free_size;
+}
+
 void *port_malloc(size_t size, bool dma_capable) {
+    #if CIRCUITPY_PORT_HEAP_POOLS
+    void *pooled = port_heap_pool_malloc(size);
+    if (pooled != NULL) {
+        return pooled;
+    }
+    #endif
     void *block = tlsf_malloc(_heap, size);
     return block;
 }
 
 void port_free(void *ptr) {
+    #if CIRCUITPY_PORT_HEAP_POOLS
+    if (port_heap_pool_free(ptr)) {
+        return;
+    }
+    #endif
     tlsf_free(_heap, ptr);
 }
 
 void *port_realloc(void *ptr, size_t size, bool dma_capable) {
+    #if CIRCUITPY_PORT_HEAP_POOLS
+    if (port_heap_pool_realloc(&ptr, size, dma_capable)) {
+        return ptr;
+    }
+    #endif
     return tlsf_realloc(_heap, ptr, size);
 }
 #endif
@@ -0,0 +1,368 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 CircuitPython contributors
+//
+// SPDX-License-Identifier: MIT
+
+// A display that renders into a framebuffer in RAM and never sends it anywhere.
+// It refreshes the same way framebufferio.FramebufferDisplay does so that Group,
+// TileGrid, vectorio and bitmaptools rendering can be profiled on a workstation.
+
+#include <string.h>
+
+#include "py/mphal.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/displayio/__init__.h"
+#include "shared-bindings/displayio/Group.h"
+#include "shared-module/displayio/area.h"
+
+// Size in bytes of the buffer each dirty area is rendered through, like
+// CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE on boards.
+#ifndef DISPLAYIO_HEADLESS_AREA_BUFFER_SIZE
+#define DISPLAYIO_HEADLESS_AREA_BUFFER_SIZE (512)
+#endif
+
+#define BUFFER_WORDS (DISPLAYIO_HEADLESS_AREA_BUFFER_SIZE / sizeof(uint32_t))
+
+typedef struct {
+    mp_obj_base_t base;
+    displayio_group_t *current_group;
+    displayio_buffer_transform_t transform;
+    displayio_area_t area;
+    _displayio_colorspace_t colorspace;
+    uint8_t *framebuffer;
+    size_t framebuffer_len;
+    size_t row_stride;
+    uint16_t width;
+    uint16_t height;
+    bool full_refresh;
+    // Totals since construction or the last reset_stats().
+    mp_uint_t refresh_count;
+    mp_uint_t refresh_time_us;
+    mp_uint_t pixels_shaded;
+    mp_uint_t bytes_sent;
+} displayio_headlessdisplay_obj_t;
+
+extern const mp_obj_type_t displayio_headlessdisplay_type;
+
+//| class HeadlessDisplay:
+//|     """A display that only exists in RAM, for benchmarking displayio on the unix port.
+//|
+//|     Refreshing renders the dirty areas of `root_group` into a framebuffer the same
+//|     way `framebufferio.FramebufferDisplay` does and keeps count of the work done."""
+//|
+//|     def __init__(self, width: int, height: int, *, color_depth: int = 16, grayscale: bool = False) -> None:
+//|         """Create a HeadlessDisplay.
+//|
+//|         :param int width: The width of the display in pixels
+//|         :param int height: The height of the display in pixels
+//|         :param int color_depth: Bits per pixel: 1, 2, 4, 8, 16, 24 or 32. Depths below 8 are always grayscale.
+//|         :param bool grayscale: True to render 8 bits per pixel as grayscale instead of RGB332"""
+//|         ...
+//|
+static mp_obj_t displayio_headlessdisplay_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_width, ARG_height, ARG_color_depth, ARG_grayscale };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_width, MP_ARG_INT | MP_ARG_REQUIRED, {.u_int = 0} },
+        { MP_QSTR_height, MP_ARG_INT | MP_ARG_REQUIRED, {.u_int = 0} },
+        { MP_QSTR_color_depth, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 16} },
+        { MP_QSTR_grayscale, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t width = mp_arg_validate_int_range(args[ARG_width].u_int, 1, 32767, MP_QSTR_width);
+    mp_int_t height = mp_arg_validate_int_range(args[ARG_height].u_int, 1, 32767, MP_QSTR_height);
+    mp_int_t depth = args[ARG_color_depth].u_int;
+    if (depth != 1 && depth != 2 && depth != 4 && depth != 8 && depth != 16 && depth != 24 && depth != 32) {
+        mp_arg_error_invalid(MP_QSTR_color_depth);
+    }
+
+    displayio_headlessdisplay_obj_t *self = mp_obj_malloc(displayio_headlessdisplay_obj_t, &displayio_headlessdisplay_type);
+    self->width = width;
+    self->height = height;
+    self->colorspace.depth = depth;
+    self->colorspace.grayscale = depth < 8 || args[ARG_grayscale].u_bool;
+    self->colorspace.grayscale_bit = 8 - depth;
+    self->colorspace.pixels_in_byte_share_row = true;
+    self->colorspace.bytes_per_cell = 1;
+    self->colorspace.reverse_pixels_in_byte = false;
+    self->colorspace.reverse_bytes_in_word = false;
+    self->colorspace.dither = false;
+
+    self->transform.x = 0;
+    self->transform.y = 0;
+    self->transform.dx = 1;
+    self->transform.dy = 1;
+    self->transform.scale = 1;
+    self->transform.mirror_x = false;
+    self->transform.mirror_y = false;
+    self->transform.transpose_xy = false;
+
+    self->area.x1 = 0;
+    self->area.y1 = 0;
+    self->area.x2 = width;
+    self->area.y2 = height;
+    self->area.next = NULL;
+
+    // Rows of packed pixels are padded out to a whole byte, which is as far
+    // as clipping rounds dirty areas out.
+    self->row_stride = (width * depth + 7) / 8;
+    self->framebuffer_len = self->row_stride * height;
+    self->framebuffer = m_malloc(self->framebuffer_len);
+    memset(self->framebuffer, 0, self->framebuffer_len);
+    self->full_refresh = true;
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static bool headlessdisplay_clip_area(displayio_headlessdisplay_obj_t *self, const displayio_area_t *area, displayio_area_t *clipped) {
+    if (!displayio_area_compute_overlap(&self->area, area, clipped)) {
+        return false;
+    }
+    if (self->colorspace.depth < 8) {
+        uint8_t pixels_per_byte = 8 / self->colorspace.depth;
+        clipped->x1 -= clipped->x1 % pixels_per_byte;
+        if (clipped->x2 % pixels_per_byte != 0) {
+            clipped->x2 += pixels_per_byte - clipped->x2 % pixels_per_byte;
+        }
+    }
+    return true;
+}
+
+static void headlessdisplay_refresh_area(displayio_headlessdisplay_obj_t *self, const displayio_area_t *area) {
+    displayio_area_t clipped;
+    if (!headlessdisplay_clip_area(self, area, &clipped)) {
+        return;
+    }
+
+    uint8_t depth = self->colorspace.depth;
+    uint16_t width = displayio_area_width(&clipped);
+    uint32_t pixels_per_word = 32 / depth;
+    uint16_t rows_per_buffer = MAX(1, BUFFER_WORDS * pixels_per_word / width);
+    // An area wider than the buffer can't be split by columns, so rows that
+    // don't fit are rendered through a buffer of their own.
+    size_t buffer_words = MAX(BUFFER_WORDS, (width + pixels_per_word - 1) / pixels_per_word);
+    size_t rowsize = width * depth / 8;
+
+    uint32_t buffer[buffer_words];
+    uint32_t mask[buffer_words * pixels_per_word / 32 + 1];
+
+    for (int16_t y = clipped.y1; y < clipped.y2; y += rows_per_buffer) {
+        displayio_area_t chunk = {
+            .x1 = clipped.x1,
+            .y1 = y,
+            .x2 = clipped.x2,
+            .y2 = MIN(y + rows_per_buffer, clipped.y2),
+        };
+        memset(mask, 0, sizeof(mask));
+        memset(buffer, 0, sizeof(buffer));
+        if (self->current_group != NULL) {
+            displayio_group_fill_area(self->current_group, &self->colorspace, &chunk, mask, buffer);
+        }
+
+        uint8_t *dest = self->framebuffer + chunk.y1 * self->row_stride + clipped.x1 * depth / 8;
+        const uint8_t *src = (const uint8_t *)buffer;
+        for (int16_t row = chunk.y1; row < chunk.y2; row++) {
+            memcpy(dest, src, rowsize);
+            dest += self->row_stride;
+            src += rowsize;
+        }
+        self->bytes_sent += rowsize * (chunk.y2 - chunk.y1);
+    }
+    self->pixels_shaded += displayio_area_size(&clipped);
+}
+
+//|     def refresh(self) -> None:
+//|         """Render everything that changed since the last refresh into the framebuffer."""
+//|         ...
+//|
+static mp_obj_t displayio_headlessdisplay_obj_refresh(mp_obj_t self_in) {
+    displayio_headlessdisplay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_uint_t start = mp_hal_ticks_us();
+
+    const displayio_area_t *current_area = NULL;
+    if (self->full_refresh) {
+        current_area = &self->area;
+    } else if (self->current_group != NULL) {
+        current_area = displayio_group_get_refresh_areas(self->current_group, NULL);
+    }
+    while (current_area != NULL) {
+        headlessdisplay_refresh_area(self, current_area);
+        current_area = current_area->next;
+    }
+    if (self->current_group != NULL) {
+        displayio_group_finish_refresh(self->current_group);
+    }
+    self->full_refresh = false;
+
+    self->refresh_count++;
+    self->refresh_time_us += mp_hal_ticks_us() - start;
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(displayio_headlessdisplay_refresh_obj, displayio_headlessdisplay_obj_refresh);
+
+//|     def reset_stats(self) -> None:
+//|         """Set `refresh_count`, `refresh_time`, `pixels_shaded` and `bytes_sent` back to zero."""
+//|         ...
+//|
+static mp_obj_t displayio_headlessdisplay_obj_reset_stats(mp_obj_t self_in) {
+    displayio_headlessdisplay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    self->refresh_count = 0;
+    self->refresh_time_us = 0;
+    self->pixels_shaded = 0;
+    self->bytes_sent = 0;
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(displayio_headlessdisplay_reset_stats_obj, displayio_headlessdisplay_obj_reset_stats);
+
+//|     root_group: Optional[Group]
+//|     """The root group on the display. If the root group is set to ``None``, no output will be shown."""
+//|
+static mp_obj_t displayio_headlessdisplay_obj_get_root_group(mp_obj_t self_in) {
+    displayio_headlessdisplay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->current_group == NULL) {
+        return mp_const_none;
+    }
+    return MP_OBJ_FROM_PTR(self->current_group);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_headlessdisplay_get_root_group_obj, displayio_headlessdisplay_obj_get_root_group);
+
+static mp_obj_t displayio_headlessdisplay_obj_set_root_group(mp_obj_t self_in, mp_obj_t group_in) {
+    displayio_headlessdisplay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    displayio_group_t *group = NULL;
+    if (group_in != mp_const_none) {
+        group = native_group(group_in);
+    }
+    if (group == self->current_group) {
+        return mp_const_none;
+    }
+    if (group != NULL && group->in_group) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Group already used"));
+    }
+    if (self->current_group != NULL) {
+        self->current_group->in_group = false;
+    }
+    if (group != NULL) {
+        displayio_group_update_transform(group, &self->transform);
+        group->in_group = true;
+    }
+    self->current_group = group;
+    self->full_refresh = true;
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(displayio_headlessdisplay_set_root_group_obj, displayio_headlessdisplay_obj_set_root_group);
+
+MP_PROPERTY_GETSET(displayio_headlessdisplay_root_group_obj,
+    (mp_obj_t)&displayio_headlessdisplay_get_root_group_obj,
+    (mp_obj_t)&displayio_headlessdisplay_set_root_group_obj);
+
+//|     width: int
+//|     """Gets the width of the display"""
+//|
+static mp_obj_t displayio_headlessdisplay_obj_get_width(mp_obj_t self_in) {
+    displayio_headlessdisplay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(self->width);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_headlessdisplay_get_width_obj, displayio_headlessdisplay_obj_get_width);
+
+MP_PROPERTY_GETTER(displayio_headlessdisplay_width_obj,
+    (mp_obj_t)&displayio_headlessdisplay_get_width_obj);
+
+//|     height: int
+//|     """Gets the height of the display"""
+//|
+static mp_obj_t displayio_headlessdisplay_obj_get_height(mp_obj_t self_in) {
+    displayio_headlessdisplay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(self->height);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_headlessdisplay_get_height_obj, displayio_headlessdisplay_obj_get_height);
+
+MP_PROPERTY_GETTER(displayio_headlessdisplay_height_obj,
+    (mp_obj_t)&displayio_headlessdisplay_get_height_obj);
+
+//|     refresh_count: int
+//|     """Number of refreshes done"""
+//|
+static mp_obj_t displayio_headlessdisplay_obj_get_refresh_count(mp_obj_t self_in) {
+    displayio_headlessdisplay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(self->refresh_count);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_headlessdisplay_get_refresh_count_obj, displayio_headlessdisplay_obj_get_refresh_count);
+
+MP_PROPERTY_GETTER(displayio_headlessdisplay_refresh_count_obj,
+    (mp_obj_t)&displayio_headlessdisplay_get_refresh_count_obj);
+
+//|     refresh_time: int
+//|     """Microseconds spent refreshing"""
+//|
+static mp_obj_t displayio_headlessdisplay_obj_get_refresh_time(mp_obj_t self_in) {
+    displayio_headlessdisplay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(self->refresh_time_us);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_headlessdisplay_get_refresh_time_obj, displayio_headlessdisplay_obj_get_refresh_time);
+
+MP_PROPERTY_GETTER(displayio_headlessdisplay_refresh_time_obj,
+    (mp_obj_t)&displayio_headlessdisplay_get_refresh_time_obj);
+
+//|     pixels_shaded: int
+//|     """Number of pixels rendered, counting the padding of dirty areas out to whole bytes"""
+//|
+static mp_obj_t displayio_headlessdisplay_obj_get_pixels_shaded(mp_obj_t self_in) {
+    displayio_headlessdisplay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(self->pixels_shaded);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_headlessdisplay_get_pixels_shaded_obj, displayio_headlessdisplay_obj_get_pixels_shaded);
+
+MP_PROPERTY_GETTER(displayio_headlessdisplay_pixels_shaded_obj,
+    (mp_obj_t)&displayio_headlessdisplay_get_pixels_shaded_obj);
+
+//|     bytes_sent: int
+//|     """Number of bytes written to the framebuffer, which a bus display would have had to send"""
+//|
+static mp_obj_t displayio_headlessdisplay_obj_get_bytes_sent(mp_obj_t self_in) {
+    displayio_headlessdisplay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(self->bytes_sent);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_headlessdisplay_get_bytes_sent_obj, displayio_headlessdisplay_obj_get_bytes_sent);
+
+MP_PROPERTY_GETTER(displayio_headlessdisplay_bytes_sent_obj,
+    (mp_obj_t)&displayio_headlessdisplay_get_bytes_sent_obj);
+
+//|     framebuffer: memoryview
+//|     """The rendered pixels, row by row. Pixels smaller than a byte are packed most significant first."""
+//|
+static mp_obj_t displayio_headlessdisplay_obj_get_framebuffer(mp_obj_t self_in) {
+    displayio_headlessdisplay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_memoryview('B', self->framebuffer_len, self->framebuffer);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_headlessdisplay_get_framebuffer_obj, displayio_headlessdisplay_obj_get_framebuffer);
+
+MP_PROPERTY_GETTER(displayio_headlessdisplay_framebuffer_obj,
+    (mp_obj_t)&displayio_headlessdisplay_get_framebuffer_obj);
+
+static const mp_rom_map_elem_t displayio_headlessdisplay_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_refresh), MP_ROM_PTR(&displayio_headlessdisplay_refresh_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reset_stats), MP_ROM_PTR(&displayio_headlessdisplay_reset_stats_obj) },
+
+    { MP_ROM_QSTR(MP_QSTR_root_group), MP_ROM_PTR(&displayio_headlessdisplay_root_group_obj) },
+    { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&displayio_headlessdisplay_width_obj) },
+    { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&displayio_headlessdisplay_height_obj) },
+    { MP_ROM_QSTR(MP_QSTR_framebuffer), MP_ROM_PTR(&displayio_headlessdisplay_framebuffer_obj) },
+
+    { MP_ROM_QSTR(MP_QSTR_refresh_count), MP_ROM_PTR(&displayio_headlessdisplay_refresh_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_refresh_time), MP_ROM_PTR(&displayio_headlessdisplay_refresh_time_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pixels_shaded), MP_ROM_PTR(&displayio_headlessdisplay_pixels_shaded_obj) },
+    { MP_ROM_QSTR(MP_QSTR_bytes_sent), MP_ROM_PTR(&displayio_headlessdisplay_bytes_sent_obj) },
+};
+static MP_DEFINE_CONST_DICT(displayio_headlessdisplay_locals_dict, displayio_headlessdisplay_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    displayio_headlessdisplay_type,
+    MP_QSTR_HeadlessDisplay,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, displayio_headlessdisplay_make_new,
+    locals_dict, &displayio_headlessdisplay_locals_dict
+    );
@@ -0,0 +1,26 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 CircuitPython contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/gnss/NMEAParser.h"
+#include "shared-bindings/gnss/PositionFix.h"
+
+// The parts of gnss that don't need GNSS hardware.
+static const mp_rom_map_elem_t gnss_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_gnss) },
+    { MP_ROM_QSTR(MP_QSTR_NMEAParser), MP_ROM_PTR(&gnss_nmeaparser_type) },
+    { MP_ROM_QSTR(MP_QSTR_PositionFix), MP_ROM_PTR(&gnss_positionfix_type) },
+};
+static MP_DEFINE_CONST_DICT(gnss_module_globals, gnss_module_globals_table);
+
+const mp_obj_module_t gnss_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&gnss_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_gnss, gnss_module);
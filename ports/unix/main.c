@@ -547,6 +547,13 @@ MP_NOINLINE int main_(int argc, char **argv) {
         if (i == 0) {
             gc_init(heaps[i], heaps[i] + multi_heap_size);
         } else {
+            #if MICROPY_GC_FAST_AREA_MAX_BLOCKS
+            // Use the last heap as the fast area for small allocations.
+            if (i == MICROPY_GC_SPLIT_HEAP_N_HEAPS - 1) {
+                gc_add_fast_area(heaps[i], heaps[i] + multi_heap_size);
+                continue;
+            }
+            #endif
             gc_add(heaps[i], heaps[i] + multi_heap_size);
         }
     }
@@ -72,6 +72,42 @@ static void sighandler(int signum) {
 }
 #endif
 
+// CIRCUITPY-CHANGE: drive the sampling profiler from the CPU-time timer
+#if MICROPY_PY_MICROPYTHON_PROFILE && !defined(_WIN32)
+#include <sys/time.h>
+#include "py/profile.h"
+
+static void prof_sighandler(int signum) {
+    (void)signum;
+    #if MICROPY_PY_THREAD
+    // the signal may arrive on a thread that isn't running Python code
+    if (mp_thread_get_state() == NULL) {
+        return;
+    }
+    #endif
+    mp_prof_sample();
+}
+
+void mp_prof_sample_timer(bool enable) {
+    struct itimerval timer = { { 0, 0 }, { 0, 0 } };
+    struct sigaction sa;
+    sa.sa_flags = SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    if (enable) {
+        sa.sa_handler = prof_sighandler;
+        sigaction(SIGPROF, &sa, NULL);
+        timer.it_interval.tv_usec = 1000;
+        timer.it_value.tv_usec = 1000;
+        setitimer(ITIMER_PROF, &timer, NULL);
+    } else {
+        setitimer(ITIMER_PROF, &timer, NULL);
+        // ignore rather than restore the default, which would terminate on a late signal
+        sa.sa_handler = SIG_IGN;
+        sigaction(SIGPROF, &sa, NULL);
+    }
+}
+#endif
+
 // CIRCUITPY-CHANGE: mp_hal_set_interrupt_char(int) instead of char
 void mp_hal_set_interrupt_char(int c) {
     // configure terminal settings to (not) let ctrl-C through
@@ -36,14 +36,23 @@
 // Enable testing of split heap.
 #define MICROPY_GC_SPLIT_HEAP          (1)
 #define MICROPY_GC_SPLIT_HEAP_N_HEAPS  (4)
+#define MICROPY_GC_FAST_AREA_MAX_BLOCKS (2)
 
 // Enable additional features.
 #define MICROPY_DEBUG_PARSE_RULE_NAME  (1)
 #define MICROPY_TRACKED_ALLOC          (1)
 #define MICROPY_WARNINGS_CATEGORY      (1)
 
+// CIRCUITPY-CHANGE: cache compiled modules in __pycache__ directories. Only in
+// this variant, because it writes a __pycache__ next to every imported module.
+#define MICROPY_PERSISTENT_CODE_SAVE   (1)
+#define MICROPY_MODULE_PYCACHE         (1)
+
 // CIRCUITPY-CHANGE: Disable things never used in circuitpython
 #define MICROPY_PY_CRYPTOLIB          (0)
 #define MICROPY_PY_CRYPTOLIB_CTR      (0)
 // CircuitPython uses shared-bindings struct
 #define MICROPY_PY_STRUCT              (0)
+
+// CIRCUITPY-CHANGE: displayio.OnDiskBitmap reads from files on a FAT filesystem
+#define mp_type_fileio mp_type_vfs_fat_fileio
@@ -26,12 +26,17 @@ $(BUILD)/lib/tjpgd/src/tjpgd.o: CFLAGS += -Wno-shadow -Wno-cast-align
 
 SRC_BITMAP := \
 	shared/runtime/context_manager_helpers.c \
+	displayio_headless.c \
 	displayio_min.c \
+	gnss_min.c \
 	shared-bindings/__future__/__init__.c \
 	shared-bindings/aesio/aes.c \
 	shared-bindings/aesio/__init__.c \
+	shared-bindings/arrayops/__init__.c \
 	shared-bindings/audiocore/__init__.c \
 	shared-bindings/audiocore/RawSample.c \
+	shared-bindings/audiocore/Resampler.c \
+	shared-bindings/audiocore/SpectrumAnalyzer.c \
 	shared-bindings/audiocore/WaveFile.c \
 	shared-bindings/audiodelays/Echo.c \
 	shared-bindings/audiodelays/Chorus.c \
@@ -40,6 +45,8 @@ SRC_BITMAP := \
 	shared-bindings/audiofilters/Distortion.c \
 	shared-bindings/audiofilters/Filter.c \
 	shared-bindings/audiofilters/__init__.c \
+	shared-bindings/audiofx/Chain.c \
+	shared-bindings/audiofx/__init__.c \
 	shared-bindings/audiomixer/__init__.c \
 	shared-bindings/audiomixer/Mixer.c \
 	shared-bindings/audiomixer/MixerVoice.c \
@@ -47,16 +54,25 @@ SRC_BITMAP := \
 	shared-bindings/audiomp3/MP3Decoder.c \
 	shared-bindings/bitmapfilter/__init__.c \
 	shared-bindings/bitmaptools/__init__.c \
+	shared-bindings/bitops/__init__.c \
 	shared-bindings/codeop/__init__.c \
 	shared-bindings/displayio/Bitmap.c \
 	shared-bindings/displayio/ColorConverter.c \
+	shared-bindings/displayio/Group.c \
+	shared-bindings/displayio/OnDiskBitmap.c \
 	shared-bindings/displayio/Palette.c \
+	shared-bindings/displayio/TileGrid.c \
 	shared-bindings/floppyio/__init__.c \
+	shared-bindings/gnss/NMEAParser.c \
+	shared-bindings/gnss/PositionFix.c \
 	shared-bindings/jpegio/__init__.c \
 	shared-bindings/jpegio/JpegDecoder.c \
 	shared-bindings/locale/__init__.c \
+	shared-bindings/msgpack/__init__.c \
+	shared-bindings/msgpack/ExtType.c \
 	shared-bindings/rainbowio/__init__.c \
 	shared-bindings/struct/__init__.c \
+	shared-bindings/struct/Struct.c \
 	shared-bindings/synthio/__init__.c \
 	shared-bindings/synthio/Math.c \
 	shared-bindings/synthio/MidiTrack.c \
@@ -64,6 +80,8 @@ SRC_BITMAP := \
 	shared-bindings/synthio/Note.c \
 	shared-bindings/synthio/Biquad.c \
 	shared-bindings/synthio/Synthesizer.c \
+	shared-bindings/tilepalettemapper/__init__.c \
+	shared-bindings/tilepalettemapper/TilePaletteMapper.c \
 	shared-bindings/traceback/__init__.c \
 	shared-bindings/util.c \
 	shared-bindings/vectorio/Circle.c \
@@ -72,10 +90,14 @@ SRC_BITMAP := \
 	shared-bindings/vectorio/Rectangle.c \
 	shared-bindings/vectorio/VectorShape.c \
 	shared-bindings/zlib/__init__.c \
+	shared-bindings/zlib/DecompIO.c \
 	shared-module/aesio/aes.c \
 	shared-module/aesio/__init__.c \
+	shared-module/arrayops/__init__.c \
 	shared-module/audiocore/__init__.c \
 	shared-module/audiocore/RawSample.c \
+	shared-module/audiocore/Resampler.c \
+	shared-module/audiocore/SpectrumAnalyzer.c \
 	shared-module/audiocore/WaveFile.c \
 	shared-module/audiodelays/Echo.c \
 	shared-module/audiodelays/Chorus.c \
@@ -84,22 +106,31 @@ SRC_BITMAP := \
 	shared-module/audiofilters/Distortion.c \
 	shared-module/audiofilters/Filter.c \
 	shared-module/audiofilters/__init__.c \
+	shared-module/audiofx/Chain.c \
+	shared-module/audiofx/__init__.c \
 	shared-module/audiomixer/__init__.c \
 	shared-module/audiomp3/MP3Decoder.c \
 	shared-module/audiomixer/Mixer.c \
 	shared-module/audiomixer/MixerVoice.c \
 	shared-module/bitmapfilter/__init__.c \
 	shared-module/bitmaptools/__init__.c \
+	shared-module/bitops/__init__.c \
 	shared-module/displayio/area.c \
 	shared-module/displayio/Bitmap.c \
 	shared-module/displayio/ColorConverter.c \
+	shared-module/displayio/Group.c \
+	shared-module/displayio/OnDiskBitmap.c \
 	shared-module/displayio/Palette.c \
+	shared-module/displayio/TileGrid.c \
 	shared-module/floppyio/__init__.c \
+	shared-module/gnss/NMEAParser.c \
 	shared-module/jpegio/__init__.c \
 	shared-module/jpegio/JpegDecoder.c \
+	shared-module/msgpack/__init__.c \
 	shared-module/os/getenv.c \
 	shared-module/rainbowio/__init__.c \
 	shared-module/struct/__init__.c \
+	shared-module/struct/Struct.c \
 	shared-module/synthio/__init__.c \
 	shared-module/synthio/Math.c \
 	shared-module/synthio/MidiTrack.c \
@@ -107,6 +138,7 @@ SRC_BITMAP := \
 	shared-module/synthio/Note.c \
 	shared-module/synthio/Biquad.c \
 	shared-module/synthio/Synthesizer.c \
+	shared-module/tilepalettemapper/TilePaletteMapper.c \
 	shared-bindings/vectorio/Circle.c \
 	shared-module/vectorio/Circle.c \
 	shared-module/vectorio/__init__.c \
@@ -115,6 +147,7 @@ SRC_BITMAP := \
 	shared-module/vectorio/VectorShape.c \
 	shared-module/traceback/__init__.c \
 	shared-module/zlib/__init__.c \
+	shared-module/zlib/DecompIO.c \
 
 SRC_C += $(SRC_BITMAP)
 
@@ -140,10 +173,12 @@ $(BUILD)/lib/mp3/src/buffers.o: CFLAGS += -include "shared-module/audiomp3/__ini
 
 CFLAGS += \
 	-DCIRCUITPY_AESIO=1 \
+	-DCIRCUITPY_ARRAYOPS=1 \
 	-DCIRCUITPY_AUDIOCORE=1 \
 	-DCIRCUITPY_AUDIOEFFECTS=1 \
 	-DCIRCUITPY_AUDIODELAYS=1 \
 	-DCIRCUITPY_AUDIOFILTERS=1 \
+	-DCIRCUITPY_AUDIOFX=1 \
 	-DCIRCUITPY_AUDIOMIXER=1 \
 	-DCIRCUITPY_AUDIOMP3=1 \
 	-DCIRCUITPY_AUDIOCORE_DEBUG=1 \
@@ -155,11 +190,13 @@ CFLAGS += \
 	-DCIRCUITPY_GIFIO=1 \
 	-DCIRCUITPY_JPEGIO=1 \
 	-DCIRCUITPY_LOCALE=1 \
+	-DCIRCUITPY_MSGPACK=1 \
 	-DCIRCUITPY_OS_GETENV=1 \
 	-DCIRCUITPY_RAINBOWIO=1 \
 	-DCIRCUITPY_STRUCT=1 \
 	-DCIRCUITPY_SYNTHIO=1 \
 	-DCIRCUITPY_SYNTHIO_MAX_CHANNELS=14 \
+	-DCIRCUITPY_TILEPALETTEMAPPER=1 \
 	-DCIRCUITPY_TRACEBACK=1 \
 	-DCIRCUITPY_VECTORIO=1 \
 	-DCIRCUITPY_ZLIB=1
@@ -82,6 +82,36 @@
 // Return number of collected objects from gc.collect().
 #define MICROPY_PY_GC_COLLECT_RETVAL   (1)
 
+// Track free runs for several allocation size classes in the GC.
+#define MICROPY_GC_FREE_SIZE_CLASSES   (6)
+
+// Provide gc.compact() to move large buffers down the heap.
+#define MICROPY_GC_COMPACT             (1)
+
+// Cache where each global and attribute lookup site last found its name.
+#define MICROPY_OPT_VM_INLINE_CACHE    (1)
+
+// Give large dicts an insertion-ordered layout with a separate hash index.
+#define MICROPY_OPT_MAP_COMPACT        (1)
+
+// Look up const dict tables with perfect hashes generated at build time.
+#define MICROPY_OPT_MAP_PERFECT_HASH   (1)
+
+// Load .mpy files from a memory mapping of the file.
+#define MICROPY_PERSISTENT_CODE_LOAD_IN_PLACE (1)
+
+// Index the qstrs interned at runtime by hash.
+#define MICROPY_OPT_QSTR_INDEX         (1)
+
+// Parse and compile files one top-level statement at a time.
+#define MICROPY_PARSE_STREAMING        (1)
+
+// Fuse self.x and x += 1 style opcode sequences in the bytecode emitter.
+#define MICROPY_BC_FUSED_OPS           (1)
+
+// Provide the micropython.profile_* sampling profiler, driven by SIGPROF.
+#define MICROPY_PY_MICROPYTHON_PROFILE (1)
+
 // Enable detailed error messages and warnings.
 #define MICROPY_ERROR_REPORTING     (MICROPY_ERROR_REPORTING_DETAILED)
 #define MICROPY_WARNINGS               (1)
@@ -1,3 +1,4 @@
 # build interpreter with nan-boxing as object model (object repr D)
 
-MICROPY_FORCE_32BIT = 1
+# CIRCUITPY-CHANGE: can also be built for 64-bit hosts, with MICROPY_FORCE_32BIT=0
+MICROPY_FORCE_32BIT ?= 1
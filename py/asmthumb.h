@@ -78,12 +78,23 @@ static inline bool asm_thumb_allow_armv7m(asm_thumb_t *as) {
            && mp_dynamic_compiler.native_arch <= MP_NATIVE_ARCH_ARMV7EMDP;
 }
 
+// CIRCUITPY-CHANGE
+static inline bool asm_thumb_allow_vfp(asm_thumb_t *as) {
+    return MP_NATIVE_ARCH_ARMV7EMSP <= mp_dynamic_compiler.native_arch
+           && mp_dynamic_compiler.native_arch <= MP_NATIVE_ARCH_ARMV7EMDP;
+}
+
 #else
 
 static inline bool asm_thumb_allow_armv7m(asm_thumb_t *as) {
     return MICROPY_EMIT_THUMB_ARMV7M;
 }
 
+// CIRCUITPY-CHANGE
+static inline bool asm_thumb_allow_vfp(asm_thumb_t *as) {
+    return MICROPY_EMIT_THUMB_VFP;
+}
+
 #endif
 
 static inline void asm_thumb_end_pass(asm_thumb_t *as) {
@@ -318,6 +329,41 @@ static inline void asm_thumb_sxth_rlo_rlo(asm_thumb_t *as, uint rlo_dest, uint r
     asm_thumb_format_11(as, ASM_THUMB_FORMAT_11_SXTH, rlo_dest, rlo_src);
 }
 
+// CIRCUITPY-CHANGE: single-precision VFP instructions, as (hi << 16 | lo)
+
+#define ASM_THUMB_VFP_ADD (0xee300a00)
+#define ASM_THUMB_VFP_SUB (0xee300a40)
+#define ASM_THUMB_VFP_MUL (0xee200a00)
+#define ASM_THUMB_VFP_DIV (0xee800a00)
+#define ASM_THUMB_VFP_NEG (0xeeb10a40)
+#define ASM_THUMB_VFP_CMP (0xeeb40a40)
+#define ASM_THUMB_VFP_CVT_F32_S32 (0xeeb80ac0)
+#define ASM_THUMB_VFP_CVT_F32_U32 (0xeeb80a40)
+#define ASM_THUMB_VFP_CVT_S32_F32 (0xeebd0ac0) // rounds towards zero
+#define ASM_THUMB_VFP_CVT_U32_F32 (0xeebc0ac0) // rounds towards zero
+
+// sd = sn op sm; two operand ops take sn = 0
+static inline void asm_thumb_vfp_op(asm_thumb_t *as, uint32_t op, uint sd, uint sn, uint sm) {
+    asm_thumb_op32(as,
+        (op >> 16) | (sd & 1) << 6 | sn >> 1,
+        (op & 0xffff) | (sd >> 1) << 12 | (sn & 1) << 7 | (sm & 1) << 5 | sm >> 1);
+}
+
+// vmov sd, r_src
+static inline void asm_thumb_vmov_sreg_reg(asm_thumb_t *as, uint sd, uint r_src) {
+    asm_thumb_op32(as, 0xee00 | sd >> 1, 0x0a10 | r_src << 12 | (sd & 1) << 7);
+}
+
+// vmov r_dest, sn
+static inline void asm_thumb_vmov_reg_sreg(asm_thumb_t *as, uint r_dest, uint sn) {
+    asm_thumb_op32(as, 0xee10 | sn >> 1, 0x0a10 | r_dest << 12 | (sn & 1) << 7);
+}
+
+// vmrs APSR_nzcv, fpscr: copy the flags of the last vcmp for a conditional
+static inline void asm_thumb_vmrs_apsr_fpscr(asm_thumb_t *as) {
+    asm_thumb_op32(as, 0xeef1, 0xfa10);
+}
+
 // TODO convert these to above format style
 
 #define ASM_THUMB_OP_MOVW (0xf240)
@@ -329,8 +329,11 @@ void mp_setup_code_state(mp_code_state_t *code_state, size_t n_args, size_t n_kw
     #if MICROPY_STACKLESS
     code_state->prev = NULL;
     #endif
-    #if MICROPY_PY_SYS_SETTRACE
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_SYS_SETTRACE || MICROPY_PY_MICROPYTHON_PROFILE
     code_state->prev_state = NULL;
+    #endif
+    #if MICROPY_PY_SYS_SETTRACE
     code_state->frame = NULL;
     #endif
     mp_setup_code_state_helper(code_state, n_args, n_kw, args);
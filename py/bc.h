@@ -250,8 +250,11 @@ typedef struct _mp_code_state_t {
     #if MICROPY_STACKLESS
     struct _mp_code_state_t *prev;
     #endif
-    #if MICROPY_PY_SYS_SETTRACE
+    // CIRCUITPY-CHANGE: prev_state is also kept for the sampling profiler
+    #if MICROPY_PY_SYS_SETTRACE || MICROPY_PY_MICROPYTHON_PROFILE
     struct _mp_code_state_t *prev_state;
+    #endif
+    #if MICROPY_PY_SYS_SETTRACE
     struct _mp_obj_frame_t *frame;
     #endif
     // Variable-length
@@ -53,9 +53,9 @@
 
 // Load, Store, Delete, Import, Make, Build, Unpack, Call, Jump, Exception, For, sTack, Return, Yield, Op
 #define MP_BC_BASE_RESERVED                 (0x00) // ----------------
-#define MP_BC_BASE_QSTR_O                   (0x10) // LLLLLLSSSDDII---
+#define MP_BC_BASE_QSTR_O                   (0x10) // LLLLLLSSSDDIILLS
 #define MP_BC_BASE_VINT_E                   (0x20) // MMLLLLSSDDBBBBBB
-#define MP_BC_BASE_VINT_O                   (0x30) // UUMMCCCC--------
+#define MP_BC_BASE_VINT_O                   (0x30) // UUMMCCCCB-------
 #define MP_BC_BASE_JUMP_E                   (0x40) // J-JJJJJEEEEF----
 #define MP_BC_BASE_BYTE_O                   (0x50) // LLLLSSDTTTTTEEFF
 #define MP_BC_BASE_BYTE_E                   (0x60) // --BREEEYYI------
@@ -159,4 +159,15 @@
 #define MP_BC_IMPORT_FROM                   (MP_BC_BASE_QSTR_O + 0x0c) // qstr
 #define MP_BC_IMPORT_STAR                   (MP_BC_BASE_BYTE_E + 0x09)
 
+// CIRCUITPY-CHANGE: fused opcodes, emitted only if MICROPY_BC_FUSED_OPS is
+// enabled (or mpy-cross is given -mfused-ops).
+// LOAD_FAST 0 followed by LOAD_ATTR, LOAD_METHOD or STORE_ATTR, ie self.x
+#define MP_BC_LOAD_FAST_0_ATTR              (MP_BC_BASE_QSTR_O + 0x0d) // qstr
+#define MP_BC_LOAD_FAST_0_METHOD            (MP_BC_BASE_QSTR_O + 0x0e) // qstr
+#define MP_BC_STORE_ATTR_FAST_0             (MP_BC_BASE_QSTR_O + 0x0f) // qstr
+// LOAD_FAST n, LOAD_CONST_SMALL_INT k, BINARY_OP op, STORE_FAST n, ie x += 1;
+// the uint is ((k + MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS)
+// * MP_BINARY_OP_NUM_BYTECODE + op) << 4 | n
+#define MP_BC_BINARY_OP_LOCAL_SMALL_INT     (MP_BC_BASE_VINT_O + 0x08) // uint
+
 #endif // MICROPY_INCLUDED_PY_BC0_H
@@ -38,6 +38,11 @@
 #include "py/runtime.h"
 #include "py/builtin.h"
 #include "py/frozenmod.h"
+// CIRCUITPY-CHANGE
+#if MICROPY_MODULE_PYCACHE
+#include "py/stream.h"
+#include "extmod/vfs.h"
+#endif
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
 #define DEBUG_PRINT (1)
@@ -198,6 +203,137 @@ static void do_execute_proto_fun(const mp_module_context_t *context, mp_proto_fu
 }
 #endif
 
+// CIRCUITPY-CHANGE: cache of compiled .py files
+#if MICROPY_MODULE_PYCACHE
+
+// A cached file holds the size and an FNV-1a hash of the contents of the source
+// it was compiled from, as two little-endian 32-bit words, followed by the .mpy
+// data.  The VFS only has the mtime to the second, so it would miss a same-sized
+// rewrite in the same second; hashing the source doesn't.
+#define PYCACHE_STAMP_LEN (8)
+
+// dir/name.py -> dir/__pycache__/name.mpy
+static qstr pycache_path(const char *file_str, size_t len) {
+    const char *base = file_str + len;
+    while (base > file_str && base[-1] != '/') {
+        --base;
+    }
+    vstr_t path;
+    vstr_init(&path, len + 16);
+    vstr_add_strn(&path, file_str, base - file_str);
+    vstr_add_str(&path, "__pycache__/");
+    vstr_add_strn(&path, base, file_str + len - 3 - base);
+    vstr_add_str(&path, ".mpy");
+    qstr cache_qstr = qstr_from_strn(path.buf, path.len);
+    vstr_clear(&path);
+    return cache_qstr;
+}
+
+static void pycache_stamp(qstr file_qstr, byte *stamp) {
+    mp_reader_t reader;
+    mp_reader_new_file(&reader, file_qstr);
+    MP_DEFINE_NLR_JUMP_CALLBACK_FUNCTION_1(ctx, reader.close, reader.data);
+    nlr_push_jump_callback(&ctx.callback, mp_call_function_1_from_nlr_jump_callback);
+    uint32_t size = 0;
+    uint32_t hash = 2166136261;
+    for (mp_uint_t c; (c = reader.readbyte(reader.data)) != MP_READER_EOF;) {
+        hash = (hash ^ c) * 16777619;
+        ++size;
+    }
+    nlr_pop_jump_callback(true);
+    for (size_t i = 0; i < 4; ++i) {
+        stamp[i] = size >> (8 * i);
+        stamp[4 + i] = hash >> (8 * i);
+    }
+}
+
+// Returns true if cm was loaded from a cache file matching stamp.
+static bool pycache_load(qstr cache_qstr, const byte *stamp, mp_compiled_module_t *cm) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_reader_t reader;
+        mp_reader_new_file(&reader, cache_qstr);
+        // Close the reader if reading the stamp raises.  From then on
+        // mp_raw_code_load() closes it, whether it succeeds or raises.
+        MP_DEFINE_NLR_JUMP_CALLBACK_FUNCTION_1(ctx, reader.close, reader.data);
+        nlr_push_jump_callback(&ctx.callback, mp_call_function_1_from_nlr_jump_callback);
+        bool fresh = true;
+        for (size_t i = 0; i < PYCACHE_STAMP_LEN; ++i) {
+            if (reader.readbyte(reader.data) != stamp[i]) {
+                fresh = false;
+            }
+        }
+        nlr_pop_jump_callback(!fresh);
+        if (fresh) {
+            mp_raw_code_load(&reader, cm);
+        }
+        nlr_pop();
+        return fresh;
+    }
+    // No cache file, or one that can't be loaded.
+    return false;
+}
+
+static void pycache_save(qstr cache_qstr, const byte *stamp, mp_compiled_module_t *cm) {
+    mp_obj_t file = MP_OBJ_NULL;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        const char *cache_str = qstr_str(cache_qstr);
+        mp_obj_t dir = mp_obj_new_str(cache_str, strrchr(cache_str, '/') - cache_str);
+        // It may already exist.
+        nlr_buf_t nlr_mkdir;
+        if (nlr_push(&nlr_mkdir) == 0) {
+            mp_vfs_mkdir(dir);
+            nlr_pop();
+        }
+        mp_obj_t args[2] = {
+            MP_OBJ_NEW_QSTR(cache_qstr),
+            MP_OBJ_NEW_QSTR(MP_QSTR_wb),
+        };
+        file = mp_vfs_open(MP_ARRAY_SIZE(args), &args[0], (mp_map_t *)&mp_const_empty_map);
+        mp_print_t print = {MP_OBJ_TO_PTR(file), mp_stream_write_adaptor};
+        // Write the stamp last, so that a partly written file is never used.
+        static const byte no_stamp[PYCACHE_STAMP_LEN] = {0};
+        print.print_strn(print.data, (const char *)no_stamp, PYCACHE_STAMP_LEN);
+        mp_raw_code_save(cm, &print);
+        int errcode;
+        if (mp_stream_seek(file, 0, MP_SEEK_SET, &errcode) == (mp_off_t)-1) {
+            mp_raise_OSError(errcode);
+        }
+        print.print_strn(print.data, (const char *)stamp, PYCACHE_STAMP_LEN);
+        mp_obj_t f = file;
+        file = MP_OBJ_NULL;
+        mp_stream_close(f);
+        nlr_pop();
+    } else if (file != MP_OBJ_NULL) {
+        // Failing to write the cache isn't an error.
+        if (nlr_push(&nlr) == 0) {
+            mp_stream_close(file);
+            nlr_pop();
+        }
+    }
+}
+
+static void do_load_pycache(mp_module_context_t *context, qstr file_qstr) {
+    byte stamp[PYCACHE_STAMP_LEN];
+    pycache_stamp(file_qstr, stamp);
+    qstr cache_qstr = pycache_path(qstr_str(file_qstr), qstr_len(file_qstr));
+
+    mp_compiled_module_t cm;
+    cm.context = context;
+    if (!pycache_load(cache_qstr, stamp, &cm)) {
+        // The cache needs the module as one raw code, so this parses the whole
+        // file even with MICROPY_PARSE_STREAMING.
+        mp_lexer_t *lex = mp_lexer_new_from_file(file_qstr);
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        mp_compile_to_raw_code(&parse_tree, file_qstr, false, &cm);
+        pycache_save(cache_qstr, stamp, &cm);
+    }
+    do_execute_proto_fun(context, cm.rc, file_qstr);
+}
+
+#endif // MICROPY_MODULE_PYCACHE
+
 static void do_load(mp_module_context_t *module_obj, vstr_t *file) {
     #if MICROPY_MODULE_FROZEN || MICROPY_ENABLE_COMPILER || (MICROPY_PERSISTENT_CODE_LOAD && MICROPY_HAS_FILE_READER)
     const char *file_str = vstr_null_terminated_str(file);
@@ -257,6 +393,11 @@ static void do_load(mp_module_context_t *module_obj, vstr_t *file) {
     // If we can compile scripts then load the file and compile and execute it.
     #if MICROPY_ENABLE_COMPILER
     {
+        // CIRCUITPY-CHANGE
+        #if MICROPY_MODULE_PYCACHE
+        do_load_pycache(module_obj, file_qstr);
+        return;
+        #endif
         mp_lexer_t *lex = mp_lexer_new_from_file(file_qstr);
         do_load_from_lexer(module_obj, lex);
         return;
@@ -116,6 +116,9 @@ endif
 ifeq ($(CIRCUITPY_ANALOGIO),1)
 SRC_PATTERNS += analogio/%
 endif
+ifeq ($(CIRCUITPY_ARRAYOPS),1)
+SRC_PATTERNS += arrayops/%
+endif
 ifeq ($(CIRCUITPY_ATEXIT),1)
 SRC_PATTERNS += atexit/%
 endif
@@ -137,6 +140,9 @@ endif
 ifeq ($(CIRCUITPY_AUDIOFILTERS),1)
 SRC_PATTERNS += audiofilters/%
 endif
+ifeq ($(CIRCUITPY_AUDIOFX),1)
+SRC_PATTERNS += audiofx/%
+endif
 ifeq ($(CIRCUITPY_AUDIOMIXER),1)
 SRC_PATTERNS += audiomixer/%
 endif
@@ -330,6 +336,12 @@ endif
 ifeq ($(CIRCUITPY_PWMIO),1)
 SRC_PATTERNS += pwmio/%
 endif
+ifeq ($(CIRCUITPY_LITTLEFS),1)
+SRC_CIRCUITPY_COMMON += lib/littlefs/lfs2.c lib/littlefs/lfs2_util.c
+CFLAGS += -DLFS2_NO_MALLOC -DLFS2_NO_DEBUG -DLFS2_NO_WARN -DLFS2_NO_ERROR -DLFS2_NO_ASSERT
+$(BUILD)/lib/littlefs/lfs2.o: CFLAGS += -Wno-missing-field-initializers
+endif
+
 ifeq ($(CIRCUITPY_QRIO),1)
 SRC_PATTERNS += qrio/%
 endif
@@ -659,8 +671,11 @@ SRC_SHARED_MODULE_ALL = \
 	_stage/__init__.c \
 	aesio/__init__.c \
 	aesio/aes.c \
+	arrayops/__init__.c \
 	atexit/__init__.c \
 	audiocore/RawSample.c \
+	audiocore/Resampler.c \
+	audiocore/SpectrumAnalyzer.c \
 	audiocore/WaveFile.c \
 	audiocore/__init__.c \
 	audiodelays/Echo.c \
@@ -670,6 +685,8 @@ SRC_SHARED_MODULE_ALL = \
 	audiofilters/Distortion.c \
 	audiofilters/Filter.c \
 	audiofilters/__init__.c \
+	audiofx/Chain.c \
+	audiofx/__init__.c \
 	audioio/__init__.c \
 	audiomixer/Mixer.c \
 	audiomixer/MixerVoice.c \
@@ -718,6 +735,7 @@ SRC_SHARED_MODULE_ALL = \
 	gifio/__init__.c \
 	gifio/GifWriter.c \
 	gifio/OnDiskGif.c \
+	gnss/NMEAParser.c \
 	i2cdisplaybus/__init__.c \
 	i2cdisplaybus/I2CDisplayBus.c \
 	imagecapture/ParallelImageCapture.c \
@@ -734,6 +752,7 @@ SRC_SHARED_MODULE_ALL = \
 	keypad/KeyMatrix.c \
 	keypad/ShiftRegisterKeys.c \
 	keypad/Keys.c \
+	keypad/TouchKeys.c \
 	max3421e/__init__.c \
 	max3421e/Max3421E.c \
 	memorymonitor/__init__.c \
@@ -743,6 +762,7 @@ SRC_SHARED_MODULE_ALL = \
 	msgpack/__init__.c \
 	onewireio/__init__.c \
 	onewireio/OneWire.c \
+	os/DirEntry.c \
 	os/__init__.c \
 	paralleldisplaybus/ParallelBus.c \
 	qrio/__init__.c \
@@ -759,6 +779,7 @@ SRC_SHARED_MODULE_ALL = \
 	socket/__init__.c \
 	storage/__init__.c \
 	struct/__init__.c \
+	struct/Struct.c \
 	supervisor/__init__.c \
 	supervisor/StatusBar.c \
 	synthio/Biquad.c \
@@ -778,6 +799,7 @@ SRC_SHARED_MODULE_ALL = \
 	usb/__init__.c \
 	usb/core/__init__.c \
 	usb/core/Device.c \
+	usb/core/EndpointStream.c \
 	usb/util/__init__.c \
 	ustack/__init__.c \
 	vectorio/Circle.c \
@@ -788,6 +810,7 @@ SRC_SHARED_MODULE_ALL = \
 	warnings/__init__.c \
 	watchdog/__init__.c \
 	zlib/__init__.c \
+	zlib/DecompIO.c \
 
 # All possible sources are listed here, and are filtered by SRC_PATTERNS.
 SRC_SHARED_MODULE = $(filter $(SRC_PATTERNS), $(SRC_SHARED_MODULE_ALL))
@@ -930,6 +953,7 @@ endif
 # All possible sources are listed here, and are filtered by SRC_PATTERNS.
 SRC_SHARED_MODULE_INTERNAL = \
 $(filter $(SRC_PATTERNS), \
+	audiobusio/pdm_filter.c \
 	displayio/bus_core.c \
 	displayio/display_core.c \
 	os/getenv.c \
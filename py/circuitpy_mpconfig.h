@@ -43,7 +43,6 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_PY_OS_DUPTERM            (0)
 #define MICROPY_ROM_TEXT_COMPRESSION     (0)
 #define MICROPY_VFS_LFS1                 (0)
-#define MICROPY_VFS_LFS2                 (0)
 
 // Sorted alphabetically for easy finding.
 //
@@ -51,6 +50,7 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_ALLOC_PARSE_CHUNK_INIT   (16)
 // default is 512. Longest path in .py bundle as of June 6th, 2023 is 73 characters.
 #define MICROPY_ALLOC_PATH_MAX           (96)
+#define MICROPY_BC_FUSED_OPS             (CIRCUITPY_BC_FUSED_OPS)
 #define MICROPY_CAN_OVERRIDE_BUILTINS    (1)
 #define MICROPY_COMP_CONST               (1)
 #define MICROPY_COMP_DOUBLE_TUPLE_ASSIGN (1)
@@ -71,6 +71,10 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_FLOAT_HIGH_QUALITY_HASH  (0)
 #define MICROPY_FLOAT_IMPL               (MICROPY_FLOAT_IMPL_FLOAT)
 #define MICROPY_GC_ALLOC_THRESHOLD       (0)
+#define MICROPY_GC_COMPACT               (CIRCUITPY_FULL_BUILD)
+#define MICROPY_GC_FAST_AREA_MAX_BLOCKS  (CIRCUITPY_GC_FAST_AREA_SIZE > 0 ? CIRCUITPY_GC_FAST_AREA_MAX_BLOCKS : 0)
+#define MICROPY_GC_FREE_SIZE_CLASSES     (CIRCUITPY_FULL_BUILD ? 6 : 1)
+#define MICROPY_GC_NO_SCAN               (CIRCUITPY_FULL_BUILD)
 #define MICROPY_GC_SPLIT_HEAP            (1)
 #define MICROPY_GC_SPLIT_HEAP_AUTO       (1)
 #define MP_PLAT_ALLOC_HEAP(size) port_malloc(size, false)
@@ -82,14 +86,25 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_MEM_STATS                (0)
 #define MICROPY_MODULE_BUILTIN_INIT      (1)
 #define MICROPY_MODULE_BUILTIN_SUBPACKAGES (1)
+#define MICROPY_MODULE_PYCACHE           (CIRCUITPY_MODULE_PYCACHE)
 #define MICROPY_NONSTANDARD_TYPECODES    (0)
 #define MICROPY_OPT_COMPUTED_GOTO        (1)
 #define MICROPY_OPT_COMPUTED_GOTO_SAVE_SPACE (CIRCUITPY_COMPUTED_GOTO_SAVE_SPACE)
 #define MICROPY_OPT_LOAD_ATTR_FAST_PATH  (CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH)
+#define MICROPY_OPT_MAP_COMPACT          (CIRCUITPY_OPT_MAP_COMPACT)
 #define MICROPY_OPT_MAP_LOOKUP_CACHE  (CIRCUITPY_OPT_MAP_LOOKUP_CACHE)
+#define MICROPY_OPT_MAP_PERFECT_HASH     (CIRCUITPY_OPT_MAP_PERFECT_HASH)
 #define MICROPY_OPT_MPZ_BITWISE          (0)
+#define MICROPY_OPT_QSTR_INDEX           (CIRCUITPY_OPT_QSTR_INDEX)
 #define MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE (CIRCUITPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE)
+#define MICROPY_OPT_VM_INLINE_CACHE      (CIRCUITPY_OPT_VM_INLINE_CACHE)
+#define MICROPY_PARSE_STREAMING          (CIRCUITPY_PARSE_STREAMING)
 #define MICROPY_PERSISTENT_CODE_LOAD     (1)
+#define MICROPY_PERSISTENT_CODE_LOAD_IN_PLACE (CIRCUITPY_PERSISTENT_CODE_LOAD_IN_PLACE)
+// Saving is needed to write the module cache.
+#if CIRCUITPY_MODULE_PYCACHE
+#define MICROPY_PERSISTENT_CODE_SAVE     (1)
+#endif
 
 #define MICROPY_PY_ARRAY                 (CIRCUITPY_ARRAY)
 #define MICROPY_PY_ARRAY_SLICE_ASSIGN    (1)
@@ -127,8 +142,10 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_PY_IO_IOBASE             (CIRCUITPY_IO_IOBASE)
 // In extmod
 #define MICROPY_PY_JSON                 (CIRCUITPY_JSON)
+#define MICROPY_PY_JSON_SELECT          (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_MATH                  (0)
 #define MICROPY_PY_MICROPYTHON_MEM_INFO  (0)
+#define MICROPY_PY_MICROPYTHON_PROFILE   (CIRCUITPY_MICROPYTHON_PROFILE)
 // Supplanted by shared-bindings/random
 #define MICROPY_PY_RANDOM               (0)
 #define MICROPY_PY_RANDOM_EXTRA_FUNCS   (0)
@@ -170,6 +187,7 @@ extern void common_hal_mcu_enable_interrupts(void);
 
 #define MICROPY_VFS                 (1)
 #define MICROPY_VFS_FAT             (MICROPY_VFS)
+#define MICROPY_VFS_LFS2            (CIRCUITPY_LITTLEFS)
 #define MICROPY_READER_VFS          (MICROPY_VFS)
 
 // type definitions for the specific machine
@@ -243,6 +261,10 @@ typedef long mp_off_t;
 #define MICROPY_PY_BUILTINS_NOTIMPLEMENTED    (CIRCUITPY_FULL_BUILD)
 #endif
 
+#ifndef MICROPY_PY_CLASS_SLOTS
+#define MICROPY_PY_CLASS_SLOTS                (CIRCUITPY_FULL_BUILD)
+#endif
+
 #define MICROPY_PY_BUILTINS_STR_CENTER        (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_BUILTINS_STR_PARTITION     (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_BUILTINS_STR_SPLITLINES    (CIRCUITPY_FULL_BUILD)
@@ -268,6 +290,8 @@ typedef long mp_off_t;
 #define MICROPY_PY_RE_MATCH_GROUPS           (CIRCUITPY_RE)
 #define MICROPY_PY_RE_MATCH_SPAN_START_END   (CIRCUITPY_RE)
 #define MICROPY_PY_RE_SUB                    (CIRCUITPY_RE)
+#define MICROPY_PY_RE_CACHE_SIZE             (CIRCUITPY_RE ? 4 : 0)
+#define MICROPY_PY_RE_PIKEVM                 (CIRCUITPY_RE && CIRCUITPY_FULL_BUILD)
 
 #define CIRCUITPY_MICROPYTHON_ADVANCED        (0)
 
@@ -279,6 +303,16 @@ typedef long mp_off_t;
 #define MICROPY_FATFS_MKFS_FAT32           (CIRCUITPY_FULL_BUILD)
 #endif
 
+// Tell the block device about freed clusters so flash doesn't keep their old data.
+#ifndef MICROPY_FATFS_USE_TRIM
+#define MICROPY_FATFS_USE_TRIM             (1)
+#endif
+
+// storage.map_file() lays files out again in one run of clusters with f_expand.
+#ifndef MICROPY_FATFS_USE_EXPAND
+#define MICROPY_FATFS_USE_EXPAND           (CIRCUITPY_STORAGE_MAP_FILE)
+#endif
+
 // LONGINT_IMPL_xxx are defined in the Makefile.
 //
 #ifdef LONGINT_IMPL_NONE
@@ -360,6 +394,19 @@ typedef long mp_off_t;
 #define CIRCUITPY_CONSOLE_UART_HEXDUMP(...) (void)0
 #endif
 
+// Bytes of console output collected for the USB, console UART and BLE consoles before they are
+// sent, so that they get whole lines instead of each piece print() writes. 0 sends every write
+// straight away.
+#ifndef CIRCUITPY_CONSOLE_BUFFER_SIZE
+#define CIRCUITPY_CONSOLE_BUFFER_SIZE (256)
+#endif
+
+// How long console output waits for a USB host that has the port open but isn't reading before
+// it is dropped. 0 waits for as long as it takes.
+#ifndef CIRCUITPY_CONSOLE_USB_CDC_DROP_MS
+#define CIRCUITPY_CONSOLE_USB_CDC_DROP_MS (0)
+#endif
+
 // These CIRCUITPY_xxx values should all be defined in the *.mk files as being on or off.
 // So if any are not defined in *.mk, they'll throw an error here.
 
@@ -373,11 +420,52 @@ typedef long mp_off_t;
 #define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (128)
 #endif
 
+// Bytes sent to set up each updated window on a bus display. Dirty areas that would cost fewer
+// extra pixels than this to draw together are merged before refreshing.
+#ifndef CIRCUITPY_DISPLAY_AREA_MERGE_BYTES
+#define CIRCUITPY_DISPLAY_AREA_MERGE_BYTES (16)
+#endif
+
+// Most dirty areas a bus display refreshes separately. More get merged into these.
+#ifndef CIRCUITPY_DISPLAY_AREA_MERGE_LIMIT
+#define CIRCUITPY_DISPLAY_AREA_MERGE_LIMIT (8)
+#endif
+
 #else
 #define CIRCUITPY_DISPLAY_LIMIT (0)
 #define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (0)
 #endif
 
+// Number of busio buses that can have an asynchronous transfer in progress at once before
+// starting another one waits for the oldest.
+#ifndef CIRCUITPY_BUSIO_ASYNC_LIMIT
+#define CIRCUITPY_BUSIO_ASYNC_LIMIT (4)
+#endif
+
+// Ticks (1/1024 second) housekeeping background callbacks may use in one run once the first has
+// run. The rest wait for the next run so that they don't hold up the VM.
+#ifndef CIRCUITPY_BACKGROUND_CALLBACK_HOUSEKEEPING_TICKS
+#define CIRCUITPY_BACKGROUND_CALLBACK_HOUSEKEEPING_TICKS (2)
+#endif
+
+// Stop the tick while idle when its users can say when they next need it. See
+// supervisor_enable_tickless().
+#ifndef CIRCUITPY_TICKLESS_IDLE
+#define CIRCUITPY_TICKLESS_IDLE (1)
+#endif
+
+// Most milliseconds select.poll() and asyncio sleep at a time while waiting for an object or a
+// deadline. Not everything that makes a polled object ready wakes the CPU, such as sockets on
+// some ports, so they look again this often.
+#ifndef CIRCUITPY_EVENT_WAIT_MAX_MS
+#define CIRCUITPY_EVENT_WAIT_MAX_MS (10)
+#endif
+
+// Number of background callback functions timed separately. Any more are counted together.
+#ifndef CIRCUITPY_BACKGROUND_CALLBACK_STATS_LEN
+#define CIRCUITPY_BACKGROUND_CALLBACK_STATS_LEN (16)
+#endif
+
 // This is not a top-level module; it's microcontroller.nvm.
 #if CIRCUITPY_NVM
 extern const struct _mp_obj_module_t nvm_module;
@@ -439,6 +527,10 @@ extern const struct _mp_obj_module_t nvm_module;
 void background_callback_run_all(void);
 #define RUN_BACKGROUND_TASKS (background_callback_run_all())
 
+// Idle instead of spinning in mp_event_wait_ms() and mp_event_wait_indefinite().
+void supervisor_event_wait_ms(uint32_t timeout_ms);
+#define MICROPY_INTERNAL_WFE(TIMEOUT_MS) supervisor_event_wait_ms(TIMEOUT_MS)
+
 #define MICROPY_VM_HOOK_LOOP RUN_BACKGROUND_TASKS;
 #define MICROPY_VM_HOOK_RETURN RUN_BACKGROUND_TASKS;
 
@@ -447,6 +539,13 @@ void background_callback_run_all(void);
 #define CIRCUITPY_AUTORELOAD_DELAY_MS 750
 #endif
 
+// Delay after a workflow write that is known to be complete, such as a whole file received over
+// the web or BLE workflow, so that a few files saved together still reload once. USB writes
+// don't say when a file is done, so they wait CIRCUITPY_AUTORELOAD_DELAY_MS.
+#ifndef CIRCUITPY_AUTORELOAD_COMPLETE_DELAY_MS
+#define CIRCUITPY_AUTORELOAD_COMPLETE_DELAY_MS 100
+#endif
+
 #ifndef CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS
 #define CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS 1000
 #endif
@@ -462,6 +561,42 @@ void background_callback_run_all(void);
 #define CIRCUITPY_HEAP_START_SIZE (8 * 1024)
 #endif
 
+// Size of an extra VM heap area that small allocations are placed in first. It
+// comes from the port's fastest RAM, so on boards with PSRAM the most used
+// objects stay in internal SRAM. 0 disables the fast area.
+#ifndef CIRCUITPY_GC_FAST_AREA_SIZE
+#define CIRCUITPY_GC_FAST_AREA_SIZE (0)
+#endif
+
+// Allocations of up to this many GC blocks are small and go to the fast area
+// first. Bulk data such as bitmaps, bytearrays and sample buffers never counts
+// as small.
+#ifndef CIRCUITPY_GC_FAST_AREA_MAX_BLOCKS
+#define CIRCUITPY_GC_FAST_AREA_MAX_BLOCKS (4)
+#endif
+
+// Numbers of fixed size blocks set aside from the port heap at boot, up to 32
+// each. Long running network boards allocate and free these sizes often.
+#ifndef CIRCUITPY_PORT_HEAP_POOL_64_COUNT
+#define CIRCUITPY_PORT_HEAP_POOL_64_COUNT (CIRCUITPY_WIFI ? 16 : 0)
+#endif
+
+#ifndef CIRCUITPY_PORT_HEAP_POOL_512_COUNT
+#define CIRCUITPY_PORT_HEAP_POOL_512_COUNT (CIRCUITPY_WIFI ? 8 : 0)
+#endif
+
+#ifndef CIRCUITPY_PORT_HEAP_POOL_4096_COUNT
+#define CIRCUITPY_PORT_HEAP_POOL_4096_COUNT (CIRCUITPY_WIFI ? 2 : 0)
+#endif
+
+#define CIRCUITPY_PORT_HEAP_POOLS (CIRCUITPY_PORT_HEAP_POOL_64_COUNT + CIRCUITPY_PORT_HEAP_POOL_512_COUNT + CIRCUITPY_PORT_HEAP_POOL_4096_COUNT > 0)
+
+// Rows of an OnDiskBitmap that are read from the file at once. 0 reads each
+// pixel separately.
+#ifndef CIRCUITPY_ONDISKBITMAP_CACHE_ROWS
+#define CIRCUITPY_ONDISKBITMAP_CACHE_ROWS (CIRCUITPY_FULL_BUILD ? 8 : 0)
+#endif
+
 // How much of the c stack we leave to ensure we can process exceptions.
 #ifndef CIRCUITPY_EXCEPTION_STACK_SIZE
 #define CIRCUITPY_EXCEPTION_STACK_SIZE 1024
@@ -549,6 +684,17 @@ void background_callback_run_all(void);
 #define USB_MSC_EP_NUM_IN (0)
 #endif
 
+// How many USB mass storage writes, of up to CFG_TUD_MSC_BUFSIZE bytes each, are accepted from the
+// host before they reach the filesystem. 0 writes each one before the host sends the next.
+#ifndef CIRCUITPY_USB_MSC_WRITE_QUEUE_LENGTH
+#define CIRCUITPY_USB_MSC_WRITE_QUEUE_LENGTH (2)
+#endif
+
+// Read the next CFG_TUD_MSC_BUFSIZE bytes ahead while the host reads a disk sequentially.
+#ifndef CIRCUITPY_USB_MSC_READ_AHEAD
+#define CIRCUITPY_USB_MSC_READ_AHEAD (1)
+#endif
+
 #ifndef USB_HID_EP_NUM_OUT
 #define USB_HID_EP_NUM_OUT (0)
 #endif
@@ -567,6 +713,12 @@ void background_callback_run_all(void);
 #error "CIRCUITPY_USB_HID_MAX_REPORT_IDS_PER_DESCRIPTOR must be at least 1"
 #endif
 
+// How many HID IN reports can wait for the host to poll for them. 0 makes send_report() wait for
+// the host each time.
+#ifndef CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH
+#define CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH (8)
+#endif
+
 #ifndef USB_MIDI_EP_NUM_OUT
 #define USB_MIDI_EP_NUM_OUT (0)
 #endif
@@ -611,6 +763,12 @@ void background_callback_run_all(void);
 #define CIRCUITPY_DIGITALIO_HAVE_INVALID_DRIVE_MODE (0)
 #endif
 
+// How many single blocks each sdcardio.SDCard holds in RAM until it is synced, so that filesystem
+// metadata updates don't end the CMD25 write streams for file data. 0 writes them through.
+#ifndef CIRCUITPY_SDCARDIO_CACHE_BLOCKS
+#define CIRCUITPY_SDCARDIO_CACHE_BLOCKS (4)
+#endif
+
 // Align the internal sector buffer. Useful when it is passed into TinyUSB for
 // loads.
 #ifndef MICROPY_FATFS_WINDOW_ALIGNMENT
@@ -635,6 +793,24 @@ void background_callback_run_all(void);
 #define CIRCUITPY_SAVES_PARTITION_SIZE 0
 #endif
 
+// Bytes of a file the web workflow reads to send, or receives before writing, at a time. A multiple
+// of 512 lets FatFS move whole sectors straight to and from it, and matching the flash erase sector
+// writes each one in one go. 0 uses 64 bytes on the stack.
+#ifndef CIRCUITPY_WEB_WORKFLOW_FILE_BUFFER_SIZE
+#define CIRCUITPY_WEB_WORKFLOW_FILE_BUFFER_SIZE (2048)
+#endif
+
+// HTTP connections the web workflow serves at once, each with about 1 KiB of request state. A
+// browser asks for several files in parallel while it loads the file manager.
+#ifndef CIRCUITPY_WEB_WORKFLOW_CONNECTIONS
+#define CIRCUITPY_WEB_WORKFLOW_CONNECTIONS (3)
+#endif
+
+// Serial output bytes the web workflow collects into one websocket frame. At most 65535.
+#ifndef CIRCUITPY_WEB_WORKFLOW_WEBSOCKET_BUFFER_SIZE
+#define CIRCUITPY_WEB_WORKFLOW_WEBSOCKET_BUFFER_SIZE (512)
+#endif
+
 // Boards that have a boot button connected to a GPIO pin should set
 // CIRCUITPY_BOOT_BUTTON_NO_GPIO to 1.
 #ifndef CIRCUITPY_BOOT_BUTTON_NO_GPIO
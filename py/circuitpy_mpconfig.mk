@@ -107,6 +107,9 @@ CFLAGS += -DCIRCUITPY_ANALOGIO=$(CIRCUITPY_ANALOGIO)
 CIRCUITPY_ARRAY ?= 1
 CFLAGS += -DCIRCUITPY_ARRAY=$(CIRCUITPY_ARRAY)
 
+CIRCUITPY_ARRAYOPS ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_ARRAYOPS=$(CIRCUITPY_ARRAYOPS)
+
 CIRCUITPY_ATEXIT ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_ATEXIT=$(CIRCUITPY_ATEXIT)
 
@@ -146,10 +149,24 @@ CIRCUITPY_AUDIODELAYS ?= $(CIRCUITPY_AUDIOEFFECTS)
 CFLAGS += -DCIRCUITPY_AUDIODELAYS=$(CIRCUITPY_AUDIODELAYS)
 CIRCUITPY_AUDIOFILTERS ?= $(CIRCUITPY_AUDIOEFFECTS)
 CFLAGS += -DCIRCUITPY_AUDIOFILTERS=$(CIRCUITPY_AUDIOFILTERS)
+CIRCUITPY_AUDIOFX ?= $(CIRCUITPY_AUDIOEFFECTS)
+CFLAGS += -DCIRCUITPY_AUDIOFX=$(CIRCUITPY_AUDIOFX)
 
 CIRCUITPY_AURORA_EPAPER ?= 0
 CFLAGS += -DCIRCUITPY_AURORA_EPAPER=$(CIRCUITPY_AURORA_EPAPER)
 
+# Fuse common bytecode sequences (self.x, x += 1) into single opcodes. Frozen
+# modules are compiled to match; .mpy files need mpy-cross -mfused-ops.
+CIRCUITPY_BC_FUSED_OPS ?= 0
+CFLAGS += -DCIRCUITPY_BC_FUSED_OPS=$(CIRCUITPY_BC_FUSED_OPS)
+ifeq ($(CIRCUITPY_BC_FUSED_OPS),1)
+MPY_CROSS_FLAGS += -mfused-ops
+endif
+
+# Count the calls and time of each background callback, for supervisor.background_stats().
+CIRCUITPY_BACKGROUND_CALLBACK_STATS ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_BACKGROUND_CALLBACK_STATS=$(CIRCUITPY_BACKGROUND_CALLBACK_STATS)
+
 CIRCUITPY_BINASCII ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_BINASCII=$(CIRCUITPY_BINASCII)
 
@@ -237,6 +254,13 @@ CFLAGS += -DCIRCUITPY_DISPLAYIO=$(CIRCUITPY_DISPLAYIO)
 CIRCUITPY_BUSDISPLAY ?= $(CIRCUITPY_DISPLAYIO)
 CFLAGS += -DCIRCUITPY_BUSDISPLAY=$(CIRCUITPY_BUSDISPLAY)
 
+# Render the next part of a BusDisplay refresh while the last one is sent over SPI or a
+# ParallelBus. The port must provide common_hal_busio_spi_write_async(); ParallelBus falls back to
+# sending synchronously on ports without a background send. The SPI bus stays locked while
+# rendering, so don't use with an SD card on the display's bus that OnDiskBitmaps are read from.
+CIRCUITPY_BUSDISPLAY_DOUBLE_BUFFER ?= 0
+CFLAGS += -DCIRCUITPY_BUSDISPLAY_DOUBLE_BUFFER=$(CIRCUITPY_BUSDISPLAY_DOUBLE_BUFFER)
+
 CIRCUITPY_FOURWIRE ?= $(CIRCUITPY_DISPLAYIO)
 CFLAGS += -DCIRCUITPY_FOURWIRE=$(CIRCUITPY_FOURWIRE)
 
@@ -256,6 +280,10 @@ CFLAGS += -DCIRCUITPY_PARALLELDISPLAYBUS=$(CIRCUITPY_PARALLELDISPLAYBUS)
 CIRCUITPY_DOTCLOCKFRAMEBUFFER ?= 0
 CFLAGS += -DCIRCUITPY_DOTCLOCKFRAMEBUFFER=$(CIRCUITPY_DOTCLOCKFRAMEBUFFER)
 
+# Per-row dirty tracking and the optional shaded tile cache in displayio.TileGrid
+CIRCUITPY_DISPLAYIO_TILE_CACHE ?= 0
+CFLAGS += -DCIRCUITPY_DISPLAYIO_TILE_CACHE=$(CIRCUITPY_DISPLAYIO_TILE_CACHE)
+
 # bitmapfilter, bitmaptools, and framebufferio rely on displayio and are not on small boards
 CIRCUITPY_BITMAPFILTER ?= $(call enable-if-all,$(CIRCUITPY_FULL_BUILD) $(CIRCUITPY_DISPLAYIO))
 CIRCUITPY_BITMAPTOOLS ?= $(call enable-if-all,$(CIRCUITPY_FULL_BUILD) $(CIRCUITPY_DISPLAYIO))
@@ -273,6 +301,19 @@ CFLAGS += -DCIRCUITPY_DUALBANK=$(CIRCUITPY_DUALBANK)
 CIRCUITPY_ENABLE_MPY_NATIVE ?= 0
 CFLAGS += -DCIRCUITPY_ENABLE_MPY_NATIVE=$(CIRCUITPY_ENABLE_MPY_NATIVE)
 
+# Frozen modules or packages, by top-level name, to compile with the native
+# emitter for CIRCUITPY_FROZEN_NATIVE_ARCH (set by the port) instead of to bytecode.
+CIRCUITPY_FROZEN_NATIVE ?=
+ifneq ($(strip $(CIRCUITPY_FROZEN_NATIVE)),)
+ifneq ($(CIRCUITPY_ENABLE_MPY_NATIVE),1)
+$(error CIRCUITPY_FROZEN_NATIVE needs CIRCUITPY_ENABLE_MPY_NATIVE = 1)
+endif
+ifeq ($(CIRCUITPY_FROZEN_NATIVE_ARCH),)
+$(error CIRCUITPY_FROZEN_NATIVE is not supported on this port)
+endif
+MPY_CROSS_NATIVE_FLAGS += -march=$(CIRCUITPY_FROZEN_NATIVE_ARCH)
+endif
+
 CIRCUITPY_OS_GETENV ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_OS_GETENV=$(CIRCUITPY_OS_GETENV)
 
@@ -368,6 +409,10 @@ CFLAGS += -DCIRCUITPY_KEYPAD_SHIFTREGISTERKEYS=$(CIRCUITPY_KEYPAD_SHIFTREGISTERK
 CIRCUITPY_KEYPAD_DEMUX ?= $(CIRCUITPY_KEYPAD)
 CFLAGS += -DCIRCUITPY_KEYPAD_DEMUX=$(CIRCUITPY_KEYPAD_DEMUX)
 
+# littlefs v2 as storage.VfsLfs2, for filesystems that must survive losing power while written.
+CIRCUITPY_LITTLEFS ?= 0
+CFLAGS += -DCIRCUITPY_LITTLEFS=$(CIRCUITPY_LITTLEFS)
+
 CIRCUITPY_LOCALE ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_LOCALE=$(CIRCUITPY_LOCALE)
 
@@ -386,9 +431,18 @@ CFLAGS += -DCIRCUITPY_MEMORYMONITOR=$(CIRCUITPY_MEMORYMONITOR)
 CIRCUITPY_MICROCONTROLLER ?= 1
 CFLAGS += -DCIRCUITPY_MICROCONTROLLER=$(CIRCUITPY_MICROCONTROLLER)
 
+# micropython.profile_start() etc: sample the running Python functions from the tick.
+CIRCUITPY_MICROPYTHON_PROFILE ?= 0
+CFLAGS += -DCIRCUITPY_MICROPYTHON_PROFILE=$(CIRCUITPY_MICROPYTHON_PROFILE)
+
 CIRCUITPY_MDNS ?= $(CIRCUITPY_WIFI)
 CFLAGS += -DCIRCUITPY_MDNS=$(CIRCUITPY_MDNS)
 
+# Cache compiled .py modules as __pycache__/*.mpy. Only written when code can
+# write to the filesystem, so it is off unless a board asks for it.
+CIRCUITPY_MODULE_PYCACHE ?= 0
+CFLAGS += -DCIRCUITPY_MODULE_PYCACHE=$(CIRCUITPY_MODULE_PYCACHE)
+
 CIRCUITPY_MSGPACK ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_MSGPACK=$(CIRCUITPY_MSGPACK)
 
@@ -404,12 +458,44 @@ CFLAGS += -DCIRCUITPY_ONEWIREIO=$(CIRCUITPY_ONEWIREIO)
 CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH ?= 1
 CFLAGS += -DCIRCUITPY_OPT_LOAD_ATTR_FAST_PATH=$(CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH)
 
+# Insertion-ordered maps with a separate hash index once they reach 17 slots.
+# Costs RAM for the index, so it is off unless a board asks for it.
+CIRCUITPY_OPT_MAP_COMPACT ?= 0
+CFLAGS += -DCIRCUITPY_OPT_MAP_COMPACT=$(CIRCUITPY_OPT_MAP_COMPACT)
+
 CIRCUITPY_OPT_MAP_LOOKUP_CACHE ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_OPT_MAP_LOOKUP_CACHE=$(CIRCUITPY_OPT_MAP_LOOKUP_CACHE)
 
+# Perfect hashes for const dict tables, generated at build time. Costs flash
+# for the hashes, about 2 bytes per key.
+CIRCUITPY_OPT_MAP_PERFECT_HASH ?= 0
+CFLAGS += -DCIRCUITPY_OPT_MAP_PERFECT_HASH=$(CIRCUITPY_OPT_MAP_PERFECT_HASH)
+
+# Hash index over the qstrs interned at runtime. Costs heap alongside each
+# qstr pool, so it is off unless a board asks for it.
+CIRCUITPY_OPT_QSTR_INDEX ?= 0
+CFLAGS += -DCIRCUITPY_OPT_QSTR_INDEX=$(CIRCUITPY_OPT_QSTR_INDEX)
+
+# Per-call-site name lookup caches in the VM. Costs heap for every function
+# that runs, so it is off unless a board asks for it.
+CIRCUITPY_OPT_VM_INLINE_CACHE ?= 0
+CFLAGS += -DCIRCUITPY_OPT_VM_INLINE_CACHE=$(CIRCUITPY_OPT_VM_INLINE_CACHE)
+
 CIRCUITPY_OS ?= 1
 CFLAGS += -DCIRCUITPY_OS=$(CIRCUITPY_OS)
 
+# Parse and compile .py files one top-level statement at a time, so that large
+# files compile on boards with little RAM. Each statement costs a small
+# function object, so it is off unless a board asks for it.
+CIRCUITPY_PARSE_STREAMING ?= 0
+CFLAGS += -DCIRCUITPY_PARSE_STREAMING=$(CIRCUITPY_PARSE_STREAMING)
+
+# Run .mpy bytecode directly from memory-mapped flash when the file is stored
+# contiguously. A running module's file must not be rewritten, so it is off
+# unless a board asks for it.
+CIRCUITPY_PERSISTENT_CODE_LOAD_IN_PLACE ?= 0
+CFLAGS += -DCIRCUITPY_PERSISTENT_CODE_LOAD_IN_PLACE=$(CIRCUITPY_PERSISTENT_CODE_LOAD_IN_PLACE)
+
 CIRCUITPY_PEW ?= 0
 CFLAGS += -DCIRCUITPY_PEW=$(CIRCUITPY_PEW)
 
@@ -504,6 +590,10 @@ CFLAGS += -DCIRCUITPY_SERIAL_BLE=$(CIRCUITPY_SERIAL_BLE)
 CIRCUITPY_SETTABLE_PROCESSOR_FREQUENCY?= 0
 CFLAGS += -DCIRCUITPY_SETTABLE_PROCESSOR_FREQUENCY=$(CIRCUITPY_SETTABLE_PROCESSOR_FREQUENCY)
 
+# Scale the CPU clock down while idle: microcontroller.cpu.idle_frequency
+CIRCUITPY_PROCESSOR_IDLE_FREQUENCY ?= 0
+CFLAGS += -DCIRCUITPY_PROCESSOR_IDLE_FREQUENCY=$(CIRCUITPY_PROCESSOR_IDLE_FREQUENCY)
+
 CIRCUITPY_SHARPDISPLAY ?= $(CIRCUITPY_FRAMEBUFFERIO)
 CFLAGS += -DCIRCUITPY_SHARPDISPLAY=$(CIRCUITPY_SHARPDISPLAY)
 
@@ -540,6 +630,11 @@ CFLAGS += -DCIRCUITPY_STORAGE=$(CIRCUITPY_STORAGE)
 CIRCUITPY_STORAGE_EXTEND ?= $(CIRCUITPY_DUALBANK)
 CFLAGS += -DCIRCUITPY_STORAGE_EXTEND=$(CIRCUITPY_STORAGE_EXTEND)
 
+# storage.map_file(), which reads files on memory-mapped flash in place. Only useful on ports
+# that implement supervisor_flash_get_block_address().
+CIRCUITPY_STORAGE_MAP_FILE ?= 0
+CFLAGS += -DCIRCUITPY_STORAGE_MAP_FILE=$(CIRCUITPY_STORAGE_MAP_FILE)
+
 CIRCUITPY_STRUCT ?= 1
 CFLAGS += -DCIRCUITPY_STRUCT=$(CIRCUITPY_STRUCT)
 
@@ -581,6 +676,10 @@ CFLAGS += -DCIRCUITPY_TOUCHIO_USE_NATIVE=$(CIRCUITPY_TOUCHIO_USE_NATIVE)
 CIRCUITPY_TOUCHIO ?= 1
 CFLAGS += -DCIRCUITPY_TOUCHIO=$(CIRCUITPY_TOUCHIO)
 
+# Defined after CIRCUITPY_TOUCHIO, which it depends on.
+CIRCUITPY_KEYPAD_TOUCHKEYS ?= $(call enable-if-all,$(CIRCUITPY_KEYPAD) $(CIRCUITPY_TOUCHIO))
+CFLAGS += -DCIRCUITPY_KEYPAD_TOUCHKEYS=$(CIRCUITPY_KEYPAD_TOUCHKEYS)
+
 CIRCUITPY_TRACEBACK ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_TRACEBACK=$(CIRCUITPY_TRACEBACK)
 
@@ -761,6 +860,10 @@ $(BUILD)/frozen_mpy: $(FROZEN_MPY_DIRS)
 
 $(BUILD)/manifest.py: $(BUILD)/frozen_mpy | $(TOP)/py/circuitpy_mpconfig.mk mpconfigport.mk boards/$(BOARD)/mpconfigboard.mk
 	$(ECHO) MKMANIFEST $(FROZEN_MPY_DIRS)
-	$(Q)(cd $(BUILD)/frozen_mpy && find * -name \*.py -exec printf 'freeze_as_mpy("frozen_mpy", "%s")\n' {} \; )> $@.tmp && mv -f $@.tmp $@
+	$(Q)(cd $(BUILD)/frozen_mpy && find * -name \*.py | awk -v native="$(CIRCUITPY_FROZEN_NATIVE)" \
+		'BEGIN { n = split(native, m); for (i = 1; i <= n; i++) want[m[i]] = 1 } \
+		{ top = $$0; sub(/[\/.].*/, "", top); \
+		printf "freeze_as_mpy(\"frozen_mpy\", \"%s\"%s)\n", $$0, (top in want) ? ", native=True" : "" }' \
+		)> $@.tmp && mv -f $@.tmp $@
 FROZEN_MANIFEST=$(BUILD)/manifest.py
 endif
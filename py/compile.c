@@ -2119,6 +2119,15 @@ static void compile_test_if_expr(compiler_t *comp, mp_parse_node_struct_t *pns)
     assert(MP_PARSE_NODE_IS_STRUCT_KIND(pns->nodes[1], PN_test_if_else));
     mp_parse_node_struct_t *pns_test_if_else = (mp_parse_node_struct_t *)pns->nodes[1];
 
+    // CIRCUITPY-CHANGE: optimisation: only compile the branch that is taken for a constant condition
+    if (mp_parse_node_is_const_true(pns_test_if_else->nodes[0])) {
+        compile_node(comp, pns->nodes[0]);
+        return;
+    } else if (mp_parse_node_is_const_false(pns_test_if_else->nodes[0])) {
+        compile_node(comp, pns_test_if_else->nodes[1]);
+        return;
+    }
+
     uint l_fail = comp_next_label(comp);
     uint l_end = comp_next_label(comp);
     c_if_cond(comp, pns_test_if_else->nodes[0], false, l_fail); // condition
@@ -3695,4 +3704,46 @@ mp_obj_t mp_compile(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl)
     return mp_make_function_from_proto_fun(cm.rc, cm.context, NULL);
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PARSE_STREAMING
+
+static mp_obj_t compile_run_statements(mp_obj_t funs_in) {
+    size_t n;
+    mp_obj_t *funs;
+    mp_obj_list_get(funs_in, &n, &funs);
+    for (size_t i = 0; i < n; ++i) {
+        mp_call_function_0(funs[i]);
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(compile_run_statements_obj, compile_run_statements);
+
+mp_obj_t mp_compile_file_streaming(mp_lexer_t *lex) {
+    qstr source_file = lex->source_name;
+    mp_parse_stream_t stream;
+    mp_parse_stream_init(&stream, lex);
+
+    // Set exception handler to free the lexer if an exception is raised.
+    MP_DEFINE_NLR_JUMP_CALLBACK_FUNCTION_1(ctx, mp_parse_stream_deinit, &stream);
+    nlr_push_jump_callback(&ctx.callback, mp_call_function_1_from_nlr_jump_callback);
+
+    // Compile each statement as its own module-level function, freeing its
+    // parse tree before the next statement is parsed.  Nothing is run until
+    // the whole file has compiled, so a syntax error anywhere still stops
+    // the file before any of it executes.
+    mp_obj_t funs = mp_obj_new_list(0, NULL);
+    mp_parse_tree_t parse_tree;
+    while (mp_parse_stream_next(&stream, &parse_tree)) {
+        mp_obj_list_append(funs, mp_compile(&parse_tree, source_file, false));
+    }
+
+    // Deregister exception handler and free the lexer.
+    nlr_pop_jump_callback(true);
+
+    // return function that executes the statements in order
+    return mp_obj_new_closure(MP_OBJ_FROM_PTR(&compile_run_statements_obj), 1, &funs);
+}
+
+#endif // MICROPY_PARSE_STREAMING
+
 #endif // MICROPY_ENABLE_COMPILER
@@ -45,6 +45,14 @@ mp_obj_t mp_compile(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl)
 void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl, mp_compiled_module_t *cm);
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PARSE_STREAMING
+// compile a file one top-level statement at a time, which bounds the memory
+// used by the parse tree to that of the largest statement
+// the lexer is freed before it returns, and the returned function runs the file
+mp_obj_t mp_compile_file_streaming(mp_lexer_t *lex);
+#endif
+
 // this is implemented in runtime.c
 mp_obj_t mp_parse_compile_execute(mp_lexer_t *lex, mp_parse_input_kind_t parse_input_kind, mp_obj_dict_t *globals, mp_obj_dict_t *locals);
 
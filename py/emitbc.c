@@ -40,6 +40,16 @@
 
 #define DUMMY_DATA_SIZE (MP_ENCODE_UINT_MAX_BYTES)
 
+// CIRCUITPY-CHANGE: whether to fuse common opcode sequences
+#if MICROPY_DYNAMIC_COMPILER
+#define EMIT_BC_FUSED_OPS (mp_dynamic_compiler.bc_fused_ops)
+#else
+#define EMIT_BC_FUSED_OPS (MICROPY_BC_FUSED_OPS)
+#endif
+
+// Number of single-byte opcodes remembered for fusing.
+#define EMIT_BC_FUSE_WINDOW (3)
+
 struct _emit_t {
     // Accessed as mp_obj_t, so must be aligned as such, and we rely on the
     // memory allocator returning a suitably aligned pointer.
@@ -73,6 +83,13 @@ struct _emit_t {
 
     size_t n_info;
     size_t n_cell;
+
+    // CIRCUITPY-CHANGE: the last single-byte opcodes written back to back,
+    // the first at fuse_offset. Cleared by labels and line number changes,
+    // where the opcodes before can't be merged with the ones after.
+    size_t fuse_offset;
+    byte fuse_ops[EMIT_BC_FUSE_WINDOW];
+    uint8_t fuse_len;
 };
 
 emit_t *emit_bc_new(mp_emit_common_t *emit_common) {
@@ -164,8 +181,43 @@ static void emit_write_bytecode_raw_byte(emit_t *emit, byte b1) {
     c[0] = b1;
 }
 
+// CIRCUITPY-CHANGE
+static void emit_bc_fuse_note(emit_t *emit, byte b1) {
+    if (emit->suppress) {
+        return;
+    }
+    if (emit->fuse_len == 0 || emit->fuse_offset + emit->fuse_len != emit->bytecode_offset) {
+        emit->fuse_offset = emit->bytecode_offset;
+        emit->fuse_len = 0;
+    } else if (emit->fuse_len == EMIT_BC_FUSE_WINDOW) {
+        memmove(emit->fuse_ops, emit->fuse_ops + 1, EMIT_BC_FUSE_WINDOW - 1);
+        emit->fuse_offset += 1;
+        emit->fuse_len -= 1;
+    }
+    emit->fuse_ops[emit->fuse_len++] = b1;
+}
+
+// The last n opcodes written, if they were all single-byte ones that can be
+// fused with the next, else NULL.
+static const byte *emit_bc_fuse_tail(emit_t *emit, size_t n) {
+    if (!EMIT_BC_FUSED_OPS || emit->suppress || emit->fuse_len < n
+        || emit->fuse_offset + emit->fuse_len != emit->bytecode_offset) {
+        return NULL;
+    }
+    return &emit->fuse_ops[emit->fuse_len - n];
+}
+
+// Drop the last n opcodes, whose stack effect has already been accounted
+// for, so that a fused one is written in their place.
+static void emit_bc_fuse_rewind(emit_t *emit, size_t n) {
+    emit->bytecode_offset -= n;
+    emit->fuse_len = 0;
+}
+
 static void emit_write_bytecode_byte(emit_t *emit, int stack_adj, byte b1) {
     mp_emit_bc_adjust_stack_size(emit, stack_adj);
+    // CIRCUITPY-CHANGE
+    emit_bc_fuse_note(emit, b1);
     byte *c = emit_get_cur_to_write_bytecode(emit, 1);
     c[0] = b1;
 }
@@ -290,6 +342,8 @@ void mp_emit_bc_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scope) {
     emit->bytecode_offset = 0;
     emit->code_info_offset = 0;
     emit->overflow = false;
+    // CIRCUITPY-CHANGE
+    emit->fuse_len = 0;
 
     // Write local state size, exception stack size, scope flags and number of arguments
     {
@@ -436,6 +490,8 @@ void mp_emit_bc_set_source_line(emit_t *emit, mp_uint_t source_line) {
         emit_write_code_info_bytes_lines(emit, bytes_to_skip, lines_to_skip);
         emit->last_source_line_offset = emit->bytecode_offset;
         emit->last_source_line = source_line;
+        // CIRCUITPY-CHANGE: the new line starts here
+        emit->fuse_len = 0;
     }
     #else
     (void)emit;
@@ -461,6 +517,8 @@ void mp_emit_bc_label_assign(emit_t *emit, mp_uint_t l) {
 
     // Assign label offset.
     emit->label_offsets[l] = emit->bytecode_offset;
+    // CIRCUITPY-CHANGE: nothing before a jump target is fused with it
+    emit->fuse_len = 0;
 }
 
 void mp_emit_bc_import(emit_t *emit, qstr qst, int kind) {
@@ -527,6 +585,13 @@ void mp_emit_bc_load_global(emit_t *emit, qstr qst, int kind) {
 
 void mp_emit_bc_load_method(emit_t *emit, qstr qst, bool is_super) {
     int stack_adj = 1 - 2 * is_super;
+    // CIRCUITPY-CHANGE
+    const byte *prev = emit_bc_fuse_tail(emit, 1);
+    if (!is_super && prev != NULL && prev[0] == MP_BC_LOAD_FAST_MULTI) {
+        emit_bc_fuse_rewind(emit, 1);
+        emit_write_bytecode_byte_qstr(emit, stack_adj, MP_BC_LOAD_FAST_0_METHOD, qst);
+        return;
+    }
     emit_write_bytecode_byte_qstr(emit, stack_adj, is_super ? MP_BC_LOAD_SUPER_METHOD : MP_BC_LOAD_METHOD, qst);
 }
 
@@ -547,14 +612,20 @@ void mp_emit_bc_subscr(emit_t *emit, int kind) {
 }
 
 void mp_emit_bc_attr(emit_t *emit, qstr qst, int kind) {
+    // CIRCUITPY-CHANGE
+    const byte *prev = emit_bc_fuse_tail(emit, 1);
+    bool fuse = kind != MP_EMIT_ATTR_DELETE && prev != NULL && prev[0] == MP_BC_LOAD_FAST_MULTI;
+    if (fuse) {
+        emit_bc_fuse_rewind(emit, 1);
+    }
     if (kind == MP_EMIT_ATTR_LOAD) {
-        emit_write_bytecode_byte_qstr(emit, 0, MP_BC_LOAD_ATTR, qst);
+        emit_write_bytecode_byte_qstr(emit, 0, fuse ? MP_BC_LOAD_FAST_0_ATTR : MP_BC_LOAD_ATTR, qst);
     } else {
         if (kind == MP_EMIT_ATTR_DELETE) {
             mp_emit_bc_load_null(emit);
             mp_emit_bc_rot_two(emit);
         }
-        emit_write_bytecode_byte_qstr(emit, -2, MP_BC_STORE_ATTR, qst);
+        emit_write_bytecode_byte_qstr(emit, -2, fuse ? MP_BC_STORE_ATTR_FAST_0 : MP_BC_STORE_ATTR, qst);
     }
 }
 
@@ -563,6 +634,20 @@ void mp_emit_bc_store_local(emit_t *emit, qstr qst, mp_uint_t local_num, int kin
     MP_STATIC_ASSERT(MP_BC_STORE_FAST_N + MP_EMIT_IDOP_LOCAL_DEREF == MP_BC_STORE_DEREF);
     (void)qst;
     if (kind == MP_EMIT_IDOP_LOCAL_FAST && local_num <= 15) {
+        // CIRCUITPY-CHANGE: x = x <op> k, for a small k
+        const byte *prev = emit_bc_fuse_tail(emit, 3);
+        if (prev != NULL
+            && prev[0] == MP_BC_LOAD_FAST_MULTI + local_num
+            && prev[1] >= MP_BC_LOAD_CONST_SMALL_INT_MULTI
+            && prev[1] < MP_BC_LOAD_CONST_SMALL_INT_MULTI + MP_BC_LOAD_CONST_SMALL_INT_MULTI_NUM
+            && prev[2] >= MP_BC_BINARY_OP_MULTI
+            && prev[2] < MP_BC_BINARY_OP_MULTI + MP_BC_BINARY_OP_MULTI_NUM) {
+            mp_uint_t arg = (prev[1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI) * MP_BINARY_OP_NUM_BYTECODE
+                + (prev[2] - MP_BC_BINARY_OP_MULTI);
+            emit_bc_fuse_rewind(emit, 3);
+            emit_write_bytecode_byte_uint(emit, -1, MP_BC_BINARY_OP_LOCAL_SMALL_INT, arg << 4 | local_num);
+            return;
+        }
         emit_write_bytecode_byte(emit, -1, MP_BC_STORE_FAST_MULTI + local_num);
     } else {
         emit_write_bytecode_byte_uint(emit, -1, MP_BC_STORE_FAST_N + kind, local_num);
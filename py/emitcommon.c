@@ -25,6 +25,8 @@
  */
 
 #include <assert.h>
+// CIRCUITPY-CHANGE
+#include <math.h>
 
 #include "py/emit.h"
 #include "py/nativeglue.h"
@@ -71,6 +73,13 @@ static bool strictly_equal(mp_obj_t a, mp_obj_t b) {
             }
         }
         return true;
+    // CIRCUITPY-CHANGE: folded float constants can be -0.0, which must not be merged with 0.0
+    #if MICROPY_PY_BUILTINS_FLOAT
+    } else if (a_type == &mp_type_float) {
+        mp_float_t a_f = mp_obj_float_get(a);
+        mp_float_t b_f = mp_obj_float_get(b);
+        return a_f == b_f && !signbit(a_f) == !signbit(b_f);
+    #endif
     } else {
         return mp_obj_equal(a, b);
     }
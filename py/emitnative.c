@@ -225,6 +225,9 @@ typedef enum {
     VTYPE_PTR8 = 0x00 | MP_NATIVE_TYPE_PTR8,
     VTYPE_PTR16 = 0x00 | MP_NATIVE_TYPE_PTR16,
     VTYPE_PTR32 = 0x00 | MP_NATIVE_TYPE_PTR32,
+    // CIRCUITPY-CHANGE: only with a VFP unit, see mp_native_type_from_qstr
+    VTYPE_FLOAT = 0x00 | MP_NATIVE_TYPE_FLOAT,
+    VTYPE_PTRF = 0x00 | MP_NATIVE_TYPE_PTRF,
 
     VTYPE_PTR_NONE = 0x50 | MP_NATIVE_TYPE_PTR,
 
@@ -250,6 +253,11 @@ static qstr vtype_to_qstr(vtype_kind_t vtype) {
             return MP_QSTR_ptr16;
         case VTYPE_PTR32:
             return MP_QSTR_ptr32;
+        // CIRCUITPY-CHANGE
+        case VTYPE_FLOAT:
+            return MP_QSTR_float;
+        case VTYPE_PTRF:
+            return MP_QSTR_ptrf;
         case VTYPE_PTR_NONE:
         default:
             return MP_QSTR_None;
@@ -1576,6 +1584,8 @@ static void emit_native_load_subscr(emit_t *emit) {
                     ASM_LOAD16_REG_REG(emit->as, REG_RET, reg_base); // load from (base+2*index)
                     break;
                 }
+                // CIRCUITPY-CHANGE: ptrf holds the bits of floats
+                case VTYPE_PTRF:
                 case VTYPE_PTR32: {
                     // pointer to 32-bit memory
                     if (index_value != 0) {
@@ -1624,6 +1634,8 @@ static void emit_native_load_subscr(emit_t *emit) {
                     ASM_LOAD16_REG_REG(emit->as, REG_RET, REG_ARG_1); // load from (base+2*index)
                     break;
                 }
+                // CIRCUITPY-CHANGE
+                case VTYPE_PTRF:
                 case VTYPE_PTR32: {
                     // pointer to word-size memory
                     ASM_ADD_REG_REG(emit->as, REG_ARG_1, reg_index); // add index to base
@@ -1638,7 +1650,8 @@ static void emit_native_load_subscr(emit_t *emit) {
                         MP_ERROR_TEXT("can't load from '%q'"), vtype_to_qstr(vtype_base));
             }
         }
-        emit_post_push_reg(emit, VTYPE_INT, REG_RET);
+        // CIRCUITPY-CHANGE
+        emit_post_push_reg(emit, vtype_base == VTYPE_PTRF ? VTYPE_FLOAT : VTYPE_INT, REG_RET);
     }
 }
 
@@ -1725,6 +1738,14 @@ static void emit_native_store_attr(emit_t *emit, qstr qst) {
     emit_post(emit);
 }
 
+// CIRCUITPY-CHANGE: ptrf stores floats, the other pointers store integers
+static bool viper_can_store(vtype_kind_t vtype_base, vtype_kind_t vtype_value) {
+    if (vtype_base == VTYPE_PTRF) {
+        return vtype_value == VTYPE_FLOAT;
+    }
+    return vtype_value == VTYPE_BOOL || vtype_value == VTYPE_INT || vtype_value == VTYPE_UINT;
+}
+
 static void emit_native_store_subscr(emit_t *emit) {
     DEBUG_printf("store_subscr\n");
     // need to compile: base[index] = value
@@ -1766,7 +1787,8 @@ static void emit_native_store_subscr(emit_t *emit) {
             #else
             emit_pre_pop_reg_flexible(emit, &vtype_value, &reg_value, reg_base, reg_index);
             #endif
-            if (vtype_value != VTYPE_BOOL && vtype_value != VTYPE_INT && vtype_value != VTYPE_UINT) {
+            // CIRCUITPY-CHANGE
+            if (!viper_can_store(vtype_base, vtype_value)) {
                 EMIT_NATIVE_VIPER_TYPE_ERROR(emit,
                     MP_ERROR_TEXT("can't store '%q'"), vtype_to_qstr(vtype_value));
             }
@@ -1810,6 +1832,8 @@ static void emit_native_store_subscr(emit_t *emit) {
                     ASM_STORE16_REG_REG(emit->as, reg_value, reg_base); // store value to (base+2*index)
                     break;
                 }
+                // CIRCUITPY-CHANGE
+                case VTYPE_PTRF:
                 case VTYPE_PTR32: {
                     // pointer to 32-bit memory
                     if (index_value != 0) {
@@ -1853,7 +1877,8 @@ static void emit_native_store_subscr(emit_t *emit) {
             #else
             emit_pre_pop_reg_flexible(emit, &vtype_value, &reg_value, REG_ARG_1, reg_index);
             #endif
-            if (vtype_value != VTYPE_BOOL && vtype_value != VTYPE_INT && vtype_value != VTYPE_UINT) {
+            // CIRCUITPY-CHANGE
+            if (!viper_can_store(vtype_base, vtype_value)) {
                 EMIT_NATIVE_VIPER_TYPE_ERROR(emit,
                     MP_ERROR_TEXT("can't store '%q'"), vtype_to_qstr(vtype_value));
             }
@@ -1880,6 +1905,8 @@ static void emit_native_store_subscr(emit_t *emit) {
                     ASM_STORE16_REG_REG(emit->as, reg_value, REG_ARG_1); // store value to (base+2*index)
                     break;
                 }
+                // CIRCUITPY-CHANGE
+                case VTYPE_PTRF:
                 case VTYPE_PTR32: {
                     // pointer to 32-bit memory
                     #if N_ARM
@@ -2288,6 +2315,103 @@ static void emit_native_pop_except_jump(emit_t *emit, mp_uint_t label, bool with
     emit_native_jump(emit, label);
 }
 
+#if N_THUMB
+// CIRCUITPY-CHANGE: viper floats are the raw bits of a single-precision float
+// held in a core register, moved through s0 and s1 for each VFP operation.
+
+static void emit_native_unary_op_float(emit_t *emit, mp_unary_op_t op) {
+    if (op == MP_UNARY_OP_POSITIVE) {
+        // No-operation, just leave the argument on the stack.
+    } else if (op == MP_UNARY_OP_NEGATIVE) {
+        vtype_kind_t vtype;
+        emit_pre_pop_reg(emit, &vtype, REG_ARG_1);
+        asm_thumb_vmov_sreg_reg(emit->as, 0, REG_ARG_1);
+        asm_thumb_vfp_op(emit->as, ASM_THUMB_VFP_NEG, 0, 0, 0);
+        asm_thumb_vmov_reg_sreg(emit->as, REG_ARG_1, 0);
+        emit_post_push_reg(emit, VTYPE_FLOAT, REG_ARG_1);
+    } else {
+        EMIT_NATIVE_VIPER_TYPE_ERROR(emit,
+            MP_ERROR_TEXT("can't do unary op of '%q'"), vtype_to_qstr(VTYPE_FLOAT));
+    }
+}
+
+static void emit_native_binary_op_float(emit_t *emit, mp_binary_op_t op) {
+    // for floats held in registers, inplace and normal ops are equivalent
+    if (MP_BINARY_OP_INPLACE_OR <= op && op <= MP_BINARY_OP_INPLACE_POWER) {
+        op += MP_BINARY_OP_OR - MP_BINARY_OP_INPLACE_OR;
+    }
+
+    vtype_kind_t vtype_lhs, vtype_rhs;
+    emit_pre_pop_reg_reg(emit, &vtype_rhs, REG_ARG_3, &vtype_lhs, REG_ARG_2);
+
+    uint32_t vfp_op = 0;
+    if (op == MP_BINARY_OP_ADD) {
+        vfp_op = ASM_THUMB_VFP_ADD;
+    } else if (op == MP_BINARY_OP_SUBTRACT) {
+        vfp_op = ASM_THUMB_VFP_SUB;
+    } else if (op == MP_BINARY_OP_MULTIPLY) {
+        vfp_op = ASM_THUMB_VFP_MUL;
+    } else if (op == MP_BINARY_OP_TRUE_DIVIDE) {
+        vfp_op = ASM_THUMB_VFP_DIV;
+    }
+
+    if (vfp_op != 0) {
+        asm_thumb_vmov_sreg_reg(emit->as, 0, REG_ARG_2);
+        asm_thumb_vmov_sreg_reg(emit->as, 1, REG_ARG_3);
+        asm_thumb_vfp_op(emit->as, vfp_op, 0, 0, 1);
+        asm_thumb_vmov_reg_sreg(emit->as, REG_ARG_2, 0);
+        emit_post_push_reg(emit, VTYPE_FLOAT, REG_ARG_2);
+    } else if (MP_BINARY_OP_LESS <= op && op <= MP_BINARY_OP_NOT_EQUAL) {
+        // these conditions are false when either argument is NaN, except for !=
+        static const uint16_t ops[6] = {
+            ASM_THUMB_OP_ITE_MI,
+            ASM_THUMB_OP_ITE_GT,
+            ASM_THUMB_OP_ITE_EQ,
+            ASM_THUMB_OP_ITE_LS,
+            ASM_THUMB_OP_ITE_GE,
+            ASM_THUMB_OP_ITE_NE,
+        };
+        need_reg_single(emit, REG_RET, 0);
+        asm_thumb_vmov_sreg_reg(emit->as, 0, REG_ARG_2);
+        asm_thumb_vmov_sreg_reg(emit->as, 1, REG_ARG_3);
+        asm_thumb_vfp_op(emit->as, ASM_THUMB_VFP_CMP, 0, 0, 1);
+        asm_thumb_vmrs_apsr_fpscr(emit->as);
+        asm_thumb_op16(emit->as, ops[op - MP_BINARY_OP_LESS]);
+        asm_thumb_mov_rlo_i8(emit->as, REG_RET, 1);
+        asm_thumb_mov_rlo_i8(emit->as, REG_RET, 0);
+        emit_post_push_reg(emit, VTYPE_BOOL, REG_RET);
+    } else {
+        adjust_stack(emit, 1);
+        EMIT_NATIVE_VIPER_TYPE_ERROR(emit,
+            MP_ERROR_TEXT("binary op %q not implemented"), mp_binary_op_method_name[op]);
+    }
+}
+
+static void emit_native_cast_float(emit_t *emit, vtype_kind_t vtype_cast) {
+    vtype_kind_t vtype;
+    emit_pre_pop_reg(emit, &vtype, REG_ARG_1);
+    emit_pre_pop_discard(emit);
+    if (vtype != vtype_cast) {
+        uint32_t vfp_op;
+        if (vtype_cast == VTYPE_FLOAT && (vtype == VTYPE_BOOL || vtype == VTYPE_INT)) {
+            vfp_op = ASM_THUMB_VFP_CVT_F32_S32;
+        } else if (vtype_cast == VTYPE_FLOAT && vtype == VTYPE_UINT) {
+            vfp_op = ASM_THUMB_VFP_CVT_F32_U32;
+        } else if (vtype == VTYPE_FLOAT && vtype_cast == VTYPE_INT) {
+            vfp_op = ASM_THUMB_VFP_CVT_S32_F32;
+        } else if (vtype == VTYPE_FLOAT && vtype_cast == VTYPE_UINT) {
+            vfp_op = ASM_THUMB_VFP_CVT_U32_F32;
+        } else {
+            mp_raise_NotImplementedError(MP_ERROR_TEXT("casting"));
+        }
+        asm_thumb_vmov_sreg_reg(emit->as, 0, REG_ARG_1);
+        asm_thumb_vfp_op(emit->as, vfp_op, 0, 0, 0);
+        asm_thumb_vmov_reg_sreg(emit->as, REG_ARG_1, 0);
+    }
+    emit_post_push_reg(emit, vtype_cast, REG_ARG_1);
+}
+#endif
+
 static void emit_native_unary_op(emit_t *emit, mp_unary_op_t op) {
     vtype_kind_t vtype = peek_vtype(emit, 0);
     if (vtype == VTYPE_INT || vtype == VTYPE_UINT) {
@@ -2314,6 +2438,11 @@ static void emit_native_unary_op(emit_t *emit, mp_unary_op_t op) {
             EMIT_NATIVE_VIPER_TYPE_ERROR(emit,
                 MP_ERROR_TEXT("'not' not implemented"), mp_binary_op_method_name[op]);
         }
+    // CIRCUITPY-CHANGE
+    #if N_THUMB
+    } else if (vtype == VTYPE_FLOAT) {
+        emit_native_unary_op_float(emit, op);
+    #endif
     } else if (vtype == VTYPE_PYOBJ) {
         emit_pre_pop_reg(emit, &vtype, REG_ARG_2);
         emit_call_with_imm_arg(emit, MP_F_UNARY_OP, op, REG_ARG_1);
@@ -2562,6 +2691,11 @@ static void emit_native_binary_op(emit_t *emit, mp_binary_op_t op) {
             EMIT_NATIVE_VIPER_TYPE_ERROR(emit,
                 MP_ERROR_TEXT("binary op %q not implemented"), mp_binary_op_method_name[op]);
         }
+    // CIRCUITPY-CHANGE
+    #if N_THUMB
+    } else if (vtype_lhs == VTYPE_FLOAT && vtype_rhs == VTYPE_FLOAT) {
+        emit_native_binary_op_float(emit, op);
+    #endif
     } else if (vtype_lhs == VTYPE_PYOBJ && vtype_rhs == VTYPE_PYOBJ) {
         emit_pre_pop_reg_reg(emit, &vtype_rhs, REG_ARG_3, &vtype_lhs, REG_ARG_2);
         bool invert = false;
@@ -2767,9 +2901,22 @@ static void emit_native_call_function(emit_t *emit, mp_uint_t n_positional, mp_u
             case VTYPE_PTR16:
             case VTYPE_PTR32:
             case VTYPE_PTR_NONE:
+                // CIRCUITPY-CHANGE: float(int) converts the value
+                #if N_THUMB
+                if (vtype_cast == VTYPE_FLOAT) {
+                    emit_native_cast_float(emit, vtype_cast);
+                    break;
+                }
+                #endif
                 emit_fold_stack_top(emit, REG_ARG_1);
                 emit_post_top_set_vtype(emit, vtype_cast);
                 break;
+            // CIRCUITPY-CHANGE
+            #if N_THUMB
+            case VTYPE_FLOAT:
+                emit_native_cast_float(emit, vtype_cast);
+                break;
+            #endif
             default:
                 // this can happen when casting a cast: int(int)
                 mp_raise_NotImplementedError(MP_ERROR_TEXT("casting"));
@@ -43,8 +43,21 @@
 #include "shared-module/memorymonitor/__init__.h"
 #endif
 
+#if MICROPY_GC_COMPACT
+#include "py/objarray.h"
+#if CIRCUITPY_DISPLAYIO
+#include "shared-bindings/displayio/Bitmap.h"
+#include "shared-module/displayio/Bitmap.h"
+#endif
+#endif
+
 #if MICROPY_ENABLE_GC
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_FAST_AREA_MAX_BLOCKS && !MICROPY_GC_SPLIT_HEAP
+#error "MICROPY_GC_FAST_AREA_MAX_BLOCKS requires MICROPY_GC_SPLIT_HEAP"
+#endif
+
 #if MICROPY_DEBUG_VERBOSE // print debugging info
 #define DEBUG_PRINT (1)
 #define DEBUG_printf DEBUG_printf
@@ -95,6 +108,13 @@
 #define NEXT_AREA(area) (NULL)
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_FAST_AREA_MAX_BLOCKS
+#define GC_AREA_IS_FAST(area) ((area) == MP_STATE_MEM(gc_fast_area))
+#else
+#define GC_AREA_IS_FAST(area) (false)
+#endif
+
 #define BLOCK_SHIFT(block) (2 * ((block) & (BLOCKS_PER_ATB - 1)))
 #define ATB_GET_KIND(area, block) (((area)->gc_alloc_table_start[(block) / BLOCKS_PER_ATB] >> BLOCK_SHIFT(block)) & 3)
 #define ATB_ANY_TO_FREE(area, block) do { area->gc_alloc_table_start[(block) / BLOCKS_PER_ATB] &= (~(AT_MARK << BLOCK_SHIFT(block))); } while (0)
@@ -123,6 +143,21 @@
 #define FTB_CLEAR(area, block) do { area->gc_finaliser_table_start[(block) / BLOCKS_PER_FTB] &= (~(1 << ((block) & 7))); } while (0)
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_NO_SCAN
+// NTB = no-scan table byte
+// if set, then the corresponding head block holds no heap pointers. Only heads
+// are meaningful: the bit is written by every allocation instead of being
+// cleared when blocks are freed.
+
+#define BLOCKS_PER_NTB (8)
+
+#define NTB_GET(area, block) ((area->gc_no_scan_table_start[(block) / BLOCKS_PER_NTB] >> ((block) & 7)) & 1)
+#define NTB_SET(area, block) do { area->gc_no_scan_table_start[(block) / BLOCKS_PER_NTB] |= (1 << ((block) & 7)); } while (0)
+#define NTB_CLEAR(area, block) do { area->gc_no_scan_table_start[(block) / BLOCKS_PER_NTB] &= (~(1 << ((block) & 7))); } while (0)
+#define NTB_WRITE(area, block, no_scan) do { if (no_scan) { NTB_SET(area, block); } else { NTB_CLEAR(area, block); } } while (0)
+#endif
+
 #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
 #define GC_ENTER() mp_thread_mutex_lock(&MP_STATE_MEM(gc_mutex), 1)
 #define GC_EXIT() mp_thread_mutex_unlock(&MP_STATE_MEM(gc_mutex))
@@ -143,6 +178,55 @@ void __attribute__ ((noinline)) gc_log_change(uint32_t start_block, uint32_t len
 #pragma GCC pop_options
 #endif
 
+// CIRCUITPY-CHANGE: free run hints per size class.
+// Invariant: no run of at least (1 << c) free blocks lies entirely before ATB
+// index gc_last_free_atb_index[c]. Class 0 is the original "last free" index.
+#define GC_MAX_SIZE_CLASS_BLOCKS ((size_t)1 << (MICROPY_GC_FREE_SIZE_CLASSES - 1))
+
+// Largest size class whose run length does not exceed n_blocks.
+static inline size_t gc_size_class(size_t n_blocks) {
+    size_t c = 0;
+    while (c + 1 < MICROPY_GC_FREE_SIZE_CLASSES && ((size_t)2 << c) <= n_blocks) {
+        c++;
+    }
+    return c;
+}
+
+static inline void gc_free_hints_reset(mp_state_mem_area_t *area, size_t atb_index) {
+    for (size_t c = 0; c < MICROPY_GC_FREE_SIZE_CLASSES; c++) {
+        area->gc_last_free_atb_index[c] = atb_index;
+    }
+}
+
+// Blocks were freed starting at the given block: any class may now have a
+// run there, including one that merges with free blocks just before it.
+static void gc_free_hints_lower(mp_state_mem_area_t *area, size_t block) {
+    // A preceding free run at least GC_MAX_SIZE_CLASS_BLOCKS long already
+    // satisfies every class, so there's no need to look further back.
+    for (size_t n = 1; n < GC_MAX_SIZE_CLASS_BLOCKS && block > 0; n++) {
+        if (ATB_GET_KIND(area, block - 1) != AT_FREE) {
+            break;
+        }
+        block--;
+    }
+    size_t atb_index = block / BLOCKS_PER_ATB;
+    for (size_t c = 0; c < MICROPY_GC_FREE_SIZE_CLASSES; c++) {
+        if (atb_index < area->gc_last_free_atb_index[c]) {
+            area->gc_last_free_atb_index[c] = atb_index;
+        }
+    }
+}
+
+// The first run of at least n_blocks at or after the hint for its class ends
+// before atb_index, so classes at least n_blocks long can skip ahead.
+static void gc_free_hints_raise(mp_state_mem_area_t *area, size_t n_blocks, size_t atb_index) {
+    for (size_t c = 0; c < MICROPY_GC_FREE_SIZE_CLASSES; c++) {
+        if (((size_t)1 << c) >= n_blocks && atb_index > area->gc_last_free_atb_index[c]) {
+            area->gc_last_free_atb_index[c] = atb_index;
+        }
+    }
+}
+
 // TODO waste less memory; currently requires that all entries in alloc_table have a corresponding block in pool
 static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     // calculate parameters for GC (T=total, A=alloc table, F=finaliser table, P=pool; all in bytes):
@@ -151,12 +235,18 @@ static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     //     P = A * BLOCKS_PER_ATB * BYTES_PER_BLOCK
     // => T = A * (1 + BLOCKS_PER_ATB / BLOCKS_PER_FTB + BLOCKS_PER_ATB * BYTES_PER_BLOCK)
     size_t total_byte_len = (byte *)end - (byte *)start;
-    #if MICROPY_ENABLE_FINALISER
+    // CIRCUITPY-CHANGE: the no-scan table is sized like the finaliser table
+    #if MICROPY_ENABLE_FINALISER || MICROPY_GC_NO_SCAN
     area->gc_alloc_table_byte_len = (total_byte_len - ALLOC_TABLE_GAP_BYTE)
         * MP_BITS_PER_BYTE
         / (
             MP_BITS_PER_BYTE
+            #if MICROPY_ENABLE_FINALISER
             + MP_BITS_PER_BYTE * BLOCKS_PER_ATB / BLOCKS_PER_FTB
+            #endif
+            #if MICROPY_GC_NO_SCAN
+            + MP_BITS_PER_BYTE * BLOCKS_PER_ATB / BLOCKS_PER_NTB
+            #endif
             + MP_BITS_PER_BYTE * BLOCKS_PER_ATB * BYTES_PER_BLOCK
             );
     #else
@@ -170,6 +260,16 @@ static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     area->gc_finaliser_table_start = area->gc_alloc_table_start + area->gc_alloc_table_byte_len + ALLOC_TABLE_GAP_BYTE;
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_NO_SCAN
+    size_t gc_no_scan_table_byte_len = (area->gc_alloc_table_byte_len * BLOCKS_PER_ATB + BLOCKS_PER_NTB - 1) / BLOCKS_PER_NTB;
+    #if MICROPY_ENABLE_FINALISER
+    area->gc_no_scan_table_start = area->gc_finaliser_table_start + gc_finaliser_table_byte_len;
+    #else
+    area->gc_no_scan_table_start = area->gc_alloc_table_start + area->gc_alloc_table_byte_len + ALLOC_TABLE_GAP_BYTE;
+    #endif
+    #endif
+
     size_t gc_pool_block_len = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
     area->gc_pool_start = (byte *)end - gc_pool_block_len * BYTES_PER_BLOCK;
     area->gc_pool_end = end;
@@ -177,6 +277,10 @@ static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     #if MICROPY_ENABLE_FINALISER
     assert(area->gc_pool_start >= area->gc_finaliser_table_start + gc_finaliser_table_byte_len);
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_NO_SCAN
+    assert(area->gc_pool_start >= area->gc_no_scan_table_start + gc_no_scan_table_byte_len);
+    #endif
 
     #if MICROPY_ENABLE_FINALISER
     // clear ATB's and FTB's
@@ -185,8 +289,13 @@ static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     // clear ATB's
     memset(area->gc_alloc_table_start, 0, area->gc_alloc_table_byte_len + ALLOC_TABLE_GAP_BYTE);
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_NO_SCAN
+    memset(area->gc_no_scan_table_start, 0, gc_no_scan_table_byte_len);
+    #endif
 
-    area->gc_last_free_atb_index = 0;
+    // CIRCUITPY-CHANGE
+    gc_free_hints_reset(area, 0);
     area->gc_last_used_block = 0;
 
     #if MICROPY_GC_SPLIT_HEAP
@@ -204,6 +313,13 @@ static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
         gc_finaliser_table_byte_len,
         gc_finaliser_table_byte_len * BLOCKS_PER_FTB);
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_NO_SCAN
+    DEBUG_printf("  no-scan table at %p, length " UINT_FMT " bytes, "
+        UINT_FMT " blocks\n", area->gc_no_scan_table_start,
+        gc_no_scan_table_byte_len,
+        gc_no_scan_table_byte_len * BLOCKS_PER_NTB);
+    #endif
     DEBUG_printf("  pool at %p, length " UINT_FMT " bytes, "
         UINT_FMT " blocks\n", area->gc_pool_start,
         gc_pool_block_len * BYTES_PER_BLOCK, gc_pool_block_len);
@@ -221,6 +337,11 @@ void gc_init(void *start, void *end) {
     MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_FAST_AREA_MAX_BLOCKS
+    MP_STATE_MEM(gc_fast_area) = NULL;
+    #endif
+
     // unlock the GC
     MP_STATE_THREAD(gc_lock_depth) = 0;
 
@@ -260,6 +381,14 @@ void gc_add(void *start, void *end) {
     prev_area->next = area;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_FAST_AREA_MAX_BLOCKS
+void gc_add_fast_area(void *start, void *end) {
+    gc_add(start, end);
+    MP_STATE_MEM(gc_fast_area) = (mp_state_mem_area_t *)start;
+}
+#endif
+
 #if MICROPY_GC_SPLIT_HEAP_AUTO
 // Try to automatically add a heap area large enough to fulfill 'failed_alloc'.
 static bool gc_try_add_heap(size_t failed_alloc) {
@@ -320,6 +449,10 @@ static bool gc_try_add_heap(size_t failed_alloc) {
         #if MICROPY_ENABLE_FINALISER
         + total_blocks / BLOCKS_PER_FTB
         #endif
+        // CIRCUITPY-CHANGE
+        #if MICROPY_GC_NO_SCAN
+        + total_blocks / BLOCKS_PER_NTB
+        #endif
         + total_blocks * BYTES_PER_BLOCK
         + ALLOC_TABLE_GAP_BYTE
         + sizeof(mp_state_mem_area_t);
@@ -358,6 +491,9 @@ void gc_deinit(void) {
     // any additional heap areas (but not the first.)
     gc_sweep_all();
     memset(&MP_STATE_MEM(area), 0, sizeof(MP_STATE_MEM(area)));
+    #if MICROPY_GC_FAST_AREA_MAX_BLOCKS
+    MP_STATE_MEM(gc_fast_area) = NULL;
+    #endif
 }
 
 void gc_lock(void) {
@@ -388,6 +524,66 @@ bool gc_ptr_on_heap(void *ptr) {
     return false;
 }
 
+// CIRCUITPY-CHANGE: reference counting for gc_compact(). While the table
+// is non-empty, marking counts every word that points into (or just past)
+// a candidate block and remembers where the last such word was.
+#if MICROPY_GC_COMPACT
+typedef struct {
+    mp_state_mem_area_t *area;
+    size_t block;
+    size_t n_blocks;
+    size_t refs;
+    void **ref;
+} gc_compact_candidate_t;
+
+static gc_compact_candidate_t gc_compact_candidates[MICROPY_GC_COMPACT_MAX_CANDIDATES];
+static size_t gc_compact_n_candidates;
+
+static inline byte *gc_compact_start(const gc_compact_candidate_t *c) {
+    return (byte *)PTR_FROM_BLOCK(c->area, c->block);
+}
+
+static inline byte *gc_compact_end(const gc_compact_candidate_t *c) {
+    return gc_compact_start(c) + c->n_blocks * BYTES_PER_BLOCK;
+}
+
+// Index of the last candidate starting at or before ptr, or -1. Candidates
+// are kept in address order.
+static int gc_compact_lookup(const void *ptr) {
+    int lo = 0;
+    int hi = gc_compact_n_candidates;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if ((const byte *)ptr < gc_compact_start(&gc_compact_candidates[mid])) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return lo - 1;
+}
+
+static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_compact_count)(void *ptr, void **ref) {
+    byte *p = ptr;
+    if (p < gc_compact_start(&gc_compact_candidates[0])
+        || p > gc_compact_end(&gc_compact_candidates[gc_compact_n_candidates - 1])) {
+        return;
+    }
+    int i = gc_compact_lookup(p);
+    // A pointer just past the end of one block is also counted for it.
+    for (int j = i; j >= 0 && j >= i - 1; j--) {
+        gc_compact_candidate_t *c = &gc_compact_candidates[j];
+        if (p >= gc_compact_start(c) && p <= gc_compact_end(c)) {
+            c->refs++;
+            c->ref = ref;
+        }
+    }
+}
+#define GC_COMPACT_COUNT(ptr, ref) do { if (gc_compact_n_candidates != 0) { gc_compact_count(ptr, ref); } } while (0)
+#else
+#define GC_COMPACT_COUNT(ptr, ref)
+#endif
+
 #if MICROPY_GC_SPLIT_HEAP
 // Returns the area to which this pointer belongs, or NULL if it isn't
 // allocated on the GC-managed heap.
@@ -420,6 +616,86 @@ static inline mp_state_mem_area_t *gc_get_ptr_area(const void *ptr) {
 #endif
 #endif
 
+// CIRCUITPY-CHANGE: a mark stack borrowed from free heap blocks, in use
+// from the first overflow of gc_block_stack until gc_collect_end. Free
+// blocks aren't read or written by marking, and nothing can be allocated
+// while the GC is locked.
+#if MICROPY_GC_BORROW_STACK
+static struct {
+    MICROPY_GC_STACK_ENTRY_TYPE *block_stack;
+    #if MICROPY_GC_SPLIT_HEAP
+    mp_state_mem_area_t **area_stack;
+    #endif
+    // Number of entries, 0 when nothing is borrowed.
+    size_t len;
+    // Set once the heap had no run of free blocks big enough to help.
+    bool failed;
+} gc_borrowed_stack;
+
+// Move the sp entries of the full gc_block_stack onto the longest run of free
+// blocks. Returns false if there is no run bigger than gc_block_stack.
+static bool gc_borrow_stack(size_t sp) {
+    if (gc_borrowed_stack.len != 0 || gc_borrowed_stack.failed) {
+        return false;
+    }
+    mp_state_mem_area_t *best_area = NULL;
+    size_t best_block = 0;
+    size_t best_len = 0;
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        size_t run = 0;
+        for (size_t block = 0; block < area->gc_alloc_table_byte_len * BLOCKS_PER_ATB; block++) {
+            MICROPY_GC_HOOK_LOOP(block);
+            if (ATB_GET_KIND(area, block) != AT_FREE) {
+                run = 0;
+                continue;
+            }
+            run += 1;
+            if (run > best_len) {
+                best_area = area;
+                best_block = block + 1 - run;
+                best_len = run;
+            }
+        }
+    }
+    #if MICROPY_GC_SPLIT_HEAP
+    const size_t entry_size = sizeof(MICROPY_GC_STACK_ENTRY_TYPE) + sizeof(mp_state_mem_area_t *);
+    #else
+    const size_t entry_size = sizeof(MICROPY_GC_STACK_ENTRY_TYPE);
+    #endif
+    size_t len = best_len * BYTES_PER_BLOCK / entry_size;
+    if (len <= MICROPY_ALLOC_GC_STACK_SIZE) {
+        gc_borrowed_stack.failed = true;
+        return false;
+    }
+    byte *start = (byte *)PTR_FROM_BLOCK(best_area, best_block);
+    #if MICROPY_GC_SPLIT_HEAP
+    // Pointers first, so that both arrays stay aligned.
+    gc_borrowed_stack.area_stack = (mp_state_mem_area_t **)(void *)start;
+    memcpy(gc_borrowed_stack.area_stack, MP_STATE_MEM(gc_area_stack), sp * sizeof(mp_state_mem_area_t *));
+    start += len * sizeof(mp_state_mem_area_t *);
+    #endif
+    gc_borrowed_stack.block_stack = (MICROPY_GC_STACK_ENTRY_TYPE *)(void *)start;
+    memcpy(gc_borrowed_stack.block_stack, MP_STATE_MEM(gc_block_stack), sp * sizeof(MICROPY_GC_STACK_ENTRY_TYPE));
+    gc_borrowed_stack.len = len;
+    return true;
+}
+
+// Give the borrowed blocks back, leaving them as zeroed as they were found
+// when allocations rely on that.
+static void gc_return_stack(void) {
+    #if !MICROPY_GC_CONSERVATIVE_CLEAR
+    if (gc_borrowed_stack.len != 0) {
+        #if MICROPY_GC_SPLIT_HEAP
+        memset(gc_borrowed_stack.area_stack, 0, (byte *)(gc_borrowed_stack.block_stack + gc_borrowed_stack.len) - (byte *)gc_borrowed_stack.area_stack);
+        #else
+        memset(gc_borrowed_stack.block_stack, 0, gc_borrowed_stack.len * sizeof(MICROPY_GC_STACK_ENTRY_TYPE));
+        #endif
+    }
+    #endif
+    memset(&gc_borrowed_stack, 0, sizeof(gc_borrowed_stack));
+}
+#endif
+
 // Take the given block as the topmost block on the stack. Check all it's
 // children: mark the unmarked child blocks and put those newly marked
 // blocks on the stack. When all children have been checked, pop off the
@@ -431,6 +707,22 @@ static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(mp_state_mem_area_t
 static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block)
 #endif
 {
+    // CIRCUITPY-CHANGE: the stack may be the borrowed one
+    MICROPY_GC_STACK_ENTRY_TYPE *block_stack = MP_STATE_MEM(gc_block_stack);
+    #if MICROPY_GC_SPLIT_HEAP
+    mp_state_mem_area_t **area_stack = MP_STATE_MEM(gc_area_stack);
+    #endif
+    size_t stack_len = MICROPY_ALLOC_GC_STACK_SIZE;
+    #if MICROPY_GC_BORROW_STACK
+    if (gc_borrowed_stack.len != 0) {
+        block_stack = gc_borrowed_stack.block_stack;
+        #if MICROPY_GC_SPLIT_HEAP
+        area_stack = gc_borrowed_stack.area_stack;
+        #endif
+        stack_len = gc_borrowed_stack.len;
+    }
+    #endif
+
     // Start with the block passed in the argument.
     size_t sp = 0;
     for (;;) {
@@ -452,6 +744,8 @@ static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block)
         for (size_t i = n_blocks * BYTES_PER_BLOCK / sizeof(void *); i > 0; i--, ptrs++) {
             MICROPY_GC_HOOK_LOOP(i);
             void *ptr = *ptrs;
+            // CIRCUITPY-CHANGE
+            GC_COMPACT_COUNT(ptr, ptrs);
             // If this is a heap pointer that hasn't been marked, mark it and push
             // it's children to the stack.
             #if MICROPY_GC_SPLIT_HEAP
@@ -474,10 +768,29 @@ static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block)
             // An unmarked head. Mark it, and push it on gc stack.
             TRACE_MARK(ptr_block, ptr);
             ATB_HEAD_TO_MARK(ptr_area, ptr_block);
-            if (sp < MICROPY_ALLOC_GC_STACK_SIZE) {
-                MP_STATE_MEM(gc_block_stack)[sp] = ptr_block;
+            // CIRCUITPY-CHANGE: there are no children to look for
+            #if MICROPY_GC_NO_SCAN
+            if (NTB_GET(ptr_area, ptr_block)) {
+                continue;
+            }
+            #endif
+            // CIRCUITPY-CHANGE: grow the stack before giving up on it
+            #if MICROPY_GC_BORROW_STACK
+            if (sp == stack_len && gc_borrow_stack(sp)) {
+                block_stack = gc_borrowed_stack.block_stack;
+                #if MICROPY_GC_SPLIT_HEAP
+                area_stack = gc_borrowed_stack.area_stack;
+                #endif
+                stack_len = gc_borrowed_stack.len;
+                #if CIRCUITPY_MEMORYMONITOR
+                memorymonitor_gc_stack_overflow(false);
+                #endif
+            }
+            #endif
+            if (sp < stack_len) {
+                block_stack[sp] = ptr_block;
                 #if MICROPY_GC_SPLIT_HEAP
-                MP_STATE_MEM(gc_area_stack)[sp] = ptr_area;
+                area_stack[sp] = ptr_area;
                 #endif
                 sp += 1;
             } else {
@@ -492,9 +805,9 @@ static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block)
 
         // pop the next block off the stack
         sp -= 1;
-        block = MP_STATE_MEM(gc_block_stack)[sp];
+        block = block_stack[sp];
         #if MICROPY_GC_SPLIT_HEAP
-        area = MP_STATE_MEM(gc_area_stack)[sp];
+        area = area_stack[sp];
         #endif
     }
 }
@@ -502,13 +815,22 @@ static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block)
 static void gc_deal_with_stack_overflow(void) {
     while (MP_STATE_MEM(gc_stack_overflow)) {
         MP_STATE_MEM(gc_stack_overflow) = 0;
+        // CIRCUITPY-CHANGE
+        #if CIRCUITPY_MEMORYMONITOR
+        memorymonitor_gc_stack_overflow(true);
+        #endif
 
         // scan entire memory looking for blocks which have been marked but not their children
         for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
             for (size_t block = 0; block < area->gc_alloc_table_byte_len * BLOCKS_PER_ATB; block++) {
                 MICROPY_GC_HOOK_LOOP(block);
                 // trace (again) if mark bit set
-                if (ATB_GET_KIND(area, block) == AT_MARK) {
+                // CIRCUITPY-CHANGE: unless it holds no pointers
+                if (ATB_GET_KIND(area, block) == AT_MARK
+                    #if MICROPY_GC_NO_SCAN
+                    && !NTB_GET(area, block)
+                    #endif
+                    ) {
                     #if MICROPY_GC_SPLIT_HEAP
                     gc_mark_subtree(area, block);
                     #else
@@ -520,10 +842,79 @@ static void gc_deal_with_stack_overflow(void) {
     }
 }
 
+// CIRCUITPY-CHANGE: per-collection statistics for memorymonitor
+#if CIRCUITPY_MEMORYMONITOR
+static struct {
+    size_t freed;
+    size_t free;
+    size_t run;
+    size_t max_run;
+} gc_sweep_stats;
+
+static inline void gc_sweep_stats_reset(void) {
+    memset(&gc_sweep_stats, 0, sizeof(gc_sweep_stats));
+}
+
+// Count n free blocks following the previous ones, of which `freed` were
+// freed by this sweep.
+static inline void gc_sweep_stats_free(size_t n, size_t freed) {
+    gc_sweep_stats.freed += freed;
+    gc_sweep_stats.free += n;
+    gc_sweep_stats.run += n;
+    if (gc_sweep_stats.run > gc_sweep_stats.max_run) {
+        gc_sweep_stats.max_run = gc_sweep_stats.run;
+    }
+}
+
+static inline void gc_sweep_stats_used(void) {
+    gc_sweep_stats.run = 0;
+}
+
+static inline void gc_sweep_stats_done(void) {
+    memorymonitor_gc_sweep_end(gc_sweep_stats.freed, gc_sweep_stats.free, gc_sweep_stats.max_run);
+}
+#else
+#define gc_sweep_stats_reset()
+#define gc_sweep_stats_free(n, freed)
+#define gc_sweep_stats_used()
+#define gc_sweep_stats_done()
+#endif
+
+#if MICROPY_ENABLE_FINALISER
+// CIRCUITPY-CHANGE: factored out of gc_sweep
+static void gc_sweep_run_finaliser(mp_state_mem_area_t *area, size_t block) {
+    if (FTB_GET(area, block)) {
+        mp_obj_base_t *obj = (mp_obj_base_t *)PTR_FROM_BLOCK(area, block);
+        if (obj->type != NULL) {
+            // if the object has a type then see if it has a __del__ method
+            mp_obj_t dest[2];
+            mp_load_method_maybe(MP_OBJ_FROM_PTR(obj), MP_QSTR___del__, dest);
+            if (dest[0] != MP_OBJ_NULL) {
+                // load_method returned a method, execute it in a protected environment
+                #if MICROPY_ENABLE_SCHEDULER
+                mp_sched_lock();
+                #endif
+                mp_call_function_1_protected(dest[0], dest[1]);
+                #if MICROPY_ENABLE_SCHEDULER
+                mp_sched_unlock();
+                #endif
+            }
+        }
+        // clear finaliser flag
+        FTB_CLEAR(area, block);
+    }
+}
+#endif
+
 static void gc_sweep(void) {
     #if MICROPY_PY_GC_COLLECT_RETVAL
     MP_STATE_MEM(gc_collected) = 0;
     #endif
+    // CIRCUITPY-CHANGE
+    #if CIRCUITPY_MEMORYMONITOR
+    memorymonitor_gc_sweep_start();
+    #endif
+    gc_sweep_stats_reset();
     // free unmarked heads and their tails
     int free_tail = 0;
     #if MICROPY_GC_SPLIT_HEAP_AUTO
@@ -537,31 +928,38 @@ static void gc_sweep(void) {
 
         size_t last_used_block = 0;
 
+        // CIRCUITPY-CHANGE: rebuild the size class hints from the free runs
+        // seen while sweeping.
+        #if MICROPY_GC_FREE_SIZE_CLASSES > 1
+        size_t run_start = 0;
+        size_t run_len = 0;
+        size_t classes_found = 0;
+        gc_free_hints_reset(area, area->gc_alloc_table_byte_len);
+        #endif
+
         for (size_t block = 0; block < end_block; block++) {
             MICROPY_GC_HOOK_LOOP(block);
+            #if MICROPY_GC_FREE_SIZE_CLASSES > 1
+            if (classes_found < MICROPY_GC_FREE_SIZE_CLASSES) {
+                byte kind = ATB_GET_KIND(area, block);
+                if (kind == AT_FREE || kind == AT_HEAD || (kind == AT_TAIL && free_tail)) {
+                    // free already, or about to be freed below
+                    if (run_len == 0) {
+                        run_start = block;
+                    }
+                    run_len++;
+                    while (classes_found < MICROPY_GC_FREE_SIZE_CLASSES && run_len >= ((size_t)1 << classes_found)) {
+                        area->gc_last_free_atb_index[classes_found++] = run_start / BLOCKS_PER_ATB;
+                    }
+                } else {
+                    run_len = 0;
+                }
+            }
+            #endif
             switch (ATB_GET_KIND(area, block)) {
                 case AT_HEAD:
                     #if MICROPY_ENABLE_FINALISER
-                    if (FTB_GET(area, block)) {
-                        mp_obj_base_t *obj = (mp_obj_base_t *)PTR_FROM_BLOCK(area, block);
-                        if (obj->type != NULL) {
-                            // if the object has a type then see if it has a __del__ method
-                            mp_obj_t dest[2];
-                            mp_load_method_maybe(MP_OBJ_FROM_PTR(obj), MP_QSTR___del__, dest);
-                            if (dest[0] != MP_OBJ_NULL) {
-                                // load_method returned a method, execute it in a protected environment
-                                #if MICROPY_ENABLE_SCHEDULER
-                                mp_sched_lock();
-                                #endif
-                                mp_call_function_1_protected(dest[0], dest[1]);
-                                #if MICROPY_ENABLE_SCHEDULER
-                                mp_sched_unlock();
-                                #endif
-                            }
-                        }
-                        // clear finaliser flag
-                        FTB_CLEAR(area, block);
-                    }
+                    gc_sweep_run_finaliser(area, block);
                     #endif
                     free_tail = 1;
                     DEBUG_printf("gc_sweep(%p)\n", (void *)PTR_FROM_BLOCK(area, block));
@@ -577,8 +975,11 @@ static void gc_sweep(void) {
                         #if CLEAR_ON_SWEEP
                         memset((void *)PTR_FROM_BLOCK(area, block), 0, BYTES_PER_BLOCK);
                         #endif
+                        // CIRCUITPY-CHANGE
+                        gc_sweep_stats_free(1, 1);
                     } else {
                         last_used_block = block;
+                        gc_sweep_stats_used();
                     }
                     break;
 
@@ -586,15 +987,39 @@ static void gc_sweep(void) {
                     ATB_MARK_TO_HEAD(area, block);
                     free_tail = 0;
                     last_used_block = block;
+                    // CIRCUITPY-CHANGE
+                    gc_sweep_stats_used();
+                    break;
+
+                // CIRCUITPY-CHANGE
+                case AT_FREE:
+                    gc_sweep_stats_free(1, 0);
                     break;
             }
         }
 
         area->gc_last_used_block = last_used_block;
 
+        // CIRCUITPY-CHANGE: free runs don't continue into the next area
+        gc_sweep_stats_free(area->gc_alloc_table_byte_len * BLOCKS_PER_ATB - end_block, 0);
+        gc_sweep_stats_used();
+
+        // CIRCUITPY-CHANGE: everything after end_block is free, so the run
+        // in progress extends to the end of the area.
+        #if MICROPY_GC_FREE_SIZE_CLASSES > 1
+        if (run_len == 0) {
+            run_start = end_block;
+        }
+        run_len += area->gc_alloc_table_byte_len * BLOCKS_PER_ATB - end_block;
+        while (classes_found < MICROPY_GC_FREE_SIZE_CLASSES && run_len >= ((size_t)1 << classes_found)) {
+            area->gc_last_free_atb_index[classes_found++] = run_start / BLOCKS_PER_ATB;
+        }
+        #endif
+
         #if MICROPY_GC_SPLIT_HEAP_AUTO
         // Free any empty area, aside from the first one
-        if (last_used_block == 0 && prev_area != NULL) {
+        // CIRCUITPY-CHANGE: and the fast area, which is owned by the port
+        if (last_used_block == 0 && prev_area != NULL && !GC_AREA_IS_FAST(area)) {
             DEBUG_printf("gc_sweep free empty area %p\n", area);
             NEXT_AREA(prev_area) = NEXT_AREA(area);
             MP_PLAT_FREE_HEAP(area);
@@ -603,11 +1028,18 @@ static void gc_sweep(void) {
         prev_area = area;
         #endif
     }
+
+    // CIRCUITPY-CHANGE
+    gc_sweep_stats_done();
 }
 
+
 void gc_collect_start(void) {
     GC_ENTER();
     MP_STATE_THREAD(gc_lock_depth)++;
+    #if CIRCUITPY_MEMORYMONITOR
+    memorymonitor_gc_mark_start();
+    #endif
     #if MICROPY_GC_ALLOC_THRESHOLD
     MP_STATE_MEM(gc_alloc_amount) = 0;
     #endif
@@ -657,6 +1089,8 @@ void gc_collect_root(void **ptrs, size_t len) {
     for (size_t i = 0; i < len; i++) {
         MICROPY_GC_HOOK_LOOP(i);
         void *ptr = gc_get_ptr(ptrs, i);
+        // CIRCUITPY-CHANGE
+        GC_COMPACT_COUNT(ptr, &ptrs[i]);
         #if MICROPY_GC_SPLIT_HEAP
         mp_state_mem_area_t *area = gc_get_ptr_area(ptr);
         if (!area) {
@@ -671,6 +1105,12 @@ void gc_collect_root(void **ptrs, size_t len) {
         if (ATB_GET_KIND(area, block) == AT_HEAD) {
             // An unmarked head: mark it, and mark all its children
             ATB_HEAD_TO_MARK(area, block);
+            // CIRCUITPY-CHANGE
+            #if MICROPY_GC_NO_SCAN
+            if (NTB_GET(area, block)) {
+                continue;
+            }
+            #endif
             #if MICROPY_GC_SPLIT_HEAP
             gc_mark_subtree(area, block);
             #else
@@ -682,13 +1122,24 @@ void gc_collect_root(void **ptrs, size_t len) {
 
 void gc_collect_end(void) {
     gc_deal_with_stack_overflow();
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_BORROW_STACK
+    gc_return_stack();
+    #endif
+    // CIRCUITPY-CHANGE
+    #if CIRCUITPY_MEMORYMONITOR
+    memorymonitor_gc_mark_end();
+    #endif
     gc_sweep();
     #if MICROPY_GC_SPLIT_HEAP
     MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
     #endif
+    // CIRCUITPY-CHANGE: with size classes, the hints were rebuilt by gc_sweep.
+    #if MICROPY_GC_FREE_SIZE_CLASSES == 1
     for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
-        area->gc_last_free_atb_index = 0;
+        gc_free_hints_reset(area, 0);
     }
+    #endif
     MP_STATE_THREAD(gc_lock_depth)--;
     GC_EXIT();
 }
@@ -700,6 +1151,191 @@ void gc_sweep_all(void) {
     gc_collect_end();
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_COMPACT
+static mp_state_mem_area_t *gc_compact_area_of(const void *ptr) {
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        if (ptr >= (void *)area->gc_pool_start && ptr < (void *)area->gc_pool_end) {
+            return area;
+        }
+    }
+    return NULL;
+}
+
+// Whether ref is the field through which a live object owns the buffer it
+// points to. Only these fields are rewritten when the buffer moves.
+static bool gc_compact_is_holder(void **ref) {
+    // Not on the stack or in a root, and not inside a buffer that may move
+    // itself.
+    mp_state_mem_area_t *area = gc_compact_area_of(ref);
+    if (area == NULL) {
+        return false;
+    }
+    int i = gc_compact_lookup(ref);
+    if (i >= 0 && (byte *)ref < gc_compact_end(&gc_compact_candidates[i])) {
+        return false;
+    }
+    size_t block = BLOCK_FROM_PTR(area, ref);
+    while (ATB_GET_KIND(area, block) == AT_TAIL) {
+        block--;
+    }
+    if (ATB_GET_KIND(area, block) != AT_HEAD) {
+        return false;
+    }
+    mp_obj_base_t *obj = (mp_obj_base_t *)PTR_FROM_BLOCK(area, block);
+    #if MICROPY_PY_BUILTINS_BYTEARRAY || MICROPY_PY_ARRAY
+    if (false
+        #if MICROPY_PY_BUILTINS_BYTEARRAY
+        || obj->type == &mp_type_bytearray
+        #endif
+        #if MICROPY_PY_ARRAY
+        || obj->type == &mp_type_array
+        #endif
+        ) {
+        return ref == &((mp_obj_array_t *)obj)->items;
+    }
+    #endif
+    #if CIRCUITPY_DISPLAYIO
+    if (obj->type == &displayio_bitmap_type) {
+        displayio_bitmap_t *bitmap = (displayio_bitmap_t *)obj;
+        return bitmap->data_alloc && ref == (void **)&bitmap->data;
+    }
+    #endif
+    return false;
+}
+
+// Find the lowest run of n_blocks blocks that is free, or belongs to the
+// candidate itself, and starts before the candidate. Areas before the
+// candidate's one are searched first; the fast area only for its own blocks.
+static bool gc_compact_find(const gc_compact_candidate_t *c, mp_state_mem_area_t **area_out, size_t *block_out) {
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        bool own = area == c->area;
+        if (!own && GC_AREA_IS_FAST(area)) {
+            continue;
+        }
+        size_t end_block = own ? c->block + c->n_blocks : area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+        size_t n_free = 0;
+        for (size_t block = 0; block < end_block; block++) {
+            MICROPY_GC_HOOK_LOOP(block);
+            if (ATB_GET_KIND(area, block) == AT_FREE || (own && block >= c->block)) {
+                if (++n_free == c->n_blocks) {
+                    size_t start = block + 1 - n_free;
+                    if (own && start >= c->block) {
+                        return false;
+                    }
+                    *area_out = area;
+                    *block_out = start;
+                    return true;
+                }
+            } else {
+                n_free = 0;
+            }
+        }
+        if (own) {
+            return false;
+        }
+    }
+    return false;
+}
+
+size_t gc_compact(void) {
+    if (MP_STATE_THREAD(gc_lock_depth) > 0) {
+        return 0;
+    }
+
+    // Large buffers without a finaliser that have free space somewhere before
+    // them are candidates.
+    GC_ENTER();
+    bool seen_free = false;
+    gc_compact_n_candidates = 0;
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        size_t end_block = MIN(area->gc_last_used_block + 1, area->gc_alloc_table_byte_len * BLOCKS_PER_ATB);
+        for (size_t block = 0; block < end_block; block++) {
+            MICROPY_GC_HOOK_LOOP(block);
+            byte kind = ATB_GET_KIND(area, block);
+            if (kind == AT_FREE) {
+                seen_free = true;
+                continue;
+            }
+            if (kind != AT_HEAD || !seen_free) {
+                continue;
+            }
+            size_t n_blocks = 1;
+            while (block + n_blocks < end_block && ATB_GET_KIND(area, block + n_blocks) == AT_TAIL) {
+                n_blocks++;
+            }
+            #if MICROPY_ENABLE_FINALISER
+            if (FTB_GET(area, block)) {
+                continue;
+            }
+            #endif
+            if (n_blocks >= MICROPY_GC_COMPACT_MIN_BLOCKS
+                && gc_compact_n_candidates < MICROPY_GC_COMPACT_MAX_CANDIDATES) {
+                gc_compact_candidate_t *c = &gc_compact_candidates[gc_compact_n_candidates++];
+                c->area = area;
+                c->block = block;
+                c->n_blocks = n_blocks;
+                c->refs = 0;
+                c->ref = NULL;
+            }
+            block += n_blocks - 1;
+        }
+    }
+    GC_EXIT();
+    if (gc_compact_n_candidates == 0) {
+        return 0;
+    }
+
+    // Count the references to each candidate while collecting garbage.
+    gc_collect();
+
+    GC_ENTER();
+    size_t moved = 0;
+    size_t n_candidates = gc_compact_n_candidates;
+    for (size_t i = 0; i < n_candidates; i++) {
+        gc_compact_candidate_t *c = &gc_compact_candidates[i];
+        // Garbage is swept before anything can be allocated in its place.
+        if (c->refs != 1 || ATB_GET_KIND(c->area, c->block) != AT_HEAD || !gc_compact_is_holder(c->ref)) {
+            continue;
+        }
+        mp_state_mem_area_t *area;
+        size_t block;
+        if (!gc_compact_find(c, &area, &block)) {
+            continue;
+        }
+        byte *from = gc_compact_start(c);
+        byte *to = (byte *)PTR_FROM_BLOCK(area, block);
+        memmove(to, from, c->n_blocks * BYTES_PER_BLOCK);
+        for (size_t bl = c->block; bl < c->block + c->n_blocks; bl++) {
+            ATB_ANY_TO_FREE(c->area, bl);
+        }
+        ATB_FREE_TO_HEAD(area, block);
+        for (size_t bl = block + 1; bl < block + c->n_blocks; bl++) {
+            ATB_FREE_TO_TAIL(area, bl);
+        }
+        #if MICROPY_GC_NO_SCAN
+        NTB_WRITE(area, block, NTB_GET(c->area, c->block));
+        #endif
+        area->gc_last_used_block = MAX(area->gc_last_used_block, block + c->n_blocks - 1);
+        *c->ref = (byte *)*c->ref + (to - from);
+        moved++;
+    }
+    // Stop counting before anything else collects.
+    gc_compact_n_candidates = 0;
+
+    if (moved != 0) {
+        for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+            gc_free_hints_reset(area, 0);
+        }
+        #if MICROPY_GC_SPLIT_HEAP
+        MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
+        #endif
+    }
+    GC_EXIT();
+    return moved;
+}
+#endif // MICROPY_GC_COMPACT
+
 void gc_info(gc_info_t *info) {
     GC_ENTER();
     info->total = 0;
@@ -773,6 +1409,24 @@ void gc_info(gc_info_t *info) {
     GC_EXIT();
 }
 
+#if MICROPY_GC_FAST_AREA_MAX_BLOCKS
+// CIRCUITPY-CHANGE: area to scan after the given one. A pending resume area
+// (where the scan would have started without the fast area) comes first.
+static mp_state_mem_area_t *gc_alloc_next_area(mp_state_mem_area_t *area, mp_state_mem_area_t **resume, bool skip_fast_area) {
+    mp_state_mem_area_t *next;
+    if (*resume != NULL) {
+        next = *resume;
+        *resume = NULL;
+    } else {
+        next = NEXT_AREA(area);
+    }
+    if (next != NULL && next == MP_STATE_MEM(gc_fast_area) && skip_fast_area) {
+        next = NEXT_AREA(next);
+    }
+    return next;
+}
+#endif
+
 // CIRCUITPY-CHANGE: C code may be used when the VM heap isn't active. This
 // allows that code to test if it is. It can use the outer pool if needed.
 bool gc_alloc_possible(void) {
@@ -805,6 +1459,8 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
     #if MICROPY_GC_SPLIT_HEAP_AUTO
     bool added = false;
     #endif
+    // CIRCUITPY-CHANGE
+    size_t size_class = gc_size_class(n_blocks);
 
     #if MICROPY_GC_ALLOC_THRESHOLD
     if (!collected && MP_STATE_MEM(gc_alloc_amount) >= MP_STATE_MEM(gc_alloc_threshold)) {
@@ -828,10 +1484,26 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
             reset_into_safe_mode(SAFE_MODE_GC_ALLOC_OUTSIDE_VM);
         }
 
+        // CIRCUITPY-CHANGE: small allocations try the fast area first. Larger
+        // ones only go there once a collection didn't free enough elsewhere.
+        #if MICROPY_GC_FAST_AREA_MAX_BLOCKS
+        bool small = n_blocks <= MICROPY_GC_FAST_AREA_MAX_BLOCKS && !(alloc_flags & GC_ALLOC_FLAG_BULK);
+        bool skip_fast_area = small || !collected;
+        mp_state_mem_area_t *resume_area = NULL;
+        if (small && MP_STATE_MEM(gc_fast_area) != NULL) {
+            resume_area = area;
+            area = MP_STATE_MEM(gc_fast_area);
+        }
+        #define GC_ALLOC_NEXT_AREA(area) gc_alloc_next_area(area, &resume_area, skip_fast_area)
+        #else
+        #define GC_ALLOC_NEXT_AREA(area) NEXT_AREA(area)
+        #endif
+
         // look for a run of n_blocks available blocks
-        for (; area != NULL; area = NEXT_AREA(area), i = 0) {
+        for (; area != NULL; area = GC_ALLOC_NEXT_AREA(area), i = 0) {
             n_free = 0;
-            for (i = area->gc_last_free_atb_index; i < area->gc_alloc_table_byte_len; i++) {
+            // CIRCUITPY-CHANGE: start at the hint for this size class
+            for (i = area->gc_last_free_atb_index[size_class]; i < area->gc_alloc_table_byte_len; i++) {
                 MICROPY_GC_HOOK_LOOP(i);
                 byte a = area->gc_alloc_table_start[i];
                 // *FORMAT-OFF*
@@ -846,12 +1518,13 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
             // filled, so we won't try to find free space here again until
             // space is freed.
             #if MICROPY_GC_SPLIT_HEAP
-            if (n_blocks == 1) {
-                area->gc_last_free_atb_index = (i + 1) / BLOCKS_PER_ATB; // or (size_t)-1
-            }
+            // CIRCUITPY-CHANGE
+            gc_free_hints_raise(area, n_blocks, (i + 1) / BLOCKS_PER_ATB); // or (size_t)-1
             #endif
         }
 
+        #undef GC_ALLOC_NEXT_AREA
+
         GC_EXIT();
         // nothing found!
         if (collected) {
@@ -881,16 +1554,21 @@ found:
     start_block = i - n_free + 1;
 
     // Set last free ATB index to block after last block we found, for start of
-    // next scan.  To reduce fragmentation, we only do this if we were looking
-    // for a single free block, which guarantees that there are no free blocks
-    // before this one.  Also, whenever we free or shink a block we must check
-    // if this index needs adjusting (see gc_realloc and gc_free).
+    // next scan.  To reduce fragmentation, we only do this for size classes
+    // at least as long as this allocation, which guarantees that there are no
+    // runs of that length before this one.  Also, whenever we free or shink a
+    // block we must check if the index needs adjusting (see gc_realloc and
+    // gc_free).
     if (n_free == 1) {
         #if MICROPY_GC_SPLIT_HEAP
-        MP_STATE_MEM(gc_last_free_area) = area;
+        // CIRCUITPY-CHANGE: the fast area is searched separately
+        if (!GC_AREA_IS_FAST(area)) {
+            MP_STATE_MEM(gc_last_free_area) = area;
+        }
         #endif
-        area->gc_last_free_atb_index = (i + 1) / BLOCKS_PER_ATB;
     }
+    // CIRCUITPY-CHANGE
+    gc_free_hints_raise(area, n_blocks, (i + 1) / BLOCKS_PER_ATB);
 
     // CIRCUITPY-CHANGE
     #ifdef LOG_HEAP_ACTIVITY
@@ -908,6 +1586,11 @@ found:
         ATB_FREE_TO_TAIL(area, bl);
     }
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_NO_SCAN
+    NTB_WRITE(area, start_block, alloc_flags & GC_ALLOC_FLAG_NO_SCAN);
+    #endif
+
     // get pointer to first block
     // we must create this pointer before unlocking the GC so a collection can find it
     void *ret_ptr = (void *)(area->gc_pool_start + start_block * BYTES_PER_BLOCK);
@@ -1023,22 +1706,22 @@ void gc_free(void *ptr) {
     }
     #endif
 
-    // set the last_free pointer to this block if it's earlier in the heap
-    if (block / BLOCKS_PER_ATB < area->gc_last_free_atb_index) {
-        area->gc_last_free_atb_index = block / BLOCKS_PER_ATB;
-    }
-
     // CIRCUITPY-CHANGE
     #ifdef LOG_HEAP_ACTIVITY
     gc_log_change(start_block, 0);
     #endif
 
     // free head and all of its tail blocks
+    size_t head_block = block;
     do {
         ATB_ANY_TO_FREE(area, block);
         block += 1;
     } while (ATB_GET_KIND(area, block) == AT_TAIL);
 
+    // CIRCUITPY-CHANGE: set the last_free pointers to this block if it's
+    // earlier in the heap
+    gc_free_hints_lower(area, head_block);
+
     GC_EXIT();
 
     #if EXTENSIVE_HEAP_PROFILING
@@ -1188,10 +1871,9 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
         }
         #endif
 
-        // set the last_free pointer to end of this block if it's earlier in the heap
-        if ((block + new_blocks) / BLOCKS_PER_ATB < area->gc_last_free_atb_index) {
-            area->gc_last_free_atb_index = (block + new_blocks) / BLOCKS_PER_ATB;
-        }
+        // CIRCUITPY-CHANGE: set the last_free pointers to end of this block if
+        // it's earlier in the heap
+        gc_free_hints_lower(area, block + new_blocks);
 
         GC_EXIT();
 
@@ -1253,6 +1935,13 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
     #else
     bool ftb_state = false;
     #endif
+    // CIRCUITPY-CHANGE: the new chain keeps the flags of the old one
+    unsigned int alloc_flags = ftb_state ? GC_ALLOC_FLAG_HAS_FINALISER : 0;
+    #if MICROPY_GC_NO_SCAN
+    if (NTB_GET(area, block)) {
+        alloc_flags |= GC_ALLOC_FLAG_NO_SCAN;
+    }
+    #endif
 
     GC_EXIT();
 
@@ -1262,7 +1951,7 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
     }
 
     // can't resize inplace; try to find a new contiguous chain
-    void *ptr_out = gc_alloc(n_bytes, ftb_state);
+    void *ptr_out = gc_alloc(n_bytes, alloc_flags);
 
     // check that the alloc succeeded
     if (ptr_out == NULL) {
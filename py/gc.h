@@ -43,6 +43,13 @@ void gc_deinit(void);
 // Used to add additional memory areas to the heap.
 void gc_add(void *start, void *end);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_FAST_AREA_MAX_BLOCKS
+// Add a memory area, normally in the port's fastest RAM, that small allocations
+// prefer. It is never released automatically, so the caller owns the memory.
+void gc_add_fast_area(void *start, void *end);
+#endif
+
 #if MICROPY_GC_SPLIT_HEAP_AUTO
 // Port must implement this function to return the maximum available block of
 // RAM to allocate a new heap area into using MP_PLAT_ALLOC_HEAP.
@@ -71,8 +78,22 @@ bool gc_alloc_possible(void);
 // Use this function to sweep the whole heap and run all finalisers
 void gc_sweep_all(void);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_COMPACT
+// Collect garbage and move large, singly-owned buffers down the heap.
+// Returns the number of buffers moved.
+size_t gc_compact(void);
+#endif
+
 enum {
     GC_ALLOC_FLAG_HAS_FINALISER = 1,
+    // CIRCUITPY-CHANGE: data that is worked through in bulk, such as bitmaps, bytearrays and
+    // sample buffers. These are placed like large allocations, so they leave the fast area to
+    // the small objects that are touched most often.
+    GC_ALLOC_FLAG_BULK = 2,
+    // CIRCUITPY-CHANGE: the allocation holds no pointers to the heap, so marking doesn't look
+    // inside it. Only has an effect with MICROPY_GC_NO_SCAN.
+    GC_ALLOC_FLAG_NO_SCAN = 4,
 };
 
 void *gc_alloc(size_t n_bytes, unsigned int alloc_flags);
@@ -0,0 +1,189 @@
+"""
+This pre-processor parses a single file containing a list of
+MAP_TABLE(table_name, MP_QSTR_key ...) items (i.e. the output of
+`py/makeqstrdefs.py cat map_table`) along with the generated qstr
+definitions, and generates a header with a minimal perfect hash for the keys
+of each const map table.
+
+The header is included by py/map.c when MICROPY_OPT_MAP_PERFECT_HASH is
+enabled.  Each hash is order-preserving (the CHM algorithm): the position of
+key q in its table is (g[h1(q)] + g[h2(q)]) % n, so the tables themselves are
+left as they are.  A table is found by its size and first, middle and last
+keys; tables that can't be told apart that way are left out.  Since a table
+the scan didn't see may still match, py/map.c checks a hash against all the
+keys of a table before it trusts a miss.
+
+The hash functions here must match those in py/map.c.
+"""
+
+from __future__ import print_function
+
+import argparse
+import re
+
+
+# Tables smaller than this are searched linearly.
+MIN_SIZE = 8
+
+# The g values are stored as bytes.
+MAX_SIZE = 255
+
+MAP_TABLE_PATTERN = re.compile(r"MAP_TABLE\((\w+), ([\w ]+)\)")
+QDEF_PATTERN = re.compile(r"^QDEF([01])\((MP_QSTR\w+),")
+
+
+def mix(q, seed):
+    x = ((q ^ (seed << 16)) * 0x9E3779B1) & 0xFFFFFFFF
+    x ^= x >> 15
+    x = (x * 0x85EBCA77) & 0xFFFFFFFF
+    x ^= x >> 13
+    return x
+
+
+def num_vertices(n):
+    return 2 * n + (n >> 3) + 1
+
+
+def table_id(keys):
+    n = len(keys)
+    return mix(keys[0] ^ ((keys[-1] << 16) & 0xFFFFFFFF), keys[n // 2] + n)
+
+
+def read_qstr_values(filename):
+    # Static qstrs (QDEF0) are numbered first, then the rest (QDEF1) follow.
+    pools = ([], [])
+    with open(filename) as f:
+        for line in f:
+            match = QDEF_PATTERN.match(line)
+            if match:
+                pools[int(match.group(1))].append(match.group(2))
+    return {name: value for value, name in enumerate(pools[0] + pools[1])}
+
+
+def read_map_tables(filename, qstr_values):
+    tables = {}
+    with open(filename) as f:
+        for match in MAP_TABLE_PATTERN.finditer(f.read()):
+            names = match.group(2).split()
+            if MIN_SIZE <= len(names) <= MAX_SIZE and all(name in qstr_values for name in names):
+                keys = tuple(qstr_values[name] for name in names)
+                if len(set(keys)) == len(keys):
+                    tables.setdefault(keys, match.group(1))
+    return tables
+
+
+def find_hash(keys):
+    """Return (seed, g) such that key i hashes to i, or None."""
+    n = len(keys)
+    m = num_vertices(n)
+    for seed in range(0x10000):
+        edges = []
+        for q in keys:
+            x = mix(q, seed)
+            edges.append((((x & 0xFFFF) * m) >> 16, ((x >> 16) * m) >> 16))
+        # The graph must be acyclic, so that g can be solved for each edge.
+        parent = list(range(m))
+
+        def root(v):
+            while parent[v] != v:
+                parent[v] = parent[parent[v]]
+                v = parent[v]
+            return v
+
+        for u, v in edges:
+            ru, rv = root(u), root(v)
+            if ru == rv:
+                break
+            parent[ru] = rv
+        else:
+            adjacent = [[] for _ in range(m)]
+            for i, (u, v) in enumerate(edges):
+                adjacent[u].append((v, i))
+                adjacent[v].append((u, i))
+            g = [None] * m
+            for start in range(m):
+                if g[start] is not None:
+                    continue
+                g[start] = 0
+                stack = [start]
+                while stack:
+                    u = stack.pop()
+                    for v, i in adjacent[u]:
+                        if g[v] is None:
+                            g[v] = (i - g[u]) % n
+                            stack.append(v)
+            return seed, g
+    return None
+
+
+def generate_header(tables):
+    # Drop tables that share an id, or the same size, first, middle and last keys.
+    by_id = {}
+    for keys in tables:
+        n = len(keys)
+        by_id.setdefault((n, keys[0], keys[n // 2], keys[-1]), []).append(keys)
+    records = []
+    g_pool = []
+    for ident, candidates in sorted(by_id.items()):
+        if len(candidates) != 1:
+            continue
+        keys = candidates[0]
+        found = find_hash(keys)
+        if found is None or len(g_pool) + len(found[1]) > 0x10000:
+            continue
+        seed, g = found
+        records.append((keys, seed, len(g_pool)))
+        g_pool += g
+
+    index_size = 4
+    while index_size < len(records) + len(records) // 2 + 1:
+        index_size *= 2
+    index = [0] * index_size
+    for i, (keys, _, _) in enumerate(records):
+        pos = table_id(keys) & (index_size - 1)
+        while index[pos]:
+            pos = (pos + 1) & (index_size - 1)
+        index[pos] = i + 1
+
+    print("// Automatically generated by make_map_hashes.py.")
+    print()
+    print("#define MP_MAP_HASH_MIN_SIZE (%d)" % MIN_SIZE)
+    print("#define MP_MAP_HASH_MAX_SIZE (%d)" % MAX_SIZE)
+    print("#define MP_MAP_HASH_INDEX_MASK (%d)" % (index_size - 1))
+    print()
+    print("static const mp_map_hash_t mp_map_hash_table[] = {")
+    for keys, seed, offset in records:
+        n = len(keys)
+        print(
+            "    { %d, %d, %d, %d, %d, %d }, // %s"
+            % (n, keys[0], keys[n // 2], keys[-1], seed, offset, tables[keys])
+        )
+    if not records:
+        print("    { 0 },")
+    print("};")
+    print()
+    print("static const uint16_t mp_map_hash_index[] = {")
+    for i in range(0, index_size, 16):
+        print("    " + " ".join("%d," % v for v in index[i : i + 16]))
+    print("};")
+    print()
+    print("static const uint8_t mp_map_hash_g[] = {")
+    for i in range(0, len(g_pool), 16):
+        print("    " + " ".join("%d," % v for v in g_pool[i : i + 16]))
+    if not g_pool:
+        print("    0,")
+    print("};")
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("file", nargs=1, help="file with MAP_TABLE definitions")
+    parser.add_argument("qstrdefs", nargs=1, help="generated qstr definitions")
+    args = parser.parse_args()
+
+    qstr_values = read_qstr_values(args.qstrdefs[0])
+    generate_header(read_map_tables(args.file[0], qstr_values))
+
+
+if __name__ == "__main__":
+    main()
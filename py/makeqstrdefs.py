@@ -64,6 +64,10 @@ _MODE_MODULE = "module"
 # Extract MP_REGISTER_ROOT_POINTER(...) macros.
 _MODE_ROOT_POINTER = "root_pointer"
 
+# CIRCUITPY-CHANGE
+# Extract the keys of const mp_rom_map_elem_t tables.
+_MODE_MAP_TABLE = "map_table"
+
 
 class PreprocessorError(Exception):
     pass
@@ -129,6 +133,65 @@ def write_out(fname, output):
             f.write("\n".join(output) + "\n")
 
 
+# CIRCUITPY-CHANGE: added
+_re_map_table = re.compile(r"\bconst\s+mp_rom_map_elem_t\s+(\w+)\s*\[\s*\]\s*=\s*\{")
+_re_map_key_qstr = re.compile(r"MP_QSTR_\w+")
+_re_ident = re.compile(r"[A-Za-z_]\w*")
+_map_key_casts = {"mp_obj_t", "mp_rom_obj_t", "mp_uint_t", "uintptr_t", "uint64_t", "u64"}
+
+
+def _skip_braced(text, i):
+    # Return the index just past the bracket that closes the one before text[i].
+    depth = 1
+    while i < len(text) and depth:
+        c = text[i]
+        if c in "({[":
+            depth += 1
+        elif c in ")}]":
+            depth -= 1
+        elif c in "\"'":
+            i += 1
+            while i < len(text) and text[i] != c:
+                i += 2 if text[i] == "\\" else 1
+        i += 1
+    return i
+
+
+def _map_table_keys(text, i):
+    # Parse the table initializer starting at text[i], just after its "{".
+    # Return the qstr names of its keys, or None if any key is not a plain
+    # MP_ROM_QSTR or an entry isn't a braced pair (e.g. an unexpanded macro).
+    keys = []
+    while True:
+        while i < len(text) and text[i] in " \t\n,":
+            i += 1
+        if i >= len(text) or text[i] == "}":
+            return keys
+        if text[i] != "{":
+            return None
+        end = _skip_braced(text, i + 1)
+        entry = text[i + 1 : end - 1]
+        # the key is everything up to the first comma outside brackets
+        j = 0
+        while j < len(entry) and entry[j] != ",":
+            j = _skip_braced(entry, j + 1) if entry[j] in "({[" else j + 1
+        key = entry[:j]
+        qstrs = _re_map_key_qstr.findall(key)
+        if len(qstrs) != 1 or set(_re_ident.findall(key)) - _map_key_casts != set(qstrs):
+            return None
+        keys.append(qstrs[0])
+        i = end
+
+
+def extract_map_tables(text):
+    output = []
+    for match in _re_map_table.finditer(text):
+        keys = _map_table_keys(text, match.end())
+        if keys:
+            output.append("MAP_TABLE(%s, %s)" % (match.group(1), " ".join(keys)))
+    return output
+
+
 # CIRCUITPY-CHANGE: added
 def qstr_unescape(qstr):
     for name in name2codepoint:
@@ -152,6 +215,10 @@ def process_file(f, output_filename=None):
         )
     elif args.mode == _MODE_ROOT_POINTER:
         re_match = re.compile(r"MP_REGISTER_ROOT_POINTER\(.*?\);")
+    # CIRCUITPY-CHANGE: map tables span lines, so collect each file's text
+    elif args.mode == _MODE_MAP_TABLE:
+        re_match = None
+    map_text = []
     # CIRCUITPY-CHANGE: added
     re_translate = re.compile(r"MP_COMPRESSED_ROM_TEXT\(\"((?:(?=(\\?))\2.)*?)\"\)")
     output = []
@@ -165,10 +232,17 @@ def process_file(f, output_filename=None):
             if not is_c_source(fname) and not is_cxx_source(fname):
                 continue
             if fname != last_fname and output_filename is None:
+                # CIRCUITPY-CHANGE
+                output += extract_map_tables("".join(map_text))
+                map_text = []
                 write_out(last_fname, output)
                 output = []
                 last_fname = fname
             continue
+        # CIRCUITPY-CHANGE
+        if re_match is None:
+            map_text.append(line)
+            continue
         for match in re_match.findall(line):
             if args.mode == _MODE_QSTR:
                 name = match.replace("MP_QSTR_", "")
@@ -181,6 +255,8 @@ def process_file(f, output_filename=None):
         for match in re_translate.findall(line):
             output.append('TRANSLATE("' + match[0] + '")')
 
+    # CIRCUITPY-CHANGE
+    output += extract_map_tables("".join(map_text))
     if output_filename is not None:
         with open(output_filename, "w") as f:
             f.write("\n".join(output) + "\n")
@@ -228,6 +304,9 @@ def cat_together():
     elif args.mode == _MODE_ROOT_POINTER:
         mode_full = "Root pointer registrations"
     # CIRCUITPY-CHANGE
+    elif args.mode == _MODE_MAP_TABLE:
+        mode_full = "Map tables"
+    # CIRCUITPY-CHANGE
     if old_hash != new_hash:
         print(mode_full, "updated")
         try:
@@ -295,7 +374,14 @@ if __name__ == "__main__":
     if args.output_file == "_":
         args.output_file = None
 
-    if args.mode not in (_MODE_QSTR, _MODE_COMPRESS, _MODE_MODULE, _MODE_ROOT_POINTER):
+    # CIRCUITPY-CHANGE: added _MODE_MAP_TABLE
+    if args.mode not in (
+        _MODE_QSTR,
+        _MODE_COMPRESS,
+        _MODE_MODULE,
+        _MODE_ROOT_POINTER,
+        _MODE_MAP_TABLE,
+    ):
         print("error: mode %s unrecognised" % sys.argv[2])
         sys.exit(2)
 
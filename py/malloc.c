@@ -58,6 +58,8 @@
 #undef realloc
 #define malloc(b) gc_alloc((b), false)
 #define malloc_with_finaliser(b) gc_alloc((b), true)
+// CIRCUITPY-CHANGE
+#define malloc_bulk(b) gc_alloc((b), GC_ALLOC_FLAG_BULK | GC_ALLOC_FLAG_NO_SCAN)
 #define free gc_free
 #define realloc(ptr, n) gc_realloc(ptr, n, true)
 #define realloc_ext(ptr, n, mv) gc_realloc(ptr, n, mv)
@@ -69,6 +71,9 @@
 #error MICROPY_ENABLE_FINALISER requires MICROPY_ENABLE_GC
 #endif
 
+// CIRCUITPY-CHANGE
+#define malloc_bulk(b) malloc(b)
+
 static void *realloc_ext(void *ptr, size_t n_bytes, bool allow_move) {
     if (allow_move) {
         return realloc(ptr, n_bytes);
@@ -123,6 +128,21 @@ void *m_malloc_with_finaliser(size_t num_bytes) {
 }
 #endif
 
+// CIRCUITPY-CHANGE
+void *m_malloc_bulk(size_t num_bytes) {
+    void *ptr = malloc_bulk(num_bytes);
+    if (ptr == NULL && num_bytes != 0) {
+        m_malloc_fail(num_bytes);
+    }
+    #if MICROPY_MEM_STATS
+    MP_STATE_MEM(total_bytes_allocated) += num_bytes;
+    MP_STATE_MEM(current_bytes_allocated) += num_bytes;
+    UPDATE_PEAK();
+    #endif
+    DEBUG_printf("malloc %d : %p\n", num_bytes, ptr);
+    return ptr;
+}
+
 void *m_malloc0(size_t num_bytes) {
     void *ptr = m_malloc(num_bytes);
     // If this config is set then the GC clears all memory, so we don't need to.
@@ -83,21 +83,212 @@ static size_t get_hash_alloc_greater_or_equal_to(size_t x) {
     return (x + x / 2) | 1;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_MAP_COMPACT
+// A compact map keeps its entries in insertion order in table[0..alloc), and
+// an index of 32-bit slots directly after them.  The lookup probes the index
+// linearly starting from hash & mask.  Each non-zero slot holds the position
+// of its entry plus one in the low 24 bits and an 8-bit tag of the hash in the
+// top bits, so most mismatches are rejected without reading the entries.
+// Deleting an entry turns its key into MP_OBJ_SENTINEL; unless it ends its
+// probe sequence the slot keeps pointing at it until the next rehash
+// squeezes out the holes.
+typedef struct _mp_map_index_t {
+    uint32_t fill; // number of entries appended since the last rehash
+    uint32_t mask; // number of index slots minus one
+    uint32_t slot[];
+} mp_map_index_t;
+
+#define MAP_INDEX(map) ((mp_map_index_t *)&(map)->table[(map)->alloc])
+#define MAP_INDEX_POS_BITS (24)
+#define MAP_INDEX_POS_MASK ((1 << MAP_INDEX_POS_BITS) - 1)
+
+static inline uint32_t map_index_tag(mp_uint_t hash) {
+    // Fold all of the hash into the tag, because qstr hashes may be only 8 bits.
+    hash ^= hash >> 16;
+    hash ^= hash >> 8;
+    return (uint32_t)(hash & 0xff) << MAP_INDEX_POS_BITS;
+}
+
+static inline bool map_use_compact(size_t alloc) {
+    return alloc >= MICROPY_OPT_MAP_COMPACT_MIN_ALLOC && alloc < MAP_INDEX_POS_MASK;
+}
+
+// The index has at least half as many slots again as there are entries, so
+// probes always find an empty slot.
+static size_t map_index_size(size_t alloc) {
+    size_t n = 4;
+    while (n < alloc + alloc / 2 + 1) {
+        n <<= 1;
+    }
+    return n;
+}
+
+static size_t map_table_nbytes(size_t alloc, bool compact) {
+    size_t n = alloc * sizeof(mp_map_elem_t);
+    if (compact) {
+        n += sizeof(mp_map_index_t) + map_index_size(alloc) * sizeof(uint32_t);
+    }
+    return n;
+}
+
+static mp_map_elem_t *map_new_table(size_t alloc, bool compact) {
+    mp_map_elem_t *table = m_malloc0(map_table_nbytes(alloc, compact));
+    if (compact) {
+        ((mp_map_index_t *)&table[alloc])->mask = map_index_size(alloc) - 1;
+    }
+    return table;
+}
+
+#define MAP_IS_COMPACT(map) ((map)->is_compact)
+#else
+#define MAP_IS_COMPACT(map) (false)
+#define map_use_compact(alloc) (false)
+#define map_table_nbytes(alloc, compact) ((void)(compact), (alloc) * sizeof(mp_map_elem_t))
+#define map_new_table(alloc, compact) ((void)(compact), m_new0(mp_map_elem_t, (alloc)))
+#endif
+
+#if MICROPY_OPT_MAP_PERFECT_HASH
+// Const tables from MP_DEFINE_CONST_MAP/DICT have an order-preserving minimal
+// perfect hash for their keys, generated at build time by make_map_hashes.py.
+// The generated record for a table is found from its size and its first,
+// middle and last keys, but another table can match those too. A hit is still
+// right, since the key is compared, but a miss is only believed once every key
+// of the table has been checked to hash to its own slot. The outcome of that
+// check is remembered in MP_STATE_VM(map_hash_cache), by table address.
+typedef struct _mp_map_hash_t {
+    uint16_t n;
+    qstr_short_t q0, qmid, qlast;
+    uint16_t seed;
+    uint16_t offset; // of the table's g values in mp_map_hash_g
+} mp_map_hash_t;
+
+// The qstr extraction stage also generates this header.
+#ifndef NO_QSTR
+#include "genhdr/map_hashes.h"
+#endif
+
+// Must match mix() in make_map_hashes.py.
+static inline uint32_t map_hash_mix(uint32_t q, uint32_t seed) {
+    uint32_t x = (q ^ (seed << 16)) * 0x9e3779b1;
+    x ^= x >> 15;
+    x *= 0x85ebca77;
+    x ^= x >> 13;
+    return x;
+}
+
+static size_t map_hash_slot(const mp_map_hash_t *h, size_t n, mp_obj_t index) {
+    const uint8_t *g = &mp_map_hash_g[h->offset];
+    size_t m = 2 * n + (n >> 3) + 1;
+    uint32_t x = map_hash_mix(MP_OBJ_QSTR_VALUE(index), h->seed);
+    size_t i = g[((x & 0xffff) * m) >> 16] + g[((x >> 16) * m) >> 16];
+    if (i >= n) {
+        i -= n;
+    }
+    return i;
+}
+
+// Returns the 1-based index of the record matching the table, or 0 if none.
+static size_t map_hash_find_record(const mp_map_elem_t *table, size_t n) {
+    if (!mp_obj_is_qstr(table[0].key) || !mp_obj_is_qstr(table[n / 2].key) || !mp_obj_is_qstr(table[n - 1].key)) {
+        return 0;
+    }
+    uint32_t q0 = MP_OBJ_QSTR_VALUE(table[0].key);
+    uint32_t qmid = MP_OBJ_QSTR_VALUE(table[n / 2].key);
+    uint32_t qlast = MP_OBJ_QSTR_VALUE(table[n - 1].key);
+    size_t pos = map_hash_mix(q0 ^ (qlast << 16), qmid + n);
+    for (;; pos++) {
+        size_t record = mp_map_hash_index[pos & MP_MAP_HASH_INDEX_MASK];
+        if (record == 0) {
+            return 0;
+        }
+        const mp_map_hash_t *h = &mp_map_hash_table[record - 1];
+        if (h->n == n && h->q0 == q0 && h->qmid == qmid && h->qlast == qlast) {
+            return record;
+        }
+    }
+}
+
+static bool map_hash_fits(const mp_map_elem_t *table, size_t n, size_t record) {
+    const mp_map_hash_t *h = &mp_map_hash_table[record - 1];
+    for (size_t i = 0; i < n; i++) {
+        if (!mp_obj_is_qstr(table[i].key) || map_hash_slot(h, n, table[i].key) != i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Returns false if the map has no perfect hash, else true with *elem set to
+// the slot of index, or NULL if index is not in the map.
+static bool map_perfect_hash_lookup(const mp_map_t *map, mp_obj_t index, mp_map_elem_t **elem) {
+    size_t n = map->alloc;
+    mp_map_elem_t *table = map->table;
+    if (n < MP_MAP_HASH_MIN_SIZE || n > MP_MAP_HASH_MAX_SIZE || !mp_obj_is_qstr(index)) {
+        return false;
+    }
+    size_t slot = ((uintptr_t)table >> 3) % MICROPY_OPT_MAP_PERFECT_HASH_CACHE_SIZE;
+    bool checked = MP_STATE_VM(map_hash_cache)[slot].table == table;
+    size_t record = checked ? MP_STATE_VM(map_hash_cache)[slot].record : map_hash_find_record(table, n);
+    if (record == 0) {
+        return false;
+    }
+    size_t i = map_hash_slot(&mp_map_hash_table[record - 1], n, index);
+    if (table[i].key == index) {
+        *elem = &table[i];
+        return true;
+    }
+    if (!checked) {
+        if (!map_hash_fits(table, n, record)) {
+            record = 0;
+        }
+        MP_STATE_VM(map_hash_cache)[slot].table = table;
+        MP_STATE_VM(map_hash_cache)[slot].record = record;
+        if (record == 0) {
+            return false;
+        }
+    }
+    *elem = NULL;
+    return true;
+}
+#endif
+
+static inline mp_uint_t map_hash(mp_obj_t index) {
+    // fast path for common case of qstr
+    if (mp_obj_is_qstr(index)) {
+        return qstr_hash(MP_OBJ_QSTR_VALUE(index));
+    } else {
+        return MP_OBJ_SMALL_INT_VALUE(mp_unary_op(MP_UNARY_OP_HASH, index));
+    }
+}
+
+static void map_free_table(mp_map_t *map) {
+    m_del(byte, map->table, map_table_nbytes(map->alloc, MAP_IS_COMPACT(map)));
+}
+
 /******************************************************************************/
 /* map                                                                        */
 
 void mp_map_init(mp_map_t *map, size_t n) {
+    // CIRCUITPY-CHANGE
+    bool compact = map_use_compact(n);
     if (n == 0) {
         map->alloc = 0;
         map->table = NULL;
     } else {
         map->alloc = n;
-        map->table = m_new0(mp_map_elem_t, map->alloc);
+        map->table = map_new_table(n, compact);
     }
     map->used = 0;
     map->all_keys_are_qstrs = 1;
     map->is_fixed = 0;
     map->is_ordered = 0;
+    #if MICROPY_OPT_MAP_COMPACT
+    map->is_compact = compact;
+    #endif
+    #if MICROPY_OPT_MAP_PERFECT_HASH
+    map->has_perfect_hash = 0;
+    #endif
 }
 
 void mp_map_init_fixed_table(mp_map_t *map, size_t n, const mp_obj_t *table) {
@@ -106,47 +297,186 @@ void mp_map_init_fixed_table(mp_map_t *map, size_t n, const mp_obj_t *table) {
     map->all_keys_are_qstrs = 1;
     map->is_fixed = 1;
     map->is_ordered = 1;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_MAP_COMPACT
+    map->is_compact = 0;
+    #endif
+    #if MICROPY_OPT_MAP_PERFECT_HASH
+    map->has_perfect_hash = 0;
+    #endif
     map->table = (mp_map_elem_t *)table;
 }
 
 // Differentiate from mp_map_clear() - semantics is different
 void mp_map_deinit(mp_map_t *map) {
     if (!map->is_fixed) {
-        m_del(mp_map_elem_t, map->table, map->alloc);
+        // CIRCUITPY-CHANGE
+        map_free_table(map);
     }
     map->used = map->alloc = 0;
 }
 
 void mp_map_clear(mp_map_t *map) {
     if (!map->is_fixed) {
-        m_del(mp_map_elem_t, map->table, map->alloc);
+        // CIRCUITPY-CHANGE
+        map_free_table(map);
     }
     map->alloc = 0;
     map->used = 0;
     map->all_keys_are_qstrs = 1;
     map->is_fixed = 0;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_MAP_COMPACT
+    map->is_compact = 0;
+    #endif
+    #if MICROPY_OPT_MAP_PERFECT_HASH
+    map->has_perfect_hash = 0;
+    #endif
     map->table = NULL;
 }
 
+// CIRCUITPY-CHANGE
+size_t mp_map_table_nbytes(const mp_map_t *map) {
+    return map_table_nbytes(map->alloc, MAP_IS_COMPACT(map));
+}
+
 static void mp_map_rehash(mp_map_t *map) {
     size_t old_alloc = map->alloc;
     size_t new_alloc = get_hash_alloc_greater_or_equal_to(map->alloc + 1);
+    // CIRCUITPY-CHANGE
+    bool old_compact = MAP_IS_COMPACT(map);
+    size_t old_fill = old_alloc;
+    #if MICROPY_OPT_MAP_COMPACT
+    if (old_compact) {
+        old_fill = MAP_INDEX(map)->fill;
+        if (map->used <= old_alloc / 2) {
+            // at least half the entries are deleted, so squeeze them out
+            // without growing the table
+            new_alloc = old_alloc;
+        }
+    }
+    #endif
+    bool new_compact = map_use_compact(new_alloc);
     DEBUG_printf("mp_map_rehash(%p): " UINT_FMT " -> " UINT_FMT "\n", map, old_alloc, new_alloc);
     mp_map_elem_t *old_table = map->table;
-    mp_map_elem_t *new_table = m_new0(mp_map_elem_t, new_alloc);
+    mp_map_elem_t *new_table = map_new_table(new_alloc, new_compact);
     // If we reach this point, table resizing succeeded, now we can edit the old map.
     map->alloc = new_alloc;
     map->used = 0;
     map->all_keys_are_qstrs = 1;
+    #if MICROPY_OPT_MAP_COMPACT
+    map->is_compact = new_compact;
+    #endif
     map->table = new_table;
-    for (size_t i = 0; i < old_alloc; i++) {
+    // A compact map is refilled in the old entry order, which also keeps an
+    // ordered map in order.
+    for (size_t i = 0; i < old_fill; i++) {
         if (old_table[i].key != MP_OBJ_NULL && old_table[i].key != MP_OBJ_SENTINEL) {
             mp_map_lookup(map, old_table[i].key, MP_MAP_LOOKUP_ADD_IF_NOT_FOUND)->value = old_table[i].value;
         }
     }
-    m_del(mp_map_elem_t, old_table, old_alloc);
+    m_del(byte, old_table, map_table_nbytes(old_alloc, old_compact));
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_MAP_COMPACT
+static mp_map_elem_t *mp_map_compact_lookup(mp_map_t *map, mp_obj_t index, mp_map_lookup_kind_t lookup_kind, bool compare_only_ptrs) {
+    mp_uint_t hash = map_hash(index);
+    uint32_t tag = map_index_tag(hash);
+    for (;;) {
+        mp_map_index_t *idx = MAP_INDEX(map);
+        size_t pos = hash & idx->mask;
+        uint32_t slot;
+        while ((slot = idx->slot[pos]) != 0) {
+            if ((slot & ~MAP_INDEX_POS_MASK) == tag) {
+                mp_map_elem_t *elem = &map->table[(slot & MAP_INDEX_POS_MASK) - 1];
+                if (elem->key == index
+                    || (!compare_only_ptrs && elem->key != MP_OBJ_SENTINEL && mp_obj_equal(elem->key, index))) {
+                    if (lookup_kind == MP_MAP_LOOKUP_REMOVE_IF_FOUND) {
+                        // leave a hole in the entries; keep elem->value so
+                        // that the caller can access it if needed
+                        map->used--;
+                        elem->key = MP_OBJ_SENTINEL;
+                        if (idx->slot[(pos + 1) & idx->mask] == 0) {
+                            // no probe continues past this slot, so empty
+                            // it, and reuse the entry if it was the last one
+                            idx->slot[pos] = 0;
+                            if (elem == &map->table[idx->fill - 1]) {
+                                idx->fill--;
+                            }
+                        }
+                    }
+                    MAP_CACHE_SET(index, elem - map->table);
+                    return elem;
+                }
+            }
+            pos = (pos + 1) & idx->mask;
+        }
+
+        // found an empty index slot, so index is not in the map
+        if (lookup_kind != MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
+            return NULL;
+        }
+        if (idx->fill < map->alloc) {
+            mp_map_elem_t *elem = &map->table[idx->fill++];
+            idx->slot[pos] = tag | idx->fill;
+            map->used++;
+            elem->key = index;
+            elem->value = MP_OBJ_NULL;
+            if (!mp_obj_is_qstr(index)) {
+                map->all_keys_are_qstrs = 0;
+            }
+            return elem;
+        }
+        // the entries are full, so rehash and search again
+        mp_map_rehash(map);
+        if (!map->is_compact) {
+            return mp_map_lookup(map, index, lookup_kind);
+        }
+    }
+}
+
+// Move elem, an entry of the compact map, to the end (or to the start if
+// !last) of the insertion order, then rebuild the index to match.
+void mp_map_compact_move_to_end(mp_map_t *map, mp_map_elem_t *elem, bool last) {
+    assert(map->is_compact);
+    mp_map_index_t *idx = MAP_INDEX(map);
+    mp_map_elem_t *table = map->table;
+    mp_map_elem_t new_elem = *elem;
+    elem->key = MP_OBJ_SENTINEL;
+
+    // squeeze out the holes, then put elem at the start or end
+    size_t n = 0;
+    for (size_t i = 0; i < idx->fill; i++) {
+        if (mp_map_slot_is_filled(map, i)) {
+            table[n++] = table[i];
+        }
+    }
+    if (last) {
+        table[n] = new_elem;
+    } else {
+        memmove(table + 1, table, n * sizeof(*table));
+        table[0] = new_elem;
+    }
+    n++;
+    for (size_t i = n; i < idx->fill; i++) {
+        table[i].key = MP_OBJ_NULL;
+        table[i].value = MP_OBJ_NULL;
+    }
+    idx->fill = n;
+
+    memset(idx->slot, 0, (idx->mask + 1) * sizeof(uint32_t));
+    for (size_t i = 0; i < n; i++) {
+        mp_uint_t hash = map_hash(table[i].key);
+        size_t pos = hash & idx->mask;
+        while (idx->slot[pos] != 0) {
+            pos = (pos + 1) & idx->mask;
+        }
+        idx->slot[pos] = map_index_tag(hash) | (i + 1);
+    }
+}
+#endif
+
 // MP_MAP_LOOKUP behaviour:
 //  - returns NULL if not found, else the slot it was found in with key,value non-null
 // MP_MAP_LOOKUP_ADD_IF_NOT_FOUND behaviour:
@@ -188,8 +518,25 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
         }
     }
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_MAP_COMPACT
+    if (map->is_compact) {
+        return mp_map_compact_lookup(map, index, lookup_kind, compare_only_ptrs);
+    }
+    #endif
+
     // if the map is an ordered array then we must do a brute force linear search
     if (map->is_ordered) {
+        // CIRCUITPY-CHANGE: unless it is a const table with a perfect hash
+        #if MICROPY_OPT_MAP_PERFECT_HASH
+        mp_map_elem_t *hashed_elem;
+        if (map->has_perfect_hash && map_perfect_hash_lookup(map, index, &hashed_elem)) {
+            if (hashed_elem != NULL) {
+                MAP_CACHE_SET(index, hashed_elem - map->table);
+            }
+            return hashed_elem;
+        }
+        #endif
         for (mp_map_elem_t *elem = &map->table[0], *top = &map->table[map->used]; elem < top; elem++) {
             if (elem->key == index || (!compare_only_ptrs && mp_obj_equal(elem->key, index))) {
                 #if MICROPY_PY_COLLECTIONS_ORDEREDDICT
@@ -214,6 +561,14 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
             return NULL;
         }
         if (map->used == map->alloc) {
+            // CIRCUITPY-CHANGE
+            #if MICROPY_OPT_MAP_COMPACT
+            if (map_use_compact(map->alloc + 4)) {
+                // large enough to switch to the compact layout, which keeps the order
+                mp_map_rehash(map);
+                return mp_map_lookup(map, index, lookup_kind);
+            }
+            #endif
             // TODO: Alloc policy
             map->alloc += 4;
             map->table = m_renew(mp_map_elem_t, map->table, map->used, map->alloc);
@@ -236,18 +591,18 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
     if (map->alloc == 0) {
         if (lookup_kind == MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
             mp_map_rehash(map);
+            // CIRCUITPY-CHANGE
+            if (MAP_IS_COMPACT(map)) {
+                return mp_map_lookup(map, index, lookup_kind);
+            }
         } else {
             return NULL;
         }
     }
 
-    // get hash of index, with fast path for common case of qstr
-    mp_uint_t hash;
-    if (mp_obj_is_qstr(index)) {
-        hash = qstr_hash(MP_OBJ_QSTR_VALUE(index));
-    } else {
-        hash = MP_OBJ_SMALL_INT_VALUE(mp_unary_op(MP_UNARY_OP_HASH, index));
-    }
+    // get hash of index
+    // CIRCUITPY-CHANGE: shared with the compact layout
+    mp_uint_t hash = map_hash(index);
 
     size_t pos = hash % map->alloc;
     size_t start_pos = pos;
@@ -311,6 +666,10 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
                 } else {
                     // not enough room in table, rehash it
                     mp_map_rehash(map);
+                    // CIRCUITPY-CHANGE
+                    if (MAP_IS_COMPACT(map)) {
+                        return mp_map_lookup(map, index, lookup_kind);
+                    }
                     // restart the search for the new element
                     start_pos = pos = hash % map->alloc;
                 }
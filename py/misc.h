@@ -77,6 +77,9 @@ typedef unsigned int uint;
 #define m_new(type, num) ((type *)(m_malloc(sizeof(type) * (num))))
 #define m_new_maybe(type, num) ((type *)(m_malloc_maybe(sizeof(type) * (num))))
 #define m_new0(type, num) ((type *)(m_malloc0(sizeof(type) * (num))))
+// CIRCUITPY-CHANGE: for data worked through in bulk, see GC_ALLOC_FLAG_BULK. The data
+// must not hold heap pointers, see GC_ALLOC_FLAG_NO_SCAN.
+#define m_new_bulk(type, num) ((type *)(m_malloc_bulk(sizeof(type) * (num))))
 #define m_new_obj(type) (m_new(type, 1))
 #define m_new_obj_maybe(type) (m_new_maybe(type, 1))
 #define m_new_obj_var(obj_type, var_field, var_type, var_num) ((obj_type *)m_malloc(offsetof(obj_type, var_field) + sizeof(var_type) * (var_num)))
@@ -98,6 +101,8 @@ typedef unsigned int uint;
 void *m_malloc(size_t num_bytes);
 void *m_malloc_maybe(size_t num_bytes);
 void *m_malloc_with_finaliser(size_t num_bytes);
+// CIRCUITPY-CHANGE
+void *m_malloc_bulk(size_t num_bytes);
 void *m_malloc0(size_t num_bytes);
 #if MICROPY_MALLOC_USES_ALLOCATED_SIZE
 void *m_realloc(void *ptr, size_t old_num_bytes, size_t new_num_bytes);
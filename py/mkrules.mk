@@ -19,6 +19,8 @@ OBJ_EXTRA_ORDER_DEPS =
 
 # Generate header files.
 OBJ_EXTRA_ORDER_DEPS += $(HEADER_BUILD)/moduledefs.h $(HEADER_BUILD)/root_pointers.h
+# CIRCUITPY-CHANGE
+OBJ_EXTRA_ORDER_DEPS += $(HEADER_BUILD)/map_hashes.h
 
 ifeq ($(MICROPY_ROM_TEXT_COMPRESSION),1)
 # If compression is enabled, trigger the build of compressed.data.h...
@@ -151,6 +153,17 @@ $(HEADER_BUILD)/root_pointers.collected: $(HEADER_BUILD)/root_pointers.split
 	$(STEPECHO) "GEN $@"
 	$(Q)$(PYTHON) $(PY_SRC)/makeqstrdefs.py cat root_pointer _ $(HEADER_BUILD)/root_pointer $@
 
+# CIRCUITPY-CHANGE
+# Keys of const map tables, for the perfect hashes in map_hashes.h.
+$(HEADER_BUILD)/map_tables.split: $(HEADER_BUILD)/qstr.i.last
+	$(STEPECHO) "GEN $@"
+	$(Q)$(PYTHON) $(PY_SRC)/makeqstrdefs.py split map_table $< $(HEADER_BUILD)/map_table _
+	$(Q)$(TOUCH) $@
+
+$(HEADER_BUILD)/map_tables.collected: $(HEADER_BUILD)/map_tables.split
+	$(STEPECHO) "GEN $@"
+	$(Q)$(PYTHON) $(PY_SRC)/makeqstrdefs.py cat map_table _ $(HEADER_BUILD)/map_table $@
+
 # Compressed error strings.
 $(HEADER_BUILD)/compressed.split: $(HEADER_BUILD)/qstr.i.last
 	$(STEPECHO) "GEN $@"
@@ -205,7 +218,7 @@ CFLAGS += -DMICROPY_MODULE_FROZEN_STR
 # to build frozen_content.c from a manifest
 $(BUILD)/frozen_content.c: FORCE $(BUILD)/genhdr/qstrdefs.generated.h $(BUILD)/genhdr/root_pointers.h $(FROZEN_MANIFEST) | $(MICROPY_MPYCROSS_DEPENDENCY)
 	$(Q)test -e "$(MPY_LIB_DIR)/README.md" || (echo -e $(HELP_MPY_LIB_SUBMODULE); false)
-	$(Q)$(MAKE_MANIFEST) -o $@ -v "MPY_DIR=$(TOP)" -v "MPY_LIB_DIR=$(MPY_LIB_DIR)" -v "PORT_DIR=$(shell pwd)" -v "BOARD_DIR=$(BOARD_DIR)" -b "$(BUILD)" $(if $(MPY_CROSS_FLAGS),-f"$(MPY_CROSS_FLAGS)",) --mpy-tool-flags="$(MPY_TOOL_FLAGS)" $(FROZEN_MANIFEST)
+	$(Q)$(MAKE_MANIFEST) -o $@ -v "MPY_DIR=$(TOP)" -v "MPY_LIB_DIR=$(MPY_LIB_DIR)" -v "PORT_DIR=$(shell pwd)" -v "BOARD_DIR=$(BOARD_DIR)" -b "$(BUILD)" $(if $(MPY_CROSS_FLAGS),-f"$(MPY_CROSS_FLAGS)",) --mpy-tool-flags="$(MPY_TOOL_FLAGS)" --mpy-cross-native-flags="$(MPY_CROSS_NATIVE_FLAGS)" $(FROZEN_MANIFEST)
 endif
 
 ifneq ($(PROG),)
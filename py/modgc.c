@@ -41,6 +41,15 @@ static mp_obj_t py_gc_collect(void) {
 }
 MP_DEFINE_CONST_FUN_OBJ_0(gc_collect_obj, py_gc_collect);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_COMPACT
+// compact(): collect and move large buffers to merge free space
+static mp_obj_t py_gc_compact(void) {
+    return MP_OBJ_NEW_SMALL_INT(gc_compact());
+}
+MP_DEFINE_CONST_FUN_OBJ_0(gc_compact_obj, py_gc_compact);
+#endif
+
 // disable(): disable the garbage collector
 static mp_obj_t gc_disable(void) {
     MP_STATE_MEM(gc_auto_collect_enabled) = 0;
@@ -103,6 +112,10 @@ MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_threshold_obj, 0, 1, gc_threshold);
 static const mp_rom_map_elem_t mp_module_gc_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_gc) },
     { MP_ROM_QSTR(MP_QSTR_collect), MP_ROM_PTR(&gc_collect_obj) },
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_COMPACT
+    { MP_ROM_QSTR(MP_QSTR_compact), MP_ROM_PTR(&gc_compact_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_disable), MP_ROM_PTR(&gc_disable_obj) },
     { MP_ROM_QSTR(MP_QSTR_enable), MP_ROM_PTR(&gc_enable_obj) },
     { MP_ROM_QSTR(MP_QSTR_isenabled), MP_ROM_PTR(&gc_isenabled_obj) },
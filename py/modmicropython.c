@@ -31,6 +31,9 @@
 #include "py/runtime.h"
 #include "py/gc.h"
 #include "py/mphal.h"
+// CIRCUITPY-CHANGE
+#include "py/profile.h"
+#include "py/stream.h"
 
 #if MICROPY_PY_MICROPYTHON
 
@@ -172,6 +175,33 @@ static mp_obj_t mp_micropython_schedule(mp_obj_t function, mp_obj_t arg) {
 static MP_DEFINE_CONST_FUN_OBJ_2(mp_micropython_schedule_obj, mp_micropython_schedule);
 #endif
 
+// CIRCUITPY-CHANGE: sampling profiler
+#if MICROPY_PY_MICROPYTHON_PROFILE
+static mp_obj_t mp_micropython_profile_start(void) {
+    mp_prof_sample_start();
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(mp_micropython_profile_start_obj, mp_micropython_profile_start);
+
+static mp_obj_t mp_micropython_profile_stop(void) {
+    mp_prof_sample_stop();
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(mp_micropython_profile_stop_obj, mp_micropython_profile_stop);
+
+static mp_obj_t mp_micropython_profile_dump(size_t n_args, const mp_obj_t *args) {
+    if (n_args == 0 || args[0] == mp_const_none) {
+        mp_prof_sample_dump(&mp_plat_print);
+    } else {
+        mp_get_stream_raise(args[0], MP_STREAM_OP_WRITE);
+        mp_print_t print = {MP_OBJ_TO_PTR(args[0]), mp_stream_write_adaptor};
+        mp_prof_sample_dump(&print);
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp_micropython_profile_dump_obj, 0, 1, mp_micropython_profile_dump);
+#endif
+
 static const mp_rom_map_elem_t mp_module_micropython_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_micropython) },
     { MP_ROM_QSTR(MP_QSTR_const), MP_ROM_PTR(&mp_identity_obj) },
@@ -216,6 +246,12 @@ static const mp_rom_map_elem_t mp_module_micropython_globals_table[] = {
     #if MICROPY_ENABLE_SCHEDULER
     { MP_ROM_QSTR(MP_QSTR_schedule), MP_ROM_PTR(&mp_micropython_schedule_obj) },
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_MICROPYTHON_PROFILE
+    { MP_ROM_QSTR(MP_QSTR_profile_start), MP_ROM_PTR(&mp_micropython_profile_start_obj) },
+    { MP_ROM_QSTR(MP_QSTR_profile_stop), MP_ROM_PTR(&mp_micropython_profile_stop_obj) },
+    { MP_ROM_QSTR(MP_QSTR_profile_dump), MP_ROM_PTR(&mp_micropython_profile_dump_obj) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(mp_module_micropython_globals, mp_module_micropython_globals_table);
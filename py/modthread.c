@@ -174,6 +174,10 @@ static void *thread_entry(void *args_in) {
 
     ts.nlr_jump_callback_top = NULL;
     ts.mp_pending_exception = MP_OBJ_NULL;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_TRACEBACK_BUFFER_ENTRIES
+    ts.traceback_buffer_owner = NULL;
+    #endif
 
     // set locals and globals from the calling context
     mp_locals_set(args->dict_locals);
@@ -208,6 +212,9 @@ static void *thread_entry(void *args_in) {
         }
     }
 
+    // CIRCUITPY-CHANGE: ts is about to go away
+    mp_obj_exception_release_traceback_buffer();
+
     DEBUG_printf("[thread] finish ts=%p\n", &ts);
 
     // signal that we are finished
@@ -187,6 +187,13 @@
 #define MICROPY_ALLOC_GC_STACK_SIZE (64)
 #endif
 
+// CIRCUITPY-CHANGE: when the GC stack overflows, continue marking on a larger
+// stack borrowed from the longest run of free heap blocks. The full heap
+// rescan is then only needed when that overflows too.
+#ifndef MICROPY_GC_BORROW_STACK
+#define MICROPY_GC_BORROW_STACK (MICROPY_ENABLE_GC)
+#endif
+
 // The C-type to use for entries in the GC stack.  By default it allows the
 // heap to be as large as the address space, but the bit-width of this type can
 // be reduced to save memory when the heap is small enough.  The type must be
@@ -342,6 +349,17 @@
 #define MICROPY_PERSISTENT_CODE_LOAD (0)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether .mpy files whose contents can be memory mapped (their VFS file
+// answers MP_STREAM_GET_DATA_PTR) are loaded from the mapping.  If the mapping
+// outlives the file, as on memory-mapped flash, bytecode runs in place instead
+// of being copied to the heap, so only the parts of a module that execute are
+// ever read from storage.  The file must not change while it is imported.
+// Requires MICROPY_READER_VFS.
+#ifndef MICROPY_PERSISTENT_CODE_LOAD_IN_PLACE
+#define MICROPY_PERSISTENT_CODE_LOAD_IN_PLACE (0)
+#endif
+
 // Whether to support saving of persistent code, i.e. for mpy-cross to
 // generate .mpy files. Enabling this enables additional metadata on raw code
 // objects which is also required for sys.settrace.
@@ -388,6 +406,17 @@
 #define MICROPY_EMIT_THUMB_ARMV7M (1)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether thumb native code may use the single-precision VFP unit, giving
+// viper its unboxed float and ptrf types
+#ifndef MICROPY_EMIT_THUMB_VFP
+#if defined(__ARM_FP) && (__ARM_FP & 4) == 4
+#define MICROPY_EMIT_THUMB_VFP (MICROPY_EMIT_THUMB_ARMV7M)
+#else
+#define MICROPY_EMIT_THUMB_VFP (0)
+#endif
+#endif
+
 // Whether to enable the thumb inline assembler
 #ifndef MICROPY_EMIT_INLINE_THUMB
 #define MICROPY_EMIT_INLINE_THUMB (0)
@@ -458,6 +487,16 @@
 #define MICROPY_DYNAMIC_COMPILER (0)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether files are parsed and compiled one top-level statement at a time, so
+// that only the largest statement's parse tree is in memory at once.  With
+// MICROPY_MODULE_PYCACHE, import doesn't stream: a cache hit loads the compiled
+// module without parsing, and a miss parses the whole file so that it compiles
+// to a single module that can be saved.
+#ifndef MICROPY_PARSE_STREAMING
+#define MICROPY_PARSE_STREAMING (0)
+#endif
+
 // Whether the compiler allows compiling top-level await expressions
 #ifndef MICROPY_COMP_ALLOW_TOP_LEVEL_AWAIT
 #define MICROPY_COMP_ALLOW_TOP_LEVEL_AWAIT (0)
@@ -468,6 +507,12 @@
 #define MICROPY_COMP_CONST_FOLDING (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_CORE_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether constant folding also covers float arithmetic and str concatenation; eg 1/2 rewritten as 0.5
+#ifndef MICROPY_COMP_CONST_FOLDING_FLOAT_STR
+#define MICROPY_COMP_CONST_FOLDING_FLOAT_STR (MICROPY_COMP_CONST_FOLDING && MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EVERYTHING)
+#endif
+
 // Whether to compile constant tuples immediately to their respective objects; eg (1, True)
 // Otherwise the tuple will be built at runtime
 #ifndef MICROPY_COMP_CONST_TUPLE
@@ -593,6 +638,69 @@
 #define MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE (128)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether maps with at least MICROPY_OPT_MAP_COMPACT_MIN_ALLOC slots use a
+// compact layout: entries kept in insertion order, followed by a separate
+// open-addressed index that stores a few bits of each key's hash. Lookups in
+// large dicts probe fewer cache lines and compare fewer keys, large dicts
+// iterate in insertion order, and large OrderedDicts no longer need a linear
+// search. Costs about 1.5 to 3 words of RAM per slot for the index.
+#ifndef MICROPY_OPT_MAP_COMPACT
+#define MICROPY_OPT_MAP_COMPACT (0)
+#endif
+
+#ifndef MICROPY_OPT_MAP_COMPACT_MIN_ALLOC
+#define MICROPY_OPT_MAP_COMPACT_MIN_ALLOC (17)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether lookups in const tables from MP_DEFINE_CONST_MAP/DICT with at least
+// 8 keys use an order-preserving minimal perfect hash generated at build time
+// by py/make_map_hashes.py, instead of a linear search. Costs about 2 bytes
+// of flash per key, plus 14 bytes per table.
+#ifndef MICROPY_OPT_MAP_PERFECT_HASH
+#define MICROPY_OPT_MAP_PERFECT_HASH (0)
+#endif
+
+// CIRCUITPY-CHANGE
+// Number of const tables, by address, remembered to have been checked against
+// their perfect hash. A table that misses the cache is checked again.
+#ifndef MICROPY_OPT_MAP_PERFECT_HASH_CACHE_SIZE
+#define MICROPY_OPT_MAP_PERFECT_HASH_CACHE_SIZE (32)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether each dynamically allocated qstr pool carries an open-addressed hash
+// index over its entries, so that qstr_find_strn (used when interning names in
+// the compiler, at import, and for getattr with a str) doesn't scan the pool.
+// Costs 2 bytes of RAM for every 2/3 of a pool entry, or less.
+#ifndef MICROPY_OPT_QSTR_INDEX
+#define MICROPY_OPT_QSTR_INDEX (0)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether the VM remembers, per call site, where LOAD_GLOBAL, LOAD_ATTR and
+// LOAD_METHOD last found their name in a globals, module or instance map.
+// Each bytecode function that runs such an opcode gets a table of
+// MICROPY_OPT_VM_INLINE_CACHE_SIZE entries (two 16-bit words each, a power of
+// two) on the heap.
+#ifndef MICROPY_OPT_VM_INLINE_CACHE
+#define MICROPY_OPT_VM_INLINE_CACHE (0)
+#endif
+
+#ifndef MICROPY_OPT_VM_INLINE_CACHE_SIZE
+#define MICROPY_OPT_VM_INLINE_CACHE_SIZE (8)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether the bytecode emitter fuses a few common opcode sequences (self.x,
+// self.x = v, self.f(), and x = x <op> k with local x and small int k) into
+// single opcodes, and the VM executes them. .mpy files with fused opcodes
+// are flagged so they load only on firmware with this enabled.
+#ifndef MICROPY_BC_FUSED_OPS
+#define MICROPY_BC_FUSED_OPS (0)
+#endif
+
 // Whether to use fast versions of bitwise operations (and, or, xor) when the
 // arguments are both positive.  Increases Thumb2 code size by about 250 bytes.
 #ifndef MICROPY_OPT_MPZ_BITWISE
@@ -679,6 +787,56 @@
 #define MICROPY_GC_SPLIT_HEAP_AUTO (0)
 #endif
 
+// CIRCUITPY-CHANGE
+// Number of power-of-two size classes (1, 2, 4, ... blocks) for which the GC
+// remembers the first allocation table byte that may start a free run of at
+// least that many blocks.  The hints are rebuilt during sweep, so allocation
+// of small objects no longer rescans the fragmented start of the heap.  A
+// value of 1 gives the original single "last free" index behaviour.
+#ifndef MICROPY_GC_FREE_SIZE_CLASSES
+#define MICROPY_GC_FREE_SIZE_CLASSES (1)
+#endif
+
+// CIRCUITPY-CHANGE
+// Allocations of at most this many blocks are placed in the area added with
+// gc_add_fast_area(), if there is one, so that small objects that are touched
+// most often live in the port's fastest RAM.  Larger allocations only use the
+// fast area when nothing else fits after a collection.  This only chooses
+// where blocks go; every collection is still a full one.  0 disables the fast
+// area.  Requires MICROPY_GC_SPLIT_HEAP.
+#ifndef MICROPY_GC_FAST_AREA_MAX_BLOCKS
+#define MICROPY_GC_FAST_AREA_MAX_BLOCKS (0)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether to provide gc_compact(), which moves large buffers towards the start
+// of the heap to merge the free space around them. A buffer is only moved if
+// the single word referring to it is the data pointer of a bytearray, array or
+// (with displayio) Bitmap, which is then updated. Memory that the collector
+// doesn't scan must not hold pointers to such buffers.
+#ifndef MICROPY_GC_COMPACT
+#define MICROPY_GC_COMPACT (0)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether to keep a bit per block saying that the block holds no pointers, set
+// by allocating with GC_ALLOC_FLAG_NO_SCAN. Marking then skips the contents of
+// such blocks, such as bitmaps and sample buffers, which is faster and keeps
+// stray data that looks like pointers from holding on to memory.
+#ifndef MICROPY_GC_NO_SCAN
+#define MICROPY_GC_NO_SCAN (0)
+#endif
+
+// Smallest buffer, in blocks, that gc_compact() considers moving.
+#ifndef MICROPY_GC_COMPACT_MIN_BLOCKS
+#define MICROPY_GC_COMPACT_MIN_BLOCKS (16)
+#endif
+
+// Number of buffers that a single gc_compact() call considers.
+#ifndef MICROPY_GC_COMPACT_MAX_CANDIDATES
+#define MICROPY_GC_COMPACT_MAX_CANDIDATES (16)
+#endif
+
 // Hook to run code during time consuming garbage collector operations
 // *i* is the loop index variable (e.g. can be used to run every x loops)
 #ifndef MICROPY_GC_HOOK_LOOP
@@ -722,6 +880,15 @@
 #endif
 #endif
 
+// CIRCUITPY-CHANGE
+// Number of traceback entries that a propagating exception records in a static
+// buffer before its traceback is copied to the heap. The copy is made once,
+// with the exact size, when the exception is caught, so unwinding deep stacks
+// doesn't grow the traceback one frame at a time. 0 disables the buffer.
+#ifndef MICROPY_TRACEBACK_BUFFER_ENTRIES
+#define MICROPY_TRACEBACK_BUFFER_ENTRIES (8)
+#endif
+
 // Whether to provide the mp_kbd_exception object, and micropython.kbd_intr function
 #ifndef MICROPY_KBD_EXCEPTION
 #define MICROPY_KBD_EXCEPTION (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
@@ -962,6 +1129,17 @@ typedef double mp_float_t;
 #define MICROPY_MODULE_OVERRIDE_MAIN_IMPORT (0)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether importing foo.py saves the compiled code to __pycache__/foo.mpy in the
+// same directory, and later imports load that instead of compiling foo.py while
+// its size and contents hash are unchanged. Failing to write the cache, e.g.
+// on a read-only filesystem, isn't an error. Imports then don't use
+// MICROPY_PARSE_STREAMING, even when the cache misses. Requires MICROPY_VFS,
+// MICROPY_READER_VFS, MICROPY_PERSISTENT_CODE_LOAD and MICROPY_PERSISTENT_CODE_SAVE.
+#ifndef MICROPY_MODULE_PYCACHE
+#define MICROPY_MODULE_PYCACHE (0)
+#endif
+
 // Whether frozen modules are supported in the form of strings
 #ifndef MICROPY_MODULE_FROZEN_STR
 #define MICROPY_MODULE_FROZEN_STR (0)
@@ -1073,6 +1251,15 @@ typedef double mp_float_t;
 #define MICROPY_PY_DESCRIPTORS (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether to support __slots__ in classes.  Instances of a class with __slots__
+// get an attribute table sized for the slots up front, and can't have any
+// other attributes.  Values are not stored inline, so unlike CPython this
+// doesn't make instances any smaller.
+#ifndef MICROPY_PY_CLASS_SLOTS
+#define MICROPY_PY_CLASS_SLOTS (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 // Whether to support class __delattr__ and __setattr__ methods
 // This costs some code size and makes store/delete of instance
 // attributes slower for the classes that use this feature
@@ -1334,6 +1521,24 @@ typedef double mp_float_t;
 #define MICROPY_PY_MICROPYTHON_HEAP_LOCKED (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EVERYTHING)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether to provide the "micropython.profile_*" sampling profiler. The VM keeps
+// the chain of running bytecode frames, which a port timer samples by calling
+// mp_prof_sample(); the port provides mp_prof_sample_timer() to drive it.
+#ifndef MICROPY_PY_MICROPYTHON_PROFILE
+#define MICROPY_PY_MICROPYTHON_PROFILE (0)
+#endif
+
+// Number of distinct call stacks the sampling profiler can count
+#ifndef MICROPY_PY_MICROPYTHON_PROFILE_ENTRIES
+#define MICROPY_PY_MICROPYTHON_PROFILE_ENTRIES (64)
+#endif
+
+// Number of frames, from the innermost, recorded for each sample
+#ifndef MICROPY_PY_MICROPYTHON_PROFILE_DEPTH
+#define MICROPY_PY_MICROPYTHON_PROFILE_DEPTH (8)
+#endif
+
 // Whether to provide "array" module. Note that large chunk of the
 // underlying code is shared with "bytearray" builtin type, so to
 // get real savings, it should be disabled too.
@@ -1691,6 +1896,12 @@ typedef double mp_float_t;
 #define MICROPY_PY_JSON_SEPARATORS (1)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether to support the "select" argument to load, loads
+#ifndef MICROPY_PY_JSON_SELECT
+#define MICROPY_PY_JSON_SELECT (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 #ifndef MICROPY_PY_OS
 #define MICROPY_PY_OS (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
@@ -1719,10 +1930,29 @@ typedef double mp_float_t;
 #define MICROPY_PY_RE_SUB (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Number of patterns compiled by the module level re functions to keep for reuse, 0 to disable
+#ifndef MICROPY_PY_RE_CACHE_SIZE
+#define MICROPY_PY_RE_CACHE_SIZE (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES ? 4 : 0)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether to match long subjects with a Pike VM, which takes linear time and doesn't recurse
+// for every character, instead of by backtracking
+#ifndef MICROPY_PY_RE_PIKEVM
+#define MICROPY_PY_RE_PIKEVM (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 #ifndef MICROPY_PY_HEAPQ
 #define MICROPY_PY_HEAPQ (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether to provide the heapq.PriorityQueue type
+#ifndef MICROPY_PY_HEAPQ_PRIORITYQUEUE
+#define MICROPY_PY_HEAPQ_PRIORITYQUEUE (MICROPY_PY_HEAPQ && MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 #ifndef MICROPY_PY_HASHLIB
 #define MICROPY_PY_HASHLIB (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
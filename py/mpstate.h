@@ -74,6 +74,8 @@ typedef struct mp_dynamic_compiler_t {
     uint8_t small_int_bits; // must be <= host small_int_bits
     uint8_t native_arch;
     uint8_t nlr_buf_num_regs;
+    // CIRCUITPY-CHANGE
+    bool bc_fused_ops;
 } mp_dynamic_compiler_t;
 extern mp_dynamic_compiler_t mp_dynamic_compiler;
 #endif
@@ -100,10 +102,15 @@ typedef struct _mp_state_mem_area_t {
     #if MICROPY_ENABLE_FINALISER
     byte *gc_finaliser_table_start;
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_NO_SCAN
+    byte *gc_no_scan_table_start;
+    #endif
     byte *gc_pool_start;
     byte *gc_pool_end;
 
-    size_t gc_last_free_atb_index;
+    // CIRCUITPY-CHANGE: one hint per size class, see MICROPY_GC_FREE_SIZE_CLASSES
+    size_t gc_last_free_atb_index[MICROPY_GC_FREE_SIZE_CLASSES];
     size_t gc_last_used_block; // The block ID of the highest block allocated in the area
 } mp_state_mem_area_t;
 
@@ -117,6 +124,11 @@ typedef struct _mp_state_mem_t {
 
     mp_state_mem_area_t area;
 
+    // CIRCUITPY-CHANGE: area preferred by small allocations, see gc_add_fast_area
+    #if MICROPY_GC_FAST_AREA_MAX_BLOCKS
+    mp_state_mem_area_t *gc_fast_area;
+    #endif
+
     int gc_stack_overflow;
     MICROPY_GC_STACK_ENTRY_TYPE gc_block_stack[MICROPY_ALLOC_GC_STACK_SIZE];
     #if MICROPY_GC_SPLIT_HEAP
@@ -266,6 +278,14 @@ typedef struct _mp_state_vm_t {
     // See mp_map_lookup.
     uint8_t map_lookup_cache[MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE];
     #endif
+
+    // CIRCUITPY-CHANGE: const tables checked against their perfect hash, see py/map.c
+    #if MICROPY_OPT_MAP_PERFECT_HASH
+    struct {
+        const mp_map_elem_t *table;
+        uint16_t record; // 1-based index into mp_map_hash_table, 0 if none fits
+    } map_hash_cache[MICROPY_OPT_MAP_PERFECT_HASH_CACHE_SIZE];
+    #endif
 } mp_state_vm_t;
 
 // This structure holds state that is specific to a given thread. Everything
@@ -294,6 +314,12 @@ typedef struct _mp_state_thread_t {
     // Locking of the GC is done per thread.
     uint16_t gc_lock_depth;
 
+    // CIRCUITPY-CHANGE: traceback of the propagating exception, see MICROPY_TRACEBACK_BUFFER_ENTRIES
+    #if MICROPY_TRACEBACK_BUFFER_ENTRIES
+    mp_obj_traceback_t traceback_buffer;
+    size_t traceback_buffer_data[MICROPY_TRACEBACK_BUFFER_ENTRIES * 3]; // (file, line, block) per entry
+    #endif
+
     ////////////////////////////////////////////////////////////
     // START ROOT POINTER SECTION
     // Everything that needs GC scanning must start here, and
@@ -312,9 +338,17 @@ typedef struct _mp_state_thread_t {
     // If MP_OBJ_STOP_ITERATION is propagated then this holds its argument.
     mp_obj_t stop_iteration_arg;
 
+    // CIRCUITPY-CHANGE: reachable so that it isn't freed while using traceback_buffer
+    #if MICROPY_TRACEBACK_BUFFER_ENTRIES
+    struct _mp_obj_exception_t *traceback_buffer_owner;
+    #endif
+
     #if MICROPY_PY_SYS_SETTRACE
     mp_obj_t prof_trace_callback;
     bool prof_callback_is_executing;
+    #endif
+    // CIRCUITPY-CHANGE: also kept for the sampling profiler
+    #if MICROPY_PY_SYS_SETTRACE || MICROPY_PY_MICROPYTHON_PROFILE
     struct _mp_code_state_t *current_code_state;
     #endif
 
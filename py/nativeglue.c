@@ -33,6 +33,8 @@
 #include "py/runtime.h"
 #include "py/smallint.h"
 #include "py/nativeglue.h"
+// CIRCUITPY-CHANGE: for MP_NATIVE_ARCH_xxx
+#include "py/persistentcode.h"
 // CIRCUITPY-CHANGE
 #include "py/objtype.h"
 #include "py/gc.h"
@@ -45,6 +47,19 @@
 
 #if MICROPY_EMIT_NATIVE
 
+// CIRCUITPY-CHANGE: viper float values live in core registers as raw
+// single-precision bits and are operated on with VFP instructions.
+static bool mp_native_has_float(void) {
+    #if !MICROPY_PY_BUILTINS_FLOAT
+    return false;
+    #elif MICROPY_DYNAMIC_COMPILER
+    return mp_dynamic_compiler.native_arch == MP_NATIVE_ARCH_ARMV7EMSP
+           || mp_dynamic_compiler.native_arch == MP_NATIVE_ARCH_ARMV7EMDP;
+    #else
+    return MICROPY_EMIT_THUMB && MICROPY_EMIT_THUMB_VFP;
+    #endif
+}
+
 int mp_native_type_from_qstr(qstr qst) {
     switch (qst) {
         case MP_QSTR_object:
@@ -63,6 +78,11 @@ int mp_native_type_from_qstr(qstr qst) {
             return MP_NATIVE_TYPE_PTR16;
         case MP_QSTR_ptr32:
             return MP_NATIVE_TYPE_PTR32;
+        // CIRCUITPY-CHANGE
+        case MP_QSTR_float:
+            return mp_native_has_float() ? MP_NATIVE_TYPE_FLOAT : -1;
+        case MP_QSTR_ptrf:
+            return mp_native_has_float() ? MP_NATIVE_TYPE_PTRF : -1;
         default:
             return -1;
     }
@@ -79,6 +99,17 @@ mp_uint_t mp_native_from_obj(mp_obj_t obj, mp_uint_t type) {
         case MP_NATIVE_TYPE_INT:
         case MP_NATIVE_TYPE_UINT:
             return mp_obj_get_int_truncated(obj);
+        // CIRCUITPY-CHANGE
+        #if MICROPY_PY_BUILTINS_FLOAT
+        case MP_NATIVE_TYPE_FLOAT: {
+            union {
+                uint32_t i;
+                float f;
+            } fpu;
+            fpu.f = mp_obj_get_float_to_f(obj);
+            return fpu.i;
+        }
+        #endif
         default: { // cast obj to a pointer
             mp_buffer_info_t bufinfo;
             if (mp_get_buffer(obj, &bufinfo, MP_BUFFER_READ)) {
@@ -109,6 +140,16 @@ mp_obj_t mp_native_to_obj(mp_uint_t val, mp_uint_t type) {
             return mp_obj_new_int_from_uint(val);
         case MP_NATIVE_TYPE_QSTR:
             return MP_OBJ_NEW_QSTR(val);
+        // CIRCUITPY-CHANGE
+        #if MICROPY_PY_BUILTINS_FLOAT
+        case MP_NATIVE_TYPE_FLOAT: {
+            union {
+                uint32_t i;
+                float f;
+            } fpu = {val};
+            return mp_obj_new_float_from_f(fpu.f);
+        }
+        #endif
         default: // a pointer
             // we return just the value of the pointer as an integer
             return mp_obj_new_int_from_uint(val);
@@ -289,6 +289,15 @@ static inline bool mp_obj_is_obj(mp_const_obj_t o) {
 #define MP_OBJ_TO_PTR(o) ((void *)(uintptr_t)(o))
 #define MP_OBJ_FROM_PTR(p) ((mp_obj_t)((uintptr_t)(p)))
 
+// CIRCUITPY-CHANGE: 64-bit pointers fill the word already, so need no widening.
+#if UINTPTR_MAX > UINT32_MAX
+typedef union _mp_rom_obj_t {
+    uint64_t u64;
+} mp_rom_obj_t;
+#define MP_ROM_INT(i) {MP_OBJ_NEW_SMALL_INT(i)}
+#define MP_ROM_QSTR(q) {MP_OBJ_NEW_QSTR(q)}
+#define MP_ROM_PTR(p) {.u64 = (uint64_t)(uintptr_t)(p)}
+#else
 // rom object storage needs special handling to widen 32-bit pointer to 64-bits
 typedef union _mp_rom_obj_t {
     uint64_t u64;
@@ -303,6 +312,7 @@ typedef union _mp_rom_obj_t {
 #else
 #define MP_ROM_PTR(p) {.u32 = {.lo = NULL, .hi = (p)}}
 #endif
+#endif
 
 #endif
 
@@ -399,11 +409,18 @@ typedef struct _mp_rom_obj_t { mp_const_obj_t o; } mp_rom_obj_t;
 // These macros are used to define constant or mutable map/dict objects
 // You can put "static" in front of the definition to make it local
 
+#if MICROPY_OPT_MAP_PERFECT_HASH
+#define MP_MAP_PERFECT_HASH_INIT .has_perfect_hash = 1,
+#else
+#define MP_MAP_PERFECT_HASH_INIT
+#endif
+
 #define MP_DEFINE_CONST_MAP(map_name, table_name) \
     const mp_map_t map_name = { \
         .all_keys_are_qstrs = 1, \
         .is_fixed = 1, \
         .is_ordered = 1, \
+        MP_MAP_PERFECT_HASH_INIT \
         .used = MP_ARRAY_SIZE(table_name), \
         .alloc = MP_ARRAY_SIZE(table_name), \
         .table = (mp_map_elem_t *)(mp_rom_map_elem_t *)table_name, \
@@ -416,6 +433,7 @@ typedef struct _mp_rom_obj_t { mp_const_obj_t o; } mp_rom_obj_t;
             .all_keys_are_qstrs = 1, \
             .is_fixed = 1, \
             .is_ordered = 1, \
+            MP_MAP_PERFECT_HASH_INIT \
             .used = n, \
             .alloc = n, \
             .table = (mp_map_elem_t *)(mp_rom_map_elem_t *)table_name, \
@@ -495,7 +513,14 @@ typedef struct _mp_map_t {
     size_t all_keys_are_qstrs : 1;
     size_t is_fixed : 1;    // if set, table is fixed/read-only and can't be modified
     size_t is_ordered : 1;  // if set, table is an ordered array, not a hash map
-    size_t used : (8 * sizeof(size_t) - 3);
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_MAP_COMPACT
+    size_t is_compact : 1;  // if set, entries are in insertion order and followed by a hash index
+    #endif
+    #if MICROPY_OPT_MAP_PERFECT_HASH
+    size_t has_perfect_hash : 1; // if set, table is const and may have a generated perfect hash
+    #endif
+    size_t used : (8 * sizeof(size_t) - 3 - MICROPY_OPT_MAP_COMPACT - MICROPY_OPT_MAP_PERFECT_HASH);
     size_t alloc;
     mp_map_elem_t *table;
 } mp_map_t;
@@ -521,6 +546,11 @@ void mp_map_free(mp_map_t *map);
 mp_map_elem_t *mp_map_lookup(mp_map_t *map, mp_obj_t index, mp_map_lookup_kind_t lookup_kind);
 void mp_map_clear(mp_map_t *map);
 void mp_map_dump(mp_map_t *map);
+// CIRCUITPY-CHANGE
+size_t mp_map_table_nbytes(const mp_map_t *map);
+#if MICROPY_OPT_MAP_COMPACT
+void mp_map_compact_move_to_end(mp_map_t *map, mp_map_elem_t *elem, bool last);
+#endif
 
 // Underlying set implementation (not set object)
 
@@ -568,6 +598,9 @@ typedef mp_obj_t (*mp_fun_kw_t)(size_t n, const mp_obj_t *, mp_map_t *);
 // If MP_TYPE_FLAG_ITER_IS_STREAM is set then the type implicitly gets a "return self"
 //   getiter, and mp_stream_unbuffered_iter for iternext.
 // If MP_TYPE_FLAG_INSTANCE_TYPE is set then this is an instance type (i.e. defined in Python).
+// CIRCUITPY-CHANGE
+// If MP_TYPE_FLAG_HAS_SLOTS is set then this instance type has __slots__ (a tuple of
+//   all the slot names, including those of its bases) and instances only have those attributes.
 #define MP_TYPE_FLAG_NONE (0x0000)
 #define MP_TYPE_FLAG_IS_SUBCLASSED (0x0001)
 #define MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS (0x0002)
@@ -583,6 +616,8 @@ typedef mp_obj_t (*mp_fun_kw_t)(size_t n, const mp_obj_t *, mp_map_t *);
 #define MP_TYPE_FLAG_INSTANCE_TYPE (0x0200)
 // CIRCUITPY-CHANGE: check for valid types in json dumps
 #define MP_TYPE_FLAG_PRINT_JSON (0x0400)
+// CIRCUITPY-CHANGE
+#define MP_TYPE_FLAG_HAS_SLOTS (0x0800)
 
 typedef enum {
     PRINT_STR = 0,
@@ -1158,6 +1193,9 @@ void mp_obj_exception_add_traceback(mp_obj_t self_in, qstr file, size_t line, qs
 void mp_obj_exception_get_traceback(mp_obj_t self_in, size_t *n, size_t **values);
 // CIRCUITPY-CHANGE
 mp_obj_t mp_obj_exception_get_traceback_obj(mp_obj_t self_in);
+// CIRCUITPY-CHANGE: copy tracebacks out of the thread's traceback buffer
+void mp_obj_exception_keep_traceback(mp_obj_t self_in);
+void mp_obj_exception_release_traceback_buffer(void);
 mp_obj_t mp_obj_exception_get_value(mp_obj_t self_in);
 mp_obj_t mp_obj_exception_make_new(const mp_obj_type_t *type_in, size_t n_args, size_t n_kw, const mp_obj_t *args);
 mp_obj_t mp_alloc_emergency_exception_buf(mp_obj_t size_in);
@@ -116,7 +116,12 @@ static mp_obj_array_t *array_new(char typecode, size_t n) {
     o->typecode = typecode;
     o->free = 0;
     o->len = n;
-    o->items = m_new(byte, typecode_size * o->len);
+    // CIRCUITPY-CHANGE: array data is bulk data, except for objects which must be scanned
+    if (typecode == 'O') {
+        o->items = m_new(byte, typecode_size * o->len);
+    } else {
+        o->items = m_new_bulk(byte, typecode_size * o->len);
+    }
     return o;
 }
 #endif
@@ -25,6 +25,8 @@
  */
 
 #include <unistd.h> // for ssize_t
+// CIRCUITPY-CHANGE
+#include <string.h>
 
 #include "py/runtime.h"
 
@@ -149,7 +151,55 @@ static mp_obj_t mp_obj_deque_appendleft(mp_obj_t self_in, mp_obj_t arg) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(deque_appendleft_obj, mp_obj_deque_appendleft);
 
+// CIRCUITPY-CHANGE: bulk extend from a list or tuple
+// Copy the items into the ring in at most two runs.  If the deque overflows
+// only the last maxlen items are kept, so any before them are skipped.
+static void deque_extend_from_array(mp_obj_deque_t *self, size_t n, const mp_obj_t *items) {
+    size_t maxlen = self->alloc - 1;
+    size_t len = deque_len(self);
+    if (self->flags & FLAG_CHECK_OVERFLOW) {
+        if (n > maxlen - len) {
+            mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("full"));
+        }
+    } else if (n >= maxlen) {
+        items += n - maxlen;
+        n = maxlen;
+        len = 0;
+        self->i_get = self->i_put = 0;
+        self->items[maxlen] = MP_OBJ_NULL;
+    }
+
+    len += n;
+    while (n > 0) {
+        size_t run = MIN(n, self->alloc - self->i_put);
+        memcpy(&self->items[self->i_put], items, run * sizeof(mp_obj_t));
+        items += run;
+        n -= run;
+        self->i_put += run;
+        if (self->i_put == self->alloc) {
+            self->i_put = 0;
+        }
+    }
+
+    if (len > maxlen) {
+        // the oldest items were overwritten, and the free slot is now at i_put
+        self->items[self->i_put] = MP_OBJ_NULL;
+        self->i_get = self->i_put + 1;
+        if (self->i_get == self->alloc) {
+            self->i_get = 0;
+        }
+    }
+}
+
 static mp_obj_t mp_obj_deque_extend(mp_obj_t self_in, mp_obj_t arg_in) {
+    // CIRCUITPY-CHANGE
+    if (mp_obj_is_type(arg_in, &mp_type_list) || mp_obj_is_type(arg_in, &mp_type_tuple)) {
+        size_t n;
+        mp_obj_t *items;
+        mp_obj_get_array(arg_in, &n, &items);
+        deque_extend_from_array(MP_OBJ_TO_PTR(self_in), n, items);
+        return mp_const_none;
+    }
     mp_obj_iter_buf_t iter_buf;
     mp_obj_t iter = mp_getiter(arg_in, &iter_buf);
     mp_obj_t item;
@@ -160,6 +210,18 @@ static mp_obj_t mp_obj_deque_extend(mp_obj_t self_in, mp_obj_t arg_in) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(deque_extend_obj, mp_obj_deque_extend);
 
+// CIRCUITPY-CHANGE
+static mp_obj_t deque_extendleft(mp_obj_t self_in, mp_obj_t arg_in) {
+    mp_obj_iter_buf_t iter_buf;
+    mp_obj_t iter = mp_getiter(arg_in, &iter_buf);
+    mp_obj_t item;
+    while ((item = mp_iternext(iter)) != MP_OBJ_STOP_ITERATION) {
+        mp_obj_deque_appendleft(self_in, item);
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(deque_extendleft_obj, deque_extendleft);
+
 static mp_obj_t deque_popleft(mp_obj_t self_in) {
     mp_obj_deque_t *self = MP_OBJ_TO_PTR(self_in);
 
@@ -208,7 +270,8 @@ static mp_obj_t deque_subscr(mp_obj_t self_in, mp_obj_t index, mp_obj_t value) {
 
     size_t offset = mp_get_index(self->base.type, deque_len(self), index, false);
     size_t index_val = self->i_get + offset;
-    if (index_val > self->alloc) {
+    // CIRCUITPY-CHANGE: i_get + offset can be alloc, which is past the end of items
+    if (index_val >= self->alloc) {
         index_val -= self->alloc;
     }
 
@@ -223,7 +286,7 @@ static mp_obj_t deque_subscr(mp_obj_t self_in, mp_obj_t index, mp_obj_t value) {
 }
 #endif
 
-#if 0
+// CIRCUITPY-CHANGE: clear, rotate and maxlen
 static mp_obj_t deque_clear(mp_obj_t self_in) {
     mp_obj_deque_t *self = MP_OBJ_TO_PTR(self_in);
     self->i_get = self->i_put = 0;
@@ -231,17 +294,66 @@ static mp_obj_t deque_clear(mp_obj_t self_in) {
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(deque_clear_obj, deque_clear);
-#endif
+
+static mp_obj_t deque_rotate(size_t n_args, const mp_obj_t *args) {
+    mp_obj_deque_t *self = MP_OBJ_TO_PTR(args[0]);
+    size_t len = deque_len(self);
+    if (len <= 1) {
+        return mp_const_none;
+    }
+    mp_int_t n = n_args > 1 ? mp_obj_get_int(args[1]) : 1;
+    n %= (mp_int_t)len;
+    if (n < 0) {
+        n += len;
+    }
+    // A ring always has a free slot at i_put, so each step moves one item from
+    // one end to the other in place.  Go whichever way round is shorter.
+    if ((size_t)n <= len / 2) {
+        // rotate right: move items from the back to the front
+        for (; n > 0; n--) {
+            self->i_put = (self->i_put == 0 ? self->alloc : self->i_put) - 1;
+            self->i_get = (self->i_get == 0 ? self->alloc : self->i_get) - 1;
+            self->items[self->i_get] = self->items[self->i_put];
+            self->items[self->i_put] = MP_OBJ_NULL;
+        }
+    } else {
+        // rotate left: move items from the front to the back
+        for (n = len - n; n > 0; n--) {
+            self->items[self->i_put] = self->items[self->i_get];
+            self->items[self->i_get] = MP_OBJ_NULL;
+            if (++self->i_put == self->alloc) {
+                self->i_put = 0;
+            }
+            if (++self->i_get == self->alloc) {
+                self->i_get = 0;
+            }
+        }
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(deque_rotate_obj, 1, 2, deque_rotate);
+
+static void deque_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
+    if (dest[0] == MP_OBJ_NULL && attr == MP_QSTR_maxlen) {
+        mp_obj_deque_t *self = MP_OBJ_TO_PTR(self_in);
+        dest[0] = MP_OBJ_NEW_SMALL_INT(self->alloc - 1);
+    } else {
+        // continue lookup in locals_dict
+        dest[1] = MP_OBJ_SENTINEL;
+    }
+}
 
 static const mp_rom_map_elem_t deque_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_append), MP_ROM_PTR(&deque_append_obj) },
     { MP_ROM_QSTR(MP_QSTR_appendleft), MP_ROM_PTR(&deque_appendleft_obj) },
     { MP_ROM_QSTR(MP_QSTR_extend), MP_ROM_PTR(&deque_extend_obj) },
-    #if 0
+    // CIRCUITPY-CHANGE
+    { MP_ROM_QSTR(MP_QSTR_extendleft), MP_ROM_PTR(&deque_extendleft_obj) },
     { MP_ROM_QSTR(MP_QSTR_clear), MP_ROM_PTR(&deque_clear_obj) },
-    #endif
     { MP_ROM_QSTR(MP_QSTR_pop), MP_ROM_PTR(&deque_pop_obj) },
     { MP_ROM_QSTR(MP_QSTR_popleft), MP_ROM_PTR(&deque_popleft_obj) },
+    // CIRCUITPY-CHANGE
+    { MP_ROM_QSTR(MP_QSTR_rotate), MP_ROM_PTR(&deque_rotate_obj) },
 };
 
 static MP_DEFINE_CONST_DICT(deque_locals_dict, deque_locals_dict_table);
@@ -266,6 +378,8 @@ MP_DEFINE_CONST_OBJ_TYPE(
     MP_TYPE_FLAG_ITER_IS_GETITER,
     make_new, deque_make_new,
     unary_op, deque_unary_op,
+    // CIRCUITPY-CHANGE
+    attr, deque_attr,
     DEQUE_TYPE_SUBSCR
     DEQUE_TYPE_ITER
     locals_dict, &deque_locals_dict
@@ -171,7 +171,8 @@ static mp_obj_t dict_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
             return MP_OBJ_NEW_SMALL_INT(self->map.used);
         #if MICROPY_PY_SYS_GETSIZEOF
         case MP_UNARY_OP_SIZEOF: {
-            size_t sz = sizeof(*self) + sizeof(*self->map.table) * self->map.alloc;
+            // CIRCUITPY-CHANGE
+            size_t sz = sizeof(*self) + mp_map_table_nbytes(&self->map);
             return MP_OBJ_NEW_SMALL_INT(sz);
         }
         #endif
@@ -305,11 +306,25 @@ mp_obj_t mp_obj_dict_copy(mp_obj_t self_in) {
     // CIRCUITPY-CHANGE
     mp_obj_dict_t *other = native_dict(other_out);
     other->base.type = self->base.type;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_MAP_COMPACT
+    if (other->map.is_compact != self->map.is_compact) {
+        // a large fixed table, e.g. in ROM, so add the entries one by one
+        other->map.is_ordered = self->map.is_ordered;
+        for (size_t i = 0; i < self->map.alloc; i++) {
+            if (mp_map_slot_is_filled(&self->map, i)) {
+                mp_map_lookup(&other->map, self->map.table[i].key, MP_MAP_LOOKUP_ADD_IF_NOT_FOUND)->value = self->map.table[i].value;
+            }
+        }
+        return other_out;
+    }
+    #endif
     other->map.used = self->map.used;
     other->map.all_keys_are_qstrs = self->map.all_keys_are_qstrs;
     other->map.is_fixed = 0;
     other->map.is_ordered = self->map.is_ordered;
-    memcpy(other->map.table, self->map.table, self->map.alloc * sizeof(mp_map_elem_t));
+    // CIRCUITPY-CHANGE: otherwise both maps have the same layout
+    memcpy(other->map.table, self->map.table, mp_map_table_nbytes(&self->map));
     return other_out;
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(dict_copy_obj, mp_obj_dict_copy);
@@ -405,6 +420,16 @@ static mp_obj_t dict_popitem(mp_obj_t self_in) {
         mp_raise_msg_varg(&mp_type_KeyError, MP_ERROR_TEXT("pop from empty %q"), MP_QSTR_dict);
     }
     size_t cur = 0;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_MAP_COMPACT
+    if (self->map.is_compact) {
+        // entries are in insertion order, so pop the last one like CPython
+        cur = self->map.alloc - 1;
+        while (!mp_map_slot_is_filled(&self->map, cur)) {
+            cur--;
+        }
+    } else
+    #endif
     #if MICROPY_PY_COLLECTIONS_ORDEREDDICT
     if (self->map.is_ordered) {
         cur = self->map.used - 1;
@@ -477,7 +502,7 @@ static MP_DEFINE_CONST_FUN_OBJ_KW(dict_update_obj, 1, dict_update);
 #if MICROPY_PY_COLLECTIONS_ORDEREDDICT
 static mp_obj_t dict_move_to_end(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     mp_obj_dict_t *self = MP_OBJ_TO_PTR(pos_args[0]);
-    mp_arg_validate_type(self, &mp_type_ordereddict, MP_QSTR_self);
+    mp_arg_validate_type(pos_args[0], &mp_type_ordereddict, MP_QSTR_self);
 
     // parse args
     enum { ARG_key, ARG_last };
@@ -488,7 +513,7 @@ static mp_obj_t dict_move_to_end(size_t n_args, const mp_obj_t *pos_args, mp_map
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
-    mp_obj_t *key = args[ARG_key].u_obj;
+    mp_obj_t key = args[ARG_key].u_obj;
     bool last = args[ARG_last].u_bool;
 
     mp_map_elem_t *elem = mp_map_lookup(&self->map, key, MP_MAP_LOOKUP);
@@ -496,6 +521,14 @@ static mp_obj_t dict_move_to_end(size_t n_args, const mp_obj_t *pos_args, mp_map
         mp_raise_type_arg(&mp_type_KeyError, key);
     }
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_MAP_COMPACT
+    if (self->map.is_compact) {
+        mp_map_compact_move_to_end(&self->map, elem, last);
+        return mp_const_none;
+    }
+    #endif
+
     mp_map_elem_t tmp = *elem;
     mp_map_elem_t *table = self->map.table;
     mp_map_elem_t *dest, *move_begin, *move_dest;
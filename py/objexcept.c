@@ -53,6 +53,10 @@
 // Number of items per traceback entry (file, line, block)
 #define TRACEBACK_ENTRY_LEN (3)
 
+// CIRCUITPY-CHANGE: the first traceback entry is stored just after the traceback object
+#define TRACEBACK_INLINE_SIZE (sizeof(mp_obj_traceback_t) + TRACEBACK_ENTRY_LEN * sizeof(size_t))
+#define TRACEBACK_INLINE_DATA(tb) ((size_t *)((tb) + 1))
+
 // Optionally allocated buffer for storing some traceback, the tuple argument,
 // and possible string object and data, for when the heap is locked.
 #if MICROPY_ENABLE_EMERGENCY_EXCEPTION_BUF
@@ -213,7 +217,7 @@ void mp_obj_exception_print(const mp_print_t *print, mp_obj_t o_in, mp_print_kin
 void mp_obj_exception_initialize0(mp_obj_exception_t *o_exc, const mp_obj_type_t *type) {
     o_exc->base.type = type;
     o_exc->args = (mp_obj_tuple_t *)&mp_const_empty_tuple_obj;
-    mp_obj_exception_clear_traceback(o_exc);
+    mp_obj_exception_clear_traceback(MP_OBJ_FROM_PTR(o_exc));
 }
 
 mp_obj_t mp_obj_exception_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
@@ -331,6 +335,8 @@ void mp_obj_exception_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
     } else if (attr == MP_QSTR_value && self->base.type == &mp_type_StopIteration) {
         dest[0] = mp_obj_exception_get_value(self_in);
     } else if (attr == MP_QSTR___traceback__) {
+        // The buffered traceback object mustn't escape to Python.
+        mp_obj_exception_keep_traceback(self_in);
         dest[0] = (self->traceback) ? MP_OBJ_FROM_PTR(self->traceback) : mp_const_none;
     #if MICROPY_CPYTHON_EXCEPTION_CHAIN
     } else if (attr == MP_QSTR___cause__) {
@@ -642,6 +648,74 @@ void mp_obj_exception_clear_traceback(mp_obj_t self_in) {
     #endif
 }
 
+// CIRCUITPY-CHANGE: the traceback of the exception most recently raised by a
+// thread is recorded in the thread's traceback buffer while it propagates, so
+// that unwinding doesn't allocate. It's copied to the heap when the exception
+// is caught by bytecode, its traceback is accessed from Python, or another
+// exception needs the buffer.
+#if MICROPY_TRACEBACK_BUFFER_ENTRIES
+static inline bool traceback_in_buffer(mp_obj_exception_t *self) {
+    return self->traceback == &MP_STATE_THREAD(traceback_buffer);
+}
+
+// Copy the buffered traceback to a heap traceback object with room for extra
+// more values. If that fails, the traceback is emptied unless it can stay.
+static void traceback_buffer_release(mp_obj_exception_t *self, size_t extra, bool can_stay) {
+    size_t len = MP_STATE_THREAD(traceback_buffer).len;
+    mp_obj_traceback_t *tb = m_malloc_maybe(sizeof(mp_obj_traceback_t) + (len + extra) * sizeof(size_t));
+    if (tb == NULL) {
+        if (can_stay) {
+            return;
+        }
+        self->traceback = (mp_obj_traceback_t *)&mp_const_empty_traceback_obj;
+    } else {
+        *tb = mp_const_empty_traceback_obj;
+        tb->data = TRACEBACK_INLINE_DATA(tb);
+        tb->alloc = len + extra;
+        tb->len = len;
+        memcpy(tb->data, MP_STATE_THREAD(traceback_buffer_data), len * sizeof(size_t));
+        self->traceback = tb;
+    }
+    MP_STATE_THREAD(traceback_buffer_owner) = NULL;
+}
+
+// Give the buffer to self, copying out the traceback of its previous owner.
+static void traceback_buffer_acquire(mp_obj_exception_t *self) {
+    mp_obj_exception_t *owner = MP_STATE_THREAD(traceback_buffer_owner);
+    if (owner != NULL && owner != self && traceback_in_buffer(owner)) {
+        traceback_buffer_release(owner, 0, false);
+    }
+    mp_obj_traceback_t *tb = &MP_STATE_THREAD(traceback_buffer);
+    *tb = mp_const_empty_traceback_obj;
+    tb->data = MP_STATE_THREAD(traceback_buffer_data);
+    tb->alloc = MP_ARRAY_SIZE(MP_STATE_THREAD(traceback_buffer_data));
+    MP_STATE_THREAD(traceback_buffer_owner) = self;
+    self->traceback = tb;
+}
+#endif
+
+void mp_obj_exception_release_traceback_buffer(void) {
+    #if MICROPY_TRACEBACK_BUFFER_ENTRIES
+    mp_obj_exception_t *owner = MP_STATE_THREAD(traceback_buffer_owner);
+    if (owner != NULL && traceback_in_buffer(owner)) {
+        traceback_buffer_release(owner, 0, false);
+    }
+    MP_STATE_THREAD(traceback_buffer_owner) = NULL;
+    #endif
+}
+
+void mp_obj_exception_keep_traceback(mp_obj_t self_in) {
+    #if MICROPY_TRACEBACK_BUFFER_ENTRIES
+    mp_obj_exception_t *self = mp_obj_exception_get_native(self_in);
+    if (traceback_in_buffer(self)) {
+        // With the heap locked, the traceback stays in the buffer until it's needed.
+        traceback_buffer_release(self, 0, true);
+    }
+    #else
+    (void)self_in;
+    #endif
+}
+
 // CIRCUITPY-CHANGE: many changes for tracebacks
 void mp_obj_exception_add_traceback(mp_obj_t self_in, qstr file, size_t line, qstr block) {
     mp_obj_exception_t *self = mp_obj_exception_get_native(self_in);
@@ -659,14 +733,33 @@ void mp_obj_exception_add_traceback(mp_obj_t self_in, qstr file, size_t line, qs
     }
     #endif
 
+    #if MICROPY_TRACEBACK_BUFFER_ENTRIES
+    if (self->traceback == NULL || self->traceback == (mp_obj_traceback_t *)&mp_const_empty_traceback_obj) {
+        traceback_buffer_acquire(self);
+    } else if (traceback_in_buffer(self) && self->traceback->len + TRACEBACK_ENTRY_LEN > self->traceback->alloc) {
+        // Deeper than the buffer: continue on the heap, growing as before.
+        traceback_buffer_release(self, TRACEBACK_ENTRY_LEN, true);
+        if (traceback_in_buffer(self)) {
+            return;
+        }
+    }
+    #endif
+
     // Try to allocate memory for the traceback, with fallback to emergency traceback object
     if (self->traceback == NULL || self->traceback == (mp_obj_traceback_t *)&mp_const_empty_traceback_obj) {
-        self->traceback = m_new_obj_maybe(mp_obj_traceback_t);
-        if (self->traceback == NULL) {
-            self->traceback = &MP_STATE_VM(mp_emergency_traceback_obj);
+        // Allocate the first entry along with the traceback object, which saves an allocation
+        // for every exception that is caught in the function that raised it.
+        mp_obj_traceback_t *tb = m_malloc_maybe(TRACEBACK_INLINE_SIZE);
+        if (tb == NULL) {
+            tb = &MP_STATE_VM(mp_emergency_traceback_obj);
         }
         // populate traceback object
-        *self->traceback = mp_const_empty_traceback_obj;
+        *tb = mp_const_empty_traceback_obj;
+        if (tb != &MP_STATE_VM(mp_emergency_traceback_obj)) {
+            tb->data = TRACEBACK_INLINE_DATA(tb);
+            tb->alloc = TRACEBACK_ENTRY_LEN;
+        }
+        self->traceback = tb;
     }
 
     // append the provided traceback info to traceback data
@@ -702,8 +795,17 @@ void mp_obj_exception_add_traceback(mp_obj_t self_in, qstr file, size_t line, qs
         }
         #endif
         // be conservative with growing traceback data
-        size_t *tb_data = m_renew_maybe(size_t, self->traceback->data, self->traceback->alloc,
-            self->traceback->alloc + TRACEBACK_ENTRY_LEN, true);
+        size_t *tb_data;
+        if (self->traceback->data == TRACEBACK_INLINE_DATA(self->traceback)) {
+            // The first entry is part of the traceback object, so it can't be resized
+            tb_data = m_new_maybe(size_t, self->traceback->alloc + TRACEBACK_ENTRY_LEN);
+            if (tb_data != NULL) {
+                memcpy(tb_data, self->traceback->data, self->traceback->len * sizeof(size_t));
+            }
+        } else {
+            tb_data = m_renew_maybe(size_t, self->traceback->data, self->traceback->alloc,
+                self->traceback->alloc + TRACEBACK_ENTRY_LEN, true);
+        }
         if (tb_data == NULL) {
             return;
         }
@@ -831,14 +933,12 @@ static mp_obj_t traceback_from_values(size_t *values, mp_obj_t tb_next) {
 };
 
 mp_obj_t mp_obj_exception_get_traceback_obj(mp_obj_t self_in) {
-    mp_obj_exception_t *self = MP_OBJ_TO_PTR(self_in);
-
-    if (!mp_obj_is_exception_instance(self)) {
+    if (!mp_obj_is_exception_instance(self_in)) {
         return mp_const_none;
     }
 
     size_t n, *values;
-    mp_obj_exception_get_traceback(self, &n, &values);
+    mp_obj_exception_get_traceback(self_in, &n, &values);
     if (n == 0) {
         return mp_const_none;
     }
@@ -386,6 +386,10 @@ mp_obj_t mp_obj_new_fun_bc(const mp_obj_t *def_args, const byte *code, const mp_
     o->bytecode = code;
     o->context = context;
     o->child_table = child_table;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_VM_INLINE_CACHE
+    o->inline_cache = NULL;
+    #endif
     if (def_pos_args != NULL) {
         memcpy(o->extra_args, def_pos_args->items, n_def_args * sizeof(mp_obj_t));
     }
@@ -37,6 +37,10 @@ typedef struct _mp_obj_fun_bc_t {
     #if MICROPY_PY_SYS_SETTRACE
     const struct _mp_raw_code_t *rc;
     #endif
+    // CIRCUITPY-CHANGE: allocated by the VM when first needed
+    #if MICROPY_OPT_VM_INLINE_CACHE
+    struct _mp_vm_inline_cache_t *inline_cache;
+    #endif
     // the following extra_args array is allocated space to take (in order):
     //  - values of positional default args (if any)
     //  - a single slot for default kw args dict (if it has them)
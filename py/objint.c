@@ -115,9 +115,9 @@ static mp_fp_as_int_class_t mp_classify_fp_as_int(mp_float_t val) {
     } else {
         e &= ~((1U << MP_FLOAT_EXP_SHIFT_I32) - 1);
     }
-    // 8 * sizeof(uintptr_t) counts the number of bits for a small int
-    // TODO provide a way to configure this properly
-    if (e <= ((8 * sizeof(uintptr_t) + MP_FLOAT_EXP_BIAS - 3) << MP_FLOAT_EXP_SHIFT_I32)) {
+    // CIRCUITPY-CHANGE: count the bits of a small int, which are fewer than those of a word with
+    // MICROPY_OBJ_REPR_D and 64-bit pointers
+    if (e <= (((size_t)MP_SMALL_INT_BITS + 1 + MP_FLOAT_EXP_BIAS - 3) << MP_FLOAT_EXP_SHIFT_I32)) {
         return MP_FP_CLASS_FIT_SMALLINT;
     }
     #if MICROPY_LONGINT_IMPL == MICROPY_LONGINT_IMPL_LONGLONG
@@ -489,7 +489,7 @@ static mp_obj_t int_from_bytes(size_t n_args, const mp_obj_t *pos_args, mp_map_t
 
     enum { ARG_bytes, ARG_byteorder, ARG_signed };
     static const mp_arg_t allowed_args[] = {
-        { MP_QSTR_bytes, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = NULL} },
+        { MP_QSTR_bytes, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
         // CIRCUITPY-CHANGE: not required and given a default value.
         { MP_QSTR_byteorder, MP_ARG_OBJ, {.u_obj = MP_OBJ_NEW_QSTR(MP_QSTR_big)} },
         { MP_QSTR_signed, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
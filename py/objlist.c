@@ -311,39 +311,267 @@ static mp_obj_t list_pop(size_t n_args, const mp_obj_t *args) {
     return mp_obj_list_pop(self, index);
 }
 
-static void mp_quicksort(mp_obj_t *head, mp_obj_t *tail, mp_obj_t key_fn, mp_obj_t binop_less_result) {
-    MP_STACK_CHECK();
-    while (head < tail) {
-        mp_obj_t *h = head - 1;
-        mp_obj_t *t = tail;
-        mp_obj_t v = key_fn == MP_OBJ_NULL ? tail[0] : mp_call_function_1(key_fn, tail[0]); // get pivot using key_fn
-        for (;;) {
-            do {++h;
-            } while (h < t && mp_binary_op(MP_BINARY_OP_LESS, key_fn == MP_OBJ_NULL ? h[0] : mp_call_function_1(key_fn, h[0]), v) == binop_less_result);
-            do {--t;
-            } while (h < t && mp_binary_op(MP_BINARY_OP_LESS, v, key_fn == MP_OBJ_NULL ? t[0] : mp_call_function_1(key_fn, t[0])) == binop_less_result);
-            if (h >= t) {
+// CIRCUITPY-CHANGE: a stable merge sort that takes advantage of runs already in order, in place
+// of a quicksort that went quadratic on sorted input and called key_fn for every comparison.
+// Keys are computed once, and each element is then a key and an item, so w, the number of
+// words an element takes, is 2 when there is a key_fn and 1 when the item is its own key.
+
+// Runs shorter than this are lengthened with binary insertion sort.
+#define LIST_SORT_MIN_MERGE (32)
+// Enough for any list that fits in memory, as each run on the stack is longer than the two
+// above it together.
+#define LIST_SORT_MAX_RUNS (48)
+
+typedef struct _list_sort_t {
+    mp_obj_t *a;
+    mp_obj_t *tmp;
+    // Room for half of the elements, made on the first merge.
+    size_t tmp_len;
+    size_t w;
+    // Where the elements in tmp belong if an exception stops a merge, so that none are lost.
+    mp_obj_t *hole;
+    const mp_obj_t *hole_src;
+    size_t hole_n;
+} list_sort_t;
+
+static inline bool list_sort_less(const mp_obj_t *x, const mp_obj_t *y) {
+    return mp_obj_is_true(mp_binary_op(MP_BINARY_OP_LESS, x[0], y[0]));
+}
+
+static inline void list_sort_move(list_sort_t *s, mp_obj_t *dest, const mp_obj_t *src, size_t n) {
+    memmove(dest, src, n * s->w * sizeof(mp_obj_t));
+}
+
+// Reverses a[lo, hi).
+static void list_sort_reverse(list_sort_t *s, size_t lo, size_t hi) {
+    size_t w = s->w;
+    for (size_t i = lo, j = hi - 1; i < j; i++, j--) {
+        for (size_t k = 0; k < w; k++) {
+            mp_obj_t t = s->a[i * w + k];
+            s->a[i * w + k] = s->a[j * w + k];
+            s->a[j * w + k] = t;
+        }
+    }
+}
+
+// The number of elements in a[lo, hi) that are no greater than x, with a[lo, hi) in order.
+static size_t list_sort_upper_bound(list_sort_t *s, const mp_obj_t *x, size_t lo, size_t hi) {
+    size_t l = lo;
+    while (lo < hi) {
+        size_t m = lo + (hi - lo) / 2;
+        if (list_sort_less(x, s->a + m * s->w)) {
+            hi = m;
+        } else {
+            lo = m + 1;
+        }
+    }
+    return lo - l;
+}
+
+// The number of elements in a[lo, hi) that are less than x, with a[lo, hi) in order.
+static size_t list_sort_lower_bound(list_sort_t *s, const mp_obj_t *x, size_t lo, size_t hi) {
+    size_t l = lo;
+    while (lo < hi) {
+        size_t m = lo + (hi - lo) / 2;
+        if (list_sort_less(s->a + m * s->w, x)) {
+            lo = m + 1;
+        } else {
+            hi = m;
+        }
+    }
+    return lo - l;
+}
+
+// Sorts a[lo, hi), where a[lo, start) is already in order. The elements are only moved once
+// all comparisons for one are done, so an exception leaves them all in place.
+static void list_sort_insertion(list_sort_t *s, size_t lo, size_t start, size_t hi) {
+    size_t w = s->w;
+    for (size_t i = start; i < hi; i++) {
+        mp_obj_t x[2];
+        memcpy(x, s->a + i * w, w * sizeof(mp_obj_t));
+        size_t p = lo + list_sort_upper_bound(s, x, lo, i);
+        list_sort_move(s, s->a + (p + 1) * w, s->a + p * w, i - p);
+        memcpy(s->a + p * w, x, w * sizeof(mp_obj_t));
+    }
+}
+
+// Returns the end of the run starting at lo, reversing it first if it is descending. Only
+// strictly descending runs are reversed, to keep the sort stable.
+static size_t list_sort_count_run(list_sort_t *s, size_t lo, size_t hi) {
+    size_t w = s->w;
+    size_t n = lo + 1;
+    if (n == hi) {
+        return n;
+    }
+    if (list_sort_less(s->a + n * w, s->a + lo * w)) {
+        while (n + 1 < hi && list_sort_less(s->a + (n + 1) * w, s->a + n * w)) {
+            n++;
+        }
+        list_sort_reverse(s, lo, n + 1);
+    } else {
+        while (n + 1 < hi && !list_sort_less(s->a + (n + 1) * w, s->a + n * w)) {
+            n++;
+        }
+    }
+    return n + 1;
+}
+
+// Merges the runs a[base, mid) and a[mid, end), copying the shorter one aside.
+static void list_sort_merge(list_sort_t *s, size_t base, size_t mid, size_t end) {
+    size_t w = s->w;
+    mp_obj_t *a = s->a;
+
+    // Elements at the start of the first run and the end of the second are already in place.
+    base += list_sort_upper_bound(s, a + mid * w, base, mid);
+    if (base == mid) {
+        return;
+    }
+    end = mid + list_sort_lower_bound(s, a + (mid - 1) * w, mid, end);
+
+    if (s->tmp == NULL) {
+        s->tmp = m_new(mp_obj_t, s->tmp_len * w);
+    }
+    mp_obj_t *tmp = s->tmp;
+    if (mid - base <= end - mid) {
+        size_t n = mid - base;
+        list_sort_move(s, tmp, a + base * w, n);
+        size_t d = base, t = 0, r = mid;
+        while (t < n && r < end) {
+            s->hole = a + d * w;
+            s->hole_src = tmp + t * w;
+            s->hole_n = n - t;
+            if (list_sort_less(a + r * w, tmp + t * w)) {
+                list_sort_move(s, a + d * w, a + r * w, 1);
+                r++;
+            } else {
+                list_sort_move(s, a + d * w, tmp + t * w, 1);
+                t++;
+            }
+            d++;
+        }
+        list_sort_move(s, a + d * w, tmp + t * w, n - t);
+    } else {
+        size_t n = end - mid;
+        list_sort_move(s, tmp, a + mid * w, n);
+        // Merges from the end, with one more than the index of each next element.
+        size_t d = end, t = n, l = mid;
+        while (t > 0 && l > base) {
+            s->hole = a + l * w;
+            s->hole_src = tmp;
+            s->hole_n = t;
+            if (list_sort_less(tmp + (t - 1) * w, a + (l - 1) * w)) {
+                list_sort_move(s, a + (d - 1) * w, a + (l - 1) * w, 1);
+                l--;
+            } else {
+                list_sort_move(s, a + (d - 1) * w, tmp + (t - 1) * w, 1);
+                t--;
+            }
+            d--;
+        }
+        list_sort_move(s, a + l * w, tmp, t);
+    }
+    s->hole_n = 0;
+}
+
+static size_t list_sort_min_run(size_t n) {
+    size_t r = 0;
+    while (n >= LIST_SORT_MIN_MERGE) {
+        r |= n & 1;
+        n >>= 1;
+    }
+    return n + r;
+}
+
+static void list_sort_runs(list_sort_t *s, size_t n) {
+    size_t min_run = list_sort_min_run(n);
+    // The start of each run yet to be merged; each ends where the next starts.
+    size_t runs[LIST_SORT_MAX_RUNS + 1];
+    size_t n_runs = 0;
+    size_t lo = 0;
+    while (lo < n) {
+        size_t hi = list_sort_count_run(s, lo, n);
+        if (hi - lo < min_run) {
+            size_t forced = MIN(n, lo + min_run);
+            list_sort_insertion(s, lo, hi, forced);
+            hi = forced;
+        }
+        runs[n_runs++] = lo;
+        runs[n_runs] = hi;
+        lo = hi;
+
+        // Merge until each run is longer than the next, and longer than the next two together,
+        // which keeps the merges balanced and the stack short.
+        while (n_runs > 1) {
+            #define RUN_LEN(i) (runs[(i) + 1] - runs[i])
+            size_t k = n_runs - 2;
+            if ((k > 0 && RUN_LEN(k - 1) <= RUN_LEN(k) + RUN_LEN(k + 1))
+                || (k > 1 && RUN_LEN(k - 2) <= RUN_LEN(k - 1) + RUN_LEN(k))) {
+                if (RUN_LEN(k - 1) < RUN_LEN(k + 1)) {
+                    k--;
+                }
+            } else if (RUN_LEN(k) > RUN_LEN(k + 1)) {
                 break;
             }
-            mp_obj_t x = h[0];
-            h[0] = t[0];
-            t[0] = x;
+            list_sort_merge(s, runs[k], runs[k + 1], runs[k + 2]);
+            for (size_t i = k + 1; i < n_runs; i++) {
+                runs[i] = runs[i + 1];
+            }
+            n_runs--;
+            #undef RUN_LEN
         }
-        mp_obj_t x = h[0];
-        h[0] = tail[0];
-        tail[0] = x;
-        // do the smaller recursive call first, to keep stack within O(log(N))
-        if (t - head < tail - h - 1) {
-            mp_quicksort(head, t, key_fn, binop_less_result);
-            head = h + 1;
-        } else {
-            mp_quicksort(h + 1, tail, key_fn, binop_less_result);
-            tail = t;
+    }
+    while (n_runs > 1) {
+        size_t k = n_runs - 2;
+        list_sort_merge(s, runs[k], runs[k + 1], runs[k + 2]);
+        runs[k + 1] = runs[k + 2];
+        n_runs--;
+    }
+}
+
+static void mp_list_sort(mp_obj_list_t *self, mp_obj_t key_fn, bool reverse) {
+    size_t n = self->len;
+    list_sort_t s = { .a = self->items, .tmp = NULL, .tmp_len = n / 2, .w = 1, .hole_n = 0 };
+    if (key_fn != MP_OBJ_NULL) {
+        s.w = 2;
+        s.a = m_new(mp_obj_t, 2 * n);
+        for (size_t i = 0; i < n; i++) {
+            s.a[2 * i + 1] = self->items[i];
+            s.a[2 * i] = mp_call_function_1(key_fn, self->items[i]);
+        }
+    }
+    // Reversing before and after sorting keeps equal elements in their original order.
+    if (reverse) {
+        list_sort_reverse(&s, 0, n);
+    }
+
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        list_sort_runs(&s, n);
+        nlr_pop();
+    } else {
+        if (s.hole_n > 0) {
+            list_sort_move(&s, s.hole, s.hole_src, s.hole_n);
+        }
+        nlr_jump(nlr.ret_val);
+    }
+
+    if (reverse) {
+        list_sort_reverse(&s, 0, n);
+    }
+    if (s.tmp != NULL) {
+        m_del(mp_obj_t, s.tmp, s.tmp_len * s.w);
+    }
+    if (key_fn != MP_OBJ_NULL) {
+        // key_fn may have changed the list, in which case it is left as key_fn made it.
+        if (self->len == n) {
+            for (size_t i = 0; i < n; i++) {
+                self->items[i] = s.a[2 * i + 1];
+            }
         }
+        m_del(mp_obj_t, s.a, 2 * n);
     }
 }
 
-// TODO Python defines sort to be stable but ours is not
 mp_obj_t mp_obj_list_sort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_key, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
@@ -362,9 +590,9 @@ mp_obj_t mp_obj_list_sort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_
     mp_obj_list_t *self = native_list(pos_args[0]);
 
     if (self->len > 1) {
-        mp_quicksort(self->items, self->items + self->len - 1,
-            args.key.u_obj == mp_const_none ? MP_OBJ_NULL : args.key.u_obj,
-            args.reverse.u_bool ? mp_const_false : mp_const_true);
+        // CIRCUITPY-CHANGE
+        mp_list_sort(self, args.key.u_obj == mp_const_none ? MP_OBJ_NULL : args.key.u_obj,
+            args.reverse.u_bool);
     }
 
     return mp_const_none;
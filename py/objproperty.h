@@ -39,8 +39,9 @@ typedef struct _mp_obj_property_getset_t {
 typedef struct _mp_obj_property_t mp_obj_property_getter_t;
 typedef struct _mp_obj_property_t mp_obj_property_getset_t;
 
-#define MP_PROPERTY_GETTER(P, G) const mp_obj_property_t P = {.base.type = &mp_type_property, .proxy = {G, MP_ROM_NONE, MP_ROM_NONE}}
-#define MP_PROPERTY_GETSET(P, G, S) const mp_obj_property_t P = {.base.type = &mp_type_property, .proxy = {G, S, MP_ROM_NONE}}
+// CIRCUITPY-CHANGE: proxy holds mp_obj_t, which isn't mp_rom_obj_t with some object representations.
+#define MP_PROPERTY_GETTER(P, G) const mp_obj_property_t P = {.base.type = &mp_type_property, .proxy = {G, mp_const_none, mp_const_none}}
+#define MP_PROPERTY_GETSET(P, G, S) const mp_obj_property_t P = {.base.type = &mp_type_property, .proxy = {G, S, mp_const_none}}
 #endif
 
 #endif  // MICROPY_PY_BUILTINS_PROPERTY
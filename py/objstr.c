@@ -317,26 +317,38 @@ wrong_args:
 
 // like strstr but with specified length and allows \0 bytes
 // TODO replace with something more efficient/standard
+// CIRCUITPY-CHANGE: skip to candidates with memchr (searching forward) or a first byte compare
+// (searching backward) and only memcmp the rest of the needle there
 const byte *find_subbytes(const byte *haystack, size_t hlen, const byte *needle, size_t nlen, int direction) {
-    if (hlen >= nlen) {
-        size_t str_index, str_index_end;
-        if (direction > 0) {
-            str_index = 0;
-            str_index_end = hlen - nlen;
-        } else {
-            str_index = hlen - nlen;
-            str_index_end = 0;
+    if (hlen < nlen) {
+        return NULL;
+    }
+    if (nlen == 0) {
+        return direction > 0 ? haystack : haystack + hlen;
+    }
+    byte first = needle[0];
+    // the last position a match can start at
+    const byte *last = haystack + hlen - nlen;
+    if (direction > 0) {
+        const byte *p = haystack;
+        while (p <= last) {
+            p = memchr(p, first, last - p + 1);
+            if (p == NULL) {
+                break;
+            }
+            if (memcmp(p + 1, needle + 1, nlen - 1) == 0) {
+                return p;
+            }
+            p++;
         }
-        for (;;) {
-            if (memcmp(&haystack[str_index], needle, nlen) == 0) {
-                // found
-                return haystack + str_index;
+    } else {
+        for (const byte *p = last;; p--) {
+            if (*p == first && memcmp(p + 1, needle + 1, nlen - 1) == 0) {
+                return p;
             }
-            if (str_index == str_index_end) {
-                // not found
+            if (p == haystack) {
                 break;
             }
-            str_index += direction;
         }
     }
     return NULL;
@@ -620,14 +632,9 @@ mp_obj_t mp_obj_str_split(size_t n_args, const mp_obj_t *args) {
 
         for (;;) {
             const byte *start = s;
-            for (;;) {
-                if (splits == 0 || s + sep_len > top) {
-                    s = top;
-                    break;
-                } else if (memcmp(s, sep_str, sep_len) == 0) {
-                    break;
-                }
-                s++;
+            // CIRCUITPY-CHANGE: use find_subbytes to skip to the next separator
+            if (splits == 0 || (s = find_subbytes(start, top - start, (const byte *)sep_str, sep_len, 1)) == NULL) {
+                s = top;
             }
             mp_obj_list_append(res, mp_obj_new_str_of_type(self_type, start, s - start));
             if (s >= top) {
@@ -726,16 +733,9 @@ static mp_obj_t str_rsplit(size_t n_args, const mp_obj_t *args) {
         const byte *beg = s;
         const byte *last = s + len;
         for (;;) {
-            s = last - sep_len;
-            for (;;) {
-                if (splits == 0 || s < beg) {
-                    break;
-                } else if (memcmp(s, sep_str, sep_len) == 0) {
-                    break;
-                }
-                s--;
-            }
-            if (s < beg || splits == 0) {
+            // CIRCUITPY-CHANGE: use find_subbytes to skip back to the previous separator
+            s = splits == 0 ? NULL : find_subbytes(beg, last - beg, (const byte *)sep_str, sep_len, -1);
+            if (s == NULL) {
                 res->items[idx] = mp_obj_new_str_of_type(self_type, beg, last - beg);
                 break;
             }
@@ -1009,10 +1009,15 @@ static NORETURN void terse_str_format_value_error(void) {
 #define terse_str_format_value_error()
 #endif
 
-static vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *arg_i, size_t n_args, const mp_obj_t *args, mp_map_t *kwargs) {
+// CIRCUITPY-CHANGE: format specs shorter than this without nested fields are
+// parsed from a stack buffer
+#define STR_FORMAT_SPEC_BUF_SIZE (32)
+
+// CIRCUITPY-CHANGE: alloc is the initial size of the returned vstr
+static vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *arg_i, size_t n_args, const mp_obj_t *args, mp_map_t *kwargs, size_t alloc) {
     vstr_t vstr;
     mp_print_t print;
-    vstr_init_print(&vstr, 16, &print);
+    vstr_init_print(&vstr, alloc, &print);
 
     for (; str < top; str++) {
         if (*str == '}') {
@@ -1165,8 +1170,11 @@ static vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *ar
             arg = args[(*arg_i) + 1];
             (*arg_i)++;
         }
-        if (!format_spec && !conversion) {
-            conversion = 's';
+        // CIRCUITPY-CHANGE: without a format spec the field is just str() or
+        // repr() of the argument, so print it straight into the output
+        if (!format_spec) {
+            mp_obj_print_helper(&print, arg, conversion == 'r' ? PRINT_REPR : PRINT_STR);
+            continue;
         }
         if (conversion) {
             mp_print_kind_t print_kind;
@@ -1201,9 +1209,19 @@ static vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *ar
             // precision   ::=  integer
             // type        ::=  "b" | "c" | "d" | "e" | "E" | "f" | "F" | "g" | "G" | "n" | "o" | "s" | "x" | "X" | "%"
 
-            // recursively call the formatter to format any nested specifiers
-            MP_STACK_CHECK();
-            vstr_t format_spec_vstr = mp_obj_str_format_helper(format_spec, str, arg_i, n_args, args, kwargs);
+            // CIRCUITPY-CHANGE: a short spec without nested fields is copied
+            // to the stack, otherwise recursively call the formatter to format
+            // any nested specifiers
+            size_t format_spec_len = str - format_spec;
+            char format_spec_buf[STR_FORMAT_SPEC_BUF_SIZE];
+            vstr_t format_spec_vstr;
+            if (format_spec_len < sizeof(format_spec_buf) && memchr(format_spec, '{', format_spec_len) == NULL) {
+                vstr_init_fixed_buf(&format_spec_vstr, sizeof(format_spec_buf), format_spec_buf);
+                vstr_add_strn(&format_spec_vstr, format_spec, format_spec_len);
+            } else {
+                MP_STACK_CHECK();
+                format_spec_vstr = mp_obj_str_format_helper(format_spec, str, arg_i, n_args, args, kwargs, 16);
+            }
             const char *s = vstr_null_terminated_str(&format_spec_vstr);
             const char *stop = s + format_spec_vstr.len;
             if (isalignment(*s)) {
@@ -1467,7 +1485,10 @@ mp_obj_t mp_obj_str_format(size_t n_args, const mp_obj_t *args, mp_map_t *kwargs
 
     GET_STR_DATA_LEN(args[0], str, len);
     int arg_i = 0;
-    vstr_t vstr = mp_obj_str_format_helper((const char *)str, (const char *)str + len, &arg_i, n_args, args, kwargs);
+    // CIRCUITPY-CHANGE: size the output up front for the literal text plus a
+    // short number per argument, to avoid growing it in the common case
+    size_t n_values = n_args - 1 + (kwargs == NULL ? 0 : kwargs->used);
+    vstr_t vstr = mp_obj_str_format_helper((const char *)str, (const char *)str + len, &arg_i, n_args, args, kwargs, len + 8 * n_values);
     return mp_obj_new_str_type_from_vstr(mp_obj_get_type(args[0]), &vstr);
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(str_format_obj, 1, mp_obj_str_format);
@@ -47,14 +47,14 @@ static void check_stringio_is_open(const mp_obj_stringio_t *o) {
 
 // CIRCUITPY-CHANGE: handling subclassing
 static mp_obj_stringio_t *native_obj(mp_obj_t o_in) {
-    mp_obj_stringio_t *native = mp_obj_cast_to_native_base(o_in, &mp_type_stringio);
+    mp_obj_t native = mp_obj_cast_to_native_base(o_in, MP_OBJ_FROM_PTR(&mp_type_stringio));
 
     #if MICROPY_PY_IO_BYTESIO
     if (native == MP_OBJ_NULL) {
-        native = mp_obj_cast_to_native_base(o_in, &mp_type_bytesio);
+        native = mp_obj_cast_to_native_base(o_in, MP_OBJ_FROM_PTR(&mp_type_bytesio));
     }
     #endif
-    return native;
+    return MP_OBJ_TO_PTR(native);
 }
 
 static void stringio_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
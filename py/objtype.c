@@ -111,6 +111,33 @@ static mp_obj_t native_base_init_wrapper(size_t n_args, const mp_obj_t *pos_args
 
 static MP_DEFINE_CONST_FUN_OBJ_KW(native_base_init_wrapper_obj, 1, native_base_init_wrapper);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_CLASS_SLOTS
+// Get the names of the slots of a type with MP_TYPE_FLAG_HAS_SLOTS set.  This is
+// NULL if __slots__ has since been replaced with something other than a tuple.
+static mp_obj_tuple_t *instance_type_get_slots(const mp_obj_type_t *type) {
+    mp_map_elem_t *elem = mp_map_lookup(&MP_OBJ_TYPE_GET_SLOT(type, locals_dict)->map, MP_OBJ_NEW_QSTR(MP_QSTR___slots__), MP_MAP_LOOKUP);
+    if (elem == NULL || !mp_obj_is_type(elem->value, &mp_type_tuple)) {
+        return NULL;
+    }
+    return MP_OBJ_TO_PTR(elem->value);
+}
+
+static bool instance_type_slots_contain(const mp_obj_tuple_t *slots, qstr attr) {
+    for (size_t i = 0; i < slots->len; i++) {
+        if (slots->items[i] == MP_OBJ_NEW_QSTR(attr)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool instance_type_has_slot(const mp_obj_type_t *type, qstr attr) {
+    mp_obj_tuple_t *slots = instance_type_get_slots(type);
+    return slots == NULL || instance_type_slots_contain(slots, attr);
+}
+#endif
+
 #if !MICROPY_CPYTHON_COMPAT
 static
 #endif
@@ -118,7 +145,15 @@ mp_obj_instance_t *mp_obj_new_instance(const mp_obj_type_t *class, const mp_obj_
     size_t num_native_bases = instance_count_native_bases(class, native_base);
     assert(num_native_bases < 2);
     mp_obj_instance_t *o = mp_obj_malloc_var(mp_obj_instance_t, subobj, mp_obj_t, num_native_bases, class);
-    mp_map_init(&o->members, 0);
+    // CIRCUITPY-CHANGE: instances with __slots__ get all the room they can use up front
+    size_t num_members = 0;
+    #if MICROPY_PY_CLASS_SLOTS
+    if (class->flags & MP_TYPE_FLAG_HAS_SLOTS) {
+        mp_obj_tuple_t *slots = instance_type_get_slots(class);
+        num_members = slots == NULL ? 0 : slots->len;
+    }
+    #endif
+    mp_map_init(&o->members, num_members);
     // Initialise the native base-class slot (should be 1 at most) with a valid
     // object.  It doesn't matter which object, so long as it can be uniquely
     // distinguished from a native class that is initialised.
@@ -201,7 +236,7 @@ static void mp_obj_class_lookup(struct class_lookup_data *lookup, const mp_obj_t
                     mp_obj_instance_t *obj = lookup->obj;
                     // CIRCUITPY-CHANGE: Pass object directly. MP passes the native object.
                     // This allows native code to lookup and call functions on Python subclasses.
-                    mp_convert_member_lookup(obj, type, elem->value, lookup->dest);
+                    mp_convert_member_lookup(MP_OBJ_FROM_PTR(obj), type, elem->value, lookup->dest);
                 }
                 #if DEBUG_PRINT
                 DEBUG_printf("mp_obj_class_lookup: Returning: ");
@@ -432,8 +467,9 @@ static mp_obj_t instance_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
         const mp_obj_type_t *native_base;
         size_t num_native_bases = instance_count_native_bases(mp_obj_get_type(self_in), &native_base);
 
+        // CIRCUITPY-CHANGE
         size_t sz = sizeof(*self) + sizeof(*self->subobj) * num_native_bases
-            + sizeof(*self->members.table) * self->members.alloc;
+            + mp_map_table_nbytes(&self->members);
         return MP_OBJ_NEW_SMALL_INT(sz);
     }
     #endif
@@ -825,6 +861,12 @@ skip_special_accessors:
         return elem != NULL;
     } else {
         // store attribute
+        // CIRCUITPY-CHANGE
+        #if MICROPY_PY_CLASS_SLOTS
+        if ((self->base.type->flags & MP_TYPE_FLAG_HAS_SLOTS) && !instance_type_has_slot(self->base.type, attr)) {
+            return false;
+        }
+        #endif
         mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP_ADD_IF_NOT_FOUND)->value = value;
         return true;
     }
@@ -998,6 +1040,68 @@ static bool check_for_special_accessors(mp_obj_t key, mp_obj_t value) {
 }
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_CLASS_SLOTS
+// Replace the __slots__ of a new class with a tuple of the slot names of the class
+// and its bases, and mark the class as having slots.  A base defined in Python
+// without __slots__ doesn't restrict the attributes of its instances, and nor
+// does a "__dict__" slot, so in those cases the class doesn't get slots either.
+static void instance_type_init_slots(mp_obj_type_t *type, size_t bases_len, const mp_obj_t *bases_items) {
+    mp_map_t *locals_map = &MP_OBJ_TYPE_GET_SLOT(type, locals_dict)->map;
+    mp_map_elem_t *elem = mp_map_lookup(locals_map, MP_OBJ_NEW_QSTR(MP_QSTR___slots__), MP_MAP_LOOKUP);
+    if (elem == NULL) {
+        return;
+    }
+
+    mp_obj_tuple_t *base_slots = NULL;
+    for (size_t i = 0; i < bases_len; i++) {
+        const mp_obj_type_t *t = MP_OBJ_TO_PTR(bases_items[i]);
+        if (!mp_obj_is_instance_type(t)) {
+            continue;
+        }
+        if (!(t->flags & MP_TYPE_FLAG_HAS_SLOTS) || base_slots != NULL) {
+            return;
+        }
+        base_slots = instance_type_get_slots(t);
+        if (base_slots == NULL) {
+            return;
+        }
+    }
+
+    size_t own_len;
+    mp_obj_t *own_items;
+    if (mp_obj_is_str(elem->value)) {
+        own_len = 1;
+        own_items = &elem->value;
+    } else {
+        mp_obj_get_array(elem->value, &own_len, &own_items);
+    }
+
+    size_t base_len = base_slots == NULL ? 0 : base_slots->len;
+    mp_obj_tuple_t *slots = MP_OBJ_TO_PTR(mp_obj_new_tuple(base_len + own_len, NULL));
+    slots->len = base_len;
+    if (base_len != 0) {
+        memcpy(slots->items, base_slots->items, base_len * sizeof(mp_obj_t));
+    }
+    for (size_t i = 0; i < own_len; i++) {
+        if (!mp_obj_is_str(own_items[i])) {
+            mp_raise_TypeError_varg(MP_ERROR_TEXT("%q in %q must be of type %q, not %q"),
+                MP_QSTR_object, MP_QSTR___slots__, MP_QSTR_str, mp_obj_get_type(own_items[i])->name);
+        }
+        qstr name = mp_obj_str_get_qstr(own_items[i]);
+        if (name == MP_QSTR___dict__) {
+            return;
+        }
+        if (!instance_type_slots_contain(slots, name)) {
+            slots->items[slots->len++] = MP_OBJ_NEW_QSTR(name);
+        }
+    }
+
+    elem->value = MP_OBJ_FROM_PTR(slots);
+    type->flags |= MP_TYPE_FLAG_HAS_SLOTS;
+}
+#endif
+
 static void type_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
     (void)kind;
     mp_obj_type_t *self = MP_OBJ_TO_PTR(self_in);
@@ -1256,6 +1360,11 @@ mp_obj_t mp_obj_new_type(qstr name, mp_obj_t bases_tuple, mp_obj_t locals_dict)
     }
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_CLASS_SLOTS
+    instance_type_init_slots(o, bases_len, bases_items);
+    #endif
+
     const mp_obj_type_t *native_base;
     size_t num_native_bases = instance_count_native_bases(o, &native_base);
     if (num_native_bases > 1) {
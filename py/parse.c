@@ -38,6 +38,10 @@
 #include "py/objint.h"
 #include "py/objstr.h"
 #include "py/builtin.h"
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_CONST_FOLDING_FLOAT_STR && MICROPY_PY_BUILTINS_FLOAT
+#include <math.h>
+#endif
 
 #if MICROPY_ENABLE_COMPILER
 
@@ -238,7 +242,7 @@ typedef struct _parser_t {
     mp_parse_chunk_t *cur_chunk;
 
     #if MICROPY_COMP_CONST
-    mp_map_t consts;
+    mp_map_t *consts;
     #endif
 } parser_t;
 
@@ -546,7 +550,12 @@ static void push_result_node(parser_t *parser, mp_parse_node_t pn) {
 }
 
 static mp_parse_node_t make_node_const_object(parser_t *parser, size_t src_line, mp_obj_t obj) {
+    #if MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_D
+    // CIRCUITPY-CHANGE: room for two nodes, which are more than one mp_obj_t with 64-bit pointers
+    mp_parse_node_struct_t *pn = parser_alloc(parser, sizeof(mp_parse_node_struct_t) + 2 * sizeof(mp_parse_node_t));
+    #else
     mp_parse_node_struct_t *pn = parser_alloc(parser, sizeof(mp_parse_node_struct_t) + sizeof(mp_obj_t));
+    #endif
     pn->source_line = src_line;
     #if MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_D
     // nodes are 32-bit pointers, but need to store 64-bit object
@@ -593,7 +602,7 @@ static void push_result_token(parser_t *parser, uint8_t rule_id) {
         // if name is a standalone identifier, look it up in the table of dynamic constants
         mp_map_elem_t *elem;
         if (rule_id == RULE_atom
-            && (elem = mp_map_lookup(&parser->consts, MP_OBJ_NEW_QSTR(id), MP_MAP_LOOKUP)) != NULL) {
+            && (elem = mp_map_lookup(parser->consts, MP_OBJ_NEW_QSTR(id), MP_MAP_LOOKUP)) != NULL) {
             pn = make_node_const_object_optimised(parser, lex->tok_line, elem->value);
         } else {
             pn = mp_parse_node_new_leaf(MP_PARSE_NODE_ID, id);
@@ -716,10 +725,168 @@ static bool fold_logical_constants(parser_t *parser, uint8_t rule_id, size_t *nu
     return false;
 }
 
+// CIRCUITPY-CHANGE: folding of float and str expressions
+#if MICROPY_COMP_CONST_FOLDING_FLOAT_STR
+
+static bool parse_node_get_str_maybe(mp_parse_node_t pn, mp_obj_t *o) {
+    if (MP_PARSE_NODE_IS_LEAF(pn) && MP_PARSE_NODE_LEAF_KIND(pn) == MP_PARSE_NODE_STRING) {
+        *o = MP_OBJ_NEW_QSTR(MP_PARSE_NODE_LEAF_ARG(pn));
+        return true;
+    } else if (MP_PARSE_NODE_IS_STRUCT_KIND(pn, RULE_const_object)) {
+        *o = mp_parse_node_extract_const_object((mp_parse_node_struct_t *)pn);
+        return mp_obj_is_str(*o);
+    } else {
+        return false;
+    }
+}
+
+static mp_parse_node_t make_node_str(parser_t *parser, mp_obj_t obj) {
+    GET_STR_DATA_LEN(obj, str, len);
+    qstr qst;
+    if (len <= MICROPY_ALLOC_PARSE_INTERN_STRING_LEN) {
+        qst = qstr_from_strn((const char *)str, len);
+    } else {
+        qst = qstr_find_strn((const char *)str, len);
+    }
+    if (qst != MP_QSTRnull) {
+        return mp_parse_node_new_leaf(MP_PARSE_NODE_STRING, qst);
+    }
+    return make_node_const_object(parser, 0, obj);
+}
+
+#if MICROPY_PY_BUILTINS_FLOAT
+// mpy-cross doesn't know the float precision of the target, so a folded value
+// must be exact in single precision to give the same result on every target.
+static bool float_is_exact(mp_float_t f) {
+    return !isinf(f) && !isnan(f) && (mp_float_t)(float)f == f;
+}
+
+static bool parse_node_get_float_maybe(mp_parse_node_t pn, mp_float_t *f, bool *is_float) {
+    mp_obj_t o;
+    if (mp_parse_node_get_int_maybe(pn, &o)) {
+        if (!mp_obj_is_small_int(o)) {
+            return false;
+        }
+        mp_int_t i = MP_OBJ_SMALL_INT_VALUE(o);
+        if (i < -(1 << 24) || i > (1 << 24)) {
+            return false;
+        }
+        *f = (mp_float_t)i;
+        *is_float = false;
+        return true;
+    } else if (MP_PARSE_NODE_IS_STRUCT_KIND(pn, RULE_const_object)) {
+        o = mp_parse_node_extract_const_object((mp_parse_node_struct_t *)pn);
+        if (!mp_obj_is_float(o)) {
+            return false;
+        }
+        *f = mp_obj_float_get(o);
+        *is_float = true;
+        return true;
+    } else {
+        return false;
+    }
+}
+#endif
+
+static bool fold_float_str_constants(parser_t *parser, uint8_t rule_id, size_t num_args) {
+    // this code does folding of float expressions, eg 1.5 * 2 or 1 / 4, and of
+    // str concatenation, eg "abc" + "def"; anything else is left to fold_constants
+
+    mp_obj_t arg0;
+    if (rule_id == RULE_arith_expr || rule_id == RULE_term) {
+        mp_parse_node_t pn = peek_result(parser, num_args - 1);
+        if (parse_node_get_str_maybe(pn, &arg0)) {
+            // folding for str concatenation: +
+            for (ssize_t i = num_args - 2; i >= 1; i -= 2) {
+                mp_obj_t arg1;
+                if (MP_PARSE_NODE_LEAF_ARG(peek_result(parser, i)) != MP_TOKEN_OP_PLUS
+                    || !parse_node_get_str_maybe(peek_result(parser, i - 1), &arg1)) {
+                    return false;
+                }
+                arg0 = mp_binary_op(MP_BINARY_OP_ADD, arg0, arg1);
+            }
+            for (size_t i = num_args; i > 0; i--) {
+                pop_result(parser);
+            }
+            push_result_node(parser, make_node_str(parser, arg0));
+            return true;
+        }
+        #if MICROPY_PY_BUILTINS_FLOAT
+        // folding for float binary ops: + - * /
+        mp_float_t lhs;
+        bool is_float;
+        if (!parse_node_get_float_maybe(pn, &lhs, &is_float) || !float_is_exact(lhs)) {
+            return false;
+        }
+        bool any_float = is_float;
+        for (ssize_t i = num_args - 2; i >= 1; i -= 2) {
+            mp_float_t rhs;
+            if (!parse_node_get_float_maybe(peek_result(parser, i - 1), &rhs, &is_float) || !float_is_exact(rhs)) {
+                return false;
+            }
+            any_float |= is_float;
+            mp_token_kind_t tok = MP_PARSE_NODE_LEAF_ARG(peek_result(parser, i));
+            if (tok == MP_TOKEN_OP_PLUS) {
+                lhs += rhs;
+            } else if (tok == MP_TOKEN_OP_MINUS) {
+                lhs -= rhs;
+            } else if (tok == MP_TOKEN_OP_STAR) {
+                lhs *= rhs;
+            } else if (tok == MP_TOKEN_OP_SLASH && rhs != 0) {
+                lhs /= rhs;
+                any_float = true;
+            } else {
+                // Can't fold @ % // or division by zero
+                return false;
+            }
+            if (!float_is_exact(lhs)) {
+                return false;
+            }
+        }
+        if (!any_float) {
+            // pure integer expression
+            return false;
+        }
+        arg0 = mp_obj_new_float(lhs);
+        #else
+        return false;
+        #endif
+    #if MICROPY_PY_BUILTINS_FLOAT
+    } else if (rule_id == RULE_factor_2) {
+        // folding for float unary ops: + -
+        // negation is exact at any precision so the operand can have any value
+        mp_float_t f;
+        bool is_float;
+        mp_token_kind_t tok = MP_PARSE_NODE_LEAF_ARG(peek_result(parser, 1));
+        if (!parse_node_get_float_maybe(peek_result(parser, 0), &f, &is_float)
+            || !is_float || tok == MP_TOKEN_OP_TILDE) {
+            return false;
+        }
+        arg0 = mp_obj_new_float(tok == MP_TOKEN_OP_MINUS ? -f : f);
+    #endif
+    } else {
+        return false;
+    }
+
+    for (size_t i = num_args; i > 0; i--) {
+        pop_result(parser);
+    }
+    push_result_node(parser, make_node_const_object(parser, 0, arg0));
+    return true;
+}
+#endif
+
 static bool fold_constants(parser_t *parser, uint8_t rule_id, size_t num_args) {
     // this code does folding of arbitrary integer expressions, eg 1 + 2 * 3 + 4
     // it does not do partial folding, eg 1 + 2 + x -> 3 + x
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_COMP_CONST_FOLDING_FLOAT_STR
+    if (fold_float_str_constants(parser, rule_id, num_args)) {
+        return true;
+    }
+    #endif
+
     mp_obj_t arg0;
     if (rule_id == RULE_expr
         || rule_id == RULE_xor_expr
@@ -833,7 +1000,7 @@ static bool fold_constants(parser_t *parser, uint8_t rule_id, size_t num_args) {
                 mp_obj_t value = mp_parse_node_convert_to_obj(pn_value);
 
                 // store the value in the table of dynamic constants
-                mp_map_elem_t *elem = mp_map_lookup(&parser->consts, MP_OBJ_NEW_QSTR(id), MP_MAP_LOOKUP_ADD_IF_NOT_FOUND);
+                mp_map_elem_t *elem = mp_map_lookup(parser->consts, MP_OBJ_NEW_QSTR(id), MP_MAP_LOOKUP_ADD_IF_NOT_FOUND);
                 assert(elem->value == MP_OBJ_NULL);
                 elem->value = value;
 
@@ -1028,11 +1195,8 @@ static void push_result_rule(parser_t *parser, size_t src_line, uint8_t rule_id,
     push_result_node(parser, (mp_parse_node_t)pn);
 }
 
-mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
-    // Set exception handler to free the lexer if an exception is raised.
-    MP_DEFINE_NLR_JUMP_CALLBACK_FUNCTION_1(ctx, mp_lexer_free, lex);
-    nlr_push_jump_callback(&ctx.callback, mp_call_function_1_from_nlr_jump_callback);
-
+// CIRCUITPY-CHANGE: parse using the given top-level rule, leaving the lexer for the caller to free
+static mp_parse_tree_t parse(mp_lexer_t *lex, size_t top_level_rule, mp_map_t *consts) {
     // initialise parser and allocate memory for its stacks
 
     parser_t parser;
@@ -1072,21 +1236,11 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     parser.cur_chunk = NULL;
 
     #if MICROPY_COMP_CONST
-    mp_map_init(&parser.consts, 0);
+    parser.consts = consts;
+    #else
+    (void)consts;
     #endif
 
-    // work out the top-level rule to use, and push it on the stack
-    size_t top_level_rule;
-    switch (input_kind) {
-        case MP_PARSE_SINGLE_INPUT:
-            top_level_rule = RULE_single_input;
-            break;
-        case MP_PARSE_EVAL_INPUT:
-            top_level_rule = RULE_eval_input;
-            break;
-        default:
-            top_level_rule = RULE_file_input;
-    }
     push_rule(&parser, lex->tok_line, top_level_rule, 0);
 
     // parse!
@@ -1198,7 +1352,7 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
 
                 #if !MICROPY_ENABLE_DOC_STRING
                 // this code discards lonely statements, such as doc strings
-                if (input_kind != MP_PARSE_SINGLE_INPUT && rule_id == RULE_expr_stmt && peek_result(&parser, 0) == MP_PARSE_NODE_NULL) {
+                if (top_level_rule != RULE_single_input && rule_id == RULE_expr_stmt && peek_result(&parser, 0) == MP_PARSE_NODE_NULL) {
                     mp_parse_node_t p = peek_result(&parser, 1);
                     if ((MP_PARSE_NODE_IS_LEAF(p) && !MP_PARSE_NODE_IS_ID(p))
                         || MP_PARSE_NODE_IS_STRUCT_KIND(p, RULE_const_object)) {
@@ -1347,10 +1501,6 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
         }
     }
 
-    #if MICROPY_COMP_CONST
-    mp_map_deinit(&parser.consts);
-    #endif
-
     // truncate final chunk and link into chain of chunks
     if (parser.cur_chunk != NULL) {
         (void)m_renew_maybe(byte, parser.cur_chunk,
@@ -1363,7 +1513,8 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     }
 
     if (
-        lex->tok_kind != MP_TOKEN_END // check we are at the end of the token stream
+        // check we are at the end of the token stream, unless parsing a single statement
+        (lex->tok_kind != MP_TOKEN_END && top_level_rule != RULE_stmt)
         || parser.result_stack_top == 0 // check that we got a node (can fail on empty input)
         ) {
     syntax_error:;
@@ -1400,12 +1551,81 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     m_del(rule_stack_t, parser.rule_stack, parser.rule_stack_alloc);
     m_del(mp_parse_node_t, parser.result_stack, parser.result_stack_alloc);
 
+    return parser.tree;
+}
+
+mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
+    // Set exception handler to free the lexer if an exception is raised.
+    MP_DEFINE_NLR_JUMP_CALLBACK_FUNCTION_1(ctx, mp_lexer_free, lex);
+    nlr_push_jump_callback(&ctx.callback, mp_call_function_1_from_nlr_jump_callback);
+
+    // work out the top-level rule to use
+    size_t top_level_rule;
+    switch (input_kind) {
+        case MP_PARSE_SINGLE_INPUT:
+            top_level_rule = RULE_single_input;
+            break;
+        case MP_PARSE_EVAL_INPUT:
+            top_level_rule = RULE_eval_input;
+            break;
+        default:
+            top_level_rule = RULE_file_input;
+    }
+
+    mp_map_t *consts = NULL;
+    #if MICROPY_COMP_CONST
+    mp_map_t consts_map;
+    mp_map_init(&consts_map, 0);
+    consts = &consts_map;
+    #endif
+
+    mp_parse_tree_t tree = parse(lex, top_level_rule, consts);
+
+    #if MICROPY_COMP_CONST
+    mp_map_deinit(consts);
+    #endif
+
     // Deregister exception handler and free the lexer.
     nlr_pop_jump_callback(true);
 
-    return parser.tree;
+    return tree;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PARSE_STREAMING
+
+void mp_parse_stream_init(mp_parse_stream_t *stream, mp_lexer_t *lex) {
+    stream->lex = lex;
+    #if MICROPY_COMP_CONST
+    mp_map_init(&stream->consts, 0);
+    #endif
+}
+
+bool mp_parse_stream_next(mp_parse_stream_t *stream, mp_parse_tree_t *tree) {
+    mp_lexer_t *lex = stream->lex;
+    while (lex->tok_kind == MP_TOKEN_NEWLINE) {
+        mp_lexer_to_next(lex);
+    }
+    if (lex->tok_kind == MP_TOKEN_END) {
+        return false;
+    }
+    mp_map_t *consts = NULL;
+    #if MICROPY_COMP_CONST
+    consts = &stream->consts;
+    #endif
+    *tree = parse(lex, RULE_stmt, consts);
+    return true;
+}
+
+void mp_parse_stream_deinit(mp_parse_stream_t *stream) {
+    #if MICROPY_COMP_CONST
+    mp_map_deinit(&stream->consts);
+    #endif
+    mp_lexer_free(stream->lex);
+}
+
+#endif // MICROPY_PARSE_STREAMING
+
 void mp_parse_tree_clear(mp_parse_tree_t *tree) {
     mp_parse_chunk_t *chunk = tree->chunk;
     while (chunk != NULL) {
@@ -113,4 +113,23 @@ typedef struct _mp_parse_t {
 mp_parse_tree_t mp_parse(struct _mp_lexer_t *lex, mp_parse_input_kind_t input_kind);
 void mp_parse_tree_clear(mp_parse_tree_t *tree);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PARSE_STREAMING
+// State for parsing a file one top-level statement at a time, so that only
+// one statement's parse tree needs to be in memory at once.
+typedef struct _mp_parse_stream_t {
+    struct _mp_lexer_t *lex;
+    #if MICROPY_COMP_CONST
+    mp_map_t consts;
+    #endif
+} mp_parse_stream_t;
+
+// mp_parse_stream_next returns false at the end of the input, otherwise it
+// parses the next statement into tree; it raises an exception on error
+// mp_parse_stream_deinit frees the lexer, and must be called even on error
+void mp_parse_stream_init(mp_parse_stream_t *stream, struct _mp_lexer_t *lex);
+bool mp_parse_stream_next(mp_parse_stream_t *stream, mp_parse_tree_t *tree);
+void mp_parse_stream_deinit(mp_parse_stream_t *stream);
+#endif
+
 #endif // MICROPY_INCLUDED_PY_PARSE_H
@@ -250,10 +250,17 @@ static mp_raw_code_t *load_raw_code(mp_reader_t *reader, mp_module_context_t *co
     #endif
 
     if (kind == MP_CODE_BYTECODE) {
-        // Allocate memory for the bytecode
-        fun_data = m_new(uint8_t, fun_data_len);
-        // Load bytecode
-        read_bytes(reader, fun_data, fun_data_len);
+        // CIRCUITPY-CHANGE: bytecode in ROM is run where it is
+        #if MICROPY_PERSISTENT_CODE_LOAD_IN_PLACE
+        fun_data = (uint8_t *)mp_reader_try_read_rom(reader, fun_data_len);
+        if (fun_data == NULL)
+        #endif
+        {
+            // Allocate memory for the bytecode
+            fun_data = m_new(uint8_t, fun_data_len);
+            // Load bytecode
+            read_bytes(reader, fun_data, fun_data_len);
+        }
 
     #if MICROPY_EMIT_MACHINE_CODE
     } else {
@@ -412,7 +419,9 @@ void mp_raw_code_load(mp_reader_t *reader, mp_compiled_module_t *cm) {
     if (header[0] != 'C'
         || header[1] != MPY_VERSION
         || (arch != MP_NATIVE_ARCH_NONE && MPY_FEATURE_DECODE_SUB_VERSION(header[2]) != MPY_SUB_VERSION)
-        || header[3] > MP_SMALL_INT_BITS) {
+        // CIRCUITPY-CHANGE
+        || (header[3] & ~MPY_FEATURE_FUSED_OPS) > MP_SMALL_INT_BITS
+        || (!MICROPY_BC_FUSED_OPS && (header[3] & MPY_FEATURE_FUSED_OPS))) {
         mp_raise_ValueError(MP_ERROR_TEXT("incompatible .mpy file"));
     }
     if (MPY_FEATURE_DECODE_ARCH(header[2]) != MP_NATIVE_ARCH_NONE) {
@@ -464,7 +473,12 @@ void mp_raw_code_load_mem(const byte *buf, size_t len, mp_compiled_module_t *con
 
 void mp_raw_code_load_file(qstr filename, mp_compiled_module_t *context) {
     mp_reader_t reader;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PERSISTENT_CODE_LOAD_IN_PLACE
+    mp_reader_new_file_rom(&reader, filename);
+    #else
     mp_reader_new_file(&reader, filename);
+    #endif
     mp_raw_code_load(&reader, context);
 }
 
@@ -609,15 +623,15 @@ void mp_raw_code_save(mp_compiled_module_t *cm, mp_print_t *print) {
     //  byte  'C' (CIRCUITPY)
     //  byte  version
     //  byte  native arch (and sub-version if native)
-    //  byte  number of bits in a small int
+    //  byte  number of bits in a small int (and whether opcodes are fused)
     byte header[4] = {
         'C',
         MPY_VERSION,
         cm->has_native ? MPY_FEATURE_ENCODE_SUB_VERSION(MPY_SUB_VERSION) | MPY_FEATURE_ENCODE_ARCH(MPY_FEATURE_ARCH_DYNAMIC) : 0,
         #if MICROPY_DYNAMIC_COMPILER
-        mp_dynamic_compiler.small_int_bits,
+        mp_dynamic_compiler.small_int_bits | (mp_dynamic_compiler.bc_fused_ops ? MPY_FEATURE_FUSED_OPS : 0),
         #else
-        MP_SMALL_INT_BITS,
+        MP_SMALL_INT_BITS | (MICROPY_BC_FUSED_OPS ? MPY_FEATURE_FUSED_OPS : 0),
         #endif
     };
     mp_print_bytes(print, header, sizeof(header));
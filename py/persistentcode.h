@@ -47,6 +47,11 @@
 #define MPY_FEATURE_ENCODE_ARCH(arch) ((arch) << 2)
 #define MPY_FEATURE_DECODE_ARCH(feat) ((feat) >> 2)
 
+// CIRCUITPY-CHANGE: set in the small-int-bits byte when the bytecode may use
+// the fused opcodes of MICROPY_BC_FUSED_OPS. Firmware that predates the flag
+// sees an oversized small int and rejects the file.
+#define MPY_FEATURE_FUSED_OPS (0x80)
+
 // Define the host architecture
 #if MICROPY_EMIT_X86
     #define MPY_FEATURE_ARCH (MP_NATIVE_ARCH_X86)
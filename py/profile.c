@@ -975,3 +975,159 @@ void mp_prof_print_instr(const byte *ip, mp_code_state_t *code_state) {
 #endif // MICROPY_PROF_INSTR_DEBUG_PRINT_ENABLE
 
 #endif // MICROPY_PY_SYS_SETTRACE
+
+// CIRCUITPY-CHANGE: sampling profiler
+#if MICROPY_PY_MICROPYTHON_PROFILE
+
+#include <string.h>
+
+typedef struct _mp_prof_sample_entry_t {
+    uint32_t count;
+    uint32_t hash;
+    // Innermost frame first; unused frames are NULL.
+    const mp_obj_fun_bc_t *fun[MICROPY_PY_MICROPYTHON_PROFILE_DEPTH];
+    const byte *ip[MICROPY_PY_MICROPYTHON_PROFILE_DEPTH];
+} mp_prof_sample_entry_t;
+
+typedef struct _mp_prof_samples_t {
+    volatile bool active;
+    // Samples taken while no bytecode was running, and samples whose call
+    // stack didn't fit in the table.
+    uint32_t idle;
+    uint32_t dropped;
+    mp_prof_sample_entry_t entries[MICROPY_PY_MICROPYTHON_PROFILE_ENTRIES];
+} mp_prof_samples_t;
+
+// The table is on the GC heap and reachable from here, so everything it points
+// to stays alive until the next profile_start().
+MP_REGISTER_ROOT_POINTER(struct _mp_prof_samples_t *prof_samples);
+
+static bool prof_timer_enabled;
+
+void mp_prof_sample_start(void) {
+    mp_prof_samples_t *samples = MP_STATE_VM(prof_samples);
+    if (samples == NULL) {
+        samples = m_new(mp_prof_samples_t, 1);
+    } else {
+        samples->active = false;
+    }
+    memset(samples, 0, sizeof(*samples));
+    MP_STATE_VM(prof_samples) = samples;
+    samples->active = true;
+    if (!prof_timer_enabled) {
+        prof_timer_enabled = true;
+        mp_prof_sample_timer(true);
+    }
+}
+
+void mp_prof_sample_stop(void) {
+    mp_prof_samples_t *samples = MP_STATE_VM(prof_samples);
+    if (samples != NULL) {
+        samples->active = false;
+    }
+    if (prof_timer_enabled) {
+        prof_timer_enabled = false;
+        mp_prof_sample_timer(false);
+    }
+}
+
+// Called from a timer interrupt, so it must not allocate or raise.
+void mp_prof_sample(void) {
+    mp_prof_samples_t *samples = MP_STATE_VM(prof_samples);
+    if (samples == NULL || !samples->active) {
+        return;
+    }
+    const mp_code_state_t *code_state = MP_STATE_THREAD(current_code_state);
+    if (code_state == NULL) {
+        samples->idle += 1;
+        return;
+    }
+
+    const mp_obj_fun_bc_t *fun[MICROPY_PY_MICROPYTHON_PROFILE_DEPTH] = { NULL };
+    const byte *ip[MICROPY_PY_MICROPYTHON_PROFILE_DEPTH] = { NULL };
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < MICROPY_PY_MICROPYTHON_PROFILE_DEPTH && code_state != NULL; ++i) {
+        fun[i] = code_state->fun_bc;
+        ip[i] = code_state->ip;
+        hash = (hash ^ (uintptr_t)fun[i]) * 16777619u;
+        hash = (hash ^ (uintptr_t)ip[i]) * 16777619u;
+        code_state = code_state->prev_state;
+    }
+
+    // Open addressing with linear probing; entries are never removed.
+    size_t idx = hash % MICROPY_PY_MICROPYTHON_PROFILE_ENTRIES;
+    for (size_t n = 0; n < MICROPY_PY_MICROPYTHON_PROFILE_ENTRIES; ++n) {
+        mp_prof_sample_entry_t *e = &samples->entries[idx];
+        if (e->count == 0) {
+            e->hash = hash;
+            memcpy(e->fun, fun, sizeof(fun));
+            memcpy(e->ip, ip, sizeof(ip));
+            e->count = 1;
+            return;
+        }
+        if (e->hash == hash && memcmp(e->fun, fun, sizeof(fun)) == 0 && memcmp(e->ip, ip, sizeof(ip)) == 0) {
+            e->count += 1;
+            return;
+        }
+        if (++idx == MICROPY_PY_MICROPYTHON_PROFILE_ENTRIES) {
+            idx = 0;
+        }
+    }
+    samples->dropped += 1;
+}
+
+static void mp_prof_print_frame(const mp_print_t *print, const mp_obj_fun_bc_t *fun, const byte *cur_ip) {
+    const byte *ip = fun->bytecode;
+    MP_BC_PRELUDE_SIG_DECODE(ip);
+    MP_BC_PRELUDE_SIZE_DECODE(ip);
+    const byte *line_info_top = ip + n_info;
+    const byte *bytecode_start = ip + n_info + n_cell;
+    // The ip is only saved before opcodes that can raise, and is before the
+    // opcodes on entry to a function.
+    size_t bc = cur_ip > bytecode_start ? (size_t)(cur_ip - bytecode_start) : 0;
+    qstr block_name = mp_decode_uint_value(ip);
+    for (size_t i = 0; i < 1 + n_pos_args + n_kwonly_args; ++i) {
+        ip = mp_decode_uint_skip(ip);
+    }
+    #if MICROPY_EMIT_BYTECODE_USES_QSTR_TABLE
+    block_name = fun->context->constants.qstr_table[block_name];
+    qstr source_file = fun->context->constants.qstr_table[0];
+    #else
+    qstr source_file = fun->context->constants.source_file;
+    #endif
+    size_t source_line = mp_bytecode_get_source_line(ip, line_info_top, bc);
+    mp_printf(print, "%q (%q:%u)", block_name, source_file, (uint)source_line);
+}
+
+void mp_prof_sample_dump(const mp_print_t *print) {
+    const mp_prof_samples_t *samples = MP_STATE_VM(prof_samples);
+    if (samples == NULL) {
+        return;
+    }
+    // One line per call stack, outermost frame first, in the "folded" format
+    // read by flame graph tools.
+    for (size_t i = 0; i < MICROPY_PY_MICROPYTHON_PROFILE_ENTRIES; ++i) {
+        const mp_prof_sample_entry_t *e = &samples->entries[i];
+        uint32_t count = e->count;
+        if (count == 0) {
+            continue;
+        }
+        size_t depth = MICROPY_PY_MICROPYTHON_PROFILE_DEPTH;
+        while (e->fun[depth - 1] == NULL) {
+            --depth;
+        }
+        while (depth-- > 0) {
+            mp_prof_print_frame(print, e->fun[depth], e->ip[depth]);
+            mp_print_str(print, depth > 0 ? ";" : " ");
+        }
+        mp_printf(print, "%u\n", (uint)count);
+    }
+    if (samples->idle != 0) {
+        mp_printf(print, "<idle> %u\n", (uint)samples->idle);
+    }
+    if (samples->dropped != 0) {
+        mp_printf(print, "<dropped> %u\n", (uint)samples->dropped);
+    }
+}
+
+#endif // MICROPY_PY_MICROPYTHON_PROFILE
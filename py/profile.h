@@ -78,4 +78,16 @@ void mp_prof_print_instr(const byte *ip, mp_code_state_t *code_state);
 #endif
 
 #endif // MICROPY_PY_SYS_SETTRACE
+
+// CIRCUITPY-CHANGE: sampling profiler
+#if MICROPY_PY_MICROPYTHON_PROFILE
+void mp_prof_sample_start(void);
+void mp_prof_sample_stop(void);
+void mp_prof_sample_dump(const mp_print_t *print);
+// Called by the port's timer interrupt while enabled.
+void mp_prof_sample(void);
+// Provided by the port: start or stop calling mp_prof_sample() periodically.
+void mp_prof_sample_timer(bool enable);
+#endif
+
 #endif // MICROPY_INCLUDED_PY_PROFILING_H
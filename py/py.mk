@@ -285,6 +285,12 @@ $(HEADER_BUILD)/root_pointers.h: $(HEADER_BUILD)/root_pointers.collected $(PY_SR
 	@$(ECHO) "GEN $@"
 	$(Q)$(PYTHON) $(PY_SRC)/make_root_pointers.py $< > $@
 
+# CIRCUITPY-CHANGE
+# build perfect hashes of const map tables for py/map.c.
+$(HEADER_BUILD)/map_hashes.h: $(HEADER_BUILD)/map_tables.collected $(HEADER_BUILD)/qstrdefs.generated.h $(PY_SRC)/make_map_hashes.py
+	@$(ECHO) "GEN $@"
+	$(Q)$(PYTHON) $(PY_SRC)/make_map_hashes.py $< $(HEADER_BUILD)/qstrdefs.generated.h > $@
+
 # Standard C functions like memset need to be compiled with special flags so
 # the compiler does not optimise these functions in terms of themselves.
 CFLAGS_BUILTIN ?= -ffreestanding -fno-builtin -fno-lto
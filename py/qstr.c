@@ -60,13 +60,17 @@
 // allocated pool is twice this size.  The value here must be <= MP_QSTRnumber_of.
 #define MICROPY_ALLOC_QSTR_ENTRIES_INIT (10)
 
-// this must match the equivalent function in makeqstrdata.py
-size_t qstr_compute_hash(const byte *data, size_t len) {
+// CIRCUITPY-CHANGE: the unmasked hash is also used by the qstr index
+static inline size_t qstr_compute_hash_full(const byte *data, size_t len) {
     // djb2 algorithm; see http://www.cse.yorku.ca/~oz/hash.html
     size_t hash = 5381;
     for (const byte *top = data + len; data < top; data++) {
         hash = ((hash << 5) + hash) ^ (*data); // hash * 33 ^ data
     }
+    return hash;
+}
+
+static inline size_t qstr_mask_hash(size_t hash) {
     hash &= Q_HASH_MASK;
     // Make sure that valid hash is never zero, zero means "hash not computed"
     if (hash == 0) {
@@ -75,6 +79,11 @@ size_t qstr_compute_hash(const byte *data, size_t len) {
     return hash;
 }
 
+// this must match the equivalent function in makeqstrdata.py
+size_t qstr_compute_hash(const byte *data, size_t len) {
+    return qstr_mask_hash(qstr_compute_hash_full(data, len));
+}
+
 // The first pool is the static qstr table. The contents must remain stable as
 // it is part of the .mpy ABI. See the top of py/persistentcode.c and
 // static_qstr_list in makeqstrdata.py. This pool is unsorted (although in a
@@ -216,6 +225,69 @@ void qstr_init(void) {
     #endif
 }
 
+// CIRCUITPY-CHANGE: hash index for dynamically allocated pools
+#if MICROPY_OPT_QSTR_INDEX
+
+// Each pool allocated by qstr_add has an open-addressed index placed between
+// its qstrs and hashes arrays.  A slot holds the entry's position in the pool
+// plus one, or zero if it is empty.  The index is less than 2/3 full so a probe
+// always reaches an empty slot.
+typedef uint16_t qstr_index_t;
+
+// Pools are capped at this many entries so that a position fits in a slot.
+#define QSTR_INDEX_MAX_ALLOC (0xfffe)
+
+static size_t qstr_index_size(size_t alloc) {
+    size_t size = 4;
+    while (size < alloc + alloc / 2 + 1) {
+        size *= 2;
+    }
+    return size;
+}
+
+static inline qstr_index_t *qstr_index(const qstr_pool_t *pool) {
+    return (qstr_index_t *)(pool->qstrs + pool->alloc);
+}
+
+// djb2 mixes poorly into its low bits, so scramble it before masking.
+static inline size_t qstr_index_pos(size_t hash) {
+    uint32_t x = (uint32_t)hash * 0x9E3779B1;
+    return x ^ (x >> 16);
+}
+
+// Returns the slot that holds the given string, or the empty slot where it
+// would go.
+static qstr_index_t *qstr_index_lookup(const qstr_pool_t *pool, size_t full_hash, const char *str, size_t str_len) {
+    qstr_index_t *index = qstr_index(pool);
+    size_t mask = qstr_index_size(pool->alloc) - 1;
+    #if MICROPY_QSTR_BYTES_IN_HASH
+    size_t str_hash = qstr_mask_hash(full_hash);
+    #endif
+    for (size_t pos = qstr_index_pos(full_hash) & mask;; pos = (pos + 1) & mask) {
+        qstr_index_t slot = index[pos];
+        if (slot == 0) {
+            return &index[pos];
+        }
+        size_t at = slot - 1;
+        if (
+            #if MICROPY_QSTR_BYTES_IN_HASH
+            pool->hashes[at] == str_hash &&
+            #endif
+            pool->lengths[at] == str_len
+            && memcmp(pool->qstrs[at], str, str_len) == 0) {
+            return &index[pos];
+        }
+    }
+}
+
+#define QSTR_INDEX_BYTES(alloc) (sizeof(qstr_index_t) * qstr_index_size(alloc))
+
+#else
+
+#define QSTR_INDEX_BYTES(alloc) (0)
+
+#endif
+
 static const qstr_pool_t *find_qstr(qstr *q) {
     // search pool for this qstr
     // total_prev_len==0 in the final pool, so the loop will always terminate
@@ -230,7 +302,13 @@ static const qstr_pool_t *find_qstr(qstr *q) {
 
 // qstr_mutex must be taken while in this function
 static qstr qstr_add(mp_uint_t len, const char *q_ptr) {
-    #if MICROPY_QSTR_BYTES_IN_HASH
+    // CIRCUITPY-CHANGE: the index needs the unmasked hash
+    #if MICROPY_OPT_QSTR_INDEX
+    size_t full_hash = qstr_compute_hash_full((const byte *)q_ptr, len);
+    #endif
+    #if MICROPY_QSTR_BYTES_IN_HASH && MICROPY_OPT_QSTR_INDEX
+    mp_uint_t hash = qstr_mask_hash(full_hash);
+    #elif MICROPY_QSTR_BYTES_IN_HASH
     mp_uint_t hash = qstr_compute_hash((const byte *)q_ptr, len);
     DEBUG_printf("QSTR: add hash=%d len=%d data=%.*s\n", hash, len, len, q_ptr);
     #else
@@ -244,12 +322,17 @@ static qstr qstr_add(mp_uint_t len, const char *q_ptr) {
         // Put a lower bound on the allocation size in case the extra qstr pool has few entries
         new_alloc = MAX(MICROPY_ALLOC_QSTR_ENTRIES_INIT, new_alloc);
         #endif
+        // CIRCUITPY-CHANGE: room for the hash index
+        #if MICROPY_OPT_QSTR_INDEX
+        new_alloc = MIN(new_alloc, QSTR_INDEX_MAX_ALLOC);
+        #endif
         mp_uint_t pool_size = sizeof(qstr_pool_t)
             + (sizeof(const char *)
                 #if MICROPY_QSTR_BYTES_IN_HASH
                 + sizeof(qstr_hash_t)
                 #endif
-                + sizeof(qstr_len_t)) * new_alloc;
+                + sizeof(qstr_len_t)) * new_alloc
+            + QSTR_INDEX_BYTES(new_alloc);
         qstr_pool_t *pool = (qstr_pool_t *)m_malloc_maybe(pool_size);
         if (pool == NULL) {
             // Keep qstr_last_chunk consistent with qstr_pool_t: qstr_last_chunk is not scanned
@@ -261,16 +344,20 @@ static qstr qstr_add(mp_uint_t len, const char *q_ptr) {
             QSTR_EXIT();
             m_malloc_fail(new_alloc);
         }
+        // CIRCUITPY-CHANGE: the hash index goes straight after the qstrs
         #if MICROPY_QSTR_BYTES_IN_HASH
-        pool->hashes = (qstr_hash_t *)(pool->qstrs + new_alloc);
+        pool->hashes = (qstr_hash_t *)((byte *)(pool->qstrs + new_alloc) + QSTR_INDEX_BYTES(new_alloc));
         pool->lengths = (qstr_len_t *)(pool->hashes + new_alloc);
         #else
-        pool->lengths = (qstr_len_t *)(pool->qstrs + new_alloc);
+        pool->lengths = (qstr_len_t *)((byte *)(pool->qstrs + new_alloc) + QSTR_INDEX_BYTES(new_alloc));
         #endif
         pool->prev = MP_STATE_VM(last_pool);
         pool->total_prev_len = MP_STATE_VM(last_pool)->total_prev_len + MP_STATE_VM(last_pool)->len;
         pool->alloc = new_alloc;
         pool->len = 0;
+        #if MICROPY_OPT_QSTR_INDEX
+        memset(qstr_index(pool), 0, QSTR_INDEX_BYTES(new_alloc));
+        #endif
         MP_STATE_VM(last_pool) = pool;
         DEBUG_printf("QSTR: allocate new pool of size %d\n", MP_STATE_VM(last_pool)->alloc);
     }
@@ -283,6 +370,10 @@ static qstr qstr_add(mp_uint_t len, const char *q_ptr) {
     MP_STATE_VM(last_pool)->lengths[at] = len;
     MP_STATE_VM(last_pool)->qstrs[at] = q_ptr;
     MP_STATE_VM(last_pool)->len++;
+    // CIRCUITPY-CHANGE: add it to the pool's hash index
+    #if MICROPY_OPT_QSTR_INDEX
+    *qstr_index_lookup(MP_STATE_VM(last_pool), full_hash, q_ptr, len) = at + 1;
+    #endif
 
     // return id for the newly-added qstr
     return MP_STATE_VM(last_pool)->total_prev_len + at;
@@ -294,13 +385,31 @@ qstr qstr_find_strn(const char *str, size_t str_len) {
         return MP_QSTR_;
     }
 
-    #if MICROPY_QSTR_BYTES_IN_HASH
+    // CIRCUITPY-CHANGE: dynamically allocated pools have a hash index
+    #if MICROPY_OPT_QSTR_INDEX
+    size_t full_hash = qstr_compute_hash_full((const byte *)str, str_len);
+    #endif
+
+    #if MICROPY_QSTR_BYTES_IN_HASH && MICROPY_OPT_QSTR_INDEX
+    size_t str_hash = qstr_mask_hash(full_hash);
+    #elif MICROPY_QSTR_BYTES_IN_HASH
     // work out hash of str
     size_t str_hash = qstr_compute_hash((const byte *)str, str_len);
     #endif
 
+    const qstr_pool_t *pool = MP_STATE_VM(last_pool);
+
+    #if MICROPY_OPT_QSTR_INDEX
+    for (; pool != &CONST_POOL; pool = pool->prev) {
+        qstr_index_t slot = *qstr_index_lookup(pool, full_hash, str, str_len);
+        if (slot != 0) {
+            return pool->total_prev_len + slot - 1;
+        }
+    }
+    #endif
+
     // search pools for the data
-    for (const qstr_pool_t *pool = MP_STATE_VM(last_pool); pool != NULL; pool = pool->prev) {
+    for (; pool != NULL; pool = pool->prev) {
         size_t low = 0;
         size_t high = pool->len - 1;
 
@@ -444,7 +553,8 @@ void qstr_pool_info(size_t *n_pool, size_t *n_qstr, size_t *n_str_data_bytes, si
                 #if MICROPY_QSTR_BYTES_IN_HASH
                 + sizeof(qstr_hash_t)
                 #endif
-                + sizeof(qstr_len_t)) * pool->alloc;
+                + sizeof(qstr_len_t)) * pool->alloc
+            + QSTR_INDEX_BYTES(pool->alloc); // CIRCUITPY-CHANGE
         #endif
     }
     *n_total_bytes += *n_str_data_bytes;
@@ -33,6 +33,7 @@
 #include "py/reader.h"
 
 typedef struct _mp_reader_mem_t {
+    // CIRCUITPY-CHANGE: or MP_READER_IS_ROM
     size_t free_len; // if >0 mem is freed on close by: m_free(beg, free_len)
     const byte *beg;
     const byte *cur;
@@ -50,7 +51,8 @@ static mp_uint_t mp_reader_mem_readbyte(void *data) {
 
 static void mp_reader_mem_close(void *data) {
     mp_reader_mem_t *reader = (mp_reader_mem_t *)data;
-    if (reader->free_len > 0) {
+    // CIRCUITPY-CHANGE
+    if (reader->free_len > 0 && reader->free_len != MP_READER_IS_ROM) {
         m_del(char, (char *)reader->beg, reader->free_len);
     }
     m_del_obj(mp_reader_mem_t, reader);
@@ -67,6 +69,22 @@ void mp_reader_new_mem(mp_reader_t *reader, const byte *buf, size_t len, size_t
     reader->close = mp_reader_mem_close;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PERSISTENT_CODE_LOAD_IN_PLACE
+const byte *mp_reader_try_read_rom(mp_reader_t *reader, size_t len) {
+    if (reader->readbyte != mp_reader_mem_readbyte) {
+        return NULL;
+    }
+    mp_reader_mem_t *rm = reader->data;
+    if (rm->free_len != MP_READER_IS_ROM || (size_t)(rm->end - rm->cur) < len) {
+        return NULL;
+    }
+    const byte *data = rm->cur;
+    rm->cur += len;
+    return data;
+}
+#endif
+
 #if MICROPY_READER_POSIX
 
 #include <sys/stat.h>
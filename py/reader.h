@@ -39,8 +39,22 @@ typedef struct _mp_reader_t {
     void (*close)(void *data);
 } mp_reader_t;
 
+// CIRCUITPY-CHANGE: pass as free_len when buf stays valid for the life of the VM
+#define MP_READER_IS_ROM ((size_t)-1)
+
 void mp_reader_new_mem(mp_reader_t *reader, const byte *buf, size_t len, size_t free_len);
 void mp_reader_new_file(mp_reader_t *reader, qstr filename);
 void mp_reader_new_file_from_fd(mp_reader_t *reader, int fd, bool close_fd);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PERSISTENT_CODE_LOAD_IN_PLACE
+// If the reader is reading from ROM, return a pointer to the next len bytes and
+// skip over them; otherwise return NULL.
+const byte *mp_reader_try_read_rom(mp_reader_t *reader, size_t len);
+// Open filename like mp_reader_new_file, but read from its memory-mapped
+// contents if its VFS can map it.  The reader is a ROM reader if the mapping
+// stays valid once the file is closed.
+void mp_reader_new_file_rom(mp_reader_t *reader, qstr filename);
+#endif
+
 #endif // MICROPY_INCLUDED_PY_READER_H
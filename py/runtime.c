@@ -101,6 +101,16 @@ void mp_init(void) {
 
     mp_obj_exception_initialize0(&MP_STATE_VM(mp_reload_exception), &mp_type_ReloadException);
 
+    // CIRCUITPY-CHANGE: a previous VM's exception may still own the traceback buffer
+    #if MICROPY_TRACEBACK_BUFFER_ENTRIES
+    MP_STATE_THREAD(traceback_buffer_owner) = NULL;
+    #endif
+
+    // CIRCUITPY-CHANGE: forget which const tables were checked against a perfect hash
+    #if MICROPY_OPT_MAP_PERFECT_HASH
+    memset(MP_STATE_VM(map_hash_cache), 0, sizeof(MP_STATE_VM(map_hash_cache)));
+    #endif
+
     // call port specific initialization if any
     #ifdef MICROPY_PORT_INIT_FUNC
     MICROPY_PORT_INIT_FUNC;
@@ -134,6 +144,13 @@ void mp_init(void) {
     MP_STATE_VM(track_reloc_code_list) = MP_OBJ_NULL;
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_RE && MICROPY_PY_RE_CACHE_SIZE
+    for (size_t i = 0; i < MICROPY_PY_RE_CACHE_SIZE * 2; ++i) {
+        MP_STATE_VM(re_cache[i]) = MP_OBJ_NULL;
+    }
+    #endif
+
     #if MICROPY_PY_OS_DUPTERM
     for (size_t i = 0; i < MICROPY_PY_OS_DUPTERM; ++i) {
         MP_STATE_VM(dupterm_objs[i]) = MP_OBJ_NULL;
@@ -172,8 +189,14 @@ void mp_init(void) {
     #if MICROPY_PY_SYS_SETTRACE
     MP_STATE_THREAD(prof_trace_callback) = MP_OBJ_NULL;
     MP_STATE_THREAD(prof_callback_is_executing) = false;
+    #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_SYS_SETTRACE || MICROPY_PY_MICROPYTHON_PROFILE
     MP_STATE_THREAD(current_code_state) = NULL;
     #endif
+    #if MICROPY_PY_MICROPYTHON_PROFILE
+    MP_STATE_VM(prof_samples) = NULL;
+    #endif
 
     #if MICROPY_PY_SYS_TRACEBACKLIMIT
     MP_STATE_VM(sys_mutable[MP_SYS_MUTABLE_TRACEBACKLIMIT]) = MP_OBJ_NEW_SMALL_INT(1000);
@@ -1304,6 +1327,13 @@ void mp_load_method(mp_obj_t base, qstr attr, mp_obj_t *dest) {
 
 // Acts like mp_load_method_maybe but catches AttributeError, and all other exceptions if requested
 void mp_load_method_protected(mp_obj_t obj, qstr attr, mp_obj_t *dest, bool catch_all_exc) {
+    // CIRCUITPY-CHANGE: skip the nlr_push when the lookup can't raise, which is when only the
+    // locals dict is searched and there are no properties to call.
+    const mp_obj_type_t *type = mp_obj_get_type(obj);
+    if (!MP_OBJ_TYPE_HAS_SLOT(type, attr) && (type->flags & MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS) == 0) {
+        mp_load_method_maybe(obj, attr, dest);
+        return;
+    }
     nlr_buf_t nlr;
     if (nlr_push(&nlr) == 0) {
         mp_load_method_maybe(obj, attr, dest);
@@ -1733,9 +1763,18 @@ mp_obj_t mp_parse_compile_execute(mp_lexer_t *lex, mp_parse_input_kind_t parse_i
     // set exception handler to restore context if an exception is raised
     nlr_push_jump_callback(&ctx.callback, mp_globals_locals_set_from_nlr_jump_callback);
 
-    qstr source_name = lex->source_name;
-    mp_parse_tree_t parse_tree = mp_parse(lex, parse_input_kind);
-    mp_obj_t module_fun = mp_compile(&parse_tree, source_name, parse_input_kind == MP_PARSE_SINGLE_INPUT);
+    mp_obj_t module_fun;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PARSE_STREAMING
+    if (parse_input_kind == MP_PARSE_FILE_INPUT && globals != NULL) {
+        module_fun = mp_compile_file_streaming(lex);
+    } else
+    #endif
+    {
+        qstr source_name = lex->source_name;
+        mp_parse_tree_t parse_tree = mp_parse(lex, parse_input_kind);
+        module_fun = mp_compile(&parse_tree, source_name, parse_input_kind == MP_PARSE_SINGLE_INPUT);
+    }
 
     mp_obj_t ret;
     if (MICROPY_PY_BUILTINS_COMPILE && globals == NULL) {
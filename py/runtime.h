@@ -198,6 +198,11 @@ static inline void mp_thread_init_state(mp_state_thread_t *ts, size_t stack_size
     ts->nlr_jump_callback_top = NULL;
     ts->mp_pending_exception = MP_OBJ_NULL;
 
+    // CIRCUITPY-CHANGE: no bytecode is running yet
+    #if MICROPY_PY_SYS_SETTRACE || MICROPY_PY_MICROPYTHON_PROFILE
+    ts->current_code_state = NULL;
+    #endif
+
     // If locals/globals are not given, inherit from main thread
     if (locals == NULL) {
         locals = mp_state_ctx.thread.dict_locals;
@@ -42,7 +42,8 @@
 #define MP_SCOPE_FLAG_ASYNC        (0x10)
 #define MP_SCOPE_FLAG_REFGLOBALS   (0x20) // used only if native emitter enabled
 #define MP_SCOPE_FLAG_HASCONSTS    (0x40) // used only if native emitter enabled
-#define MP_SCOPE_FLAG_VIPERRET_POS    (7) // 3 bits used for viper return type, to pass from compiler to native emitter
+// CIRCUITPY-CHANGE: 4 bits, for MP_NATIVE_TYPE_FLOAT and MP_NATIVE_TYPE_PTRF
+#define MP_SCOPE_FLAG_VIPERRET_POS    (7) // 4 bits used for viper return type, to pass from compiler to native emitter
 #define MP_SCOPE_FLAG_VIPERRELOC   (0x20) // used only when loading viper from .mpy
 #define MP_SCOPE_FLAG_VIPERRODATA  (0x40) // used only when loading viper from .mpy
 #define MP_SCOPE_FLAG_VIPERBSS     (0x80) // used only when loading viper from .mpy
@@ -60,6 +61,11 @@
 // Not use for viper, but for dynamic native modules
 #define MP_NATIVE_TYPE_QSTR (0x08)
 
+// CIRCUITPY-CHANGE: unboxed single-precision float, and pointer to such,
+// for viper when the native emitter targets a core with a VFP unit
+#define MP_NATIVE_TYPE_FLOAT (0x09)
+#define MP_NATIVE_TYPE_PTRF (0x0a)
+
 // Bytecode and runtime boundaries for unary ops
 #define MP_UNARY_OP_NUM_BYTECODE    (MP_UNARY_OP_NOT + 1)
 #define MP_UNARY_OP_NUM_RUNTIME     (MP_UNARY_OP_SIZEOF + 1)
@@ -526,6 +526,31 @@ const byte *mp_bytecode_print_str(const mp_print_t *print, const byte *ip_start,
             mp_printf(print, "IMPORT_STAR");
             break;
 
+        // CIRCUITPY-CHANGE
+        case MP_BC_LOAD_FAST_0_ATTR:
+            DECODE_QSTR;
+            mp_printf(print, "LOAD_FAST_0_ATTR %s", qstr_str(qst));
+            break;
+
+        case MP_BC_LOAD_FAST_0_METHOD:
+            DECODE_QSTR;
+            mp_printf(print, "LOAD_FAST_0_METHOD %s", qstr_str(qst));
+            break;
+
+        case MP_BC_STORE_ATTR_FAST_0:
+            DECODE_QSTR;
+            mp_printf(print, "STORE_ATTR_FAST_0 %s", qstr_str(qst));
+            break;
+
+        case MP_BC_BINARY_OP_LOCAL_SMALL_INT: {
+            DECODE_UINT;
+            mp_uint_t op = (unum >> 4) % MP_BINARY_OP_NUM_BYTECODE;
+            mp_int_t k = (mp_int_t)((unum >> 4) / MP_BINARY_OP_NUM_BYTECODE) - MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS;
+            mp_printf(print, "BINARY_OP_LOCAL_SMALL_INT " UINT_FMT " " INT_FMT " " UINT_FMT " %s",
+                unum & 0xf, k, op, qstr_str(mp_binary_op_method_name[op]));
+            break;
+        }
+
         default:
             if (ip[-1] < MP_BC_LOAD_CONST_SMALL_INT_MULTI + 64) {
                 mp_printf(print, "LOAD_CONST_SMALL_INT " INT_FMT, (mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - 16);
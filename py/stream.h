@@ -46,6 +46,8 @@
 #define MP_STREAM_SET_DATA_OPTS (9)  // Set data/message options
 #define MP_STREAM_GET_FILENO    (10) // Get fileno of underlying file
 #define MP_STREAM_GET_BUFFER_SIZE (11) // Get preferred buffer size for file
+// CIRCUITPY-CHANGE
+#define MP_STREAM_GET_DATA_PTR  (12) // Get a pointer to the file's contents
 
 // These poll ioctl values are compatible with Linux
 #define MP_STREAM_POLL_RD       (0x0001)
@@ -63,6 +65,14 @@ struct mp_stream_seek_t {
     int whence;
 };
 
+// CIRCUITPY-CHANGE
+// Argument structure for MP_STREAM_GET_DATA_PTR, which returns the length of the data
+struct mp_stream_data_ptr_t {
+    const byte *data;
+    // If false, data is only valid until the stream is closed.
+    bool persistent;
+};
+
 // seek ioctl "whence" values
 #define MP_SEEK_SET (0)
 #define MP_SEEK_CUR (1)
@@ -34,6 +34,8 @@
 #include "py/objfun.h"
 #include "py/runtime.h"
 #include "py/bc0.h"
+// CIRCUITPY-CHANGE
+#include "py/smallint.h"
 #include "py/profile.h"
 
 // *FORMAT-OFF*
@@ -119,6 +121,81 @@
 #define CLEAR_SYS_EXC_INFO()
 #endif
 
+// CIRCUITPY-CHANGE: per-call-site caches of where LOAD_GLOBAL, LOAD_ATTR and
+// LOAD_METHOD last found their name. Each bytecode function gets a small
+// direct-mapped table, keyed by the offset of the site in the bytecode. The
+// cached index is used for whatever map the site looks in next, if the
+// element there still has the same key, so instances of a class that were
+// built alike share an entry and stale entries just miss.
+#if MICROPY_OPT_VM_INLINE_CACHE
+#define VM_INLINE_CACHE_ABSENT (UINT16_MAX)
+
+typedef struct _mp_vm_inline_cache_t {
+    uint16_t site;
+    // VM_INLINE_CACHE_ABSENT if the name was not in the map last time, to go
+    // straight to the full lookup.
+    uint16_t index;
+} mp_vm_inline_cache_t;
+
+static MP_NOINLINE mp_map_elem_t *vm_cache_fill(mp_obj_fun_bc_t *fun, uint16_t offset, mp_map_t *map, qstr qst) {
+    if (fun->inline_cache == NULL) {
+        // Allocated on first use; without it everything still works.
+        fun->inline_cache = m_new_maybe(mp_vm_inline_cache_t, MICROPY_OPT_VM_INLINE_CACHE_SIZE);
+        if (fun->inline_cache != NULL) {
+            memset(fun->inline_cache, 0, MICROPY_OPT_VM_INLINE_CACHE_SIZE * sizeof(mp_vm_inline_cache_t));
+        }
+    }
+    mp_map_elem_t *elem = mp_map_lookup(map, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
+    size_t index = elem == NULL ? VM_INLINE_CACHE_ABSENT : (size_t)(elem - map->table);
+    if (fun->inline_cache != NULL && index <= VM_INLINE_CACHE_ABSENT) {
+        mp_vm_inline_cache_t *entry = &fun->inline_cache[offset % MICROPY_OPT_VM_INLINE_CACHE_SIZE];
+        entry->site = offset;
+        entry->index = index;
+    }
+    return elem;
+}
+
+// Look qst up in map for the site at the given ip. Returns NULL if it isn't
+// there, including without looking if it wasn't there last time.
+static inline mp_map_elem_t *vm_cached_lookup(mp_code_state_t *code_state, const byte *site, mp_map_t *map, qstr qst) {
+    mp_obj_fun_bc_t *fun = (mp_obj_fun_bc_t *)code_state->fun_bc;
+    uint16_t offset = site - fun->bytecode;
+    if (fun->inline_cache != NULL) {
+        mp_vm_inline_cache_t entry = fun->inline_cache[offset % MICROPY_OPT_VM_INLINE_CACHE_SIZE];
+        if (entry.site == offset) {
+            if (entry.index == VM_INLINE_CACHE_ABSENT) {
+                return NULL;
+            }
+            if (entry.index < map->alloc && map->table[entry.index].key == MP_OBJ_NEW_QSTR(qst)) {
+                return &map->table[entry.index];
+            }
+        }
+    }
+    return vm_cache_fill(fun, offset, map, qst);
+}
+
+// The map that an attribute load on obj consults first, returning the value
+// as is when the name is there. An instance's members are looked up before
+// anything else if members_first is set, as the LOAD_ATTR fast path does.
+static inline mp_map_t *vm_attr_map(mp_obj_t obj, qstr qst, bool members_first) {
+    const mp_obj_type_t *type = mp_obj_get_type(obj);
+    if (members_first && mp_obj_is_instance_type(type)) {
+        return &((mp_obj_instance_t *)MP_OBJ_TO_PTR(obj))->members;
+    }
+    // These are special-cased by mp_load_method_maybe before the type is asked.
+    if (qst == MP_QSTR___class__ || qst == MP_QSTR___next__) {
+        return NULL;
+    }
+    if (mp_obj_is_instance_type(type)) {
+        return &((mp_obj_instance_t *)MP_OBJ_TO_PTR(obj))->members;
+    }
+    if (type == &mp_type_module) {
+        return &((mp_obj_module_t *)MP_OBJ_TO_PTR(obj))->globals->map;
+    }
+    return NULL;
+}
+#endif
+
 #define PUSH_EXC_BLOCK(with_or_finally) do { \
     DECODE_ULABEL; /* except labels are always forward */ \
     ++exc_sp; \
@@ -187,6 +264,24 @@
     } \
 } while(0)
 
+// CIRCUITPY-CHANGE: the sampling profiler only needs the chain of running frames
+#elif MICROPY_PY_MICROPYTHON_PROFILE
+
+#define FRAME_SETUP() do { \
+    MP_STATE_THREAD(current_code_state) = code_state; \
+} while(0)
+
+#define FRAME_ENTER() do { \
+    code_state->prev_state = MP_STATE_THREAD(current_code_state); \
+} while(0)
+
+#define FRAME_LEAVE() do { \
+    MP_STATE_THREAD(current_code_state) = code_state->prev_state; \
+} while(0)
+
+#define FRAME_UPDATE()
+#define TRACE_TICK(current_ip, current_sp, is_exception)
+
 #else // MICROPY_PY_SYS_SETTRACE
 #define FRAME_SETUP()
 #define FRAME_ENTER()
@@ -258,11 +353,15 @@ mp_vm_return_kind_t MICROPY_WRAP_MP_EXECUTE_BYTECODE(mp_execute_bytecode)(mp_cod
     #define DISPATCH_WITH_PEND_EXC_CHECK() goto pending_exception_check
     #define ENTRY(op) entry_##op
     #define ENTRY_DEFAULT entry_default
+    // CIRCUITPY-CHANGE: an entry continuing into the one after it
+    #define ENTRY_FALLTHROUGH
 #else
     #define DISPATCH() goto dispatch_loop
     #define DISPATCH_WITH_PEND_EXC_CHECK() goto pending_exception_check
     #define ENTRY(op) case op
     #define ENTRY_DEFAULT default
+    // CIRCUITPY-CHANGE
+    #define ENTRY_FALLTHROUGH MP_FALLTHROUGH
 #endif
 
     // nlr_raise needs to be implemented as a goto, so that the C compiler's flow analyser
@@ -409,18 +508,47 @@ dispatch_loop:
 
                 ENTRY(MP_BC_LOAD_GLOBAL): {
                     MARK_EXC_IP_SELECTIVE();
+                    // CIRCUITPY-CHANGE
+                    #if MICROPY_OPT_VM_INLINE_CACHE
+                    const byte *site = ip;
+                    DECODE_QSTR;
+                    mp_map_elem_t *elem = vm_cached_lookup(code_state, site, &mp_globals_get()->map, qst);
+                    PUSH(elem != NULL ? elem->value : mp_load_global(qst));
+                    #else
                     DECODE_QSTR;
                     PUSH(mp_load_global(qst));
+                    #endif
                     DISPATCH();
                 }
 
+                // CIRCUITPY-CHANGE: LOAD_FAST 0 then LOAD_ATTR
+                #if MICROPY_BC_FUSED_OPS
+                ENTRY(MP_BC_LOAD_FAST_0_ATTR):
+                    if (fastn[0] == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    PUSH(fastn[0]);
+                    ENTRY_FALLTHROUGH
+                #endif
+
                 ENTRY(MP_BC_LOAD_ATTR): {
                     FRAME_UPDATE();
                     MARK_EXC_IP_SELECTIVE();
+                    // CIRCUITPY-CHANGE
+                    #if MICROPY_OPT_VM_INLINE_CACHE
+                    const byte *site = ip;
+                    #endif
                     DECODE_QSTR;
                     mp_obj_t top = TOP();
                     mp_obj_t obj;
-                    #if MICROPY_OPT_LOAD_ATTR_FAST_PATH
+                    // CIRCUITPY-CHANGE
+                    #if MICROPY_OPT_VM_INLINE_CACHE
+                    mp_map_t *map = vm_attr_map(top, qst, MICROPY_OPT_LOAD_ATTR_FAST_PATH);
+                    mp_map_elem_t *elem = map == NULL ? NULL : vm_cached_lookup(code_state, site, map, qst);
+                    if (elem) {
+                        obj = elem->value;
+                    } else
+                    #elif MICROPY_OPT_LOAD_ATTR_FAST_PATH
                     // For the specific case of an instance type, it implements .attr
                     // and forwards to its members map. Attribute lookups on instance
                     // types are extremely common, so avoid all the other checks and
@@ -441,10 +569,39 @@ dispatch_loop:
                     DISPATCH();
                 }
 
+                // CIRCUITPY-CHANGE: LOAD_FAST 0 then LOAD_METHOD
+                #if MICROPY_BC_FUSED_OPS
+                ENTRY(MP_BC_LOAD_FAST_0_METHOD):
+                    if (fastn[0] == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    PUSH(fastn[0]);
+                    ENTRY_FALLTHROUGH
+                #endif
+
                 ENTRY(MP_BC_LOAD_METHOD): {
                     MARK_EXC_IP_SELECTIVE();
+                    // CIRCUITPY-CHANGE: a module attribute is a plain value,
+                    // called without self.
+                    #if MICROPY_OPT_VM_INLINE_CACHE
+                    const byte *site = ip;
+                    DECODE_QSTR;
+                    // Instances are left out: their methods live in the class.
+                    mp_map_t *map = NULL;
+                    if (mp_obj_is_type(*sp, &mp_type_module) && qst != MP_QSTR___class__) {
+                        map = &((mp_obj_module_t *)MP_OBJ_TO_PTR(*sp))->globals->map;
+                    }
+                    mp_map_elem_t *elem = map == NULL ? NULL : vm_cached_lookup(code_state, site, map, qst);
+                    if (elem != NULL) {
+                        sp[0] = elem->value;
+                        sp[1] = MP_OBJ_NULL;
+                    } else {
+                        mp_load_method(*sp, qst, sp);
+                    }
+                    #else
                     DECODE_QSTR;
                     mp_load_method(*sp, qst, sp);
+                    #endif
                     sp += 1;
                     DISPATCH();
                 }
@@ -495,6 +652,16 @@ dispatch_loop:
                     DISPATCH();
                 }
 
+                // CIRCUITPY-CHANGE: LOAD_FAST 0 then STORE_ATTR
+                #if MICROPY_BC_FUSED_OPS
+                ENTRY(MP_BC_STORE_ATTR_FAST_0):
+                    if (fastn[0] == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    PUSH(fastn[0]);
+                    ENTRY_FALLTHROUGH
+                #endif
+
                 ENTRY(MP_BC_STORE_ATTR): {
                     FRAME_UPDATE();
                     MARK_EXC_IP_SELECTIVE();
@@ -510,6 +677,40 @@ dispatch_loop:
                     sp -= 3;
                     DISPATCH();
 
+                // CIRCUITPY-CHANGE: x = x <op> k, with x a local and k a
+                // small int constant; the stack isn't touched.
+                #if MICROPY_BC_FUSED_OPS
+                ENTRY(MP_BC_BINARY_OP_LOCAL_SMALL_INT): {
+                    MARK_EXC_IP_SELECTIVE();
+                    DECODE_UINT;
+                    mp_obj_t *local = &fastn[-(mp_int_t)(unum & 0xf)];
+                    unum >>= 4;
+                    mp_obj_t lhs = *local;
+                    if (lhs == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    mp_binary_op_t op = unum % MP_BINARY_OP_NUM_BYTECODE;
+                    mp_int_t k = (mp_int_t)(unum / MP_BINARY_OP_NUM_BYTECODE) - MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS;
+                    if (mp_obj_is_small_int(lhs)) {
+                        mp_int_t res;
+                        if (op == MP_BINARY_OP_ADD || op == MP_BINARY_OP_INPLACE_ADD) {
+                            res = MP_OBJ_SMALL_INT_VALUE(lhs) + k;
+                        } else if (op == MP_BINARY_OP_SUBTRACT || op == MP_BINARY_OP_INPLACE_SUBTRACT) {
+                            res = MP_OBJ_SMALL_INT_VALUE(lhs) - k;
+                        } else {
+                            goto binary_op_local_generic;
+                        }
+                        if (MP_SMALL_INT_FITS(res)) {
+                            *local = MP_OBJ_NEW_SMALL_INT(res);
+                            DISPATCH();
+                        }
+                    }
+                    binary_op_local_generic:
+                    *local = mp_binary_op(op, lhs, MP_OBJ_NEW_SMALL_INT(k));
+                    DISPATCH();
+                }
+                #endif
+
                 ENTRY(MP_BC_DELETE_FAST): {
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_UINT;
@@ -1496,6 +1697,8 @@ unwind_loop:
                 // save this exception in the stack so it can be used in a reraise, if needed
                 exc_sp->prev_exc = nlr.ret_val;
                 mp_obj_t ret_val_obj = MP_OBJ_FROM_PTR(nlr.ret_val);
+                // CIRCUITPY-CHANGE: the handler may keep the exception
+                mp_obj_exception_keep_traceback(ret_val_obj);
                 #if MICROPY_CPYTHON_EXCEPTION_CHAIN
                 if (active_exception != MP_OBJ_NULL && active_exception != ret_val_obj) {
                     mp_store_attr(ret_val_obj, MP_QSTR___context__, active_exception);
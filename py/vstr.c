@@ -116,7 +116,20 @@ static void vstr_ensure_extra(vstr_t *vstr, size_t size) {
             mp_raise_msg(&mp_type_RuntimeError, NULL);
         }
         size_t new_alloc = ROUND_ALLOC((vstr->len + size) + 16);
-        char *new_buf = m_renew(char, vstr->buf, vstr->alloc, new_alloc);
+        // CIRCUITPY-CHANGE: grow by half again when that's more, so that
+        // building up a vstr a piece at a time takes linear time, but fall
+        // back to the size needed if the heap can't fit the bigger buffer
+        char *new_buf = NULL;
+        size_t grown_alloc = ROUND_ALLOC(vstr->alloc + vstr->alloc / 2);
+        if (grown_alloc > new_alloc) {
+            new_buf = m_renew_maybe(char, vstr->buf, vstr->alloc, grown_alloc, true);
+            if (new_buf != NULL) {
+                new_alloc = grown_alloc;
+            }
+        }
+        if (new_buf == NULL) {
+            new_buf = m_renew(char, vstr->buf, vstr->alloc, new_alloc);
+        }
         vstr->alloc = new_alloc;
         vstr->buf = new_buf;
     }
@@ -12,6 +12,7 @@
 #include "shared-bindings/_bleio/__init__.h"
 #include "shared-bindings/_bleio/Address.h"
 #include "shared-bindings/_bleio/Adapter.h"
+#include "shared-bindings/_bleio/ScanResults.h"
 
 #define ADV_INTERVAL_MIN (0.02f)
 #define ADV_INTERVAL_MIN_STRING "0.02"
@@ -267,6 +268,8 @@ static MP_DEFINE_CONST_FUN_OBJ_1(bleio_adapter_stop_advertising_obj, bleio_adapt
 //|         window: float = 0.1,
 //|         minimum_rssi: int = -80,
 //|         active: bool = True,
+//|         addresses: Optional[Sequence[Address]] = None,
+//|         duplicate_window: float = 0,
 //|     ) -> Iterable[ScanEntry]:
 //|         """Starts a BLE scan and returns an iterator of results. Advertisements and scan responses are
 //|         filtered and returned separately.
@@ -283,12 +286,21 @@ static MP_DEFINE_CONST_FUN_OBJ_1(bleio_adapter_stop_advertising_obj, bleio_adapt
 //|            window must be <= interval.
 //|         :param int minimum_rssi: the minimum rssi of entries to return.
 //|         :param bool active: retrieve scan responses for scannable advertisements.
+//|         :param Sequence addresses: when given, only advertisements from these addresses are returned.
+//|         :param float duplicate_window: when non-zero, further advertisements or scan responses from
+//|            an address already returned in the last ``duplicate_window`` seconds are dropped.
+//|            Only the 16 most recently heard addresses are remembered.
+//|
+//|         The filtering is done as packets arrive, so filtered out packets take no space
+//|         in the buffer and create no objects. Use `ScanResults.readinto` to collect the
+//|         results without creating objects too.
+//|
 //|         :returns: an iterable of `_bleio.ScanEntry` objects
 //|         :rtype: iterable"""
 //|         ...
 //|
 static mp_obj_t bleio_adapter_start_scan(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_prefixes, ARG_buffer_size, ARG_extended, ARG_timeout, ARG_interval, ARG_window, ARG_minimum_rssi, ARG_active };
+    enum { ARG_prefixes, ARG_buffer_size, ARG_extended, ARG_timeout, ARG_interval, ARG_window, ARG_minimum_rssi, ARG_active, ARG_addresses, ARG_duplicate_window };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_prefixes,  MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
         { MP_QSTR_buffer_size,  MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 512} },
@@ -298,6 +310,8 @@ static mp_obj_t bleio_adapter_start_scan(size_t n_args, const mp_obj_t *pos_args
         { MP_QSTR_window,   MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
         { MP_QSTR_minimum_rssi,  MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = -80} },
         { MP_QSTR_active,  MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
+        { MP_QSTR_addresses,  MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_duplicate_window,  MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NEW_SMALL_INT(0)} },
     };
 
     bleio_adapter_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
@@ -344,7 +358,30 @@ static mp_obj_t bleio_adapter_start_scan(size_t n_args, const mp_obj_t *pos_args
         }
     }
 
-    return common_hal_bleio_adapter_start_scan(self, prefix_bufinfo.buf, prefix_bufinfo.len, args[ARG_extended].u_bool, args[ARG_buffer_size].u_int, timeout, interval, window, args[ARG_minimum_rssi].u_int, args[ARG_active].u_bool);
+    // The addresses are copied into one packed array that the scan results keep.
+    uint8_t *addresses = NULL;
+    size_t addresses_count = 0;
+    if (args[ARG_addresses].u_obj != mp_const_none) {
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_get_array(args[ARG_addresses].u_obj, &len, &items);
+        addresses = m_new(uint8_t, MAX(len, 1) * NUM_BLEIO_ADDRESS_BYTES);
+        for (size_t i = 0; i < len; i++) {
+            bleio_address_obj_t *address = mp_arg_validate_type(items[i], &bleio_address_type, MP_QSTR_addresses);
+            mp_buffer_info_t address_bufinfo;
+            mp_get_buffer_raise(common_hal_bleio_address_get_address_bytes(address), &address_bufinfo, MP_BUFFER_READ);
+            memcpy(addresses + i * NUM_BLEIO_ADDRESS_BYTES, address_bufinfo.buf, NUM_BLEIO_ADDRESS_BYTES);
+        }
+        addresses_count = len;
+    }
+
+    const mp_float_t duplicate_window = mp_arg_validate_obj_float_non_negative(args[ARG_duplicate_window].u_obj, 0, MP_QSTR_duplicate_window);
+
+    mp_obj_t scan_results = common_hal_bleio_adapter_start_scan(self, prefix_bufinfo.buf, prefix_bufinfo.len, args[ARG_extended].u_bool, args[ARG_buffer_size].u_int, timeout, interval, window, args[ARG_minimum_rssi].u_int, args[ARG_active].u_bool);
+    if (addresses != NULL || duplicate_window > 0) {
+        shared_module_bleio_scanresults_set_filter(MP_OBJ_TO_PTR(scan_results), addresses, addresses_count, (uint32_t)(duplicate_window * 1000));
+    }
+    return scan_results;
 }
 static MP_DEFINE_CONST_FUN_OBJ_KW(bleio_adapter_start_scan_obj, 1, bleio_adapter_start_scan);
 
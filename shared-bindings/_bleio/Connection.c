@@ -139,6 +139,28 @@ static mp_obj_t bleio_connection_discover_remote_services(mp_uint_t n_args, cons
 }
 static MP_DEFINE_CONST_FUN_OBJ_KW(bleio_connection_discover_remote_services_obj, 1, bleio_connection_discover_remote_services);
 
+//|     def request_high_throughput(self) -> None:
+//|         """Ask the peer for the settings that move data fastest: the 2M PHY, 251 byte link
+//|         layer packets (data length extension) and the largest ATT MTU this device supports.
+//|         `Connection.connected` must be True.
+//|
+//|         The peer may refuse any of them, and they take effect a little while later.
+//|         `max_packet_length` shows the MTU once it has been agreed. Pair this with a
+//|         `PacketBuffer` that has ``max_queued_packets`` above one so that several packets
+//|         go out in each connection event.
+//|
+//|         Does nothing on ports whose BLE stack can't be told to do this."""
+//|         ...
+//|
+static mp_obj_t bleio_connection_request_high_throughput(mp_obj_t self_in) {
+    bleio_connection_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    bleio_connection_ensure_connected(self);
+    common_hal_bleio_connection_request_high_throughput(self->connection);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(bleio_connection_request_high_throughput_obj, bleio_connection_request_high_throughput);
+
 //|     connected: bool
 //|     """True if connected to the remote peer."""
 static mp_obj_t bleio_connection_get_connected(mp_obj_t self_in) {
@@ -225,6 +247,7 @@ static const mp_rom_map_elem_t bleio_connection_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_pair),                     MP_ROM_PTR(&bleio_connection_pair_obj) },
     { MP_ROM_QSTR(MP_QSTR_disconnect),               MP_ROM_PTR(&bleio_connection_disconnect_obj) },
     { MP_ROM_QSTR(MP_QSTR_discover_remote_services), MP_ROM_PTR(&bleio_connection_discover_remote_services_obj) },
+    { MP_ROM_QSTR(MP_QSTR_request_high_throughput),  MP_ROM_PTR(&bleio_connection_request_high_throughput_obj) },
 
     // Properties
     { MP_ROM_QSTR(MP_QSTR_connected),           MP_ROM_PTR(&bleio_connection_connected_obj) },
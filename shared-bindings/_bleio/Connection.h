@@ -22,5 +22,6 @@ mp_obj_tuple_t *common_hal_bleio_connection_discover_remote_services(bleio_conne
 
 mp_float_t common_hal_bleio_connection_get_connection_interval(bleio_connection_internal_t *self);
 void common_hal_bleio_connection_set_connection_interval(bleio_connection_internal_t *self, mp_float_t new_interval);
+void common_hal_bleio_connection_request_high_throughput(bleio_connection_internal_t *self);
 
 void bleio_connection_ensure_connected(bleio_connection_obj_t *self);
@@ -22,6 +22,7 @@
 //|         *,
 //|         buffer_size: int,
 //|         max_packet_size: Optional[int] = None,
+//|         max_queued_packets: int = 1,
 //|     ) -> None:
 //|         """Accumulates a Characteristic's incoming packets in a FIFO buffer and facilitates packet aware
 //|         outgoing writes. A packet's size is either the characteristic length or the maximum transmission
@@ -37,15 +38,22 @@
 //|         :param int buffer_size: Size of ring buffer (in packets of the Characteristic's maximum
 //|           length) that stores incoming packets coming from the peer.
 //|         :param int max_packet_size: Maximum size of packets. Overrides value from the characteristic.
-//|           (Remote characteristics may not have the correct length.)"""
+//|           (Remote characteristics may not have the correct length.)
+//|         :param int max_queued_packets: How many outgoing notifications or writes without response
+//|           may be handed to the BLE stack at once. The default of one sends a single packet per
+//|           connection event and merges later writes into the next packet while it waits. More
+//|           lets several full packets go out in each connection event, which is much faster for bulk
+//|           transfers. Indications and writes with response are always sent one at a time.
+//|           Only the nRF port uses this."""
 //|         ...
 //|
 static mp_obj_t bleio_packet_buffer_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_characteristic, ARG_buffer_size, ARG_max_packet_size };
+    enum { ARG_characteristic, ARG_buffer_size, ARG_max_packet_size, ARG_max_queued_packets };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_characteristic,  MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_buffer_size, MP_ARG_KW_ONLY | MP_ARG_REQUIRED | MP_ARG_INT },
         { MP_QSTR_max_packet_size, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none}},
+        { MP_QSTR_max_queued_packets, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 1}},
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -55,6 +63,8 @@ static mp_obj_t bleio_packet_buffer_make_new(const mp_obj_type_t *type, size_t n
 
     const mp_int_t buffer_size = mp_arg_validate_int_min(args[ARG_buffer_size].u_int, 1, MP_QSTR_buffer_size);
 
+    const mp_int_t max_queued_packets = mp_arg_validate_int_range(args[ARG_max_queued_packets].u_int, 1, 255, MP_QSTR_max_queued_packets);
+
     size_t max_packet_size = common_hal_bleio_characteristic_get_max_length(characteristic);
     if (args[ARG_max_packet_size].u_obj != mp_const_none) {
         max_packet_size = mp_obj_get_int(args[ARG_max_packet_size].u_obj);
@@ -62,7 +72,7 @@ static mp_obj_t bleio_packet_buffer_make_new(const mp_obj_type_t *type, size_t n
 
     bleio_packet_buffer_obj_t *self = mp_obj_malloc(bleio_packet_buffer_obj_t, &bleio_packet_buffer_type);
 
-    common_hal_bleio_packet_buffer_construct(self, characteristic, buffer_size, max_packet_size);
+    common_hal_bleio_packet_buffer_construct(self, characteristic, buffer_size, max_packet_size, max_queued_packets);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -19,7 +19,7 @@ extern const mp_obj_type_t bleio_packet_buffer_type;
 
 void common_hal_bleio_packet_buffer_construct(
     bleio_packet_buffer_obj_t *self, bleio_characteristic_obj_t *characteristic,
-    size_t buffer_size, size_t max_packet_size);
+    size_t buffer_size, size_t max_packet_size, size_t max_queued_packets);
 // Allocation free version for BLE workflow use.
 #if CIRCUITPY_SERIAL_BLE || CIRCUITPY_BLE_FILE_SERVICE
 void _common_hal_bleio_packet_buffer_construct(
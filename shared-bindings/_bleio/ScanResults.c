@@ -40,11 +40,54 @@ static mp_obj_t scanresults_iternext(mp_obj_t self_in) {
 //|         """
 //|         ...
 //|
+//|     def readinto(self, records: WriteableBuffer, *, record_size: int = 48) -> int:
+//|         """Copies as many received results as fit into ``records`` as fixed size records,
+//|         without creating any objects. Blocks like `__next__` until there is at least one.
 //|
+//|         Each record starts with 16 bytes, which unpack with
+//|         ``struct.unpack_from("<6sBbBxHI", records, i * record_size)``: the address bytes,
+//|         address type, rssi, flags (bit 0 is set when connectable and bit 1 for a scan
+//|         response), the length of the advertising data and the time received in milliseconds
+//|         since boot, modulo 2**32. The advertising data follows, cut short if it is longer than
+//|         the rest of the record and padded with zeros if shorter.
+//|
+//|         :param WriteableBuffer records: Receives the records
+//|         :param int record_size: The size of each record. Must be at least 16.
+//|         :return: The number of records filled, or 0 when scanning is finished and no other
+//|           results are available."""
+//|         ...
+//|
+//|
+static mp_obj_t scanresults_readinto(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_records, ARG_record_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_records,  MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_record_size,  MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 48} },
+    };
+
+    bleio_scanresults_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    const mp_int_t record_size = mp_arg_validate_int_min(args[ARG_record_size].u_int, BLEIO_SCAN_RECORD_HEADER_SIZE, MP_QSTR_record_size);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_records].u_obj, &bufinfo, MP_BUFFER_WRITE);
+    mp_arg_validate_length_min(bufinfo.len, record_size, MP_QSTR_records);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_bleio_scanresults_readinto(self, bufinfo.buf, bufinfo.len, record_size));
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(scanresults_readinto_obj, 1, scanresults_readinto);
+
+static const mp_rom_map_elem_t scanresults_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&scanresults_readinto_obj) },
+};
+static MP_DEFINE_CONST_DICT(scanresults_locals_dict, scanresults_locals_dict_table);
 
 MP_DEFINE_CONST_OBJ_TYPE(
     bleio_scanresults_type,
     MP_QSTR_ScanResults,
     MP_TYPE_FLAG_ITER_IS_ITERNEXT,
-    iter, scanresults_iternext
+    iter, scanresults_iternext,
+    locals_dict, &scanresults_locals_dict
     );
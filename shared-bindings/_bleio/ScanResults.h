@@ -14,3 +14,4 @@
 extern const mp_obj_type_t bleio_scanresults_type;
 
 mp_obj_t common_hal_bleio_scanresults_next(bleio_scanresults_obj_t *self);
+size_t common_hal_bleio_scanresults_readinto(bleio_scanresults_obj_t *self, uint8_t *records, size_t records_len, size_t record_size);
@@ -46,6 +46,8 @@ static mp_obj_t layer_make_new(const mp_obj_type_t *type, size_t n_args,
     self->y = 0;
     self->frame = 0;
     self->rotation = false;
+    self->rendered = false;
+    self->dirty = true;
 
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(args[2], &bufinfo, MP_BUFFER_READ);
@@ -79,8 +81,13 @@ static mp_obj_t layer_make_new(const mp_obj_type_t *type, size_t n_args,
 //|
 static mp_obj_t layer_move(mp_obj_t self_in, mp_obj_t x_in, mp_obj_t y_in) {
     layer_obj_t *self = MP_OBJ_TO_PTR(self_in);
-    self->x = mp_obj_get_int(x_in);
-    self->y = mp_obj_get_int(y_in);
+    int16_t x = mp_obj_get_int(x_in);
+    int16_t y = mp_obj_get_int(y_in);
+    if (x != self->x || y != self->y) {
+        self->dirty = true;
+    }
+    self->x = x;
+    self->y = y;
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_3(layer_move_obj, layer_move);
@@ -94,8 +101,13 @@ static MP_DEFINE_CONST_FUN_OBJ_3(layer_move_obj, layer_move);
 static mp_obj_t layer_frame(mp_obj_t self_in, mp_obj_t frame_in,
     mp_obj_t rotation_in) {
     layer_obj_t *self = MP_OBJ_TO_PTR(self_in);
-    self->frame = mp_obj_get_int(frame_in);
-    self->rotation = mp_obj_get_int(rotation_in);
+    uint8_t frame = mp_obj_get_int(frame_in);
+    uint8_t rotation = mp_obj_get_int(rotation_in);
+    if (frame != self->frame || rotation != self->rotation) {
+        self->dirty = true;
+    }
+    self->frame = frame;
+    self->rotation = rotation;
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_3(layer_frame_obj, layer_frame);
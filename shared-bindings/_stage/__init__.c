@@ -85,12 +85,83 @@ static mp_obj_t stage_render(size_t n_args, const mp_obj_t *args) {
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(stage_render_obj, 10, 10, stage_render);
 
+//| def render_dirty(
+//|     sprites: List[Layer],
+//|     layers: List[Layer],
+//|     buffer: WriteableBuffer,
+//|     display: busdisplay.BusDisplay,
+//|     scale: int,
+//|     vx: int,
+//|     vy: int,
+//| ) -> int:
+//|     """Render and send to the display only the parts of the screen that
+//|     changed because sprites moved or changed frame since the last call.
+//|
+//|     The old and new areas of all the changed sprites are collected and
+//|     overlapping or nearby ones are merged, so each pixel is usually sent
+//|     once per frame however many sprites there are. Those areas are then
+//|     rendered as with `render`.
+//|
+//|     :param sprites: The :py:class:`~_stage.Layer` objects that can move.
+//|     :type sprites: list[Layer]
+//|     :param layers: All the :py:class:`~_stage.Layer` and :py:class:`~_stage.Text` objects to draw, as for `render`.
+//|     :type layers: list[Layer]
+//|     :param ~circuitpython_typing.WriteableBuffer buffer: A buffer to use for rendering.
+//|     :param ~busdisplay.BusDisplay display: The display to use.
+//|     :param int scale: How many times should the image be scaled up.
+//|     :param int vx: The horizontal offset of the view.
+//|     :param int vy: The vertical offset of the view.
+//|
+//|     A sprite that was never rendered by this function only has its new
+//|     area drawn, so draw the whole screen with `render` first.
+//|
+//|     :return: The number of separate areas that were sent.
+//|
+//|     This function is intended for internal use in the ``stage`` library."""
+//|
+//|
+static mp_obj_t stage_render_dirty(size_t n_args, const mp_obj_t *args) {
+    size_t sprites_size = 0;
+    mp_obj_t *sprites;
+    mp_obj_get_array(args[0], &sprites_size, &sprites);
+    for (size_t i = 0; i < sprites_size; ++i) {
+        mp_arg_validate_type(sprites[i], &mp_type_layer, MP_QSTR_sprites);
+    }
+
+    size_t layers_size = 0;
+    mp_obj_t *layers;
+    mp_obj_get_array(args[1], &layers_size, &layers);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[2], &bufinfo, MP_BUFFER_WRITE);
+    uint16_t *buffer = bufinfo.buf;
+    size_t buffer_size = bufinfo.len / 2; // 16-bit indexing
+
+    mp_obj_t native_display = mp_obj_cast_to_native_base(args[3],
+        &busdisplay_busdisplay_type);
+    if (!mp_obj_is_type(native_display, &busdisplay_busdisplay_type)) {
+        mp_raise_TypeError(MP_ERROR_TEXT("argument num/types mismatch"));
+    }
+    busdisplay_busdisplay_obj_t *display = MP_OBJ_TO_PTR(native_display);
+    uint8_t scale = mp_arg_validate_int_min(mp_obj_get_int(args[4]), 1, MP_QSTR_scale);
+    int16_t vx = mp_obj_get_int(args[5]);
+    int16_t vy = mp_obj_get_int(args[6]);
+    uint16_t background = 0;
+
+    size_t count = render_dirty(sprites, sprites_size, vx, vy, layers, layers_size,
+        buffer, buffer_size, display, scale, background);
+
+    return MP_OBJ_NEW_SMALL_INT(count);
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(stage_render_dirty_obj, 7, 7, stage_render_dirty);
+
 
 static const mp_rom_map_elem_t stage_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR__stage) },
     { MP_ROM_QSTR(MP_QSTR_Layer), MP_ROM_PTR(&mp_type_layer) },
     { MP_ROM_QSTR(MP_QSTR_Text), MP_ROM_PTR(&mp_type_text) },
     { MP_ROM_QSTR(MP_QSTR_render), MP_ROM_PTR(&stage_render_obj) },
+    { MP_ROM_QSTR(MP_QSTR_render_dirty), MP_ROM_PTR(&stage_render_dirty_obj) },
 };
 
 static MP_DEFINE_CONST_DICT(stage_module_globals, stage_module_globals_table);
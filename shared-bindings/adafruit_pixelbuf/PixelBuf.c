@@ -42,6 +42,7 @@ static void parse_byteorder(mp_obj_t byteorder_obj, pixelbuf_byteorder_details_t
 //|         auto_write: bool = False,
 //|         header: ReadableBuffer = b"",
 //|         trailer: ReadableBuffer = b"",
+//|         double_buffer: bool = False,
 //|     ) -> None:
 //|         """Create a PixelBuf object of the specified size, byteorder, and bits per pixel.
 //|
@@ -59,11 +60,16 @@ static void parse_byteorder(mp_obj_t byteorder_obj, pixelbuf_byteorder_details_t
 //|         :param bool auto_write: Whether to automatically write pixels (Default False)
 //|         :param ~circuitpython_typing.ReadableBuffer header: Sequence of bytes to always send before pixel values.
 //|         :param ~circuitpython_typing.ReadableBuffer trailer: Sequence of bytes to always send after pixel values.
+//|         :param bool double_buffer: Whether to keep a second buffer so that pixels can be changed
+//|           while `show` is still sending the previous ones in the background, such as with
+//|           ``neopixel_write.neopixel_write(pin, buf, background=True)`` in ``_transmit``. The
+//|           transmission must wait for the previous one to finish before it starts, as
+//|           `neopixel_write` does. (Default False)
 //|         """
 //|         ...
 //|
 static mp_obj_t pixelbuf_pixelbuf_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_size, ARG_byteorder, ARG_brightness, ARG_auto_write, ARG_header, ARG_trailer };
+    enum { ARG_size, ARG_byteorder, ARG_brightness, ARG_auto_write, ARG_header, ARG_trailer, ARG_double_buffer };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_size, MP_ARG_REQUIRED | MP_ARG_INT },
         { MP_QSTR_byteorder, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = MP_OBJ_NEW_QSTR(MP_QSTR_BGR) } },
@@ -71,6 +77,7 @@ static mp_obj_t pixelbuf_pixelbuf_make_new(const mp_obj_type_t *type, size_t n_a
         { MP_QSTR_auto_write, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
         { MP_QSTR_header, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = mp_const_none } },
         { MP_QSTR_trailer, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = mp_const_none } },
+        { MP_QSTR_double_buffer, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -104,7 +111,7 @@ static mp_obj_t pixelbuf_pixelbuf_make_new(const mp_obj_type_t *type, size_t n_a
     pixelbuf_pixelbuf_obj_t *self = mp_obj_malloc(pixelbuf_pixelbuf_obj_t, &pixelbuf_pixelbuf_type);
     common_hal_adafruit_pixelbuf_pixelbuf_construct(self, args[ARG_size].u_int,
         &byteorder_details, brightness, args[ARG_auto_write].u_bool, header_bufinfo.buf,
-        header_bufinfo.len, trailer_bufinfo.buf, trailer_bufinfo.len);
+        header_bufinfo.len, trailer_bufinfo.buf, trailer_bufinfo.len, args[ARG_double_buffer].u_bool);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -211,6 +218,17 @@ MP_DEFINE_CONST_FUN_OBJ_1(pixelbuf_pixelbuf_get_byteorder_str, pixelbuf_pixelbuf
 MP_PROPERTY_GETTER(pixelbuf_pixelbuf_byteorder_str,
     (mp_obj_t)&pixelbuf_pixelbuf_get_byteorder_str);
 
+//|     is_showing: bool
+//|     """True while `show` is still sending the pixels in the background. (read-only)"""
+//|
+static mp_obj_t pixelbuf_pixelbuf_obj_get_is_showing(mp_obj_t self_in) {
+    return mp_obj_new_bool(common_hal_adafruit_pixelbuf_pixelbuf_get_is_showing(self_in));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(pixelbuf_pixelbuf_get_is_showing_obj, pixelbuf_pixelbuf_obj_get_is_showing);
+
+MP_PROPERTY_GETTER(pixelbuf_pixelbuf_is_showing_obj,
+    (mp_obj_t)&pixelbuf_pixelbuf_get_is_showing_obj);
+
 static mp_obj_t pixelbuf_pixelbuf_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
     switch (op) {
         case MP_UNARY_OP_BOOL:
@@ -349,6 +367,7 @@ static const mp_rom_map_elem_t pixelbuf_pixelbuf_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_bpp), MP_ROM_PTR(&pixelbuf_pixelbuf_bpp_obj)},
     { MP_ROM_QSTR(MP_QSTR_brightness), MP_ROM_PTR(&pixelbuf_pixelbuf_brightness_obj)},
     { MP_ROM_QSTR(MP_QSTR_byteorder), MP_ROM_PTR(&pixelbuf_pixelbuf_byteorder_str)},
+    { MP_ROM_QSTR(MP_QSTR_is_showing), MP_ROM_PTR(&pixelbuf_pixelbuf_is_showing_obj)},
     { MP_ROM_QSTR(MP_QSTR_show), MP_ROM_PTR(&pixelbuf_pixelbuf_show_obj)},
     { MP_ROM_QSTR(MP_QSTR_fill), MP_ROM_PTR(&pixelbuf_pixelbuf_fill_obj)},
 };
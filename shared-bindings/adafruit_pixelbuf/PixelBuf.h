@@ -20,7 +20,7 @@ typedef union {
 
 void common_hal_adafruit_pixelbuf_pixelbuf_construct(pixelbuf_pixelbuf_obj_t *self, size_t n,
     pixelbuf_byteorder_details_t *byteorder, mp_float_t brightness, bool auto_write, uint8_t *header,
-    size_t header_len, uint8_t *trailer, size_t trailer_len);
+    size_t header_len, uint8_t *trailer, size_t trailer_len, bool double_buffer);
 
 // These take mp_obj_t because they are called on subclasses of PixelBuf.
 uint8_t common_hal_adafruit_pixelbuf_pixelbuf_get_bpp(mp_obj_t self);
@@ -32,6 +32,9 @@ size_t common_hal_adafruit_pixelbuf_pixelbuf_get_len(mp_obj_t self_in);
 mp_obj_t common_hal_adafruit_pixelbuf_pixelbuf_get_byteorder_string(mp_obj_t self);
 void common_hal_adafruit_pixelbuf_pixelbuf_fill(mp_obj_t self, mp_obj_t item);
 void common_hal_adafruit_pixelbuf_pixelbuf_show(mp_obj_t self);
+bool common_hal_adafruit_pixelbuf_pixelbuf_get_is_showing(mp_obj_t self);
+// The buffer that show() passes to _transmit.
+mp_obj_t common_hal_adafruit_pixelbuf_pixelbuf_get_transmit_buffer(mp_obj_t self);
 mp_obj_t common_hal_adafruit_pixelbuf_pixelbuf_get_pixel(mp_obj_t self, size_t index);
 void common_hal_adafruit_pixelbuf_pixelbuf_set_pixel(mp_obj_t self, size_t index, mp_obj_t item);
 void common_hal_adafruit_pixelbuf_pixelbuf_set_pixels(mp_obj_t self_in, size_t start, mp_int_t step, size_t slice_len, mp_obj_t *values, mp_obj_tuple_t *flatten_to);
@@ -9,6 +9,7 @@
 #include "py/binary.h"
 #include "py/mphal.h"
 #include "py/nlr.h"
+#include "py/objproperty.h"
 #include "py/runtime.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/analogbufio/BufferedIn.h"
@@ -109,12 +110,16 @@ static void check_for_deinit(analogbufio_bufferedin_obj_t *self) {
 //|         For 16-bit samples, if loop=False, the 12-bit ADC values are scaled up to fill the 16 bit range.
 //|         If loop=True, ADC values are stored without scaling.
 //|
+//|         With loop=True, this returns right away and sampling carries on without gaps, filling
+//|         the first half of the buffer, then the second, then the first again and so on. The
+//|         buffer must hold an even number of samples. Watch `halves_filled` to process each
+//|         half while the other one fills. Looping stops at the next `readinto` or `deinit`.
+//|
 //|         :param ~circuitpython_typing.WriteableBuffer buffer: buffer: A buffer for samples
 //|         :param ~bool loop: loop: Set to true for continuous conversions, False to fill buffer once then stop
 //|         """
 //|         ...
 //|
-//|
 static mp_obj_t analogbufio_bufferedin_obj_readinto(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_buffer, ARG_loop };
     static const mp_arg_t allowed_args[] = {
@@ -140,12 +145,46 @@ static mp_obj_t analogbufio_bufferedin_obj_readinto(size_t n_args, const mp_obj_
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(analogbufio_bufferedin_readinto_obj, 1, analogbufio_bufferedin_obj_readinto);
 
+//|     halves_filled: int
+//|     """The number of times half of the buffer has been filled since `readinto` started
+//|     looping. The half filled most recently is ``(halves_filled - 1) % 2``, where 0 is the
+//|     first half. When this goes up by more than one between looks, a half was overwritten
+//|     before it was processed. Only the RP2 ports loop. (read-only)
+//|
+//|     Processing each half as it fills, from an `asyncio` task::
+//|
+//|         samples = array.array("H", [0] * 2048)
+//|         adcbuf.readinto(samples, loop=True)
+//|         halves = memoryview(samples)[:1024], memoryview(samples)[1024:]
+//|         done = 0
+//|         while True:
+//|             while adcbuf.halves_filled == done:
+//|                 await asyncio.sleep(0)
+//|             process(halves[done % 2])
+//|             done += 1"""
+//|
+//|
+static mp_obj_t analogbufio_bufferedin_obj_get_halves_filled(mp_obj_t self_in) {
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_analogbufio_bufferedin_get_halves_filled(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(analogbufio_bufferedin_get_halves_filled_obj, analogbufio_bufferedin_obj_get_halves_filled);
+
+MP_PROPERTY_GETTER(analogbufio_bufferedin_halves_filled_obj,
+    (mp_obj_t)&analogbufio_bufferedin_get_halves_filled_obj);
+
+MP_WEAK uint32_t common_hal_analogbufio_bufferedin_get_halves_filled(analogbufio_bufferedin_obj_t *self) {
+    return 0;
+}
+
 static const mp_rom_map_elem_t analogbufio_bufferedin_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR___del__),    MP_ROM_PTR(&analogbufio_bufferedin_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR_deinit),     MP_ROM_PTR(&analogbufio_bufferedin_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__),  MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__),   MP_ROM_PTR(&default___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_readinto),   MP_ROM_PTR(&analogbufio_bufferedin_readinto_obj)},
+    { MP_ROM_QSTR(MP_QSTR_halves_filled), MP_ROM_PTR(&analogbufio_bufferedin_halves_filled_obj)},
 };
 
 static MP_DEFINE_CONST_DICT(analogbufio_bufferedin_locals_dict, analogbufio_bufferedin_locals_dict_table);
@@ -153,7 +192,7 @@ static MP_DEFINE_CONST_DICT(analogbufio_bufferedin_locals_dict, analogbufio_buff
 MP_DEFINE_CONST_OBJ_TYPE(
     analogbufio_bufferedin_type,
     MP_QSTR_BufferedIn,
-    MP_TYPE_FLAG_NONE,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
     make_new, analogbufio_bufferedin_make_new,
     locals_dict, &analogbufio_bufferedin_locals_dict
     );
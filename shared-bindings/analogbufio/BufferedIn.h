@@ -15,3 +15,5 @@ void common_hal_analogbufio_bufferedin_construct(analogbufio_bufferedin_obj_t *s
 void common_hal_analogbufio_bufferedin_deinit(analogbufio_bufferedin_obj_t *self);
 bool common_hal_analogbufio_bufferedin_deinited(analogbufio_bufferedin_obj_t *self);
 uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t *self, uint8_t *buffer, uint32_t len, uint8_t bytes_per_sample, bool loop);
+// The number of halves of the buffer filled since a looping readinto started on ports that loop.
+uint32_t common_hal_analogbufio_bufferedin_get_halves_filled(analogbufio_bufferedin_obj_t *self);
@@ -0,0 +1,259 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "py/binary.h"
+#include "py/obj.h"
+#include "py/objint.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/arrayops/__init__.h"
+
+//| """Element-wise math on arrays of numbers
+//|
+//| These work on `array.array`, `bytearray` and `memoryview` objects, including slices of
+//| memoryviews, without making a Python object for each element. The typecodes ``b``, ``B``,
+//| ``h``, ``H``, ``i``, ``I``, ``f`` and ``d`` are supported, and buffers used together must
+//| have the same typecode, other than in `convert`, and the same length.
+//|
+//| Results that don't fit an integer typecode are saturated: they are clamped to the smallest
+//| or largest value the typecode holds, rather than wrapping around. Buffers may be the same
+//| object but must not otherwise overlap.
+//|
+//| For more than this, such as FFTs and matrices, see `ulab`."""
+//|
+//|
+
+static char arrayops_get_array(mp_obj_t obj, mp_buffer_info_t *bufinfo, mp_uint_t flags, qstr arg_name) {
+    mp_get_buffer_raise(obj, bufinfo, flags);
+    if (bufinfo->typecode == BYTEARRAY_TYPECODE) {
+        bufinfo->typecode = 'B';
+    }
+    if (!common_hal_arrayops_typecode_supported(bufinfo->typecode)) {
+        mp_arg_error_invalid(arg_name);
+    }
+    size_t size = mp_binary_get_size('@', bufinfo->typecode, NULL);
+    // Loads that aren't aligned fault on some cores.
+    if ((uintptr_t)bufinfo->buf % size != 0 || bufinfo->len % size != 0) {
+        mp_arg_error_invalid(arg_name);
+    }
+    return bufinfo->typecode;
+}
+
+// Gets a second buffer that matches the first one.
+static void arrayops_get_matching_array(mp_obj_t obj, mp_buffer_info_t *bufinfo, const mp_buffer_info_t *match, qstr arg_name) {
+    if (arrayops_get_array(obj, bufinfo, MP_BUFFER_READ, arg_name) != match->typecode) {
+        mp_arg_error_invalid(arg_name);
+    }
+    size_t size = mp_binary_get_size('@', match->typecode, NULL);
+    mp_arg_validate_length(bufinfo->len / size, match->len / size, arg_name);
+}
+
+static arrayops_value_t arrayops_get_value(mp_obj_t obj, char typecode, qstr arg_name) {
+    arrayops_value_t value;
+    if (common_hal_arrayops_typecode_is_float(typecode)) {
+        value.f = mp_arg_validate_type_float(obj, arg_name);
+    } else if (mp_obj_is_small_int(obj)) {
+        value.i = MP_OBJ_SMALL_INT_VALUE(obj);
+    #if MICROPY_LONGINT_IMPL != MICROPY_LONGINT_IMPL_NONE
+    } else if (mp_obj_is_int(obj)) {
+        // Values beyond 64 bits would saturate anyway.
+        if (mp_binary_op(MP_BINARY_OP_LESS, obj, mp_obj_new_int_from_ll(INT64_MIN)) == mp_const_true) {
+            value.i = INT64_MIN;
+        } else if (mp_binary_op(MP_BINARY_OP_MORE, obj, mp_obj_new_int_from_ll(INT64_MAX)) == mp_const_true) {
+            value.i = INT64_MAX;
+        } else {
+            byte buf[sizeof(int64_t)];
+            mp_obj_int_to_bytes_impl(obj, false, sizeof(buf), buf);
+            value.i = mp_binary_get_int(sizeof(buf), true, false, buf);
+        }
+    #endif
+    } else {
+        value.i = mp_arg_validate_type_int(obj, arg_name);
+    }
+    return value;
+}
+
+static mp_obj_t arrayops_new_value(arrayops_value_t value, char typecode) {
+    if (common_hal_arrayops_typecode_is_float(typecode)) {
+        return mp_obj_new_float(value.f);
+    }
+    return mp_obj_new_int_from_ll(value.i);
+}
+
+static mp_obj_t arrayops_combine(mp_obj_t dest_in, mp_obj_t other_in, arrayops_op_t op) {
+    mp_buffer_info_t dest;
+    char typecode = arrayops_get_array(dest_in, &dest, MP_BUFFER_WRITE, MP_QSTR_dest);
+    if (mp_obj_is_int(other_in) || mp_obj_is_float(other_in)) {
+        common_hal_arrayops_combine_scalar(&dest, arrayops_get_value(other_in, typecode, MP_QSTR_other), op);
+    } else {
+        mp_buffer_info_t other;
+        arrayops_get_matching_array(other_in, &other, &dest, MP_QSTR_other);
+        common_hal_arrayops_combine(&dest, &other, op);
+    }
+    return mp_const_none;
+}
+
+//| def add(dest: WriteableBuffer, other: ReadableBuffer | int | float) -> None:
+//|     """Adds ``other`` to each element of ``dest``, in place. If ``other`` is a buffer,
+//|     each of its elements is added to the matching element of ``dest``."""
+//|     ...
+//|
+//|
+static mp_obj_t arrayops_add(mp_obj_t dest_in, mp_obj_t other_in) {
+    return arrayops_combine(dest_in, other_in, ARRAYOPS_ADD);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(arrayops_add_obj, arrayops_add);
+
+//| def mul(dest: WriteableBuffer, other: ReadableBuffer | int | float) -> None:
+//|     """Multiplies each element of ``dest`` by ``other``, in place. If ``other`` is a buffer,
+//|     each element is multiplied by the matching element of ``other``. To multiply an
+//|     integer array by a fraction, use `scale`."""
+//|     ...
+//|
+//|
+static mp_obj_t arrayops_mul(mp_obj_t dest_in, mp_obj_t other_in) {
+    return arrayops_combine(dest_in, other_in, ARRAYOPS_MUL);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(arrayops_mul_obj, arrayops_mul);
+
+//| def scale(dest: WriteableBuffer, factor: float, offset: float = 0.0) -> None:
+//|     """Sets each element of ``dest`` to ``element * factor + offset``, in place. This is
+//|     worked out in floating point, and rounded to the nearest integer for integer
+//|     typecodes."""
+//|     ...
+//|
+//|
+static mp_obj_t arrayops_scale(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_dest, ARG_factor, ARG_offset };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_dest, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_factor, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_offset, MP_ARG_OBJ, { .u_obj = MP_OBJ_NULL } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t dest;
+    arrayops_get_array(args[ARG_dest].u_obj, &dest, MP_BUFFER_WRITE, MP_QSTR_dest);
+    mp_float_t factor = mp_arg_validate_type_float(args[ARG_factor].u_obj, MP_QSTR_factor);
+    mp_float_t offset = args[ARG_offset].u_obj == MP_OBJ_NULL ? MICROPY_FLOAT_CONST(0.0) :
+        mp_arg_validate_type_float(args[ARG_offset].u_obj, MP_QSTR_offset);
+    common_hal_arrayops_scale(&dest, factor, offset);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(arrayops_scale_obj, 2, arrayops_scale);
+
+//| def clip(dest: WriteableBuffer, low: int | float, high: int | float) -> None:
+//|     """Limits each element of ``dest`` to between ``low`` and ``high``, in place."""
+//|     ...
+//|
+//|
+static mp_obj_t arrayops_clip(mp_obj_t dest_in, mp_obj_t low_in, mp_obj_t high_in) {
+    mp_buffer_info_t dest;
+    char typecode = arrayops_get_array(dest_in, &dest, MP_BUFFER_WRITE, MP_QSTR_dest);
+    common_hal_arrayops_clip(&dest, arrayops_get_value(low_in, typecode, MP_QSTR_low),
+        arrayops_get_value(high_in, typecode, MP_QSTR_high));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(arrayops_clip_obj, arrayops_clip);
+
+//| def convert(dest: WriteableBuffer, src: ReadableBuffer) -> None:
+//|     """Copies ``src`` into ``dest``, which may have a different typecode. Values are
+//|     rounded to the nearest integer for integer typecodes. ``dest`` must have as many
+//|     elements as ``src``."""
+//|     ...
+//|
+//|
+static mp_obj_t arrayops_convert(mp_obj_t dest_in, mp_obj_t src_in) {
+    mp_buffer_info_t dest;
+    mp_buffer_info_t src;
+    arrayops_get_array(dest_in, &dest, MP_BUFFER_WRITE, MP_QSTR_dest);
+    arrayops_get_array(src_in, &src, MP_BUFFER_READ, MP_QSTR_src);
+    size_t n = dest.len / mp_binary_get_size('@', dest.typecode, NULL);
+    mp_arg_validate_length(src.len / mp_binary_get_size('@', src.typecode, NULL), n, MP_QSTR_src);
+    common_hal_arrayops_convert(&dest, &src);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(arrayops_convert_obj, arrayops_convert);
+
+//| def sum(src: ReadableBuffer) -> int | float:
+//|     """Returns the sum of the elements of ``src``. For integer typecodes it is worked out in
+//|     64 bits."""
+//|     ...
+//|
+//|
+static mp_obj_t arrayops_sum(mp_obj_t src_in) {
+    mp_buffer_info_t src;
+    char typecode = arrayops_get_array(src_in, &src, MP_BUFFER_READ, MP_QSTR_src);
+    return arrayops_new_value(common_hal_arrayops_sum(&src), typecode);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(arrayops_sum_obj, arrayops_sum);
+
+//| def dot(a: ReadableBuffer, b: ReadableBuffer) -> int | float:
+//|     """Returns the sum of the products of the matching elements of ``a`` and ``b``. For
+//|     integer typecodes it is worked out in 64 bits, and saturates there."""
+//|     ...
+//|
+//|
+static mp_obj_t arrayops_dot(mp_obj_t a_in, mp_obj_t b_in) {
+    mp_buffer_info_t a;
+    mp_buffer_info_t b;
+    char typecode = arrayops_get_array(a_in, &a, MP_BUFFER_READ, MP_QSTR_a);
+    arrayops_get_matching_array(b_in, &b, &a, MP_QSTR_b);
+    return arrayops_new_value(common_hal_arrayops_dot(&a, &b), typecode);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(arrayops_dot_obj, arrayops_dot);
+
+static mp_obj_t arrayops_extreme(mp_obj_t src_in, bool maximum) {
+    mp_buffer_info_t src;
+    char typecode = arrayops_get_array(src_in, &src, MP_BUFFER_READ, MP_QSTR_src);
+    mp_arg_validate_length_min(src.len, 1, MP_QSTR_src);
+    return arrayops_new_value(common_hal_arrayops_extreme(&src, maximum), typecode);
+}
+
+//| def min(src: ReadableBuffer) -> int | float:
+//|     """Returns the smallest element of ``src``, which must not be empty."""
+//|     ...
+//|
+//|
+static mp_obj_t arrayops_min(mp_obj_t src_in) {
+    return arrayops_extreme(src_in, false);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(arrayops_min_obj, arrayops_min);
+
+//| def max(src: ReadableBuffer) -> int | float:
+//|     """Returns the largest element of ``src``, which must not be empty."""
+//|     ...
+//|
+//|
+static mp_obj_t arrayops_max(mp_obj_t src_in) {
+    return arrayops_extreme(src_in, true);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(arrayops_max_obj, arrayops_max);
+
+static const mp_rom_map_elem_t arrayops_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_arrayops) },
+    { MP_ROM_QSTR(MP_QSTR_add), MP_ROM_PTR(&arrayops_add_obj) },
+    { MP_ROM_QSTR(MP_QSTR_clip), MP_ROM_PTR(&arrayops_clip_obj) },
+    { MP_ROM_QSTR(MP_QSTR_convert), MP_ROM_PTR(&arrayops_convert_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dot), MP_ROM_PTR(&arrayops_dot_obj) },
+    { MP_ROM_QSTR(MP_QSTR_max), MP_ROM_PTR(&arrayops_max_obj) },
+    { MP_ROM_QSTR(MP_QSTR_min), MP_ROM_PTR(&arrayops_min_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mul), MP_ROM_PTR(&arrayops_mul_obj) },
+    { MP_ROM_QSTR(MP_QSTR_scale), MP_ROM_PTR(&arrayops_scale_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sum), MP_ROM_PTR(&arrayops_sum_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(arrayops_module_globals, arrayops_module_globals_table);
+
+const mp_obj_module_t arrayops_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&arrayops_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_arrayops, arrayops_module);
@@ -0,0 +1,37 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "py/obj.h"
+
+// A number in the type an array works in: i for the integer typecodes and f for 'f' and 'd'.
+typedef union {
+    int64_t i;
+    mp_float_t f;
+} arrayops_value_t;
+
+typedef enum {
+    ARRAYOPS_ADD,
+    ARRAYOPS_MUL,
+} arrayops_op_t;
+
+// Each buffer has a supported typecode, and buffers passed together have the same length.
+bool common_hal_arrayops_typecode_supported(char typecode);
+bool common_hal_arrayops_typecode_is_float(char typecode);
+
+void common_hal_arrayops_combine(mp_buffer_info_t *dest, const mp_buffer_info_t *other, arrayops_op_t op);
+void common_hal_arrayops_combine_scalar(mp_buffer_info_t *dest, arrayops_value_t value, arrayops_op_t op);
+void common_hal_arrayops_scale(mp_buffer_info_t *dest, mp_float_t factor, mp_float_t offset);
+void common_hal_arrayops_clip(mp_buffer_info_t *dest, arrayops_value_t low, arrayops_value_t high);
+void common_hal_arrayops_convert(mp_buffer_info_t *dest, const mp_buffer_info_t *src);
+arrayops_value_t common_hal_arrayops_sum(const mp_buffer_info_t *src);
+arrayops_value_t common_hal_arrayops_dot(const mp_buffer_info_t *a, const mp_buffer_info_t *b);
+// src must not be empty.
+arrayops_value_t common_hal_arrayops_extreme(const mp_buffer_info_t *src, bool maximum);
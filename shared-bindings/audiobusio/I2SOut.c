@@ -14,6 +14,13 @@
 #include "shared-bindings/audiobusio/I2SOut.h"
 #include "shared-bindings/util.h"
 
+#if CIRCUITPY_AUDIOBUSIO_I2SOUT
+// Ports that don't track underruns report none.
+MP_WEAK uint32_t common_hal_audiobusio_i2sout_get_underruns(audiobusio_i2sout_obj_t *self) {
+    return 0;
+}
+#endif
+
 //| class I2SOut:
 //|     """Output an I2S audio signal"""
 //|
@@ -235,6 +242,23 @@ MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_i2sout_get_paused_obj, audiobusio_i2sout_ob
 
 MP_PROPERTY_GETTER(audiobusio_i2sout_paused_obj,
     (mp_obj_t)&audiobusio_i2sout_get_paused_obj);
+
+//|     underruns: int
+//|     """The number of times the output played a buffer before it was refilled since the last
+//|     `play()`, which is heard as a repeated or stale block. Underruns mean the sample can't keep
+//|     up with the output; giving the sample a larger ``buffer_size``, for example on its
+//|     `audiomixer.Mixer`, adds latency but leaves more time to refill. (read-only)"""
+//|
+//|
+static mp_obj_t audiobusio_i2sout_obj_get_underruns(mp_obj_t self_in) {
+    audiobusio_i2sout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_audiobusio_i2sout_get_underruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_i2sout_get_underruns_obj, audiobusio_i2sout_obj_get_underruns);
+
+MP_PROPERTY_GETTER(audiobusio_i2sout_underruns_obj,
+    (mp_obj_t)&audiobusio_i2sout_get_underruns_obj);
 #endif // CIRCUITPY_AUDIOBUSIO_I2SOUT
 
 static const mp_rom_map_elem_t audiobusio_i2sout_locals_dict_table[] = {
@@ -252,6 +276,7 @@ static const mp_rom_map_elem_t audiobusio_i2sout_locals_dict_table[] = {
     // Properties
     { MP_ROM_QSTR(MP_QSTR_playing), MP_ROM_PTR(&audiobusio_i2sout_playing_obj) },
     { MP_ROM_QSTR(MP_QSTR_paused), MP_ROM_PTR(&audiobusio_i2sout_paused_obj) },
+    { MP_ROM_QSTR(MP_QSTR_underruns), MP_ROM_PTR(&audiobusio_i2sout_underruns_obj) },
     #endif // CIRCUITPY_AUDIOBUSIO_I2SOUT
 };
 static MP_DEFINE_CONST_DICT(audiobusio_i2sout_locals_dict, audiobusio_i2sout_locals_dict_table);
@@ -0,0 +1,137 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/audiocore/Resampler.h"
+#include "shared-bindings/audiocore/__init__.h"
+#include "shared-bindings/util.h"
+
+//| class Resampler:
+//|     """Plays another sample at a different sample rate"""
+//|
+//|     def __init__(
+//|         self,
+//|         sample: circuitpython_typing.AudioSample,
+//|         *,
+//|         sample_rate: int,
+//|         buffer_size: int = 512,
+//|     ) -> None:
+//|         """Wrap ``sample`` so that it plays at ``sample_rate``, for example to mix a 22.05kHz
+//|         `WaveFile` with a 44.1kHz `synthio.Synthesizer` in one `audiomixer.Mixer`. The output has
+//|         the same channel count, bits per sample and signedness as ``sample``.
+//|
+//|         Samples are linearly interpolated in fixed point. The conversion ratio is taken from the
+//|         current sample rates each buffer, so changing ``sample_rate`` on either object while
+//|         playing shifts the pitch.
+//|
+//|         :param ~circuitpython_typing.AudioSample sample: The sample to resample
+//|         :param int sample_rate: The sample rate to output, in Hertz
+//|         :param int buffer_size: The size in bytes of each of the two output buffers
+//|
+//|         Playing a 22.05kHz wave file in a 44.1kHz mixer::
+//|
+//|           import audiocore
+//|           import audiomixer
+//|           import audiobusio
+//|           import board
+//|
+//|           wave = audiocore.WaveFile("sound.wav")
+//|           mixer = audiomixer.Mixer(sample_rate=44100, channel_count=wave.channel_count,
+//|                                    bits_per_sample=wave.bits_per_sample)
+//|           audio = audiobusio.I2SOut(board.GP0, board.GP1, board.GP2)
+//|           audio.play(mixer)
+//|           mixer.voice[0].play(audiocore.Resampler(wave, sample_rate=44100))"""
+//|         ...
+//|
+static mp_obj_t audioio_resampler_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_sample, ARG_sample_rate, ARG_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY | MP_ARG_REQUIRED, {.u_int = 0} },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 512} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t sample = args[ARG_sample].u_obj;
+    audiosample_check(sample);
+    mp_int_t sample_rate = mp_arg_validate_int_min(args[ARG_sample_rate].u_int, 1, MP_QSTR_sample_rate);
+    mp_int_t buffer_size = mp_arg_validate_int_min(args[ARG_buffer_size].u_int, 4, MP_QSTR_buffer_size);
+
+    audioio_resampler_obj_t *self = mp_obj_malloc(audioio_resampler_obj_t, &audioio_resampler_type);
+    common_hal_audioio_resampler_construct(self, sample, sample_rate, buffer_size);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the Resampler and releases its buffers."""
+//|         ...
+//|
+static mp_obj_t audioio_resampler_deinit(mp_obj_t self_in) {
+    audioio_resampler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audioio_resampler_deinit(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(audioio_resampler_deinit_obj, audioio_resampler_deinit);
+
+//|     def __enter__(self) -> Resampler:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     sample: circuitpython_typing.AudioSample
+//|     """The sample being resampled. (read only)"""
+//|
+//|
+static mp_obj_t audioio_resampler_obj_get_sample(mp_obj_t self_in) {
+    audioio_resampler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base);
+    return common_hal_audioio_resampler_get_sample(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_resampler_get_sample_obj, audioio_resampler_obj_get_sample);
+
+MP_PROPERTY_GETTER(audioio_resampler_sample_obj,
+    (mp_obj_t)&audioio_resampler_get_sample_obj);
+
+static const mp_rom_map_elem_t audioio_resampler_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audioio_resampler_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&default___exit___obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_sample), MP_ROM_PTR(&audioio_resampler_sample_obj) },
+    AUDIOSAMPLE_FIELDS,
+};
+static MP_DEFINE_CONST_DICT(audioio_resampler_locals_dict, audioio_resampler_locals_dict_table);
+
+static const audiosample_p_t audioio_resampler_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .reset_buffer = (audiosample_reset_buffer_fun)audioio_resampler_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audioio_resampler_get_buffer,
+};
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    audioio_resampler_type,
+    MP_QSTR_Resampler,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, audioio_resampler_make_new,
+    locals_dict, &audioio_resampler_locals_dict,
+    protocol, &audioio_resampler_proto
+    );
@@ -0,0 +1,17 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/audiocore/Resampler.h"
+
+extern const mp_obj_type_t audioio_resampler_type;
+
+void common_hal_audioio_resampler_construct(audioio_resampler_obj_t *self,
+    mp_obj_t sample, uint32_t sample_rate, uint32_t buffer_size);
+
+void common_hal_audioio_resampler_deinit(audioio_resampler_obj_t *self);
+mp_obj_t common_hal_audioio_resampler_get_sample(audioio_resampler_obj_t *self);
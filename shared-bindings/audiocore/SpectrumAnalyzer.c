@@ -0,0 +1,178 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/audiocore/SpectrumAnalyzer.h"
+#include "shared-bindings/audiocore/__init__.h"
+#include "shared-bindings/util.h"
+
+//| class SpectrumAnalyzer:
+//|     """Measures the spectrum of another sample as it plays"""
+//|
+//|     def __init__(
+//|         self,
+//|         sample: circuitpython_typing.AudioSample,
+//|         *,
+//|         fft_size: int = 256,
+//|     ) -> None:
+//|         """Wrap ``sample`` so that its spectrum can be read while it plays, for level meters and
+//|         visualizers. The analyzer plays ``sample`` unchanged, so it can stand in for it anywhere:
+//|         on an output, in an `audiomixer.Mixer` voice or as the input of an effect.
+//|
+//|         Every ``fft_size`` frames of output are averaged to mono, Hann windowed and run through a
+//|         fixed point FFT in the audio background task. Nothing is allocated while playing.
+//|
+//|         :param ~circuitpython_typing.AudioSample sample: The sample to analyze
+//|         :param int fft_size: The number of frames in each block, a power of 2 from 16 to 1024.
+//|           Each block gives ``fft_size // 2`` frequency bins, ``sample_rate / fft_size`` Hertz
+//|           apart.
+//|
+//|         Showing the spectrum of a playing wave file::
+//|
+//|           import array
+//|           import audiocore
+//|           import audiobusio
+//|           import board
+//|
+//|           wave = audiocore.WaveFile("sound.wav")
+//|           analyzer = audiocore.SpectrumAnalyzer(wave, fft_size=64)
+//|           bins = array.array("H", [0] * 32)
+//|           audio = audiobusio.I2SOut(board.GP0, board.GP1, board.GP2)
+//|           audio.play(analyzer)
+//|           while audio.playing:
+//|               if analyzer.read(bins):
+//|                   print(bins[1:9])"""
+//|         ...
+//|
+static mp_obj_t audioio_spectrumanalyzer_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_sample, ARG_fft_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_fft_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 256} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t sample = args[ARG_sample].u_obj;
+    audiosample_check(sample);
+    mp_int_t fft_size = mp_arg_validate_int_range(args[ARG_fft_size].u_int, 16, 1024, MP_QSTR_fft_size);
+    if ((fft_size & (fft_size - 1)) != 0) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be power of 2"), MP_QSTR_fft_size);
+    }
+
+    audioio_spectrumanalyzer_obj_t *self = mp_obj_malloc(audioio_spectrumanalyzer_obj_t, &audioio_spectrumanalyzer_type);
+    common_hal_audioio_spectrumanalyzer_construct(self, sample, fft_size);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the SpectrumAnalyzer and releases its buffers."""
+//|         ...
+//|
+static mp_obj_t audioio_spectrumanalyzer_deinit(mp_obj_t self_in) {
+    audioio_spectrumanalyzer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audioio_spectrumanalyzer_deinit(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(audioio_spectrumanalyzer_deinit_obj, audioio_spectrumanalyzer_deinit);
+
+//|     def __enter__(self) -> SpectrumAnalyzer:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def read(self, magnitudes: WriteableBuffer) -> bool:
+//|         """Copy the magnitude of each frequency bin of the last complete block into
+//|         ``magnitudes``, an array of type ``'H'`` with at least ``fft_size // 2`` elements. Bin
+//|         ``k`` is centered on ``k * sample_rate / fft_size`` Hertz. A full scale sine wave centered
+//|         in a bin reads about 32768.
+//|
+//|         Returns True when a block has completed since the last call, and False when the
+//|         magnitudes are the same as last time."""
+//|         ...
+//|
+static mp_obj_t audioio_spectrumanalyzer_obj_read(mp_obj_t self_in, mp_obj_t magnitudes) {
+    audioio_spectrumanalyzer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(magnitudes, &bufinfo, MP_BUFFER_WRITE);
+    if (bufinfo.typecode != 'H') {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be array of type 'H'"), MP_QSTR_magnitudes);
+    }
+    mp_arg_validate_length_min(bufinfo.len / sizeof(uint16_t), common_hal_audioio_spectrumanalyzer_get_fft_size(self) / 2, MP_QSTR_magnitudes);
+    return mp_obj_new_bool(common_hal_audioio_spectrumanalyzer_read(self, bufinfo.buf));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audioio_spectrumanalyzer_read_obj, audioio_spectrumanalyzer_obj_read);
+
+//|     sample: circuitpython_typing.AudioSample
+//|     """The sample being analyzed. (read only)"""
+//|
+static mp_obj_t audioio_spectrumanalyzer_obj_get_sample(mp_obj_t self_in) {
+    audioio_spectrumanalyzer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base);
+    return common_hal_audioio_spectrumanalyzer_get_sample(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_spectrumanalyzer_get_sample_obj, audioio_spectrumanalyzer_obj_get_sample);
+
+MP_PROPERTY_GETTER(audioio_spectrumanalyzer_sample_obj,
+    (mp_obj_t)&audioio_spectrumanalyzer_get_sample_obj);
+
+//|     fft_size: int
+//|     """The number of frames in each analyzed block. (read only)"""
+//|
+//|
+static mp_obj_t audioio_spectrumanalyzer_obj_get_fft_size(mp_obj_t self_in) {
+    audioio_spectrumanalyzer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audioio_spectrumanalyzer_get_fft_size(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_spectrumanalyzer_get_fft_size_obj, audioio_spectrumanalyzer_obj_get_fft_size);
+
+MP_PROPERTY_GETTER(audioio_spectrumanalyzer_fft_size_obj,
+    (mp_obj_t)&audioio_spectrumanalyzer_get_fft_size_obj);
+
+static const mp_rom_map_elem_t audioio_spectrumanalyzer_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audioio_spectrumanalyzer_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&default___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_read), MP_ROM_PTR(&audioio_spectrumanalyzer_read_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_sample), MP_ROM_PTR(&audioio_spectrumanalyzer_sample_obj) },
+    { MP_ROM_QSTR(MP_QSTR_fft_size), MP_ROM_PTR(&audioio_spectrumanalyzer_fft_size_obj) },
+    AUDIOSAMPLE_FIELDS,
+};
+static MP_DEFINE_CONST_DICT(audioio_spectrumanalyzer_locals_dict, audioio_spectrumanalyzer_locals_dict_table);
+
+static const audiosample_p_t audioio_spectrumanalyzer_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .reset_buffer = (audiosample_reset_buffer_fun)audioio_spectrumanalyzer_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audioio_spectrumanalyzer_get_buffer,
+};
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    audioio_spectrumanalyzer_type,
+    MP_QSTR_SpectrumAnalyzer,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, audioio_spectrumanalyzer_make_new,
+    locals_dict, &audioio_spectrumanalyzer_locals_dict,
+    protocol, &audioio_spectrumanalyzer_proto
+    );
@@ -0,0 +1,19 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/audiocore/SpectrumAnalyzer.h"
+
+extern const mp_obj_type_t audioio_spectrumanalyzer_type;
+
+void common_hal_audioio_spectrumanalyzer_construct(audioio_spectrumanalyzer_obj_t *self,
+    mp_obj_t sample, uint16_t fft_size);
+
+void common_hal_audioio_spectrumanalyzer_deinit(audioio_spectrumanalyzer_obj_t *self);
+mp_obj_t common_hal_audioio_spectrumanalyzer_get_sample(audioio_spectrumanalyzer_obj_t *self);
+uint16_t common_hal_audioio_spectrumanalyzer_get_fft_size(audioio_spectrumanalyzer_obj_t *self);
+bool common_hal_audioio_spectrumanalyzer_read(audioio_spectrumanalyzer_obj_t *self, uint16_t *magnitudes);
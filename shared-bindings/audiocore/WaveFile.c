@@ -27,8 +27,14 @@
 //|         :param Union[str, typing.BinaryIO] file: The name of a wave file (preferred) or an already opened wave file
 //|         :param ~circuitpython_typing.WriteableBuffer buffer: Optional pre-allocated buffer,
 //|           that will be split in half and used for double-buffering of the data.
-//|           The buffer must be 8 to 1024 bytes long.
+//|           The buffer must be 8 to 32768 bytes long.
 //|           If not provided, two 256 byte buffers are initially allocated internally.
+//|           When each half is 512 bytes or more, reads are aligned to whole sectors (or clusters
+//|           when they fit) so slow storage such as SD cards reads several blocks at once. A
+//|           larger buffer also gives more time between reads.
+//|
+//|         The first block is read when the WaveFile is created, so opening the next file of a
+//|         playlist while the current one plays lets it start without a gap.
 //|
 //|         Playing a wave file from flash::
 //|
@@ -70,7 +76,7 @@ static mp_obj_t audioio_wavefile_make_new(const mp_obj_type_t *type, size_t n_ar
         mp_buffer_info_t bufinfo;
         mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_WRITE);
         buffer = bufinfo.buf;
-        buffer_size = mp_arg_validate_length_range(bufinfo.len, 8, 1024, MP_QSTR_buffer);
+        buffer_size = mp_arg_validate_length_range(bufinfo.len, 8, 32768, MP_QSTR_buffer);
     }
     common_hal_audioio_wavefile_construct(self, MP_OBJ_TO_PTR(arg),
         buffer, buffer_size);
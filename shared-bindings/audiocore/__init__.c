@@ -13,6 +13,8 @@
 
 #include "shared-bindings/audiocore/__init__.h"
 #include "shared-bindings/audiocore/RawSample.h"
+#include "shared-bindings/audiocore/Resampler.h"
+#include "shared-bindings/audiocore/SpectrumAnalyzer.h"
 #include "shared-bindings/audiocore/WaveFile.h"
 #include "shared-bindings/util.h"
 // #include "shared-bindings/audiomixer/Mixer.h"
@@ -82,6 +84,8 @@ static MP_DEFINE_CONST_FUN_OBJ_1(audiocore_reset_buffer_obj, audiocore_reset_buf
 static const mp_rom_map_elem_t audiocore_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_audiocore) },
     { MP_ROM_QSTR(MP_QSTR_RawSample), MP_ROM_PTR(&audioio_rawsample_type) },
+    { MP_ROM_QSTR(MP_QSTR_Resampler), MP_ROM_PTR(&audioio_resampler_type) },
+    { MP_ROM_QSTR(MP_QSTR_SpectrumAnalyzer), MP_ROM_PTR(&audioio_spectrumanalyzer_type) },
     { MP_ROM_QSTR(MP_QSTR_WaveFile), MP_ROM_PTR(&audioio_wavefile_type) },
     #if CIRCUITPY_AUDIOCORE_DEBUG
     { MP_ROM_QSTR(MP_QSTR_get_buffer), MP_ROM_PTR(&audiocore_get_buffer_obj) },
@@ -0,0 +1,207 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "shared-bindings/audiofx/Chain.h"
+#include "shared-bindings/audiocore/__init__.h"
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/objtuple.h"
+#include "py/runtime.h"
+#include "shared-bindings/util.h"
+
+//| class Chain:
+//|     """Several effects run as one"""
+//|
+//|     def __init__(
+//|         self,
+//|         effects: Sequence[
+//|             audiodelays.Echo
+//|             | audiodelays.Chorus
+//|             | audiodelays.PitchShift
+//|             | audiofilters.Filter
+//|             | audiofilters.Distortion
+//|         ],
+//|         *,
+//|         buffer_size: int = 512,
+//|     ) -> None:
+//|         """Run ``effects`` one after another on a sample, as if each played the one before it,
+//|         with a single pair of output buffers. The sample is converted to signed samples once,
+//|         every effect works on them in turn for each block, and the result is converted back
+//|         once, instead of every effect filling its own buffers and converting on the way in
+//|         and out.
+//|
+//|         The effects keep their settings, which can be changed while the chain plays, but they
+//|         must not be played on their own at the same time. They must all have the same
+//|         ``sample_rate``, ``channel_count``, ``bits_per_sample`` and ``samples_signed``, which
+//|         the chain uses too. Their ``buffer_size`` is not used.
+//|
+//|         :param Sequence effects: The effects, in the order the sample passes through them
+//|         :param int buffer_size: The total size in bytes of each of the two playback buffers to use
+//|
+//|         Playing a synth through an echo and a filter::
+//|
+//|           import board
+//|           import audiobusio
+//|           import audiodelays
+//|           import audiofilters
+//|           import audiofx
+//|           import synthio
+//|
+//|           audio = audiobusio.I2SOut(bit_clock=board.GP20, word_select=board.GP21, data=board.GP22)
+//|           synth = synthio.Synthesizer(channel_count=1, sample_rate=44100)
+//|           echo = audiodelays.Echo(delay_ms=200, decay=0.6, mix=0.5, sample_rate=44100)
+//|           low_pass = audiofilters.Filter(filter=synth.low_pass_filter(2000), sample_rate=44100)
+//|           chain = audiofx.Chain((echo, low_pass), buffer_size=1024)
+//|           chain.play(synth)
+//|           audio.play(chain)
+//|
+//|           synth.press(synthio.Note(261))"""
+//|         ...
+//|
+static mp_obj_t audiofx_chain_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_effects, ARG_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_effects, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 512} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    // convert object to tuple if it wasn't before
+    mp_obj_t effects = MP_OBJ_TYPE_GET_SLOT(&mp_type_tuple, make_new)(&mp_type_tuple, 1, 0, &args[ARG_effects].u_obj);
+    mp_int_t buffer_size = mp_arg_validate_int_min(args[ARG_buffer_size].u_int, 2, MP_QSTR_buffer_size);
+
+    audiofx_chain_obj_t *self = mp_obj_malloc(audiofx_chain_obj_t, &audiofx_chain_type);
+    common_hal_audiofx_chain_construct(self, effects, buffer_size);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the Chain. The effects are left as they are."""
+//|         ...
+//|
+static mp_obj_t audiofx_chain_deinit(mp_obj_t self_in) {
+    audiofx_chain_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audiofx_chain_deinit(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(audiofx_chain_deinit_obj, audiofx_chain_deinit);
+
+static void check_for_deinit(audiofx_chain_obj_t *self) {
+    audiosample_check_for_deinit(&self->base);
+}
+
+//|     def __enter__(self) -> Chain:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     effects: Tuple
+//|     """The effects, in the order the sample passes through them. (read-only)"""
+//|
+static mp_obj_t audiofx_chain_obj_get_effects(mp_obj_t self_in) {
+    audiofx_chain_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return common_hal_audiofx_chain_get_effects(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_chain_get_effects_obj, audiofx_chain_obj_get_effects);
+
+MP_PROPERTY_GETTER(audiofx_chain_effects_obj,
+    (mp_obj_t)&audiofx_chain_get_effects_obj);
+
+//|     playing: bool
+//|     """True when the chain is playing a sample. (read-only)"""
+//|
+static mp_obj_t audiofx_chain_obj_get_playing(mp_obj_t self_in) {
+    audiofx_chain_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_bool(common_hal_audiofx_chain_get_playing(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_chain_get_playing_obj, audiofx_chain_obj_get_playing);
+
+MP_PROPERTY_GETTER(audiofx_chain_playing_obj,
+    (mp_obj_t)&audiofx_chain_get_playing_obj);
+
+//|     def play(self, sample: circuitpython_typing.AudioSample, *, loop: bool = False) -> None:
+//|         """Plays the sample once when loop=False and continuously when loop=True.
+//|         Does not block. Use `playing` to block.
+//|
+//|         The sample must match the encoding settings of the effects."""
+//|         ...
+//|
+static mp_obj_t audiofx_chain_obj_play(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_sample, ARG_loop };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample,    MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_loop,      MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+    };
+    audiofx_chain_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t sample = args[ARG_sample].u_obj;
+    common_hal_audiofx_chain_play(self, sample, args[ARG_loop].u_bool);
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(audiofx_chain_play_obj, 1, audiofx_chain_obj_play);
+
+//|     def stop(self) -> None:
+//|         """Stops playback of the sample. The effects keep playing out what they hold, such
+//|         as the remaining echoes."""
+//|         ...
+//|
+//|
+static mp_obj_t audiofx_chain_obj_stop(mp_obj_t self_in) {
+    audiofx_chain_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    common_hal_audiofx_chain_stop(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_chain_stop_obj, audiofx_chain_obj_stop);
+
+static const mp_rom_map_elem_t audiofx_chain_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiofx_chain_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&default___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_play), MP_ROM_PTR(&audiofx_chain_play_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop), MP_ROM_PTR(&audiofx_chain_stop_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_effects), MP_ROM_PTR(&audiofx_chain_effects_obj) },
+    { MP_ROM_QSTR(MP_QSTR_playing), MP_ROM_PTR(&audiofx_chain_playing_obj) },
+    AUDIOSAMPLE_FIELDS,
+};
+static MP_DEFINE_CONST_DICT(audiofx_chain_locals_dict, audiofx_chain_locals_dict_table);
+
+static const audiosample_p_t audiofx_chain_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .reset_buffer = (audiosample_reset_buffer_fun)audiofx_chain_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audiofx_chain_get_buffer,
+};
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    audiofx_chain_type,
+    MP_QSTR_Chain,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, audiofx_chain_make_new,
+    locals_dict, &audiofx_chain_locals_dict,
+    protocol, &audiofx_chain_proto
+    );
@@ -0,0 +1,22 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/audiofx/Chain.h"
+
+extern const mp_obj_type_t audiofx_chain_type;
+
+void common_hal_audiofx_chain_construct(audiofx_chain_obj_t *self,
+    mp_obj_t effects, uint32_t buffer_size);
+
+void common_hal_audiofx_chain_deinit(audiofx_chain_obj_t *self);
+
+mp_obj_t common_hal_audiofx_chain_get_effects(audiofx_chain_obj_t *self);
+
+bool common_hal_audiofx_chain_get_playing(audiofx_chain_obj_t *self);
+void common_hal_audiofx_chain_play(audiofx_chain_obj_t *self, mp_obj_t sample, bool loop);
+void common_hal_audiofx_chain_stop(audiofx_chain_obj_t *self);
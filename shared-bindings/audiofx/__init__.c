@@ -0,0 +1,34 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/audiofx/__init__.h"
+#include "shared-bindings/audiofx/Chain.h"
+
+//| """Support for running several audio effects as one
+//|
+//| The `audiofx` module contains classes that combine the effects of `audiodelays` and
+//| `audiofilters`.
+//|
+//| """
+
+static const mp_rom_map_elem_t audiofx_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_audiofx) },
+    { MP_ROM_QSTR(MP_QSTR_Chain), MP_ROM_PTR(&audiofx_chain_type) },
+};
+
+static MP_DEFINE_CONST_DICT(audiofx_module_globals, audiofx_module_globals_table);
+
+const mp_obj_module_t audiofx_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&audiofx_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_audiofx, audiofx_module);
@@ -15,6 +15,11 @@
 #include "shared-bindings/audiocore/RawSample.h"
 #include "shared-bindings/util.h"
 
+// Ports that don't track underruns report none.
+MP_WEAK uint32_t common_hal_audioio_audioout_get_underruns(audioio_audioout_obj_t *self) {
+    return 0;
+}
+
 //| class AudioOut:
 //|     """Output an analog audio signal"""
 //|
@@ -237,6 +242,23 @@ MP_DEFINE_CONST_FUN_OBJ_1(audioio_audioout_get_paused_obj, audioio_audioout_obj_
 MP_PROPERTY_GETTER(audioio_audioout_paused_obj,
     (mp_obj_t)&audioio_audioout_get_paused_obj);
 
+//|     underruns: int
+//|     """The number of times the output played a buffer before it was refilled since the last
+//|     `play()`, which is heard as a repeated or stale block. Underruns mean the sample can't keep
+//|     up with the output; giving the sample a larger ``buffer_size``, for example on its
+//|     `audiomixer.Mixer`, adds latency but leaves more time to refill. (read-only)"""
+//|
+//|
+static mp_obj_t audioio_audioout_obj_get_underruns(mp_obj_t self_in) {
+    audioio_audioout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_audioio_audioout_get_underruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_audioout_get_underruns_obj, audioio_audioout_obj_get_underruns);
+
+MP_PROPERTY_GETTER(audioio_audioout_underruns_obj,
+    (mp_obj_t)&audioio_audioout_get_underruns_obj);
+
 static const mp_rom_map_elem_t audioio_audioout_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&audioio_audioout_deinit_obj) },
@@ -251,6 +273,7 @@ static const mp_rom_map_elem_t audioio_audioout_locals_dict_table[] = {
     // Properties
     { MP_ROM_QSTR(MP_QSTR_playing), MP_ROM_PTR(&audioio_audioout_playing_obj) },
     { MP_ROM_QSTR(MP_QSTR_paused), MP_ROM_PTR(&audioio_audioout_paused_obj) },
+    { MP_ROM_QSTR(MP_QSTR_underruns), MP_ROM_PTR(&audioio_audioout_underruns_obj) },
 };
 static MP_DEFINE_CONST_DICT(audioio_audioout_locals_dict, audioio_audioout_locals_dict_table);
 
@@ -24,3 +24,4 @@ bool common_hal_audioio_audioout_get_playing(audioio_audioout_obj_t *self);
 void common_hal_audioio_audioout_pause(audioio_audioout_obj_t *self);
 void common_hal_audioio_audioout_resume(audioio_audioout_obj_t *self);
 bool common_hal_audioio_audioout_get_paused(audioio_audioout_obj_t *self);
+uint32_t common_hal_audioio_audioout_get_underruns(audioio_audioout_obj_t *self);
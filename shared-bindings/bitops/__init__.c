@@ -4,6 +4,7 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include "py/binary.h"
 #include "py/obj.h"
 #include "py/runtime.h"
 
@@ -41,8 +42,8 @@
 static mp_obj_t bit_transpose(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_input, ARG_output, ARG_width };
     static const mp_arg_t allowed_args[] = {
-        { MP_QSTR_input, MP_ARG_OBJ | MP_ARG_REQUIRED },
-        { MP_QSTR_output, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_input, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_output, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL} },
         { MP_QSTR_width, MP_ARG_INT, { .u_int = 8 } },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -69,8 +70,68 @@ static mp_obj_t bit_transpose(size_t n_args, const mp_obj_t *pos_args, mp_map_t
 }
 static MP_DEFINE_CONST_FUN_OBJ_KW(bitops_bit_transpose_obj, 0, bit_transpose);
 
+//| def bit_planes(
+//|     input: ReadableBuffer, output: WriteableBuffer, *, plane_stride: Optional[int] = None
+//| ) -> WriteableBuffer:
+//|     """Split a buffer of integer elements into bit planes, one plane per bit of the element type.
+//|
+//|     This is the packing used by bit-plane displays such as RGB LED matrices, and by
+//|     1-bit displays. For instance, an ``array.array('H')`` of RGB565 pixels yields 16
+//|     planes, with the most significant bit of red in plane 0 and the least significant
+//|     bit of blue in plane 15.
+//|
+//|     The element size is taken from the input buffer's type: 1 for a ``bytearray``,
+//|     2 for ``array.array('H')``, 4 for ``array.array('L')``, and so on. The number of
+//|     elements must be a multiple of 8.
+//|
+//|     Plane ``p`` holds bit ``element_bits - 1 - p`` of each element, packed 8 elements per
+//|     byte with the first element in the most significant bit. Plane ``p`` starts at byte
+//|     ``p * plane_stride``. The default ``plane_stride`` is ``len(elements) // 8``, so that
+//|     the planes are contiguous and the output is the same size as the input. A larger
+//|     ``plane_stride`` leaves room between planes, e.g. for row padding or address bits.
+//|
+//|     Returns the output buffer."""
+//|     ...
+//|
+//|
+
+static mp_obj_t bit_planes(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_input, ARG_output, ARG_plane_stride };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_input, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_output, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_plane_stride, MP_ARG_OBJ | MP_ARG_KW_ONLY, { .u_obj = mp_const_none } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t input_bufinfo;
+    mp_get_buffer_raise(args[ARG_input].u_obj, &input_bufinfo, MP_BUFFER_READ);
+    size_t element_size = mp_binary_get_size('@', input_bufinfo.typecode, NULL);
+    if (input_bufinfo.len % (8 * element_size) != 0) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Buffer must be a multiple of %d bytes"), 8 * element_size);
+    }
+    size_t count = input_bufinfo.len / element_size;
+    size_t plane_len = count / 8;
+
+    size_t plane_stride = plane_len;
+    if (args[ARG_plane_stride].u_obj != mp_const_none) {
+        plane_stride = mp_arg_validate_int_min(mp_obj_get_int(args[ARG_plane_stride].u_obj), plane_len, MP_QSTR_plane_stride);
+    }
+
+    mp_buffer_info_t output_bufinfo;
+    mp_get_buffer_raise(args[ARG_output].u_obj, &output_bufinfo, MP_BUFFER_WRITE);
+    size_t planes = 8 * element_size;
+    mp_arg_validate_length_min(output_bufinfo.len, (planes - 1) * plane_stride + plane_len, MP_QSTR_output);
+
+    common_hal_bitops_bit_planes(output_bufinfo.buf, input_bufinfo.buf, count, element_size, plane_stride);
+    return args[ARG_output].u_obj;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(bitops_bit_planes_obj, 0, bit_planes);
+
 static const mp_rom_map_elem_t bitops_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_bitops) },
+    { MP_ROM_QSTR(MP_QSTR_bit_planes), MP_ROM_PTR(&bitops_bit_planes_obj) },
     { MP_ROM_QSTR(MP_QSTR_bit_transpose), MP_ROM_PTR(&bitops_bit_transpose_obj) },
 };
 
@@ -10,3 +10,4 @@
 #include <stdlib.h>
 
 void common_hal_bitops_bit_transpose(uint8_t *result, const uint8_t *src, size_t inlen, size_t num_strands);
+void common_hal_bitops_bit_planes(uint8_t *result, const uint8_t *src, size_t count, size_t element_size, size_t plane_stride);
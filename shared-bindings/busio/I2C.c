@@ -8,13 +8,16 @@
 // busio.I2C class.
 
 #include "shared-bindings/microcontroller/Pin.h"
+#include "shared-bindings/busio/__init__.h"
 #include "shared-bindings/busio/I2C.h"
 #include "shared-bindings/util.h"
 
 #include "shared/runtime/buffer_helper.h"
 #include "shared/runtime/context_manager_helpers.h"
 #include "py/binary.h"
+#include "py/objproperty.h"
 #include "py/runtime.h"
+#include "py/stream.h"
 
 //| class I2C:
 //|     """Two wire serial protocol"""
@@ -81,6 +84,10 @@ static mp_obj_t busio_i2c_make_new(const mp_obj_type_t *type, size_t n_args, siz
 //|
 static mp_obj_t busio_i2c_obj_deinit(mp_obj_t self_in) {
     busio_i2c_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (!common_hal_busio_i2c_deinited(self)) {
+        common_hal_busio_i2c_wait_for_async(self);
+    }
+    busio_async_release_buffer(self_in);
     common_hal_busio_i2c_deinit(self);
     return mp_const_none;
 }
@@ -336,7 +343,6 @@ static MP_DEFINE_CONST_FUN_OBJ_KW(busio_i2c_writeto_obj, 1, busio_i2c_writeto);
 //|         """
 //|         ...
 //|
-//|
 static mp_obj_t busio_i2c_writeto_then_readfrom(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_address, ARG_out_buffer, ARG_in_buffer, ARG_out_start, ARG_out_end, ARG_in_start, ARG_in_end };
     static const mp_arg_t allowed_args[] = {
@@ -386,6 +392,281 @@ static mp_obj_t busio_i2c_writeto_then_readfrom(size_t n_args, const mp_obj_t *p
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(busio_i2c_writeto_then_readfrom_obj, 1, busio_i2c_writeto_then_readfrom);
+
+//|     def transact(
+//|         self, transactions: Sequence[Tuple[int, ReadableBuffer, Optional[WriteableBuffer]]]
+//|     ) -> None:
+//|         """Run a list of transactions one after another in a single call. Each one is a tuple
+//|         of ``(address, out_buffer, in_buffer)``. ``out_buffer`` is written to the device
+//|         selected by ``address`` and then ``in_buffer`` is read from it after a repeated start,
+//|         as in `writeto_then_readfrom()`. When ``in_buffer`` is ``None`` or empty, only
+//|         ``out_buffer`` is written, as in `writeto()`. When ``out_buffer`` is empty, only
+//|         ``in_buffer`` is read, as in `readfrom_into()`.
+//|
+//|         This saves the cost of a call from Python for every register read when polling
+//|         several sensors. Build the list once, with slices of one buffer from `memoryview`
+//|         as ``in_buffer`` so that each reading lands in its own place, and pass the same list
+//|         every time::
+//|
+//|           data = bytearray(12)
+//|           view = memoryview(data)
+//|           reads = [
+//|               (0x6A, b"\x22", view[0:6]),  # gyroscope
+//|               (0x6A, b"\x28", view[6:12]),  # accelerometer
+//|           ]
+//|           while True:
+//|               i2c.transact(reads)
+//|
+//|         The transactions stop at the first one that fails, which raises `OSError`.
+//|
+//|         :param Sequence transactions: the transactions to run, in order
+//|         """
+//|         ...
+//|
+static mp_obj_t busio_i2c_transact(mp_obj_t self_in, mp_obj_t transactions_in) {
+    busio_i2c_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    check_lock(self);
+
+    size_t count;
+    mp_obj_t *transactions;
+    mp_obj_get_array(transactions_in, &count, &transactions);
+
+    for (size_t i = 0; i < count; i++) {
+        size_t fields_len;
+        mp_obj_t *fields;
+        mp_obj_get_array(transactions[i], &fields_len, &fields);
+        mp_arg_validate_length_range(fields_len, 2, 3, MP_QSTR_transactions);
+
+        uint16_t address = mp_obj_get_int(fields[0]);
+
+        mp_buffer_info_t out_bufinfo;
+        mp_get_buffer_raise(fields[1], &out_bufinfo, MP_BUFFER_READ);
+
+        mp_buffer_info_t in_bufinfo = { .buf = NULL, .len = 0 };
+        if (fields_len == 3 && fields[2] != mp_const_none) {
+            mp_get_buffer_raise(fields[2], &in_bufinfo, MP_BUFFER_WRITE);
+        }
+
+        uint8_t status;
+        if (in_bufinfo.len == 0) {
+            status = common_hal_busio_i2c_write(self, address, out_bufinfo.buf, out_bufinfo.len);
+        } else if (out_bufinfo.len == 0) {
+            status = common_hal_busio_i2c_read(self, address, in_bufinfo.buf, in_bufinfo.len);
+        } else {
+            status = common_hal_busio_i2c_write_read(self, address,
+                out_bufinfo.buf, out_bufinfo.len, in_bufinfo.buf, in_bufinfo.len);
+        }
+        if (status != 0) {
+            mp_raise_OSError(status);
+        }
+    }
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(busio_i2c_transact_obj, busio_i2c_transact);
+
+//|     import sys
+//|
+//|     def readfrom_into_async(
+//|         self, address: int, buffer: WriteableBuffer, *, start: int = 0, end: int = sys.maxsize
+//|     ) -> None:
+//|         """Start reading into ``buffer`` from the device selected by ``address`` and return
+//|         while it is still being read, where the hardware can do that in the background.
+//|         At least one byte must be read.
+//|
+//|         ``buffer`` holds the data once `busy` is ``False`` or `wait()` returns, and must not
+//|         be used before then. `wait()` raises the error if the device didn't respond. Any
+//|         other use of the bus first waits for the transfer to finish. On chips that can't
+//|         read in the background the transfer is done before this returns.
+//|
+//|         :param int address: 7-bit device address
+//|         :param WriteableBuffer buffer: buffer to write into
+//|         :param int start: beginning of buffer slice
+//|         :param int end: end of buffer slice; if not specified, use ``len(buffer)``"""
+//|         ...
+//|
+static mp_obj_t busio_i2c_readfrom_into_async(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_address, ARG_buffer, ARG_start, ARG_end };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_address,    MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_buffer,     MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_start,      MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_end,        MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = INT_MAX} },
+    };
+    busio_i2c_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    check_lock(self);
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_WRITE);
+
+    // Compute bounds in terms of elements, not bytes.
+    int stride_in_bytes = mp_binary_get_size('@', bufinfo.typecode, NULL);
+    size_t length = bufinfo.len / stride_in_bytes;
+    int32_t start = args[ARG_start].u_int;
+    const int32_t end = args[ARG_end].u_int;
+    normalize_buffer_bounds(&start, end, &length);
+    mp_arg_validate_length_min(length, 1, MP_QSTR_buffer);
+
+    // Treat start and length in terms of bytes from now on.
+    start *= stride_in_bytes;
+    length *= stride_in_bytes;
+
+    busio_async_hold_buffer(pos_args[0], args[ARG_buffer].u_obj);
+    uint8_t status =
+        common_hal_busio_i2c_read_async(self, args[ARG_address].u_int, ((uint8_t *)bufinfo.buf) + start, length);
+    if (status != 0) {
+        busio_async_release_buffer(pos_args[0]);
+        mp_raise_OSError(status);
+    }
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(busio_i2c_readfrom_into_async_obj, 1, busio_i2c_readfrom_into_async);
+
+//|     import sys
+//|
+//|     def writeto_async(
+//|         self, address: int, buffer: ReadableBuffer, *, start: int = 0, end: int = sys.maxsize
+//|     ) -> None:
+//|         """Start writing the bytes from ``buffer`` to the device selected by ``address``,
+//|         followed by a stop bit, and return while they are still being sent, where the
+//|         hardware can do that in the background.
+//|
+//|         ``buffer`` must not be changed until `busy` is ``False`` or `wait()` returns. The same
+//|         rules as `readfrom_into_async()` apply.
+//|
+//|         :param int address: 7-bit device address
+//|         :param ReadableBuffer buffer: buffer containing the bytes to write
+//|         :param int start: beginning of buffer slice
+//|         :param int end: end of buffer slice; if not specified, use ``len(buffer)``
+//|         """
+//|         ...
+//|
+static mp_obj_t busio_i2c_writeto_async(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_address, ARG_buffer, ARG_start, ARG_end };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_address,    MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_buffer,     MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_start,      MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_end,        MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = INT_MAX} },
+    };
+    busio_i2c_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    check_lock(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    // get the buffer to write the data from
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ);
+    int stride_in_bytes = mp_binary_get_size('@', bufinfo.typecode, NULL);
+
+    // Compute bounds in terms of elements, not bytes.
+    size_t length = bufinfo.len / stride_in_bytes;
+    int32_t start = args[ARG_start].u_int;
+    const int32_t end = args[ARG_end].u_int;
+    normalize_buffer_bounds(&start, end, &length);
+
+    // Treat start and length in terms of bytes from now on.
+    start *= stride_in_bytes;
+    length *= stride_in_bytes;
+
+    busio_async_hold_buffer(pos_args[0], args[ARG_buffer].u_obj);
+    uint8_t status =
+        common_hal_busio_i2c_write_async(self, args[ARG_address].u_int, ((uint8_t *)bufinfo.buf) + start, length);
+    if (status != 0) {
+        busio_async_release_buffer(pos_args[0]);
+        mp_raise_OSError(status);
+    }
+
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(busio_i2c_writeto_async_obj, 1, busio_i2c_writeto_async);
+
+//|     def wait(self) -> None:
+//|         """Wait for the transfer started by `writeto_async()` or `readfrom_into_async()` to
+//|         finish, and raise the error if it failed. Returns right away when there isn't one."""
+//|         ...
+//|
+static mp_obj_t busio_i2c_obj_wait(mp_obj_t self_in) {
+    busio_i2c_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    uint8_t status = common_hal_busio_i2c_wait_for_async(self);
+    busio_async_release_buffer(self_in);
+    if (status != 0) {
+        mp_raise_OSError(status);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busio_i2c_wait_obj, busio_i2c_obj_wait);
+
+//|     busy: bool
+//|     """True while a transfer started by `writeto_async()` or `readfrom_into_async()` is still
+//|     going. Call `wait()` afterwards to find out whether it worked. The bus can also be
+//|     registered with `select.poll`, which reports it ready to read and write once the
+//|     transfer is done. (read-only)"""
+//|
+//|
+static mp_obj_t busio_i2c_obj_get_busy(mp_obj_t self_in) {
+    busio_i2c_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    if (common_hal_busio_i2c_async_busy(self)) {
+        return mp_const_true;
+    }
+    busio_async_release_buffer(self_in);
+    return mp_const_false;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busio_i2c_get_busy_obj, busio_i2c_obj_get_busy);
+
+MP_PROPERTY_GETTER(busio_i2c_busy_obj,
+    (mp_obj_t)&busio_i2c_get_busy_obj);
+
+// Support ioctl(MP_STREAM_POLL, ) for asyncio
+static mp_uint_t busio_i2c_ioctl(mp_obj_t self_in, mp_uint_t request, uintptr_t arg, int *errcode) {
+    busio_i2c_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    switch (request) {
+        case MP_STREAM_POLL: {
+            mp_uint_t flags = arg;
+            if (common_hal_busio_i2c_async_busy(self)) {
+                return 0;
+            }
+            busio_async_release_buffer(self_in);
+            return flags & (MP_STREAM_POLL_RD | MP_STREAM_POLL_WR);
+        }
+        default:
+            *errcode = MP_EINVAL;
+            return MP_STREAM_ERROR;
+    }
+}
+
+static const mp_stream_p_t busio_i2c_stream_p = {
+    .ioctl = busio_i2c_ioctl,
+};
+
+// Ports that can't transfer in the background do it right away.
+MP_WEAK uint8_t common_hal_busio_i2c_write_async(busio_i2c_obj_t *self, uint16_t address,
+    const uint8_t *data, size_t len) {
+    return common_hal_busio_i2c_write(self, address, data, len);
+}
+
+MP_WEAK uint8_t common_hal_busio_i2c_read_async(busio_i2c_obj_t *self, uint16_t address,
+    uint8_t *data, size_t len) {
+    return common_hal_busio_i2c_read(self, address, data, len);
+}
+
+MP_WEAK bool common_hal_busio_i2c_async_busy(busio_i2c_obj_t *self) {
+    return false;
+}
+
+MP_WEAK uint8_t common_hal_busio_i2c_wait_for_async(busio_i2c_obj_t *self) {
+    return 0;
+}
 #endif // CIRCUITPY_BUSIO_I2C
 
 static const mp_rom_map_elem_t busio_i2c_locals_dict_table[] = {
@@ -403,6 +684,11 @@ static const mp_rom_map_elem_t busio_i2c_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_readfrom_into), MP_ROM_PTR(&busio_i2c_readfrom_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_writeto), MP_ROM_PTR(&busio_i2c_writeto_obj) },
     { MP_ROM_QSTR(MP_QSTR_writeto_then_readfrom), MP_ROM_PTR(&busio_i2c_writeto_then_readfrom_obj) },
+    { MP_ROM_QSTR(MP_QSTR_transact), MP_ROM_PTR(&busio_i2c_transact_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readfrom_into_async), MP_ROM_PTR(&busio_i2c_readfrom_into_async_obj) },
+    { MP_ROM_QSTR(MP_QSTR_writeto_async), MP_ROM_PTR(&busio_i2c_writeto_async_obj) },
+    { MP_ROM_QSTR(MP_QSTR_wait), MP_ROM_PTR(&busio_i2c_wait_obj) },
+    { MP_ROM_QSTR(MP_QSTR_busy), MP_ROM_PTR(&busio_i2c_busy_obj) },
     #endif // CIRCUITPY_BUSIO_I2C
 };
 
@@ -411,7 +697,10 @@ static MP_DEFINE_CONST_DICT(busio_i2c_locals_dict, busio_i2c_locals_dict_table);
 MP_DEFINE_CONST_OBJ_TYPE(
     busio_i2c_type,
     MP_QSTR_I2C,
-    MP_TYPE_FLAG_NONE,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
     make_new, busio_i2c_make_new,
+    #if CIRCUITPY_BUSIO_I2C
+    protocol, &busio_i2c_stream_p,
+    #endif
     locals_dict, &busio_i2c_locals_dict
     );
@@ -44,6 +44,18 @@ extern uint8_t common_hal_busio_i2c_write(busio_i2c_obj_t *self, uint16_t addres
 extern uint8_t common_hal_busio_i2c_read(busio_i2c_obj_t *self, uint16_t address,
     uint8_t *data, size_t len);
 
+// Start a write or read and may return before it is done. An error found while starting is
+// returned right away and one found later by common_hal_busio_i2c_wait_for_async(). The data
+// must stay where it is and must not be touched until common_hal_busio_i2c_async_busy() returns
+// false or common_hal_busio_i2c_wait_for_async() returns. Ports without a way to do this in the
+// background provide nothing and the transfer is done before these return.
+extern uint8_t common_hal_busio_i2c_write_async(busio_i2c_obj_t *self, uint16_t address,
+    const uint8_t *data, size_t len);
+extern uint8_t common_hal_busio_i2c_read_async(busio_i2c_obj_t *self, uint16_t address,
+    uint8_t *data, size_t len);
+extern bool common_hal_busio_i2c_async_busy(busio_i2c_obj_t *self);
+extern uint8_t common_hal_busio_i2c_wait_for_async(busio_i2c_obj_t *self);
+
 // Do a write and then a read in the same I2C transaction.
 uint8_t common_hal_busio_i2c_write_read(busio_i2c_obj_t *self, uint16_t address,
     uint8_t *out_data, size_t out_len, uint8_t *in_data, size_t in_len);
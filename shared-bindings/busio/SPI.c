@@ -10,6 +10,7 @@
 #include <string.h>
 
 #include "shared-bindings/microcontroller/Pin.h"
+#include "shared-bindings/busio/__init__.h"
 #include "shared-bindings/busio/SPI.h"
 #include "shared-bindings/util.h"
 
@@ -19,6 +20,7 @@
 #include "py/mperrno.h"
 #include "py/objproperty.h"
 #include "py/runtime.h"
+#include "py/stream.h"
 
 
 //| class SPI:
@@ -121,6 +123,10 @@ static mp_obj_t busio_spi_make_new(const mp_obj_type_t *type, size_t n_args, siz
 //|
 static mp_obj_t busio_spi_obj_deinit(mp_obj_t self_in) {
     busio_spi_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (!common_hal_busio_spi_deinited(self)) {
+        common_hal_busio_spi_wait_for_async(self);
+    }
+    busio_async_release_buffer(self_in);
     common_hal_busio_spi_deinit(self);
     return mp_const_none;
 }
@@ -444,6 +450,169 @@ static mp_obj_t busio_spi_write_readinto(size_t n_args, const mp_obj_t *pos_args
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(busio_spi_write_readinto_obj, 1, busio_spi_write_readinto);
 
+//|     import sys
+//|
+//|     def write_async(
+//|         self, buffer: ReadableBuffer, *, start: int = 0, end: int = sys.maxsize
+//|     ) -> None:
+//|         """Start writing the data contained in ``buffer`` and return while it is still being
+//|         sent, where the hardware can do that in the background. The SPI object must be locked.
+//|
+//|         ``buffer`` must not be changed until `busy` is ``False`` or `wait()` returns. Any
+//|         other use of the bus first waits for the transfer to finish. Short transfers, and
+//|         those on chips that can't send in the background, are done before this returns.
+//|
+//|         :param ReadableBuffer buffer: write out bytes from this buffer
+//|         :param int start: beginning of buffer slice
+//|         :param int end: end of buffer slice; if not specified, use ``len(buffer)``
+//|         """
+//|         ...
+//|
+
+static mp_obj_t busio_spi_write_async(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_start, ARG_end };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer,     MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_start,      MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_end,        MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = INT_MAX} },
+    };
+    busio_spi_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    check_lock(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ);
+    // Compute bounds in terms of elements, not bytes.
+    int stride_in_bytes = mp_binary_get_size('@', bufinfo.typecode, NULL);
+    int32_t start = args[ARG_start].u_int;
+    size_t length = bufinfo.len / stride_in_bytes;
+    normalize_buffer_bounds(&start, args[ARG_end].u_int, &length);
+
+    // Treat start and length in terms of bytes from now on.
+    start *= stride_in_bytes;
+    length *= stride_in_bytes;
+
+    if (length == 0) {
+        return mp_const_none;
+    }
+
+    busio_async_hold_buffer(pos_args[0], args[ARG_buffer].u_obj);
+    bool ok = common_hal_busio_spi_write_async(self, ((uint8_t *)bufinfo.buf) + start, length);
+    if (!ok) {
+        busio_async_release_buffer(pos_args[0]);
+        mp_raise_OSError(MP_EIO);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(busio_spi_write_async_obj, 1, busio_spi_write_async);
+
+//|     import sys
+//|
+//|     def readinto_async(
+//|         self,
+//|         buffer: WriteableBuffer,
+//|         *,
+//|         start: int = 0,
+//|         end: int = sys.maxsize,
+//|         write_value: int = 0,
+//|     ) -> None:
+//|         """Start reading into ``buffer`` while writing ``write_value`` for each byte read, and
+//|         return while it is still being read, where the hardware can do that in the background.
+//|         The SPI object must be locked.
+//|
+//|         ``buffer`` holds the data once `busy` is ``False`` or `wait()` returns, and must not be
+//|         used before then. The same rules as `write_async()` apply.
+//|
+//|         :param WriteableBuffer buffer: read bytes into this buffer
+//|         :param int start: beginning of buffer slice
+//|         :param int end: end of buffer slice; if not specified, use ``len(buffer)``
+//|         :param int write_value: value to write while reading
+//|         """
+//|         ...
+//|
+
+static mp_obj_t busio_spi_readinto_async(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_start, ARG_end, ARG_write_value };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer,     MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_start,      MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_end,        MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = INT_MAX} },
+        { MP_QSTR_write_value, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+    };
+    busio_spi_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    check_lock(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_WRITE);
+    // Compute bounds in terms of elements, not bytes.
+    int stride_in_bytes = mp_binary_get_size('@', bufinfo.typecode, NULL);
+    int32_t start = args[ARG_start].u_int;
+    size_t length = bufinfo.len / stride_in_bytes;
+    normalize_buffer_bounds(&start, args[ARG_end].u_int, &length);
+
+    // Treat start and length in terms of bytes from now on.
+    start *= stride_in_bytes;
+    length *= stride_in_bytes;
+
+    if (length == 0) {
+        return mp_const_none;
+    }
+
+    busio_async_hold_buffer(pos_args[0], args[ARG_buffer].u_obj);
+    bool ok = common_hal_busio_spi_read_async(self, ((uint8_t *)bufinfo.buf) + start, length, args[ARG_write_value].u_int);
+    if (!ok) {
+        busio_async_release_buffer(pos_args[0]);
+        mp_raise_OSError(MP_EIO);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(busio_spi_readinto_async_obj, 1, busio_spi_readinto_async);
+
+//|     def wait(self) -> None:
+//|         """Wait for the transfer started by `write_async()` or `readinto_async()` to finish.
+//|         Returns right away when there isn't one."""
+//|         ...
+//|
+
+static mp_obj_t busio_spi_obj_wait(mp_obj_t self_in) {
+    busio_spi_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_busio_spi_wait_for_async(self);
+    busio_async_release_buffer(self_in);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busio_spi_wait_obj, busio_spi_obj_wait);
+
+//|     busy: bool
+//|     """True while a transfer started by `write_async()` or `readinto_async()` is still going.
+//|     An `asyncio` task can wait for it to finish with::
+//|
+//|         while spi.busy:
+//|             await asyncio.sleep(0)
+//|
+//|     The bus can also be registered with `select.poll`, which reports it ready to read and
+//|     write once the transfer is done. (read-only)"""
+//|
+
+static mp_obj_t busio_spi_obj_get_busy(mp_obj_t self_in) {
+    busio_spi_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    if (common_hal_busio_spi_async_busy(self)) {
+        return mp_const_true;
+    }
+    busio_async_release_buffer(self_in);
+    return mp_const_false;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busio_spi_get_busy_obj, busio_spi_obj_get_busy);
+
+MP_PROPERTY_GETTER(busio_spi_busy_obj,
+    (mp_obj_t)&busio_spi_get_busy_obj);
+
 //|     frequency: int
 //|     """The actual SPI bus frequency. This may not match the frequency requested
 //|     due to internal limitations."""
@@ -460,6 +629,45 @@ MP_DEFINE_CONST_FUN_OBJ_1(busio_spi_get_frequency_obj, busio_spi_obj_get_frequen
 MP_PROPERTY_GETTER(busio_spi_frequency_obj,
     (mp_obj_t)&busio_spi_get_frequency_obj);
 
+// Support ioctl(MP_STREAM_POLL, ) for asyncio
+static mp_uint_t busio_spi_ioctl(mp_obj_t self_in, mp_uint_t request, uintptr_t arg, int *errcode) {
+    busio_spi_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    switch (request) {
+        case MP_STREAM_POLL: {
+            mp_uint_t flags = arg;
+            if (common_hal_busio_spi_async_busy(self)) {
+                return 0;
+            }
+            busio_async_release_buffer(self_in);
+            return flags & (MP_STREAM_POLL_RD | MP_STREAM_POLL_WR);
+        }
+        default:
+            *errcode = MP_EINVAL;
+            return MP_STREAM_ERROR;
+    }
+}
+
+static const mp_stream_p_t busio_spi_stream_p = {
+    .ioctl = busio_spi_ioctl,
+};
+
+// Ports that can't transfer in the background do it right away.
+MP_WEAK bool common_hal_busio_spi_write_async(busio_spi_obj_t *self, const uint8_t *data, size_t len) {
+    return common_hal_busio_spi_write(self, data, len);
+}
+
+MP_WEAK bool common_hal_busio_spi_read_async(busio_spi_obj_t *self, uint8_t *data, size_t len, uint8_t write_value) {
+    return common_hal_busio_spi_read(self, data, len, write_value);
+}
+
+MP_WEAK bool common_hal_busio_spi_async_busy(busio_spi_obj_t *self) {
+    return false;
+}
+
+MP_WEAK void common_hal_busio_spi_wait_for_async(busio_spi_obj_t *self) {
+}
+
 #endif // CIRCUITPY_BUSIO_SPI
 
 
@@ -476,6 +684,10 @@ static const mp_rom_map_elem_t busio_spi_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&busio_spi_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&busio_spi_write_obj) },
     { MP_ROM_QSTR(MP_QSTR_write_readinto), MP_ROM_PTR(&busio_spi_write_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto_async), MP_ROM_PTR(&busio_spi_readinto_async_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write_async), MP_ROM_PTR(&busio_spi_write_async_obj) },
+    { MP_ROM_QSTR(MP_QSTR_wait), MP_ROM_PTR(&busio_spi_wait_obj) },
+    { MP_ROM_QSTR(MP_QSTR_busy), MP_ROM_PTR(&busio_spi_busy_obj) },
     { MP_ROM_QSTR(MP_QSTR_frequency), MP_ROM_PTR(&busio_spi_frequency_obj) }
 
     #endif // CIRCUITPY_BUSIO_SPI
@@ -487,6 +699,9 @@ MP_DEFINE_CONST_OBJ_TYPE(
     MP_QSTR_SPI,
     MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
     make_new, busio_spi_make_new,
+    #if CIRCUITPY_BUSIO_SPI
+    protocol, &busio_spi_stream_p,
+    #endif
     locals_dict, &busio_spi_locals_dict
     );
 
@@ -31,6 +31,16 @@ extern void common_hal_busio_spi_unlock(busio_spi_obj_t *self);
 // Writes out the given data.
 extern bool common_hal_busio_spi_write(busio_spi_obj_t *self, const uint8_t *data, size_t len);
 
+// Start writing out or reading in the given data and may return before the transfer is done. The
+// data must stay where it is and must not be touched until common_hal_busio_spi_async_busy()
+// returns false or common_hal_busio_spi_wait_for_async() returns. Any other use of the bus waits
+// for the transfer first. Ports without a way to do this in the background provide nothing and
+// the transfer is done before these return.
+extern bool common_hal_busio_spi_write_async(busio_spi_obj_t *self, const uint8_t *data, size_t len);
+extern bool common_hal_busio_spi_read_async(busio_spi_obj_t *self, uint8_t *data, size_t len, uint8_t write_value);
+extern bool common_hal_busio_spi_async_busy(busio_spi_obj_t *self);
+extern void common_hal_busio_spi_wait_for_async(busio_spi_obj_t *self);
+
 // Reads in len bytes while outputting the byte write_value.
 extern bool common_hal_busio_spi_read(busio_spi_obj_t *self, uint8_t *data, size_t len, uint8_t write_value);
 
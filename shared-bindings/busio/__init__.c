@@ -64,6 +64,77 @@
 //| .. jinja
 //| """
 
+// Pairs of bus and buffer.
+MP_REGISTER_ROOT_POINTER(mp_obj_t busio_async_buffers[CIRCUITPY_BUSIO_ASYNC_LIMIT * 2]);
+
+static bool async_busy(mp_obj_t bus) {
+    #if CIRCUITPY_BUSIO_SPI
+    if (mp_obj_is_type(bus, &busio_spi_type)) {
+        return common_hal_busio_spi_async_busy(MP_OBJ_TO_PTR(bus));
+    }
+    #endif
+    #if CIRCUITPY_BUSIO_I2C
+    if (mp_obj_is_type(bus, &busio_i2c_type)) {
+        return common_hal_busio_i2c_async_busy(MP_OBJ_TO_PTR(bus));
+    }
+    #endif
+    return false;
+}
+
+static void async_wait(mp_obj_t bus) {
+    #if CIRCUITPY_BUSIO_SPI
+    if (mp_obj_is_type(bus, &busio_spi_type)) {
+        common_hal_busio_spi_wait_for_async(MP_OBJ_TO_PTR(bus));
+    }
+    #endif
+    #if CIRCUITPY_BUSIO_I2C
+    if (mp_obj_is_type(bus, &busio_i2c_type)) {
+        // An error is reported when the bus is next asked about it.
+        common_hal_busio_i2c_wait_for_async(MP_OBJ_TO_PTR(bus));
+    }
+    #endif
+}
+
+void busio_async_hold_buffer(mp_obj_t bus, mp_obj_t buffer) {
+    mp_obj_t *slots = MP_STATE_VM(busio_async_buffers);
+    size_t slot = CIRCUITPY_BUSIO_ASYNC_LIMIT;
+    // A bus has one transfer at a time, so its own slot is free to reuse.
+    for (size_t i = 0; i < CIRCUITPY_BUSIO_ASYNC_LIMIT; i++) {
+        if (slots[2 * i] == bus) {
+            slot = i;
+            break;
+        }
+    }
+    for (size_t i = 0; slot == CIRCUITPY_BUSIO_ASYNC_LIMIT && i < CIRCUITPY_BUSIO_ASYNC_LIMIT; i++) {
+        if (slots[2 * i] == MP_OBJ_NULL || !async_busy(slots[2 * i])) {
+            slot = i;
+        }
+    }
+    if (slot == CIRCUITPY_BUSIO_ASYNC_LIMIT) {
+        slot = 0;
+        async_wait(slots[0]);
+    }
+    slots[2 * slot] = bus;
+    slots[2 * slot + 1] = buffer;
+}
+
+void busio_async_release_buffer(mp_obj_t bus) {
+    mp_obj_t *slots = MP_STATE_VM(busio_async_buffers);
+    for (size_t i = 0; i < CIRCUITPY_BUSIO_ASYNC_LIMIT; i++) {
+        if (slots[2 * i] == bus) {
+            slots[2 * i] = MP_OBJ_NULL;
+            slots[2 * i + 1] = MP_OBJ_NULL;
+        }
+    }
+}
+
+void busio_async_reset(void) {
+    mp_obj_t *slots = MP_STATE_VM(busio_async_buffers);
+    for (size_t i = 0; i < CIRCUITPY_BUSIO_ASYNC_LIMIT * 2; i++) {
+        slots[i] = MP_OBJ_NULL;
+    }
+}
+
 static const mp_rom_map_elem_t busio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_busio) },
     { MP_ROM_QSTR(MP_QSTR_I2C),   MP_ROM_PTR(&busio_i2c_type) },
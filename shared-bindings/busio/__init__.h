@@ -5,3 +5,12 @@
 // SPDX-License-Identifier: MIT
 
 #pragma once
+
+#include "py/obj.h"
+
+// Asynchronous transfers keep their buffer here until the bus is seen to be done with it, so
+// that the buffer isn't collected out from under the hardware even when nothing else refers
+// to it or the bus lives outside the heap.
+void busio_async_hold_buffer(mp_obj_t bus, mp_obj_t buffer);
+void busio_async_release_buffer(mp_obj_t bus);
+void busio_async_reset(void);
@@ -4,6 +4,8 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <string.h>
+
 #include "shared-bindings/canio/Listener.h"
 #include "shared-bindings/canio/Message.h"
 #include "common-hal/canio/Listener.h"
@@ -11,6 +13,11 @@
 #include "py/runtime.h"
 #include "py/objproperty.h"
 
+// The record layout used by readinto().
+#define RECORD_SIZE (16)
+#define RECORD_FLAG_EXTENDED (1 << 0)
+#define RECORD_FLAG_RTR (1 << 1)
+
 //| class Listener:
 //|     """Listens for CAN message
 //|
@@ -34,16 +41,63 @@ static mp_obj_t canio_listener_receive(mp_obj_t self_in) {
     canio_listener_obj_t *self = MP_OBJ_TO_PTR(self_in);
     common_hal_canio_listener_check_for_deinit(self);
 
-    mp_obj_t message = common_hal_canio_listener_receive(self);
+    canio_message_obj_t received;
     // note: receive fills out the type field of the message
-
-    if (message) {
-        return message;
+    if (!common_hal_canio_listener_receive_into(self, &received, true)) {
+        return mp_const_none;
     }
-    return mp_const_none;
+    canio_message_obj_t *message = mp_obj_malloc(canio_message_obj_t, received.base.type);
+    *message = received;
+    return MP_OBJ_FROM_PTR(message);
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(canio_listener_receive_obj, canio_listener_receive);
 
+//|     def readinto(self, buf: WriteableBuffer) -> int:
+//|         """Reads as many messages as fit in *buf* without creating objects for them,
+//|         after waiting up to ``self.timeout`` seconds for the first one. The rest are
+//|         only the messages that have already arrived.
+//|
+//|         Each message takes 16 bytes of *buf*: the id as a little endian 32 bit number,
+//|         a flags byte, the data length, two zero bytes and then 8 bytes of data, which are
+//|         zero past the length. Bit 0 of the flags is set for an extended id and bit 1 for
+//|         a remote transmission request. In `struct` terms each record is ``"<IBBxx8s"``.
+//|
+//|         :return: the number of messages read; 0 if none arrived in time
+//|         :rtype: int"""
+//|         ...
+//|
+static mp_obj_t canio_listener_readinto(mp_obj_t self_in, mp_obj_t buf_in) {
+    canio_listener_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_canio_listener_check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_WRITE);
+    uint8_t *record = bufinfo.buf;
+    size_t count = 0;
+    canio_message_obj_t message;
+    for (; count < bufinfo.len / RECORD_SIZE; count++, record += RECORD_SIZE) {
+        if (!common_hal_canio_listener_receive_into(self, &message, count == 0)) {
+            break;
+        }
+        bool rtr = message.base.type == &canio_remote_transmission_request_type;
+        uint32_t id = message.id;
+        record[0] = id;
+        record[1] = id >> 8;
+        record[2] = id >> 16;
+        record[3] = id >> 24;
+        record[4] = (message.extended ? RECORD_FLAG_EXTENDED : 0) | (rtr ? RECORD_FLAG_RTR : 0);
+        record[5] = message.size;
+        record[6] = 0;
+        record[7] = 0;
+        memset(record + 8, 0, 8);
+        if (!rtr) {
+            memcpy(record + 8, message.data, MIN(message.size, sizeof(message.data)));
+        }
+    }
+    return MP_OBJ_NEW_SMALL_INT(count);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(canio_listener_readinto_obj, canio_listener_readinto);
+
 //|     def in_waiting(self) -> int:
 //|         """Returns the number of messages (including remote
 //|         transmission requests) waiting"""
@@ -149,6 +203,7 @@ static const mp_rom_map_elem_t canio_listener_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&canio_listener_exit_obj) },
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&canio_listener_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR_in_waiting), MP_ROM_PTR(&canio_listener_in_waiting_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&canio_listener_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_receive), MP_ROM_PTR(&canio_listener_receive_obj) },
     { MP_ROM_QSTR(MP_QSTR_timeout), MP_ROM_PTR(&canio_listener_timeout_obj) },
 };
@@ -24,7 +24,7 @@
 //|         """Create a ColorConverter object to convert color formats.
 //|
 //|         :param Colorspace colorspace: The source colorspace, one of the Colorspace constants
-//|         :param bool dither: Adds random noise to dither the output image"""
+//|         :param bool dither: Dithers the output image with an ordered (Bayer) pattern"""
 //|         ...
 //|
 
@@ -60,7 +60,7 @@ static mp_obj_t displayio_colorconverter_obj_convert(mp_obj_t self_in, mp_obj_t
 MP_DEFINE_CONST_FUN_OBJ_2(displayio_colorconverter_convert_obj, displayio_colorconverter_obj_convert);
 
 //|     dither: bool
-//|     """When `True` the ColorConverter dithers the output by adding random noise when
+//|     """When `True` the ColorConverter dithers the output with an ordered (Bayer) pattern when
 //|     truncating to display bitdepth"""
 //|
 static mp_obj_t displayio_colorconverter_obj_get_dither(mp_obj_t self_in) {
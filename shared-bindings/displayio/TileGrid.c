@@ -80,8 +80,8 @@ void displayio_tilegrid_validate_pixel_shader(mp_obj_t pixel_shader) {
 static mp_obj_t displayio_tilegrid_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
     enum { ARG_bitmap, ARG_pixel_shader, ARG_width, ARG_height, ARG_tile_width, ARG_tile_height, ARG_default_tile, ARG_x, ARG_y };
     static const mp_arg_t allowed_args[] = {
-        { MP_QSTR_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ },
-        { MP_QSTR_pixel_shader, MP_ARG_OBJ | MP_ARG_KW_ONLY | MP_ARG_REQUIRED },
+        { MP_QSTR_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_pixel_shader, MP_ARG_OBJ | MP_ARG_KW_ONLY | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL} },
         { MP_QSTR_width, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
         { MP_QSTR_height, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
         { MP_QSTR_tile_width, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
@@ -312,6 +312,32 @@ MP_PROPERTY_GETSET(displayio_tilegrid_transpose_xy_obj,
     (mp_obj_t)&displayio_tilegrid_get_transpose_xy_obj,
     (mp_obj_t)&displayio_tilegrid_set_transpose_xy_obj);
 
+#if CIRCUITPY_DISPLAYIO_TILE_CACHE
+//|     tile_cache: bool
+//|     """When true, each tile of the bitmap is kept shaded into the display's colors so that it
+//|     can be redrawn without going through the pixel shader again. This helps TileGrids that
+//|     scroll or reuse a few tiles many times. The cache takes 4 bytes per bitmap pixel plus a little
+//|     per tile. It is only used with a `Palette` or no pixel shader. Defaults to False."""
+//|
+static mp_obj_t displayio_tilegrid_obj_get_tile_cache(mp_obj_t self_in) {
+    displayio_tilegrid_t *self = native_tilegrid(self_in);
+    return mp_obj_new_bool(common_hal_displayio_tilegrid_get_tile_cache(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_tilegrid_get_tile_cache_obj, displayio_tilegrid_obj_get_tile_cache);
+
+static mp_obj_t displayio_tilegrid_obj_set_tile_cache(mp_obj_t self_in, mp_obj_t tile_cache_obj) {
+    displayio_tilegrid_t *self = native_tilegrid(self_in);
+
+    common_hal_displayio_tilegrid_set_tile_cache(self, mp_obj_is_true(tile_cache_obj));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(displayio_tilegrid_set_tile_cache_obj, displayio_tilegrid_obj_set_tile_cache);
+
+MP_PROPERTY_GETSET(displayio_tilegrid_tile_cache_obj,
+    (mp_obj_t)&displayio_tilegrid_get_tile_cache_obj,
+    (mp_obj_t)&displayio_tilegrid_set_tile_cache_obj);
+#endif
+
 //|     def contains(self, touch_tuple: tuple) -> bool:
 //|         """Returns True if the first two values in ``touch_tuple`` represent an x,y coordinate
 //|         inside the tilegrid rectangle bounds."""
@@ -474,6 +500,9 @@ static const mp_rom_map_elem_t displayio_tilegrid_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_flip_x), MP_ROM_PTR(&displayio_tilegrid_flip_x_obj) },
     { MP_ROM_QSTR(MP_QSTR_flip_y), MP_ROM_PTR(&displayio_tilegrid_flip_y_obj) },
     { MP_ROM_QSTR(MP_QSTR_transpose_xy), MP_ROM_PTR(&displayio_tilegrid_transpose_xy_obj) },
+    #if CIRCUITPY_DISPLAYIO_TILE_CACHE
+    { MP_ROM_QSTR(MP_QSTR_tile_cache), MP_ROM_PTR(&displayio_tilegrid_tile_cache_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_contains), MP_ROM_PTR(&displayio_tilegrid_contains_obj) },
     { MP_ROM_QSTR(MP_QSTR_pixel_shader), MP_ROM_PTR(&displayio_tilegrid_pixel_shader_obj) },
     { MP_ROM_QSTR(MP_QSTR_bitmap), MP_ROM_PTR(&displayio_tilegrid_bitmap_obj) },
@@ -43,8 +43,15 @@ uint16_t common_hal_displayio_tilegrid_get_height(displayio_tilegrid_t *self);
 uint16_t common_hal_displayio_tilegrid_get_tile_width(displayio_tilegrid_t *self);
 uint16_t common_hal_displayio_tilegrid_get_tile_height(displayio_tilegrid_t *self);
 
+#if CIRCUITPY_DISPLAYIO_TILE_CACHE
+bool common_hal_displayio_tilegrid_get_tile_cache(displayio_tilegrid_t *self);
+void common_hal_displayio_tilegrid_set_tile_cache(displayio_tilegrid_t *self, bool tile_cache);
+#endif
+
 uint16_t common_hal_displayio_tilegrid_get_tile(displayio_tilegrid_t *self, uint16_t x, uint16_t y);
 void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint16_t tile_index);
+// Sets count tiles starting at x, y and moving right along the row.
+void common_hal_displayio_tilegrid_set_tiles(displayio_tilegrid_t *self, uint16_t x, uint16_t y, const uint16_t *tile_indices, uint16_t count);
 
 // Private API for scrolling the TileGrid.
 void common_hal_displayio_tilegrid_set_top_left(displayio_tilegrid_t *self, uint16_t x, uint16_t y);
@@ -43,6 +43,23 @@
 //|
 //|     dualbank.flash(buffer, offset)
 //|     dualbank.switch()
+//|
+//| An image can be written as it arrives from the network, and checked without reading it
+//| back, because it is hashed as it is written:
+//|
+//| .. code-block:: python
+//|
+//|     import dualbank
+//|
+//|     buffer = bytearray(4096)
+//|     while True:
+//|         n = sock.recv_into(buffer)
+//|         if n == 0:
+//|             break
+//|         dualbank.flash(memoryview(buffer)[:n])
+//|     if dualbank.sha256() != expected_sha256:
+//|         raise RuntimeError("bad image")
+//|     dualbank.switch()
 //| """
 //|
 //| ...
@@ -60,7 +77,9 @@ static void raise_error_if_storage_extended(void) {
 //| def flash(buffer: ReadableBuffer, offset: int = 0) -> None:
 //|     """Writes one of the two app partitions at the given offset.
 //|
-//|     This can be called multiple times when flashing the firmware in smaller chunks.
+//|     This can be called multiple times when flashing the firmware in smaller chunks. The first
+//|     chunk must be at least as long as the image header. Each chunk written without an
+//|     offset follows the one before.
 //|
 //|     :param ReadableBuffer buffer: The entire firmware or a partial chunk.
 //|     :param int offset: Start writing at this offset in the app partition.
@@ -94,6 +113,23 @@ static mp_obj_t dualbank_flash(size_t n_args, const mp_obj_t *pos_args, mp_map_t
 }
 static MP_DEFINE_CONST_FUN_OBJ_KW(dualbank_flash_obj, 0, dualbank_flash);
 
+//| def sha256() -> Optional[bytes]:
+//|     """Returns the SHA-256 digest of the image written so far, to check it before `switch()`.
+//|
+//|     Returns ``None`` when nothing has been written or when chunks were written out of order.
+//|     """
+//|     ...
+//|
+//|
+static mp_obj_t dualbank_sha256(void) {
+    uint8_t digest[32];
+    if (!common_hal_dualbank_get_sha256(digest)) {
+        return mp_const_none;
+    }
+    return mp_obj_new_bytes(digest, sizeof(digest));
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(dualbank_sha256_obj, dualbank_sha256);
+
 //| def switch() -> None:
 //|     """Switches to the next-update partition.
 //|
@@ -116,6 +152,7 @@ static const mp_rom_map_elem_t dualbank_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_dualbank) },
     // module functions
     { MP_ROM_QSTR(MP_QSTR_flash), MP_ROM_PTR(&dualbank_flash_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sha256), MP_ROM_PTR(&dualbank_sha256_obj) },
     { MP_ROM_QSTR(MP_QSTR_switch), MP_ROM_PTR(&dualbank_switch_obj) },
 };
 static MP_DEFINE_CONST_DICT(dualbank_module_globals, dualbank_module_globals_table);
@@ -10,3 +10,5 @@
 
 extern void common_hal_dualbank_switch(void);
 extern void common_hal_dualbank_flash(const void *buf, const size_t len, const size_t offset);
+// Returns false when the image hasn't been written in order since it was started.
+extern bool common_hal_dualbank_get_sha256(uint8_t digest[32]);
@@ -65,6 +65,9 @@
 //|         two_byte_sequence_length: bool = False,
 //|         start_up_time: float = 0,
 //|         address_little_endian: bool = False,
+//|         partial_refresh_sequence: Optional[ReadableBuffer] = None,
+//|         partial_refresh_time: Optional[float] = None,
+//|         full_refresh_interval: int = 10,
 //|     ) -> None:
 //|         """Create a EPaperDisplay object on the given display bus (`fourwire.FourWire` or `paralleldisplaybus.ParallelBus`).
 //|
@@ -107,6 +110,9 @@
 //|         :param bool two_byte_sequence_length: When true, use two bytes to define sequence length
 //|         :param float start_up_time: Time to wait after reset before sending commands
 //|         :param bool address_little_endian: Send the least significant byte (not bit) of multi-byte addresses first. Ignored when ram is addressed with one byte
+//|         :param ~circuitpython_typing.ReadableBuffer partial_refresh_sequence: Byte-packed command sequence sent instead of the refresh command when only the changed areas were written. It usually selects the panel's fast partial refresh waveform. Partial refreshes need ``set_row_window_command``. When None, every refresh is a full refresh.
+//|         :param float partial_refresh_time: Time a partial refresh takes. Defaults to ``refresh_time``. Ignored when busy_pin is provided.
+//|         :param int full_refresh_interval: Number of partial refreshes to do before a full refresh clears their ghosting
 //|         """
 //|         ...
 //|
@@ -118,7 +124,8 @@ static mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type,
            ARG_write_color_ram_command, ARG_color_bits_inverted, ARG_highlight_color,
            ARG_refresh_display_command,  ARG_refresh_time, ARG_busy_pin, ARG_busy_state,
            ARG_seconds_per_frame, ARG_always_toggle_chip_select, ARG_grayscale, ARG_advanced_color_epaper,
-           ARG_two_byte_sequence_length, ARG_start_up_time, ARG_address_little_endian };
+           ARG_two_byte_sequence_length, ARG_start_up_time, ARG_address_little_endian,
+           ARG_partial_refresh_sequence, ARG_partial_refresh_time, ARG_full_refresh_interval };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_display_bus, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_start_sequence, MP_ARG_REQUIRED | MP_ARG_OBJ },
@@ -150,6 +157,9 @@ static mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type,
         { MP_QSTR_two_byte_sequence_length, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
         { MP_QSTR_start_up_time, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NEW_SMALL_INT(0)} },
         { MP_QSTR_address_little_endian, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+        { MP_QSTR_partial_refresh_sequence, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_partial_refresh_time, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_full_refresh_interval, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 10} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -175,6 +185,15 @@ static mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type,
     mp_float_t refresh_time = mp_obj_get_float(args[ARG_refresh_time].u_obj);
     mp_float_t seconds_per_frame = mp_obj_get_float(args[ARG_seconds_per_frame].u_obj);
     mp_float_t start_up_time = mp_obj_get_float(args[ARG_start_up_time].u_obj);
+    mp_float_t partial_refresh_time = refresh_time;
+    if (args[ARG_partial_refresh_time].u_obj != mp_const_none) {
+        partial_refresh_time = mp_obj_get_float(args[ARG_partial_refresh_time].u_obj);
+    }
+    mp_int_t full_refresh_interval = mp_arg_validate_int_range(args[ARG_full_refresh_interval].u_int, 0, 0xffff, MP_QSTR_full_refresh_interval);
+    mp_buffer_info_t partial_refresh_bufinfo = { .buf = NULL, .len = 0 };
+    if (args[ARG_partial_refresh_sequence].u_obj != mp_const_none) {
+        mp_get_buffer_raise(args[ARG_partial_refresh_sequence].u_obj, &partial_refresh_bufinfo, MP_BUFFER_READ);
+    }
 
     mp_int_t write_color_ram_command = NO_COMMAND;
     mp_int_t highlight_color = args[ARG_highlight_color].u_int;
@@ -218,6 +237,10 @@ static mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type,
         args[ARG_always_toggle_chip_select].u_bool, args[ARG_grayscale].u_bool, args[ARG_advanced_color_epaper].u_bool,
         two_byte_sequence_length, args[ARG_address_little_endian].u_bool
         );
+    if (partial_refresh_bufinfo.buf != NULL) {
+        common_hal_epaperdisplay_epaperdisplay_set_partial_refresh(self, partial_refresh_bufinfo.buf,
+            partial_refresh_bufinfo.len, partial_refresh_time, full_refresh_interval);
+    }
 
     return self;
 }
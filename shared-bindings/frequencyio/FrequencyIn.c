@@ -128,7 +128,7 @@ static mp_obj_t frequencyio_frequencyin_obj_resume(mp_obj_t self_in) {
 MP_DEFINE_CONST_FUN_OBJ_1(frequencyio_frequencyin_resume_obj, frequencyio_frequencyin_obj_resume);
 
 //|     def clear(self) -> None:
-//|         """Clears the last detected frequency capture value."""
+//|         """Clears the last detected frequency capture value and the `statistics`."""
 //|         ...
 //|
 
@@ -141,6 +141,30 @@ static mp_obj_t frequencyio_frequencyin_obj_clear(mp_obj_t self_in) {
 }
 MP_DEFINE_CONST_FUN_OBJ_1(frequencyio_frequencyin_clear_obj, frequencyio_frequencyin_obj_clear);
 
+//|     def statistics(self) -> Tuple[int, int, int, int]:
+//|         """Returns ``(windows, min, max, mean)`` for the capture periods that have completed
+//|         since the last call or `clear()`, and starts collecting again. ``windows`` is how many
+//|         capture periods there were and the rest are frequencies in hertz. They are gathered
+//|         as each capture period completes, so no reading is missed between calls to `value`.
+//|         All are 0 when no capture period has completed."""
+//|         ...
+//|
+static mp_obj_t frequencyio_frequencyin_obj_statistics(mp_obj_t self_in) {
+    frequencyio_frequencyin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    frequencyio_statistics_t stats;
+    common_hal_frequencyio_frequencyin_get_statistics(self, &stats);
+    mp_obj_t items[] = {
+        mp_obj_new_int_from_uint(stats.windows),
+        mp_obj_new_int_from_uint(stats.min),
+        mp_obj_new_int_from_uint(stats.max),
+        mp_obj_new_int_from_uint(stats.mean),
+    };
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(frequencyio_frequencyin_statistics_obj, frequencyio_frequencyin_obj_statistics);
+
 //|     capture_period: int
 //|     """The capture measurement period. Lower incoming frequencies will be measured
 //|     more accurately with longer capture periods. Higher frequencies are more
@@ -197,6 +221,7 @@ static const mp_rom_map_elem_t frequencyio_frequencyin_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_pause), MP_ROM_PTR(&frequencyio_frequencyin_pause_obj) },
     { MP_ROM_QSTR(MP_QSTR_resume), MP_ROM_PTR(&frequencyio_frequencyin_resume_obj) },
     { MP_ROM_QSTR(MP_QSTR_clear), MP_ROM_PTR(&frequencyio_frequencyin_clear_obj) },
+    { MP_ROM_QSTR(MP_QSTR_statistics), MP_ROM_PTR(&frequencyio_frequencyin_statistics_obj) },
     { MP_ROM_QSTR(MP_QSTR_capture_period), MP_ROM_PTR(&frequencyio_frequencyin_capture_period_obj) },
 };
 static MP_DEFINE_CONST_DICT(frequencyio_frequencyin_locals_dict, frequencyio_frequencyin_locals_dict_table);
@@ -11,6 +11,14 @@
 
 extern const mp_obj_type_t frequencyio_frequencyin_type;
 
+// Frequencies, in hertz, of the capture windows completed since the statistics were last reset.
+typedef struct {
+    uint32_t windows;
+    uint32_t min;
+    uint32_t max;
+    uint32_t mean;
+} frequencyio_statistics_t;
+
 extern void common_hal_frequencyio_frequencyin_construct(frequencyio_frequencyin_obj_t *self,
     const mcu_pin_obj_t *pin, uint16_t capture_period);
 extern void common_hal_frequencyio_frequencyin_deinit(frequencyio_frequencyin_obj_t *self);
@@ -19,5 +27,7 @@ extern void common_hal_frequencyio_frequencyin_pause(frequencyio_frequencyin_obj
 extern void common_hal_frequencyio_frequencyin_resume(frequencyio_frequencyin_obj_t *self);
 extern void common_hal_frequencyio_frequencyin_clear(frequencyio_frequencyin_obj_t *self);
 extern uint32_t common_hal_frequencyio_frequencyin_get_item(frequencyio_frequencyin_obj_t *self);
+// Fills in stats and starts collecting them again. clear() also resets them.
+extern void common_hal_frequencyio_frequencyin_get_statistics(frequencyio_frequencyin_obj_t *self, frequencyio_statistics_t *stats);
 extern uint16_t common_hal_frequencyio_frequencyin_get_capture_period(frequencyio_frequencyin_obj_t *self);
 extern void common_hal_frequencyio_frequencyin_set_capture_period(frequencyio_frequencyin_obj_t *self, uint16_t capture_period);
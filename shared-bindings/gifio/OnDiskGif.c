@@ -87,12 +87,24 @@
 //|
 //|     """
 //|
-//|     def __init__(self, file: str) -> None:
+//|     def __init__(
+//|         self,
+//|         file: str,
+//|         *,
+//|         use_palette: bool = False,
+//|         framebuffer: Optional[circuitpython_typing.FrameBuffer] = None,
+//|     ) -> None:
 //|         """Create an `OnDiskGif` object with the given file.
 //|         The GIF frames are decoded into RGB565 big-endian format.
 //|         `displayio` expects little-endian, so the example above uses `Colorspace.RGB565_SWAPPED`.
 //|
 //|         :param file file: The name of the GIF file.
+//|         :param bool use_palette: Decode into an 8-bit `bitmap` with a `palette` instead of RGB565.
+//|         :param framebuffer: A 16-bit framebuffer, such as a `dotclockframebuffer.DotClockFramebuffer`,
+//|           to decode into directly instead of a separate bitmap. The frames are written at the top left
+//|           in native RGB565 and each `next_frame` swaps just the rows of `frame_rect`. Any
+//|           `framebufferio.FramebufferDisplay` on the same framebuffer should have ``auto_refresh`` off
+//|           so it doesn't draw over the animation.
 //|
 //|         If the image is too large it will be cropped at the bottom and right when displayed.
 //|
@@ -103,10 +115,11 @@
 //|         ...
 //|
 static mp_obj_t gifio_ondiskgif_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_filename, ARG_use_palette, NUM_ARGS };
+    enum { ARG_filename, ARG_use_palette, ARG_framebuffer, NUM_ARGS };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_filename, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_use_palette, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+        { MP_QSTR_framebuffer, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
     };
     MP_STATIC_ASSERT(MP_ARRAY_SIZE(allowed_args) == NUM_ARGS);
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -122,7 +135,7 @@ static mp_obj_t gifio_ondiskgif_make_new(const mp_obj_type_t *type, size_t n_arg
     }
 
     gifio_ondiskgif_t *self = mp_obj_malloc(gifio_ondiskgif_t, &gifio_ondiskgif_type);
-    common_hal_gifio_ondiskgif_construct(self, MP_OBJ_TO_PTR(filename), args[ARG_use_palette].u_bool);
+    common_hal_gifio_ondiskgif_construct(self, MP_OBJ_TO_PTR(filename), args[ARG_use_palette].u_bool, args[ARG_framebuffer].u_obj);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -203,6 +216,20 @@ MP_DEFINE_CONST_FUN_OBJ_1(gifio_ondiskgif_get_palette_obj, gifio_ondiskgif_obj_g
 MP_PROPERTY_GETTER(gifio_ondiskgif_palette_obj,
     (mp_obj_t)&gifio_ondiskgif_get_palette_obj);
 
+//|     frame_rect: Tuple[int, int, int, int]
+//|     """The ``(x, y, width, height)`` of the area the last frame drew, from its GIF image descriptor
+//|     and clipped to the bitmap. Only this area of `bitmap` is marked dirty by `next_frame`, so to blit
+//|     frames to a display directly only this area needs to be sent. (read only)"""
+static mp_obj_t gifio_ondiskgif_obj_get_frame_rect(mp_obj_t self_in) {
+    gifio_ondiskgif_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return common_hal_gifio_ondiskgif_get_frame_rect(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gifio_ondiskgif_get_frame_rect_obj, gifio_ondiskgif_obj_get_frame_rect);
+
+MP_PROPERTY_GETTER(gifio_ondiskgif_frame_rect_obj,
+    (mp_obj_t)&gifio_ondiskgif_get_frame_rect_obj);
+
 //|     def next_frame(self) -> float:
 //|         """Loads the next frame. Returns expected delay before the next frame in seconds."""
 //|
@@ -293,6 +320,7 @@ static const mp_rom_map_elem_t gifio_ondiskgif_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_bitmap), MP_ROM_PTR(&gifio_ondiskgif_bitmap_obj) },
     { MP_ROM_QSTR(MP_QSTR_palette), MP_ROM_PTR(&gifio_ondiskgif_palette_obj) },
     { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&gifio_ondiskgif_width_obj) },
+    { MP_ROM_QSTR(MP_QSTR_frame_rect), MP_ROM_PTR(&gifio_ondiskgif_frame_rect_obj) },
     { MP_ROM_QSTR(MP_QSTR_next_frame), MP_ROM_PTR(&gifio_ondiskgif_next_frame_obj) },
     { MP_ROM_QSTR(MP_QSTR_duration), MP_ROM_PTR(&gifio_ondiskgif_duration_obj) },
     { MP_ROM_QSTR(MP_QSTR_frame_count), MP_ROM_PTR(&gifio_ondiskgif_frame_count_obj) },
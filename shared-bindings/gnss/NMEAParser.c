@@ -0,0 +1,286 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 CircuitPython contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/gnss/NMEAParser.h"
+#include "shared-bindings/gnss/PositionFix.h"
+#include "shared-bindings/util.h"
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "py/stream.h"
+#include "shared/timeutils/timeutils.h"
+
+#if CIRCUITPY_TIME
+#include "shared-bindings/time/__init__.h"
+#endif
+
+//| class NMEAParser:
+//|     """Parse NMEA 0183 sentences from a GPS receiver into a position fix
+//|
+//|     Parsing happens in C as bytes arrive and only updates fields of the
+//|     parser, so a receiver sending several sentences at 10Hz creates no
+//|     garbage. Sentences with a bad checksum are counted and dropped.
+//|
+//|     Usage::
+//|
+//|         import board
+//|         import busio
+//|         import gnss
+//|
+//|         uart = busio.UART(board.TX, board.RX, baudrate=9600, timeout=0)
+//|         gps = gnss.NMEAParser(uart, sentences=("GGA", "RMC"))
+//|         while True:
+//|             if gps.update() and gps.fix is not gnss.PositionFix.INVALID:
+//|                 print(gps.latitude, gps.longitude, gps.satellites)"""
+//|
+//|     def __init__(
+//|         self,
+//|         stream: Optional[circuitpython_typing.ByteStream] = None,
+//|         *,
+//|         sentences: Optional[Iterable[str]] = None,
+//|     ) -> None:
+//|         """Create a parser.
+//|
+//|         :param stream: receiver connection such as a `busio.UART` that `update()` reads
+//|           from. If ``None``, bytes must be passed to `feed()` instead.
+//|         :param sentences: sentence types to use, from ``"GGA"``, ``"GLL"``, ``"GSA"``
+//|           and ``"RMC"``, regardless of talker ID. Others are skipped before any field
+//|           is parsed. Defaults to all of them."""
+//|         ...
+//|
+static mp_obj_t gnss_nmeaparser_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_stream, ARG_sentences };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_stream, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_sentences, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t stream = args[ARG_stream].u_obj;
+    if (stream != mp_const_none) {
+        mp_get_stream_raise(stream, MP_STREAM_OP_READ | MP_STREAM_OP_IOCTL);
+    }
+
+    uint8_t sentence_mask = GNSS_NMEA_ALL;
+    if (args[ARG_sentences].u_obj != mp_const_none) {
+        sentence_mask = 0;
+        mp_obj_iter_buf_t iter_buf;
+        mp_obj_t iterable = mp_getiter(args[ARG_sentences].u_obj, &iter_buf);
+        mp_obj_t item;
+        while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+            size_t len;
+            const char *name = mp_obj_str_get_data(item, &len);
+            uint8_t bit = shared_module_gnss_nmea_sentence_type(name, len);
+            if (bit == 0) {
+                mp_arg_error_invalid(MP_QSTR_sentences);
+            }
+            sentence_mask |= bit;
+        }
+    }
+
+    gnss_nmeaparser_obj_t *self = mp_obj_malloc(gnss_nmeaparser_obj_t, &gnss_nmeaparser_type);
+    common_hal_gnss_nmeaparser_construct(self, stream, sentence_mask);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def feed(self, data: ReadableBuffer) -> int:
+//|         """Parse bytes received from the GPS. Partial sentences are kept until
+//|         the rest arrives.
+//|
+//|         :return: the number of sentences accepted"""
+//|         ...
+//|
+static mp_obj_t gnss_nmeaparser_feed(mp_obj_t self_in, mp_obj_t data_in) {
+    gnss_nmeaparser_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data_in, &bufinfo, MP_BUFFER_READ);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_gnss_nmeaparser_feed(self, bufinfo.buf, bufinfo.len));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(gnss_nmeaparser_feed_obj, gnss_nmeaparser_feed);
+
+//|     def update(self) -> int:
+//|         """Parse all bytes already waiting in ``stream``. This does not wait for
+//|         more to arrive, so call it regularly.
+//|
+//|         :return: the number of sentences accepted"""
+//|         ...
+//|
+static mp_obj_t gnss_nmeaparser_update(mp_obj_t self_in) {
+    gnss_nmeaparser_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_gnss_nmeaparser_update(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gnss_nmeaparser_update_obj, gnss_nmeaparser_update);
+
+//|     def reset(self) -> None:
+//|         """Forget the current fix, counters and any partial sentence."""
+//|         ...
+//|
+static mp_obj_t gnss_nmeaparser_reset(mp_obj_t self_in) {
+    gnss_nmeaparser_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_gnss_nmeaparser_reset(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gnss_nmeaparser_reset_obj, gnss_nmeaparser_reset);
+
+static mp_obj_t new_e7_float(int32_t value) {
+    return mp_obj_new_float((mp_float_t)value / MICROPY_FLOAT_CONST(1e7));
+}
+
+//|     latitude: Optional[float]
+//|     """Latitude of the last valid position in degrees, or ``None`` if there
+//|     hasn't been one."""
+static mp_obj_t gnss_nmeaparser_obj_get_latitude(mp_obj_t self_in) {
+    gnss_nmeaparser_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    const gnss_nmea_fix_t *fix = common_hal_gnss_nmeaparser_get_fix(self);
+    return fix->has_position ? new_e7_float(fix->latitude_e7) : mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gnss_nmeaparser_get_latitude_obj, gnss_nmeaparser_obj_get_latitude);
+
+MP_PROPERTY_GETTER(gnss_nmeaparser_latitude_obj,
+    (mp_obj_t)&gnss_nmeaparser_get_latitude_obj);
+
+//|     longitude: Optional[float]
+//|     """Longitude of the last valid position in degrees, or ``None`` if there
+//|     hasn't been one."""
+static mp_obj_t gnss_nmeaparser_obj_get_longitude(mp_obj_t self_in) {
+    gnss_nmeaparser_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    const gnss_nmea_fix_t *fix = common_hal_gnss_nmeaparser_get_fix(self);
+    return fix->has_position ? new_e7_float(fix->longitude_e7) : mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gnss_nmeaparser_get_longitude_obj, gnss_nmeaparser_obj_get_longitude);
+
+MP_PROPERTY_GETTER(gnss_nmeaparser_longitude_obj,
+    (mp_obj_t)&gnss_nmeaparser_get_longitude_obj);
+
+//|     altitude: Optional[float]
+//|     """Altitude above mean sea level in meters from the last GGA fix, or
+//|     ``None`` if there hasn't been one."""
+static mp_obj_t gnss_nmeaparser_obj_get_altitude(mp_obj_t self_in) {
+    gnss_nmeaparser_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    const gnss_nmea_fix_t *fix = common_hal_gnss_nmeaparser_get_fix(self);
+    if (!fix->has_altitude) {
+        return mp_const_none;
+    }
+    return mp_obj_new_float((mp_float_t)fix->altitude_mm / MICROPY_FLOAT_CONST(1000.0));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gnss_nmeaparser_get_altitude_obj, gnss_nmeaparser_obj_get_altitude);
+
+MP_PROPERTY_GETTER(gnss_nmeaparser_altitude_obj,
+    (mp_obj_t)&gnss_nmeaparser_get_altitude_obj);
+
+//|     timestamp: Optional[time.struct_time]
+//|     """UTC time of the last sentence that carried one, or ``None``. The date
+//|     is 2000-01-01 until an RMC sentence supplies it."""
+static mp_obj_t gnss_nmeaparser_obj_get_timestamp(mp_obj_t self_in) {
+    gnss_nmeaparser_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    const gnss_nmea_fix_t *fix = common_hal_gnss_nmeaparser_get_fix(self);
+    if (!fix->has_time) {
+        return mp_const_none;
+    }
+    timeutils_struct_time_t tm = {
+        .tm_year = fix->has_date ? fix->year : 2000,
+        .tm_mon = fix->has_date ? fix->month : 1,
+        .tm_mday = fix->has_date ? fix->day : 1,
+        .tm_hour = fix->hour,
+        .tm_min = fix->minute,
+        .tm_sec = fix->second,
+    };
+    #if CIRCUITPY_TIME
+    return struct_time_from_tm(&tm);
+    #else
+    tm.tm_wday = timeutils_calc_weekday(tm.tm_year, tm.tm_mon, tm.tm_mday);
+    tm.tm_yday = timeutils_year_day(tm.tm_year, tm.tm_mon, tm.tm_mday);
+    mp_obj_t elems[9] = {
+        mp_obj_new_int(tm.tm_year),
+        mp_obj_new_int(tm.tm_mon),
+        mp_obj_new_int(tm.tm_mday),
+        mp_obj_new_int(tm.tm_hour),
+        mp_obj_new_int(tm.tm_min),
+        mp_obj_new_int(tm.tm_sec),
+        mp_obj_new_int(tm.tm_wday),
+        mp_obj_new_int(tm.tm_yday),
+        mp_obj_new_int(-1),
+    };
+    return mp_obj_new_tuple(9, elems);
+    #endif
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gnss_nmeaparser_get_timestamp_obj, gnss_nmeaparser_obj_get_timestamp);
+
+MP_PROPERTY_GETTER(gnss_nmeaparser_timestamp_obj,
+    (mp_obj_t)&gnss_nmeaparser_get_timestamp_obj);
+
+//|     satellites: Optional[int]
+//|     """Number of satellites used in the last GGA fix, or ``None``."""
+static mp_obj_t gnss_nmeaparser_obj_get_satellites(mp_obj_t self_in) {
+    gnss_nmeaparser_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    const gnss_nmea_fix_t *fix = common_hal_gnss_nmeaparser_get_fix(self);
+    return fix->has_satellites ? MP_OBJ_NEW_SMALL_INT(fix->satellites) : mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gnss_nmeaparser_get_satellites_obj, gnss_nmeaparser_obj_get_satellites);
+
+MP_PROPERTY_GETTER(gnss_nmeaparser_satellites_obj,
+    (mp_obj_t)&gnss_nmeaparser_get_satellites_obj);
+
+//|     fix: PositionFix
+//|     """Fix mode. GSA reports 2D or 3D directly; otherwise a GGA fix with an
+//|     altitude counts as 3D."""
+static mp_obj_t gnss_nmeaparser_obj_get_fix(mp_obj_t self_in) {
+    gnss_nmeaparser_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return gnss_positionfix_type_to_obj(common_hal_gnss_nmeaparser_get_fix(self)->fix);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gnss_nmeaparser_get_fix_obj, gnss_nmeaparser_obj_get_fix);
+
+MP_PROPERTY_GETTER(gnss_nmeaparser_fix_obj,
+    (mp_obj_t)&gnss_nmeaparser_get_fix_obj);
+
+//|     sentence_count: int
+//|     """Number of sentences accepted since creation or `reset()`."""
+static mp_obj_t gnss_nmeaparser_obj_get_sentence_count(mp_obj_t self_in) {
+    gnss_nmeaparser_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_gnss_nmeaparser_get_sentence_count(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gnss_nmeaparser_get_sentence_count_obj, gnss_nmeaparser_obj_get_sentence_count);
+
+MP_PROPERTY_GETTER(gnss_nmeaparser_sentence_count_obj,
+    (mp_obj_t)&gnss_nmeaparser_get_sentence_count_obj);
+
+//|     error_count: int
+//|     """Number of sentences dropped because of a bad checksum, a malformed
+//|     field or excessive length."""
+//|
+static mp_obj_t gnss_nmeaparser_obj_get_error_count(mp_obj_t self_in) {
+    gnss_nmeaparser_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_gnss_nmeaparser_get_error_count(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gnss_nmeaparser_get_error_count_obj, gnss_nmeaparser_obj_get_error_count);
+
+MP_PROPERTY_GETTER(gnss_nmeaparser_error_count_obj,
+    (mp_obj_t)&gnss_nmeaparser_get_error_count_obj);
+
+static const mp_rom_map_elem_t gnss_nmeaparser_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_feed), MP_ROM_PTR(&gnss_nmeaparser_feed_obj) },
+    { MP_ROM_QSTR(MP_QSTR_update), MP_ROM_PTR(&gnss_nmeaparser_update_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reset), MP_ROM_PTR(&gnss_nmeaparser_reset_obj) },
+
+    { MP_ROM_QSTR(MP_QSTR_latitude), MP_ROM_PTR(&gnss_nmeaparser_latitude_obj) },
+    { MP_ROM_QSTR(MP_QSTR_longitude), MP_ROM_PTR(&gnss_nmeaparser_longitude_obj) },
+    { MP_ROM_QSTR(MP_QSTR_altitude), MP_ROM_PTR(&gnss_nmeaparser_altitude_obj) },
+    { MP_ROM_QSTR(MP_QSTR_timestamp), MP_ROM_PTR(&gnss_nmeaparser_timestamp_obj) },
+    { MP_ROM_QSTR(MP_QSTR_satellites), MP_ROM_PTR(&gnss_nmeaparser_satellites_obj) },
+    { MP_ROM_QSTR(MP_QSTR_fix), MP_ROM_PTR(&gnss_nmeaparser_fix_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sentence_count), MP_ROM_PTR(&gnss_nmeaparser_sentence_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_error_count), MP_ROM_PTR(&gnss_nmeaparser_error_count_obj) },
+};
+static MP_DEFINE_CONST_DICT(gnss_nmeaparser_locals_dict, gnss_nmeaparser_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    gnss_nmeaparser_type,
+    MP_QSTR_NMEAParser,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, gnss_nmeaparser_make_new,
+    locals_dict, &gnss_nmeaparser_locals_dict
+    );
@@ -0,0 +1,20 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 CircuitPython contributors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/gnss/NMEAParser.h"
+
+extern const mp_obj_type_t gnss_nmeaparser_type;
+
+void common_hal_gnss_nmeaparser_construct(gnss_nmeaparser_obj_t *self, mp_obj_t stream, uint8_t sentence_mask);
+size_t common_hal_gnss_nmeaparser_feed(gnss_nmeaparser_obj_t *self, const uint8_t *data, size_t len);
+size_t common_hal_gnss_nmeaparser_update(gnss_nmeaparser_obj_t *self);
+void common_hal_gnss_nmeaparser_reset(gnss_nmeaparser_obj_t *self);
+
+const gnss_nmea_fix_t *common_hal_gnss_nmeaparser_get_fix(gnss_nmeaparser_obj_t *self);
+uint32_t common_hal_gnss_nmeaparser_get_sentence_count(gnss_nmeaparser_obj_t *self);
+uint32_t common_hal_gnss_nmeaparser_get_error_count(gnss_nmeaparser_obj_t *self);
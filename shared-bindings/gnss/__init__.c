@@ -6,16 +6,19 @@
 #include "py/runtime.h"
 #include "py/mphal.h"
 #include "shared-bindings/gnss/GNSS.h"
+#include "shared-bindings/gnss/NMEAParser.h"
 #include "shared-bindings/gnss/SatelliteSystem.h"
 #include "shared-bindings/gnss/PositionFix.h"
 #include "shared-bindings/util.h"
 
 //| """Global Navigation Satellite System
 //|
-//| The `gnss` module contains classes to control the GNSS and acquire positioning information."""
+//| The `gnss` module contains classes to control the GNSS and acquire positioning information,
+//| and `NMEAParser` for external GPS receivers that send NMEA sentences."""
 static const mp_rom_map_elem_t gnss_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_gnss) },
     { MP_ROM_QSTR(MP_QSTR_GNSS), MP_ROM_PTR(&gnss_type) },
+    { MP_ROM_QSTR(MP_QSTR_NMEAParser), MP_ROM_PTR(&gnss_nmeaparser_type) },
 
     // Enum-like Classes.
     { MP_ROM_QSTR(MP_QSTR_SatelliteSystem), MP_ROM_PTR(&gnss_satellitesystem_type) },
@@ -9,6 +9,7 @@
 #include "py/obj.h"
 #include "py/mpconfig.h"
 #include "py/runtime.h"
+#include "py/stream.h"
 #include "shared-bindings/hashlib/__init__.h"
 #include "shared-bindings/hashlib/Hash.h"
 
@@ -19,8 +20,8 @@
 //|
 //|
 //| def new(name: str, data: bytes = b"") -> hashlib.Hash:
-//|     """Returns a Hash object setup for the named algorithm. Raises ValueError when the named
-//|        algorithm is unsupported.
+//|     """Returns a Hash object setup for the named algorithm, ``"sha1"`` or ``"sha256"``. Raises
+//|        ValueError when the named algorithm is unsupported.
 //|
 //|     :return: a hash object for the given algorithm
 //|     :rtype: hashlib.Hash"""
@@ -51,10 +52,75 @@ static mp_obj_t hashlib_new(size_t n_args, const mp_obj_t *pos_args, mp_map_t *k
 }
 static MP_DEFINE_CONST_FUN_OBJ_KW(hashlib_new_obj, 1, hashlib_new);
 
+// Whole sectors are read straight into the buffer by the filesystem, without its window.
+#define FILE_DIGEST_CHUNK_SIZE (4096)
+
+//| def file_digest(fileobj: object, digest: str, *, size: int = -1) -> hashlib.Hash:
+//|     """Returns a Hash object for the named algorithm, as for `new`, of the data read from
+//|     ``fileobj``. The data is read and hashed in C, in large chunks, so hashing a file or a
+//|     download doesn't make a Python object for each chunk.
+//|
+//|     :param fileobj: A file opened in binary mode, a socket or any other readable stream
+//|     :param str digest: The name of the algorithm, ``"sha1"`` or ``"sha256"``
+//|     :param int size: How many bytes to read, such as the length of an HTTP response body.
+//|       Reads until the end of the stream when negative. Raises EOFError if the stream ends first.
+//|     :return: a hash object that has been updated with the data
+//|     :rtype: hashlib.Hash"""
+//|     ...
+//|
+//|
+static mp_obj_t hashlib_file_digest(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_fileobj, ARG_digest, ARG_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_fileobj, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_digest, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_size, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = -1} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t fileobj = args[ARG_fileobj].u_obj;
+    const mp_stream_p_t *stream_p = mp_get_stream_raise(fileobj, MP_STREAM_OP_READ);
+    const char *algorithm = mp_obj_str_get_str(args[ARG_digest].u_obj);
+    mp_int_t remaining = args[ARG_size].u_int;
+
+    hashlib_hash_obj_t *self = mp_obj_malloc(hashlib_hash_obj_t, &hashlib_hash_type);
+    if (!common_hal_hashlib_new(self, algorithm)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Unsupported hash algorithm"));
+    }
+
+    uint8_t *buf = m_new(uint8_t, FILE_DIGEST_CHUNK_SIZE);
+    while (remaining != 0) {
+        size_t to_read = FILE_DIGEST_CHUNK_SIZE;
+        if (remaining > 0 && (size_t)remaining < to_read) {
+            to_read = remaining;
+        }
+        int errcode;
+        mp_uint_t out_sz = stream_p->read(fileobj, buf, to_read, &errcode);
+        if (out_sz == MP_STREAM_ERROR) {
+            mp_raise_OSError(errcode);
+        }
+        if (out_sz == 0) {
+            if (remaining > 0) {
+                mp_raise_type(&mp_type_EOFError);
+            }
+            break;
+        }
+        common_hal_hashlib_hash_update(self, buf, out_sz);
+        if (remaining > 0) {
+            remaining -= out_sz;
+        }
+    }
+    m_del(uint8_t, buf, FILE_DIGEST_CHUNK_SIZE);
+    return self;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(hashlib_file_digest_obj, 2, hashlib_file_digest);
+
 static const mp_rom_map_elem_t hashlib_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_hashlib) },
 
     { MP_ROM_QSTR(MP_QSTR_new), MP_ROM_PTR(&hashlib_new_obj) },
+    { MP_ROM_QSTR(MP_QSTR_file_digest), MP_ROM_PTR(&hashlib_file_digest_obj) },
 
     // Hash is deliberately omitted here because CPython doesn't expose the
     // object on `hashlib` only the internal `_hashlib`.
@@ -119,7 +119,6 @@ static void check_for_deinit(i2ctarget_i2c_target_obj_t *self) {
 //|         :return: I2CTargetRequest or None if timeout=-1 and there's no request
 //|         :rtype: ~i2ctarget.I2CTargetRequest"""
 //|
-//|
 static mp_obj_t i2ctarget_i2c_target_request(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     i2ctarget_i2c_target_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
     check_for_deinit(self);
@@ -186,12 +185,78 @@ static mp_obj_t i2ctarget_i2c_target_request(size_t n_args, const mp_obj_t *pos_
 }
 static MP_DEFINE_CONST_FUN_OBJ_KW(i2ctarget_i2c_target_request_obj, 1, i2ctarget_i2c_target_request);
 
+//|     def serve_registers(self, registers: Optional[WriteableBuffer]) -> None:
+//|         """Answer the controller from ``registers`` in the background, without `request`.
+//|
+//|         The first byte of each write from the controller selects a register, and any more
+//|         bytes are stored starting there. Reads return bytes starting at the selected register.
+//|         The register moves on by one for each byte and wraps around at the end of
+//|         ``registers``. Transactions are handled by interrupts, so the controller is answered
+//|         at bus speed while Python does other things. Use `registers_changed` to find out what
+//|         the controller wrote.
+//|
+//|         ``registers`` must be kept the same size while it is being served.
+//|
+//|         :param ~circuitpython_typing.WriteableBuffer registers: The register file, 1 to 256
+//|           bytes long, or ``None`` to go back to using `request`."""
+//|         ...
+//|
+static mp_obj_t i2ctarget_i2c_target_serve_registers(mp_obj_t self_in, mp_obj_t registers_in) {
+    i2ctarget_i2c_target_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    if (registers_in == mp_const_none) {
+        common_hal_i2ctarget_i2c_target_serve_registers(self, NULL, 0);
+        return mp_const_none;
+    }
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(registers_in, &bufinfo, MP_BUFFER_WRITE);
+    mp_arg_validate_length_range(bufinfo.len, 1, 256, MP_QSTR_registers);
+    common_hal_i2ctarget_i2c_target_serve_registers(self, bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(i2ctarget_i2c_target_serve_registers_obj, i2ctarget_i2c_target_serve_registers);
+
+//|     def registers_changed(self) -> Optional[Tuple[int, int]]:
+//|         """Returns ``(start, end)`` covering the registers that the controller has written since
+//|         the last call, or ``None`` if it hasn't written any.
+//|         ``registers[start:end]`` holds the new values."""
+//|         ...
+//|
+//|
+static mp_obj_t i2ctarget_i2c_target_registers_changed(mp_obj_t self_in) {
+    i2ctarget_i2c_target_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    size_t start, end;
+    if (!common_hal_i2ctarget_i2c_target_registers_changed(self, &start, &end)) {
+        return mp_const_none;
+    }
+    mp_obj_t items[] = { MP_OBJ_NEW_SMALL_INT(start), MP_OBJ_NEW_SMALL_INT(end) };
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(i2ctarget_i2c_target_registers_changed_obj, i2ctarget_i2c_target_registers_changed);
+
+MP_WEAK void common_hal_i2ctarget_i2c_target_serve_registers(i2ctarget_i2c_target_obj_t *self,
+    uint8_t *registers, size_t len) {
+    if (registers != NULL) {
+        mp_raise_NotImplementedError(NULL);
+    }
+}
+
+MP_WEAK bool common_hal_i2ctarget_i2c_target_registers_changed(i2ctarget_i2c_target_obj_t *self,
+    size_t *start, size_t *end) {
+    return false;
+}
+
 static const mp_rom_map_elem_t i2ctarget_i2c_target_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&i2ctarget_i2c_target_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&i2ctarget_i2c_target_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&default___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_request), MP_ROM_PTR(&i2ctarget_i2c_target_request_obj) },
+    { MP_ROM_QSTR(MP_QSTR_serve_registers), MP_ROM_PTR(&i2ctarget_i2c_target_serve_registers_obj) },
+    { MP_ROM_QSTR(MP_QSTR_registers_changed), MP_ROM_PTR(&i2ctarget_i2c_target_registers_changed_obj) },
 
 };
 
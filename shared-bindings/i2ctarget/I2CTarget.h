@@ -35,3 +35,12 @@ extern int common_hal_i2ctarget_i2c_target_read_byte(i2ctarget_i2c_target_obj_t
 extern int common_hal_i2ctarget_i2c_target_write_byte(i2ctarget_i2c_target_obj_t *self, uint8_t data);
 extern void common_hal_i2ctarget_i2c_target_ack(i2ctarget_i2c_target_obj_t *self, bool ack);
 extern void common_hal_i2ctarget_i2c_target_close(i2ctarget_i2c_target_obj_t *self);
+
+// Answers transactions from interrupts using registers as the register file, instead of through
+// request(). NULL goes back to request(). Ports that can't do this raise NotImplementedError.
+extern void common_hal_i2ctarget_i2c_target_serve_registers(i2ctarget_i2c_target_obj_t *self,
+    uint8_t *registers, size_t len);
+// Returns false if no registers have been written since the last call. Otherwise [start, end)
+// covers the registers that were.
+extern bool common_hal_i2ctarget_i2c_target_registers_changed(i2ctarget_i2c_target_obj_t *self,
+    size_t *start, size_t *end);
@@ -116,6 +116,11 @@ MP_DEFINE_CONST_FUN_OBJ_2(jpegio_jpegdecoder_open_obj, jpegio_jpegdecoder_open);
 //|         higher JPEG encoding quality can help, but ultimately it will not be
 //|         perfect.
 //|
+//|         Only the part of the image selected by ``x1``, ``y1``, ``x2`` and ``y2`` that
+//|         fits in the bitmap goes through the inverse DCT and color conversion, and decoding
+//|         stops after its last row. Decoding a large image a band at a time into a small
+//|         bitmap, or previewing part of it, therefore costs much less than a full decode.
+//|
 //|         After a call to ``decode``, you must ``open`` a new JPEG. It is not
 //|         possible to repeatedly ``decode`` the same jpeg data, even if it is to
 //|         select different scales or crop regions from it.
@@ -4,6 +4,7 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include "py/binary.h"
 #include "py/stream.h"
 #include "py/mperrno.h"
 #include "py/objproperty.h"
@@ -68,6 +69,69 @@ static mp_obj_t keypad_eventqueue_get_into(mp_obj_t self_in, mp_obj_t event_in)
 }
 MP_DEFINE_CONST_FUN_OBJ_2(keypad_eventqueue_get_into_obj, keypad_eventqueue_get_into);
 
+//|     def get_many_into(
+//|         self,
+//|         key_numbers: WriteableBuffer,
+//|         pressed: Optional[WriteableBuffer] = None,
+//|         timestamps: Optional[WriteableBuffer] = None,
+//|     ) -> int:
+//|         """Remove as many queued key transition events as fit in ``key_numbers``, and
+//|         store their fields in the given buffers, one element per event.
+//|         Return the number of events removed, which is ``0`` if none were pending.
+//|
+//|         Like ``get_into()``, this does not allocate storage, and draining a burst of
+//|         events in one call is much cheaper than calling ``get_into()`` repeatedly.
+//|         Each buffer may be a ``bytearray`` or an ``array.array`` of any integer type;
+//|         values that do not fit in the element type are truncated.
+//|
+//|         :param WriteableBuffer key_numbers: Receives the `Event.key_number` of each event.
+//|         :param WriteableBuffer pressed: If given, receives ``1`` for a press and ``0`` for a release.
+//|            Must be at least as long as ``key_numbers``.
+//|         :param WriteableBuffer timestamps: If given, receives the `Event.timestamp` of each event.
+//|            Use an ``array.array('L')`` to hold the full range of values.
+//|            Must be at least as long as ``key_numbers``.
+//|         :return: The number of events stored.
+//|         :rtype: int
+//|         """
+//|         ...
+//|
+static mp_obj_t keypad_eventqueue_get_many_into(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_key_numbers, ARG_pressed, ARG_timestamps };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_key_numbers, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_pressed, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_timestamps, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    keypad_eventqueue_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t key_numbers;
+    mp_get_buffer_raise(args[ARG_key_numbers].u_obj, &key_numbers, MP_BUFFER_WRITE);
+    size_t max_events = key_numbers.len / mp_binary_get_size('@', key_numbers.typecode, NULL);
+
+    mp_buffer_info_t pressed_info;
+    mp_buffer_info_t *pressed = NULL;
+    if (args[ARG_pressed].u_obj != mp_const_none) {
+        mp_get_buffer_raise(args[ARG_pressed].u_obj, &pressed_info, MP_BUFFER_WRITE);
+        mp_arg_validate_length_min(pressed_info.len / mp_binary_get_size('@', pressed_info.typecode, NULL),
+            max_events, MP_QSTR_pressed);
+        pressed = &pressed_info;
+    }
+
+    mp_buffer_info_t timestamps_info;
+    mp_buffer_info_t *timestamps = NULL;
+    if (args[ARG_timestamps].u_obj != mp_const_none) {
+        mp_get_buffer_raise(args[ARG_timestamps].u_obj, &timestamps_info, MP_BUFFER_WRITE);
+        mp_arg_validate_length_min(timestamps_info.len / mp_binary_get_size('@', timestamps_info.typecode, NULL),
+            max_events, MP_QSTR_timestamps);
+        timestamps = &timestamps_info;
+    }
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_keypad_eventqueue_get_many_into(self, max_events, &key_numbers, pressed, timestamps));
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(keypad_eventqueue_get_many_into_obj, 1, keypad_eventqueue_get_many_into);
+
 //|     def clear(self) -> None:
 //|         """Clear any queued key transition events. Also sets `overflowed` to ``False``."""
 //|         ...
@@ -122,6 +186,7 @@ static const mp_rom_map_elem_t keypad_eventqueue_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_clear),      MP_ROM_PTR(&keypad_eventqueue_clear_obj) },
     { MP_ROM_QSTR(MP_QSTR_get),        MP_ROM_PTR(&keypad_eventqueue_get_obj) },
     { MP_ROM_QSTR(MP_QSTR_get_into),   MP_ROM_PTR(&keypad_eventqueue_get_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_get_many_into), MP_ROM_PTR(&keypad_eventqueue_get_many_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_overflowed), MP_ROM_PTR(&keypad_eventqueue_overflowed_obj) },
 };
 
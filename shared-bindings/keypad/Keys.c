@@ -48,6 +48,9 @@
 //|
 //|         An `EventQueue` is created when this object is created and is available in the `events` attribute.
 //|
+//|         On ports that can interrupt on a pin level, scanning stops while no key is pressed
+//|         and resumes when one is, so idle keys cost almost nothing.
+//|
 //|         :param Sequence[microcontroller.Pin] pins: The pins attached to the keys.
 //|           The key numbers correspond to indices into this sequence.
 //|         :param bool value_when_pressed: ``True`` if the pin reads high when the key is pressed.
@@ -14,3 +14,8 @@ extern const mp_obj_type_t keypad_keys_type;
 void common_hal_keypad_keys_construct(keypad_keys_obj_t *self, mp_uint_t num_pins, const mcu_pin_obj_t *pins[], bool value_when_pressed,  bool pull, mp_float_t interval, size_t max_events, uint8_t debounce_threshold);
 
 void common_hal_keypad_keys_deinit(keypad_keys_obj_t *self);
+
+// Arms an interrupt that calls keypad_wake() when any key is pressed, firing at once if one already
+// is, and disarms it when it fires. Returns false when the port can't wake on the pins.
+bool common_hal_keypad_keys_enable_wakeup(keypad_keys_obj_t *self);
+void common_hal_keypad_keys_disable_wakeup(keypad_keys_obj_t *self);
@@ -0,0 +1,226 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 CircuitPython contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/keypad/__init__.h"
+#include "shared-bindings/keypad/Event.h"
+#include "shared-bindings/keypad/TouchKeys.h"
+#include "shared-bindings/microcontroller/Pin.h"
+#include "shared-bindings/util.h"
+
+//| class TouchKeys:
+//|     """Manage a set of capacitive touch pads as keys.
+//|
+//|     .. raw:: html
+//|
+//|         <p>
+//|         <details>
+//|         <summary>Available on these boards</summary>
+//|         <ul>
+//|         {% for board in support_matrix_reverse["keypad.TouchKeys"] %}
+//|         <li> {{ board }}
+//|         {% endfor %}
+//|         </ul>
+//|         </details>
+//|         </p>
+//|
+//|     """
+//|
+//|     def __init__(
+//|         self,
+//|         pins: Sequence[microcontroller.Pin],
+//|         *,
+//|         pull: Optional[digitalio.Pull] = None,
+//|         threshold: Optional[int] = None,
+//|         interval: float = 0.020,
+//|         max_events: int = 64,
+//|         debounce_threshold: int = 1,
+//|     ) -> None:
+//|         """
+//|         Create a `TouchKeys` object that will measure the touch pads attached to the given
+//|         sequence of pins in the background, the same way `touchio.TouchIn` does, using the
+//|         touch peripheral where the chip has one.
+//|
+//|         Each pad's readings are smoothed, and compared with a baseline that slowly follows
+//|         the untouched reading, so that pads keep working as temperature and humidity drift.
+//|         A pad is pressed when its reading is ``threshold`` above its baseline, and released
+//|         when it falls back below half of that.
+//|
+//|         An `EventQueue` is created when this object is created and is available in the `events` attribute.
+//|
+//|         :param Sequence[microcontroller.Pin] pins: The pins attached to the touch pads.
+//|           The key numbers correspond to indices into this sequence.
+//|           No pad should be touched when this object is created, because its first reading
+//|           is the initial baseline.
+//|         :param Optional[digitalio.Pull] pull: The external pull resistor, as for `touchio.TouchIn`.
+//|         :param Optional[int] threshold: How far above its baseline a pad's raw reading must be
+//|           to count as touched. If ``None``, each pad uses the margin `touchio.TouchIn` would use.
+//|         :param float interval: Measure the pads no more often than ``interval``.
+//|           ``interval`` is in float seconds. The default is 0.020 (20 msecs).
+//|         :param int max_events: maximum size of `events` `EventQueue`:
+//|           maximum number of key transition events that are saved.
+//|           Must be >= 1.
+//|           If a new event arrives when the queue is full, the oldest event is discarded.
+//|         :param int debounce_threshold: Emit events for state changes only after a pad has been
+//|           in the respective state for ``debounce_threshold`` times on average.
+//|           Successive measurements are spaced apart by ``interval`` seconds.
+//|           The default is 1, which resolves immediately. The maximum is 127.
+//|         """
+//|         ...
+//|
+
+static mp_obj_t keypad_touchkeys_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    #if CIRCUITPY_KEYPAD_TOUCHKEYS
+    keypad_touchkeys_obj_t *self = mp_obj_malloc(keypad_touchkeys_obj_t, &keypad_touchkeys_type);
+    enum { ARG_pins, ARG_pull, ARG_threshold, ARG_interval, ARG_max_events, ARG_debounce_threshold };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_pins, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_pull, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_threshold, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_interval, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_max_events, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 64} },
+        { MP_QSTR_debounce_threshold, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 1} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t pins = args[ARG_pins].u_obj;
+    validate_no_duplicate_pins(pins, MP_QSTR_pins);
+    // mp_obj_len() will be >= 0.
+    const size_t num_pins = (size_t)MP_OBJ_SMALL_INT_VALUE(mp_obj_len(pins));
+
+    const digitalio_pull_t pull = validate_pull(args[ARG_pull].u_obj, MP_QSTR_pull);
+    uint16_t threshold = 0;
+    if (args[ARG_threshold].u_obj != mp_const_none) {
+        threshold = (uint16_t)mp_arg_validate_int_range(mp_obj_get_int(args[ARG_threshold].u_obj), 1, 65535, MP_QSTR_threshold);
+    }
+    const mp_float_t interval =
+        mp_arg_validate_obj_float_non_negative(args[ARG_interval].u_obj, 0.020f, MP_QSTR_interval);
+    const size_t max_events = (size_t)mp_arg_validate_int_min(args[ARG_max_events].u_int, 1, MP_QSTR_max_events);
+    const uint8_t debounce_threshold = (uint8_t)mp_arg_validate_int_range(args[ARG_debounce_threshold].u_int, 1, 127, MP_QSTR_debounce_threshold);
+
+    const mcu_pin_obj_t *pins_array[num_pins];
+
+    for (mp_uint_t i = 0; i < num_pins; i++) {
+        pins_array[i] =
+            validate_obj_is_free_pin(mp_obj_subscr(pins, MP_OBJ_NEW_SMALL_INT(i), MP_OBJ_SENTINEL), MP_QSTR_pin);
+    }
+
+    common_hal_keypad_touchkeys_construct(self, num_pins, pins_array, pull, threshold, interval, max_events, debounce_threshold);
+
+    return MP_OBJ_FROM_PTR(self);
+    #else
+    mp_raise_NotImplementedError_varg(MP_ERROR_TEXT("%q"), MP_QSTR_TouchKeys);
+
+    #endif
+}
+
+#if CIRCUITPY_KEYPAD_TOUCHKEYS
+static void check_for_deinit(keypad_touchkeys_obj_t *self) {
+    if (common_hal_keypad_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+static size_t validate_key_number(keypad_touchkeys_obj_t *self, mp_obj_t key_number_in) {
+    check_for_deinit(self);
+    return (size_t)mp_arg_validate_int_range(mp_obj_get_int(key_number_in),
+        0, (mp_int_t)common_hal_keypad_generic_get_key_count(self) - 1, MP_QSTR_key_number);
+}
+
+//|     def deinit(self) -> None:
+//|         """Stop scanning and release the pins."""
+//|         ...
+//|
+static mp_obj_t keypad_touchkeys_deinit(mp_obj_t self_in) {
+    keypad_touchkeys_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    common_hal_keypad_touchkeys_deinit(self);
+    return MP_ROM_NONE;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(keypad_touchkeys_deinit_obj, keypad_touchkeys_deinit);
+
+//|     def __enter__(self) -> TouchKeys:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def raw_value(self, key_number: int) -> int:
+//|         """The smoothed reading of the given pad, as of the last scan. Compare with
+//|         `baseline()` when choosing a ``threshold``."""
+//|         ...
+//|
+static mp_obj_t keypad_touchkeys_raw_value(mp_obj_t self_in, mp_obj_t key_number_in) {
+    keypad_touchkeys_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t key_number = validate_key_number(self, key_number_in);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_keypad_touchkeys_get_raw_value(self, key_number));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(keypad_touchkeys_raw_value_obj, keypad_touchkeys_raw_value);
+
+//|     def baseline(self, key_number: int) -> int:
+//|         """The tracked untouched reading of the given pad."""
+//|         ...
+//|
+static mp_obj_t keypad_touchkeys_baseline(mp_obj_t self_in, mp_obj_t key_number_in) {
+    keypad_touchkeys_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t key_number = validate_key_number(self, key_number_in);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_keypad_touchkeys_get_baseline(self, key_number));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(keypad_touchkeys_baseline_obj, keypad_touchkeys_baseline);
+
+//|     def reset(self) -> None:
+//|         """Reset the internal state of the scanner to assume that all pads are now released.
+//|         Any pad that is already touched at the time of this call will therefore immediately cause
+//|         a new key-pressed event to occur.
+//|         """
+//|         ...
+//|
+
+//|     key_count: int
+//|     """The number of pads that are being scanned. (read-only)
+//|     """
+
+//|     events: EventQueue
+//|     """The `EventQueue` associated with this `TouchKeys` object. (read-only)
+//|     """
+//|
+//|
+static const mp_rom_map_elem_t keypad_touchkeys_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_deinit),       MP_ROM_PTR(&keypad_touchkeys_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__),    MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__),     MP_ROM_PTR(&default___exit___obj) },
+
+    { MP_ROM_QSTR(MP_QSTR_baseline),     MP_ROM_PTR(&keypad_touchkeys_baseline_obj) },
+    { MP_ROM_QSTR(MP_QSTR_events),       MP_ROM_PTR(&keypad_generic_events_obj) },
+    { MP_ROM_QSTR(MP_QSTR_key_count),    MP_ROM_PTR(&keypad_generic_key_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_raw_value),    MP_ROM_PTR(&keypad_touchkeys_raw_value_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reset),        MP_ROM_PTR(&keypad_generic_reset_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(keypad_touchkeys_locals_dict, keypad_touchkeys_locals_dict_table);
+#endif
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    keypad_touchkeys_type,
+    MP_QSTR_TouchKeys,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, keypad_touchkeys_make_new
+    #if CIRCUITPY_KEYPAD_TOUCHKEYS
+    , locals_dict, &keypad_touchkeys_locals_dict
+    #endif
+    );
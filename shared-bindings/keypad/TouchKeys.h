@@ -0,0 +1,21 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 CircuitPython contributors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "common-hal/microcontroller/Pin.h"
+#include "shared-bindings/digitalio/Pull.h"
+#include "shared-module/keypad/TouchKeys.h"
+
+extern const mp_obj_type_t keypad_touchkeys_type;
+
+// threshold of 0 uses each pad's own touchio.TouchIn threshold, relative to its first reading.
+void common_hal_keypad_touchkeys_construct(keypad_touchkeys_obj_t *self, mp_uint_t num_pins, const mcu_pin_obj_t *pins[], digitalio_pull_t pull, uint16_t threshold, mp_float_t interval, size_t max_events, uint8_t debounce_threshold);
+
+void common_hal_keypad_touchkeys_deinit(keypad_touchkeys_obj_t *self);
+
+uint16_t common_hal_keypad_touchkeys_get_raw_value(keypad_touchkeys_obj_t *self, size_t key_number);
+uint16_t common_hal_keypad_touchkeys_get_baseline(keypad_touchkeys_obj_t *self, size_t key_number);
@@ -12,6 +12,7 @@
 #include "shared-bindings/keypad/KeyMatrix.h"
 #include "shared-bindings/keypad/Keys.h"
 #include "shared-bindings/keypad/ShiftRegisterKeys.h"
+#include "shared-bindings/keypad/TouchKeys.h"
 #include "shared-bindings/util.h"
 
 static void check_for_deinit(keypad_keymatrix_obj_t *self) {
@@ -77,6 +78,7 @@ static mp_rom_map_elem_t keypad_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_KeyMatrix),         MP_OBJ_FROM_PTR(&keypad_keymatrix_type) },
     { MP_ROM_QSTR(MP_QSTR_Keys),              MP_OBJ_FROM_PTR(&keypad_keys_type) },
     { MP_ROM_QSTR(MP_QSTR_ShiftRegisterKeys), MP_OBJ_FROM_PTR(&keypad_shiftregisterkeys_type) },
+    { MP_ROM_QSTR(MP_QSTR_TouchKeys),         MP_OBJ_FROM_PTR(&keypad_touchkeys_type) },
 };
 
 static MP_DEFINE_CONST_DICT(keypad_module_globals, keypad_module_globals_table);
@@ -19,11 +19,24 @@
 //| class OnDiskFont:
 //|     """A font built into CircuitPython for use with LVGL"""
 //|
-//|     def __init__(self, file_path: str, max_glyphs: int = 100) -> None:
+//|     def __init__(
+//|         self,
+//|         file_path: str,
+//|         max_glyphs: int = 100,
+//|         *,
+//|         preload: Optional[Union[str, Iterable[int]]] = None,
+//|     ) -> None:
 //|         """Create a OnDiskFont by loading an LVGL font file from the filesystem.
 //|
+//|         Glyphs are read from the file the first time they are shown and kept in the cache
+//|         bitmap. Once the cache is full, the least recently used glyph that isn't being
+//|         shown is replaced.
+//|
 //|         :param str file_path: The path to the font file
-//|         :param int max_glyphs: Maximum number of glyphs to cache at once
+//|         :param int max_glyphs: Maximum number of glyphs to cache at once. The cache uses
+//|           ``max_glyphs`` glyph cells of bitmap memory plus 10 bytes of bookkeeping per glyph.
+//|         :param preload: Characters, or codepoints such as a `range`, to load into the cache
+//|           now instead of when they are first shown
 //|         """
 //|         ...
 //|
@@ -59,10 +72,11 @@ static const mp_rom_map_elem_t lvfontio_ondiskfont_locals_dict_table[] = {
 static MP_DEFINE_CONST_DICT(lvfontio_ondiskfont_locals_dict, lvfontio_ondiskfont_locals_dict_table);
 
 static mp_obj_t lvfontio_ondiskfont_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_file_path, ARG_max_glyphs };
+    enum { ARG_file_path, ARG_max_glyphs, ARG_preload };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_file_path, MP_ARG_OBJ | MP_ARG_REQUIRED },
         { MP_QSTR_max_glyphs, MP_ARG_INT, {.u_int = 100} },
+        { MP_QSTR_preload, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -82,6 +96,22 @@ static mp_obj_t lvfontio_ondiskfont_make_new(const mp_obj_type_t *type, size_t n
     // Always use GC allocator for Python-created objects
     common_hal_lvfontio_ondiskfont_construct(self, file_path, max_glyphs, true);
 
+    mp_obj_t preload = args[ARG_preload].u_obj;
+    if (mp_obj_is_str(preload)) {
+        GET_STR_DATA_LEN(preload, str, len);
+        const byte *s = str;
+        while (s < str + len) {
+            common_hal_lvfontio_ondiskfont_preload_glyph(self, utf8_get_char(s));
+            s = utf8_next_char(s);
+        }
+    } else if (preload != mp_const_none) {
+        mp_obj_t iterable = mp_getiter(preload, NULL);
+        mp_obj_t item;
+        while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+            common_hal_lvfontio_ondiskfont_preload_glyph(self, mp_obj_get_int(item));
+        }
+    }
+
     return MP_OBJ_FROM_PTR(self);
 }
 
@@ -116,27 +116,33 @@ MP_PROPERTY_GETSET(mdns_server_instance_name_obj,
 
 
 //|     def find(
-//|         self, service_type: str, protocol: str, *, timeout: float = 1
+//|         self, service_type: str, protocol: str, *, timeout: float = 1, cached: bool = False
 //|     ) -> Tuple[RemoteService]:
 //|         """Find all locally available remote services with the given service type and protocol.
 //|
 //|         This doesn't allow for direct hostname lookup. To do that, use
 //|         `socketpool.SocketPool.getaddrinfo()`.
 //|
+//|         The results of the most recent search are remembered until the shortest time-to-live
+//|         of their records runs out.
+//|
 //|         :param str service_type: The service type such as "_http"
 //|         :param str protocol: The service protocol such as "_tcp"
-//|         :param float/int timeout: Time to wait for responses"""
+//|         :param float/int timeout: Time to wait for responses
+//|         :param bool cached: Return the remembered results right away, without querying, when
+//|             they are for the same ``service_type`` and ``protocol`` and haven't expired"""
 //|         ...
 //|
 static mp_obj_t _mdns_server_find(mp_uint_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     mdns_server_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
     check_for_deinit(self);
 
-    enum { ARG_service_type, ARG_protocol, ARG_timeout };
+    enum { ARG_service_type, ARG_protocol, ARG_timeout, ARG_cached };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_service_type, MP_ARG_KW_ONLY | MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_protocol, MP_ARG_KW_ONLY | MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_timeout, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NEW_SMALL_INT(1)} },
+        { MP_QSTR_cached, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -146,10 +152,65 @@ static mp_obj_t _mdns_server_find(mp_uint_t n_args, const mp_obj_t *pos_args, mp
     const char *service_type = mp_obj_str_get_str(args[ARG_service_type].u_obj);
     const char *protocol = mp_obj_str_get_str(args[ARG_protocol].u_obj);
 
-    return common_hal_mdns_server_find(self, service_type, protocol, timeout);
+    return common_hal_mdns_server_find(self, service_type, protocol, timeout, args[ARG_cached].u_bool);
 }
 static MP_DEFINE_CONST_FUN_OBJ_KW(mdns_server_find_obj, 1, _mdns_server_find);
 
+//|     def browse(self, service_type: str, protocol: str, *, timeout: float = 1) -> None:
+//|         """Start finding remote services with the given service type and protocol in the
+//|         background and return immediately. Collect them with `browse_results()`.
+//|
+//|         Services remembered from an earlier search that haven't expired are returned first,
+//|         before any new responses arrive. Starting a browse stops any browse already running.
+//|
+//|         :param str service_type: The service type such as "_http"
+//|         :param str protocol: The service protocol such as "_tcp"
+//|         :param float/int timeout: Time to keep collecting responses"""
+//|         ...
+//|
+static mp_obj_t mdns_server_browse(mp_uint_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    mdns_server_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+
+    enum { ARG_service_type, ARG_protocol, ARG_timeout };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_service_type, MP_ARG_KW_ONLY | MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_protocol, MP_ARG_KW_ONLY | MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_timeout, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NEW_SMALL_INT(1)} },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_float_t timeout = mp_obj_get_float(args[ARG_timeout].u_obj);
+    const char *service_type = mp_obj_str_get_str(args[ARG_service_type].u_obj);
+    const char *protocol = mp_obj_str_get_str(args[ARG_protocol].u_obj);
+
+    common_hal_mdns_server_browse(self, service_type, protocol, timeout);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(mdns_server_browse_obj, 1, mdns_server_browse);
+
+//|     def browse_results(self) -> Optional[Tuple[RemoteService]]:
+//|         """Return the services found by `browse()` since the last call, which may be an empty
+//|         tuple, or None once the browse has finished and everything it found has been returned.
+//|         It never blocks, so it can be polled from an `asyncio` task::
+//|
+//|             server.browse(service_type="_http", protocol="_tcp")
+//|             while (services := server.browse_results()) is not None:
+//|                 for service in services:
+//|                     print(service.instance_name)
+//|                 await asyncio.sleep(0.05)
+//|         """
+//|         ...
+//|
+static mp_obj_t mdns_server_browse_results(mp_obj_t self_in) {
+    mdns_server_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return common_hal_mdns_server_browse_results(self);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(mdns_server_browse_results_obj, mdns_server_browse_results);
+
 //|     def advertise_service(self, *, service_type: str, protocol: str, port: int) -> None:
 //|         """Respond to queries for the given service with the given port.
 //|
@@ -211,6 +272,8 @@ static const mp_rom_map_elem_t mdns_server_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_instance_name),     MP_ROM_PTR(&mdns_server_instance_name_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_find),              MP_ROM_PTR(&mdns_server_find_obj) },
+    { MP_ROM_QSTR(MP_QSTR_browse),            MP_ROM_PTR(&mdns_server_browse_obj) },
+    { MP_ROM_QSTR(MP_QSTR_browse_results),    MP_ROM_PTR(&mdns_server_browse_results_obj) },
     { MP_ROM_QSTR(MP_QSTR_advertise_service), MP_ROM_PTR(&mdns_server_advertise_service_obj) },
 
     { MP_ROM_QSTR(MP_QSTR___del__),           MP_ROM_PTR(&mdns_server_deinit_obj) },
@@ -21,7 +21,9 @@ const char *common_hal_mdns_server_get_hostname(mdns_server_obj_t *self);
 void common_hal_mdns_server_set_hostname(mdns_server_obj_t *self, const char *hostname);
 const char *common_hal_mdns_server_get_instance_name(mdns_server_obj_t *self);
 void common_hal_mdns_server_set_instance_name(mdns_server_obj_t *self, const char *instance_name);
-mp_obj_t common_hal_mdns_server_find(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_float_t timeout);
+mp_obj_t common_hal_mdns_server_find(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_float_t timeout, bool cached);
+void common_hal_mdns_server_browse(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_float_t timeout);
+mp_obj_t common_hal_mdns_server_browse_results(mdns_server_obj_t *self);
 
 /**
  * @brief Advertises service
@@ -5,3 +5,8 @@
 // SPDX-License-Identifier: MIT
 
 #pragma once
+
+// Drop remembered search results and stop any browse started by user code.
+void mdns_user_reset(void);
+// Mark the remembered search results and in-progress browse results.
+void mdns_gc_collect(void);
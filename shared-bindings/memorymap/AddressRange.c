@@ -116,7 +116,85 @@ static mp_obj_t memorymap_addressrange_unary_op(mp_unary_op_t op, mp_obj_t self_
     }
 }
 
+// Checks a bulk transfer of len bytes at offset and returns the access width.
+static size_t validate_transfer(memorymap_addressrange_obj_t *self, mp_int_t offset, mp_int_t width, size_t len) {
+    if (width != 1 && width != 2 && width != 4) {
+        mp_arg_error_invalid(MP_QSTR_width);
+    }
+    if (len % width != 0) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Buffer must be a multiple of %d bytes"), (int)width);
+    }
+    size_t length = common_hal_memorymap_addressrange_get_length(self);
+    mp_arg_validate_length_max(len, length, MP_QSTR_buffer);
+    mp_arg_validate_int_range(offset, 0, length - len, MP_QSTR_offset);
+    return width;
+}
+
+//|     def readinto(self, buffer: WriteableBuffer, *, offset: int = 0, width: int = 1) -> None:
+//|         """Read ``len(buffer)`` bytes starting at ``offset`` into ``buffer``.
+//|
+//|         Each element is read with a single access of ``width`` bytes (1, 2 or 4), in
+//|         ascending address order, so registers see exactly the access size requested.
+//|         The address at ``offset`` must be a multiple of ``width`` and the buffer length
+//|         must be a multiple of ``width``.
+//|
+//|         :param WriteableBuffer buffer: buffer to read into
+//|         :param int offset: offset into the address range to start reading from
+//|         :param int width: bytes per access"""
+//|         ...
+//|
+static mp_obj_t memorymap_addressrange_readinto(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_offset, ARG_width };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_offset, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_width, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 1} },
+    };
+    memorymap_addressrange_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_WRITE);
+    size_t width = validate_transfer(self, args[ARG_offset].u_int, args[ARG_width].u_int, bufinfo.len);
+    common_hal_memorymap_addressrange_readinto(self, args[ARG_offset].u_int, width, bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(memorymap_addressrange_readinto_obj, 1, memorymap_addressrange_readinto);
+
+//|     def write(self, buffer: ReadableBuffer, *, offset: int = 0, width: int = 1) -> None:
+//|         """Write the contents of ``buffer`` starting at ``offset``.
+//|
+//|         Each element is written with a single access of ``width`` bytes (1, 2 or 4), in
+//|         ascending address order. The same alignment rules as `readinto` apply.
+//|
+//|         :param ReadableBuffer buffer: buffer to write from
+//|         :param int offset: offset into the address range to start writing at
+//|         :param int width: bytes per access"""
+//|         ...
+//|
+static mp_obj_t memorymap_addressrange_write(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_offset, ARG_width };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_offset, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_width, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 1} },
+    };
+    memorymap_addressrange_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ);
+    size_t width = validate_transfer(self, args[ARG_offset].u_int, args[ARG_width].u_int, bufinfo.len);
+    common_hal_memorymap_addressrange_write(self, args[ARG_offset].u_int, width, bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(memorymap_addressrange_write_obj, 1, memorymap_addressrange_write);
+
 static const mp_rom_map_elem_t memorymap_addressrange_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&memorymap_addressrange_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&memorymap_addressrange_write_obj) },
 };
 
 static MP_DEFINE_CONST_DICT(memorymap_addressrange_locals_dict, memorymap_addressrange_locals_dict_table);
@@ -21,3 +21,11 @@ void common_hal_memorymap_addressrange_set_bytes(const memorymap_addressrange_ob
 // also leverage the compiler to validate uses are expected.
 void common_hal_memorymap_addressrange_get_bytes(const memorymap_addressrange_obj_t *self,
     size_t start_index, size_t len, uint8_t *values);
+
+// Transfer len bytes using volatile accesses of exactly width bytes (1, 2 or
+// 4) in ascending address order. The caller checks that the transfer fits in
+// the range and that len is a multiple of width.
+void common_hal_memorymap_addressrange_write(const memorymap_addressrange_obj_t *self,
+    size_t start_index, size_t width, const uint8_t *values, size_t len);
+void common_hal_memorymap_addressrange_readinto(const memorymap_addressrange_obj_t *self,
+    size_t start_index, size_t width, uint8_t *values, size_t len);
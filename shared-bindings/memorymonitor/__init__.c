@@ -10,6 +10,7 @@
 #include "py/runtime.h"
 
 #include "shared-bindings/memorymonitor/__init__.h"
+#include "shared-module/memorymonitor/__init__.h"
 #include "shared-bindings/memorymonitor/AllocationAlarm.h"
 #include "shared-bindings/memorymonitor/AllocationSize.h"
 
@@ -33,10 +34,76 @@ NORETURN void mp_raise_memorymonitor_AllocationError(mp_rom_error_text_t fmt, ..
     nlr_raise(exception);
 }
 
+//| def gc_count() -> int:
+//|     """Number of garbage collections since the VM started."""
+//|     ...
+//|
+static mp_obj_t memorymonitor_gc_count(void) {
+    return mp_obj_new_int_from_uint(common_hal_memorymonitor_gc_count());
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(memorymonitor_gc_count_obj, memorymonitor_gc_count);
+
+//| def gc_history(buffer: WriteableBuffer) -> int:
+//|     """Copies the most recent garbage collections into ``buffer``, oldest first, and
+//|     returns how many were copied. Up to 8 collections are kept.
+//|
+//|     Each collection is five values: mark time in microseconds, sweep time in microseconds,
+//|     blocks freed, the largest free run in blocks after the sweep and the fragmentation of the
+//|     free space in thousandths (0 when all free blocks are contiguous).
+//|
+//|     ``buffer`` must have 4 byte items, such as ``array.array("I", [0] * 40)``. This doesn't
+//|     allocate, so it can be called right after a frame is late::
+//|
+//|       import array
+//|       import memorymonitor
+//|
+//|       history = array.array("I", [0] * 40)
+//|       for i in range(memorymonitor.gc_history(history)):
+//|           mark_us, sweep_us, freed, max_free, fragmentation = history[i * 5 : i * 5 + 5]
+//|     """
+//|     ...
+//|
+//|
+static mp_obj_t memorymonitor_gc_history(mp_obj_t buffer_in) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_WRITE);
+    if (bufinfo.typecode != 'I') {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be array of type 'I'"), MP_QSTR_buffer);
+    }
+    size_t max_records = bufinfo.len / sizeof(memorymonitor_gc_record_t);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_memorymonitor_gc_history(bufinfo.buf, max_records));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(memorymonitor_gc_history_obj, memorymonitor_gc_history);
+
+//| def gc_stack_overflows() -> Tuple[int, int]:
+//|     """Counts how often the garbage collector's mark stack overflowed since the VM started.
+//|
+//|     Returns a tuple of two values: the number of collections that continued marking on a
+//|     larger stack borrowed from free memory, and the number of times the whole heap had to be
+//|     rescanned instead. Rescans are slow on deeply nested data when little memory is free.
+//|     """
+//|     ...
+//|
+//|
+static mp_obj_t memorymonitor_gc_stack_overflows(void) {
+    uint32_t borrows;
+    uint32_t rescans;
+    common_hal_memorymonitor_gc_stack_overflows(&borrows, &rescans);
+    mp_obj_t items[] = {
+        mp_obj_new_int_from_uint(borrows),
+        mp_obj_new_int_from_uint(rescans),
+    };
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(memorymonitor_gc_stack_overflows_obj, memorymonitor_gc_stack_overflows);
+
 static const mp_rom_map_elem_t memorymonitor_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_memorymonitor) },
     { MP_ROM_QSTR(MP_QSTR_AllocationAlarm), MP_ROM_PTR(&memorymonitor_allocationalarm_type) },
     { MP_ROM_QSTR(MP_QSTR_AllocationSize), MP_ROM_PTR(&memorymonitor_allocationsize_type) },
+    { MP_ROM_QSTR(MP_QSTR_gc_count), MP_ROM_PTR(&memorymonitor_gc_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_gc_history), MP_ROM_PTR(&memorymonitor_gc_history_obj) },
+    { MP_ROM_QSTR(MP_QSTR_gc_stack_overflows), MP_ROM_PTR(&memorymonitor_gc_stack_overflows_obj) },
 
     // Errors
     { MP_ROM_QSTR(MP_QSTR_AllocationError),      MP_ROM_PTR(&mp_type_memorymonitor_AllocationError) },
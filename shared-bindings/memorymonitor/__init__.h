@@ -24,3 +24,7 @@ void memorymonitor_exception_print(const mp_print_t *print, mp_obj_t o_in, mp_pr
 extern const mp_obj_type_t mp_type_memorymonitor_AllocationError;
 
 NORETURN void mp_raise_memorymonitor_AllocationError(mp_rom_error_text_t msg, ...);
+
+uint32_t common_hal_memorymonitor_gc_count(void);
+size_t common_hal_memorymonitor_gc_history(uint32_t *buf, size_t max_records);
+void common_hal_memorymonitor_gc_stack_overflows(uint32_t *borrows, uint32_t *rescans);
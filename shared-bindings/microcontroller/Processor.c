@@ -84,6 +84,43 @@ MP_PROPERTY_GETTER(mcu_processor_frequency_obj,
     (mp_obj_t)&mcu_processor_get_frequency_obj);
 #endif
 
+//|     idle_frequency: Optional[int]
+//|     """The CPU frequency in Hertz to drop to while idle, or ``None`` to always
+//|     run at `frequency`.
+//|
+//|     When set, the clock is scaled with load: it runs at `frequency` while code,
+//|     USB, displays or audio are busy and drops to ``idle_frequency`` while waiting,
+//|     such as in `time.sleep()` or an asyncio loop with nothing to do. Peripherals
+//|     whose timing depends on the clock (UART, PWM, I2S and so on) hold it at the
+//|     speed they need while they are in use.
+//|
+//|     **Limitations:** Only available on ESP32 boards where `frequency` is settable.
+//|     """
+
+#if CIRCUITPY_PROCESSOR_IDLE_FREQUENCY
+static mp_obj_t mcu_processor_get_idle_frequency(mp_obj_t self) {
+    uint32_t frequency = common_hal_mcu_processor_get_idle_frequency();
+    return frequency == 0 ? mp_const_none : mp_obj_new_int_from_uint(frequency);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(mcu_processor_get_idle_frequency_obj, mcu_processor_get_idle_frequency);
+
+static mp_obj_t mcu_processor_set_idle_frequency(mp_obj_t self, mp_obj_t freq) {
+    uint32_t value_of_freq = 0;
+    if (freq != mp_const_none) {
+        value_of_freq = (uint32_t)mp_arg_validate_int_min(mp_obj_get_int(freq), 1, MP_QSTR_idle_frequency);
+    }
+    common_hal_mcu_processor_set_idle_frequency(self, value_of_freq);
+    return mp_const_none;
+}
+
+MP_DEFINE_CONST_FUN_OBJ_2(mcu_processor_set_idle_frequency_obj, mcu_processor_set_idle_frequency);
+
+MP_PROPERTY_GETSET(mcu_processor_idle_frequency_obj,
+    (mp_obj_t)&mcu_processor_get_idle_frequency_obj,
+    (mp_obj_t)&mcu_processor_set_idle_frequency_obj);
+#endif
+
 //|     reset_reason: microcontroller.ResetReason
 //|     """The reason the microcontroller started up from reset state."""
 static mp_obj_t mcu_processor_get_reset_reason(mp_obj_t self) {
@@ -144,6 +181,9 @@ MP_PROPERTY_GETTER(mcu_processor_voltage_obj,
 
 static const mp_rom_map_elem_t mcu_processor_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_frequency), MP_ROM_PTR(&mcu_processor_frequency_obj) },
+    #if CIRCUITPY_PROCESSOR_IDLE_FREQUENCY
+    { MP_ROM_QSTR(MP_QSTR_idle_frequency), MP_ROM_PTR(&mcu_processor_idle_frequency_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_reset_reason), MP_ROM_PTR(&mcu_processor_reset_reason_obj) },
     { MP_ROM_QSTR(MP_QSTR_temperature), MP_ROM_PTR(&mcu_processor_temperature_obj) },
     { MP_ROM_QSTR(MP_QSTR_uid), MP_ROM_PTR(&mcu_processor_uid_obj) },
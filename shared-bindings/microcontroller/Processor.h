@@ -19,3 +19,6 @@ float common_hal_mcu_processor_get_temperature(void);
 void common_hal_mcu_processor_get_uid(uint8_t raw_id[]);
 float common_hal_mcu_processor_get_voltage(void);
 void common_hal_mcu_processor_set_frequency(mcu_processor_obj_t *self, uint32_t frequency);
+// An idle frequency of 0 means the CPU always runs at the set frequency.
+uint32_t common_hal_mcu_processor_get_idle_frequency(void);
+void common_hal_mcu_processor_set_idle_frequency(mcu_processor_obj_t *self, uint32_t frequency);
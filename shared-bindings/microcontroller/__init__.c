@@ -18,6 +18,7 @@
 #include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/microcontroller/Processor.h"
+#include "supervisor/shared/serial.h"
 
 //| """Pin references and cpu functionality
 //|
@@ -119,6 +120,7 @@ static MP_DEFINE_CONST_FUN_OBJ_1(mcu_on_next_reset_obj, mcu_on_next_reset);
 //|
 //|
 static mp_obj_t mcu_reset(void) {
+    serial_flush_output();
     common_hal_mcu_reset();
     // We won't actually get here because we're resetting.
     return mp_const_none;
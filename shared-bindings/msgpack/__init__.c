@@ -87,8 +87,8 @@
 static mp_obj_t mod_msgpack_pack(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_obj, ARG_buffer, ARG_default };
     static const mp_arg_t allowed_args[] = {
-        { MP_QSTR_obj, MP_ARG_REQUIRED | MP_ARG_OBJ },
-        { MP_QSTR_stream, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_obj, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_stream, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
         { MP_QSTR_default, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = mp_const_none } },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -105,6 +105,13 @@ static mp_obj_t mod_msgpack_pack(size_t n_args, const mp_obj_t *pos_args, mp_map
 MP_DEFINE_CONST_FUN_OBJ_KW(mod_msgpack_pack_obj, 0, mod_msgpack_pack);
 
 
+static mp_obj_t validate_ext_hook(mp_obj_t hook) {
+    if (hook != mp_const_none && !mp_obj_is_fun(hook) && !MP_OBJ_IS_METH(hook)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("ext_hook is not a function"));
+    }
+    return hook;
+}
+
 //| def unpack(
 //|     stream: circuitpython_typing.ByteStream,
 //|     *,
@@ -126,28 +133,69 @@ MP_DEFINE_CONST_FUN_OBJ_KW(mod_msgpack_pack_obj, 0, mod_msgpack_pack);
 static mp_obj_t mod_msgpack_unpack(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_buffer, ARG_ext_hook, ARG_use_list };
     static const mp_arg_t allowed_args[] = {
-        { MP_QSTR_stream, MP_ARG_REQUIRED | MP_ARG_OBJ, },
+        { MP_QSTR_stream, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
         { MP_QSTR_ext_hook, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = mp_const_none } },
         { MP_QSTR_use_list, MP_ARG_KW_ONLY | MP_ARG_BOOL, { .u_bool = true } },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
-    mp_obj_t hook = args[ARG_ext_hook].u_obj;
-    if (hook != mp_const_none && !mp_obj_is_fun(hook) && !MP_OBJ_IS_METH(hook)) {
-        mp_raise_ValueError(MP_ERROR_TEXT("ext_hook is not a function"));
-    }
-
+    mp_obj_t hook = validate_ext_hook(args[ARG_ext_hook].u_obj);
     return common_hal_msgpack_unpack(args[ARG_buffer].u_obj, hook, args[ARG_use_list].u_bool);
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(mod_msgpack_unpack_obj, 0, mod_msgpack_unpack);
 
 
+//| def unpack_from(
+//|     buffer: circuitpython_typing.ReadableBuffer,
+//|     offset: int = 0,
+//|     *,
+//|     ext_hook: Union[Callable[[int, bytes], object], None] = None,
+//|     use_list: bool = True,
+//| ) -> object:
+//|     """Unpack and return one object from buffer, starting at offset.
+//|
+//|     This reads straight from the buffer instead of through a stream and copies less:
+//|     bin values are returned as memoryview slices of the buffer, which must not be changed
+//|     while they are in use, and arrays whose elements are all ints of up to 32 bits or all
+//|     floats are returned as an `array.array` of the smallest type that holds them, instead
+//|     of as a list or tuple. str values and ext payloads are still copied.
+//|
+//|     :param ~circuitpython_typing.ReadableBuffer buffer: buffer to read from
+//|     :param int offset: where in the buffer the object starts
+//|     :param Optional[~circuitpython_typing.Callable[[int, bytes], object]] ext_hook: function called for objects in
+//|            msgpack ext format.
+//|     :param Optional[bool] use_list: return other arrays as list or tuple (use_list=False).
+//|
+//|     :return object: object read from buffer.
+//|     """
+//|     ...
+//|
+//|
+static mp_obj_t mod_msgpack_unpack_from(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_offset, ARG_ext_hook, ARG_use_list };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_offset, MP_ARG_INT, { .u_int = 0 } },
+        { MP_QSTR_ext_hook, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = mp_const_none } },
+        { MP_QSTR_use_list, MP_ARG_KW_ONLY | MP_ARG_BOOL, { .u_bool = true } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t offset = mp_arg_validate_int_min(args[ARG_offset].u_int, 0, MP_QSTR_offset);
+    mp_obj_t hook = validate_ext_hook(args[ARG_ext_hook].u_obj);
+    return common_hal_msgpack_unpack_from(args[ARG_buffer].u_obj, offset, hook, args[ARG_use_list].u_bool);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(mod_msgpack_unpack_from_obj, 0, mod_msgpack_unpack_from);
+
+
 static const mp_rom_map_elem_t msgpack_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_msgpack) },
     { MP_ROM_QSTR(MP_QSTR_ExtType), MP_ROM_PTR(&mod_msgpack_exttype_type) },
     { MP_ROM_QSTR(MP_QSTR_pack), MP_ROM_PTR(&mod_msgpack_pack_obj) },
     { MP_ROM_QSTR(MP_QSTR_unpack), MP_ROM_PTR(&mod_msgpack_unpack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack_from), MP_ROM_PTR(&mod_msgpack_unpack_from_obj) },
 };
 
 static MP_DEFINE_CONST_DICT(msgpack_module_globals, msgpack_module_globals_table);
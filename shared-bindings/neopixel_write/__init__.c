@@ -11,6 +11,10 @@
 #include "shared-bindings/digitalio/DigitalInOut.h"
 #include "shared-bindings/util.h"
 
+#if CIRCUITPY_PIXELBUF
+#include "shared-bindings/adafruit_pixelbuf/PixelBuf.h"
+#endif
+
 // RGB LED timing information:
 
 // From the WS2811 datasheet: high speed mode
@@ -85,33 +89,165 @@ static void check_for_deinit(digitalio_digitalinout_obj_t *self) {
 //| """
 //|
 //|
-//| def neopixel_write(digitalinout: digitalio.DigitalInOut, buf: ReadableBuffer) -> None:
+//| def neopixel_write(
+//|     digitalinout: digitalio.DigitalInOut, buf: ReadableBuffer, *, background: bool = False
+//| ) -> None:
 //|     """Write buf out on the given DigitalInOut.
 //|
+//|     A write waits for any background write before it to finish.
+//|
 //|     :param ~digitalio.DigitalInOut digitalinout: the DigitalInOut to output with
 //|     :param ~circuitpython_typing.ReadableBuffer buf: The bytes to clock out. No assumption is made about color order
+//|     :param bool background: When True, return as soon as the write has started, where the port
+//|         supports it, so that the next frame can be computed while this one goes out. ``buf``
+//|         must not be changed until `busy` is False.
 //|     """
 //|     ...
 //|
 //|
-static mp_obj_t neopixel_write_neopixel_write_(mp_obj_t digitalinout_obj, mp_obj_t buf) {
+static mp_obj_t neopixel_write_neopixel_write_(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_digitalinout, ARG_buf, ARG_background };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_digitalinout, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_buf, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_background, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
     const digitalio_digitalinout_obj_t *digitalinout =
-        mp_arg_validate_type(digitalinout_obj, &digitalio_digitalinout_type, MP_QSTR_digitalinout);
+        mp_arg_validate_type(args[ARG_digitalinout].u_obj, &digitalio_digitalinout_type, MP_QSTR_digitalinout);
 
     // Check to see if the NeoPixel has been deinited before writing to it.
-    check_for_deinit(digitalinout_obj);
+    check_for_deinit(args[ARG_digitalinout].u_obj);
 
     mp_buffer_info_t bufinfo;
-    mp_get_buffer_raise(buf, &bufinfo, MP_BUFFER_READ);
+    mp_get_buffer_raise(args[ARG_buf].u_obj, &bufinfo, MP_BUFFER_READ);
+
+    // Finish the last background write before letting go of its buffer.
+    common_hal_neopixel_write_wait();
+    MP_STATE_VM(neopixel_write_buffer) = MP_OBJ_NULL;
+
     // Call platform's neopixel write function with provided buffer and options.
-    common_hal_neopixel_write(digitalinout, (uint8_t *)bufinfo.buf, bufinfo.len);
+    if (args[ARG_background].u_bool) {
+        // Keep the buffer alive while it's written.
+        MP_STATE_VM(neopixel_write_buffer) = args[ARG_buf].u_obj;
+        common_hal_neopixel_write_background(digitalinout, (uint8_t *)bufinfo.buf, bufinfo.len);
+    } else {
+        common_hal_neopixel_write(digitalinout, (uint8_t *)bufinfo.buf, bufinfo.len);
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(neopixel_write_neopixel_write_obj, 2, neopixel_write_neopixel_write_);
+
+//| def neopixel_write_parallel(
+//|     digitalinouts: Sequence[digitalio.DigitalInOut],
+//|     bufs: Sequence[ReadableBuffer | adafruit_pixelbuf.PixelBuf],
+//| ) -> None:
+//|     """Write each of bufs out on the DigitalInOut at the same index, all at the same time, so
+//|     that a frame for several strips takes as long as the longest strip instead of all of them
+//|     together.
+//|
+//|     Where the port supports it, the pins must be consecutive and in order, such as
+//|     GP0, GP1, GP2 and GP3, to be written at the same time. Otherwise the strips are written one
+//|     after another.
+//|
+//|     :param Sequence[~digitalio.DigitalInOut] digitalinouts: the DigitalInOuts to output with, up to 32
+//|     :param Sequence bufs: The bytes to clock out on each, or `adafruit_pixelbuf.PixelBuf` objects
+//|         to send what their ``show`` would. They may have different lengths.
+//|     """
+//|     ...
+//|
+//|
+static mp_obj_t neopixel_write_neopixel_write_parallel(mp_obj_t digitalinouts_obj, mp_obj_t bufs_obj) {
+    size_t count;
+    mp_obj_t *digitalinout_items;
+    mp_obj_get_array(digitalinouts_obj, &count, &digitalinout_items);
+    mp_arg_validate_length_range(count, 1, NEOPIXEL_WRITE_PARALLEL_MAX, MP_QSTR_digitalinouts);
+    size_t buf_count;
+    mp_obj_t *buf_items;
+    mp_obj_get_array(bufs_obj, &buf_count, &buf_items);
+    mp_arg_validate_length(buf_count, count, MP_QSTR_bufs);
+
+    const digitalio_digitalinout_obj_t *digitalinouts[NEOPIXEL_WRITE_PARALLEL_MAX];
+    uint8_t *pixels[NEOPIXEL_WRITE_PARALLEL_MAX];
+    uint32_t num_bytes[NEOPIXEL_WRITE_PARALLEL_MAX];
+    for (size_t i = 0; i < count; i++) {
+        digitalinouts[i] = mp_arg_validate_type(digitalinout_items[i], &digitalio_digitalinout_type, MP_QSTR_digitalinouts);
+        check_for_deinit((digitalio_digitalinout_obj_t *)digitalinouts[i]);
+
+        mp_obj_t buf = buf_items[i];
+        #if CIRCUITPY_PIXELBUF
+        if (mp_obj_cast_to_native_base(buf, MP_OBJ_FROM_PTR(&pixelbuf_pixelbuf_type)) != MP_OBJ_NULL) {
+            buf = common_hal_adafruit_pixelbuf_pixelbuf_get_transmit_buffer(buf);
+        }
+        #endif
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(buf, &bufinfo, MP_BUFFER_READ);
+        pixels[i] = bufinfo.buf;
+        num_bytes[i] = bufinfo.len;
+    }
+
+    common_hal_neopixel_write_wait();
+    MP_STATE_VM(neopixel_write_buffer) = MP_OBJ_NULL;
+    common_hal_neopixel_write_parallel(digitalinouts, pixels, num_bytes, count);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(neopixel_write_neopixel_write_parallel_obj, neopixel_write_neopixel_write_parallel);
+
+//| def busy() -> bool:
+//|     """True while a background write is still going out."""
+//|     ...
+//|
+//|
+static mp_obj_t neopixel_write_busy(void) {
+    return mp_obj_new_bool(common_hal_neopixel_write_busy());
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(neopixel_write_busy_obj, neopixel_write_busy);
+
+//| def wait() -> None:
+//|     """Wait for a background write to finish."""
+//|     ...
+//|
+//|
+static mp_obj_t neopixel_write_wait(void) {
+    common_hal_neopixel_write_wait();
     return mp_const_none;
 }
-static MP_DEFINE_CONST_FUN_OBJ_2(neopixel_write_neopixel_write_obj, neopixel_write_neopixel_write_);
+static MP_DEFINE_CONST_FUN_OBJ_0(neopixel_write_wait_obj, neopixel_write_wait);
+
+bool shared_bindings_neopixel_write_is_writing(mp_obj_t buffer) {
+    return MP_STATE_VM(neopixel_write_buffer) == buffer && common_hal_neopixel_write_busy();
+}
+
+void neopixel_write_reset(void) {
+    common_hal_neopixel_write_wait();
+    MP_STATE_VM(neopixel_write_buffer) = MP_OBJ_NULL;
+}
+
+MP_WEAK void common_hal_neopixel_write_background(const digitalio_digitalinout_obj_t *digitalinout, uint8_t *pixels, uint32_t num_bytes) {
+    common_hal_neopixel_write(digitalinout, pixels, num_bytes);
+}
+
+MP_WEAK void common_hal_neopixel_write_parallel(const digitalio_digitalinout_obj_t **digitalinouts, uint8_t **pixels, const uint32_t *num_bytes, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        common_hal_neopixel_write(digitalinouts[i], pixels[i], num_bytes[i]);
+    }
+}
+
+MP_WEAK bool common_hal_neopixel_write_busy(void) {
+    return false;
+}
+
+MP_WEAK void common_hal_neopixel_write_wait(void) {
+}
 
 static const mp_rom_map_elem_t neopixel_write_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_OBJ_NEW_QSTR(MP_QSTR_neopixel_write) },
     { MP_ROM_QSTR(MP_QSTR_neopixel_write), (mp_obj_t)&neopixel_write_neopixel_write_obj },
+    { MP_ROM_QSTR(MP_QSTR_neopixel_write_parallel), (mp_obj_t)&neopixel_write_neopixel_write_parallel_obj },
+    { MP_ROM_QSTR(MP_QSTR_busy), (mp_obj_t)&neopixel_write_busy_obj },
+    { MP_ROM_QSTR(MP_QSTR_wait), (mp_obj_t)&neopixel_write_wait_obj },
 };
 
 static MP_DEFINE_CONST_DICT(neopixel_write_module_globals, neopixel_write_module_globals_table);
@@ -122,3 +258,5 @@ const mp_obj_module_t neopixel_write_module = {
 };
 
 MP_REGISTER_MODULE(MP_QSTR_neopixel_write, neopixel_write_module);
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t neopixel_write_buffer);
@@ -9,6 +9,23 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "py/obj.h"
 #include "common-hal/digitalio/DigitalInOut.h"
 
 extern void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *gpio, uint8_t *pixels, uint32_t numBytes);
+
+// Starts writing pixels and may return before it's done. pixels must stay as they are until
+// common_hal_neopixel_write_busy() is false. Every write waits for the one before it to finish.
+// Ports without a way to write in the background write before returning.
+extern void common_hal_neopixel_write_background(const digitalio_digitalinout_obj_t *gpio, uint8_t *pixels, uint32_t numBytes);
+extern bool common_hal_neopixel_write_busy(void);
+// Writes each pixels[i] on digitalinouts[i] at the same time where the port can, and one after
+// another otherwise.
+extern void common_hal_neopixel_write_parallel(const digitalio_digitalinout_obj_t **digitalinouts, uint8_t **pixels, const uint32_t *num_bytes, size_t count);
+extern void common_hal_neopixel_write_wait(void);
+
+// True while buffer is being written in the background.
+bool shared_bindings_neopixel_write_is_writing(mp_obj_t buffer);
+void neopixel_write_reset(void);
+
+#define NEOPIXEL_WRITE_PARALLEL_MAX (32)
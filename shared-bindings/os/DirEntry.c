@@ -0,0 +1,97 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/os/DirEntry.h"
+
+//| class DirEntry:
+//|     """An entry of a directory, given by `os.scandir`. On FAT filesystems, everything `stat`
+//|     returns is read along with the entry's name, so the file isn't looked up again."""
+//|
+
+//|     def __init__(self) -> None:
+//|         """Cannot be instantiated directly. Use `os.scandir`."""
+//|         ...
+//|
+
+//|     name: str
+//|     """The entry's file name. (read-only)"""
+static mp_obj_t os_direntry_get_name(mp_obj_t self_in) {
+    os_direntry_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_os_direntry_get_name(self);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(os_direntry_get_name_obj, os_direntry_get_name);
+
+MP_PROPERTY_GETTER(os_direntry_name_obj,
+    (mp_obj_t)&os_direntry_get_name_obj);
+
+//|     path: str
+//|     """The path given to `os.scandir` joined with `name`. (read-only)"""
+static mp_obj_t os_direntry_get_path(mp_obj_t self_in) {
+    os_direntry_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_os_direntry_get_path(self);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(os_direntry_get_path_obj, os_direntry_get_path);
+
+MP_PROPERTY_GETTER(os_direntry_path_obj,
+    (mp_obj_t)&os_direntry_get_path_obj);
+
+//|     def is_dir(self) -> bool:
+//|         """True when the entry is a directory."""
+//|         ...
+//|
+static mp_obj_t os_direntry_is_dir(mp_obj_t self_in) {
+    os_direntry_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_os_direntry_is_dir(self));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(os_direntry_is_dir_obj, os_direntry_is_dir);
+
+//|     def is_file(self) -> bool:
+//|         """True when the entry is a regular file."""
+//|         ...
+//|
+static mp_obj_t os_direntry_is_file(mp_obj_t self_in) {
+    os_direntry_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_os_direntry_is_file(self));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(os_direntry_is_file_obj, os_direntry_is_file);
+
+//|     def stat(self) -> Tuple[int, int, int, int, int, int, int, int, int, int]:
+//|         """Like `os.stat` of `path`. The result is kept, so later calls return it again."""
+//|         ...
+//|
+//|
+static mp_obj_t os_direntry_stat(mp_obj_t self_in) {
+    os_direntry_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_os_direntry_stat(self);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(os_direntry_stat_obj, os_direntry_stat);
+
+static void os_direntry_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+    os_direntry_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_print_str(print, "<DirEntry ");
+    mp_obj_print_helper(print, self->name, PRINT_REPR);
+    mp_print_str(print, ">");
+}
+
+static const mp_rom_map_elem_t os_direntry_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_name),    MP_ROM_PTR(&os_direntry_name_obj) },
+    { MP_ROM_QSTR(MP_QSTR_path),    MP_ROM_PTR(&os_direntry_path_obj) },
+    { MP_ROM_QSTR(MP_QSTR_is_dir),  MP_ROM_PTR(&os_direntry_is_dir_obj) },
+    { MP_ROM_QSTR(MP_QSTR_is_file), MP_ROM_PTR(&os_direntry_is_file_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stat),    MP_ROM_PTR(&os_direntry_stat_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(os_direntry_locals_dict, os_direntry_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    os_direntry_type,
+    MP_QSTR_DirEntry,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    print, os_direntry_print,
+    locals_dict, &os_direntry_locals_dict
+    );
@@ -0,0 +1,17 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/os/DirEntry.h"
+
+extern const mp_obj_type_t os_direntry_type;
+
+mp_obj_t common_hal_os_direntry_get_name(os_direntry_obj_t *self);
+mp_obj_t common_hal_os_direntry_get_path(os_direntry_obj_t *self);
+bool common_hal_os_direntry_is_dir(os_direntry_obj_t *self);
+bool common_hal_os_direntry_is_file(os_direntry_obj_t *self);
+mp_obj_t common_hal_os_direntry_stat(os_direntry_obj_t *self);
@@ -15,6 +15,7 @@
 #include "py/obj.h"
 #include "py/objstr.h"
 #include "py/runtime.h"
+#include "shared-bindings/os/DirEntry.h"
 #include "shared-bindings/os/__init__.h"
 
 //| """functions that an OS normally provides
@@ -150,6 +151,24 @@ static mp_obj_t os_listdir(size_t n_args, const mp_obj_t *args) {
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(os_listdir_obj, 0, 1, os_listdir);
 
+//| def scandir(path: str = ".") -> Iterator[DirEntry]:
+//|     """Returns an iterator of a `DirEntry` for each entry of the given directory, or of the
+//|     current directory. Unlike `listdir`, no list is built, and on FAT filesystems each
+//|     entry's size, modification time and type are read along with its name, so going through
+//|     a large directory and calling `DirEntry.stat` doesn't look each file up again.
+//|
+//|     Unlike CPython, the iterator can't be used with ``with``."""
+//|     ...
+//|
+//|
+static mp_obj_t os_scandir(size_t n_args, const mp_obj_t *args) {
+    if (n_args == 1) {
+        return common_hal_os_scandir(mp_obj_str_get_str(args[0]), args[0]);
+    }
+    return common_hal_os_scandir(mp_obj_str_get_str(common_hal_os_getcwd()), MP_OBJ_NEW_QSTR(MP_QSTR__dot_));
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(os_scandir_obj, 0, 1, os_scandir);
+
 //| def mkdir(path: str) -> None:
 //|     """Create a new directory."""
 //|     ...
@@ -315,6 +334,7 @@ static const mp_rom_map_elem_t os_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_remove), MP_ROM_PTR(&os_remove_obj) },
     { MP_ROM_QSTR(MP_QSTR_rename), MP_ROM_PTR(&os_rename_obj) },
     { MP_ROM_QSTR(MP_QSTR_rmdir), MP_ROM_PTR(&os_rmdir_obj) },
+    { MP_ROM_QSTR(MP_QSTR_scandir), MP_ROM_PTR(&os_scandir_obj) },
     { MP_ROM_QSTR(MP_QSTR_stat), MP_ROM_PTR(&os_stat_obj) },
     { MP_ROM_QSTR(MP_QSTR_statvfs), MP_ROM_PTR(&os_statvfs_obj) },
     { MP_ROM_QSTR(MP_QSTR_unlink), MP_ROM_PTR(&os_remove_obj) }, // unlink aliases to remove
@@ -324,6 +344,8 @@ static const mp_rom_map_elem_t os_module_globals_table[] = {
 
     { MP_ROM_QSTR(MP_QSTR_urandom), MP_ROM_PTR(&os_urandom_obj) },
 
+    { MP_ROM_QSTR(MP_QSTR_DirEntry), MP_ROM_PTR(&os_direntry_type) },
+
 //| sep: str
 //| """Separator used to delineate path components such as folder and file names."""
     { MP_ROM_QSTR(MP_QSTR_sep), MP_ROM_QSTR(MP_QSTR__slash_) },
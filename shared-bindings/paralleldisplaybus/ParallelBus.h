@@ -34,6 +34,11 @@ void common_hal_paralleldisplaybus_parallelbus_send(mp_obj_t self, display_byte_
 
 void common_hal_paralleldisplaybus_parallelbus_end_transaction(mp_obj_t self);
 
+#if CIRCUITPY_BUSDISPLAY_DOUBLE_BUFFER
+void common_hal_paralleldisplaybus_parallelbus_send_async(mp_obj_t self, const uint8_t *data, uint32_t data_length);
+void common_hal_paralleldisplaybus_parallelbus_wait_for_send(mp_obj_t self);
+#endif
+
 // The ParallelBus object always lives off the MP heap. So, code must collect any pointers
 // back to the MP heap manually. Otherwise they'll get freed.
 void common_hal_paralleldisplaybus_parallelbus_collect_ptrs(mp_obj_t self);
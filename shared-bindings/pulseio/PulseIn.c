@@ -171,6 +171,29 @@ static mp_obj_t pulseio_pulsein_obj_popleft(mp_obj_t self_in) {
 }
 MP_DEFINE_CONST_FUN_OBJ_1(pulseio_pulsein_popleft_obj, pulseio_pulsein_obj_popleft);
 
+//|     def readinto(self, buffer: WriteableBuffer) -> int:
+//|         """Removes the oldest pulse durations and stores them in ``buffer``, up to its length.
+//|         This is much faster than calling `popleft` for each pulse when many have been captured.
+//|
+//|         :param ~circuitpython_typing.WriteableBuffer buffer: An ``array.array`` of type ``'H'``
+//|         :return: the number of pulse durations stored. 0 when none have been captured.
+//|         :rtype: int"""
+//|         ...
+//|
+static mp_obj_t pulseio_pulsein_obj_readinto(mp_obj_t self_in, mp_obj_t buffer) {
+    pulseio_pulsein_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_WRITE);
+    if (bufinfo.typecode != 'H') {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be array of type 'H'"), MP_QSTR_buffer);
+    }
+    size_t count = common_hal_pulseio_pulsein_readinto(self, bufinfo.buf, bufinfo.len / sizeof(uint16_t));
+    return MP_OBJ_NEW_SMALL_INT(count);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(pulseio_pulsein_readinto_obj, pulseio_pulsein_obj_readinto);
+
 //|     maxlen: int
 //|     """The maximum length of the PulseIn. When len() is equal to maxlen,
 //|     it is unclear which pulses are active and which are idle."""
@@ -267,6 +290,7 @@ static const mp_rom_map_elem_t pulseio_pulsein_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_resume), MP_ROM_PTR(&pulseio_pulsein_resume_obj) },
     { MP_ROM_QSTR(MP_QSTR_clear), MP_ROM_PTR(&pulseio_pulsein_clear_obj) },
     { MP_ROM_QSTR(MP_QSTR_popleft), MP_ROM_PTR(&pulseio_pulsein_popleft_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&pulseio_pulsein_readinto_obj) },
 
     // Properties
     { MP_ROM_QSTR(MP_QSTR_maxlen), MP_ROM_PTR(&pulseio_pulsein_maxlen_obj) },
@@ -19,6 +19,8 @@ extern void common_hal_pulseio_pulsein_pause(pulseio_pulsein_obj_t *self);
 extern void common_hal_pulseio_pulsein_resume(pulseio_pulsein_obj_t *self, uint16_t trigger_duration);
 extern void common_hal_pulseio_pulsein_clear(pulseio_pulsein_obj_t *self);
 extern uint16_t common_hal_pulseio_pulsein_popleft(pulseio_pulsein_obj_t *self);
+// Removes up to len of the oldest pulses into buffer and returns how many there were.
+extern size_t common_hal_pulseio_pulsein_readinto(pulseio_pulsein_obj_t *self, uint16_t *buffer, size_t len);
 extern uint16_t common_hal_pulseio_pulsein_get_maxlen(pulseio_pulsein_obj_t *self);
 extern bool common_hal_pulseio_pulsein_get_paused(pulseio_pulsein_obj_t *self);
 extern uint16_t common_hal_pulseio_pulsein_get_len(pulseio_pulsein_obj_t *self);
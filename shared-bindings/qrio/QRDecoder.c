@@ -38,66 +38,118 @@ static mp_obj_t qrio_qrdecoder_make_new(const mp_obj_type_t *type, size_t n_args
 }
 
 
-static void verify_buffer_size(qrio_qrdecoder_obj_t *self, mp_obj_t *buffer, size_t len, qrio_pixel_policy_t policy) {
+//|     def decode(
+//|         self,
+//|         buffer: ReadableBuffer,
+//|         pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE,
+//|         *,
+//|         scale: int = 1,
+//|         x: int = 0,
+//|         y: int = 0,
+//|         stride: Optional[int] = None,
+//|     ) -> List[QRInfo]:
+//|         """Decode zero or more QR codes from the given image.
+//|
+//|         The image can be part of a larger frame, such as a camera framebuffer, so that it
+//|         doesn't have to be copied out first. Each pixel the decoder sees is the average of a
+//|         ``scale`` × ``scale`` block of the frame, starting at (``x``, ``y``). A camera frame
+//|         that is 2 or 4 times the decoder's size in each direction is decoded much faster than
+//|         at full size, and after `find` has located a code, decoding just the region around it
+//|         in the following frames is faster still.
+//|
+//|         The buffer must hold ``stride`` × (``y`` + ``scale`` × `height`) pixels, where each pixel
+//|         is one byte for `EVERY_BYTE` and two bytes otherwise.
+//|
+//|         :param ReadableBuffer buffer: The image, or the frame the image is part of
+//|         :param PixelPolicy pixel_policy: How the pixels are stored in ``buffer``
+//|         :param int scale: 1, 2 or 4
+//|         :param int x: The first column of the frame to use
+//|         :param int y: The first row of the frame to use
+//|         :param int stride: The number of pixels from the start of one row of the frame to
+//|             the start of the next. Defaults to ``scale`` × `width`.
+//|         """
+//|
+
+enum { ARG_buffer, ARG_pixel_policy, ARG_scale, ARG_x, ARG_y, ARG_stride };
+static const mp_arg_t qrio_qrdecoder_image_args[] = {
+    { MP_QSTR_buffer, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_int = 0} },
+    { MP_QSTR_pixel_policy, MP_ARG_OBJ, {.u_obj = MP_ROM_PTR((mp_obj_t *)&qrio_pixel_policy_EVERY_BYTE_obj)} },
+    { MP_QSTR_scale, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
+    { MP_QSTR_x, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+    { MP_QSTR_y, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+    { MP_QSTR_stride, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+};
+
+// Parses the arguments shared by decode() and find() and checks the image fits in the buffer.
+static void parse_image_args(qrio_qrdecoder_obj_t *self, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args,
+    mp_buffer_info_t *bufinfo, qrio_pixel_policy_t *policy, qrio_frame_layout_t *layout) {
+    mp_arg_val_t args[MP_ARRAY_SIZE(qrio_qrdecoder_image_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(qrio_qrdecoder_image_args), qrio_qrdecoder_image_args, args);
+
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, bufinfo, MP_BUFFER_READ);
+    *policy = cp_enum_value(&qrio_pixel_policy_type, args[ARG_pixel_policy].u_obj, MP_QSTR_pixel_policy);
+
     int width = shared_module_qrio_qrdecoder_get_width(self);
     int height = shared_module_qrio_qrdecoder_get_height(self);
 
+    layout->scale = args[ARG_scale].u_int;
+    if (layout->scale != 1 && layout->scale != 2 && layout->scale != 4) {
+        mp_arg_error_invalid(MP_QSTR_scale);
+    }
+    layout->x = mp_arg_validate_int_min(args[ARG_x].u_int, 0, MP_QSTR_x);
+    layout->y = mp_arg_validate_int_min(args[ARG_y].u_int, 0, MP_QSTR_y);
+    int row_pixels = width * layout->scale;
+    if (args[ARG_stride].u_obj == mp_const_none) {
+        layout->stride = row_pixels;
+    } else {
+        layout->stride = mp_obj_get_int(args[ARG_stride].u_obj);
+    }
+    mp_arg_validate_int_min(layout->stride, layout->x + row_pixels, MP_QSTR_stride);
+
     // verify that the buffer is big enough
-    int sz = width * height;
-    if (policy != QRIO_EVERY_BYTE) {
+    size_t sz = (size_t)(layout->y + height * layout->scale) * layout->stride;
+    if (*policy != QRIO_EVERY_BYTE) {
         sz *= 2;
     }
-    mp_get_index(mp_obj_get_type(*buffer), len, MP_OBJ_NEW_SMALL_INT(sz - 1), false);
+    mp_get_index(mp_obj_get_type(args[ARG_buffer].u_obj), bufinfo->len, MP_OBJ_NEW_SMALL_INT(sz - 1), false);
 }
 
-//|     def decode(
-//|         self, buffer: ReadableBuffer, pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE
-//|     ) -> List[QRInfo]:
-//|         """Decode zero or more QR codes from the given image.  The size of the buffer must be at least ``length``×``width`` bytes for `EVERY_BYTE`, and 2×``length``×``width`` bytes for `EVEN_BYTES` or `ODD_BYTES`."""
-//|
 static mp_obj_t qrio_qrdecoder_decode(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
 
-    enum { ARG_buffer, ARG_pixel_policy };
-    static const mp_arg_t allowed_args[] = {
-        { MP_QSTR_buffer, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_int = 0} },
-        { MP_QSTR_pixel_policy, MP_ARG_OBJ, {.u_obj = MP_ROM_PTR((mp_obj_t *)&qrio_pixel_policy_EVERY_BYTE_obj)} },
-    };
-    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
-    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
-
     mp_buffer_info_t bufinfo;
-    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ);
-    qrio_pixel_policy_t policy = cp_enum_value(&qrio_pixel_policy_type, args[ARG_pixel_policy].u_obj, MP_QSTR_pixel_policy);
-    verify_buffer_size(self, &args[ARG_buffer].u_obj, bufinfo.len, policy);
+    qrio_pixel_policy_t policy;
+    qrio_frame_layout_t layout;
+    parse_image_args(self, n_args, pos_args, kw_args, &bufinfo, &policy, &layout);
 
-    return shared_module_qrio_qrdecoder_decode(self, &bufinfo, policy);
+    return shared_module_qrio_qrdecoder_decode(self, &bufinfo, policy, &layout);
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(qrio_qrdecoder_decode_obj, 1, qrio_qrdecoder_decode);
 
 
 //|     def find(
-//|         self, buffer: ReadableBuffer, pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE
+//|         self,
+//|         buffer: ReadableBuffer,
+//|         pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE,
+//|         *,
+//|         scale: int = 1,
+//|         x: int = 0,
+//|         y: int = 0,
+//|         stride: Optional[int] = None,
 //|     ) -> List[QRPosition]:
-//|         """Find all visible QR codes from the given image.  The size of the buffer must be at least ``length``×``width`` bytes for `EVERY_BYTE`, and 2×``length``×``width`` bytes for `EVEN_BYTES` or `ODD_BYTES`."""
+//|         """Find all visible QR codes from the given image. The arguments are the same as for
+//|         `decode`. The positions are in the coordinates of the whole frame, so they can be
+//|         used directly to choose ``x`` and ``y`` for the next frame."""
 //|
 static mp_obj_t qrio_qrdecoder_find(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
 
-    enum { ARG_buffer, ARG_pixel_policy };
-    static const mp_arg_t allowed_args[] = {
-        { MP_QSTR_buffer, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_int = 0} },
-        { MP_QSTR_pixel_policy, MP_ARG_OBJ, {.u_obj = MP_ROM_PTR((mp_obj_t *)&qrio_pixel_policy_EVERY_BYTE_obj)} },
-    };
-    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
-    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
-
     mp_buffer_info_t bufinfo;
-    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ);
-    qrio_pixel_policy_t policy = cp_enum_value(&qrio_pixel_policy_type, args[ARG_pixel_policy].u_obj, MP_QSTR_pixel_policy);
-    verify_buffer_size(self, &args[ARG_buffer].u_obj, bufinfo.len, policy);
+    qrio_pixel_policy_t policy;
+    qrio_frame_layout_t layout;
+    parse_image_args(self, n_args, pos_args, kw_args, &bufinfo, &policy, &layout);
 
-    return shared_module_qrio_qrdecoder_find(self, &bufinfo, policy);
+    return shared_module_qrio_qrdecoder_find(self, &bufinfo, policy, &layout);
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(qrio_qrdecoder_find_obj, 1, qrio_qrdecoder_find);
 
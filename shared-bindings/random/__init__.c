@@ -8,7 +8,9 @@
 #include <assert.h>
 #include <string.h>
 
+#include "py/binary.h"
 #include "py/obj.h"
+#include "py/objarray.h"
 #include "py/runtime.h"
 #include "shared-bindings/random/__init__.h"
 
@@ -158,6 +160,68 @@ static mp_obj_t random_uniform(mp_obj_t a_in, mp_obj_t b_in) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(random_uniform_obj, random_uniform);
 
+//| def fill(buffer: WriteableBuffer, lo: float = ..., hi: float = ...) -> None:
+//|     """Fills every item of ``buffer`` with a random number, in a single call.
+//|
+//|     The buffer's type decides the kind of number. Items of an integer type
+//|     (a `bytearray`, or an `array.array` of type ``'b'``, ``'B'``, ``'h'``,
+//|     ``'H'``, ``'i'``, ``'I'``, ``'l'``, ``'L'``, ``'q'`` or ``'Q'``) get an
+//|     integer from ``range(lo, hi)``, which defaults to the whole range of the
+//|     type. ``hi - lo`` must be less than 2**32 unless it is the whole range.
+//|     Items of type ``'f'`` or ``'d'`` get a float between ``lo`` and ``hi``,
+//|     which default to 0.0 and 1.0.
+//|
+//|     This is much faster than filling the buffer one number at a time and
+//|     doesn't allocate any objects."""
+//|     ...
+//|
+//|
+static mp_obj_t random_fill(size_t n_args, const mp_obj_t *args) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[0], &bufinfo, MP_BUFFER_WRITE);
+    char typecode = bufinfo.typecode == BYTEARRAY_TYPECODE ? 'B' : bufinfo.typecode;
+    size_t itemsize = mp_binary_get_size('@', typecode, NULL);
+    size_t len = bufinfo.len / itemsize;
+
+    #if MICROPY_PY_BUILTINS_FLOAT
+    if (typecode == 'f' || typecode == 'd') {
+        mp_float_t lo = n_args > 1 ? mp_obj_get_float(args[1]) : MICROPY_FLOAT_CONST(0.0);
+        mp_float_t hi = n_args > 2 ? mp_obj_get_float(args[2]) : MICROPY_FLOAT_CONST(1.0);
+        shared_modules_random_fill_float(bufinfo.buf, len, typecode == 'd', lo, hi);
+        return mp_const_none;
+    }
+    #endif
+
+    if (typecode == 0 || strchr("bBhHiIlLqQ", typecode) == NULL) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("unsupported %q type"), MP_QSTR_buffer);
+    }
+    size_t bits = itemsize * 8;
+    bool is_signed = typecode >= 'a';
+    int64_t type_min = is_signed ? -((int64_t)1 << (bits - 1)) : 0;
+    int64_t type_max = (bits == 64 || is_signed) ? (int64_t)(UINT64_MAX >> (65 - bits)) : ((int64_t)1 << bits) - 1;
+    int64_t lo = n_args > 1 ? mp_obj_get_int(args[1]) : type_min;
+    int64_t hi_max = n_args > 2 ? mp_obj_get_int(args[2]) - 1 : type_max;
+    if (lo < type_min || lo > type_max) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q out of range"), MP_QSTR_lo);
+    }
+    if (hi_max < lo || hi_max > type_max) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q out of range"), MP_QSTR_hi);
+    }
+
+    uint32_t span;
+    if (lo == type_min && hi_max == type_max) {
+        // the whole type, so just fill in random bits
+        span = 0;
+    } else if ((uint64_t)(hi_max - lo) < UINT32_MAX) {
+        span = hi_max - lo + 1;
+    } else {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q out of range"), MP_QSTR_hi);
+    }
+    shared_modules_random_fill_int(bufinfo.buf, len, itemsize, lo, span);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(random_fill_obj, 1, 3, random_fill);
+
 static const mp_rom_map_elem_t mp_module_random_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_random) },
     { MP_ROM_QSTR(MP_QSTR_seed), MP_ROM_PTR(&random_seed_obj) },
@@ -167,6 +231,7 @@ static const mp_rom_map_elem_t mp_module_random_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_choice), MP_ROM_PTR(&random_choice_obj) },
     { MP_ROM_QSTR(MP_QSTR_random), MP_ROM_PTR(&random_random_obj) },
     { MP_ROM_QSTR(MP_QSTR_uniform), MP_ROM_PTR(&random_uniform_obj) },
+    { MP_ROM_QSTR(MP_QSTR_fill), MP_ROM_PTR(&random_fill_obj) },
 };
 
 static MP_DEFINE_CONST_DICT(mp_module_random_globals, mp_module_random_globals_table);
@@ -15,3 +15,8 @@ mp_uint_t shared_modules_random_getrandbits(uint8_t n);
 mp_int_t shared_modules_random_randrange(mp_int_t start, mp_int_t stop, mp_int_t step);
 mp_float_t shared_modules_random_random(void);
 mp_float_t shared_modules_random_uniform(mp_float_t a, mp_float_t b);
+// Fill len items of itemsize bytes each with lo plus a random number below span,
+// or with random bits when span is 0.
+void shared_modules_random_fill_int(void *buf, size_t len, size_t itemsize, mp_int_t lo, uint32_t span);
+// Fill len floats (or doubles) with random numbers between a and b.
+void shared_modules_random_fill_float(void *buf, size_t len, bool is_double, mp_float_t a, mp_float_t b);
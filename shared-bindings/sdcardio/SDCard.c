@@ -130,7 +130,8 @@ static mp_obj_t _sdcardio_sdcard_readblocks(mp_obj_t self_in, mp_obj_t start_blo
 MP_DEFINE_CONST_FUN_OBJ_3(sdcardio_sdcard_readblocks_obj, _sdcardio_sdcard_readblocks);
 
 //|     def sync(self) -> None:
-//|         """Ensure all blocks written are actually committed to the SD card
+//|         """Ensure all blocks written are actually committed to the SD card.
+//|         Blocks written one at a time may be held in memory until then.
 //|
 //|         :return: None"""
 //|         ...
@@ -216,6 +216,48 @@ static mp_obj_t _socketpool_socket_recv_into(size_t n_args, const mp_obj_t *args
 }
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(socketpool_socket_recv_into_obj, 2, 3, _socketpool_socket_recv_into);
 
+//|     def recvmsg_into(self, buffers: Iterable[WriteableBuffer]) -> int:
+//|         """Reads some bytes from the connected remote address into several buffers in turn,
+//|         such as the two free parts of a ring buffer, filling each before starting the next.
+//|         Only the first buffer waits for data. The rest are filled from what has already
+//|         arrived.
+//|
+//|         Suits sockets of type SOCK_STREAM
+//|         Unlike CPython, returns just an int of the total number of bytes read.
+//|
+//|         :param Iterable buffers: buffers to receive into"""
+//|         ...
+//|
+static mp_obj_t _socketpool_socket_recvmsg_into(mp_obj_t self_in, mp_obj_t buffers_in) {
+    socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (common_hal_socketpool_socket_get_closed(self)) {
+        // Bad file number.
+        mp_raise_OSError(MP_EBADF);
+    }
+    mp_uint_t total = 0;
+    mp_obj_iter_buf_t iter_buf;
+    mp_obj_t iterable = mp_getiter(buffers_in, &iter_buf);
+    mp_obj_t item;
+    while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(item, &bufinfo, MP_BUFFER_WRITE);
+        if (bufinfo.len == 0) {
+            continue;
+        }
+        // Don't wait, or fail, once some bytes have been read.
+        if (total > 0 && !common_hal_socketpool_readable(self)) {
+            break;
+        }
+        mp_uint_t ret = common_hal_socketpool_socket_recv_into(self, (byte *)bufinfo.buf, bufinfo.len);
+        total += ret;
+        if (ret < bufinfo.len) {
+            break;
+        }
+    }
+    return mp_obj_new_int_from_uint(total);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_recvmsg_into_obj, _socketpool_socket_recvmsg_into);
+
 //|     def send(self, bytes: ReadableBuffer) -> int:
 //|         """Send some bytes to the connected remote address.
 //|         Suits sockets of type SOCK_STREAM
@@ -283,6 +325,56 @@ static mp_obj_t _socketpool_socket_sendall(mp_obj_t self_in, mp_obj_t buf_in) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_sendall_obj, _socketpool_socket_sendall);
 
+//|     def sendmsg(self, buffers: Iterable[ReadableBuffer]) -> int:
+//|         """Send the contents of several buffers in turn to the connected remote address, as
+//|         if they were one, without joining them first. Stops at the first buffer that isn't
+//|         sent completely.
+//|
+//|         Suits sockets of type SOCK_STREAM
+//|         Returns an int of the total number of bytes sent.
+//|
+//|         :param Iterable buffers: buffers to send"""
+//|         ...
+//|
+static mp_obj_t _socketpool_socket_sendmsg(mp_obj_t self_in, mp_obj_t buffers_in) {
+    socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (common_hal_socketpool_socket_get_closed(self)) {
+        // Bad file number.
+        mp_raise_OSError(MP_EBADF);
+    }
+    if (!common_hal_socketpool_socket_get_connected(self)) {
+        mp_raise_BrokenPipeError();
+    }
+    mp_uint_t total = 0;
+    mp_obj_iter_buf_t iter_buf;
+    mp_obj_t iterable = mp_getiter(buffers_in, &iter_buf);
+    mp_obj_t item;
+    while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(item, &bufinfo, MP_BUFFER_READ);
+        if (bufinfo.len == 0) {
+            continue;
+        }
+        // Don't wait, or fail, once some bytes have been sent.
+        if (total > 0 && !common_hal_socketpool_writable(self)) {
+            break;
+        }
+        mp_int_t ret = common_hal_socketpool_socket_send(self, bufinfo.buf, bufinfo.len);
+        if (ret == -1) {
+            if (total > 0) {
+                break;
+            }
+            mp_raise_BrokenPipeError();
+        }
+        total += ret;
+        if ((size_t)ret < bufinfo.len) {
+            break;
+        }
+    }
+    return mp_obj_new_int_from_uint(total);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_sendmsg_obj, _socketpool_socket_sendmsg);
+
 //|     def sendto(self, bytes: ReadableBuffer, address: Tuple[str, int]) -> int:
 //|         """Send some bytes to a specific address.
 //|         Suits sockets of type SOCK_DGRAM
@@ -415,7 +507,9 @@ static const mp_rom_map_elem_t socketpool_socket_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_listen), MP_ROM_PTR(&socketpool_socket_listen_obj) },
     { MP_ROM_QSTR(MP_QSTR_recvfrom_into), MP_ROM_PTR(&socketpool_socket_recvfrom_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_recv_into), MP_ROM_PTR(&socketpool_socket_recv_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_recvmsg_into), MP_ROM_PTR(&socketpool_socket_recvmsg_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_sendall), MP_ROM_PTR(&socketpool_socket_sendall_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sendmsg), MP_ROM_PTR(&socketpool_socket_sendmsg_obj) },
     { MP_ROM_QSTR(MP_QSTR_send), MP_ROM_PTR(&socketpool_socket_send_obj) },
     { MP_ROM_QSTR(MP_QSTR_sendto), MP_ROM_PTR(&socketpool_socket_sendto_obj) },
     { MP_ROM_QSTR(MP_QSTR_setblocking), MP_ROM_PTR(&socketpool_socket_setblocking_obj) },
@@ -17,6 +17,7 @@
 extern const mp_obj_type_t ssl_sslcontext_type;
 
 void common_hal_ssl_sslcontext_construct(ssl_sslcontext_obj_t *self);
+void common_hal_ssl_sslcontext_deinit(ssl_sslcontext_obj_t *self);
 
 ssl_sslsocket_obj_t *common_hal_ssl_sslcontext_wrap_socket(ssl_sslcontext_obj_t *self,
     mp_obj_t socket, bool server_side, const char *server_hostname);
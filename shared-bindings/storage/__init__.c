@@ -9,6 +9,8 @@
 #include <string.h>
 
 #include "extmod/vfs_fat.h"
+#include "extmod/vfs_lfs.h"
+#include "py/binary.h"
 #include "py/obj.h"
 #include "py/objnamedtuple.h"
 #include "py/runtime.h"
@@ -143,6 +145,51 @@ static mp_obj_t storage_getmount(const mp_obj_t mnt_in) {
 }
 MP_DEFINE_CONST_FUN_OBJ_1(storage_getmount_obj, storage_getmount);
 
+#if CIRCUITPY_STORAGE_MAP_FILE
+//| def map_file(path: str, *, typecode: str = "B", defragment: bool = False) -> memoryview:
+//|     """Returns a read-only memoryview of the contents of the file at ``path``. When the file
+//|     is stored in one piece on flash that the microcontroller can read directly, such as
+//|     ``CIRCUITPY`` on most RP2040 and RP2350 boards, the memoryview reads it in place and
+//|     no RAM is used for it. Otherwise the file is read into RAM.
+//|
+//|     This lets assets such as wavetables and samples be given to `synthio` and
+//|     `audiocore.RawSample` without copying them.
+//|
+//|     The memoryview is only valid until the file is changed or deleted, by CircuitPython or
+//|     over USB.
+//|
+//|     :param str path: The file to map
+//|     :param str typecode: The `array` typecode of the memoryview's items, such as ``"h"``
+//|         for signed 16-bit samples
+//|     :param bool defragment: When the file isn't in one piece, rewrite it so it is, when
+//|         CircuitPython can write to its filesystem. Only FAT filesystems can be rewritten. If
+//|         power is lost part way through, the file may be left as ``/.map_file.tmp``.
+//|     """
+//|     ...
+//|
+//|
+static mp_obj_t storage_map_file(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_path, ARG_typecode, ARG_defragment };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_path, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_typecode, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NEW_QSTR(MP_QSTR_B)} },
+        { MP_QSTR_defragment, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    size_t typecode_len;
+    const char *typecode = mp_obj_str_get_data(args[ARG_typecode].u_obj, &typecode_len);
+    mp_arg_validate_length(typecode_len, 1, MP_QSTR_typecode);
+    // Raises ValueError for typecodes that array doesn't have.
+    mp_binary_get_size('@', typecode[0], NULL);
+
+    return common_hal_storage_map_file(args[ARG_path].u_obj, typecode[0], args[ARG_defragment].u_bool);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(storage_map_file_obj, 1, storage_map_file);
+#endif
+
 //| def erase_filesystem(extended: Optional[bool] = None) -> None:
 //|     """Erase and re-create the ``CIRCUITPY`` filesystem.
 //|
@@ -242,6 +289,9 @@ static const mp_rom_map_elem_t storage_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_umount),            MP_ROM_PTR(&storage_umount_obj) },
     { MP_ROM_QSTR(MP_QSTR_remount),           MP_ROM_PTR(&storage_remount_obj) },
     { MP_ROM_QSTR(MP_QSTR_getmount),          MP_ROM_PTR(&storage_getmount_obj) },
+    #if CIRCUITPY_STORAGE_MAP_FILE
+    { MP_ROM_QSTR(MP_QSTR_map_file),          MP_ROM_PTR(&storage_map_file_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_erase_filesystem),  MP_ROM_PTR(&storage_erase_filesystem_obj) },
     { MP_ROM_QSTR(MP_QSTR_disable_usb_drive), MP_ROM_PTR(&storage_disable_usb_drive_obj) },
     { MP_ROM_QSTR(MP_QSTR_enable_usb_drive),  MP_ROM_PTR(&storage_enable_usb_drive_obj) },
@@ -310,6 +360,80 @@ static const mp_rom_map_elem_t storage_module_globals_table[] = {
 //|
 //|
     { MP_ROM_QSTR(MP_QSTR_VfsFat), MP_ROM_PTR(&mp_fat_vfs_type) },
+
+    #if MICROPY_VFS_LFS2
+//| class VfsLfs2:
+//|     """A littlefs filesystem. Its files can't be corrupted by losing power part way through
+//|     a write, and appending to a file doesn't rewrite its earlier blocks. It can't be shown
+//|     over USB and is not available on all boards."""
+//|
+//|     def __init__(
+//|         self,
+//|         block_device: BlockDevice,
+//|         *,
+//|         readsize: int = 32,
+//|         progsize: int = 32,
+//|         lookahead: int = 0,
+//|         mtime: bool = True,
+//|     ) -> None:
+//|         """Create a new VfsLfs2 filesystem around the given block device.
+//|
+//|         :param block_device: Block device the the filesystem lives on
+//|         :param int readsize: The smallest read from the block device, in bytes
+//|         :param int progsize: The smallest write to the block device, in bytes
+//|         :param int lookahead: How many bytes of blocks to track the use of when looking for
+//|           free ones, one bit per block. 0 covers the whole device, up to 2048 blocks.
+//|         :param bool mtime: Whether to store the modification time of each file"""
+//|
+//|     @staticmethod
+//|     def mkfs(
+//|         block_device: BlockDevice,
+//|         *,
+//|         readsize: int = 32,
+//|         progsize: int = 32,
+//|         lookahead: int = 0,
+//|     ) -> None:
+//|         """Format the block device, deleting any data that may have been there."""
+//|         ...
+//|
+//|     def open(self, path: str, mode: str) -> None:
+//|         """Like builtin ``open()``"""
+//|         ...
+//|
+//|     def ilistdir(
+//|         self, path: str
+//|     ) -> Iterator[Union[Tuple[AnyStr, int, int, int], Tuple[AnyStr, int, int]]]:
+//|         """Return an iterator whose values describe files and folders within
+//|         ``path``"""
+//|         ...
+//|
+//|     def mkdir(self, path: str) -> None:
+//|         """Like `os.mkdir`"""
+//|         ...
+//|
+//|     def rmdir(self, path: str) -> None:
+//|         """Like `os.rmdir`"""
+//|         ...
+//|
+//|     def stat(self, path: str) -> Tuple[int, int, int, int, int, int, int, int, int, int]:
+//|         """Like `os.stat`"""
+//|         ...
+//|
+//|     def statvfs(self, path: int) -> Tuple[int, int, int, int, int, int, int, int, int, int]:
+//|         """Like `os.statvfs`"""
+//|         ...
+//|
+//|     def mount(self, readonly: bool, mkfs: VfsLfs2) -> None:
+//|         """Don't call this directly, call `storage.mount`."""
+//|         ...
+//|
+//|     def umount(self) -> None:
+//|         """Don't call this directly, call `storage.umount`."""
+//|         ...
+//|
+//|
+    { MP_ROM_QSTR(MP_QSTR_VfsLfs2), MP_ROM_PTR(&mp_type_vfs_lfs2) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(storage_module_globals, storage_module_globals_table);
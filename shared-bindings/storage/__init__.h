@@ -16,6 +16,7 @@ void common_hal_storage_umount_path(const char *path);
 void common_hal_storage_umount_object(mp_obj_t vfs_obj);
 void common_hal_storage_remount(const char *path, bool readonly, bool disable_concurrent_write_protection);
 mp_obj_t common_hal_storage_getmount(const char *path);
+mp_obj_t common_hal_storage_map_file(mp_obj_t path, char typecode, bool defragment);
 void common_hal_storage_erase_filesystem(bool extended);
 
 bool common_hal_storage_disable_usb_drive(void);
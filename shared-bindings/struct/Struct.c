@@ -0,0 +1,176 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "py/objlist.h"
+#include "py/objproperty.h"
+#include "py/objtuple.h"
+#include "py/runtime.h"
+#include "shared-bindings/struct/Struct.h"
+
+//| class Struct:
+//|     """A format string parsed once, for packing and unpacking it many times."""
+//|
+//|     def __init__(self, format: str) -> None:
+//|         """Parses ``format``, in the same way as the module functions, so that its methods
+//|         don't parse it again on every call.
+//|
+//|         :param str format: The format string"""
+//|         ...
+//|
+static mp_obj_t struct_struct_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_format };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_format, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    return shared_modules_struct_struct_new(args[ARG_format].u_obj);
+}
+
+// Returns where the struct starts in buffer, after checking that it fits.
+static byte *get_struct_start(struct_struct_obj_t *self, mp_obj_t buffer, mp_int_t offset, mp_uint_t flags) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, flags);
+    if (offset < 0) {
+        // negative offsets are relative to the end of the buffer
+        offset += bufinfo.len;
+    }
+    if (offset < 0 || (size_t)offset + shared_modules_struct_struct_get_size(self) > bufinfo.len) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Buffer too small"));
+    }
+    return (byte *)bufinfo.buf + offset;
+}
+
+//|     format: str
+//|     """The format string."""
+static mp_obj_t struct_struct_obj_get_format(mp_obj_t self_in) {
+    return shared_modules_struct_struct_get_format(MP_OBJ_TO_PTR(self_in));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(struct_struct_get_format_obj, struct_struct_obj_get_format);
+
+MP_PROPERTY_GETTER(struct_struct_format_obj,
+    (mp_obj_t)&struct_struct_get_format_obj);
+
+//|     size: int
+//|     """The number of bytes that the format packs into, as `struct.calcsize` would return."""
+//|
+static mp_obj_t struct_struct_obj_get_size(mp_obj_t self_in) {
+    return MP_OBJ_NEW_SMALL_INT(shared_modules_struct_struct_get_size(MP_OBJ_TO_PTR(self_in)));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(struct_struct_get_size_obj, struct_struct_obj_get_size);
+
+MP_PROPERTY_GETTER(struct_struct_size_obj,
+    (mp_obj_t)&struct_struct_get_size_obj);
+
+//|     def pack(self, *values: Any) -> bytes:
+//|         """Packs the values, as `struct.pack` does."""
+//|         ...
+//|
+static mp_obj_t struct_struct_pack(size_t n_args, const mp_obj_t *args) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_uint_t size = shared_modules_struct_struct_get_size(self);
+    vstr_t vstr;
+    vstr_init_len(&vstr, size);
+    memset(vstr.buf, 0, size);
+    shared_modules_struct_struct_pack_into(self, (byte *)vstr.buf, n_args - 1, &args[1]);
+    return mp_obj_new_bytes_from_vstr(&vstr);
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_struct_pack_obj, 1, MP_OBJ_FUN_ARGS_MAX, struct_struct_pack);
+
+//|     def pack_into(self, buffer: WriteableBuffer, offset: int, *values: Any) -> None:
+//|         """Packs the values into buffer starting at offset, as `struct.pack_into` does."""
+//|         ...
+//|
+static mp_obj_t struct_struct_pack_into(size_t n_args, const mp_obj_t *args) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    byte *p = get_struct_start(self, args[1], mp_obj_get_int(args[2]), MP_BUFFER_WRITE);
+    shared_modules_struct_struct_pack_into(self, p, n_args - 3, &args[3]);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_struct_pack_into_obj, 3, MP_OBJ_FUN_ARGS_MAX, struct_struct_pack_into);
+
+//|     def unpack(self, buffer: ReadableBuffer) -> Tuple[Any, ...]:
+//|         """Unpacks buffer, which must be exactly `size` bytes, as `struct.unpack` does."""
+//|         ...
+//|
+static mp_obj_t struct_struct_unpack(mp_obj_t self_in, mp_obj_t buffer) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_READ);
+    if (bufinfo.len != shared_modules_struct_struct_get_size(self)) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("buffer size must match format"));
+    }
+    mp_obj_tuple_t *result = MP_OBJ_TO_PTR(mp_obj_new_tuple(shared_modules_struct_struct_get_num_items(self), NULL));
+    shared_modules_struct_struct_unpack_into(self, bufinfo.buf, result->items);
+    return MP_OBJ_FROM_PTR(result);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(struct_struct_unpack_obj, struct_struct_unpack);
+
+//|     def unpack_from(self, buffer: ReadableBuffer, offset: int = 0) -> Tuple[Any, ...]:
+//|         """Unpacks from buffer starting at offset, as `struct.unpack_from` does."""
+//|         ...
+//|
+static mp_obj_t struct_struct_unpack_from(size_t n_args, const mp_obj_t *args) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_int_t offset = n_args > 2 ? mp_obj_get_int(args[2]) : 0;
+    byte *p = get_struct_start(self, args[1], offset, MP_BUFFER_READ);
+    mp_obj_tuple_t *result = MP_OBJ_TO_PTR(mp_obj_new_tuple(shared_modules_struct_struct_get_num_items(self), NULL));
+    shared_modules_struct_struct_unpack_into(self, p, result->items);
+    return MP_OBJ_FROM_PTR(result);
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_struct_unpack_from_obj, 2, 3, struct_struct_unpack_from);
+
+//|     def unpack_from_into(self, items: List[Any], buffer: ReadableBuffer, offset: int = 0) -> None:
+//|         """Unpacks from buffer starting at offset like `unpack_from`, but stores the values
+//|         in ``items`` instead of a new tuple. ``items`` must be a list with one entry for each
+//|         value. Reusing it avoids allocating a tuple for every call.
+//|
+//|         For example::
+//|
+//|             import struct
+//|
+//|             header = struct.Struct("<HHI")
+//|             values = [0] * 3
+//|             header.unpack_from_into(values, packet)
+//|             kind, length, timestamp = values"""
+//|         ...
+//|
+//|
+static mp_obj_t struct_struct_unpack_from_into(size_t n_args, const mp_obj_t *args) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_obj_t items_in = mp_arg_validate_type(args[1], &mp_type_list, MP_QSTR_items);
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_list_get(items_in, &len, &items);
+    (void)mp_arg_validate_length(len, shared_modules_struct_struct_get_num_items(self), MP_QSTR_items);
+    mp_int_t offset = n_args > 3 ? mp_obj_get_int(args[3]) : 0;
+    byte *p = get_struct_start(self, args[2], offset, MP_BUFFER_READ);
+    shared_modules_struct_struct_unpack_into(self, p, items);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_struct_unpack_from_into_obj, 3, 4, struct_struct_unpack_from_into);
+
+static const mp_rom_map_elem_t struct_struct_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_format), MP_ROM_PTR(&struct_struct_format_obj) },
+    { MP_ROM_QSTR(MP_QSTR_size), MP_ROM_PTR(&struct_struct_size_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pack), MP_ROM_PTR(&struct_struct_pack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pack_into), MP_ROM_PTR(&struct_struct_pack_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack), MP_ROM_PTR(&struct_struct_unpack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack_from), MP_ROM_PTR(&struct_struct_unpack_from_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack_from_into), MP_ROM_PTR(&struct_struct_unpack_from_into_obj) },
+};
+static MP_DEFINE_CONST_DICT(struct_struct_locals_dict, struct_struct_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    struct_struct_type,
+    MP_QSTR_Struct,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, struct_struct_make_new,
+    locals_dict, &struct_struct_locals_dict
+    );
@@ -0,0 +1,20 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/struct/Struct.h"
+
+extern const mp_obj_type_t struct_struct_type;
+
+mp_obj_t shared_modules_struct_struct_new(mp_obj_t format);
+mp_obj_t shared_modules_struct_struct_get_format(struct_struct_obj_t *self);
+mp_uint_t shared_modules_struct_struct_get_size(struct_struct_obj_t *self);
+mp_uint_t shared_modules_struct_struct_get_num_items(struct_struct_obj_t *self);
+// The buffer at p must have room for get_size() bytes.
+void shared_modules_struct_struct_pack_into(struct_struct_obj_t *self, byte *p, size_t n_args, const mp_obj_t *args);
+// Stores get_num_items() values into items from the get_size() bytes at p.
+void shared_modules_struct_struct_unpack_into(struct_struct_obj_t *self, byte *p, mp_obj_t *items);
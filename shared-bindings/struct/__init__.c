@@ -15,6 +15,7 @@
 #include "py/binary.h"
 #include "py/parsenum.h"
 #include "shared-bindings/struct/__init__.h"
+#include "shared-bindings/struct/Struct.h"
 #include "shared-module/struct/__init__.h"
 
 //| """Manipulation of c-style data
@@ -24,7 +25,9 @@
 //| Supported size/byte order prefixes: *@*, *<*, *>*, *!*.
 //|
 //| Supported format codes: *b*, *B*, *x*, *h*, *H*, *i*, *I*, *l*, *L*, *q*, *Q*,
-//| *s*, *P*, *f*, *d* (the latter 2 depending on the floating-point support)."""
+//| *s*, *P*, *f*, *d* (the latter 2 depending on the floating-point support).
+//|
+//| Use `Struct` to parse a format once when it is packed or unpacked repeatedly."""
 //|
 //|
 
@@ -149,6 +152,7 @@ MP_DEFINE_CONST_FUN_OBJ_KW(struct_unpack_from_obj, 0, struct_unpack_from);
 
 static const mp_rom_map_elem_t mp_module_struct_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_struct) },
+    { MP_ROM_QSTR(MP_QSTR_Struct), MP_ROM_PTR(&struct_struct_type) },
     { MP_ROM_QSTR(MP_QSTR_calcsize), MP_ROM_PTR(&struct_calcsize_obj) },
     { MP_ROM_QSTR(MP_QSTR_pack), MP_ROM_PTR(&struct_pack_obj) },
     { MP_ROM_QSTR(MP_QSTR_pack_into), MP_ROM_PTR(&struct_pack_into_obj) },
@@ -18,6 +18,7 @@
 #include "supervisor/shared/serial.h"
 #include "supervisor/shared/stack.h"
 #include "supervisor/shared/status_leds.h"
+#include "supervisor/shared/tick.h"
 #include "supervisor/shared/bluetooth/bluetooth.h"
 
 #if CIRCUITPY_DISPLAYIO
@@ -29,6 +30,8 @@
 #endif
 
 static supervisor_run_reason_t _run_reason;
+static uint32_t _boot_time_ms;
+static bool _boot_complete;
 
 // TODO: add REPL to description once it is operational
 
@@ -112,6 +115,26 @@ MP_DEFINE_CONST_FUN_OBJ_1(supervisor_runtime_get_run_reason_obj, supervisor_runt
 MP_PROPERTY_GETTER(supervisor_runtime_run_reason_obj,
     (mp_obj_t)&supervisor_runtime_get_run_reason_obj);
 
+void supervisor_mark_boot_complete(void) {
+    if (!_boot_complete) {
+        _boot_time_ms = supervisor_ticks_ms32();
+        _boot_complete = true;
+    }
+}
+
+//|     boot_time_ms: Optional[int]
+//|     """Milliseconds from reset until ``code.py`` first started running, including ``boot.py``
+//|     and filesystem and USB setup, or `None` when read from ``boot.py``. Reloads don't change it,
+//|     so a device that wakes from deep sleep can log it to see how much of each wake is spent
+//|     booting rather than in ``code.py`` (read-only)."""
+static mp_obj_t supervisor_runtime_get_boot_time_ms(mp_obj_t self) {
+    return _boot_complete ? mp_obj_new_int_from_uint(_boot_time_ms) : mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(supervisor_runtime_get_boot_time_ms_obj, supervisor_runtime_get_boot_time_ms);
+
+MP_PROPERTY_GETTER(supervisor_runtime_boot_time_ms_obj,
+    (mp_obj_t)&supervisor_runtime_get_boot_time_ms_obj);
+
 //|     safe_mode_reason: SafeModeReason
 //|     """Why CircuitPython went into safe mode this particular time (read-only).
 //|
@@ -245,6 +268,7 @@ static const mp_rom_map_elem_t supervisor_runtime_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_serial_connected), MP_ROM_PTR(&supervisor_runtime_serial_connected_obj) },
     { MP_ROM_QSTR(MP_QSTR_serial_bytes_available), MP_ROM_PTR(&supervisor_runtime_serial_bytes_available_obj) },
     { MP_ROM_QSTR(MP_QSTR_run_reason), MP_ROM_PTR(&supervisor_runtime_run_reason_obj) },
+    { MP_ROM_QSTR(MP_QSTR_boot_time_ms), MP_ROM_PTR(&supervisor_runtime_boot_time_ms_obj) },
     { MP_ROM_QSTR(MP_QSTR_safe_mode_reason), MP_ROM_PTR(&supervisor_runtime_safe_mode_reason_obj) },
     { MP_ROM_QSTR(MP_QSTR_autoreload), MP_ROM_PTR(&supervisor_runtime_autoreload_obj) },
     { MP_ROM_QSTR(MP_QSTR_ble_workflow),  MP_ROM_PTR(&supervisor_runtime_ble_workflow_obj) },
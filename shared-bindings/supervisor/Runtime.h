@@ -16,6 +16,9 @@ extern const mp_obj_type_t supervisor_runtime_type;
 supervisor_run_reason_t supervisor_get_run_reason(void);
 void supervisor_set_run_reason(supervisor_run_reason_t run_reason);
 
+// Records boot_time_ms the first time it is called after a reset.
+void supervisor_mark_boot_complete(void);
+
 safe_mode_t supervisor_get_safe_mode(void);
 void supervisor_set_safe_mode(safe_mode_t safe_mode);
 
@@ -8,8 +8,10 @@
 #include "py/obj.h"
 #include "py/runtime.h"
 #include "py/objstr.h"
+#include "py/objtuple.h"
 
 #include "shared/runtime/interrupt_char.h"
+#include "supervisor/background_callback.h"
 #include "supervisor/port.h"
 #include "supervisor/shared/display.h"
 #include "supervisor/shared/reload.h"
@@ -318,6 +320,75 @@ static mp_obj_t supervisor_set_usb_identification(size_t n_args, const mp_obj_t
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(supervisor_set_usb_identification_obj, 0, supervisor_set_usb_identification);
 
+//| def background_stats(*, reset: bool = False) -> Tuple[Tuple[int, int, int, int], ...]:
+//|     """Returns how much time each kind of background work has taken since it was last reset,
+//|     to find out what is slowing down the REPL or code. Each item is the address of the
+//|     work's function, the number of times it ran, the total time it took in microseconds and
+//|     the longest single run in microseconds. Look the address up in the firmware's map file.
+//|     Address ``0`` counts the work that didn't fit in its own item. The periodic supervisor
+//|     work, such as display refresh and filesystem flushing, is one function.
+//|
+//|     The same figures are printed in safe mode.
+//|
+//|     :param bool reset: Start counting again after returning the figures
+//|
+//|     Not available on all boards.
+//|     """
+//|     ...
+//|
+//|
+#if CIRCUITPY_BACKGROUND_CALLBACK_STATS
+static mp_obj_t supervisor_background_stats(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_reset };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_reset, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    size_t len;
+    const background_callback_stats_t *stats = background_callback_get_stats(&len);
+    mp_obj_tuple_t *result = MP_OBJ_TO_PTR(mp_obj_new_tuple(len, NULL));
+    for (size_t i = 0; i < len; i++) {
+        mp_obj_t item[4] = {
+            mp_obj_new_int_from_uint((uintptr_t)stats[i].fun),
+            mp_obj_new_int_from_uint(stats[i].calls),
+            mp_obj_new_int_from_ull(stats[i].total * 1000000 / 32768),
+            mp_obj_new_int_from_uint((uint64_t)stats[i].max * 1000000 / 32768),
+        };
+        result->items[i] = mp_obj_new_tuple(4, item);
+    }
+    if (args[ARG_reset].u_bool) {
+        background_callback_reset_stats();
+    }
+    return MP_OBJ_FROM_PTR(result);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(supervisor_background_stats_obj, 0, supervisor_background_stats);
+#endif
+
+//| def heap_stats() -> Tuple[int, int, int]:
+//|     """Returns the free bytes of the heap that buffers outside of the VM come from, such as
+//|     display, USB and network buffers, the size of its largest free block and how fragmented
+//|     it is as a percentage. A fragmentation that keeps rising on a long running board means
+//|     large buffers will fail to allocate even though there is enough free memory."""
+//|     ...
+//|
+//|
+static mp_obj_t supervisor_heap_stats(void) {
+    size_t free_size = port_heap_get_free_size();
+    size_t largest = port_heap_get_largest_free_size();
+    if (largest > free_size) {
+        largest = free_size;
+    }
+    mp_obj_t items[3] = {
+        mp_obj_new_int_from_uint(free_size),
+        mp_obj_new_int_from_uint(largest),
+        MP_OBJ_NEW_SMALL_INT(free_size == 0 ? 0 : 100 - (uint64_t)largest * 100 / free_size),
+    };
+    return mp_obj_new_tuple(3, items);
+}
+MP_DEFINE_CONST_FUN_OBJ_0(supervisor_heap_stats_obj, supervisor_heap_stats);
+
 static const mp_rom_map_elem_t supervisor_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_supervisor) },
     { MP_ROM_QSTR(MP_QSTR_runtime),  MP_ROM_PTR(&common_hal_supervisor_runtime_obj) },
@@ -334,6 +405,10 @@ static const mp_rom_map_elem_t supervisor_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_reset_terminal),  MP_ROM_PTR(&supervisor_reset_terminal_obj) },
     { MP_ROM_QSTR(MP_QSTR_set_usb_identification),  MP_ROM_PTR(&supervisor_set_usb_identification_obj) },
     { MP_ROM_QSTR(MP_QSTR_status_bar),  MP_ROM_PTR(&shared_module_supervisor_status_bar_obj) },
+    #if CIRCUITPY_BACKGROUND_CALLBACK_STATS
+    { MP_ROM_QSTR(MP_QSTR_background_stats),  MP_ROM_PTR(&supervisor_background_stats_obj) },
+    #endif
+    { MP_ROM_QSTR(MP_QSTR_heap_stats),  MP_ROM_PTR(&supervisor_heap_stats_obj) },
 };
 
 static MP_DEFINE_CONST_DICT(supervisor_module_globals, supervisor_module_globals_table);
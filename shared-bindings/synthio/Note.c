@@ -29,6 +29,7 @@ static const mp_arg_t note_properties[] = {
     { MP_QSTR_ring_waveform, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_NONE } },
     { MP_QSTR_ring_waveform_loop_start, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_INT(0) } },
     { MP_QSTR_ring_waveform_loop_end, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_INT(SYNTHIO_WAVEFORM_SIZE) } },
+    { MP_QSTR_band_limited, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_FALSE } },
 };
 //| class Note:
 //|     def __init__(
@@ -48,6 +49,7 @@ static const mp_arg_t note_properties[] = {
 //|         ring_waveform: Optional[ReadableBuffer] = None,
 //|         ring_waveform_loop_start: BlockInput = 0,
 //|         ring_waveform_loop_end: BlockInput = waveform_max_length,
+//|         band_limited: bool = False,
 //|     ) -> None:
 //|         """Construct a Note object, with a frequency in Hz, and optional panning, waveform, envelope, tremolo (volume change) and bend (frequency change).
 //|
@@ -201,6 +203,34 @@ MP_PROPERTY_GETSET(synthio_note_waveform_obj,
 
 
 
+//|     band_limited: bool
+//|     """When True, high notes play band-limited copies of `waveform` so they don't alias.
+//|
+//|     Each copy is half the length of the one before and is made once, when the waveform or
+//|     this property is assigned, using about as much extra memory as the waveform itself.
+//|     Assign the waveform again after changing its contents. The oscillator picks the longest
+//|     copy that advances at most one sample per output sample, so low notes are unchanged,
+//|     and reads the shorter copies with linear interpolation.
+//|
+//|     Copies are only used when the note loops over the whole waveform, and only as long as
+//|     the waveform's length stays even when halved (a power of two length gives the most).
+//|     A note that uses the `Synthesizer`'s waveform is not band-limited."""
+static mp_obj_t synthio_note_get_band_limited(mp_obj_t self_in) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_synthio_note_get_band_limited(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_note_get_band_limited_obj, synthio_note_get_band_limited);
+
+static mp_obj_t synthio_note_set_band_limited(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_note_set_band_limited(self, mp_obj_is_true(arg));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_note_set_band_limited_obj, synthio_note_set_band_limited);
+MP_PROPERTY_GETSET(synthio_note_band_limited_obj,
+    (mp_obj_t)&synthio_note_get_band_limited_obj,
+    (mp_obj_t)&synthio_note_set_band_limited_obj);
+
 //|     waveform_loop_start: BlockInput
 //|     """The sample index of where to begin looping waveform data.
 //|
@@ -388,6 +418,7 @@ static const mp_rom_map_elem_t synthio_note_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_waveform), MP_ROM_PTR(&synthio_note_waveform_obj) },
     { MP_ROM_QSTR(MP_QSTR_waveform_loop_start), MP_ROM_PTR(&synthio_note_waveform_loop_start_obj) },
     { MP_ROM_QSTR(MP_QSTR_waveform_loop_end), MP_ROM_PTR(&synthio_note_waveform_loop_end_obj) },
+    { MP_ROM_QSTR(MP_QSTR_band_limited), MP_ROM_PTR(&synthio_note_band_limited_obj) },
     { MP_ROM_QSTR(MP_QSTR_envelope), MP_ROM_PTR(&synthio_note_envelope_obj) },
     { MP_ROM_QSTR(MP_QSTR_amplitude), MP_ROM_PTR(&synthio_note_amplitude_obj) },
     { MP_ROM_QSTR(MP_QSTR_bend), MP_ROM_PTR(&synthio_note_bend_obj) },
@@ -31,6 +31,9 @@ void common_hal_synthio_note_set_bend(synthio_note_obj_t *self, mp_obj_t value);
 mp_obj_t common_hal_synthio_note_get_waveform_obj(synthio_note_obj_t *self);
 void common_hal_synthio_note_set_waveform(synthio_note_obj_t *self, mp_obj_t value);
 
+bool common_hal_synthio_note_get_band_limited(synthio_note_obj_t *self);
+void common_hal_synthio_note_set_band_limited(synthio_note_obj_t *self, bool value);
+
 mp_obj_t common_hal_synthio_note_get_waveform_loop_start(synthio_note_obj_t *self);
 void common_hal_synthio_note_set_waveform_loop_start(synthio_note_obj_t *self, mp_obj_t value);
 
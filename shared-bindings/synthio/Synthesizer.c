@@ -81,6 +81,10 @@ static void check_for_deinit(synthio_synthesizer_obj_t *self) {
 //|
 //|         Pressing a note that was already pressed has no effect.
 //|
+//|         When all ``max_polyphony`` voices are in use, the quietest released note
+//|         is replaced. If no note has been released, the note that was pressed
+//|         longest ago is cut off.
+//|
 //|         :param NoteOrNoteSequence press: Any sequence of notes."""
 //|
 static mp_obj_t synthio_synthesizer_press(mp_obj_t self_in, mp_obj_t press) {
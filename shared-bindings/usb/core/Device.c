@@ -39,6 +39,7 @@
 
 #include "py/objproperty.h"
 #include "shared-bindings/usb/core/Device.h"
+#include "shared-bindings/usb/core/EndpointStream.h"
 #include "shared-bindings/util.h"
 #include "py/runtime.h"
 
@@ -319,6 +320,36 @@ static mp_obj_t usb_core_device_ctrl_transfer(size_t n_args, const mp_obj_t *pos
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(usb_core_device_ctrl_transfer_obj, 2, usb_core_device_ctrl_transfer);
 
+//|     def open_stream(self, endpoint: int, *, buffer_size: int = 256) -> EndpointStream:
+//|         """Queue transfers on an endpoint in the background instead of waiting for each one.
+//|
+//|         :param int endpoint: the bEndpointAddress you want to communicate with. IN endpoints
+//|           give a stream to read from, OUT endpoints one to write to.
+//|         :param int buffer_size: bytes to buffer between Python and the endpoint. It is raised
+//|           to at least one transfer, which is a few max size packets.
+//|         :returns: the stream for the endpoint
+//|         """
+//|         ...
+//|
+static mp_obj_t usb_core_device_open_stream(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_endpoint, ARG_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_endpoint, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 256} },
+    };
+    usb_core_device_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t buffer_size = mp_arg_validate_int_min(args[ARG_buffer_size].u_int, 1, MP_QSTR_buffer_size);
+
+    usb_core_endpoint_stream_obj_t *stream = mp_obj_malloc(usb_core_endpoint_stream_obj_t, &usb_core_endpoint_stream_type);
+    common_hal_usb_core_endpoint_stream_construct(stream, self, args[ARG_endpoint].u_int, buffer_size);
+    return MP_OBJ_FROM_PTR(stream);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(usb_core_device_open_stream_obj, 2, usb_core_device_open_stream);
+
 //|     def is_kernel_driver_active(self, interface: int) -> bool:
 //|         """Determine if CircuitPython is using the interface. If it is, the
 //|         object will be unable to perform I/O.
@@ -388,6 +419,7 @@ static const mp_rom_map_elem_t usb_core_device_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_write),            MP_ROM_PTR(&usb_core_device_write_obj) },
     { MP_ROM_QSTR(MP_QSTR_read),             MP_ROM_PTR(&usb_core_device_read_obj) },
     { MP_ROM_QSTR(MP_QSTR_ctrl_transfer),    MP_ROM_PTR(&usb_core_device_ctrl_transfer_obj) },
+    { MP_ROM_QSTR(MP_QSTR_open_stream),      MP_ROM_PTR(&usb_core_device_open_stream_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_is_kernel_driver_active), MP_ROM_PTR(&usb_core_device_is_kernel_driver_active_obj) },
     { MP_ROM_QSTR(MP_QSTR_detach_kernel_driver),    MP_ROM_PTR(&usb_core_device_detach_kernel_driver_obj) },
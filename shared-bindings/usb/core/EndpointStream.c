@@ -0,0 +1,214 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 CircuitPython contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "shared-bindings/usb/core/EndpointStream.h"
+#include "shared-bindings/util.h"
+#include "shared/runtime/context_manager_helpers.h"
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "py/stream.h"
+
+//| class EndpointStream:
+//|     """Queued transfers on one endpoint of a `Device`.
+//|
+//|     A transfer is kept queued with the USB host in the background, so data from an IN
+//|     endpoint is received while Python does other things and data written to an OUT
+//|     endpoint is sent without waiting for it. Reads and writes never block: they return
+//|     ``None`` when there is nothing to read or no room to write. Once a transfer fails or
+//|     the device is unplugged, they raise `OSError` with ``errno.EIO`` when they run out of data.
+//|
+//|     It is a stream, so `asyncio` can wait on it with ``asyncio.StreamReader``::
+//|
+//|         import asyncio
+//|         import usb.core
+//|
+//|         device = next(usb.core.find(find_all=True))
+//|         device.set_configuration()
+//|         keys = asyncio.StreamReader(device.open_stream(0x81))
+//|
+//|         async def main():
+//|             while True:
+//|                 report = await keys.read(8)
+//|                 print(report)
+//|
+//|         asyncio.run(main())
+//|     """
+//|
+//|     def __init__(self) -> None:
+//|         """You cannot create an instance of `usb.core.EndpointStream` directly.
+//|         Use `Device.open_stream`."""
+//|         ...
+//|
+
+static usb_core_endpoint_stream_obj_t *native_stream(mp_obj_t self_in) {
+    usb_core_endpoint_stream_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (common_hal_usb_core_endpoint_stream_deinited(self)) {
+        raise_deinited_error();
+    }
+    return self;
+}
+
+//|     def deinit(self) -> None:
+//|         """Stop queueing transfers and release the buffers. Data not read or sent yet is dropped."""
+//|         ...
+//|
+static mp_obj_t usb_core_endpoint_stream_deinit(mp_obj_t self_in) {
+    usb_core_endpoint_stream_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_usb_core_endpoint_stream_deinit(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(usb_core_endpoint_stream_deinit_obj, usb_core_endpoint_stream_deinit);
+
+//|     def __enter__(self) -> EndpointStream:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+
+// These are standard stream methods. Code is in py/stream.c.
+//
+//|     def read(self, nbytes: Optional[int] = None) -> Optional[bytes]:
+//|         """Read at most ``nbytes`` bytes that have been received from an IN endpoint.
+//|
+//|         :return: Data read, or ``None`` if nothing has been received
+//|         :rtype: bytes or None"""
+//|         ...
+//|
+//|     def readinto(self, buf: WriteableBuffer, nbytes: Optional[int] = None) -> Optional[int]:
+//|         """Read bytes received from an IN endpoint into ``buf``.
+//|
+//|         :return: number of bytes read and stored into ``buf``, or ``None`` if nothing has been received
+//|         :rtype: int or None"""
+//|         ...
+//|
+//|     def write(self, buf: ReadableBuffer) -> Optional[int]:
+//|         """Queue bytes to send to an OUT endpoint.
+//|
+//|         :return: the number of bytes queued, or ``None`` if the buffer is full
+//|         :rtype: int or None"""
+//|         ...
+//|
+
+static mp_uint_t usb_core_endpoint_stream_read_stream(mp_obj_t self_in, void *buf_in, mp_uint_t size, int *errcode) {
+    usb_core_endpoint_stream_obj_t *self = native_stream(self_in);
+    if (size == 0) {
+        return 0;
+    }
+    return common_hal_usb_core_endpoint_stream_read(self, buf_in, size, errcode);
+}
+
+static mp_uint_t usb_core_endpoint_stream_write_stream(mp_obj_t self_in, const void *buf_in, mp_uint_t size, int *errcode) {
+    usb_core_endpoint_stream_obj_t *self = native_stream(self_in);
+    if (size == 0) {
+        return 0;
+    }
+    return common_hal_usb_core_endpoint_stream_write(self, buf_in, size, errcode);
+}
+
+static mp_uint_t usb_core_endpoint_stream_ioctl_stream(mp_obj_t self_in, mp_uint_t request, mp_uint_t arg, int *errcode) {
+    usb_core_endpoint_stream_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_uint_t ret = 0;
+    switch (request) {
+        case MP_STREAM_POLL: {
+            if (common_hal_usb_core_endpoint_stream_deinited(self)) {
+                break;
+            }
+            mp_uint_t flags = arg;
+            if ((flags & MP_STREAM_POLL_RD) && common_hal_usb_core_endpoint_stream_readable(self)) {
+                ret |= MP_STREAM_POLL_RD;
+            }
+            if ((flags & MP_STREAM_POLL_WR) && common_hal_usb_core_endpoint_stream_writable(self)) {
+                ret |= MP_STREAM_POLL_WR;
+            }
+            break;
+        }
+
+        case MP_STREAM_CLOSE:
+            common_hal_usb_core_endpoint_stream_deinit(self);
+            break;
+
+        default:
+            *errcode = MP_EINVAL;
+            ret = MP_STREAM_ERROR;
+    }
+    return ret;
+}
+
+//|     endpoint: int
+//|     """The bEndpointAddress transfers are queued on. (read-only)"""
+static mp_obj_t usb_core_endpoint_stream_get_endpoint(mp_obj_t self_in) {
+    usb_core_endpoint_stream_obj_t *self = native_stream(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_usb_core_endpoint_stream_get_endpoint(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_core_endpoint_stream_get_endpoint_obj, usb_core_endpoint_stream_get_endpoint);
+
+MP_PROPERTY_GETTER(usb_core_endpoint_stream_endpoint_obj,
+    (mp_obj_t)&usb_core_endpoint_stream_get_endpoint_obj);
+
+//|     in_waiting: int
+//|     """The number of bytes received and waiting to be read. (read-only)"""
+static mp_obj_t usb_core_endpoint_stream_get_in_waiting(mp_obj_t self_in) {
+    usb_core_endpoint_stream_obj_t *self = native_stream(self_in);
+    return mp_obj_new_int(common_hal_usb_core_endpoint_stream_get_in_waiting(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_core_endpoint_stream_get_in_waiting_obj, usb_core_endpoint_stream_get_in_waiting);
+
+MP_PROPERTY_GETTER(usb_core_endpoint_stream_in_waiting_obj,
+    (mp_obj_t)&usb_core_endpoint_stream_get_in_waiting_obj);
+
+//|     out_waiting: int
+//|     """The number of bytes written and not sent yet. (read-only)"""
+//|
+//|
+static mp_obj_t usb_core_endpoint_stream_get_out_waiting(mp_obj_t self_in) {
+    usb_core_endpoint_stream_obj_t *self = native_stream(self_in);
+    return mp_obj_new_int(common_hal_usb_core_endpoint_stream_get_out_waiting(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_core_endpoint_stream_get_out_waiting_obj, usb_core_endpoint_stream_get_out_waiting);
+
+MP_PROPERTY_GETTER(usb_core_endpoint_stream_out_waiting_obj,
+    (mp_obj_t)&usb_core_endpoint_stream_get_out_waiting_obj);
+
+static const mp_rom_map_elem_t usb_core_endpoint_stream_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___del__),     MP_ROM_PTR(&usb_core_endpoint_stream_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR_deinit),      MP_ROM_PTR(&usb_core_endpoint_stream_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__),   MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__),    MP_ROM_PTR(&default___exit___obj) },
+
+    // Standard stream methods.
+    { MP_ROM_QSTR(MP_QSTR_read),        MP_ROM_PTR(&mp_stream_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto),    MP_ROM_PTR(&mp_stream_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write),       MP_ROM_PTR(&mp_stream_write_obj) },
+
+    { MP_ROM_QSTR(MP_QSTR_endpoint),    MP_ROM_PTR(&usb_core_endpoint_stream_endpoint_obj) },
+    { MP_ROM_QSTR(MP_QSTR_in_waiting),  MP_ROM_PTR(&usb_core_endpoint_stream_in_waiting_obj) },
+    { MP_ROM_QSTR(MP_QSTR_out_waiting), MP_ROM_PTR(&usb_core_endpoint_stream_out_waiting_obj) },
+};
+static MP_DEFINE_CONST_DICT(usb_core_endpoint_stream_locals_dict, usb_core_endpoint_stream_locals_dict_table);
+
+static const mp_stream_p_t usb_core_endpoint_stream_p = {
+    .read = usb_core_endpoint_stream_read_stream,
+    .write = usb_core_endpoint_stream_write_stream,
+    .ioctl = usb_core_endpoint_stream_ioctl_stream,
+    .is_text = false,
+};
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    usb_core_endpoint_stream_type,
+    MP_QSTR_EndpointStream,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    locals_dict, &usb_core_endpoint_stream_locals_dict,
+    protocol, &usb_core_endpoint_stream_p
+    );
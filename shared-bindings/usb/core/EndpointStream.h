@@ -0,0 +1,24 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 CircuitPython contributors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/usb/core/EndpointStream.h"
+
+extern const mp_obj_type_t usb_core_endpoint_stream_type;
+
+void common_hal_usb_core_endpoint_stream_construct(usb_core_endpoint_stream_obj_t *self,
+    usb_core_device_obj_t *device, mp_int_t endpoint, size_t buffer_size);
+bool common_hal_usb_core_endpoint_stream_deinited(usb_core_endpoint_stream_obj_t *self);
+void common_hal_usb_core_endpoint_stream_deinit(usb_core_endpoint_stream_obj_t *self);
+
+size_t common_hal_usb_core_endpoint_stream_read(usb_core_endpoint_stream_obj_t *self, uint8_t *data, size_t len, int *errcode);
+size_t common_hal_usb_core_endpoint_stream_write(usb_core_endpoint_stream_obj_t *self, const uint8_t *data, size_t len, int *errcode);
+uint32_t common_hal_usb_core_endpoint_stream_get_in_waiting(usb_core_endpoint_stream_obj_t *self);
+uint32_t common_hal_usb_core_endpoint_stream_get_out_waiting(usb_core_endpoint_stream_obj_t *self);
+bool common_hal_usb_core_endpoint_stream_readable(usb_core_endpoint_stream_obj_t *self);
+bool common_hal_usb_core_endpoint_stream_writable(usb_core_endpoint_stream_obj_t *self);
+mp_int_t common_hal_usb_core_endpoint_stream_get_endpoint(usb_core_endpoint_stream_obj_t *self);
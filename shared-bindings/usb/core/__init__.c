@@ -15,6 +15,7 @@
 
 #include "shared-bindings/usb/core/__init__.h"
 #include "shared-bindings/usb/core/Device.h"
+#include "shared-bindings/usb/core/EndpointStream.h"
 
 //| """USB Core
 //|
@@ -157,6 +158,7 @@ static mp_rom_map_elem_t usb_core_module_globals_table[] = {
 
     // Classes
     { MP_ROM_QSTR(MP_QSTR_Device),          MP_OBJ_FROM_PTR(&usb_core_device_type) },
+    { MP_ROM_QSTR(MP_QSTR_EndpointStream),  MP_OBJ_FROM_PTR(&usb_core_endpoint_stream_type) },
 
     // Errors
     { MP_ROM_QSTR(MP_QSTR_USBError),        MP_OBJ_FROM_PTR(&mp_type_usb_core_USBError) },
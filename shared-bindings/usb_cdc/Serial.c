@@ -69,14 +69,17 @@
 //|         ...
 //|
 //|     def write(self, buf: ReadableBuffer) -> int:
-//|         """Write as many bytes as possible from the buffer of bytes.
+//|         """Write as many bytes as possible from the buffer of bytes. Large buffers are copied
+//|         straight into the USB FIFO as it empties, so writing big blocks, with `auto_flush`
+//|         off for many small ones, gets the most out of the connection.
 //|
 //|         :return: the number of bytes written
 //|         :rtype: int"""
 //|         ...
 //|
 //|     def flush(self) -> None:
-//|         """Force out any unwritten bytes, waiting until they are written."""
+//|         """Force out any unwritten bytes, waiting until they are written or `write_timeout`
+//|         expires."""
 //|         ...
 //|
 
@@ -215,7 +218,6 @@ MP_PROPERTY_GETSET(usb_cdc_serial_timeout_obj,
 //|     writing all the bytes passed to ``write()``.If 0, do not wait.
 //|     If > 0, wait only ``write_timeout`` seconds."""
 //|
-//|
 static mp_obj_t usb_cdc_serial_get_write_timeout(mp_obj_t self_in) {
     usb_cdc_serial_obj_t *self = MP_OBJ_TO_PTR(self_in);
     mp_float_t write_timeout = common_hal_usb_cdc_serial_get_write_timeout(self);
@@ -235,6 +237,30 @@ MP_PROPERTY_GETSET(usb_cdc_serial_write_timeout_obj,
     (mp_obj_t)&usb_cdc_serial_get_write_timeout_obj,
     (mp_obj_t)&usb_cdc_serial_set_write_timeout_obj);
 
+//|     auto_flush: bool
+//|     """When ``True``, the default, each ``write()`` sends whatever it leaves in the FIFO right
+//|     away, even if that is less than a USB packet. When ``False``, bytes are only sent once a
+//|     full packet is ready, or on `flush()`, which makes many small writes much faster. Call
+//|     `flush()` when the host must see the data now."""
+//|
+//|
+static mp_obj_t usb_cdc_serial_get_auto_flush(mp_obj_t self_in) {
+    usb_cdc_serial_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_usb_cdc_serial_get_auto_flush(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_cdc_serial_get_auto_flush_obj, usb_cdc_serial_get_auto_flush);
+
+static mp_obj_t usb_cdc_serial_set_auto_flush(mp_obj_t self_in, mp_obj_t auto_flush_in) {
+    usb_cdc_serial_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_usb_cdc_serial_set_auto_flush(self, mp_obj_is_true(auto_flush_in));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(usb_cdc_serial_set_auto_flush_obj, usb_cdc_serial_set_auto_flush);
+
+MP_PROPERTY_GETSET(usb_cdc_serial_auto_flush_obj,
+    (mp_obj_t)&usb_cdc_serial_get_auto_flush_obj,
+    (mp_obj_t)&usb_cdc_serial_set_auto_flush_obj);
+
 
 static const mp_rom_map_elem_t usb_cdc_serial_locals_dict_table[] = {
     // Standard stream methods.
@@ -255,6 +281,7 @@ static const mp_rom_map_elem_t usb_cdc_serial_locals_dict_table[] = {
 
     // Not in pyserial protocol.
     { MP_ROM_QSTR(MP_QSTR_connected),     MP_ROM_PTR(&usb_cdc_serial_connected_obj) },
+    { MP_ROM_QSTR(MP_QSTR_auto_flush),    MP_ROM_PTR(&usb_cdc_serial_auto_flush_obj) },
 
 
 
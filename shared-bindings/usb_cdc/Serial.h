@@ -28,3 +28,6 @@ extern void common_hal_usb_cdc_serial_set_timeout(usb_cdc_serial_obj_t *self, mp
 
 extern mp_float_t common_hal_usb_cdc_serial_get_write_timeout(usb_cdc_serial_obj_t *self);
 extern void common_hal_usb_cdc_serial_set_write_timeout(usb_cdc_serial_obj_t *self, mp_float_t write_timeout);
+
+extern bool common_hal_usb_cdc_serial_get_auto_flush(usb_cdc_serial_obj_t *self);
+extern void common_hal_usb_cdc_serial_set_auto_flush(usb_cdc_serial_obj_t *self, bool auto_flush);
@@ -29,11 +29,15 @@
 //|     def write(self, buf: ReadableBuffer) -> Optional[int]:
 //|         """Write the buffer of bytes to the bus.
 //|
-//|         :return: the number of bytes written
+//|         What fits is queued straight away, and the rest waits for room as long as
+//|         `write_timeout` allows. A large buffer, such as a SysEx dump, is sent directly from
+//|         ``buf`` as the host takes it, so there is no need to split it up.
+//|
+//|         :return: the number of bytes written, which is less than ``len(buf)`` when the host
+//|           isn't keeping up, or ``None`` if there was no room at all
 //|         :rtype: int or None"""
 //|         ...
 //|
-//|
 
 static mp_uint_t usb_midi_portout_write(mp_obj_t self_in, const void *buf_in, mp_uint_t size, int *errcode) {
     usb_midi_portout_obj_t *self = MP_OBJ_TO_PTR(self_in);
@@ -58,9 +62,38 @@ static mp_uint_t usb_midi_portout_ioctl(mp_obj_t self_in, mp_uint_t request, mp_
     return ret;
 }
 
+//|     write_timeout: Optional[float]
+//|     """The initial value of `write_timeout` is ``0``, which does not wait, and leaves it to the
+//|     caller to send the rest of what ``write()`` couldn't queue. If ``None``, wait indefinitely
+//|     to finish writing all the bytes passed to ``write()``. If > 0, wait only ``write_timeout``
+//|     seconds. It is set back to ``0`` each time a program starts."""
+//|
+//|
+static mp_obj_t usb_midi_portout_get_write_timeout(mp_obj_t self_in) {
+    usb_midi_portout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_float_t write_timeout = common_hal_usb_midi_portout_get_write_timeout(self);
+    return (write_timeout < 0.0f) ? mp_const_none : mp_obj_new_float(write_timeout);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_midi_portout_get_write_timeout_obj, usb_midi_portout_get_write_timeout);
+
+static mp_obj_t usb_midi_portout_set_write_timeout(mp_obj_t self_in, mp_obj_t write_timeout_in) {
+    usb_midi_portout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_usb_midi_portout_set_write_timeout(self,
+        write_timeout_in == mp_const_none ? -1.0f : mp_obj_get_float(write_timeout_in));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(usb_midi_portout_set_write_timeout_obj, usb_midi_portout_set_write_timeout);
+
+MP_PROPERTY_GETSET(usb_midi_portout_write_timeout_obj,
+    (mp_obj_t)&usb_midi_portout_get_write_timeout_obj,
+    (mp_obj_t)&usb_midi_portout_set_write_timeout_obj);
+
 static const mp_rom_map_elem_t usb_midi_portout_locals_dict_table[] = {
     // Standard stream methods.
     { MP_ROM_QSTR(MP_QSTR_write),    MP_ROM_PTR(&mp_stream_write_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_write_timeout), MP_ROM_PTR(&usb_midi_portout_write_timeout_obj) },
 };
 static MP_DEFINE_CONST_DICT(usb_midi_portout_locals_dict, usb_midi_portout_locals_dict_table);
 
@@ -15,3 +15,6 @@ extern size_t common_hal_usb_midi_portout_write(usb_midi_portout_obj_t *self,
     const uint8_t *data, size_t len, int *errcode);
 
 extern bool common_hal_usb_midi_portout_ready_to_tx(usb_midi_portout_obj_t *self);
+
+extern mp_float_t common_hal_usb_midi_portout_get_write_timeout(usb_midi_portout_obj_t *self);
+extern void common_hal_usb_midi_portout_set_write_timeout(usb_midi_portout_obj_t *self, mp_float_t write_timeout);
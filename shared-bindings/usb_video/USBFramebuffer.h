@@ -12,6 +12,6 @@ extern const mp_obj_type_t usb_video_USBFramebuffer_type;
 extern usb_video_uvcframebuffer_obj_t usb_video_uvcframebuffer_singleton_obj;
 
 void shared_module_usb_video_uvcframebuffer_get_bufinfo(usb_video_uvcframebuffer_obj_t *self, mp_buffer_info_t *bufinfo);
-void shared_module_usb_video_uvcframebuffer_refresh(usb_video_uvcframebuffer_obj_t *self);
+void shared_module_usb_video_uvcframebuffer_refresh(usb_video_uvcframebuffer_obj_t *self, uint8_t *dirty_row_bitmask);
 int shared_module_usb_video_uvcframebuffer_get_width(usb_video_uvcframebuffer_obj_t *self);
 int shared_module_usb_video_uvcframebuffer_get_height(usb_video_uvcframebuffer_obj_t *self);
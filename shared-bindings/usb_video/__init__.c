@@ -48,7 +48,7 @@
 //|
 //|
 
-//| def enable_framebuffer(width: int, height: int) -> None:
+//| def enable_framebuffer(width: int, height: int, *, yuyv: bool = False) -> None:
 //|     """Enable a USB video framebuffer, setting the given width & height
 //|
 //|     This function may only be used from ``boot.py``.
@@ -58,15 +58,23 @@
 //|     After boot.py completes, the framebuffer will be allocated. Total storage
 //|     of 4×``width``×``height`` bytes is required, reducing the amount available
 //|     for Python objects. If the allocation fails, a MemoryError is raised.
-//|     This message can be seen in ``boot_out.txt``."""
+//|     This message can be seen in ``boot_out.txt``.
+//|
+//|     Only the rows changed since the last frame are converted to the USB format.
+//|
+//|     If ``yuyv`` is True, the framebuffer holds YUY2 data, such as frames from a camera,
+//|     and is sent as-is. No conversion is done and only 2×``width``×``height`` bytes are
+//|     needed. Such a framebuffer can't be used with `framebufferio.FramebufferDisplay`,
+//|     which draws RGB565."""
 //|
 //|
 
 static mp_obj_t usb_video_enable_framebuffer(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_width, ARG_height };
+    enum { ARG_width, ARG_height, ARG_yuyv };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_width, MP_ARG_REQUIRED | MP_ARG_INT, { .u_int = 0 } },
         { MP_QSTR_height, MP_ARG_REQUIRED | MP_ARG_INT, { .u_int = 0 } },
+        { MP_QSTR_yuyv, MP_ARG_KW_ONLY | MP_ARG_BOOL, { .u_bool = false } },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -74,7 +82,7 @@ static mp_obj_t usb_video_enable_framebuffer(size_t n_args, const mp_obj_t *pos_
     // (but note that most devices will not be able to allocate this much memory.
     uint32_t width = mp_arg_validate_int_range(args[ARG_width].u_int, 0, 32767, MP_QSTR_width);
     uint32_t height = mp_arg_validate_int_range(args[ARG_height].u_int, 0, 32767, MP_QSTR_height);
-    if (!shared_module_usb_video_enable(width, height)) {
+    if (!shared_module_usb_video_enable(width, height, args[ARG_yuyv].u_bool)) {
         mp_raise_RuntimeError(MP_ERROR_TEXT("Cannot change USB devices now"));
     }
 
@@ -7,6 +7,8 @@
 #pragma once
 
 #include "shared-module/displayio/Bitmap.h"
-bool shared_module_usb_video_enable(mp_int_t frame_width, mp_int_t frame_height);
+bool shared_module_usb_video_enable(mp_int_t frame_width, mp_int_t frame_height, bool yuyv);
 bool shared_module_usb_video_disable(void);
-void shared_module_usb_video_swapbuffers(void);
+// Marks the rows set in dirty_row_bitmask, or every row if it is NULL, for conversion before
+// the next frame is sent.
+void shared_module_usb_video_swapbuffers(const uint8_t *dirty_row_bitmask);
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "shared-module/vectorio/__init__.h"
+#include "shared-module/vectorio/VectorShape.h"
 #include "shared-module/vectorio/Circle.h"
 #include "shared-module/displayio/area.h"
 
@@ -17,6 +18,7 @@ void common_hal_vectorio_circle_construct(vectorio_circle_t *self, uint16_t radi
 void common_hal_vectorio_circle_set_on_dirty(vectorio_circle_t *self, vectorio_event_t notification);
 
 uint32_t common_hal_vectorio_circle_get_pixel(void *circle, int16_t x, int16_t y);
+int common_hal_vectorio_circle_get_spans(void *circle, int16_t y, int16_t x1, int16_t x2, vectorio_span_t *spans);
 
 void common_hal_vectorio_circle_get_area(void *circle, displayio_area_t *out_area);
 
@@ -9,6 +9,7 @@
 #include "shared-module/vectorio/Polygon.h"
 #include "shared-module/displayio/area.h"
 #include "shared-module/vectorio/__init__.h"
+#include "shared-module/vectorio/VectorShape.h"
 
 extern const mp_obj_type_t vectorio_polygon_type;
 
@@ -17,6 +18,7 @@ void common_hal_vectorio_polygon_set_on_dirty(vectorio_polygon_t *self, vectorio
 
 
 uint32_t common_hal_vectorio_polygon_get_pixel(void *polygon, int16_t x, int16_t y);
+int common_hal_vectorio_polygon_get_spans(void *polygon, int16_t y, int16_t x1, int16_t x2, vectorio_span_t *spans);
 
 void common_hal_vectorio_polygon_get_area(void *polygon, displayio_area_t *out_area);
 
@@ -9,6 +9,7 @@
 #include "shared-module/vectorio/Rectangle.h"
 #include "shared-module/displayio/area.h"
 #include "shared-module/vectorio/__init__.h"
+#include "shared-module/vectorio/VectorShape.h"
 
 extern const mp_obj_type_t vectorio_rectangle_type;
 
@@ -16,6 +17,7 @@ void common_hal_vectorio_rectangle_construct(vectorio_rectangle_t *self, uint32_
 void common_hal_vectorio_rectangle_set_on_dirty(vectorio_rectangle_t *self, vectorio_event_t on_dirty);
 
 uint32_t common_hal_vectorio_rectangle_get_pixel(void *rectangle, int16_t x, int16_t y);
+int common_hal_vectorio_rectangle_get_spans(void *rectangle, int16_t y, int16_t x1, int16_t x2, vectorio_span_t *spans);
 
 void common_hal_vectorio_rectangle_get_area(void *rectangle, displayio_area_t *out_area);
 
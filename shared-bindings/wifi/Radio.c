@@ -460,7 +460,11 @@ MP_PROPERTY_GETTER(wifi_radio_ap_active_obj,
 //|         significantly because a full scan doesn't occur.
 //|
 //|         If ``bssid`` is given and not None, the scan will start at the first channel or the one given and
-//|         connect to the AP with the given ``bssid`` and ``ssid``."""
+//|         connect to the AP with the given ``bssid`` and ``ssid``.
+//|
+//|         On ports that support it, the BSSID and channel of the last successful connection are kept
+//|         across deep sleep. When neither ``channel`` nor ``bssid`` is given and ``ssid`` matches,
+//|         that AP is tried directly first and the full scan only happens if it can't be reached."""
 //|         ...
 //|
 static mp_obj_t wifi_radio_connect(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
@@ -0,0 +1,112 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/zlib/DecompIO.h"
+
+#include "py/runtime.h"
+#include "py/stream.h"
+
+//| class DecompIO:
+//|     """Decompresses data from a stream as it is read, so neither the compressed nor the
+//|     decompressed data has to fit in memory at once."""
+//|
+//|     def __init__(self, stream: circuitpython_typing.ByteStream, wbits: int = 0) -> None:
+//|         """Reads compressed data from *stream* as decompressed data is read from the
+//|         `DecompIO`. *wbits* selects the format the same way as for `zlib.decompress()`:
+//|
+//|         * 0 to 15 for the zlib format. The window size is taken from the zlib header.
+//|         * -15 to -8 for raw DEFLATE data, with a window of ``2 ** -wbits`` bytes.
+//|         * 24 to 31 for the gzip format, with a window of ``2 ** (wbits - 16)`` bytes.
+//|
+//|         The window, which holds the most recent decompressed data that later data can
+//|         refer back to, is the only buffer that grows with the compression settings.
+//|         Compressed data is read from *stream* in small blocks, so a `DecompIO` may read
+//|         a little past the end of the compressed data. If *stream* ends before the
+//|         compressed data does, reading raises `EOFError`.
+//|
+//|         For example, to save a gzip-compressed HTTP response without buffering it::
+//|
+//|             import zlib
+//|
+//|             with open("/data.bin", "wb") as f:
+//|                 body = zlib.DecompIO(response.socket, 31)
+//|                 buf = bytearray(512)
+//|                 while n := body.readinto(buf):
+//|                     f.write(memoryview(buf)[:n])
+//|
+//|         :param ~circuitpython_typing.ByteStream stream: stream to read compressed data from
+//|         :param int wbits: the format and window size of the data. See above.
+//|         """
+//|         ...
+//|
+//|     def read(self, size: int = -1) -> bytes:
+//|         """Read and decompress up to *size* bytes, or to the end of the data if *size* is
+//|         not given or negative.
+//|
+//|         :return: the decompressed data; ``b''`` at the end of the data
+//|         :rtype: bytes"""
+//|         ...
+//|
+//|     def readinto(self, buf: WriteableBuffer) -> int:
+//|         """Read and decompress up to ``len(buf)`` bytes into *buf*.
+//|
+//|         :return: number of bytes stored in *buf*; 0 at the end of the data
+//|         :rtype: int"""
+//|         ...
+//|
+//|     def readline(self, size: int = -1) -> bytes:
+//|         r"""Read a line ending in a newline character ("\\n"), including the newline.
+//|
+//|         :return: the line read
+//|         :rtype: bytes"""
+//|         ...
+//|
+static mp_obj_t zlib_decompio_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_stream, ARG_wbits };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_stream, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_wbits, MP_ARG_INT, { .u_int = 0 } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t wbits = args[ARG_wbits].u_int;
+    if (wbits < 0) {
+        mp_arg_validate_int_range(wbits, -15, -8, MP_QSTR_wbits);
+    } else if (wbits >= 16) {
+        mp_arg_validate_int_range(wbits, 24, 31, MP_QSTR_wbits);
+    }
+
+    zlib_decompio_obj_t *self = mp_obj_malloc(zlib_decompio_obj_t, &zlib_decompio_type);
+    common_hal_zlib_decompio_construct(self, args[ARG_stream].u_obj, wbits);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static mp_uint_t zlib_decompio_read_stream(mp_obj_t self_in, void *buf, mp_uint_t size, int *errcode) {
+    zlib_decompio_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_zlib_decompio_read(self, buf, size, errcode);
+}
+
+static const mp_rom_map_elem_t zlib_decompio_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_read), MP_ROM_PTR(&mp_stream_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&mp_stream_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readline), MP_ROM_PTR(&mp_stream_unbuffered_readline_obj) },
+};
+static MP_DEFINE_CONST_DICT(zlib_decompio_locals_dict, zlib_decompio_locals_dict_table);
+
+static const mp_stream_p_t zlib_decompio_stream_p = {
+    .read = zlib_decompio_read_stream,
+    .is_text = false,
+};
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    zlib_decompio_type,
+    MP_QSTR_DecompIO,
+    MP_TYPE_FLAG_NONE,
+    make_new, zlib_decompio_make_new,
+    locals_dict, &zlib_decompio_locals_dict,
+    protocol, &zlib_decompio_stream_p
+    );
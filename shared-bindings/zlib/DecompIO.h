@@ -0,0 +1,14 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/zlib/DecompIO.h"
+
+extern const mp_obj_type_t zlib_decompio_type;
+
+void common_hal_zlib_decompio_construct(zlib_decompio_obj_t *self, mp_obj_t stream, mp_int_t wbits);
+mp_uint_t common_hal_zlib_decompio_read(zlib_decompio_obj_t *self, uint8_t *buf, size_t len, int *errcode);
@@ -18,12 +18,14 @@
 #include "py/parsenum.h"
 
 #include "shared-bindings/zlib/__init__.h"
+#include "shared-bindings/zlib/DecompIO.h"
 
 //| """zlib decompression functionality
 //|
 //| The `zlib` module allows limited functionality similar to the CPython zlib library.
 //| This module allows to decompress binary data compressed with DEFLATE algorithm
-//| (commonly used in zlib library and gzip archiver). Compression is not yet implemented."""
+//| (commonly used in zlib library and gzip archiver). `DecompIO` decompresses data from a stream
+//| as it is read. Compression is not yet implemented."""
 //|
 //|
 
@@ -63,6 +65,7 @@ static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(zlib_decompress_obj, 1, 3, zlib_decom
 static const mp_rom_map_elem_t zlib_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_zlib) },
     { MP_ROM_QSTR(MP_QSTR_decompress), MP_ROM_PTR(&zlib_decompress_obj) },
+    { MP_ROM_QSTR(MP_QSTR_DecompIO), MP_ROM_PTR(&zlib_decompio_type) },
 };
 
 static MP_DEFINE_CONST_DICT(zlib_globals, zlib_globals_table);
@@ -20,14 +20,35 @@ bleio_scanresults_obj_t *shared_module_bleio_new_scanresults(size_t buffer_size,
     self->prefixes = prefixes;
     self->prefix_length = prefixes_len;
     self->minimum_rssi = minimum_rssi;
+    self->addresses = NULL;
+    self->addresses_count = 0;
+    self->duplicate_window_ms = 0;
+    self->seen = NULL;
     return self;
 }
 
-mp_obj_t common_hal_bleio_scanresults_next(bleio_scanresults_obj_t *self) {
+// Wait for an entry, unless scanning has finished. Returns false when there is none to read.
+static bool wait_for_entry(bleio_scanresults_obj_t *self) {
     while (ringbuf_num_filled(&self->buf) == 0 && !self->done && !mp_hal_is_interrupted()) {
         RUN_BACKGROUND_TASKS;
     }
-    if (ringbuf_num_filled(&self->buf) == 0 || mp_hal_is_interrupted()) {
+    return ringbuf_num_filled(&self->buf) != 0 && !mp_hal_is_interrupted();
+}
+
+// Read the fixed size fields of the next entry. The caller must have interrupts disabled and then
+// read or skip the len bytes of advertising data that follow.
+static void get_entry_header(bleio_scanresults_obj_t *self, uint8_t *type, uint64_t *ticks_ms,
+    int8_t *rssi, uint8_t *peer_addr, uint8_t *addr_type, uint16_t *len) {
+    *type = ringbuf_get(&self->buf);
+    ringbuf_get_n(&self->buf, (uint8_t *)ticks_ms, sizeof(*ticks_ms));
+    *rssi = ringbuf_get(&self->buf);
+    ringbuf_get_n(&self->buf, peer_addr, NUM_BLEIO_ADDRESS_BYTES);
+    *addr_type = ringbuf_get(&self->buf);
+    ringbuf_get_n(&self->buf, (uint8_t *)len, sizeof(*len));
+}
+
+mp_obj_t common_hal_bleio_scanresults_next(bleio_scanresults_obj_t *self) {
+    if (!wait_for_entry(self)) {
         return mp_const_none;
     }
 
@@ -36,17 +57,15 @@ mp_obj_t common_hal_bleio_scanresults_next(bleio_scanresults_obj_t *self) {
     // Remove data atomically.
     common_hal_mcu_disable_interrupts();
 
-    uint8_t type = ringbuf_get(&self->buf);
-    bool connectable = (type & (1 << 0)) != 0;
-    bool scan_response = (type & (1 << 1)) != 0;
+    uint8_t type;
     uint64_t ticks_ms;
-    ringbuf_get_n(&self->buf, (uint8_t *)&ticks_ms, sizeof(ticks_ms));
-    int8_t rssi = ringbuf_get(&self->buf);
+    int8_t rssi;
     uint8_t peer_addr[NUM_BLEIO_ADDRESS_BYTES];
-    ringbuf_get_n(&self->buf, peer_addr, sizeof(peer_addr));
-    uint8_t addr_type = ringbuf_get(&self->buf);
+    uint8_t addr_type;
     uint16_t len;
-    ringbuf_get_n(&self->buf, (uint8_t *)&len, sizeof(len));
+    get_entry_header(self, &type, &ticks_ms, &rssi, peer_addr, &addr_type, &len);
+    bool connectable = (type & (1 << 0)) != 0;
+    bool scan_response = (type & (1 << 1)) != 0;
     mp_obj_str_t *o = MP_OBJ_TO_PTR(mp_obj_new_bytes_of_zeros(len));
     ringbuf_get_n(&self->buf, (uint8_t *)o->data, len);
 
@@ -67,6 +86,109 @@ mp_obj_t common_hal_bleio_scanresults_next(bleio_scanresults_obj_t *self) {
     return MP_OBJ_FROM_PTR(entry);
 }
 
+// Copy entries into fixed size records without allocating: the address, address type, rssi, the
+// connectable and scan response flags, a zero byte, the data length, the low 32 bits of the
+// receive time and then as much of the data as fits. Returns the number of records filled.
+size_t common_hal_bleio_scanresults_readinto(bleio_scanresults_obj_t *self, uint8_t *records, size_t records_len, size_t record_size) {
+    if (!wait_for_entry(self)) {
+        return 0;
+    }
+
+    size_t count = 0;
+    size_t data_size = record_size - BLEIO_SCAN_RECORD_HEADER_SIZE;
+
+    // Remove data atomically, one entry at a time so the radio isn't held off for long.
+    while (records_len >= record_size) {
+        common_hal_mcu_disable_interrupts();
+        if (ringbuf_num_filled(&self->buf) == 0) {
+            common_hal_mcu_enable_interrupts();
+            break;
+        }
+
+        uint8_t type;
+        uint64_t ticks_ms;
+        int8_t rssi;
+        uint8_t addr_type;
+        uint16_t len;
+        get_entry_header(self, &type, &ticks_ms, &rssi, records, &addr_type, &len);
+        uint16_t copied = MIN(len, data_size);
+        ringbuf_get_n(&self->buf, records + BLEIO_SCAN_RECORD_HEADER_SIZE, copied);
+        for (uint16_t i = copied; i < len; i++) {
+            ringbuf_get(&self->buf);
+        }
+
+        common_hal_mcu_enable_interrupts();
+
+        records[6] = addr_type;
+        records[7] = rssi;
+        records[8] = type;
+        records[9] = 0;
+        records[10] = len;
+        records[11] = len >> 8;
+        for (size_t i = 0; i < 4; i++) {
+            records[12 + i] = ticks_ms >> (8 * i);
+        }
+        memset(records + BLEIO_SCAN_RECORD_HEADER_SIZE + copied, 0, data_size - copied);
+
+        records += record_size;
+        records_len -= record_size;
+        count++;
+    }
+    return count;
+}
+
+// Returns true when the advertiser was already heard within the duplicate window, and otherwise
+// remembers it in place of the advertiser heard from longest ago.
+static bool is_duplicate(bleio_scanresults_obj_t *self, uint64_t ticks_ms, bool scan_response, const uint8_t *peer_addr) {
+    uint32_t now = ticks_ms;
+    bleio_scanresults_seen_t *oldest = &self->seen[0];
+    for (size_t i = 0; i < BLEIO_SCAN_DUPLICATE_TABLE_SIZE; i++) {
+        bleio_scanresults_seen_t *seen = &self->seen[i];
+        if (seen->scan_response == scan_response &&
+            memcmp(seen->peer_addr, peer_addr, NUM_BLEIO_ADDRESS_BYTES) == 0) {
+            if (now - seen->ticks_ms < self->duplicate_window_ms) {
+                return true;
+            }
+            oldest = seen;
+            break;
+        }
+        if (now - seen->ticks_ms > now - oldest->ticks_ms) {
+            oldest = seen;
+        }
+    }
+    memcpy(oldest->peer_addr, peer_addr, NUM_BLEIO_ADDRESS_BYTES);
+    oldest->scan_response = scan_response;
+    oldest->ticks_ms = now;
+    return false;
+}
+
+static bool address_matches(bleio_scanresults_obj_t *self, const uint8_t *peer_addr) {
+    if (self->addresses == NULL) {
+        return true;
+    }
+    for (size_t i = 0; i < self->addresses_count; i++) {
+        if (memcmp(self->addresses + i * NUM_BLEIO_ADDRESS_BYTES, peer_addr, NUM_BLEIO_ADDRESS_BYTES) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void shared_module_bleio_scanresults_set_filter(bleio_scanresults_obj_t *self, uint8_t *addresses, size_t addresses_count, uint32_t duplicate_window_ms) {
+    bleio_scanresults_seen_t *seen = NULL;
+    if (duplicate_window_ms > 0) {
+        seen = m_new0(bleio_scanresults_seen_t, BLEIO_SCAN_DUPLICATE_TABLE_SIZE);
+    }
+
+    common_hal_mcu_disable_interrupts();
+    self->addresses = addresses;
+    self->addresses_count = addresses_count;
+    self->duplicate_window_ms = duplicate_window_ms;
+    self->seen = seen;
+    // Drop anything that arrived before the filter was in place.
+    ringbuf_clear(&self->buf);
+    common_hal_mcu_enable_interrupts();
+}
 
 void shared_module_bleio_scanresults_append(bleio_scanresults_obj_t *self,
     uint64_t ticks_ms,
@@ -82,10 +204,15 @@ void shared_module_bleio_scanresults_append(bleio_scanresults_obj_t *self,
         return;
     }
 
+    if (!address_matches(self, peer_addr)) {
+        return;
+    }
+
     // If any prefixes are provided, then only include packets that include at least one of them.
     if (!bleio_scanentry_data_matches(data, len, self->prefixes, self->prefix_length, true)) {
         return;
     }
+
     uint8_t type = 0;
     if (connectable) {
         type |= 1 << 0;
@@ -102,7 +229,9 @@ void shared_module_bleio_scanresults_append(bleio_scanresults_obj_t *self,
         sizeof(addr_type) + sizeof(len) + len;
     int32_t empty_space = self->buf.size - ringbuf_num_filled(&self->buf);
 
-    if (packet_size <= empty_space) {
+    // Only advertisers that make it into the buffer count as heard for duplicate filtering.
+    if (packet_size <= empty_space &&
+        (self->seen == NULL || !is_duplicate(self, ticks_ms, scan_response, peer_addr))) {
         // Packet will fit.
         ringbuf_put(&self->buf, type);
         ringbuf_put_n(&self->buf, (uint8_t *)&ticks_ms, sizeof(ticks_ms));
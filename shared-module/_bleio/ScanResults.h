@@ -11,6 +11,21 @@
 
 #include "py/obj.h"
 #include "py/ringbuf.h"
+#include "shared-module/_bleio/Address.h"
+
+// The number of advertisers remembered for duplicate filtering. When more are in range, the one
+// heard from longest ago is forgotten first.
+#define BLEIO_SCAN_DUPLICATE_TABLE_SIZE (16)
+
+// The fixed part of each record written by common_hal_bleio_scanresults_readinto(), before the
+// advertising data.
+#define BLEIO_SCAN_RECORD_HEADER_SIZE (16)
+
+typedef struct {
+    uint8_t peer_addr[NUM_BLEIO_ADDRESS_BYTES];
+    bool scan_response;
+    uint32_t ticks_ms;
+} bleio_scanresults_seen_t;
 
 typedef struct {
     mp_obj_base_t base;
@@ -20,6 +35,12 @@ typedef struct {
     // Prefixes is a length encoded array of prefixes.
     uint8_t *prefixes;
     size_t prefix_length;
+    // Addresses is a packed array of addresses_count addresses to accept. NULL accepts any.
+    uint8_t *addresses;
+    size_t addresses_count;
+    // Repeats from the same advertiser within this many milliseconds are dropped when non-zero.
+    uint32_t duplicate_window_ms;
+    bleio_scanresults_seen_t *seen;
     mp_int_t minimum_rssi;
     bool active;
     bool done;
@@ -27,6 +48,8 @@ typedef struct {
 
 bleio_scanresults_obj_t *shared_module_bleio_new_scanresults(size_t buffer_size, uint8_t *prefixes, size_t prefixes_len, mp_int_t minimum_rssi);
 
+void shared_module_bleio_scanresults_set_filter(bleio_scanresults_obj_t *self, uint8_t *addresses, size_t addresses_count, uint32_t duplicate_window_ms);
+
 bool shared_module_bleio_scanresults_get_done(bleio_scanresults_obj_t *self);
 void shared_module_bleio_scanresults_set_done(bleio_scanresults_obj_t *self, bool done);
 
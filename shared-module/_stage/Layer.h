@@ -20,6 +20,10 @@ typedef struct {
     uint8_t width, height;
     uint8_t frame;
     uint8_t rotation;
+    // Where render_dirty() last drew the layer, and whether it changed since.
+    int16_t rendered_x, rendered_y;
+    bool rendered;
+    bool dirty;
 } layer_obj_t;
 
 uint16_t get_layer_pixel(layer_obj_t *layer, int16_t x, int16_t y);
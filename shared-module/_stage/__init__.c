@@ -9,6 +9,13 @@
 #include "__init__.h"
 #include "shared-bindings/_stage/Layer.h"
 #include "shared-bindings/_stage/Text.h"
+#include "shared-module/displayio/area.h"
+#include "shared-module/displayio/display_core.h"
+
+// The most separate regions that render_dirty() sends in one frame.
+#define MAX_DIRTY_AREAS (8)
+// Merge regions when that draws no more than one extra tile's worth of pixels.
+#define DIRTY_MERGE_COST (16 * 16)
 
 
 void render_stage(
@@ -76,3 +83,61 @@ void render_stage(
 
     displayio_display_bus_end_transaction(&display->bus);
 }
+
+static uint8_t add_dirty_area(displayio_area_t *areas, uint8_t count,
+    const layer_obj_t *layer, int16_t x, int16_t y,
+    int16_t vx, int16_t vy, const displayio_area_t *screen) {
+    displayio_area_t area = {
+        .x1 = x - vx,
+        .y1 = y - vy,
+        .x2 = x - vx + (layer->width << 4),
+        .y2 = y - vy + (layer->height << 4),
+        .next = NULL,
+    };
+    displayio_area_t clipped;
+    if (!displayio_area_compute_overlap(&area, screen, &clipped)) {
+        return count;
+    }
+    return displayio_area_coalesce(areas, count, MAX_DIRTY_AREAS, &clipped, DIRTY_MERGE_COST);
+}
+
+size_t render_dirty(
+    mp_obj_t *sprites, size_t sprites_size,
+    int16_t vx, int16_t vy,
+    mp_obj_t *layers, size_t layers_size,
+    uint16_t *buffer, size_t buffer_size,
+    busdisplay_busdisplay_obj_t *display,
+    uint8_t scale, uint16_t background) {
+
+    displayio_area_t screen = {
+        .x1 = 0,
+        .y1 = 0,
+        .x2 = displayio_display_core_get_width(&display->core) / scale,
+        .y2 = displayio_display_core_get_height(&display->core) / scale,
+        .next = NULL,
+    };
+
+    // Collect where the changed sprites were and where they are now.
+    displayio_area_t areas[MAX_DIRTY_AREAS];
+    uint8_t count = 0;
+    for (size_t i = 0; i < sprites_size; ++i) {
+        layer_obj_t *sprite = MP_OBJ_TO_PTR(sprites[i]);
+        if (!sprite->dirty) {
+            continue;
+        }
+        if (sprite->rendered) {
+            count = add_dirty_area(areas, count, sprite, sprite->rendered_x, sprite->rendered_y, vx, vy, &screen);
+        }
+        count = add_dirty_area(areas, count, sprite, sprite->x, sprite->y, vx, vy, &screen);
+        sprite->rendered_x = sprite->x;
+        sprite->rendered_y = sprite->y;
+        sprite->rendered = true;
+        sprite->dirty = false;
+    }
+
+    for (uint8_t i = 0; i < count; ++i) {
+        render_stage(areas[i].x1, areas[i].y1, areas[i].x2, areas[i].y2, vx, vy,
+            layers, layers_size, buffer, buffer_size, display, scale, background);
+    }
+    return count;
+}
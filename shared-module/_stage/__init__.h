@@ -21,3 +21,11 @@ void render_stage(
     uint16_t *buffer, size_t buffer_size,
     busdisplay_busdisplay_obj_t *display,
     uint8_t scale, uint16_t background);
+
+size_t render_dirty(
+    mp_obj_t *sprites, size_t sprites_size,
+    int16_t vx, int16_t vy,
+    mp_obj_t *layers, size_t layers_size,
+    uint16_t *buffer, size_t buffer_size,
+    busdisplay_busdisplay_obj_t *display,
+    uint8_t scale, uint16_t background);
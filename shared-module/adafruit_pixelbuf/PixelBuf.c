@@ -10,6 +10,9 @@
 #include "py/objtype.h"
 #include "py/runtime.h"
 #include "shared-bindings/adafruit_pixelbuf/PixelBuf.h"
+#if CIRCUITPY_NEOPIXEL_WRITE
+#include "shared-bindings/neopixel_write/__init__.h"
+#endif
 #include <string.h>
 #include <math.h>
 
@@ -22,7 +25,7 @@ static pixelbuf_pixelbuf_obj_t *native_pixelbuf(mp_obj_t pixelbuf_obj) {
 
 void common_hal_adafruit_pixelbuf_pixelbuf_construct(pixelbuf_pixelbuf_obj_t *self, size_t n,
     pixelbuf_byteorder_details_t *byteorder, mp_float_t brightness, bool auto_write,
-    uint8_t *header, size_t header_len, uint8_t *trailer, size_t trailer_len) {
+    uint8_t *header, size_t header_len, uint8_t *trailer, size_t trailer_len, bool double_buffer) {
 
     self->pixel_count = n;
     self->byteorder = *byteorder;  // Copied because we modify for dotstar
@@ -37,6 +40,8 @@ void common_hal_adafruit_pixelbuf_pixelbuf_construct(pixelbuf_pixelbuf_obj_t *se
     memcpy(transmit_buffer, header, header_len);
     memcpy(transmit_buffer + header_len + pixel_len, trailer, trailer_len);
     self->post_brightness_buffer = transmit_buffer + header_len;
+    // Filled from the first buffer when they swap.
+    self->back_transmit_buffer_obj = double_buffer ? mp_obj_new_bytearray_of_zeros(o->len) : MP_OBJ_NULL;
 
     if (self->byteorder.is_dotstar) {
         // Initialize the buffer with the dotstar start bytes.
@@ -301,6 +306,33 @@ void common_hal_adafruit_pixelbuf_pixelbuf_show(mp_obj_t self_in) {
     dest[2] = self->transmit_buffer_obj;
 
     mp_call_method_n_kw(1, 0, dest);
+
+    if (self->back_transmit_buffer_obj != MP_OBJ_NULL) {
+        // _transmit may still be sending the buffer, so later changes go to a copy of it. The copy
+        // was sent last time, which finished before this one started.
+        mp_obj_array_t *front = MP_OBJ_TO_PTR(self->transmit_buffer_obj);
+        mp_obj_array_t *back = MP_OBJ_TO_PTR(self->back_transmit_buffer_obj);
+        memcpy(back->items, front->items, front->len);
+        self->post_brightness_buffer = (uint8_t *)back->items + (self->post_brightness_buffer - (uint8_t *)front->items);
+        self->back_transmit_buffer_obj = self->transmit_buffer_obj;
+        self->transmit_buffer_obj = MP_OBJ_FROM_PTR(back);
+    }
+}
+
+mp_obj_t common_hal_adafruit_pixelbuf_pixelbuf_get_transmit_buffer(mp_obj_t self_in) {
+    pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
+    return self->transmit_buffer_obj;
+}
+
+bool common_hal_adafruit_pixelbuf_pixelbuf_get_is_showing(mp_obj_t self_in) {
+    #if CIRCUITPY_NEOPIXEL_WRITE
+    pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
+    return shared_bindings_neopixel_write_is_writing(self->transmit_buffer_obj) ||
+           (self->back_transmit_buffer_obj != MP_OBJ_NULL &&
+            shared_bindings_neopixel_write_is_writing(self->back_transmit_buffer_obj));
+    #else
+    return false;
+    #endif
 }
 
 void common_hal_adafruit_pixelbuf_pixelbuf_fill(mp_obj_t self_in, mp_obj_t fill_color) {
@@ -32,6 +32,9 @@ typedef struct {
     pixelbuf_byteorder_details_t byteorder;
     mp_float_t brightness;
     mp_obj_t transmit_buffer_obj;
+    // The other transmit buffer when double buffered, or MP_OBJ_NULL. It's the one last passed to
+    // _transmit, which may still be sending it.
+    mp_obj_t back_transmit_buffer_obj;
     // The post_brightness_buffer is offset into the buffer allocated in transmit_buffer_obj to
     // account for any header.
     uint8_t *post_brightness_buffer;
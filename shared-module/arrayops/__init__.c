@@ -0,0 +1,393 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/arrayops/__init__.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "py/misc.h"
+
+// Each operation is a loop over one element type, made for each typecode by the macros below.
+// Integer loops work in a wider type, 32 bits for elements up to 16 bits and 64 bits otherwise,
+// and saturate at the limits of the element type instead of wrapping.
+
+static inline int32_t sat_add32(int32_t a, int32_t b) {
+    int32_t r;
+    if (__builtin_add_overflow(a, b, &r)) {
+        return a < 0 ? INT32_MIN : INT32_MAX;
+    }
+    return r;
+}
+
+static inline int32_t sat_mul32(int32_t a, int32_t b) {
+    int32_t r;
+    if (__builtin_mul_overflow(a, b, &r)) {
+        return (a < 0) != (b < 0) ? INT32_MIN : INT32_MAX;
+    }
+    return r;
+}
+
+static inline int64_t sat_add64(int64_t a, int64_t b) {
+    int64_t r;
+    if (__builtin_add_overflow(a, b, &r)) {
+        return a < 0 ? INT64_MIN : INT64_MAX;
+    }
+    return r;
+}
+
+static inline int64_t sat_mul64(int64_t a, int64_t b) {
+    int64_t r;
+    if (__builtin_mul_overflow(a, b, &r)) {
+        return (a < 0) != (b < 0) ? INT64_MIN : INT64_MAX;
+    }
+    return r;
+}
+
+static inline int32_t clamp_to32(int64_t v) {
+    return v < INT32_MIN ? INT32_MIN : v > INT32_MAX ? INT32_MAX : (int32_t)v;
+}
+
+static inline int64_t clamp_to64(int64_t v) {
+    return v;
+}
+
+// Products of elements up to 16 bits can't overflow 64 bits, nor can their sums.
+static inline int64_t dot_mul32(int64_t a, int64_t b) {
+    return a * b;
+}
+
+static inline int64_t dot_add32(int64_t a, int64_t b) {
+    return a + b;
+}
+
+#define dot_mul64 sat_mul64
+#define dot_add64 sat_add64
+
+#define ARRAYOPS_ADD_OP(BITS, a, b) sat_add##BITS(a, b)
+#define ARRAYOPS_MUL_OP(BITS, a, b) sat_mul##BITS(a, b)
+
+#define ARRAYOPS_INT_FUNCS(T, LO, HI, BITS) \
+    static inline T clamp_##T(int##BITS##_t v) { \
+        return v < LO ? LO : v > HI ? HI : (T)v; \
+    } \
+    static inline T from_float_##T(mp_float_t v) { \
+        v += v < 0 ? MICROPY_FLOAT_CONST(-0.5) : MICROPY_FLOAT_CONST(0.5); \
+        if (!(v > (mp_float_t)LO)) { \
+            return LO; \
+        } \
+        if (v >= (mp_float_t)HI) { \
+            return HI; \
+        } \
+        return (T)v; \
+    } \
+    static void combine_##T(void *dest_in, const void *other_in, size_t n, arrayops_op_t op) { \
+        T *dest = dest_in; \
+        const T *other = other_in; \
+        if (op == ARRAYOPS_ADD) { \
+            for (size_t i = 0; i < n; i++) { \
+                dest[i] = clamp_##T(ARRAYOPS_ADD_OP(BITS, dest[i], other[i])); \
+            } \
+        } else { \
+            for (size_t i = 0; i < n; i++) { \
+                dest[i] = clamp_##T(ARRAYOPS_MUL_OP(BITS, dest[i], other[i])); \
+            } \
+        } \
+    } \
+    static void combine_scalar_##T(void *dest_in, size_t n, arrayops_value_t value, arrayops_op_t op) { \
+        T *dest = dest_in; \
+        int##BITS##_t v = clamp_to##BITS(value.i); \
+        if (op == ARRAYOPS_ADD) { \
+            for (size_t i = 0; i < n; i++) { \
+                dest[i] = clamp_##T(ARRAYOPS_ADD_OP(BITS, dest[i], v)); \
+            } \
+        } else { \
+            for (size_t i = 0; i < n; i++) { \
+                dest[i] = clamp_##T(ARRAYOPS_MUL_OP(BITS, dest[i], v)); \
+            } \
+        } \
+    } \
+    static void scale_##T(void *dest_in, size_t n, mp_float_t factor, mp_float_t offset) { \
+        T *dest = dest_in; \
+        for (size_t i = 0; i < n; i++) { \
+            dest[i] = from_float_##T((mp_float_t)dest[i] * factor + offset); \
+        } \
+    } \
+    static void clip_##T(void *dest_in, size_t n, arrayops_value_t low, arrayops_value_t high) { \
+        T *dest = dest_in; \
+        T lo = clamp_##T(clamp_to##BITS(low.i)); \
+        T hi = clamp_##T(clamp_to##BITS(high.i)); \
+        for (size_t i = 0; i < n; i++) { \
+            T v = dest[i] < lo ? lo : dest[i]; \
+            dest[i] = v > hi ? hi : v; \
+        } \
+    } \
+    static void sum_##T(const void *src_in, size_t n, arrayops_value_t *result) { \
+        const T *src = src_in; \
+        int64_t acc = 0; \
+        for (size_t i = 0; i < n; i++) { \
+            acc += src[i]; \
+        } \
+        result->i = acc; \
+    } \
+    static void dot_##T(const void *a_in, const void *b_in, size_t n, arrayops_value_t *result) { \
+        const T *a = a_in; \
+        const T *b = b_in; \
+        int64_t acc = 0; \
+        for (size_t i = 0; i < n; i++) { \
+            acc = dot_add##BITS(acc, dot_mul##BITS(a[i], b[i])); \
+        } \
+        result->i = acc; \
+    } \
+    static void extreme_##T(const void *src_in, size_t n, bool maximum, arrayops_value_t *result) { \
+        const T *src = src_in; \
+        T best = src[0]; \
+        if (maximum) { \
+            for (size_t i = 1; i < n; i++) { \
+                best = src[i] > best ? src[i] : best; \
+            } \
+        } else { \
+            for (size_t i = 1; i < n; i++) { \
+                best = src[i] < best ? src[i] : best; \
+            } \
+        } \
+        result->i = best; \
+    } \
+    static void load_int_##T(const void *src_in, int64_t *out, size_t n) { \
+        const T *src = src_in; \
+        for (size_t i = 0; i < n; i++) { \
+            out[i] = src[i]; \
+        } \
+    } \
+    static void store_int_##T(void *dest_in, const int64_t *in, size_t n) { \
+        T *dest = dest_in; \
+        for (size_t i = 0; i < n; i++) { \
+            dest[i] = clamp_##T(clamp_to##BITS(in[i])); \
+        } \
+    } \
+    static void load_float_##T(const void *src_in, mp_float_t *out, size_t n) { \
+        const T *src = src_in; \
+        for (size_t i = 0; i < n; i++) { \
+            out[i] = (mp_float_t)src[i]; \
+        } \
+    } \
+    static void store_float_##T(void *dest_in, const mp_float_t *in, size_t n) { \
+        T *dest = dest_in; \
+        for (size_t i = 0; i < n; i++) { \
+            dest[i] = from_float_##T(in[i]); \
+        } \
+    }
+
+#define ARRAYOPS_FLOAT_FUNCS(T) \
+    static void combine_##T(void *dest_in, const void *other_in, size_t n, arrayops_op_t op) { \
+        T *dest = dest_in; \
+        const T *other = other_in; \
+        if (op == ARRAYOPS_ADD) { \
+            for (size_t i = 0; i < n; i++) { \
+                dest[i] += other[i]; \
+            } \
+        } else { \
+            for (size_t i = 0; i < n; i++) { \
+                dest[i] *= other[i]; \
+            } \
+        } \
+    } \
+    static void combine_scalar_##T(void *dest_in, size_t n, arrayops_value_t value, arrayops_op_t op) { \
+        T *dest = dest_in; \
+        T v = (T)value.f; \
+        if (op == ARRAYOPS_ADD) { \
+            for (size_t i = 0; i < n; i++) { \
+                dest[i] += v; \
+            } \
+        } else { \
+            for (size_t i = 0; i < n; i++) { \
+                dest[i] *= v; \
+            } \
+        } \
+    } \
+    static void scale_##T(void *dest_in, size_t n, mp_float_t factor, mp_float_t offset) { \
+        T *dest = dest_in; \
+        T f = (T)factor; \
+        T o = (T)offset; \
+        for (size_t i = 0; i < n; i++) { \
+            dest[i] = dest[i] * f + o; \
+        } \
+    } \
+    static void clip_##T(void *dest_in, size_t n, arrayops_value_t low, arrayops_value_t high) { \
+        T *dest = dest_in; \
+        T lo = (T)low.f; \
+        T hi = (T)high.f; \
+        for (size_t i = 0; i < n; i++) { \
+            T v = dest[i] < lo ? lo : dest[i]; \
+            dest[i] = v > hi ? hi : v; \
+        } \
+    } \
+    static void sum_##T(const void *src_in, size_t n, arrayops_value_t *result) { \
+        const T *src = src_in; \
+        T acc = 0; \
+        for (size_t i = 0; i < n; i++) { \
+            acc += src[i]; \
+        } \
+        result->f = (mp_float_t)acc; \
+    } \
+    static void dot_##T(const void *a_in, const void *b_in, size_t n, arrayops_value_t *result) { \
+        const T *a = a_in; \
+        const T *b = b_in; \
+        T acc = 0; \
+        for (size_t i = 0; i < n; i++) { \
+            acc += a[i] * b[i]; \
+        } \
+        result->f = (mp_float_t)acc; \
+    } \
+    static void extreme_##T(const void *src_in, size_t n, bool maximum, arrayops_value_t *result) { \
+        const T *src = src_in; \
+        T best = src[0]; \
+        if (maximum) { \
+            for (size_t i = 1; i < n; i++) { \
+                best = src[i] > best ? src[i] : best; \
+            } \
+        } else { \
+            for (size_t i = 1; i < n; i++) { \
+                best = src[i] < best ? src[i] : best; \
+            } \
+        } \
+        result->f = (mp_float_t)best; \
+    } \
+    static void load_float_##T(const void *src_in, mp_float_t *out, size_t n) { \
+        const T *src = src_in; \
+        for (size_t i = 0; i < n; i++) { \
+            out[i] = (mp_float_t)src[i]; \
+        } \
+    } \
+    static void store_float_##T(void *dest_in, const mp_float_t *in, size_t n) { \
+        T *dest = dest_in; \
+        for (size_t i = 0; i < n; i++) { \
+            dest[i] = (T)in[i]; \
+        } \
+    }
+
+ARRAYOPS_INT_FUNCS(int8_t, INT8_MIN, INT8_MAX, 32)
+ARRAYOPS_INT_FUNCS(uint8_t, 0, UINT8_MAX, 32)
+ARRAYOPS_INT_FUNCS(int16_t, INT16_MIN, INT16_MAX, 32)
+ARRAYOPS_INT_FUNCS(uint16_t, 0, UINT16_MAX, 32)
+ARRAYOPS_INT_FUNCS(int32_t, INT32_MIN, INT32_MAX, 64)
+ARRAYOPS_INT_FUNCS(uint32_t, 0, UINT32_MAX, 64)
+ARRAYOPS_FLOAT_FUNCS(float)
+ARRAYOPS_FLOAT_FUNCS(double)
+
+// 'i' and 'I' are int, which is 32 bits on every port.
+#define ARRAYOPS_DISPATCH(typecode, FUNC, ...) \
+    switch (typecode) { \
+        case 'b': FUNC##_int8_t(__VA_ARGS__); break; \
+        case 'B': FUNC##_uint8_t(__VA_ARGS__); break; \
+        case 'h': FUNC##_int16_t(__VA_ARGS__); break; \
+        case 'H': FUNC##_uint16_t(__VA_ARGS__); break; \
+        case 'i': FUNC##_int32_t(__VA_ARGS__); break; \
+        case 'I': FUNC##_uint32_t(__VA_ARGS__); break; \
+        case 'f': FUNC##_float(__VA_ARGS__); break; \
+        case 'd': FUNC##_double(__VA_ARGS__); break; \
+    }
+
+#define ARRAYOPS_DISPATCH_INT(typecode, FUNC, ...) \
+    switch (typecode) { \
+        case 'b': FUNC##_int8_t(__VA_ARGS__); break; \
+        case 'B': FUNC##_uint8_t(__VA_ARGS__); break; \
+        case 'h': FUNC##_int16_t(__VA_ARGS__); break; \
+        case 'H': FUNC##_uint16_t(__VA_ARGS__); break; \
+        case 'i': FUNC##_int32_t(__VA_ARGS__); break; \
+        case 'I': FUNC##_uint32_t(__VA_ARGS__); break; \
+    }
+
+static size_t element_size(char typecode) {
+    switch (typecode) {
+        case 'b':
+        case 'B':
+            return 1;
+        case 'h':
+        case 'H':
+            return 2;
+        case 'i':
+        case 'I':
+        case 'f':
+            return 4;
+        default:
+            return 8;
+    }
+}
+
+static size_t element_count(const mp_buffer_info_t *bufinfo) {
+    return bufinfo->len / element_size(bufinfo->typecode);
+}
+
+bool common_hal_arrayops_typecode_supported(char typecode) {
+    return typecode != 0 && strchr("bBhHiIfd", typecode) != NULL;
+}
+
+bool common_hal_arrayops_typecode_is_float(char typecode) {
+    return typecode == 'f' || typecode == 'd';
+}
+
+void common_hal_arrayops_combine(mp_buffer_info_t *dest, const mp_buffer_info_t *other, arrayops_op_t op) {
+    ARRAYOPS_DISPATCH(dest->typecode, combine, dest->buf, other->buf, element_count(dest), op);
+}
+
+void common_hal_arrayops_combine_scalar(mp_buffer_info_t *dest, arrayops_value_t value, arrayops_op_t op) {
+    ARRAYOPS_DISPATCH(dest->typecode, combine_scalar, dest->buf, element_count(dest), value, op);
+}
+
+void common_hal_arrayops_scale(mp_buffer_info_t *dest, mp_float_t factor, mp_float_t offset) {
+    ARRAYOPS_DISPATCH(dest->typecode, scale, dest->buf, element_count(dest), factor, offset);
+}
+
+void common_hal_arrayops_clip(mp_buffer_info_t *dest, arrayops_value_t low, arrayops_value_t high) {
+    ARRAYOPS_DISPATCH(dest->typecode, clip, dest->buf, element_count(dest), low, high);
+}
+
+arrayops_value_t common_hal_arrayops_sum(const mp_buffer_info_t *src) {
+    arrayops_value_t result = { .i = 0 };
+    ARRAYOPS_DISPATCH(src->typecode, sum, src->buf, element_count(src), &result);
+    return result;
+}
+
+arrayops_value_t common_hal_arrayops_dot(const mp_buffer_info_t *a, const mp_buffer_info_t *b) {
+    arrayops_value_t result = { .i = 0 };
+    ARRAYOPS_DISPATCH(a->typecode, dot, a->buf, b->buf, element_count(a), &result);
+    return result;
+}
+
+arrayops_value_t common_hal_arrayops_extreme(const mp_buffer_info_t *src, bool maximum) {
+    arrayops_value_t result = { .i = 0 };
+    ARRAYOPS_DISPATCH(src->typecode, extreme, src->buf, element_count(src), maximum, &result);
+    return result;
+}
+
+// Converts a chunk at a time through a buffer on the stack: exactly between integer types, and
+// otherwise through mp_float_t, rounding to the nearest integer.
+#define ARRAYOPS_CONVERT_CHUNK (32)
+
+void common_hal_arrayops_convert(mp_buffer_info_t *dest, const mp_buffer_info_t *src) {
+    size_t n = element_count(dest);
+    size_t dest_size = element_size(dest->typecode);
+    size_t src_size = element_size(src->typecode);
+    bool via_float = common_hal_arrayops_typecode_is_float(dest->typecode) ||
+        common_hal_arrayops_typecode_is_float(src->typecode);
+    union {
+        int64_t i[ARRAYOPS_CONVERT_CHUNK];
+        mp_float_t f[ARRAYOPS_CONVERT_CHUNK];
+    } chunk;
+    for (size_t done = 0; done < n; done += ARRAYOPS_CONVERT_CHUNK) {
+        size_t count = MIN(n - done, ARRAYOPS_CONVERT_CHUNK);
+        const uint8_t *s = (const uint8_t *)src->buf + done * src_size;
+        uint8_t *d = (uint8_t *)dest->buf + done * dest_size;
+        if (via_float) {
+            ARRAYOPS_DISPATCH(src->typecode, load_float, s, chunk.f, count);
+            ARRAYOPS_DISPATCH(dest->typecode, store_float, d, chunk.f, count);
+        } else {
+            ARRAYOPS_DISPATCH_INT(src->typecode, load_int, s, chunk.i, count);
+            ARRAYOPS_DISPATCH_INT(dest->typecode, store_int, d, chunk.i, count);
+        }
+    }
+}
@@ -0,0 +1,296 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-module/audiobusio/pdm_filter.h"
+
+// A windowed sinc filter for 44 khz, 64 taps. It is good enough for lower
+// sample rates as well.
+//
+// Entry [k][b] is the sum of taps 8k through 8k+7 that have their bit set in b,
+// with tap 8k in the most significant bit. Generated from:
+//
+//     0, 2, 9, 21, 39, 63, 94, 132,
+//     179, 236, 302, 379, 467, 565, 674, 792,
+//     920, 1055, 1196, 1341, 1487, 1633, 1776, 1913,
+//     2042, 2159, 2263, 2352, 2422, 2474, 2506, 2516,
+//     2506, 2474, 2422, 2352, 2263, 2159, 2042, 1913,
+//     1776, 1633, 1487, 1341, 1196, 1055, 920, 792,
+//     674, 565, 467, 379, 302, 236, 179, 132,
+//     94, 63, 39, 21, 9, 2, 0, 0
+const uint16_t audiobusio_pdm_filter_table[8][256] = {
+    {
+        0, 132, 94, 226, 63, 195, 157, 289,
+        39, 171, 133, 265, 102, 234, 196, 328,
+        21, 153, 115, 247, 84, 216, 178, 310,
+        60, 192, 154, 286, 123, 255, 217, 349,
+        9, 141, 103, 235, 72, 204, 166, 298,
+        48, 180, 142, 274, 111, 243, 205, 337,
+        30, 162, 124, 256, 93, 225, 187, 319,
+        69, 201, 163, 295, 132, 264, 226, 358,
+        2, 134, 96, 228, 65, 197, 159, 291,
+        41, 173, 135, 267, 104, 236, 198, 330,
+        23, 155, 117, 249, 86, 218, 180, 312,
+        62, 194, 156, 288, 125, 257, 219, 351,
+        11, 143, 105, 237, 74, 206, 168, 300,
+        50, 182, 144, 276, 113, 245, 207, 339,
+        32, 164, 126, 258, 95, 227, 189, 321,
+        71, 203, 165, 297, 134, 266, 228, 360,
+        0, 132, 94, 226, 63, 195, 157, 289,
+        39, 171, 133, 265, 102, 234, 196, 328,
+        21, 153, 115, 247, 84, 216, 178, 310,
+        60, 192, 154, 286, 123, 255, 217, 349,
+        9, 141, 103, 235, 72, 204, 166, 298,
+        48, 180, 142, 274, 111, 243, 205, 337,
+        30, 162, 124, 256, 93, 225, 187, 319,
+        69, 201, 163, 295, 132, 264, 226, 358,
+        2, 134, 96, 228, 65, 197, 159, 291,
+        41, 173, 135, 267, 104, 236, 198, 330,
+        23, 155, 117, 249, 86, 218, 180, 312,
+        62, 194, 156, 288, 125, 257, 219, 351,
+        11, 143, 105, 237, 74, 206, 168, 300,
+        50, 182, 144, 276, 113, 245, 207, 339,
+        32, 164, 126, 258, 95, 227, 189, 321,
+        71, 203, 165, 297, 134, 266, 228, 360,
+    },
+    {
+        0, 792, 674, 1466, 565, 1357, 1239, 2031,
+        467, 1259, 1141, 1933, 1032, 1824, 1706, 2498,
+        379, 1171, 1053, 1845, 944, 1736, 1618, 2410,
+        846, 1638, 1520, 2312, 1411, 2203, 2085, 2877,
+        302, 1094, 976, 1768, 867, 1659, 1541, 2333,
+        769, 1561, 1443, 2235, 1334, 2126, 2008, 2800,
+        681, 1473, 1355, 2147, 1246, 2038, 1920, 2712,
+        1148, 1940, 1822, 2614, 1713, 2505, 2387, 3179,
+        236, 1028, 910, 1702, 801, 1593, 1475, 2267,
+        703, 1495, 1377, 2169, 1268, 2060, 1942, 2734,
+        615, 1407, 1289, 2081, 1180, 1972, 1854, 2646,
+        1082, 1874, 1756, 2548, 1647, 2439, 2321, 3113,
+        538, 1330, 1212, 2004, 1103, 1895, 1777, 2569,
+        1005, 1797, 1679, 2471, 1570, 2362, 2244, 3036,
+        917, 1709, 1591, 2383, 1482, 2274, 2156, 2948,
+        1384, 2176, 2058, 2850, 1949, 2741, 2623, 3415,
+        179, 971, 853, 1645, 744, 1536, 1418, 2210,
+        646, 1438, 1320, 2112, 1211, 2003, 1885, 2677,
+        558, 1350, 1232, 2024, 1123, 1915, 1797, 2589,
+        1025, 1817, 1699, 2491, 1590, 2382, 2264, 3056,
+        481, 1273, 1155, 1947, 1046, 1838, 1720, 2512,
+        948, 1740, 1622, 2414, 1513, 2305, 2187, 2979,
+        860, 1652, 1534, 2326, 1425, 2217, 2099, 2891,
+        1327, 2119, 2001, 2793, 1892, 2684, 2566, 3358,
+        415, 1207, 1089, 1881, 980, 1772, 1654, 2446,
+        882, 1674, 1556, 2348, 1447, 2239, 2121, 2913,
+        794, 1586, 1468, 2260, 1359, 2151, 2033, 2825,
+        1261, 2053, 1935, 2727, 1826, 2618, 2500, 3292,
+        717, 1509, 1391, 2183, 1282, 2074, 1956, 2748,
+        1184, 1976, 1858, 2650, 1749, 2541, 2423, 3215,
+        1096, 1888, 1770, 2562, 1661, 2453, 2335, 3127,
+        1563, 2355, 2237, 3029, 2128, 2920, 2802, 3594,
+    },
+    {
+        0, 1913, 1776, 3689, 1633, 3546, 3409, 5322,
+        1487, 3400, 3263, 5176, 3120, 5033, 4896, 6809,
+        1341, 3254, 3117, 5030, 2974, 4887, 4750, 6663,
+        2828, 4741, 4604, 6517, 4461, 6374, 6237, 8150,
+        1196, 3109, 2972, 4885, 2829, 4742, 4605, 6518,
+        2683, 4596, 4459, 6372, 4316, 6229, 6092, 8005,
+        2537, 4450, 4313, 6226, 4170, 6083, 5946, 7859,
+        4024, 5937, 5800, 7713, 5657, 7570, 7433, 9346,
+        1055, 2968, 2831, 4744, 2688, 4601, 4464, 6377,
+        2542, 4455, 4318, 6231, 4175, 6088, 5951, 7864,
+        2396, 4309, 4172, 6085, 4029, 5942, 5805, 7718,
+        3883, 5796, 5659, 7572, 5516, 7429, 7292, 9205,
+        2251, 4164, 4027, 5940, 3884, 5797, 5660, 7573,
+        3738, 5651, 5514, 7427, 5371, 7284, 7147, 9060,
+        3592, 5505, 5368, 7281, 5225, 7138, 7001, 8914,
+        5079, 6992, 6855, 8768, 6712, 8625, 8488, 10401,
+        920, 2833, 2696, 4609, 2553, 4466, 4329, 6242,
+        2407, 4320, 4183, 6096, 4040, 5953, 5816, 7729,
+        2261, 4174, 4037, 5950, 3894, 5807, 5670, 7583,
+        3748, 5661, 5524, 7437, 5381, 7294, 7157, 9070,
+        2116, 4029, 3892, 5805, 3749, 5662, 5525, 7438,
+        3603, 5516, 5379, 7292, 5236, 7149, 7012, 8925,
+        3457, 5370, 5233, 7146, 5090, 7003, 6866, 8779,
+        4944, 6857, 6720, 8633, 6577, 8490, 8353, 10266,
+        1975, 3888, 3751, 5664, 3608, 5521, 5384, 7297,
+        3462, 5375, 5238, 7151, 5095, 7008, 6871, 8784,
+        3316, 5229, 5092, 7005, 4949, 6862, 6725, 8638,
+        4803, 6716, 6579, 8492, 6436, 8349, 8212, 10125,
+        3171, 5084, 4947, 6860, 4804, 6717, 6580, 8493,
+        4658, 6571, 6434, 8347, 6291, 8204, 8067, 9980,
+        4512, 6425, 6288, 8201, 6145, 8058, 7921, 9834,
+        5999, 7912, 7775, 9688, 7632, 9545, 9408, 11321,
+    },
+    {
+        0, 2516, 2506, 5022, 2474, 4990, 4980, 7496,
+        2422, 4938, 4928, 7444, 4896, 7412, 7402, 9918,
+        2352, 4868, 4858, 7374, 4826, 7342, 7332, 9848,
+        4774, 7290, 7280, 9796, 7248, 9764, 9754, 12270,
+        2263, 4779, 4769, 7285, 4737, 7253, 7243, 9759,
+        4685, 7201, 7191, 9707, 7159, 9675, 9665, 12181,
+        4615, 7131, 7121, 9637, 7089, 9605, 9595, 12111,
+        7037, 9553, 9543, 12059, 9511, 12027, 12017, 14533,
+        2159, 4675, 4665, 7181, 4633, 7149, 7139, 9655,
+        4581, 7097, 7087, 9603, 7055, 9571, 9561, 12077,
+        4511, 7027, 7017, 9533, 6985, 9501, 9491, 12007,
+        6933, 9449, 9439, 11955, 9407, 11923, 11913, 14429,
+        4422, 6938, 6928, 9444, 6896, 9412, 9402, 11918,
+        6844, 9360, 9350, 11866, 9318, 11834, 11824, 14340,
+        6774, 9290, 9280, 11796, 9248, 11764, 11754, 14270,
+        9196, 11712, 11702, 14218, 11670, 14186, 14176, 16692,
+        2042, 4558, 4548, 7064, 4516, 7032, 7022, 9538,
+        4464, 6980, 6970, 9486, 6938, 9454, 9444, 11960,
+        4394, 6910, 6900, 9416, 6868, 9384, 9374, 11890,
+        6816, 9332, 9322, 11838, 9290, 11806, 11796, 14312,
+        4305, 6821, 6811, 9327, 6779, 9295, 9285, 11801,
+        6727, 9243, 9233, 11749, 9201, 11717, 11707, 14223,
+        6657, 9173, 9163, 11679, 9131, 11647, 11637, 14153,
+        9079, 11595, 11585, 14101, 11553, 14069, 14059, 16575,
+        4201, 6717, 6707, 9223, 6675, 9191, 9181, 11697,
+        6623, 9139, 9129, 11645, 9097, 11613, 11603, 14119,
+        6553, 9069, 9059, 11575, 9027, 11543, 11533, 14049,
+        8975, 11491, 11481, 13997, 11449, 13965, 13955, 16471,
+        6464, 8980, 8970, 11486, 8938, 11454, 11444, 13960,
+        8886, 11402, 11392, 13908, 11360, 13876, 13866, 16382,
+        8816, 11332, 11322, 13838, 11290, 13806, 13796, 16312,
+        11238, 13754, 13744, 16260, 13712, 16228, 16218, 18734,
+    },
+    {
+        0, 1913, 2042, 3955, 2159, 4072, 4201, 6114,
+        2263, 4176, 4305, 6218, 4422, 6335, 6464, 8377,
+        2352, 4265, 4394, 6307, 4511, 6424, 6553, 8466,
+        4615, 6528, 6657, 8570, 6774, 8687, 8816, 10729,
+        2422, 4335, 4464, 6377, 4581, 6494, 6623, 8536,
+        4685, 6598, 6727, 8640, 6844, 8757, 8886, 10799,
+        4774, 6687, 6816, 8729, 6933, 8846, 8975, 10888,
+        7037, 8950, 9079, 10992, 9196, 11109, 11238, 13151,
+        2474, 4387, 4516, 6429, 4633, 6546, 6675, 8588,
+        4737, 6650, 6779, 8692, 6896, 8809, 8938, 10851,
+        4826, 6739, 6868, 8781, 6985, 8898, 9027, 10940,
+        7089, 9002, 9131, 11044, 9248, 11161, 11290, 13203,
+        4896, 6809, 6938, 8851, 7055, 8968, 9097, 11010,
+        7159, 9072, 9201, 11114, 9318, 11231, 11360, 13273,
+        7248, 9161, 9290, 11203, 9407, 11320, 11449, 13362,
+        9511, 11424, 11553, 13466, 11670, 13583, 13712, 15625,
+        2506, 4419, 4548, 6461, 4665, 6578, 6707, 8620,
+        4769, 6682, 6811, 8724, 6928, 8841, 8970, 10883,
+        4858, 6771, 6900, 8813, 7017, 8930, 9059, 10972,
+        7121, 9034, 9163, 11076, 9280, 11193, 11322, 13235,
+        4928, 6841, 6970, 8883, 7087, 9000, 9129, 11042,
+        7191, 9104, 9233, 11146, 9350, 11263, 11392, 13305,
+        7280, 9193, 9322, 11235, 9439, 11352, 11481, 13394,
+        9543, 11456, 11585, 13498, 11702, 13615, 13744, 15657,
+        4980, 6893, 7022, 8935, 7139, 9052, 9181, 11094,
+        7243, 9156, 9285, 11198, 9402, 11315, 11444, 13357,
+        7332, 9245, 9374, 11287, 9491, 11404, 11533, 13446,
+        9595, 11508, 11637, 13550, 11754, 13667, 13796, 15709,
+        7402, 9315, 9444, 11357, 9561, 11474, 11603, 13516,
+        9665, 11578, 11707, 13620, 11824, 13737, 13866, 15779,
+        9754, 11667, 11796, 13709, 11913, 13826, 13955, 15868,
+        12017, 13930, 14059, 15972, 14176, 16089, 16218, 18131,
+    },
+    {
+        0, 792, 920, 1712, 1055, 1847, 1975, 2767,
+        1196, 1988, 2116, 2908, 2251, 3043, 3171, 3963,
+        1341, 2133, 2261, 3053, 2396, 3188, 3316, 4108,
+        2537, 3329, 3457, 4249, 3592, 4384, 4512, 5304,
+        1487, 2279, 2407, 3199, 2542, 3334, 3462, 4254,
+        2683, 3475, 3603, 4395, 3738, 4530, 4658, 5450,
+        2828, 3620, 3748, 4540, 3883, 4675, 4803, 5595,
+        4024, 4816, 4944, 5736, 5079, 5871, 5999, 6791,
+        1633, 2425, 2553, 3345, 2688, 3480, 3608, 4400,
+        2829, 3621, 3749, 4541, 3884, 4676, 4804, 5596,
+        2974, 3766, 3894, 4686, 4029, 4821, 4949, 5741,
+        4170, 4962, 5090, 5882, 5225, 6017, 6145, 6937,
+        3120, 3912, 4040, 4832, 4175, 4967, 5095, 5887,
+        4316, 5108, 5236, 6028, 5371, 6163, 6291, 7083,
+        4461, 5253, 5381, 6173, 5516, 6308, 6436, 7228,
+        5657, 6449, 6577, 7369, 6712, 7504, 7632, 8424,
+        1776, 2568, 2696, 3488, 2831, 3623, 3751, 4543,
+        2972, 3764, 3892, 4684, 4027, 4819, 4947, 5739,
+        3117, 3909, 4037, 4829, 4172, 4964, 5092, 5884,
+        4313, 5105, 5233, 6025, 5368, 6160, 6288, 7080,
+        3263, 4055, 4183, 4975, 4318, 5110, 5238, 6030,
+        4459, 5251, 5379, 6171, 5514, 6306, 6434, 7226,
+        4604, 5396, 5524, 6316, 5659, 6451, 6579, 7371,
+        5800, 6592, 6720, 7512, 6855, 7647, 7775, 8567,
+        3409, 4201, 4329, 5121, 4464, 5256, 5384, 6176,
+        4605, 5397, 5525, 6317, 5660, 6452, 6580, 7372,
+        4750, 5542, 5670, 6462, 5805, 6597, 6725, 7517,
+        5946, 6738, 6866, 7658, 7001, 7793, 7921, 8713,
+        4896, 5688, 5816, 6608, 5951, 6743, 6871, 7663,
+        6092, 6884, 7012, 7804, 7147, 7939, 8067, 8859,
+        6237, 7029, 7157, 7949, 7292, 8084, 8212, 9004,
+        7433, 8225, 8353, 9145, 8488, 9280, 9408, 10200,
+    },
+    {
+        0, 132, 179, 311, 236, 368, 415, 547,
+        302, 434, 481, 613, 538, 670, 717, 849,
+        379, 511, 558, 690, 615, 747, 794, 926,
+        681, 813, 860, 992, 917, 1049, 1096, 1228,
+        467, 599, 646, 778, 703, 835, 882, 1014,
+        769, 901, 948, 1080, 1005, 1137, 1184, 1316,
+        846, 978, 1025, 1157, 1082, 1214, 1261, 1393,
+        1148, 1280, 1327, 1459, 1384, 1516, 1563, 1695,
+        565, 697, 744, 876, 801, 933, 980, 1112,
+        867, 999, 1046, 1178, 1103, 1235, 1282, 1414,
+        944, 1076, 1123, 1255, 1180, 1312, 1359, 1491,
+        1246, 1378, 1425, 1557, 1482, 1614, 1661, 1793,
+        1032, 1164, 1211, 1343, 1268, 1400, 1447, 1579,
+        1334, 1466, 1513, 1645, 1570, 1702, 1749, 1881,
+        1411, 1543, 1590, 1722, 1647, 1779, 1826, 1958,
+        1713, 1845, 1892, 2024, 1949, 2081, 2128, 2260,
+        674, 806, 853, 985, 910, 1042, 1089, 1221,
+        976, 1108, 1155, 1287, 1212, 1344, 1391, 1523,
+        1053, 1185, 1232, 1364, 1289, 1421, 1468, 1600,
+        1355, 1487, 1534, 1666, 1591, 1723, 1770, 1902,
+        1141, 1273, 1320, 1452, 1377, 1509, 1556, 1688,
+        1443, 1575, 1622, 1754, 1679, 1811, 1858, 1990,
+        1520, 1652, 1699, 1831, 1756, 1888, 1935, 2067,
+        1822, 1954, 2001, 2133, 2058, 2190, 2237, 2369,
+        1239, 1371, 1418, 1550, 1475, 1607, 1654, 1786,
+        1541, 1673, 1720, 1852, 1777, 1909, 1956, 2088,
+        1618, 1750, 1797, 1929, 1854, 1986, 2033, 2165,
+        1920, 2052, 2099, 2231, 2156, 2288, 2335, 2467,
+        1706, 1838, 1885, 2017, 1942, 2074, 2121, 2253,
+        2008, 2140, 2187, 2319, 2244, 2376, 2423, 2555,
+        2085, 2217, 2264, 2396, 2321, 2453, 2500, 2632,
+        2387, 2519, 2566, 2698, 2623, 2755, 2802, 2934,
+    },
+    {
+        0, 0, 0, 0, 2, 2, 2, 2,
+        9, 9, 9, 9, 11, 11, 11, 11,
+        21, 21, 21, 21, 23, 23, 23, 23,
+        30, 30, 30, 30, 32, 32, 32, 32,
+        39, 39, 39, 39, 41, 41, 41, 41,
+        48, 48, 48, 48, 50, 50, 50, 50,
+        60, 60, 60, 60, 62, 62, 62, 62,
+        69, 69, 69, 69, 71, 71, 71, 71,
+        63, 63, 63, 63, 65, 65, 65, 65,
+        72, 72, 72, 72, 74, 74, 74, 74,
+        84, 84, 84, 84, 86, 86, 86, 86,
+        93, 93, 93, 93, 95, 95, 95, 95,
+        102, 102, 102, 102, 104, 104, 104, 104,
+        111, 111, 111, 111, 113, 113, 113, 113,
+        123, 123, 123, 123, 125, 125, 125, 125,
+        132, 132, 132, 132, 134, 134, 134, 134,
+        94, 94, 94, 94, 96, 96, 96, 96,
+        103, 103, 103, 103, 105, 105, 105, 105,
+        115, 115, 115, 115, 117, 117, 117, 117,
+        124, 124, 124, 124, 126, 126, 126, 126,
+        133, 133, 133, 133, 135, 135, 135, 135,
+        142, 142, 142, 142, 144, 144, 144, 144,
+        154, 154, 154, 154, 156, 156, 156, 156,
+        163, 163, 163, 163, 165, 165, 165, 165,
+        157, 157, 157, 157, 159, 159, 159, 159,
+        166, 166, 166, 166, 168, 168, 168, 168,
+        178, 178, 178, 178, 180, 180, 180, 180,
+        187, 187, 187, 187, 189, 189, 189, 189,
+        196, 196, 196, 196, 198, 198, 198, 198,
+        205, 205, 205, 205, 207, 207, 207, 207,
+        217, 217, 217, 217, 219, 219, 219, 219,
+        226, 226, 226, 226, 228, 228, 228, 228,
+    },
+};
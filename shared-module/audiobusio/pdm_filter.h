@@ -0,0 +1,24 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdint.h>
+
+// Lets PDMIn filter a 64 bit window of PDM samples down to one PCM sample a
+// byte at a time. Index it with the byte's position in the window and its
+// value, with the earliest bit of each byte in its most significant bit. The
+// sum of the eight entries is the filtered sample.
+extern const uint16_t audiobusio_pdm_filter_table[8][256];
+
+// Filters the 64 PDM bits in b0 through b7, in time order.
+static inline uint16_t audiobusio_pdm_filter(uint8_t b0, uint8_t b1, uint8_t b2, uint8_t b3,
+    uint8_t b4, uint8_t b5, uint8_t b6, uint8_t b7) {
+    return audiobusio_pdm_filter_table[0][b0] + audiobusio_pdm_filter_table[1][b1] +
+           audiobusio_pdm_filter_table[2][b2] + audiobusio_pdm_filter_table[3][b3] +
+           audiobusio_pdm_filter_table[4][b4] + audiobusio_pdm_filter_table[5][b5] +
+           audiobusio_pdm_filter_table[6][b6] + audiobusio_pdm_filter_table[7][b7];
+}
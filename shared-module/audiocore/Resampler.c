@@ -0,0 +1,183 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/audiocore/Resampler.h"
+#include "shared-bindings/audiocore/__init__.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "py/runtime.h"
+
+void common_hal_audioio_resampler_construct(audioio_resampler_obj_t *self,
+    mp_obj_t sample, uint32_t sample_rate, uint32_t buffer_size) {
+    const audiosample_base_t *source = audiosample_check(sample);
+
+    // The output has the source's format, so the resampler can stand in for it anywhere.
+    self->base.bits_per_sample = source->bits_per_sample;
+    self->base.samples_signed = source->samples_signed;
+    self->base.channel_count = source->channel_count;
+    self->base.sample_rate = sample_rate;
+    self->base.single_buffer = false;
+
+    uint32_t frame_size = self->base.channel_count * (self->base.bits_per_sample / 8);
+    self->buffer_len = buffer_size - buffer_size % frame_size; // in bytes
+    self->base.max_buffer_length = self->buffer_len;
+    self->sample = sample;
+
+    self->buffer[0] = m_malloc(self->buffer_len);
+    self->buffer[1] = m_malloc(self->buffer_len);
+    memset(self->buffer[0], 0, self->buffer_len);
+    memset(self->buffer[1], 0, self->buffer_len);
+    self->last_buf_idx = 1;
+
+    audioio_resampler_reset_buffer(self, false, 0);
+}
+
+void common_hal_audioio_resampler_deinit(audioio_resampler_obj_t *self) {
+    audiosample_mark_deinit(&self->base);
+    self->buffer[0] = NULL;
+    self->buffer[1] = NULL;
+    self->sample = MP_OBJ_NULL;
+}
+
+mp_obj_t common_hal_audioio_resampler_get_sample(audioio_resampler_obj_t *self) {
+    return self->sample;
+}
+
+void audioio_resampler_reset_buffer(audioio_resampler_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel) {
+    if (single_channel_output && channel != 0) {
+        return;
+    }
+    audiosample_reset_buffer(self->sample, false, 0);
+    self->sample_remaining_buffer = NULL;
+    self->sample_buffer_length = 0;
+    self->more_data = true;
+    self->source_ended = false;
+    self->output_len = 0;
+    self->last_result = GET_BUFFER_MORE_DATA;
+    memset(self->prev, 0, sizeof(self->prev));
+    memset(self->cur, 0, sizeof(self->cur));
+    // Two frames are read before the first output, so it starts exactly on the first frame.
+    self->phase = 2 * RESAMPLER_PHASE_ONE;
+}
+
+// Reads the next source frame into cur, returning false at the end of the source.
+static bool read_frame(audioio_resampler_obj_t *self) {
+    uint8_t channel_count = self->base.channel_count;
+    uint8_t bytes_per_sample = self->base.bits_per_sample / 8;
+    while (self->sample_buffer_length < channel_count) {
+        if (!self->more_data) {
+            return false;
+        }
+        uint32_t length;
+        audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, &self->sample_remaining_buffer, &length);
+        if (result == GET_BUFFER_ERROR) {
+            self->more_data = false;
+            return false;
+        }
+        self->sample_buffer_length = length / bytes_per_sample;
+        self->more_data = result == GET_BUFFER_MORE_DATA;
+    }
+
+    for (uint8_t c = 0; c < channel_count; c++) {
+        int16_t value;
+        if (MP_LIKELY(bytes_per_sample == 2)) {
+            value = *(int16_t *)self->sample_remaining_buffer;
+            if (!self->base.samples_signed) {
+                value ^= 0x8000;
+            }
+        } else {
+            uint8_t u8 = *self->sample_remaining_buffer;
+            if (!self->base.samples_signed) {
+                u8 ^= 0x80;
+            }
+            value = (int16_t)((int8_t)u8 * 256);
+        }
+        self->cur[c] = value;
+        self->sample_remaining_buffer += bytes_per_sample;
+    }
+    self->sample_buffer_length -= channel_count;
+    return true;
+}
+
+audioio_get_buffer_result_t audioio_resampler_get_buffer(audioio_resampler_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length) {
+
+    uint8_t channel_count = self->base.channel_count;
+    uint8_t bytes_per_sample = self->base.bits_per_sample / 8;
+
+    // Single channel outputs ask for each channel of the same buffer in turn.
+    if (single_channel_output && channel % channel_count != 0) {
+        *buffer = self->buffer[self->last_buf_idx] + (channel % channel_count) * bytes_per_sample;
+        *buffer_length = self->output_len;
+        return self->last_result;
+    }
+
+    self->last_buf_idx = !self->last_buf_idx;
+    uint8_t *out = self->buffer[self->last_buf_idx];
+    int16_t *word_out = (int16_t *)out;
+
+    // Recomputed every buffer so changes to either sample rate apply on the fly. Rounded up so
+    // the output never has more frames than the exact ratio gives.
+    const audiosample_base_t *source = MP_OBJ_TO_PTR(self->sample);
+    uint32_t step = (((uint64_t)source->sample_rate << RESAMPLER_PHASE_SHIFT) + self->base.sample_rate - 1) / self->base.sample_rate;
+
+    uint32_t frames = self->buffer_len / (channel_count * bytes_per_sample);
+    uint32_t frame = 0;
+    bool done = false;
+    for (; frame < frames && !done; frame++) {
+        while (self->phase >= RESAMPLER_PHASE_ONE) {
+            memcpy(self->prev, self->cur, sizeof(self->prev));
+            if (!read_frame(self)) {
+                // The last frame is held for one more source period, so every source frame
+                // gets its share of output frames and loops keep their length.
+                done = self->source_ended;
+                self->source_ended = true;
+                if (done) {
+                    break;
+                }
+            }
+            self->phase -= RESAMPLER_PHASE_ONE;
+        }
+        if (done) {
+            break;
+        }
+
+        for (uint8_t c = 0; c < channel_count; c++) {
+            int32_t delta = (int32_t)self->cur[c] - self->prev[c];
+            int16_t value = self->prev[c] + ((delta * (int32_t)self->phase) >> RESAMPLER_PHASE_SHIFT);
+            if (MP_LIKELY(bytes_per_sample == 2)) {
+                *word_out++ = self->base.samples_signed ? value : (int16_t)(value ^ 0x8000);
+            } else {
+                uint8_t u8 = (uint8_t)(value >> 8);
+                *out++ = self->base.samples_signed ? u8 : (uint8_t)(u8 ^ 0x80);
+            }
+        }
+        self->phase += step;
+
+        // Finish now rather than returning an empty buffer next time.
+        bool exhausted = !self->more_data && self->sample_buffer_length < channel_count;
+        if (exhausted && self->phase >= (self->source_ended ? 1 : 2) * RESAMPLER_PHASE_ONE) {
+            done = true;
+        }
+    }
+
+    self->output_len = frame * channel_count * bytes_per_sample;
+    self->last_result = done ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
+
+    *buffer = self->buffer[self->last_buf_idx];
+    if (single_channel_output) {
+        *buffer += (channel % channel_count) * bytes_per_sample;
+    }
+    *buffer_length = self->output_len;
+    return self->last_result;
+}
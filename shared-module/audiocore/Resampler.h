@@ -0,0 +1,47 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "shared-module/audiocore/__init__.h"
+
+// Fractional bits of the read position between two source frames. With 15 bits the
+// interpolation product of a 16-bit difference still fits in an int32_t.
+#define RESAMPLER_PHASE_SHIFT (15)
+#define RESAMPLER_PHASE_ONE (1u << RESAMPLER_PHASE_SHIFT)
+
+typedef struct {
+    audiosample_base_t base;
+    mp_obj_t sample;
+
+    uint8_t *buffer[2];
+    uint8_t last_buf_idx;
+    uint32_t buffer_len; // max buffer in bytes
+    uint32_t output_len; // bytes in the last buffer returned
+    audioio_get_buffer_result_t last_result;
+
+    uint8_t *sample_remaining_buffer;
+    uint32_t sample_buffer_length; // in samples, not frames
+    bool more_data;
+    bool source_ended; // the last source frame has been read
+
+    // The output is interpolated between prev and cur, which are source frames in signed 16-bit.
+    uint32_t phase; // << RESAMPLER_PHASE_SHIFT
+    int16_t prev[2];
+    int16_t cur[2];
+} audioio_resampler_obj_t;
+
+// These are not available from Python because it may be called in an interrupt.
+void audioio_resampler_reset_buffer(audioio_resampler_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel);
+audioio_get_buffer_result_t audioio_resampler_get_buffer(audioio_resampler_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length);                                                      // length in bytes
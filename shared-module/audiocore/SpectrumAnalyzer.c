@@ -0,0 +1,209 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/audiocore/SpectrumAnalyzer.h"
+#include "shared-bindings/audiocore/__init__.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "py/runtime.h"
+
+void common_hal_audioio_spectrumanalyzer_construct(audioio_spectrumanalyzer_obj_t *self,
+    mp_obj_t sample, uint16_t fft_size) {
+    const audiosample_base_t *source = audiosample_check(sample);
+
+    // Buffers are passed through, so the analyzer has the source's format. It is never
+    // single buffered so that every repeat of a looping sample is analyzed.
+    self->base.sample_rate = source->sample_rate;
+    self->base.max_buffer_length = source->max_buffer_length;
+    self->base.bits_per_sample = source->bits_per_sample;
+    self->base.channel_count = source->channel_count;
+    self->base.samples_signed = source->samples_signed;
+    self->base.single_buffer = false;
+    self->sample = sample;
+    self->fft_size = fft_size;
+
+    self->re = m_malloc(fft_size * sizeof(int16_t));
+    self->im = m_malloc(fft_size * sizeof(int16_t));
+    self->twiddle = m_malloc(fft_size * sizeof(int16_t));
+    self->magnitudes = m_malloc(fft_size / 2 * sizeof(uint16_t));
+    memset(self->magnitudes, 0, fft_size / 2 * sizeof(uint16_t));
+
+    for (uint16_t k = 0; k < fft_size / 2; k++) {
+        mp_float_t angle = 2 * MICROPY_FLOAT_CONST(3.14159265358979323846) * k / fft_size;
+        self->twiddle[2 * k] = (int16_t)MIN(32767, (int32_t)MICROPY_FLOAT_C_FUN(round)(MICROPY_FLOAT_C_FUN(cos)(angle) * 32768));
+        self->twiddle[2 * k + 1] = (int16_t)MIN(32767, (int32_t)MICROPY_FLOAT_C_FUN(round)(-MICROPY_FLOAT_C_FUN(sin)(angle) * 32768));
+    }
+
+    self->fill = 0;
+    self->new_magnitudes = false;
+    audioio_spectrumanalyzer_reset_buffer(self, false, 0);
+}
+
+void common_hal_audioio_spectrumanalyzer_deinit(audioio_spectrumanalyzer_obj_t *self) {
+    audiosample_mark_deinit(&self->base);
+    self->re = NULL;
+    self->im = NULL;
+    self->twiddle = NULL;
+    self->magnitudes = NULL;
+    self->sample = MP_OBJ_NULL;
+}
+
+mp_obj_t common_hal_audioio_spectrumanalyzer_get_sample(audioio_spectrumanalyzer_obj_t *self) {
+    return self->sample;
+}
+
+uint16_t common_hal_audioio_spectrumanalyzer_get_fft_size(audioio_spectrumanalyzer_obj_t *self) {
+    return self->fft_size;
+}
+
+bool common_hal_audioio_spectrumanalyzer_read(audioio_spectrumanalyzer_obj_t *self, uint16_t *magnitudes) {
+    // The background task may finish a block part way through the copy; that only mixes two
+    // consecutive spectra.
+    memcpy(magnitudes, self->magnitudes, self->fft_size / 2 * sizeof(uint16_t));
+    bool new_magnitudes = self->new_magnitudes;
+    self->new_magnitudes = false;
+    return new_magnitudes;
+}
+
+void audioio_spectrumanalyzer_reset_buffer(audioio_spectrumanalyzer_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel) {
+    // A partial block is kept, so that loops shorter than fft_size are still analyzed.
+    audiosample_reset_buffer(self->sample, single_channel_output, channel);
+}
+
+// Hann window in Q15, from the cosines in the twiddle table.
+static int16_t hann(const audioio_spectrumanalyzer_obj_t *self, uint16_t i) {
+    uint16_t half = self->fft_size / 2;
+    if (i > half) {
+        i = self->fft_size - i;
+    }
+    int32_t c = i == half ? -32768 : self->twiddle[2 * i];
+    return (int16_t)MIN(32767, (32768 - c) / 2);
+}
+
+static uint16_t isqrt(uint32_t value) {
+    uint32_t result = 0;
+    uint32_t bit = 1u << 30;
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return result;
+}
+
+// In-place radix-2 decimation in time. Every stage halves its output so nothing overflows,
+// which leaves the result divided by fft_size.
+static void fft_q15(audioio_spectrumanalyzer_obj_t *self) {
+    int16_t *re = self->re;
+    int16_t *im = self->im;
+    uint16_t n = self->fft_size;
+
+    for (uint16_t i = 1, j = 0; i < n; i++) {
+        uint16_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            int16_t t = re[i];
+            re[i] = re[j];
+            re[j] = t;
+            t = im[i];
+            im[i] = im[j];
+            im[j] = t;
+        }
+    }
+
+    for (uint16_t len = 2; len <= n; len <<= 1) {
+        uint16_t half = len / 2;
+        uint16_t step = n / len;
+        for (uint16_t start = 0; start < n; start += len) {
+            for (uint16_t k = 0; k < half; k++) {
+                int32_t wr = self->twiddle[2 * k * step];
+                int32_t wi = self->twiddle[2 * k * step + 1];
+                uint16_t a = start + k;
+                uint16_t b = a + half;
+                int32_t tr = (wr * re[b] - wi * im[b]) >> 15;
+                int32_t ti = (wr * im[b] + wi * re[b]) >> 15;
+                re[b] = (re[a] - tr) >> 1;
+                im[b] = (im[a] - ti) >> 1;
+                re[a] = (re[a] + tr) >> 1;
+                im[a] = (im[a] + ti) >> 1;
+            }
+        }
+    }
+}
+
+static void analyze_block(audioio_spectrumanalyzer_obj_t *self) {
+    // The window also halves the input so complex values stay within 16 bits.
+    for (uint16_t i = 0; i < self->fft_size; i++) {
+        self->re[i] = (self->re[i] * hann(self, i)) >> 16;
+        self->im[i] = 0;
+    }
+    fft_q15(self);
+    // Scaled so that a full scale sine wave in the middle of a bin reads about 32768.
+    for (uint16_t k = 0; k < self->fft_size / 2; k++) {
+        int32_t power = self->re[k] * self->re[k] + self->im[k] * self->im[k];
+        self->magnitudes[k] = MIN(65535, (uint32_t)isqrt(power) << 3);
+    }
+    self->new_magnitudes = true;
+}
+
+static inline int16_t read_sample(const uint8_t *p, uint8_t bytes_per_sample, bool samples_signed) {
+    if (bytes_per_sample == 2) {
+        int16_t value = *(const int16_t *)(const void *)p;
+        return samples_signed ? value : (int16_t)(value ^ 0x8000);
+    }
+    uint8_t value = samples_signed ? *p : (uint8_t)(*p ^ 0x80);
+    return (int16_t)((int8_t)value * 256);
+}
+
+// Averages each frame's channels, or takes one channel every `channel_count` samples for
+// single channel outputs.
+static void tap(audioio_spectrumanalyzer_obj_t *self, const uint8_t *buffer, uint32_t length,
+    bool single_channel_output) {
+    uint8_t bytes_per_sample = self->base.bits_per_sample / 8;
+    uint8_t channel_count = self->base.channel_count;
+    bool samples_signed = self->base.samples_signed;
+    uint32_t frame_size = bytes_per_sample * channel_count;
+    uint8_t channels_to_mix = single_channel_output ? 1 : channel_count;
+
+    for (uint32_t offset = 0; offset + bytes_per_sample * channels_to_mix <= length; offset += frame_size) {
+        int32_t value = 0;
+        for (uint8_t c = 0; c < channels_to_mix; c++) {
+            value += read_sample(buffer + offset + c * bytes_per_sample, bytes_per_sample, samples_signed);
+        }
+        self->re[self->fill++] = value / channels_to_mix;
+        if (self->fill == self->fft_size) {
+            analyze_block(self);
+            self->fill = 0;
+        }
+    }
+}
+
+audioio_get_buffer_result_t audioio_spectrumanalyzer_get_buffer(audioio_spectrumanalyzer_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length) {
+    audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, single_channel_output, channel, buffer, buffer_length);
+    if (result != GET_BUFFER_ERROR && (!single_channel_output || channel == 0)) {
+        tap(self, *buffer, *buffer_length, single_channel_output);
+    }
+    return result;
+}
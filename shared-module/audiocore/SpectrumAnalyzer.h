@@ -0,0 +1,35 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "shared-module/audiocore/__init__.h"
+
+typedef struct {
+    audiosample_base_t base;
+    mp_obj_t sample;
+
+    uint16_t fft_size;
+    uint16_t fill; // samples collected in re
+    // Samples are collected in re, then transformed in place with im.
+    int16_t *re;
+    int16_t *im;
+    int16_t *twiddle; // cos and -sin pairs for the first fft_size / 2 roots, Q15
+    uint16_t *magnitudes; // fft_size / 2 bins of the last complete block
+    bool new_magnitudes;
+} audioio_spectrumanalyzer_obj_t;
+
+// These are not available from Python because it may be called in an interrupt.
+void audioio_spectrumanalyzer_reset_buffer(audioio_spectrumanalyzer_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel);
+audioio_get_buffer_result_t audioio_spectrumanalyzer_get_buffer(audioio_spectrumanalyzer_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length);                                                      // length in bytes
@@ -29,6 +29,48 @@ struct wave_format_chunk {
     uint8_t extended_guid[14];
 };
 
+// Reads the next block of the file into the buffer selected by buffer_index.
+static bool load_block(audioio_wavefile_obj_t *self) {
+    uint32_t num_bytes_to_load = self->len;
+    if (self->bytes_remaining == self->file_length) {
+        num_bytes_to_load = self->first_len;
+    }
+    if (num_bytes_to_load > self->bytes_remaining) {
+        num_bytes_to_load = self->bytes_remaining;
+    }
+    uint8_t *buffer = self->buffer;
+    if (self->buffer_index % 2 == 1) {
+        buffer = self->second_buffer;
+    }
+    UINT length_read;
+    if (f_read(&self->file->fp, buffer, num_bytes_to_load, &length_read) != FR_OK || length_read != num_bytes_to_load) {
+        return false;
+    }
+    self->bytes_remaining -= length_read;
+    // Pad the last buffer to word align it.
+    if (self->bytes_remaining == 0 && length_read % sizeof(uint32_t) != 0) {
+        uint32_t pad = length_read % sizeof(uint32_t);
+        length_read += pad;
+        if (self->base.bits_per_sample == 8) {
+            for (uint32_t i = 0; i < pad; i++) {
+                buffer[length_read / sizeof(uint8_t) - i - 1] = 0x80;
+            }
+        } else if (self->base.bits_per_sample == 16) {
+            // We know the buffer is aligned because we allocated it onto the heap ourselves.
+            #pragma GCC diagnostic push
+            #pragma GCC diagnostic ignored "-Wcast-align"
+            ((int16_t *)buffer)[length_read / sizeof(int16_t) - 1] = 0;
+            #pragma GCC diagnostic pop
+        }
+    }
+    if (self->buffer_index % 2 == 1) {
+        self->second_buffer_length = length_read;
+    } else {
+        self->buffer_length = length_read;
+    }
+    return true;
+}
+
 void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
     pyb_file_obj_t *file,
     uint8_t *buffer,
@@ -76,7 +118,6 @@ void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
     self->base.channel_count = format.num_channels;
     self->base.bits_per_sample = format.bits_per_sample;
     self->base.samples_signed = format.bits_per_sample > 8;
-    self->base.max_buffer_length = 512;
     self->base.single_buffer = false;
 
     uint8_t chunk_tag[4];
@@ -119,18 +160,58 @@ void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
         self->second_buffer = buffer + self->len;
     } else {
         self->len = 256;
-        self->buffer = m_malloc(self->len);
+        self->buffer = m_malloc_bulk(self->len);
         if (self->buffer == NULL) {
             common_hal_audioio_wavefile_deinit(self);
             m_malloc_fail(self->len);
         }
 
-        self->second_buffer = m_malloc(self->len);
+        self->second_buffer = m_malloc_bulk(self->len);
         if (self->second_buffer == NULL) {
             common_hal_audioio_wavefile_deinit(self);
             m_malloc_fail(self->len);
         }
     }
+    self->base.max_buffer_length = MAX(self->len, 512);
+    self->first_len = self->len;
+
+    // Blocks of a sector or more are realigned so that every read after the first starts on a
+    // sector boundary, or a cluster boundary when a cluster fits in a block. FatFS then reads
+    // whole sectors straight into the buffer instead of through its sector cache. The first
+    // read is kept to at least half a block so looping doesn't play one tiny block.
+    uint32_t unit = FF_MIN_SS;
+    uint32_t cluster_size = self->file->fp.obj.fs->csize * FF_MIN_SS;
+    if (cluster_size <= self->len) {
+        unit = cluster_size;
+    }
+    if (self->len >= unit) {
+        uint32_t frame_size = self->base.channel_count * self->base.bits_per_sample / 8;
+        self->len -= self->len % unit;
+        uint32_t head = (unit - self->data_start % unit) % unit;
+        if (head != 0 && head < self->len / 2) {
+            head += unit;
+        }
+        if (head != 0 && head <= self->len && head % frame_size == 0) {
+            self->first_len = head;
+        } else {
+            self->first_len = self->len;
+        }
+    }
+
+    // Read the first block now so playback starts without waiting on storage. Opening the next
+    // file while the current one plays gives gapless playback from slow cards.
+    self->buffer_index = 0;
+    self->bytes_remaining = self->file_length;
+    self->read_count = 0;
+    self->left_read_count = 0;
+    self->right_read_count = 0;
+    if (self->bytes_remaining > 0) {
+        if (!load_block(self)) {
+            common_hal_audioio_wavefile_deinit(self);
+            mp_raise_OSError(MP_EIO);
+        }
+        self->preloaded = true;
+    }
 }
 
 void common_hal_audioio_wavefile_deinit(audioio_wavefile_obj_t *self) {
@@ -145,6 +226,10 @@ void audioio_wavefile_reset_buffer(audioio_wavefile_obj_t *self,
     if (single_channel_output && channel == 1) {
         return;
     }
+    // Nothing has been played since the first block was read ahead.
+    if (self->preloaded) {
+        return;
+    }
     // We don't reset the buffer index in case we're looping and we have an odd number of buffer
     // loads
     self->bytes_remaining = self->file_length;
@@ -177,42 +262,11 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *
     }
 
     if (need_more_data) {
-        uint32_t num_bytes_to_load = self->len;
-        if (num_bytes_to_load > self->bytes_remaining) {
-            num_bytes_to_load = self->bytes_remaining;
-        }
-        UINT length_read;
-        if (self->buffer_index % 2 == 1) {
-            *buffer = self->second_buffer;
-        } else {
-            *buffer = self->buffer;
-        }
-        if (f_read(&self->file->fp, *buffer, num_bytes_to_load, &length_read) != FR_OK || length_read != num_bytes_to_load) {
+        if (self->preloaded) {
+            self->preloaded = false;
+        } else if (!load_block(self)) {
             return GET_BUFFER_ERROR;
         }
-        self->bytes_remaining -= length_read;
-        // Pad the last buffer to word align it.
-        if (self->bytes_remaining == 0 && length_read % sizeof(uint32_t) != 0) {
-            uint32_t pad = length_read % sizeof(uint32_t);
-            length_read += pad;
-            if (self->base.bits_per_sample == 8) {
-                for (uint32_t i = 0; i < pad; i++) {
-                    ((uint8_t *)(*buffer))[length_read / sizeof(uint8_t) - i - 1] = 0x80;
-                }
-            } else if (self->base.bits_per_sample == 16) {
-                // We know the buffer is aligned because we allocated it onto the heap ourselves.
-                #pragma GCC diagnostic push
-                #pragma GCC diagnostic ignored "-Wcast-align"
-                ((int16_t *)(*buffer))[length_read / sizeof(int16_t) - 1] = 0;
-                #pragma GCC diagnostic pop
-            }
-        }
-        *buffer_length = length_read;
-        if (self->buffer_index % 2 == 1) {
-            self->second_buffer_length = length_read;
-        } else {
-            self->buffer_length = length_read;
-        }
         self->buffer_index += 1;
         self->read_count += 1;
     }
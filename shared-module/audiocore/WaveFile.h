@@ -23,11 +23,13 @@ typedef struct {
     uint32_t bytes_remaining;
 
     uint32_t len;
+    uint32_t first_len; // shorter so later reads are aligned
     pyb_file_obj_t *file;
 
     uint32_t read_count;
     uint32_t left_read_count;
     uint32_t right_read_count;
+    bool preloaded; // the first block was read when the file was opened
 } audioio_wavefile_obj_t;
 
 // These are not available from Python because it may be called in an interrupt.
@@ -189,6 +189,73 @@ void common_hal_audiodelays_chorus_stop(audiodelays_chorus_obj_t *self) {
     return;
 }
 
+// get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
+static void chorus_get_params(audiodelays_chorus_obj_t *self, int32_t *voices, mp_float_t *mix) {
+    *voices = (int32_t)MAX(synthio_block_slot_get(&self->voices), 1.0);
+    *mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
+
+    mp_float_t f_delay_ms = synthio_block_slot_get(&self->delay_ms);
+    if (MICROPY_FLOAT_C_FUN(fabs)(self->current_delay_ms - f_delay_ms) >= self->sample_ms) {
+        chorus_recalculate_delay(self, f_delay_ms);
+    }
+}
+
+// Adds one signed sample to the chorus and returns the mixed output, which the caller narrows to the sample size
+static inline int32_t chorus_sample(audiodelays_chorus_obj_t *self, int32_t sample_word, int32_t voices,
+    int32_t mix_down_scale, mp_float_t mix, uint32_t chorus_buf_len) {
+    // The chorus buffer is always stored as a 16-bit value internally
+    int16_t *chorus_buffer = (int16_t *)self->chorus_buffer;
+    uint32_t max_chorus_buf_len = self->max_chorus_buffer_len / sizeof(uint16_t);
+
+    chorus_buffer[self->chorus_buffer_pos++] = (int16_t)sample_word;
+
+    int32_t word = 0;
+    if (voices == 1) {
+        word = sample_word;
+    } else {
+        int32_t step = chorus_buf_len / (voices - 1) - 1;
+        int32_t c_pos = self->chorus_buffer_pos - 1;
+
+        for (int32_t v = 0; v < voices; v++) {
+            if (c_pos < 0) {
+                c_pos += max_chorus_buf_len;
+            }
+            word += chorus_buffer[c_pos];
+
+            c_pos -= step;
+        }
+
+        // Dividing would get an average but does not sound as good
+        // Leaving this here in case someone wants to try an average instead
+        // word = word / voices;
+
+        word = synthio_mix_down_sample(word, mix_down_scale);
+    }
+
+    // Add original sample + effect
+    word = sample_word + (int32_t)(word * mix);
+    word = synthio_mix_down_sample(word, 2);
+
+    if (self->chorus_buffer_pos >= max_chorus_buf_len) {
+        self->chorus_buffer_pos = 0;
+    }
+    return word;
+}
+
+void audiodelays_chorus_process(audiodelays_chorus_obj_t *self, int32_t *words, uint32_t length, uint8_t channel) {
+    (void)channel;
+    int32_t voices;
+    mp_float_t mix;
+    chorus_get_params(self, &voices, &mix);
+    int32_t mix_down_scale = SYNTHIO_MIX_DOWN_SCALE(voices);
+    uint32_t chorus_buf_len = self->chorus_buffer_len / sizeof(uint16_t);
+
+    for (uint32_t i = 0; i < length; i++) {
+        int32_t word = chorus_sample(self, words[i], voices, mix_down_scale, mix, chorus_buf_len);
+        words[i] = MP_LIKELY(self->base.bits_per_sample == 16) ? (int16_t)word : (int8_t)word;
+    }
+}
+
 audioio_get_buffer_result_t audiodelays_chorus_get_buffer(audiodelays_chorus_obj_t *self, bool single_channel_output, uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length) {
 
@@ -199,11 +266,7 @@ audioio_get_buffer_result_t audiodelays_chorus_get_buffer(audiodelays_chorus_obj
     int16_t *word_buffer = (int16_t *)self->buffer[self->last_buf_idx];
     int8_t *hword_buffer = self->buffer[self->last_buf_idx];
     uint32_t length = self->buffer_len / (self->base.bits_per_sample / 8);
-
-    // The chorus buffer is always stored as a 16-bit value internally
-    int16_t *chorus_buffer = (int16_t *)self->chorus_buffer;
     uint32_t chorus_buf_len = self->chorus_buffer_len / sizeof(uint16_t);
-    uint32_t max_chorus_buf_len = self->max_chorus_buffer_len / sizeof(uint16_t);
 
     // Loop over the entire length of our buffer to fill it, this may require several calls to get data from the sample
     while (length != 0) {
@@ -233,17 +296,11 @@ audioio_get_buffer_result_t audiodelays_chorus_get_buffer(audiodelays_chorus_obj
             n = MIN(MIN(self->sample_buffer_length, length), SYNTHIO_MAX_DUR * self->base.channel_count);
         }
 
-        // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
         shared_bindings_synthio_lfo_tick(self->base.sample_rate, n / self->base.channel_count);
-
-        int32_t voices = (int32_t)MAX(synthio_block_slot_get(&self->voices), 1.0);
+        int32_t voices;
+        mp_float_t mix;
+        chorus_get_params(self, &voices, &mix);
         int32_t mix_down_scale = SYNTHIO_MIX_DOWN_SCALE(voices);
-        mp_float_t mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
-
-        mp_float_t f_delay_ms = synthio_block_slot_get(&self->delay_ms);
-        if (MICROPY_FLOAT_C_FUN(fabs)(self->current_delay_ms - f_delay_ms) >= self->sample_ms) {
-            chorus_recalculate_delay(self, f_delay_ms);
-        }
 
         if (self->sample == NULL) {
             if (self->base.samples_signed) {
@@ -276,34 +333,7 @@ audioio_get_buffer_result_t audiodelays_chorus_get_buffer(audiodelays_chorus_obj
                     }
                 }
 
-                chorus_buffer[self->chorus_buffer_pos++] = (int16_t)sample_word;
-
-                int32_t word = 0;
-                if (voices == 1) {
-                    word = sample_word;
-                } else {
-                    int32_t step = chorus_buf_len / (voices - 1) - 1;
-                    int32_t c_pos = self->chorus_buffer_pos - 1;
-
-                    for (int32_t v = 0; v < voices; v++) {
-                        if (c_pos < 0) {
-                            c_pos += max_chorus_buf_len;
-                        }
-                        word += chorus_buffer[c_pos];
-
-                        c_pos -= step;
-                    }
-
-                    // Dividing would get an average but does not sound as good
-                    // Leaving this here in case someone wants to try an average instead
-                    // word = word / voices;
-
-                    word = synthio_mix_down_sample(word, mix_down_scale);
-                }
-
-                // Add original sample + effect
-                word = sample_word + (int32_t)(word * mix);
-                word = synthio_mix_down_sample(word, 2);
+                int32_t word = chorus_sample(self, sample_word, voices, mix_down_scale, mix, chorus_buf_len);
 
                 if (MP_LIKELY(self->base.bits_per_sample == 16)) {
                     word_buffer[i] = word;
@@ -318,10 +348,6 @@ audioio_get_buffer_result_t audiodelays_chorus_get_buffer(audiodelays_chorus_obj
                         hword_buffer[i] = (uint8_t)out ^ 0x80;
                     }
                 }
-
-                if (self->chorus_buffer_pos >= max_chorus_buf_len) {
-                    self->chorus_buffer_pos = 0;
-                }
             }
             self->sample_remaining_buffer += (n * (self->base.bits_per_sample / 8));
             self->sample_buffer_length -= n;
@@ -46,6 +46,10 @@ void audiodelays_chorus_reset_buffer(audiodelays_chorus_obj_t *self,
     bool single_channel_output,
     uint8_t channel);
 
+// Applies the chorus in place to `length` signed samples in the effect's bits_per_sample range,
+// for audiofx.Chain. Block inputs must already be ticked for these samples.
+void audiodelays_chorus_process(audiodelays_chorus_obj_t *self, int32_t *words, uint32_t length, uint8_t channel);
+
 audioio_get_buffer_result_t audiodelays_chorus_get_buffer(audiodelays_chorus_obj_t *self,
     bool single_channel_output,
     uint8_t channel,
@@ -220,6 +220,99 @@ void common_hal_audiodelays_echo_stop(audiodelays_echo_obj_t *self) {
     return;
 }
 
+// get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
+static void echo_get_params(audiodelays_echo_obj_t *self, mp_float_t *mix, mp_float_t *decay) {
+    *mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0)) * MICROPY_FLOAT_CONST(2.0);
+    *decay = synthio_block_slot_get_limited(&self->decay, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
+
+    mp_float_t f_delay_ms = synthio_block_slot_get(&self->delay_ms);
+    if (MICROPY_FLOAT_C_FUN(fabs)(self->current_delay_ms - f_delay_ms) >= self->sample_ms) {
+        recalculate_delay(self, f_delay_ms);
+    }
+}
+
+// Echoes one signed sample and returns the mixed output, which the caller narrows to the sample size
+static inline int32_t echo_sample(audiodelays_echo_obj_t *self, int32_t sample_word, mp_float_t mix, mp_float_t decay,
+    uint32_t echo_buf_len, uint32_t *echo_buffer_pos) {
+    int16_t *echo_buffer = (int16_t *)self->echo_buffer;
+
+    int32_t echo, word = 0;
+    uint32_t next_buffer_pos = 0;
+    if (self->freq_shift) {
+        echo = echo_buffer[*echo_buffer_pos >> 8];
+        next_buffer_pos = *echo_buffer_pos + self->echo_buffer_rate;
+    } else {
+        echo = echo_buffer[self->echo_buffer_read_pos++];
+        word = (int32_t)(echo * decay + sample_word);
+    }
+
+    if (MP_LIKELY(self->base.bits_per_sample == 16)) {
+        if (self->freq_shift) {
+            for (uint32_t j = *echo_buffer_pos >> 8; j < next_buffer_pos >> 8; j++) {
+                word = (int32_t)(echo_buffer[j % echo_buf_len] * decay + sample_word);
+                word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
+                echo_buffer[j % echo_buf_len] = (int16_t)word;
+            }
+        } else {
+            word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
+            echo_buffer[self->echo_buffer_write_pos++] = (int16_t)word;
+        }
+    } else {
+        if (self->freq_shift) {
+            for (uint32_t j = *echo_buffer_pos >> 8; j < next_buffer_pos >> 8; j++) {
+                word = (int32_t)(echo_buffer[j % echo_buf_len] * decay + sample_word);
+                // Do not have mix_down for 8 bit so just hard cap samples into 1 byte
+                word = MIN(MAX(word, -128), 127);
+                echo_buffer[j % echo_buf_len] = (int8_t)word;
+            }
+        } else {
+            // Do not have mix_down for 8 bit so just hard cap samples into 1 byte
+            word = MIN(MAX(word, -128), 127);
+            echo_buffer[self->echo_buffer_write_pos++] = (int8_t)word;
+        }
+    }
+
+    word = (int32_t)((sample_word * MIN(MICROPY_FLOAT_CONST(2.0) - mix, MICROPY_FLOAT_CONST(1.0)))
+        + (echo * MIN(mix, MICROPY_FLOAT_CONST(1.0))));
+    word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
+
+    if (self->freq_shift) {
+        *echo_buffer_pos = next_buffer_pos % (echo_buf_len << 8);
+    } else {
+        if (self->echo_buffer_read_pos >= echo_buf_len) {
+            self->echo_buffer_read_pos = 0;
+        }
+        if (self->echo_buffer_write_pos >= echo_buf_len) {
+            self->echo_buffer_write_pos = 0;
+        }
+    }
+    return word;
+}
+
+void audiodelays_echo_process(audiodelays_echo_obj_t *self, int32_t *words, uint32_t length, uint8_t channel) {
+    mp_float_t mix, decay;
+    echo_get_params(self, &mix, &decay);
+    if (mix <= MICROPY_FLOAT_CONST(0.01)) { // if mix is zero pure sample only
+        return;
+    }
+
+    uint32_t echo_buf_len = self->echo_buffer_len / sizeof(uint16_t);
+    uint32_t echo_buffer_pos = channel == 1 ? self->echo_buffer_right_pos : self->echo_buffer_left_pos;
+
+    for (uint32_t i = 0; i < length; i++) {
+        int32_t word = echo_sample(self, words[i], mix, decay, echo_buf_len, &echo_buffer_pos);
+        words[i] = MP_LIKELY(self->base.bits_per_sample == 16) ? (int16_t)word : (int8_t)word;
+    }
+
+    if (self->freq_shift) {
+        if (channel == 1) {
+            self->echo_buffer_right_pos = echo_buffer_pos;
+        } else {
+            self->echo_buffer_left_pos = echo_buffer_pos;
+        }
+    }
+}
+
 audioio_get_buffer_result_t audiodelays_echo_get_buffer(audiodelays_echo_obj_t *self, bool single_channel_output, uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length) {
 
@@ -266,15 +359,9 @@ audioio_get_buffer_result_t audiodelays_echo_get_buffer(audiodelays_echo_obj_t *
             n = MIN(MIN(self->sample_buffer_length, length), SYNTHIO_MAX_DUR * self->base.channel_count);
         }
 
-        // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
         shared_bindings_synthio_lfo_tick(self->base.sample_rate, n / self->base.channel_count);
-        mp_float_t mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0)) * MICROPY_FLOAT_CONST(2.0);
-        mp_float_t decay = synthio_block_slot_get_limited(&self->decay, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
-
-        mp_float_t f_delay_ms = synthio_block_slot_get(&self->delay_ms);
-        if (MICROPY_FLOAT_C_FUN(fabs)(self->current_delay_ms - f_delay_ms) >= self->sample_ms) {
-            recalculate_delay(self, f_delay_ms);
-        }
+        mp_float_t mix, decay;
+        echo_get_params(self, &mix, &decay);
 
         uint32_t echo_buf_len = self->echo_buffer_len / sizeof(uint16_t);
 
@@ -378,45 +465,7 @@ audioio_get_buffer_result_t audiodelays_echo_get_buffer(audiodelays_echo_obj_t *
                         }
                     }
 
-                    int32_t echo, word = 0;
-                    uint32_t next_buffer_pos = 0;
-                    if (self->freq_shift) {
-                        echo = echo_buffer[echo_buffer_pos >> 8];
-                        next_buffer_pos = echo_buffer_pos + self->echo_buffer_rate;
-                    } else {
-                        echo = echo_buffer[self->echo_buffer_read_pos++];
-                        word = (int32_t)(echo * decay + sample_word);
-                    }
-
-                    if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                        if (self->freq_shift) {
-                            for (uint32_t j = echo_buffer_pos >> 8; j < next_buffer_pos >> 8; j++) {
-                                word = (int32_t)(echo_buffer[j % echo_buf_len] * decay + sample_word);
-                                word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
-                                echo_buffer[j % echo_buf_len] = (int16_t)word;
-                            }
-                        } else {
-                            word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
-                            echo_buffer[self->echo_buffer_write_pos++] = (int16_t)word;
-                        }
-                    } else {
-                        if (self->freq_shift) {
-                            for (uint32_t j = echo_buffer_pos >> 8; j < next_buffer_pos >> 8; j++) {
-                                word = (int32_t)(echo_buffer[j % echo_buf_len] * decay + sample_word);
-                                // Do not have mix_down for 8 bit so just hard cap samples into 1 byte
-                                word = MIN(MAX(word, -128), 127);
-                                echo_buffer[j % echo_buf_len] = (int8_t)word;
-                            }
-                        } else {
-                            // Do not have mix_down for 8 bit so just hard cap samples into 1 byte
-                            word = MIN(MAX(word, -128), 127);
-                            echo_buffer[self->echo_buffer_write_pos++] = (int8_t)word;
-                        }
-                    }
-
-                    word = (int32_t)((sample_word * MIN(MICROPY_FLOAT_CONST(2.0) - mix, MICROPY_FLOAT_CONST(1.0)))
-                        + (echo * MIN(mix, MICROPY_FLOAT_CONST(1.0))));
-                    word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
+                    int32_t word = echo_sample(self, sample_word, mix, decay, echo_buf_len, &echo_buffer_pos);
 
                     if (MP_LIKELY(self->base.bits_per_sample == 16)) {
                         word_buffer[i] = (int16_t)word;
@@ -431,17 +480,6 @@ audioio_get_buffer_result_t audiodelays_echo_get_buffer(audiodelays_echo_obj_t *
                             hword_buffer[i] = (uint8_t)mixed ^ 0x80;
                         }
                     }
-
-                    if (self->freq_shift) {
-                        echo_buffer_pos = next_buffer_pos % (echo_buf_len << 8);
-                    } else {
-                        if (self->echo_buffer_read_pos >= echo_buf_len) {
-                            self->echo_buffer_read_pos = 0;
-                        }
-                        if (self->echo_buffer_write_pos >= echo_buf_len) {
-                            self->echo_buffer_write_pos = 0;
-                        }
-                    }
                 }
             }
 
@@ -53,6 +53,10 @@ void audiodelays_echo_reset_buffer(audiodelays_echo_obj_t *self,
     bool single_channel_output,
     uint8_t channel);
 
+// Applies the echo in place to `length` signed samples in the effect's bits_per_sample range,
+// for audiofx.Chain. Block inputs must already be ticked for these samples.
+void audiodelays_echo_process(audiodelays_echo_obj_t *self, int32_t *words, uint32_t length, uint8_t channel);
+
 audioio_get_buffer_result_t audiodelays_echo_get_buffer(audiodelays_echo_obj_t *self,
     bool single_channel_output,
     uint8_t channel,
@@ -51,6 +51,10 @@ void audiodelays_pitch_shift_reset_buffer(audiodelays_pitch_shift_obj_t *self,
     bool single_channel_output,
     uint8_t channel);
 
+// Applies the pitch shift in place to `length` signed samples in the effect's bits_per_sample range,
+// for audiofx.Chain. Block inputs must already be ticked for these samples.
+void audiodelays_pitch_shift_process(audiodelays_pitch_shift_obj_t *self, int32_t *words, uint32_t length, uint8_t channel);
+
 audioio_get_buffer_result_t audiodelays_pitch_shift_get_buffer(audiodelays_pitch_shift_obj_t *self,
     bool single_channel_output,
     uint8_t channel,
@@ -167,6 +167,112 @@ static mp_float_t db_to_linear(mp_float_t value) {
     return MICROPY_FLOAT_C_FUN(exp)(value * MICROPY_FLOAT_CONST(0.11512925464970228420089957273422));
 }
 
+typedef struct {
+    mp_float_t drive;
+    mp_float_t pre_gain;
+    mp_float_t post_gain;
+    mp_float_t mix;
+    uint32_t word_mask;
+} distortion_params_t;
+
+// get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
+static void distortion_get_params(audiofilters_distortion_obj_t *self, distortion_params_t *params) {
+    mp_float_t drive = synthio_block_slot_get_limited(&self->drive, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
+    params->pre_gain = db_to_linear(synthio_block_slot_get_limited(&self->pre_gain, MICROPY_FLOAT_CONST(-60.0), MICROPY_FLOAT_CONST(60.0)));
+    params->post_gain = db_to_linear(synthio_block_slot_get_limited(&self->post_gain, MICROPY_FLOAT_CONST(-80.0), MICROPY_FLOAT_CONST(24.0)));
+    params->mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
+
+    // Modify drive value depending on mode
+    params->word_mask = 0;
+    if (self->mode == DISTORTION_MODE_CLIP) {
+        drive = MICROPY_FLOAT_CONST(1.0001) - drive;
+    } else if (self->mode == DISTORTION_MODE_WAVESHAPE) {
+        drive = MICROPY_FLOAT_CONST(2.0) * drive / (MICROPY_FLOAT_CONST(1.0001) - drive);
+    } else if (self->mode == DISTORTION_MODE_LOFI) {
+        params->word_mask = 0xFFFFFFFF ^ ((1 << (uint32_t)MICROPY_FLOAT_C_FUN(round)(drive * MICROPY_FLOAT_CONST(14.0))) - 1);
+    }
+    params->drive = drive;
+}
+
+// Distorts one signed sample and returns the mixed output, which the caller narrows to the sample size
+static inline int32_t distortion_sample(audiofilters_distortion_obj_t *self, int32_t sample_word, const distortion_params_t *params) {
+    mp_float_t drive = params->drive;
+    mp_float_t post_gain = params->post_gain;
+
+    // Apply pre-gain
+    int32_t word = (int32_t)(sample_word * params->pre_gain);
+
+    // Apply bit mask before converting to float
+    if (self->mode == DISTORTION_MODE_LOFI) {
+        word = word & params->word_mask;
+    }
+
+    if (self->mode != DISTORTION_MODE_LOFI || self->soft_clip) {
+        // Convert sample to float
+        mp_float_t wordf = word / MICROPY_FLOAT_CONST(32768.0);
+
+        switch (self->mode) {
+            case DISTORTION_MODE_CLIP: {
+                wordf = MICROPY_FLOAT_C_FUN(pow)(MICROPY_FLOAT_C_FUN(fabs)(wordf), drive);
+                if (word < 0) {
+                    wordf *= MICROPY_FLOAT_CONST(-1.0);
+                }
+            } break;
+            case DISTORTION_MODE_LOFI:
+                break;
+            case DISTORTION_MODE_OVERDRIVE: {
+                wordf *= MICROPY_FLOAT_CONST(0.686306);
+                mp_float_t z = MICROPY_FLOAT_CONST(1.0) + MICROPY_FLOAT_C_FUN(exp)(MICROPY_FLOAT_C_FUN(sqrt)(MICROPY_FLOAT_C_FUN(fabs)(wordf)) * MICROPY_FLOAT_CONST(-0.75));
+                mp_float_t word_exp = MICROPY_FLOAT_C_FUN(exp)(wordf);
+                wordf *= MICROPY_FLOAT_CONST(-1.0);
+                wordf = (word_exp - MICROPY_FLOAT_C_FUN(exp)(wordf * z)) / (word_exp + MICROPY_FLOAT_C_FUN(exp)(wordf));
+            } break;
+            case DISTORTION_MODE_WAVESHAPE: {
+                wordf = (MICROPY_FLOAT_CONST(1.0) + drive) * wordf / (MICROPY_FLOAT_CONST(1.0) + drive * MICROPY_FLOAT_C_FUN(fabs)(wordf));
+            } break;
+        }
+
+        // Apply post-gain
+        wordf = wordf * post_gain;
+
+        // Soft clip
+        if (self->soft_clip) {
+            if (wordf > 0) {
+                wordf = MICROPY_FLOAT_CONST(1.0) - MICROPY_FLOAT_C_FUN(exp)(-wordf);
+            } else {
+                wordf = MICROPY_FLOAT_CONST(-1.0) + MICROPY_FLOAT_C_FUN(exp)(wordf);
+            }
+        }
+
+        // Convert sample back to signed integer
+        word = (int32_t)(wordf * MICROPY_FLOAT_CONST(32767.0));
+    } else {
+        // Apply post-gain
+        word = (int32_t)(word * post_gain);
+    }
+
+    // Hard clip
+    if (!self->soft_clip) {
+        word = MIN(MAX(word, -32767), 32768);
+    }
+
+    return (int32_t)((sample_word * (MICROPY_FLOAT_CONST(1.0) - params->mix)) + (word * params->mix));
+}
+
+void audiofilters_distortion_process(audiofilters_distortion_obj_t *self, int32_t *words, uint32_t length, uint8_t channel) {
+    (void)channel;
+    distortion_params_t params;
+    distortion_get_params(self, &params);
+    if (params.mix <= MICROPY_FLOAT_CONST(0.01)) { // if mix is zero pure sample only
+        return;
+    }
+
+    for (uint32_t i = 0; i < length; i++) {
+        int32_t word = distortion_sample(self, words[i], &params);
+        words[i] = MP_LIKELY(self->base.bits_per_sample == 16) ? (int16_t)word : (int8_t)word;
+    }
+}
+
 audioio_get_buffer_result_t audiofilters_distortion_get_buffer(audiofilters_distortion_obj_t *self, bool single_channel_output, uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length) {
 
@@ -226,24 +332,11 @@ audioio_get_buffer_result_t audiofilters_distortion_get_buffer(audiofilters_dist
             int16_t *sample_src = (int16_t *)self->sample_remaining_buffer; // for 16-bit samples
             int8_t *sample_hsrc = (int8_t *)self->sample_remaining_buffer; // for 8-bit samples
 
-            // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
             shared_bindings_synthio_lfo_tick(self->base.sample_rate, n / self->base.channel_count);
-            mp_float_t drive = synthio_block_slot_get_limited(&self->drive, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
-            mp_float_t pre_gain = db_to_linear(synthio_block_slot_get_limited(&self->pre_gain, MICROPY_FLOAT_CONST(-60.0), MICROPY_FLOAT_CONST(60.0)));
-            mp_float_t post_gain = db_to_linear(synthio_block_slot_get_limited(&self->post_gain, MICROPY_FLOAT_CONST(-80.0), MICROPY_FLOAT_CONST(24.0)));
-            mp_float_t mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
-
-            // Modify drive value depending on mode
-            uint32_t word_mask = 0;
-            if (self->mode == DISTORTION_MODE_CLIP) {
-                drive = MICROPY_FLOAT_CONST(1.0001) - drive;
-            } else if (self->mode == DISTORTION_MODE_WAVESHAPE) {
-                drive = MICROPY_FLOAT_CONST(2.0) * drive / (MICROPY_FLOAT_CONST(1.0001) - drive);
-            } else if (self->mode == DISTORTION_MODE_LOFI) {
-                word_mask = 0xFFFFFFFF ^ ((1 << (uint32_t)MICROPY_FLOAT_C_FUN(round)(drive * MICROPY_FLOAT_CONST(14.0))) - 1);
-            }
+            distortion_params_t params;
+            distortion_get_params(self, &params);
 
-            if (mix <= MICROPY_FLOAT_CONST(0.01)) { // if mix is zero pure sample only
+            if (params.mix <= MICROPY_FLOAT_CONST(0.01)) { // if mix is zero pure sample only
                 for (uint32_t i = 0; i < n; i++) {
                     if (MP_LIKELY(self->base.bits_per_sample == 16)) {
                         word_buffer[i] = sample_src[i];
@@ -265,70 +358,15 @@ audioio_get_buffer_result_t audiofilters_distortion_get_buffer(audiofilters_dist
                         }
                     }
 
-                    // Apply pre-gain
-                    int32_t word = (int32_t)(sample_word * pre_gain);
-
-                    // Apply bit mask before converting to float
-                    if (self->mode == DISTORTION_MODE_LOFI) {
-                        word = word & word_mask;
-                    }
-
-                    if (self->mode != DISTORTION_MODE_LOFI || self->soft_clip) {
-                        // Convert sample to float
-                        mp_float_t wordf = word / MICROPY_FLOAT_CONST(32768.0);
-
-                        switch (self->mode) {
-                            case DISTORTION_MODE_CLIP: {
-                                wordf = MICROPY_FLOAT_C_FUN(pow)(MICROPY_FLOAT_C_FUN(fabs)(wordf), drive);
-                                if (word < 0) {
-                                    wordf *= MICROPY_FLOAT_CONST(-1.0);
-                                }
-                            } break;
-                            case DISTORTION_MODE_LOFI:
-                                break;
-                            case DISTORTION_MODE_OVERDRIVE: {
-                                wordf *= MICROPY_FLOAT_CONST(0.686306);
-                                mp_float_t z = MICROPY_FLOAT_CONST(1.0) + MICROPY_FLOAT_C_FUN(exp)(MICROPY_FLOAT_C_FUN(sqrt)(MICROPY_FLOAT_C_FUN(fabs)(wordf)) * MICROPY_FLOAT_CONST(-0.75));
-                                mp_float_t word_exp = MICROPY_FLOAT_C_FUN(exp)(wordf);
-                                wordf *= MICROPY_FLOAT_CONST(-1.0);
-                                wordf = (word_exp - MICROPY_FLOAT_C_FUN(exp)(wordf * z)) / (word_exp + MICROPY_FLOAT_C_FUN(exp)(wordf));
-                            } break;
-                            case DISTORTION_MODE_WAVESHAPE: {
-                                wordf = (MICROPY_FLOAT_CONST(1.0) + drive) * wordf / (MICROPY_FLOAT_CONST(1.0) + drive * MICROPY_FLOAT_C_FUN(fabs)(wordf));
-                            } break;
-                        }
-
-                        // Apply post-gain
-                        wordf = wordf * post_gain;
-
-                        // Soft clip
-                        if (self->soft_clip) {
-                            if (wordf > 0) {
-                                wordf = MICROPY_FLOAT_CONST(1.0) - MICROPY_FLOAT_C_FUN(exp)(-wordf);
-                            } else {
-                                wordf = MICROPY_FLOAT_CONST(-1.0) + MICROPY_FLOAT_C_FUN(exp)(wordf);
-                            }
-                        }
-
-                        // Convert sample back to signed integer
-                        word = (int32_t)(wordf * MICROPY_FLOAT_CONST(32767.0));
-                    } else {
-                        // Apply post-gain
-                        word = (int32_t)(word * post_gain);
-                    }
-
-                    // Hard clip
-                    if (!self->soft_clip) {
-                        word = MIN(MAX(word, -32767), 32768);
-                    }
+                    int32_t word = distortion_sample(self, sample_word, &params);
 
                     if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                        word_buffer[i] = (int16_t)((sample_word * (MICROPY_FLOAT_CONST(1.0) - mix)) + (word * mix));
+                        word_buffer[i] = (int16_t)word;
                         if (!self->base.samples_signed) {
                             word_buffer[i] ^= 0x8000;
                         }
                     } else {
-                        int8_t mixed = (int8_t)((sample_word * (MICROPY_FLOAT_CONST(1.0) - mix)) + (word * mix));
+                        int8_t mixed = (int8_t)word;
                         if (self->base.samples_signed) {
                             hword_buffer[i] = mixed;
                         } else {
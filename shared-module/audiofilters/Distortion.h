@@ -46,6 +46,10 @@ void audiofilters_distortion_reset_buffer(audiofilters_distortion_obj_t *self,
     bool single_channel_output,
     uint8_t channel);
 
+// Applies the distortion in place to `length` signed samples in the effect's bits_per_sample range,
+// for audiofx.Chain. Block inputs must already be ticked for these samples.
+void audiofilters_distortion_process(audiofilters_distortion_obj_t *self, int32_t *words, uint32_t length, uint8_t channel);
+
 audioio_get_buffer_result_t audiofilters_distortion_get_buffer(audiofilters_distortion_obj_t *self,
     bool single_channel_output, uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length);
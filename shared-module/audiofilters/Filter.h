@@ -43,6 +43,10 @@ void audiofilters_filter_reset_buffer(audiofilters_filter_obj_t *self,
     bool single_channel_output,
     uint8_t channel);
 
+// Applies the filter in place to `length` signed samples in the effect's bits_per_sample range,
+// for audiofx.Chain. Block inputs must already be ticked for these samples.
+void audiofilters_filter_process(audiofilters_filter_obj_t *self, int32_t *words, uint32_t length, uint8_t channel);
+
 audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_obj_t *self,
     bool single_channel_output,
     uint8_t channel,
@@ -0,0 +1,239 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/audiofx/Chain.h"
+#include "shared-bindings/audiocore/__init__.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared-module/synthio/__init__.h"
+
+#if CIRCUITPY_AUDIODELAYS
+#include "shared-bindings/audiodelays/Chorus.h"
+#include "shared-bindings/audiodelays/Echo.h"
+#include "shared-bindings/audiodelays/PitchShift.h"
+#endif
+#if CIRCUITPY_AUDIOFILTERS
+#include "shared-bindings/audiofilters/Distortion.h"
+#include "shared-bindings/audiofilters/Filter.h"
+#endif
+
+static const struct {
+    const mp_obj_type_t *type;
+    audiofx_process_fun process;
+} stage_kernels[] = {
+    #if CIRCUITPY_AUDIODELAYS
+    { &audiodelays_echo_type, (audiofx_process_fun)audiodelays_echo_process },
+    { &audiodelays_chorus_type, (audiofx_process_fun)audiodelays_chorus_process },
+    { &audiodelays_pitch_shift_type, (audiofx_process_fun)audiodelays_pitch_shift_process },
+    #endif
+    #if CIRCUITPY_AUDIOFILTERS
+    { &audiofilters_filter_type, (audiofx_process_fun)audiofilters_filter_process },
+    { &audiofilters_distortion_type, (audiofx_process_fun)audiofilters_distortion_process },
+    #endif
+};
+
+static audiofx_process_fun find_kernel(mp_obj_t effect) {
+    for (size_t i = 0; i < MP_ARRAY_SIZE(stage_kernels); i++) {
+        if (mp_obj_is_type(effect, stage_kernels[i].type)) {
+            return stage_kernels[i].process;
+        }
+    }
+    mp_raise_TypeError_varg(MP_ERROR_TEXT("%q in %q must be of type %q, not %q"),
+        MP_QSTR_object, MP_QSTR_effects, MP_QSTR_effect, mp_obj_get_type(effect)->name);
+}
+
+void common_hal_audiofx_chain_construct(audiofx_chain_obj_t *self,
+    mp_obj_t effects, uint32_t buffer_size) {
+    size_t n_items;
+    mp_obj_t *items;
+    mp_obj_tuple_get(effects, &n_items, &items);
+    mp_arg_validate_length_min(n_items, 1, MP_QSTR_effects);
+
+    // The chain plays in the format of its effects, which must all agree.
+    const audiosample_base_t *first = audiosample_check(items[0]);
+    self->base.bits_per_sample = first->bits_per_sample;
+    self->base.samples_signed = first->samples_signed;
+    self->base.channel_count = first->channel_count;
+    self->base.sample_rate = first->sample_rate;
+    self->base.single_buffer = false;
+    self->base.max_buffer_length = buffer_size;
+
+    self->stages = m_malloc(n_items * sizeof(audiofx_chain_stage_t));
+    for (size_t i = 0; i < n_items; i++) {
+        audiofx_process_fun process = find_kernel(items[i]);
+        audiosample_must_match(&self->base, items[i]);
+        self->stages[i].effect = items[i];
+        self->stages[i].process = process;
+    }
+    self->stages_len = n_items;
+    self->effects = effects;
+
+    self->buffer_len = buffer_size; // in bytes
+
+    self->buffer[0] = m_malloc(self->buffer_len);
+    memset(self->buffer[0], 0, self->buffer_len);
+
+    self->buffer[1] = m_malloc(self->buffer_len);
+    memset(self->buffer[1], 0, self->buffer_len);
+
+    self->last_buf_idx = 1; // Which buffer to use first, toggle between 0 and 1
+
+    self->work_buffer = m_malloc(SYNTHIO_MAX_DUR * self->base.channel_count * sizeof(int32_t));
+
+    self->sample = NULL;
+    self->sample_remaining_buffer = NULL;
+    self->sample_buffer_length = 0;
+    self->loop = false;
+    self->more_data = false;
+}
+
+void common_hal_audiofx_chain_deinit(audiofx_chain_obj_t *self) {
+    audiosample_mark_deinit(&self->base);
+    self->buffer[0] = NULL;
+    self->buffer[1] = NULL;
+    self->work_buffer = NULL;
+    self->stages = NULL;
+    self->stages_len = 0;
+    self->effects = mp_const_none;
+    self->sample = NULL;
+}
+
+mp_obj_t common_hal_audiofx_chain_get_effects(audiofx_chain_obj_t *self) {
+    return self->effects;
+}
+
+void audiofx_chain_reset_buffer(audiofx_chain_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel) {
+
+    memset(self->buffer[0], 0, self->buffer_len);
+    memset(self->buffer[1], 0, self->buffer_len);
+    for (size_t i = 0; i < self->stages_len; i++) {
+        audiosample_reset_buffer(self->stages[i].effect, single_channel_output, channel);
+    }
+}
+
+bool common_hal_audiofx_chain_get_playing(audiofx_chain_obj_t *self) {
+    return self->sample != NULL;
+}
+
+void common_hal_audiofx_chain_play(audiofx_chain_obj_t *self, mp_obj_t sample, bool loop) {
+    audiosample_must_match(&self->base, sample);
+    for (size_t i = 0; i < self->stages_len; i++) {
+        audiosample_check_for_deinit(MP_OBJ_TO_PTR(self->stages[i].effect));
+    }
+
+    self->sample = sample;
+    self->loop = loop;
+
+    audiosample_reset_buffer(self->sample, false, 0);
+    audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->sample_remaining_buffer, &self->sample_buffer_length);
+
+    // Track remaining sample length in terms of bytes per sample
+    self->sample_buffer_length /= (self->base.bits_per_sample / 8);
+    // Store if we have more data in the sample to retrieve
+    self->more_data = result == GET_BUFFER_MORE_DATA;
+}
+
+void common_hal_audiofx_chain_stop(audiofx_chain_obj_t *self) {
+    // Like the effects themselves, the chain keeps playing their tails after the sample stops
+    self->sample = NULL;
+}
+
+audioio_get_buffer_result_t audiofx_chain_get_buffer(audiofx_chain_obj_t *self, bool single_channel_output, uint8_t channel,
+    uint8_t **buffer, uint32_t *buffer_length) {
+
+    if (!single_channel_output) {
+        channel = 0;
+    }
+
+    // Switch our buffers to the other buffer
+    self->last_buf_idx = !self->last_buf_idx;
+
+    // If we are using 16 bit samples we need a 16 bit pointer, 8 bit needs an 8 bit pointer
+    int16_t *word_buffer = (int16_t *)self->buffer[self->last_buf_idx];
+    int8_t *hword_buffer = self->buffer[self->last_buf_idx];
+    uint32_t length = self->buffer_len / (self->base.bits_per_sample / 8);
+    int32_t *words = self->work_buffer;
+
+    // Loop over the entire length of our buffer to fill it, this may require several calls to get data from the sample
+    while (length != 0) {
+        // Check if there is no more sample to play, we will either load more data, reset the sample if loop is on or clear the sample
+        if (self->sample_buffer_length == 0) {
+            if (!self->more_data) { // The sample has indicated it has no more data to play
+                if (self->loop && self->sample) { // If we are supposed to loop reset the sample to the start
+                    audiosample_reset_buffer(self->sample, false, 0);
+                } else { // If we were not supposed to loop the sample, stop playing it but keep running the effects
+                    self->sample = NULL;
+                }
+            }
+            if (self->sample) {
+                // Load another sample buffer to play
+                audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->sample_remaining_buffer, &self->sample_buffer_length);
+                // Track length in terms of words.
+                self->sample_buffer_length /= (self->base.bits_per_sample / 8);
+                self->more_data = result == GET_BUFFER_MORE_DATA;
+            }
+        }
+
+        uint32_t n;
+        if (self->sample == NULL) {
+            // Silence goes through the effects so that echoes ring out
+            n = MIN(length, SYNTHIO_MAX_DUR * self->base.channel_count);
+            memset(words, 0, n * sizeof(int32_t));
+        } else {
+            n = MIN(MIN(self->sample_buffer_length, length), SYNTHIO_MAX_DUR * self->base.channel_count);
+            if (MP_LIKELY(self->base.bits_per_sample == 16)) {
+                int16_t *sample_src = (int16_t *)self->sample_remaining_buffer;
+                uint16_t flip = self->base.samples_signed ? 0 : 0x8000;
+                for (uint32_t i = 0; i < n; i++) {
+                    words[i] = (int16_t)(sample_src[i] ^ flip);
+                }
+            } else {
+                int8_t *sample_hsrc = (int8_t *)self->sample_remaining_buffer;
+                uint8_t flip = self->base.samples_signed ? 0 : 0x80;
+                for (uint32_t i = 0; i < n; i++) {
+                    words[i] = (int8_t)(sample_hsrc[i] ^ flip);
+                }
+            }
+            self->sample_remaining_buffer += (n * (self->base.bits_per_sample / 8));
+            self->sample_buffer_length -= n;
+        }
+
+        // Block inputs advance once for every stage, which then run back to back on the same samples
+        shared_bindings_synthio_lfo_tick(self->base.sample_rate, n / self->base.channel_count);
+        for (size_t i = 0; i < self->stages_len; i++) {
+            self->stages[i].process(self->stages[i].effect, words, n, channel);
+        }
+
+        if (MP_LIKELY(self->base.bits_per_sample == 16)) {
+            uint16_t flip = self->base.samples_signed ? 0 : 0x8000;
+            for (uint32_t i = 0; i < n; i++) {
+                word_buffer[i] = (int16_t)words[i] ^ flip;
+            }
+        } else {
+            uint8_t flip = self->base.samples_signed ? 0 : 0x80;
+            for (uint32_t i = 0; i < n; i++) {
+                hword_buffer[i] = (int8_t)words[i] ^ flip;
+            }
+        }
+
+        // Update the remaining length and the buffer positions based on how much we wrote into our buffer
+        length -= n;
+        word_buffer += n;
+        hword_buffer += n;
+    }
+
+    // Finally pass our buffer and length to the calling audio function
+    *buffer = (uint8_t *)self->buffer[self->last_buf_idx];
+    *buffer_length = self->buffer_len;
+
+    // The chain always returns more data so that effect tails keep playing
+    return GET_BUFFER_MORE_DATA;
+}
@@ -0,0 +1,51 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "shared-module/audiocore/__init__.h"
+
+// Applies one effect in place to signed samples, see audiodelays_echo_process.
+typedef void (*audiofx_process_fun)(mp_obj_t effect, int32_t *words, uint32_t length, uint8_t channel);
+
+typedef struct {
+    mp_obj_t effect;
+    audiofx_process_fun process;
+} audiofx_chain_stage_t;
+
+typedef struct {
+    audiosample_base_t base;
+    mp_obj_t effects; // tuple
+    audiofx_chain_stage_t *stages;
+    size_t stages_len;
+
+    int8_t *buffer[2];
+    uint8_t last_buf_idx;
+    uint32_t buffer_len; // max buffer in bytes
+
+    // Every stage runs on these signed samples before they are converted back to the output format.
+    int32_t *work_buffer; // SYNTHIO_MAX_DUR frames
+
+    uint8_t *sample_remaining_buffer;
+    uint32_t sample_buffer_length;
+
+    bool loop;
+    bool more_data;
+
+    mp_obj_t sample;
+} audiofx_chain_obj_t;
+
+void audiofx_chain_reset_buffer(audiofx_chain_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel);
+
+audioio_get_buffer_result_t audiofx_chain_get_buffer(audiofx_chain_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length);  // length in bytes
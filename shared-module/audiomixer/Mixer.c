@@ -8,6 +8,7 @@
 #include "shared-bindings/audiomixer/MixerVoice.h"
 
 #include <stdint.h>
+#include <string.h>
 
 #include "py/runtime.h"
 #include "shared-module/audiocore/__init__.h"
@@ -26,13 +27,13 @@ void common_hal_audiomixer_mixer_construct(audiomixer_mixer_obj_t *self,
     uint32_t sample_rate) {
     self->len = buffer_size / 2 / sizeof(uint32_t) * sizeof(uint32_t);
 
-    self->first_buffer = m_malloc(self->len);
+    self->first_buffer = m_malloc_bulk(self->len);
     if (self->first_buffer == NULL) {
         common_hal_audiomixer_mixer_deinit(self);
         m_malloc_fail(self->len);
     }
 
-    self->second_buffer = m_malloc(self->len);
+    self->second_buffer = m_malloc_bulk(self->len);
     if (self->second_buffer == NULL) {
         common_hal_audiomixer_mixer_deinit(self);
         m_malloc_fail(self->len);
@@ -98,11 +99,12 @@ static inline uint32_t mult16signed(uint32_t val, int32_t mul) {
     int32_t hi, lo;
     enum { bits = 16 }; // saturate to 16 bits
     enum { shift = 15 }; // shift is done automatically
-    asm volatile ("smulwb %0, %1, %2" : "=r" (lo) : "r" (mul), "r" (val));
-    asm volatile ("smulwt %0, %1, %2" : "=r" (hi) : "r" (mul), "r" (val));
-    asm volatile ("ssat %0, %1, %2, asr %3" : "=r" (lo) : "I" (bits), "r" (lo), "I" (shift));
-    asm volatile ("ssat %0, %1, %2, asr %3" : "=r" (hi) : "I" (bits), "r" (hi), "I" (shift));
-    asm volatile ("pkhbt %0, %1, %2, lsl #16" : "=r" (val) : "r" (lo), "r" (hi)); // pack
+    // Not volatile: these have no side effects, so they can be scheduled between other work.
+    asm ("smulwb %0, %1, %2" : "=r" (lo) : "r" (mul), "r" (val));
+    asm ("smulwt %0, %1, %2" : "=r" (hi) : "r" (mul), "r" (val));
+    asm ("ssat %0, %1, %2, asr %3" : "=r" (lo) : "I" (bits), "r" (lo), "I" (shift));
+    asm ("ssat %0, %1, %2, asr %3" : "=r" (hi) : "I" (bits), "r" (hi), "I" (shift));
+    asm ("pkhbt %0, %1, %2, lsl #16" : "=r" (val) : "r" (lo), "r" (hi)); // pack
     return val;
     #else
     uint32_t result = 0;
@@ -154,6 +156,78 @@ static inline uint32_t pack8(uint32_t val) {
     return ((val & 0xff000000) >> 16) | ((val & 0xff00) >> 8);
 }
 
+// Scales one word of two signed 16-bit samples by level and, unless this is the first voice,
+// adds it to what is already in the output. unity and first are compile time constants in every
+// caller, so each kernel below is a straight line loop.
+__attribute__((always_inline))
+static inline uint32_t mix_word(uint32_t word, uint32_t out, int32_t level, bool unity, bool first) {
+    if (!unity) {
+        word = mult16signed(word, level);
+    }
+    return first ? word : add16signed(word, out);
+}
+
+// 16-bit samples: each word is a stereo frame or two mono frames. Two words are done per
+// iteration so the multiplies of one can overlap the loads and saturation of the other.
+__attribute__((always_inline))
+static inline void mix_words_16(uint32_t *restrict dst, const uint32_t *restrict src, uint32_t n,
+    int32_t level, bool samples_signed, bool unity, bool first) {
+    uint32_t i = 0;
+    for (; i + 1 < n; i += 2) {
+        uint32_t a = src[i];
+        uint32_t b = src[i + 1];
+        if (!samples_signed) {
+            a = tosigned16(a);
+            b = tosigned16(b);
+        }
+        dst[i] = mix_word(a, dst[i], level, unity, first);
+        dst[i + 1] = mix_word(b, dst[i + 1], level, unity, first);
+    }
+    if (i < n) {
+        uint32_t a = src[i];
+        if (!samples_signed) {
+            a = tosigned16(a);
+        }
+        dst[i] = mix_word(a, dst[i], level, unity, first);
+    }
+}
+
+// 8-bit samples: each word holds four samples, which are widened into two words of 16-bit
+// samples so the same saturating arithmetic applies, then narrowed back.
+__attribute__((always_inline))
+static inline void mix_words_8(uint32_t *restrict dst, const uint32_t *restrict src, uint32_t n,
+    int32_t level, bool samples_signed, bool unity, bool first) {
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t word = src[i];
+        uint32_t lo = unpack8(word & 0xffff);
+        uint32_t hi = unpack8(word >> 16);
+        if (!samples_signed) {
+            lo = tosigned16(lo);
+            hi = tosigned16(hi);
+        }
+        uint32_t out = first ? 0 : dst[i];
+        lo = mix_word(lo, unpack8(out & 0xffff), level, unity, first);
+        hi = mix_word(hi, unpack8(out >> 16), level, unity, first);
+        dst[i] = pack8(lo) | (pack8(hi) << 16);
+    }
+}
+
+// Picks the kernel for a format once per source buffer rather than testing it per sample.
+#define MIX_WORDS(kernel, samples_signed) \
+    do { \
+        if (unity) { \
+            if (first) { \
+                kernel(word_buffer, src, n, level, samples_signed, true, true); \
+            } else { \
+                kernel(word_buffer, src, n, level, samples_signed, true, false); \
+            } \
+        } else if (first) { \
+            kernel(word_buffer, src, n, level, samples_signed, false, true); \
+        } else { \
+            kernel(word_buffer, src, n, level, samples_signed, false, false); \
+        } \
+    } while (0)
+
 static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
     audiomixer_mixervoice_obj_t *voice, bool voices_active,
     uint32_t *word_buffer, uint32_t length) {
@@ -189,59 +263,24 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
         uint16_t level = voice->level;
         #endif
 
-        // First active voice gets copied over verbatim.
-        if (!voices_active) {
-            if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                if (MP_LIKELY(self->base.samples_signed)) {
-                    for (uint32_t i = 0; i < n; i++) {
-                        uint32_t v = src[i];
-                        word_buffer[i] = mult16signed(v, level);
-                    }
-                } else {
-                    for (uint32_t i = 0; i < n; i++) {
-                        uint32_t v = src[i];
-                        v = tosigned16(v);
-                        word_buffer[i] = mult16signed(v, level);
-                    }
-                }
+        // A silent voice leaves the mix alone; the first voice still has to clear it.
+        bool first = !voices_active;
+        bool unity = level == (1 << 15);
+        if (level == 0) {
+            if (first) {
+                memset(word_buffer, 0, n * sizeof(uint32_t));
+            }
+        } else if (MP_LIKELY(self->base.bits_per_sample == 16)) {
+            if (MP_LIKELY(self->base.samples_signed)) {
+                MIX_WORDS(mix_words_16, true);
             } else {
-                uint16_t *hword_buffer = (uint16_t *)word_buffer;
-                uint16_t *hsrc = (uint16_t *)src;
-                for (uint32_t i = 0; i < n * 2; i++) {
-                    uint32_t word = unpack8(hsrc[i]);
-                    if (MP_LIKELY(!self->base.samples_signed)) {
-                        word = tosigned16(word);
-                    }
-                    word = mult16signed(word, level);
-                    hword_buffer[i] = pack8(word);
-                }
+                MIX_WORDS(mix_words_16, false);
             }
         } else {
-            if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                if (MP_LIKELY(self->base.samples_signed)) {
-                    for (uint32_t i = 0; i < n; i++) {
-                        uint32_t word = src[i];
-                        word_buffer[i] = add16signed(mult16signed(word, level), word_buffer[i]);
-                    }
-                } else {
-                    for (uint32_t i = 0; i < n; i++) {
-                        uint32_t word = src[i];
-                        word = tosigned16(word);
-                        word_buffer[i] = add16signed(mult16signed(word, level), word_buffer[i]);
-                    }
-                }
+            if (self->base.samples_signed) {
+                MIX_WORDS(mix_words_8, true);
             } else {
-                uint16_t *hword_buffer = (uint16_t *)word_buffer;
-                uint16_t *hsrc = (uint16_t *)src;
-                for (uint32_t i = 0; i < n * 2; i++) {
-                    uint32_t word = unpack8(hsrc[i]);
-                    if (MP_LIKELY(!self->base.samples_signed)) {
-                        word = tosigned16(word);
-                    }
-                    word = mult16signed(word, level);
-                    word = add16signed(word, unpack8(hword_buffer[i]));
-                    hword_buffer[i] = pack8(word);
-                }
+                MIX_WORDS(mix_words_8, false);
             }
         }
         length -= n;
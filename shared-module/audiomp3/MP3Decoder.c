@@ -25,6 +25,13 @@
 
 #define MAX_BUFFER_LEN (MAX_NSAMP * MAX_NGRAN * MAX_NCHAN * sizeof(int16_t))
 
+#if CIRCUITPY_AUDIOMP3_FRAME_BUFFERS < 2
+#error "MP3Decoder needs at least two frame buffers"
+#endif
+// The frame buffers that can be decoded ahead. The one returned last and the
+// one before it may still be in use by the audio output.
+#define MAX_FRAMES_AHEAD (CIRCUITPY_AUDIOMP3_FRAME_BUFFERS - 2)
+
 #define DO_DEBUG (0)
 
 #if defined(MICROPY_UNIX_COVERAGE)
@@ -163,6 +170,8 @@ static bool mp3file_update_inbuf_always(audiomp3_mp3file_obj_t *self, bool block
     return INPUT_BUFFER_AVAILABLE(self->inbuf) > 0;
 }
 
+static void mp3file_queue_decode_ahead(audiomp3_mp3file_obj_t *self);
+
 /** Update the inbuf from a background callback.
  *
  * Re-queue if there's still buffer space available to read stream data
@@ -184,6 +193,8 @@ static void mp3file_update_inbuf_cb(void *self_in) {
             self);
     }
     #endif
+
+    mp3file_queue_decode_ahead(self);
 }
 
 /** Fill the input buffer if it is less than half full.
@@ -328,6 +339,13 @@ void common_hal_audiomp3_mp3file_construct(audiomp3_mp3file_obj_t *self,
             }
         }
     }
+    for (size_t i = 2; i < CIRCUITPY_AUDIOMP3_FRAME_BUFFERS; i++) {
+        self->pcm_buffer[i] = m_malloc(MAX_BUFFER_LEN);
+        if (self->pcm_buffer[i] == NULL) {
+            common_hal_audiomp3_mp3file_deinit(self);
+            m_malloc_fail(MAX_BUFFER_LEN);
+        }
+    }
     self->inbuf.read_off = self->inbuf.write_off = 0;
 
     self->decoder = MP3InitDecoder();
@@ -360,8 +378,13 @@ void common_hal_audiomp3_mp3file_set_file(audiomp3_mp3file_obj_t *self, mp_obj_t
     // this is necessary to avoid a glitch at the start of playback of a second
     // track using the same decoder object means there's still a bug in
     // get_buffer() that I didn't understand.
-    memset(self->pcm_buffer[0], 0, MAX_BUFFER_LEN);
-    memset(self->pcm_buffer[1], 0, MAX_BUFFER_LEN);
+    for (size_t i = 0; i < CIRCUITPY_AUDIOMP3_FRAME_BUFFERS; i++) {
+        memset(self->pcm_buffer[i], 0, MAX_BUFFER_LEN);
+        self->decoded_result[i] = GET_BUFFER_DONE;
+        self->decoded_empty[i] = true;
+    }
+    // Nothing is decoded ahead until playback starts.
+    self->frames_ahead = 0;
 
     /* important to do this - DSP primitives assume a bunch of state variables are 0 on first use */
     struct _MP3DecInfo *decoder = self->decoder;
@@ -398,13 +421,108 @@ void common_hal_audiomp3_mp3file_deinit(audiomp3_mp3file_obj_t *self) {
     }
     self->decoder = NULL;
     self->inbuf.buf = NULL;
-    self->pcm_buffer[0] = NULL;
-    self->pcm_buffer[1] = NULL;
+    for (size_t i = 0; i < CIRCUITPY_AUDIOMP3_FRAME_BUFFERS; i++) {
+        self->pcm_buffer[i] = NULL;
+    }
+    self->frames_ahead = 0;
     self->stream = mp_const_none;
     self->settimeout_args[0] = MP_OBJ_NULL;
     self->samples_decoded = 0;
 }
 
+/** Decode the next frame into pcm_buffer[index].
+ *
+ * Sets decoded_empty[index] when there was no frame to decode. The whole
+ * buffer is filled with silence if decoding fails.
+ */
+static audioio_get_buffer_result_t mp3file_decode_frame(audiomp3_mp3file_obj_t *self, uint8_t index) {
+    int16_t *buffer = self->pcm_buffer[index];
+    size_t frame_buffer_size_bytes = self->base.max_buffer_length;
+    self->decoded_empty[index] = false;
+
+    mp3file_skip_id3v2(self, false);
+    if (!mp3file_find_sync_word(self, false)) {
+        memset(buffer, 0, self->base.max_buffer_length);
+        self->decoded_empty[index] = true;
+        return self->eof ? GET_BUFFER_DONE : GET_BUFFER_ERROR;
+    }
+    int bytes_left = BYTES_LEFT(self);
+    uint8_t *inbuf = READ_PTR(self);
+    int err = MP3Decode(self->decoder, &inbuf, &bytes_left, buffer, 0);
+    if (err != ERR_MP3_INDATA_UNDERFLOW) {
+        CONSUME(self, BYTES_LEFT(self) - bytes_left);
+    }
+    if (err) {
+        memset(buffer, 0, frame_buffer_size_bytes);
+        if (DO_DEBUG) {
+            mp_printf(&mp_plat_print, "%s:%d err=%d\n", __FILE__, __LINE__, err);
+        }
+        if (self->eof || (err != ERR_MP3_INDATA_UNDERFLOW && err != ERR_MP3_MAINDATA_UNDERFLOW)) {
+            memset(buffer, 0, self->base.max_buffer_length);
+            self->decoded_empty[index] = true;
+            self->eof = true;
+            return GET_BUFFER_ERROR;
+        }
+    }
+
+    mp3file_skip_id3v2(self, false);
+    audioio_get_buffer_result_t result = mp3file_find_sync_word(self, false) ? GET_BUFFER_MORE_DATA : GET_BUFFER_DONE;
+
+    if (DO_DEBUG) {
+        mp_printf(&mp_plat_print, "%s:%d result=%d\n", __FILE__, __LINE__, result);
+        mp_printf(&mp_plat_print, "post-decode avail=%d eof=%d\n", (int)INPUT_BUFFER_AVAILABLE(self->inbuf), self->eof);
+    }
+    return result;
+}
+
+static void mp3file_queue_inbuf_fill(audiomp3_mp3file_obj_t *self) {
+    if (INPUT_BUFFER_SPACE(self->inbuf) > 512) {
+        background_callback_add(
+            &self->inbuf_fill_cb,
+            mp3file_update_inbuf_cb,
+            self);
+    }
+}
+
+/** Decode one frame ahead of get_buffer() from a background callback.
+ *
+ * Re-queue until MAX_FRAMES_AHEAD frames are waiting or the end of the file
+ * is decoded. If the input buffer may not hold a whole frame, wait for the
+ * input buffer callback to queue this again once it has read more.
+ */
+static void mp3file_decode_ahead_cb(void *self_in) {
+    audiomp3_mp3file_obj_t *self = self_in;
+    if (audiosample_deinited(&self->base) || self->frames_ahead >= MAX_FRAMES_AHEAD) {
+        return;
+    }
+    uint8_t last = (self->buffer_index + self->frames_ahead) % CIRCUITPY_AUDIOMP3_FRAME_BUFFERS;
+    if (self->decoded_result[last] != GET_BUFFER_MORE_DATA) {
+        return;
+    }
+    if (!self->eof && BYTES_LEFT(self) < MAINBUF_SIZE) {
+        mp3file_update_inbuf_always(self, false);
+        if (!self->eof && BYTES_LEFT(self) < MAINBUF_SIZE) {
+            return;
+        }
+    }
+    uint8_t index = (last + 1) % CIRCUITPY_AUDIOMP3_FRAME_BUFFERS;
+    self->decoded_result[index] = mp3file_decode_frame(self, index);
+    self->frames_ahead++;
+
+    mp3file_queue_inbuf_fill(self);
+    mp3file_queue_decode_ahead(self);
+}
+
+static void mp3file_queue_decode_ahead(audiomp3_mp3file_obj_t *self) {
+    if (self->frames_ahead >= MAX_FRAMES_AHEAD) {
+        return;
+    }
+    background_callback_add(
+        &self->decode_ahead_cb,
+        mp3file_decode_ahead_cb,
+        self);
+}
+
 void audiomp3_mp3file_reset_buffer(audiomp3_mp3file_obj_t *self,
     bool single_channel_output,
     uint8_t channel) {
@@ -419,6 +537,7 @@ void audiomp3_mp3file_reset_buffer(audiomp3_mp3file_obj_t *self,
         self->eof = 0;
         self->samples_decoded = 0;
         self->other_channel = -1;
+        self->frames_ahead = 0;
         mp3file_skip_id3v2(self, false);
         mp3file_find_sync_word(self, false);
     }
@@ -455,55 +574,27 @@ audioio_get_buffer_result_t audiomp3_mp3file_get_buffer(audiomp3_mp3file_obj_t *
     }
 
 
-    self->buffer_index = !self->buffer_index;
+    uint8_t index = (self->buffer_index + 1) % CIRCUITPY_AUDIOMP3_FRAME_BUFFERS;
+    if (self->frames_ahead > 0) {
+        self->frames_ahead--;
+    } else {
+        self->decoded_result[index] = mp3file_decode_frame(self, index);
+    }
+    self->buffer_index = index;
     self->other_channel = 1 - channel;
-    self->other_buffer_index = self->buffer_index;
-    int16_t *buffer = (int16_t *)(void *)self->pcm_buffer[self->buffer_index];
-    *bufptr = (uint8_t *)buffer;
+    self->other_buffer_index = index;
+    *bufptr = (uint8_t *)self->pcm_buffer[index];
 
-    mp3file_skip_id3v2(self, false);
-    if (!mp3file_find_sync_word(self, false)) {
-        memset(buffer, 0, self->base.max_buffer_length);
+    audioio_get_buffer_result_t result = self->decoded_result[index];
+    if (self->decoded_empty[index]) {
         *buffer_length = 0;
-        return self->eof ? GET_BUFFER_DONE : GET_BUFFER_ERROR;
-    }
-    int bytes_left = BYTES_LEFT(self);
-    uint8_t *inbuf = READ_PTR(self);
-    int err = MP3Decode(self->decoder, &inbuf, &bytes_left, buffer, 0);
-    if (err != ERR_MP3_INDATA_UNDERFLOW) {
-        CONSUME(self, BYTES_LEFT(self) - bytes_left);
+        return result;
     }
-    if (err) {
-        memset(buffer, 0, frame_buffer_size_bytes);
-        if (DO_DEBUG) {
-            mp_printf(&mp_plat_print, "%s:%d err=%d\n", __FILE__, __LINE__, err);
-        }
-        if (self->eof || (err != ERR_MP3_INDATA_UNDERFLOW && err != ERR_MP3_MAINDATA_UNDERFLOW)) {
-            memset(buffer, 0, self->base.max_buffer_length);
-            *buffer_length = 0;
-            self->eof = true;
-            return GET_BUFFER_ERROR;
-        }
-    }
-
     self->samples_decoded += frame_buffer_size_bytes / sizeof(int16_t);
 
-    mp3file_skip_id3v2(self, false);
-    int result = mp3file_find_sync_word(self, false) ? GET_BUFFER_MORE_DATA : GET_BUFFER_DONE;
-
-    if (DO_DEBUG) {
-        mp_printf(&mp_plat_print, "%s:%d result=%d\n", __FILE__, __LINE__, result);
-    }
-    if (INPUT_BUFFER_SPACE(self->inbuf) > 512) {
-        background_callback_add(
-            &self->inbuf_fill_cb,
-            mp3file_update_inbuf_cb,
-            self);
-    }
-
-    if (DO_DEBUG) {
-        mp_printf(&mp_plat_print, "post-decode avail=%d eof=%d\n", (int)INPUT_BUFFER_AVAILABLE(self->inbuf), self->eof);
-    }
+    mp3file_queue_inbuf_fill(self);
+    // Use the time until the next call to decode the frames after this one.
+    mp3file_queue_decode_ahead(self);
     return result;
 }
 
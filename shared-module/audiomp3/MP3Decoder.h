@@ -13,6 +13,13 @@
 
 #include "shared-module/audiocore/__init__.h"
 
+// Decoded frames kept by each MP3Decoder. Two hold the frame that is playing
+// and the one queued behind it; the others are decoded ahead of time in the
+// background so that slow reads don't starve the audio output.
+#ifndef CIRCUITPY_AUDIOMP3_FRAME_BUFFERS
+#define CIRCUITPY_AUDIOMP3_FRAME_BUFFERS (4)
+#endif
+
 typedef struct {
     uint8_t *buf;
     mp_int_t size;
@@ -24,13 +31,21 @@ typedef struct {
     audiosample_base_t base;
     struct _MP3DecInfo *decoder;
     background_callback_t inbuf_fill_cb;
+    background_callback_t decode_ahead_cb;
     mp3_input_buffer_t inbuf;
-    int16_t *pcm_buffer[2];
+    // pcm_buffer[0] and [1] may come from the user's buffer. Any others are
+    // always allocated separately.
+    int16_t *pcm_buffer[CIRCUITPY_AUDIOMP3_FRAME_BUFFERS];
+    // The result of decoding into each pcm_buffer, and whether it is empty.
+    uint8_t decoded_result[CIRCUITPY_AUDIOMP3_FRAME_BUFFERS];
+    bool decoded_empty[CIRCUITPY_AUDIOMP3_FRAME_BUFFERS];
     uint32_t len;
 
     mp_obj_t stream;
 
+    // The pcm_buffer returned last, and how many after it are already decoded.
     uint8_t buffer_index;
+    uint8_t frames_ahead;
     bool eof;
     bool block_ok;
     mp_obj_t settimeout_args[3];
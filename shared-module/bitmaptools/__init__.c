@@ -6,6 +6,7 @@
 
 #include "shared/runtime/interrupt_char.h"
 #include "shared-bindings/bitmaptools/__init__.h"
+#include "shared-module/bitmaptools/__init__.h"
 #include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/displayio/Palette.h"
 #include "shared-bindings/displayio/ColorConverter.h"
@@ -20,9 +21,56 @@
 #include <stdio.h>
 #include <string.h>
 
+MP_WEAK bool bitmaptools_port_fill_region(displayio_bitmap_t *destination,
+    int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint32_t value) {
+    return false;
+}
+
+MP_WEAK bool bitmaptools_port_blit(displayio_bitmap_t *destination, displayio_bitmap_t *source, int16_t x, int16_t y,
+    int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint32_t skip_source_index, bool skip_source_index_none, uint32_t skip_dest_index,
+    bool skip_dest_index_none) {
+    return false;
+}
+
+MP_WEAK bool bitmaptools_port_alphablend(displayio_bitmap_t *dest, displayio_bitmap_t *source1, displayio_bitmap_t *source2, displayio_colorspace_t colorspace, mp_float_t factor1, mp_float_t factor2,
+    bitmaptools_blendmode_t blendmode, uint32_t skip_source1_index, bool skip_source1_index_none, uint32_t skip_source2_index, bool skip_source2_index_none) {
+    return false;
+}
+
 #define BITMAP_DEBUG(...) (void)0
 // #define BITMAP_DEBUG(...) mp_printf(&mp_plat_print, __VA_ARGS__)
 
+// Narrows [*first, *last] to the steps k where lo <= f0 + k * df < hi.
+static void rotozoom_clip_span(int64_t f0, int64_t df, int64_t lo, int64_t hi, int32_t *first, int32_t *last) {
+    if (df == 0) {
+        if (f0 < lo || f0 >= hi) {
+            *last = *first - 1;
+        }
+        return;
+    }
+    // Solve for the steps where f crosses each bound, rounding towards the side that's inside.
+    int64_t a, b;
+    if (df > 0) {
+        // k >= (lo - f0) / df and k < (hi - f0) / df
+        a = lo - f0;
+        a = a > 0 ? (a + df - 1) / df : -(-a / df);
+        b = hi - f0;
+        b = b > 0 ? (b + df - 1) / df - 1 : -(-b / df) - 1;
+    } else {
+        // k > (hi - f0) / df and k <= (lo - f0) / df
+        a = f0 - hi;
+        a = a >= 0 ? a / -df + 1 : -((-a - 1) / -df);
+        b = f0 - lo;
+        b = b >= 0 ? b / -df : -((-b + -df - 1) / -df);
+    }
+    if (a > *first) {
+        *first = a > INT32_MAX ? INT32_MAX : (int32_t)a;
+    }
+    if (b < *last) {
+        *last = b < INT32_MIN ? INT32_MIN : (int32_t)b;
+    }
+}
+
 void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16_t oy,
     int16_t dest_clip0_x, int16_t dest_clip0_y,
     int16_t dest_clip1_x, int16_t dest_clip1_y,
@@ -180,27 +228,41 @@ void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16
     mp_float_t startu = px - (ox * dvCol + oy * duCol);
     mp_float_t startv = py - (ox * dvRow + oy * duRow);
 
-    mp_float_t rowu = startu + miny * duCol;
-    mp_float_t rowv = startv + miny * dvCol;
-
     displayio_area_t dirty_area = {minx, miny, maxx + 1, maxy + 1, NULL};
     displayio_bitmap_set_dirty_area(self, &dirty_area);
 
+    // Walk each row in 32.32 fixed point. The start of every row is computed afresh so that
+    // rounding errors don't build up down the bitmap, and the part of the row that lands inside
+    // the source clip is worked out up front so the loop doesn't need to test each pixel.
+    // Coordinates get a nudge of a few units in the last place so that ones meant to land
+    // exactly on a pixel edge, as happens with simple scales and angles, don't fall just short
+    // of it after rounding.
+    const mp_float_t one = MICROPY_FLOAT_CONST(4294967296.);
+    const int64_t nudge = 1 << 4;
+    const int64_t du = (int64_t)MICROPY_FLOAT_C_FUN(floor)(duRow * one + MICROPY_FLOAT_CONST(0.5));
+    const int64_t dv = (int64_t)MICROPY_FLOAT_C_FUN(floor)(dvRow * one + MICROPY_FLOAT_CONST(0.5));
+    const int64_t clip_u0 = (int64_t)source_clip0_x << 32, clip_u1 = (int64_t)source_clip1_x << 32;
+    const int64_t clip_v0 = (int64_t)source_clip0_y << 32, clip_v1 = (int64_t)source_clip1_y << 32;
+
     for (y = miny; y <= maxy; y++) {
-        mp_float_t u = rowu + minx * duRow;
-        mp_float_t v = rowv + minx * dvRow;
-        for (x = minx; x <= maxx; x++) {
-            if (u >= source_clip0_x && u < source_clip1_x && v >= source_clip0_y && v < source_clip1_y) {
-                uint32_t c = common_hal_displayio_bitmap_get_pixel(source, (int)u, (int)v);
-                if ((skip_index_none) || (c != skip_index)) {
-                    displayio_bitmap_write_pixel(self, x, y, c);
-                }
+        int64_t u = (int64_t)MICROPY_FLOAT_C_FUN(floor)((startu + y * duCol + minx * duRow) * one) + nudge;
+        int64_t v = (int64_t)MICROPY_FLOAT_C_FUN(floor)((startv + y * dvCol + minx * dvRow) * one) + nudge;
+        int32_t first = 0, last = maxx - minx;
+        rotozoom_clip_span(u, du, clip_u0, clip_u1, &first, &last);
+        rotozoom_clip_span(v, dv, clip_v0, clip_v1, &first, &last);
+        if (first > last) {
+            continue;
+        }
+        u += first * du;
+        v += first * dv;
+        for (x = minx + first; x <= minx + last; x++) {
+            uint32_t c = common_hal_displayio_bitmap_get_pixel(source, u >> 32, v >> 32);
+            if ((skip_index_none) || (c != skip_index)) {
+                displayio_bitmap_write_pixel(self, x, y, c);
             }
-            u += duRow;
-            v += dvRow;
+            u += du;
+            v += dv;
         }
-        rowu += duCol;
-        rowv += dvCol;
     }
 }
 
@@ -221,6 +283,10 @@ void common_hal_bitmaptools_fill_region(displayio_bitmap_t *destination,
     // update the dirty rectangle
     displayio_bitmap_set_dirty_area(destination, &area);
 
+    if (bitmaptools_port_fill_region(destination, area.x1, area.y1, area.x2, area.y2, value)) {
+        return;
+    }
+
     int16_t x, y;
     for (x = area.x1; x < area.x2; x++) {
         for (y = area.y1; y < area.y2; y++) {
@@ -558,6 +624,55 @@ void common_hal_bitmaptools_arrayblit(displayio_bitmap_t *self, void *data, int
     displayio_bitmap_set_dirty_area(self, &area);
 }
 
+// Swaps the bytes of each element in place, the same way for the row buffer and the bitmap.
+static void readinto_swap_bytes(void *data, size_t len, int element_size) {
+    switch (element_size) {
+        case 2: {
+            uint16_t *data16 = data;
+            for (size_t i = 0; i < len / sizeof(uint16_t); i++) {
+                data16[i] = __builtin_bswap16(data16[i]);
+            }
+            break;
+        }
+        case 4: {
+            uint32_t *data32 = data;
+            for (size_t i = 0; i < len / sizeof(uint32_t); i++) {
+                data32[i] = __builtin_bswap32(data32[i]);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+// When the file stores pixels the way the bitmap does, reads them straight into the bitmap,
+// all rows in one read when the file rows are the same size as the bitmap's.
+static void readinto_direct(displayio_bitmap_t *self, mp_obj_t *file, size_t rowsize, int element_size, bool swap_bytes, bool reverse_rows) {
+    if (self->read_only) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Read-only"));
+    }
+    size_t stride_bytes = self->stride * sizeof(uint32_t);
+    bool contiguous = !reverse_rows && rowsize == stride_bytes;
+    size_t chunk = contiguous ? rowsize * self->height : rowsize;
+    for (int y = 0; y < self->height; y += contiguous ? self->height : 1) {
+        const int y_draw = reverse_rows ? (self->height) - 1 - y : y;
+        uint8_t *dest = (uint8_t *)(self->data + y_draw * self->stride);
+
+        int error = 0;
+        mp_uint_t bytes_read = mp_stream_read_exactly(file, dest, chunk, &error);
+        if (error) {
+            mp_raise_OSError(error);
+        }
+        if (bytes_read != chunk) {
+            mp_raise_msg(&mp_type_EOFError, NULL);
+        }
+        if (swap_bytes) {
+            readinto_swap_bytes(dest, chunk, element_size);
+        }
+    }
+}
+
 void common_hal_bitmaptools_readinto(displayio_bitmap_t *self, mp_obj_t *file, int element_size, int bits_per_pixel, bool reverse_pixels_in_element, bool swap_bytes, bool reverse_rows) {
     uint32_t mask = (1 << common_hal_displayio_bitmap_get_bits_per_value(self)) - 1;
 
@@ -569,7 +684,15 @@ void common_hal_bitmaptools_readinto(displayio_bitmap_t *self, mp_obj_t *file, i
     size_t elements_per_row = (self->width * bits_per_pixel + element_size * 8 - 1) / (element_size * 8);
     size_t rowsize = element_size * elements_per_row;
     size_t rowsize_in_u32 = (rowsize + sizeof(uint32_t) - 1) / sizeof(uint32_t);
-    size_t rowsize_in_u16 = (rowsize + sizeof(uint16_t) - 1) / sizeof(uint16_t);
+
+    // Bitmaps pack pixels smaller than a byte from the most significant bit, so those only
+    // match when they are reversed in the file. Rows of elements up to 4 bytes always fit in
+    // the bitmap's stride.
+    if ((uint32_t)bits_per_pixel == common_hal_displayio_bitmap_get_bits_per_value(self) &&
+        (bits_per_pixel >= 8 || reverse_pixels_in_element)) {
+        readinto_direct(self, file, rowsize, element_size, swap_bytes, reverse_rows);
+        return;
+    }
 
     for (int y = 0; y < self->height; y++) {
         uint32_t rowdata32[rowsize_in_u32];
@@ -588,19 +711,7 @@ void common_hal_bitmaptools_readinto(displayio_bitmap_t *self, mp_obj_t *file, i
         }
 
         if (swap_bytes) {
-            switch (element_size) {
-                case 2:
-                    for (size_t i = 0; i < rowsize_in_u16; i++) {
-                        rowdata16[i] = __builtin_bswap16(rowdata16[i]);
-                    }
-                    break;
-                case 4:
-                    for (size_t i = 0; i < rowsize_in_u32; i++) {
-                        rowdata32[i] = __builtin_bswap32(rowdata32[i]);
-                    }
-                default:
-                    break;
-            }
+            readinto_swap_bytes(rowdata32, rowsize, element_size);
         }
 
         for (int x = 0; x < self->width; x++) {
@@ -846,6 +957,11 @@ void common_hal_bitmaptools_alphablend(displayio_bitmap_t *dest, displayio_bitma
     displayio_area_t a = {0, 0, dest->width, dest->height, NULL};
     displayio_bitmap_set_dirty_area(dest, &a);
 
+    if (bitmaptools_port_alphablend(dest, source1, source2, colorspace, factor1, factor2, blendmode,
+        skip_source1_index, skip_source1_index_none, skip_source2_index, skip_source2_index_none)) {
+        return;
+    }
+
     int ifactor1 = (int)(factor1 * 256);
     int ifactor2 = (int)(factor2 * 256);
     bool blend_source1, blend_source2;
@@ -1034,6 +1150,89 @@ void common_hal_bitmaptools_draw_circle(displayio_bitmap_t *destination,
     draw_circle(destination, x, y, radius, value);
 }
 
+// Copies whole rows at a time when both bitmaps store values the same way. Returns false when the
+// per pixel loop is needed.
+static bool _blit_rows(displayio_bitmap_t *destination, displayio_bitmap_t *source, int16_t x, int16_t y,
+    int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint32_t skip_source_index, bool skip_source_index_none) {
+    uint8_t bits_per_value = destination->bits_per_value;
+    if (source->bits_per_value != bits_per_value) {
+        return false;
+    }
+    // Clip to the destination.
+    if (x < 0) {
+        x1 -= x;
+        x = 0;
+    }
+    if (y < 0) {
+        y1 -= y;
+        y = 0;
+    }
+    if (x + (x2 - x1) > destination->width) {
+        x2 = x1 + destination->width - x;
+    }
+    if (y + (y2 - y1) > destination->height) {
+        y2 = y1 + destination->height - y;
+    }
+    if (x1 >= x2 || y1 >= y2) {
+        return true;
+    }
+    int16_t width = x2 - x1;
+    bool same = destination->data == source->data;
+    if (bits_per_value < 8) {
+        // Only spans that start on a byte in both bitmaps, and don't overlap, can be moved
+        // as bytes. The last, partial byte is done a pixel at a time.
+        uint8_t values_per_byte = 8 / bits_per_value;
+        if (same || !skip_source_index_none || x % values_per_byte != 0 || x1 % values_per_byte != 0) {
+            return false;
+        }
+        int16_t bytes = width / values_per_byte;
+        for (int16_t j = 0; j < y2 - y1; j++) {
+            uint8_t *src = (uint8_t *)(source->data + (y1 + j) * source->stride) + x1 / values_per_byte;
+            uint8_t *dst = (uint8_t *)(destination->data + (y + j) * destination->stride) + x / values_per_byte;
+            memcpy(dst, src, bytes);
+            for (int16_t i = bytes * values_per_byte; i < width; i++) {
+                displayio_bitmap_write_pixel(destination, x + i, y + j,
+                    common_hal_displayio_bitmap_get_pixel(source, x1 + i, y1 + j));
+            }
+        }
+        return true;
+    }
+    // Rows are walked bottom up when moving down within one bitmap, and pixels right to left
+    // when moving right, so nothing is read after it has been overwritten.
+    bool y_reverse = same && y > y1;
+    bool x_reverse = same && x > x1;
+    uint8_t bytes_per_value = bits_per_value / 8;
+    for (int16_t j = 0; j < y2 - y1; j++) {
+        int16_t row = y_reverse ? y2 - y1 - 1 - j : j;
+        uint8_t *src = (uint8_t *)(source->data + (y1 + row) * source->stride) + x1 * bytes_per_value;
+        uint8_t *dst = (uint8_t *)(destination->data + (y + row) * destination->stride) + x * bytes_per_value;
+        if (skip_source_index_none) {
+            memmove(dst, src, width * bytes_per_value);
+            continue;
+        }
+        for (int16_t k = 0; k < width; k++) {
+            int16_t i = x_reverse ? width - 1 - k : k;
+            if (bytes_per_value == 1) {
+                uint8_t value = src[i];
+                if (value != skip_source_index) {
+                    dst[i] = value;
+                }
+            } else if (bytes_per_value == 2) {
+                uint16_t value = ((uint16_t *)src)[i];
+                if (value != skip_source_index) {
+                    ((uint16_t *)dst)[i] = value;
+                }
+            } else {
+                uint32_t value = ((uint32_t *)src)[i];
+                if (value != skip_source_index) {
+                    ((uint32_t *)dst)[i] = value;
+                }
+            }
+        }
+    }
+    return true;
+}
+
 void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitmap_t *source, int16_t x, int16_t y,
     int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint32_t skip_source_index, bool skip_source_index_none, uint32_t skip_dest_index,
     bool skip_dest_index_none) {
@@ -1059,6 +1258,15 @@ void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitm
     displayio_area_t a = { x, y, dirty_x_max, dirty_y_max, NULL};
     displayio_bitmap_set_dirty_area(destination, &a);
 
+    if (bitmaptools_port_blit(destination, source, x, y, x1, y1, x2, y2,
+        skip_source_index, skip_source_index_none, skip_dest_index, skip_dest_index_none)) {
+        return;
+    }
+
+    if (skip_dest_index_none && _blit_rows(destination, source, x, y, x1, y1, x2, y2, skip_source_index, skip_source_index_none)) {
+        return;
+    }
+
     bool x_reverse = false;
     bool y_reverse = false;
 
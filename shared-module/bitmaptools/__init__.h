@@ -0,0 +1,22 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-bindings/bitmaptools/__init__.h"
+
+// Ports with a 2D engine can override these to do the work in hardware. Each is called after
+// the argument checks and the dirty area update, and returns false to fall back to the C
+// loops. Hardware that can't handle a particular depth or skip index should return false for
+// it rather than approximate. The blit region is in source coordinates and may extend past the
+// destination, which must be clipped.
+bool bitmaptools_port_fill_region(displayio_bitmap_t *destination,
+    int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint32_t value);
+bool bitmaptools_port_blit(displayio_bitmap_t *destination, displayio_bitmap_t *source, int16_t x, int16_t y,
+    int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint32_t skip_source_index, bool skip_source_index_none, uint32_t skip_dest_index,
+    bool skip_dest_index_none);
+bool bitmaptools_port_alphablend(displayio_bitmap_t *dest, displayio_bitmap_t *source1, displayio_bitmap_t *source2, displayio_colorspace_t colorspace, mp_float_t factor1, mp_float_t factor2,
+    bitmaptools_blendmode_t blendmode, uint32_t skip_source1_index, bool skip_source1_index_none, uint32_t skip_source2_index, bool skip_source2_index_none);
@@ -141,3 +141,30 @@ void common_hal_bitops_bit_transpose(uint8_t *result, const uint8_t *src, size_t
         bit_transpose_var((uint32_t *)(void *)result, src, inlen / num_strands, inlen / num_strands, num_strands);
     }
 }
+
+// Each group of 8 consecutive elements contributes one byte to every plane.
+// Byte k of the elements (most significant first) is transposed by the same
+// 8x8 kernel as bit_transpose, giving planes 8*k .. 8*k+7. The kernel is fed
+// the elements in reverse so that the first element lands in the most
+// significant bit of each plane byte.
+void common_hal_bitops_bit_planes(uint8_t *result, const uint8_t *src, size_t count, size_t element_size, size_t plane_stride) {
+    int src_stride = -(int)element_size;
+    for (size_t i = 0; i < count / 8; i++) {
+        const uint8_t *last = src + 7 * element_size;
+        for (size_t k = 0; k < element_size; k++) {
+            #if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            size_t offset = element_size - 1 - k;
+            #else
+            size_t offset = k;
+            #endif
+            uint32_t planes[2];
+            transpose_8(planes, last + offset, src_stride);
+            const uint8_t *plane_bytes = (const uint8_t *)planes;
+            uint8_t *out = result + 8 * k * plane_stride + i;
+            for (size_t j = 0; j < 8; j++) {
+                out[j * plane_stride] = plane_bytes[j];
+            }
+        }
+        src += 8 * element_size;
+    }
+}
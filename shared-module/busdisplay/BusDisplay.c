@@ -213,6 +213,15 @@ static void _send_pixels(busdisplay_busdisplay_obj_t *self, uint8_t *pixels, uin
     self->bus.send(self->bus.bus, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED, pixels, length);
 }
 
+#if CIRCUITPY_BUSDISPLAY_DOUBLE_BUFFER
+static void _send_pixels_async(busdisplay_busdisplay_obj_t *self, uint8_t *pixels, uint32_t length) {
+    if (!self->bus.data_as_commands) {
+        self->bus.send(self->bus.bus, DISPLAY_COMMAND, CHIP_SELECT_TOGGLE_EVERY_BYTE, &self->write_ram_command, 1);
+    }
+    self->bus.send_async(self->bus.bus, pixels, length);
+}
+#endif
+
 static bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_area_t *area) {
     uint16_t buffer_size = 128; // In uint32_ts
 
@@ -254,9 +263,17 @@ static bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_are
         }
     }
 
+    #if CIRCUITPY_BUSDISPLAY_DOUBLE_BUFFER
+    // When the bus can send in the background, render each subrectangle into one buffer while
+    // the previous one is still going out of the other. The bus stays locked while rendering.
+    bool double_buffer = self->bus.send_async != NULL && subrectangles > 1;
+    bool sending = false;
+    #else
+    bool double_buffer = false;
+    #endif
     // Allocated and shared as a uint32_t array so the compiler knows the
     // alignment everywhere.
-    uint32_t buffer[buffer_size];
+    uint32_t buffers[double_buffer ? 2 : 1][buffer_size];
     uint32_t mask_length = (pixels_per_buffer / 32) + 1;
     uint32_t mask[mask_length];
     uint16_t remaining_rows = displayio_area_height(&clipped);
@@ -273,8 +290,6 @@ static bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_are
         }
         remaining_rows -= rows_per_buffer;
 
-        displayio_display_bus_set_region_to_update(&self->bus, &self->core, &subrectangle);
-
         uint16_t subrectangle_size_bytes;
         if (self->core.colorspace.depth >= 8) {
             subrectangle_size_bytes = displayio_area_size(&subrectangle) * (self->core.colorspace.depth / 8);
@@ -282,19 +297,38 @@ static bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_are
             subrectangle_size_bytes = displayio_area_size(&subrectangle) / (8 / self->core.colorspace.depth);
         }
 
+        uint32_t *buffer = buffers[double_buffer ? j % 2 : 0];
         memset(mask, 0, mask_length * sizeof(mask[0]));
         memset(buffer, 0, buffer_size * sizeof(buffer[0]));
 
         displayio_display_core_fill_area(&self->core, &subrectangle, mask, buffer);
 
+        #if CIRCUITPY_BUSDISPLAY_DOUBLE_BUFFER
+        if (sending) {
+            self->bus.wait_for_send(self->bus.bus);
+            displayio_display_bus_end_transaction(&self->bus);
+            sending = false;
+        }
+        #endif
+
+        displayio_display_bus_set_region_to_update(&self->bus, &self->core, &subrectangle);
+
         // Can't acquire display bus; skip the rest of the data.
         if (!displayio_display_bus_is_free(&self->bus)) {
             return false;
         }
 
         displayio_display_bus_begin_transaction(&self->bus);
-        _send_pixels(self, (uint8_t *)buffer, subrectangle_size_bytes);
-        displayio_display_bus_end_transaction(&self->bus);
+        #if CIRCUITPY_BUSDISPLAY_DOUBLE_BUFFER
+        if (double_buffer) {
+            _send_pixels_async(self, (uint8_t *)buffer, subrectangle_size_bytes);
+            sending = true;
+        } else
+        #endif
+        {
+            _send_pixels(self, (uint8_t *)buffer, subrectangle_size_bytes);
+            displayio_display_bus_end_transaction(&self->bus);
+        }
 
         // TODO(tannewt): Make refresh displays faster so we don't starve other
         // background tasks.
@@ -302,6 +336,12 @@ static bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_are
         usb_background();
         #endif
     }
+    #if CIRCUITPY_BUSDISPLAY_DOUBLE_BUFFER
+    if (sending) {
+        self->bus.wait_for_send(self->bus.bus);
+        displayio_display_bus_end_transaction(&self->bus);
+    }
+    #endif
     return true;
 }
 
@@ -312,10 +352,21 @@ static void _refresh_display(busdisplay_busdisplay_obj_t *self) {
     }
     displayio_display_core_start_refresh(&self->core);
     const displayio_area_t *current_area = _get_refresh_areas(self);
+    // Each area costs a window setup on the bus so merge nearby ones first. Extra pixels are
+    // weighed against the setup bytes.
+    displayio_area_t areas[CIRCUITPY_DISPLAY_AREA_MERGE_LIMIT];
+    uint8_t area_count = 0;
+    uint32_t merge_cost = CIRCUITPY_DISPLAY_AREA_MERGE_BYTES * 8 / self->core.colorspace.depth;
     while (current_area != NULL) {
-        _refresh_area(self, current_area);
+        displayio_area_t clipped;
+        if (displayio_display_core_clip_area(&self->core, current_area, &clipped)) {
+            area_count = displayio_area_coalesce(areas, area_count, CIRCUITPY_DISPLAY_AREA_MERGE_LIMIT, &clipped, merge_cost);
+        }
         current_area = current_area->next;
     }
+    for (uint8_t i = 0; i < area_count; i++) {
+        _refresh_area(self, &areas[i]);
+    }
     displayio_display_core_finish_refresh(&self->core);
 }
 
@@ -376,9 +427,9 @@ void common_hal_busdisplay_busdisplay_set_auto_refresh(busdisplay_busdisplay_obj
     self->first_manual_refresh = !auto_refresh;
     if (auto_refresh != self->auto_refresh) {
         if (auto_refresh) {
-            supervisor_enable_tick();
+            supervisor_enable_tickless();
         } else {
-            supervisor_disable_tick();
+            supervisor_disable_tickless();
         }
     }
     self->auto_refresh = auto_refresh;
@@ -31,7 +31,7 @@ void common_hal_displayio_bitmap_construct_from_buffer(displayio_bitmap_t *self,
     self->stride = stride(width, bits_per_value);
     self->data_alloc = false;
     if (!data) {
-        data = m_malloc(self->stride * height * sizeof(uint32_t));
+        data = m_malloc_bulk(self->stride * height * sizeof(uint32_t));
         self->data_alloc = true;
     }
     self->data = data;
@@ -119,6 +119,9 @@ void displayio_bitmap_set_dirty_area(displayio_bitmap_t *self, const displayio_a
     displayio_area_union(&area, &self->dirty_area, &area);
     displayio_area_t bitmap_area = {0, 0, self->width, self->height, NULL};
     displayio_area_compute_overlap(&area, &bitmap_area, &self->dirty_area);
+    #if CIRCUITPY_DISPLAYIO_TILE_CACHE
+    self->version++;
+    #endif
 }
 
 void displayio_bitmap_write_pixel(displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t value) {
@@ -25,6 +25,9 @@ typedef struct {
     uint16_t bitmask;
     bool read_only;
     bool data_alloc; // did bitmap allocate data or someone else
+    #if CIRCUITPY_DISPLAYIO_TILE_CACHE
+    uint32_t version; // Bumped on every change so cached copies of pixels can be checked.
+    #endif
 } displayio_bitmap_t;
 
 void displayio_bitmap_finish_refresh(displayio_bitmap_t *self);
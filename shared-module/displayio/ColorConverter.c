@@ -11,15 +11,18 @@
 
 #define NO_TRANSPARENT_COLOR (0x1000000)
 
-uint32_t displayio_colorconverter_dither_noise_1(uint32_t n) {
-    n = (n >> 13) ^ n;
-    int nn = (n * (n * n * 60493 + 19990303) + 1376312589) & 0x7fffffff;
-    return (uint32_t)(((float)nn / (1073741824.0f * 2)) * 255);
-}
-
-uint32_t displayio_colorconverter_dither_noise_2(uint32_t x, uint32_t y) {
-    return displayio_colorconverter_dither_noise_1(x + y * 0xFFFF);
-}
+// 8x8 ordered dither thresholds, spread over 0-252 in steps of 4. Shifting one right by
+// the number of bits a channel keeps gives an offset up to the largest value it drops.
+static const uint8_t dither_matrix[8][8] = {
+    {   0, 128,  32, 160,   8, 136,  40, 168 },
+    { 192,  64, 224,  96, 200,  72, 232, 104 },
+    {  48, 176,  16, 144,  56, 184,  24, 152 },
+    { 240, 112, 208,  80, 248, 120, 216,  88 },
+    {  12, 140,  44, 172,   4, 132,  36, 164 },
+    { 204,  76, 236, 108, 196,  68, 228, 100 },
+    {  60, 188,  28, 156,  52, 180,  20, 148 },
+    { 252, 124, 220,  92, 244, 116, 212,  84 },
+};
 
 void common_hal_displayio_colorconverter_construct(displayio_colorconverter_t *self, bool dither, displayio_colorspace_t input_colorspace) {
     self->dither = dither;
@@ -53,7 +56,9 @@ uint8_t displayio_colorconverter_compute_luma(uint32_t color_rgb888) {
     uint32_t r8 = (color_rgb888 >> 16);
     uint32_t g8 = (color_rgb888 >> 8) & 0xff;
     uint32_t b8 = color_rgb888 & 0xff;
-    return (r8 * 19 + g8 * 182 + b8 * 54) / 255;
+    // Dividing by 255 this way is exact for sums up to 255 * 255 and avoids a division call on
+    // chips without a hardware divider.
+    return ((r8 * 19 + g8 * 182 + b8 * 54) * 0x8081) >> 23;
 }
 
 uint8_t displayio_colorconverter_compute_chroma(uint32_t color_rgb888) {
@@ -249,23 +254,21 @@ uint32_t displayio_colorconverter_convert_pixel(displayio_colorspace_t colorspac
 void displayio_convert_color(const _displayio_colorspace_t *colorspace, bool dither, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
     uint32_t pixel = input_pixel->pixel;
     if (dither) {
-        uint8_t randr = (displayio_colorconverter_dither_noise_2(input_pixel->tile_x, input_pixel->tile_y));
-        uint8_t randg = (displayio_colorconverter_dither_noise_2(input_pixel->tile_x + 33, input_pixel->tile_y));
-        uint8_t randb = (displayio_colorconverter_dither_noise_2(input_pixel->tile_x, input_pixel->tile_y + 33));
+        uint8_t threshold = dither_matrix[input_pixel->tile_y & 0x7][input_pixel->tile_x & 0x7];
 
         uint32_t r8 = (pixel >> 16);
         uint32_t g8 = (pixel >> 8) & 0xff;
         uint32_t b8 = pixel & 0xff;
 
         if (colorspace->depth == 16) {
-            b8 = MIN(255, b8 + (randb & 0x07));
-            r8 = MIN(255, r8 + (randr & 0x07));
-            g8 = MIN(255, g8 + (randg & 0x03));
+            b8 = MIN(255, b8 + (threshold >> 5));
+            r8 = MIN(255, r8 + (threshold >> 5));
+            g8 = MIN(255, g8 + (threshold >> 6));
         } else {
-            int bitmask = 0xFF >> colorspace->depth;
-            b8 = MIN(255, b8 + (randb & bitmask));
-            r8 = MIN(255, r8 + (randr & bitmask));
-            g8 = MIN(255, g8 + (randg & bitmask));
+            uint8_t offset = colorspace->depth < 8 ? threshold >> colorspace->depth : 0;
+            b8 = MIN(255, b8 + offset);
+            r8 = MIN(255, r8 + offset);
+            g8 = MIN(255, g8 + offset);
         }
         pixel = r8 << 16 | g8 << 8 | b8;
     }
@@ -364,9 +364,15 @@ void displayio_group_construct(displayio_group_t *self, mp_obj_list_t *members,
     self->scale = scale;
     self->in_group = false;
     self->readonly = false;
+    self->bounds_valid = false;
 }
 
 bool displayio_group_fill_area(displayio_group_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
+    // Skip the whole subtree when none of it is in the area.
+    displayio_area_t overlap;
+    if (self->bounds_valid && !displayio_area_compute_overlap(area, &self->bounds, &overlap)) {
+        return false;
+    }
     // Track if any of the layers finishes filling in the given area. We can ignore any remaining
     // layers at that point.
     if (self->hidden == false) {
@@ -405,6 +411,8 @@ bool displayio_group_fill_area(displayio_group_t *self, const _displayio_colorsp
 
 void displayio_group_finish_refresh(displayio_group_t *self) {
     self->item_removed = false;
+    // Layers may change before the next refresh.
+    self->bounds_valid = false;
     for (int32_t i = self->members->len - 1; i >= 0; i--) {
         mp_obj_t layer;
         #if CIRCUITPY_VECTORIO
@@ -436,6 +444,11 @@ displayio_area_t *displayio_group_get_refresh_areas(displayio_group_t *self, dis
         tail = &self->dirty_area;
     }
 
+    // Collect the bounds of every visible layer along the way so that fill_area can skip this
+    // group for parts of the screen it doesn't touch. They stay valid until finish_refresh.
+    bool bounded = true;
+    self->bounds.x1 = 0;
+    self->bounds.x2 = 0;
     for (int32_t i = self->members->len - 1; i >= 0; i--) {
         mp_obj_t layer;
         #if CIRCUITPY_VECTORIO
@@ -443,6 +456,8 @@ displayio_area_t *displayio_group_get_refresh_areas(displayio_group_t *self, dis
         if (draw_protocol != NULL) {
             layer = draw_protocol->draw_get_protocol_self(self->members->items[i]);
             tail = draw_protocol->draw_protocol_impl->draw_get_refresh_areas(layer, tail);
+            // Vector shapes don't expose where they are.
+            bounded = false;
             continue;
         }
         #endif
@@ -452,15 +467,28 @@ displayio_area_t *displayio_group_get_refresh_areas(displayio_group_t *self, dis
             if (!displayio_tilegrid_get_rendered_hidden(layer)) {
                 tail = displayio_tilegrid_get_refresh_areas(layer, tail);
             }
+            displayio_tilegrid_t *tilegrid = layer;
+            if (!tilegrid->hidden && !tilegrid->hidden_by_parent) {
+                displayio_area_union(&self->bounds, &tilegrid->current_area, &self->bounds);
+            }
             continue;
         }
         layer = mp_obj_cast_to_native_base(
             self->members->items[i], &displayio_group_type);
         if (layer != MP_OBJ_NULL) {
             tail = displayio_group_get_refresh_areas(layer, tail);
+            displayio_group_t *group = layer;
+            if (!group->bounds_valid) {
+                bounded = false;
+            } else if (!group->hidden) {
+                displayio_area_union(&self->bounds, &group->bounds, &self->bounds);
+            }
             continue;
         }
+        // Anything else gets drawn nowhere, but play it safe.
+        bounded = false;
     }
+    self->bounds_valid = bounded;
 
     return tail;
 }
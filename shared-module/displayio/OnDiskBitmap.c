@@ -21,6 +21,9 @@
 // #define DISPLAYIO_ODBMP_DEBUG(...) mp_printf(&mp_plat_print __VA_OPT__(,) __VA_ARGS__)
 
 
+// Reads are aligned to this so that FatFS reads whole sectors straight into the cache.
+#define CACHE_ALIGNMENT (512)
+
 static uint32_t read_word(uint16_t *bmp_header, uint16_t index) {
     return bmp_header[index] | bmp_header[index + 1] << 16;
 }
@@ -158,7 +161,47 @@ void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self,
         self->stride = (bit_stride / 8);
     }
 
+    self->cache = NULL;
+    self->cache_len = 0;
+    self->cache_row = self->height;
+    #if CIRCUITPY_ONDISKBITMAP_CACHE_ROWS > 0
+    // The extra sector leaves room to align the start of each read.
+    uint32_t cache_size = self->stride * CIRCUITPY_ONDISKBITMAP_CACHE_ROWS;
+    cache_size = (cache_size + CACHE_ALIGNMENT - 1) / CACHE_ALIGNMENT * CACHE_ALIGNMENT + CACHE_ALIGNMENT;
+    // Carry on reading pixel by pixel if there isn't room.
+    self->cache = m_malloc_maybe(cache_size);
+    if (self->cache != NULL) {
+        self->cache_size = cache_size;
+    }
+    #endif
+}
+
+#if CIRCUITPY_ONDISKBITMAP_CACHE_ROWS > 0
+// Loads the cache so that it holds the pixel at location. Refresh usually goes from the top of
+// the image down, which is from the end of the file backwards, so the cache then ends at the
+// pixel's row. Otherwise it starts at the pixel.
+static bool load_cache(displayio_ondiskbitmap_t *self, uint32_t location, uint16_t row) {
+    uint32_t start = location;
+    if (row < self->cache_row) {
+        uint32_t row_end = self->data_offset + (row + 1) * self->stride;
+        uint32_t window = self->cache_size - CACHE_ALIGNMENT;
+        start = row_end > window ? row_end - window : 0;
+    }
+    start -= start % CACHE_ALIGNMENT;
+    self->cache_row = row;
+    self->cache_len = 0;
+    if (f_lseek(&self->file->fp, start) != FR_OK) {
+        return false;
+    }
+    UINT bytes_read;
+    if (f_read(&self->file->fp, self->cache, self->cache_size, &bytes_read) != FR_OK) {
+        return false;
+    }
+    self->cache_offset = start;
+    self->cache_len = bytes_read;
+    return true;
 }
+#endif
 
 
 uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *self,
@@ -175,11 +218,24 @@ uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *s
     } else {
         location = self->data_offset + (self->height - y - 1) * self->stride + x / pixels_per_byte;
     }
-    // We don't cache here because the underlying FS caches sectors.
-    f_lseek(&self->file->fp, location);
-    UINT bytes_read;
     uint32_t pixel_data = 0;
-    uint32_t result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
+    uint32_t result = FR_OK;
+    #if CIRCUITPY_ONDISKBITMAP_CACHE_ROWS > 0
+    if (self->cache != NULL) {
+        if (location < self->cache_offset || location + bytes_per_pixel > self->cache_offset + self->cache_len) {
+            if (!load_cache(self, location, self->height - y - 1) ||
+                location + bytes_per_pixel > self->cache_offset + self->cache_len) {
+                return 0;
+            }
+        }
+        memcpy(&pixel_data, self->cache + (location - self->cache_offset), bytes_per_pixel);
+    } else
+    #endif
+    {
+        f_lseek(&self->file->fp, location);
+        UINT bytes_read;
+        result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
+    }
     if (result == FR_OK) {
         uint32_t tmp = 0;
         uint8_t red;
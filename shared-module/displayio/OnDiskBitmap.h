@@ -23,6 +23,13 @@ typedef struct {
     uint32_t g_bitmask;
     uint32_t b_bitmask;
     pyb_file_obj_t *file;
+    // Bytes of the file starting at cache_offset, read a few rows at a time.
+    uint8_t *cache;
+    uint32_t cache_offset;
+    uint32_t cache_size;
+    uint32_t cache_len;
+    // File row the cache was last loaded for, to tell which way refresh is going.
+    uint16_t cache_row;
     union {
         mp_obj_base_t *pixel_shader_base;
         struct displayio_palette *palette;
@@ -8,14 +8,21 @@
 
 #include "shared-module/displayio/ColorConverter.h"
 
+static void palette_changed(displayio_palette_t *self) {
+    self->needs_refresh = true;
+    self->version++;
+}
+
 void common_hal_displayio_palette_construct(displayio_palette_t *self, uint16_t color_count, bool dither) {
     self->color_count = color_count;
     self->colors = (_displayio_color_t *)m_malloc(color_count * sizeof(_displayio_color_t));
     self->dither = dither;
+    self->prepared_colorspace = NULL;
 }
 
 void common_hal_displayio_palette_set_dither(displayio_palette_t *self, bool dither) {
     self->dither = dither;
+    self->version++;
 }
 
 bool common_hal_displayio_palette_get_dither(displayio_palette_t *self) {
@@ -24,12 +31,12 @@ bool common_hal_displayio_palette_get_dither(displayio_palette_t *self) {
 
 void common_hal_displayio_palette_make_opaque(displayio_palette_t *self, uint32_t palette_index) {
     self->colors[palette_index].transparent = false;
-    self->needs_refresh = true;
+    palette_changed(self);
 }
 
 void common_hal_displayio_palette_make_transparent(displayio_palette_t *self, uint32_t palette_index) {
     self->colors[palette_index].transparent = true;
-    self->needs_refresh = true;
+    palette_changed(self);
 }
 
 bool common_hal_displayio_palette_is_transparent(displayio_palette_t *self, uint32_t palette_index) {
@@ -46,7 +53,7 @@ void common_hal_displayio_palette_set_color(displayio_palette_t *self, uint32_t
     }
     self->colors[palette_index].rgb888 = color;
     self->colors[palette_index].cached_colorspace = NULL;
-    self->needs_refresh = true;
+    palette_changed(self);
 }
 
 uint32_t common_hal_displayio_palette_get_color(displayio_palette_t *self, uint32_t palette_index) {
@@ -55,7 +62,7 @@ uint32_t common_hal_displayio_palette_get_color(displayio_palette_t *self, uint3
 
 void displayio_palette_get_color(displayio_palette_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
     uint32_t palette_index = input_pixel->pixel;
-    if (palette_index > self->color_count || self->colors[palette_index].transparent) {
+    if (palette_index >= self->color_count || self->colors[palette_index].transparent) {
         output_color->opaque = false;
         return;
     }
@@ -83,6 +90,30 @@ void displayio_palette_get_color(displayio_palette_t *self, const _displayio_col
     }
 }
 
+bool displayio_palette_prepare_colors(displayio_palette_t *self, const _displayio_colorspace_t *colorspace) {
+    if (self->dither) {
+        return false;
+    }
+    // Check the grayscale settings because EPaperDisplay will change them on the same object.
+    if (self->prepared_colorspace == colorspace &&
+        self->prepared_version == self->version &&
+        self->prepared_grayscale_bit == colorspace->grayscale_bit &&
+        self->prepared_grayscale == colorspace->grayscale) {
+        return true;
+    }
+    displayio_input_pixel_t input_pixel = { 0 };
+    displayio_output_pixel_t output_pixel;
+    for (uint32_t i = 0; i < self->color_count; i++) {
+        input_pixel.pixel = i;
+        displayio_palette_get_color(self, colorspace, &input_pixel, &output_pixel);
+    }
+    self->prepared_colorspace = colorspace;
+    self->prepared_version = self->version;
+    self->prepared_grayscale_bit = colorspace->grayscale_bit;
+    self->prepared_grayscale = colorspace->grayscale;
+    return true;
+}
+
 bool displayio_palette_needs_refresh(displayio_palette_t *self) {
     return self->needs_refresh;
 }
@@ -53,12 +53,22 @@ typedef struct displayio_palette {
     mp_obj_base_t base;
     _displayio_color_t *colors;
     uint32_t color_count;
+    uint32_t version; // Bumped on every change so cached shaded pixels can be checked.
+    // The colorspace and version that every color's cached_color was last converted for.
+    const _displayio_colorspace_t *prepared_colorspace;
+    uint32_t prepared_version;
+    uint8_t prepared_grayscale_bit;
+    bool prepared_grayscale;
     bool needs_refresh;
     bool dither;
 } displayio_palette_t;
 
 
 void displayio_palette_get_color(displayio_palette_t *palette, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color);
+// Converts every color for colorspace once, so that a fill can read each color's cached_color
+// directly until the palette changes. Returns false when dithering, because then each pixel
+// converts differently.
+bool displayio_palette_prepare_colors(displayio_palette_t *self, const _displayio_colorspace_t *colorspace);
 ;
 bool displayio_palette_needs_refresh(displayio_palette_t *self);
 void displayio_palette_finish_refresh(displayio_palette_t *self);
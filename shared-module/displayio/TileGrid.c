@@ -6,6 +6,8 @@
 
 #include "shared-bindings/displayio/TileGrid.h"
 
+#include <string.h>
+
 #include "py/runtime.h"
 #include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/displayio/ColorConverter.h"
@@ -70,6 +72,17 @@ void common_hal_displayio_tilegrid_construct(displayio_tilegrid_t *self, mp_obj_
     self->pixel_height = height * tile_height;
     self->tile_width = tile_width;
     self->tile_height = tile_height;
+    #if CIRCUITPY_DISPLAYIO_TILE_CACHE
+    self->dirty_rows = NULL;
+    if (height > 1) {
+        self->dirty_rows = m_new(displayio_area_t, height);
+        for (uint16_t i = 0; i < height; i++) {
+            self->dirty_rows[i].x1 = 0;
+            self->dirty_rows[i].x2 = 0;
+        }
+    }
+    self->tile_cache = NULL;
+    #endif
     self->bitmap = bitmap;
     self->pixel_shader = pixel_shader;
     self->in_group = false;
@@ -228,9 +241,61 @@ mp_obj_t common_hal_displayio_tilegrid_get_pixel_shader(displayio_tilegrid_t *se
     return self->pixel_shader;
 }
 
+#if CIRCUITPY_DISPLAYIO_TILE_CACHE
+static size_t _tile_cache_size(displayio_tilegrid_t *self) {
+    uint32_t pixels_per_tile = self->tile_width * self->tile_height;
+    uint32_t opaque_words_per_tile = (pixels_per_tile + 31) / 32;
+    return sizeof(displayio_tilegrid_tile_cache_t) + self->tiles_in_bitmap *
+           (sizeof(displayio_tilegrid_cached_tile_t) + (opaque_words_per_tile + pixels_per_tile) * sizeof(uint32_t));
+}
+
+static void _tile_cache_invalidate(displayio_tilegrid_tile_cache_t *cache) {
+    if (cache == NULL) {
+        return;
+    }
+    for (uint16_t i = 0; i < cache->tile_count; i++) {
+        cache->tiles[i].valid = false;
+    }
+}
+
+bool common_hal_displayio_tilegrid_get_tile_cache(displayio_tilegrid_t *self) {
+    return self->tile_cache != NULL;
+}
+
+void common_hal_displayio_tilegrid_set_tile_cache(displayio_tilegrid_t *self, bool tile_cache) {
+    if (!tile_cache) {
+        if (self->tile_cache != NULL) {
+            #if MICROPY_MALLOC_USES_ALLOCATED_SIZE
+            m_free(self->tile_cache, _tile_cache_size(self));
+            #else
+            m_free(self->tile_cache);
+            #endif
+            self->tile_cache = NULL;
+        }
+        return;
+    }
+    if (self->tile_cache != NULL) {
+        return;
+    }
+    displayio_tilegrid_tile_cache_t *cache = m_malloc(_tile_cache_size(self));
+    cache->colorspace = NULL;
+    cache->tile_count = self->tiles_in_bitmap;
+    cache->pixels_per_tile = self->tile_width * self->tile_height;
+    cache->opaque_words_per_tile = (cache->pixels_per_tile + 31) / 32;
+    cache->tiles = (displayio_tilegrid_cached_tile_t *)(cache + 1);
+    cache->opaque = (uint32_t *)(cache->tiles + cache->tile_count);
+    cache->pixels = cache->opaque + cache->tile_count * cache->opaque_words_per_tile;
+    _tile_cache_invalidate(cache);
+    self->tile_cache = cache;
+}
+#endif
+
 void common_hal_displayio_tilegrid_set_pixel_shader(displayio_tilegrid_t *self, mp_obj_t pixel_shader) {
     self->pixel_shader = pixel_shader;
     self->full_change = true;
+    #if CIRCUITPY_DISPLAYIO_TILE_CACHE
+    _tile_cache_invalidate(self->tile_cache);
+    #endif
 }
 
 mp_obj_t common_hal_displayio_tilegrid_get_bitmap(displayio_tilegrid_t *self) {
@@ -240,6 +305,9 @@ mp_obj_t common_hal_displayio_tilegrid_get_bitmap(displayio_tilegrid_t *self) {
 void common_hal_displayio_tilegrid_set_bitmap(displayio_tilegrid_t *self, mp_obj_t bitmap) {
     self->bitmap = bitmap;
     self->full_change = true;
+    #if CIRCUITPY_DISPLAYIO_TILE_CACHE
+    _tile_cache_invalidate(self->tile_cache);
+    #endif
 }
 
 uint16_t common_hal_displayio_tilegrid_get_width(displayio_tilegrid_t *self) {
@@ -275,6 +343,42 @@ uint16_t common_hal_displayio_tilegrid_get_tile(displayio_tilegrid_t *self, uint
     }
 }
 
+// Marks count tiles starting at x, y and moving right as changed. They must not wrap around
+// the right edge on screen.
+static void _mark_tiles_dirty(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint16_t count) {
+    displayio_area_t temp_area;
+    displayio_area_t *tile_area;
+    if (!self->partial_change) {
+        tile_area = &self->dirty_area;
+    } else {
+        tile_area = &temp_area;
+    }
+    int16_t tx = (x - self->top_left_x) % self->width_in_tiles;
+    if (tx < 0) {
+        tx += self->width_in_tiles;
+    }
+    tile_area->x1 = tx * self->tile_width;
+    tile_area->x2 = tile_area->x1 + count * self->tile_width;
+    int16_t ty = (y - self->top_left_y) % self->height_in_tiles;
+    if (ty < 0) {
+        ty += self->height_in_tiles;
+    }
+    tile_area->y1 = ty * self->tile_height;
+    tile_area->y2 = tile_area->y1 + self->tile_height;
+
+    if (self->partial_change) {
+        displayio_area_union(&self->dirty_area, &temp_area, &self->dirty_area);
+    }
+
+    #if CIRCUITPY_DISPLAYIO_TILE_CACHE
+    if (self->dirty_rows != NULL) {
+        displayio_area_union(&self->dirty_rows[ty], tile_area, &self->dirty_rows[ty]);
+    }
+    #endif
+
+    self->partial_change = true;
+}
+
 void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint16_t tile_index) {
     if (tile_index >= self->tiles_in_bitmap) {
         mp_raise_ValueError(MP_ERROR_TEXT("Tile index out of bounds"));
@@ -294,31 +398,43 @@ void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t
     } else {
         ((uint8_t *)tiles)[index] = (uint8_t)tile_index;
     }
-    displayio_area_t temp_area;
-    displayio_area_t *tile_area;
-    if (!self->partial_change) {
-        tile_area = &self->dirty_area;
+    _mark_tiles_dirty(self, x, y, 1);
+}
+
+void common_hal_displayio_tilegrid_set_tiles(displayio_tilegrid_t *self, uint16_t x, uint16_t y, const uint16_t *tile_indices, uint16_t count) {
+    for (uint16_t i = 0; i < count; i++) {
+        if (tile_indices[i] >= self->tiles_in_bitmap) {
+            mp_raise_ValueError(MP_ERROR_TEXT("Tile index out of bounds"));
+        }
+    }
+
+    void *tiles = self->tiles;
+    if (self->inline_tiles) {
+        tiles = &self->tiles;
+    }
+    if (tiles == NULL || count == 0) {
+        return;
+    }
+
+    uint32_t index = y * self->width_in_tiles + x;
+    if (self->tiles_in_bitmap > 255) {
+        memcpy(((uint16_t *)tiles) + index, tile_indices, count * sizeof(uint16_t));
     } else {
-        tile_area = &temp_area;
+        for (uint16_t i = 0; i < count; i++) {
+            ((uint8_t *)tiles)[index + i] = (uint8_t)tile_indices[i];
+        }
     }
+
+    // The run is split in two on screen if top_left_x wraps it around.
     int16_t tx = (x - self->top_left_x) % self->width_in_tiles;
     if (tx < 0) {
         tx += self->width_in_tiles;
     }
-    tile_area->x1 = tx * self->tile_width;
-    tile_area->x2 = tile_area->x1 + self->tile_width;
-    int16_t ty = (y - self->top_left_y) % self->height_in_tiles;
-    if (ty < 0) {
-        ty += self->height_in_tiles;
+    uint16_t before_wrap = MIN(count, self->width_in_tiles - tx);
+    _mark_tiles_dirty(self, x, y, before_wrap);
+    if (before_wrap < count) {
+        _mark_tiles_dirty(self, x + before_wrap, y, count - before_wrap);
     }
-    tile_area->y1 = ty * self->tile_height;
-    tile_area->y2 = tile_area->y1 + self->tile_height;
-
-    if (self->partial_change) {
-        displayio_area_union(&self->dirty_area, &temp_area, &self->dirty_area);
-    }
-
-    self->partial_change = true;
 }
 
 void common_hal_displayio_tilegrid_set_all_tiles(displayio_tilegrid_t *self, uint16_t tile_index) {
@@ -412,6 +528,149 @@ void common_hal_displayio_tilegrid_set_top_left(displayio_tilegrid_t *self, uint
     self->full_change = true;
 }
 
+// Reads the bitmap pixel at input_pixel's tile_x and tile_y and runs it through the pixel shader.
+static void _shade_pixel(displayio_tilegrid_t *self, const _displayio_colorspace_t *colorspace,
+    displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_pixel,
+    uint16_t x_tile_index, uint16_t y_tile_index) {
+    output_pixel->pixel = 0;
+    input_pixel->pixel = 0;
+
+    // We always want to read bitmap pixels by row first and then transpose into the destination
+    // buffer because most bitmaps are row associated.
+    if (mp_obj_is_type(self->bitmap, &displayio_bitmap_type)) {
+        input_pixel->pixel = common_hal_displayio_bitmap_get_pixel(self->bitmap, input_pixel->tile_x, input_pixel->tile_y);
+    } else if (mp_obj_is_type(self->bitmap, &displayio_ondiskbitmap_type)) {
+        input_pixel->pixel = common_hal_displayio_ondiskbitmap_get_pixel(self->bitmap, input_pixel->tile_x, input_pixel->tile_y);
+    }
+
+    output_pixel->opaque = true;
+    #if CIRCUITPY_TILEPALETTEMAPPER
+    if (mp_obj_is_type(self->pixel_shader, &tilepalettemapper_tilepalettemapper_type)) {
+        tilepalettemapper_tilepalettemapper_get_color(self->pixel_shader, colorspace, input_pixel, output_pixel, x_tile_index, y_tile_index);
+    }
+    #endif
+    if (self->pixel_shader == mp_const_none) {
+        output_pixel->pixel = input_pixel->pixel;
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        displayio_palette_get_color(self->pixel_shader, colorspace, input_pixel, output_pixel);
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+        displayio_colorconverter_convert(self->pixel_shader, colorspace, input_pixel, output_pixel);
+    }
+}
+
+#if CIRCUITPY_DISPLAYIO_TILE_CACHE
+// Returns the tile cache to use for this fill or NULL if the tiles must be shaded pixel by pixel.
+static displayio_tilegrid_tile_cache_t *_tile_cache_prepare(displayio_tilegrid_t *self,
+    const _displayio_colorspace_t *colorspace) {
+    displayio_tilegrid_tile_cache_t *cache = self->tile_cache;
+    if (cache == NULL) {
+        return NULL;
+    }
+    // Only shaders whose output depends on nothing but the bitmap pixel can be cached. A
+    // TilePaletteMapper depends on where the tile is shown and a ColorConverter's changes aren't
+    // tracked.
+    uint32_t shader_version = 0;
+    if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        shader_version = ((displayio_palette_t *)MP_OBJ_TO_PTR(self->pixel_shader))->version;
+    } else if (self->pixel_shader != mp_const_none) {
+        return NULL;
+    }
+    // OnDiskBitmaps never change.
+    uint32_t bitmap_version = 0;
+    if (mp_obj_is_type(self->bitmap, &displayio_bitmap_type)) {
+        bitmap_version = ((displayio_bitmap_t *)MP_OBJ_TO_PTR(self->bitmap))->version;
+    } else if (!mp_obj_is_type(self->bitmap, &displayio_ondiskbitmap_type)) {
+        return NULL;
+    }
+    // Check the grayscale settings because EPaperDisplay will change them on the same object.
+    if (cache->colorspace != colorspace ||
+        cache->colorspace_grayscale_bit != colorspace->grayscale_bit ||
+        cache->colorspace_grayscale != colorspace->grayscale) {
+        _tile_cache_invalidate(cache);
+        cache->colorspace = colorspace;
+        cache->colorspace_grayscale_bit = colorspace->grayscale_bit;
+        cache->colorspace_grayscale = colorspace->grayscale;
+    }
+    cache->bitmap_version = bitmap_version;
+    cache->shader_version = shader_version;
+    return cache;
+}
+
+// Gets the shaded pixel at x, y within the tile, shading the whole tile first if the cached copy
+// is out of date.
+static void _tile_cache_get_pixel(displayio_tilegrid_t *self, displayio_tilegrid_tile_cache_t *cache,
+    const _displayio_colorspace_t *colorspace, uint16_t tile, uint16_t x, uint16_t y,
+    displayio_output_pixel_t *output_pixel) {
+    displayio_tilegrid_cached_tile_t *cached_tile = &cache->tiles[tile];
+    uint32_t *pixels = cache->pixels + tile * cache->pixels_per_tile;
+    uint32_t *opaque = cache->opaque + tile * cache->opaque_words_per_tile;
+    if (!cached_tile->valid ||
+        cached_tile->bitmap_version != cache->bitmap_version ||
+        cached_tile->shader_version != cache->shader_version) {
+        memset(opaque, 0, cache->opaque_words_per_tile * sizeof(uint32_t));
+        displayio_input_pixel_t input_pixel;
+        displayio_output_pixel_t shaded;
+        input_pixel.tile = tile;
+        uint16_t tile_x = (tile % self->bitmap_width_in_tiles) * self->tile_width;
+        uint16_t tile_y = (tile / self->bitmap_width_in_tiles) * self->tile_height;
+        uint32_t i = 0;
+        for (input_pixel.y = 0; input_pixel.y < self->tile_height; input_pixel.y++) {
+            input_pixel.tile_y = tile_y + input_pixel.y;
+            for (input_pixel.x = 0; input_pixel.x < self->tile_width; input_pixel.x++, i++) {
+                input_pixel.tile_x = tile_x + input_pixel.x;
+                _shade_pixel(self, colorspace, &input_pixel, &shaded, 0, 0);
+                pixels[i] = shaded.pixel;
+                if (shaded.opaque) {
+                    opaque[i / 32] |= 1 << (i % 32);
+                }
+            }
+        }
+        cached_tile->bitmap_version = cache->bitmap_version;
+        cached_tile->shader_version = cache->shader_version;
+        cached_tile->valid = true;
+    }
+    uint32_t i = y * self->tile_width + x;
+    output_pixel->pixel = pixels[i];
+    output_pixel->opaque = (opaque[i / 32] & (1 << (i % 32))) != 0;
+}
+#endif
+
+// Writes one shaded pixel into the area's buffer at offset, packing it in when the display has
+// less than a byte per pixel.
+static void _write_pixel(const _displayio_colorspace_t *colorspace, const displayio_area_t *area,
+    uint32_t *buffer, int16_t offset, uint32_t pixel) {
+    if (colorspace->depth == 16) {
+        *(((uint16_t *)buffer) + offset) = pixel;
+    } else if (colorspace->depth == 32) {
+        *(((uint32_t *)buffer) + offset) = pixel;
+    } else if (colorspace->depth == 24) {
+        memcpy(((uint8_t *)buffer) + offset * 3, &pixel, 3);
+    } else if (colorspace->depth == 8) {
+        *(((uint8_t *)buffer) + offset) = pixel;
+    } else if (colorspace->depth < 8) {
+        uint8_t pixels_per_byte = 8 / colorspace->depth;
+
+        // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
+        if (!colorspace->pixels_in_byte_share_row) {
+            uint16_t width = displayio_area_width(area);
+            uint16_t row = offset / width;
+            uint16_t col = offset % width;
+            // Dividing by pixels_per_byte does truncated division even if we multiply it back out.
+            offset = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * width + row % pixels_per_byte;
+            // Also useful for validating that the bitpacking worked correctly.
+            // if (offset > displayio_area_size(area)) {
+            //     asm("bkpt");
+            // }
+        }
+        uint8_t shift = (offset % pixels_per_byte) * colorspace->depth;
+        if (colorspace->reverse_pixels_in_byte) {
+            // Reverse the shift by subtracting it from the leftmost shift.
+            shift = (pixels_per_byte - 1) * colorspace->depth - shift;
+        }
+        ((uint8_t *)buffer)[offset / pixels_per_byte] |= pixel << shift;
+    }
+}
+
 bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     const _displayio_colorspace_t *colorspace, const displayio_area_t *area,
     uint32_t *mask, uint32_t *buffer) {
@@ -499,96 +758,182 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
         y_shift = temp_shift;
     }
 
+    // Fast path for the common case of a Bitmap shaded by a Palette onto a display with whole
+    // bytes per pixel. The palette keeps each color converted, so it is written straight into
+    // the buffer. A TilePaletteMapper over a Palette only adds a per-tile index remap.
+    displayio_palette_t *palette = NULL;
+    #if CIRCUITPY_TILEPALETTEMAPPER
+    tilepalettemapper_tilepalettemapper_t *mapper = NULL;
+    #endif
+    if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        palette = MP_OBJ_TO_PTR(self->pixel_shader);
+    }
+    #if CIRCUITPY_TILEPALETTEMAPPER
+    else if (mp_obj_is_type(self->pixel_shader, &tilepalettemapper_tilepalettemapper_type)) {
+        mapper = MP_OBJ_TO_PTR(self->pixel_shader);
+        if (mp_obj_is_type(mapper->pixel_shader, &displayio_palette_type)) {
+            palette = MP_OBJ_TO_PTR(mapper->pixel_shader);
+        }
+    }
+    #endif
+    if ((colorspace->depth == 8 || colorspace->depth == 16 || colorspace->depth == 32) &&
+        mp_obj_is_type(self->bitmap, &displayio_bitmap_type) &&
+        palette != NULL &&
+        displayio_palette_prepare_colors(palette, colorspace)) {
+        displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(self->bitmap);
+        uint8_t depth = colorspace->depth;
+        uint16_t scale = self->absolute_transform->scale;
+        uint16_t scaled_tile_width = self->tile_width * scale;
+        for (int16_t y = start_y; y < end_y; y++) {
+            int16_t offset = start + (y - start_y + y_shift) * y_stride + x_shift * x_stride;
+            int16_t local_y = y / scale;
+            uint16_t y_tile_index = (local_y / self->tile_height + self->top_left_y) % self->height_in_tiles;
+            uint16_t tile_y_offset = local_y % self->tile_height;
+            int16_t x = start_x;
+            while (x < end_x) {
+                // Every pixel up to the next tile edge comes from the same row of the same tile.
+                int16_t run_end = MIN(end_x, x - x % scaled_tile_width + scaled_tile_width);
+                uint16_t x_tile_index = (x / scaled_tile_width + self->top_left_x) % self->width_in_tiles;
+                uint16_t tile_location = y_tile_index * self->width_in_tiles + x_tile_index;
+                uint16_t tile;
+                if (self->tiles_in_bitmap > 255) {
+                    tile = ((uint16_t *)tiles)[tile_location];
+                } else {
+                    tile = ((uint8_t *)tiles)[tile_location];
+                }
+                uint16_t tile_x = (tile % self->bitmap_width_in_tiles) * self->tile_width;
+                uint16_t tile_y = (tile / self->bitmap_width_in_tiles) * self->tile_height + tile_y_offset;
+                #if CIRCUITPY_TILEPALETTEMAPPER
+                const uint32_t *mapping = NULL;
+                uint16_t mapping_len = 0;
+                if (mapper != NULL) {
+                    mapping = tilepalettemapper_tilepalettemapper_get_tile_mapping(mapper, x_tile_index, y_tile_index);
+                    mapping_len = mapper->input_color_count;
+                }
+                #endif
+                // When scaled up, neighboring display pixels share a bitmap pixel so only read it
+                // once.
+                int16_t last_local_x = -1;
+                uint32_t index = 0;
+                for (; x < run_end; x++, offset += x_stride) {
+                    if ((mask[offset / 32] & (1 << (offset % 32))) != 0) {
+                        continue;
+                    }
+                    int16_t local_x = x / scale;
+                    if (local_x != last_local_x) {
+                        last_local_x = local_x;
+                        index = common_hal_displayio_bitmap_get_pixel(bitmap, tile_x + local_x % self->tile_width, tile_y);
+                        #if CIRCUITPY_TILEPALETTEMAPPER
+                        if (mapping != NULL && index < mapping_len) {
+                            index = mapping[index];
+                        }
+                        #endif
+                    }
+                    if (index >= palette->color_count || palette->colors[index].transparent) {
+                        full_coverage = false;
+                        continue;
+                    }
+                    mask[offset / 32] |= 1 << (offset % 32);
+                    uint32_t color = palette->colors[index].cached_color;
+                    if (depth == 16) {
+                        ((uint16_t *)buffer)[offset] = color;
+                    } else if (depth == 32) {
+                        buffer[offset] = color;
+                    } else {
+                        ((uint8_t *)buffer)[offset] = color;
+                    }
+                }
+            }
+        }
+        return full_coverage;
+    }
+
     displayio_input_pixel_t input_pixel;
     displayio_output_pixel_t output_pixel;
 
-    for (input_pixel.y = start_y; input_pixel.y < end_y; ++input_pixel.y) {
-        int16_t row_start = start + (input_pixel.y - start_y + y_shift) * y_stride; // in pixels
-        int16_t local_y = input_pixel.y / self->absolute_transform->scale;
-        for (input_pixel.x = start_x; input_pixel.x < end_x; ++input_pixel.x) {
-            // Compute the destination pixel in the buffer and mask based on the transformations.
-            int16_t offset = row_start + (input_pixel.x - start_x + x_shift) * x_stride; // in pixels
-
-            // This is super useful for debugging out of range accesses. Uncomment to use.
-            // if (offset < 0 || offset >= (int32_t) displayio_area_size(area)) {
-            //     asm("bkpt");
-            // }
+    #if CIRCUITPY_DISPLAYIO_TILE_CACHE
+    displayio_tilegrid_tile_cache_t *cache = _tile_cache_prepare(self, colorspace);
+    #endif
 
-            // Check the mask first to see if the pixel has already been set.
-            if ((mask[offset / 32] & (1 << (offset % 32))) != 0) {
+    // Each bitmap pixel covers a scale by scale block of display pixels. Shade it once and copy
+    // it to the part of the block inside the area instead of mapping every display pixel back
+    // into the bitmap. ColorConverter dithers on the bitmap coordinates so the whole block
+    // gets the same result.
+    uint16_t scale = self->absolute_transform->scale;
+    int16_t end_block_x = (end_x + scale - 1) / scale;
+    int16_t end_block_y = (end_y + scale - 1) / scale;
+
+    for (int16_t block_y = start_y / scale; block_y < end_block_y; block_y++) {
+        int16_t y1 = MAX(start_y, block_y * scale);
+        int16_t y2 = MIN(end_y, (block_y + 1) * scale);
+        int16_t local_y = y1 / scale;
+        uint16_t y_tile_index = (local_y / self->tile_height + self->top_left_y) % self->height_in_tiles;
+        for (int16_t block_x = start_x / scale; block_x < end_block_x; block_x++) {
+            int16_t x1 = MAX(start_x, block_x * scale);
+            int16_t x2 = MIN(end_x, (block_x + 1) * scale);
+
+            // Check the mask first to see if the pixels have already been set.
+            bool needed = false;
+            for (int16_t y = y1; y < y2 && !needed; y++) {
+                int16_t row_start = start + (y - start_y + y_shift) * y_stride; // in pixels
+                for (int16_t x = x1; x < x2; x++) {
+                    int16_t offset = row_start + (x - start_x + x_shift) * x_stride; // in pixels
+                    if ((mask[offset / 32] & (1 << (offset % 32))) == 0) {
+                        needed = true;
+                        break;
+                    }
+                }
+            }
+            if (!needed) {
                 continue;
             }
-            int16_t local_x = input_pixel.x / self->absolute_transform->scale;
+
+            int16_t local_x = x1 / scale;
             uint16_t x_tile_index = (local_x / self->tile_width + self->top_left_x) % self->width_in_tiles;
-            uint16_t y_tile_index = (local_y / self->tile_height + self->top_left_y) % self->height_in_tiles;
             uint16_t tile_location = y_tile_index * self->width_in_tiles + x_tile_index;
 
+            uint16_t tile;
             if (self->tiles_in_bitmap > 255) {
-                input_pixel.tile = ((uint16_t *)tiles)[tile_location];
+                tile = ((uint16_t *)tiles)[tile_location];
             } else {
-                input_pixel.tile = ((uint8_t *)tiles)[tile_location];
-            }
-            input_pixel.tile_x = (input_pixel.tile % self->bitmap_width_in_tiles) * self->tile_width + local_x % self->tile_width;
-            input_pixel.tile_y = (input_pixel.tile / self->bitmap_width_in_tiles) * self->tile_height + local_y % self->tile_height;
-
-            output_pixel.pixel = 0;
-            input_pixel.pixel = 0;
-
-            // We always want to read bitmap pixels by row first and then transpose into the destination
-            // buffer because most bitmaps are row associated.
-            if (mp_obj_is_type(self->bitmap, &displayio_bitmap_type)) {
-                input_pixel.pixel = common_hal_displayio_bitmap_get_pixel(self->bitmap, input_pixel.tile_x, input_pixel.tile_y);
-            } else if (mp_obj_is_type(self->bitmap, &displayio_ondiskbitmap_type)) {
-                input_pixel.pixel = common_hal_displayio_ondiskbitmap_get_pixel(self->bitmap, input_pixel.tile_x, input_pixel.tile_y);
+                tile = ((uint8_t *)tiles)[tile_location];
             }
 
-            output_pixel.opaque = true;
-            #if CIRCUITPY_TILEPALETTEMAPPER
-            if (mp_obj_is_type(self->pixel_shader, &tilepalettemapper_tilepalettemapper_type)) {
-                tilepalettemapper_tilepalettemapper_get_color(self->pixel_shader, colorspace, &input_pixel, &output_pixel, x_tile_index, y_tile_index);
-            }
+            #if CIRCUITPY_DISPLAYIO_TILE_CACHE
+            if (cache != NULL) {
+                _tile_cache_get_pixel(self, cache, colorspace, tile,
+                    local_x % self->tile_width, local_y % self->tile_height, &output_pixel);
+            } else
             #endif
-            if (self->pixel_shader == mp_const_none) {
-                output_pixel.pixel = input_pixel.pixel;
-            } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
-                displayio_palette_get_color(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
-            } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
-                displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
+            {
+                input_pixel.x = x1;
+                input_pixel.y = y1;
+                input_pixel.tile = tile;
+                input_pixel.tile_x = (tile % self->bitmap_width_in_tiles) * self->tile_width + local_x % self->tile_width;
+                input_pixel.tile_y = (tile / self->bitmap_width_in_tiles) * self->tile_height + local_y % self->tile_height;
+                _shade_pixel(self, colorspace, &input_pixel, &output_pixel, x_tile_index, y_tile_index);
             }
             if (!output_pixel.opaque) {
                 // A pixel is transparent so we haven't fully covered the area ourselves.
                 full_coverage = false;
-            } else {
-                mask[offset / 32] |= 1 << (offset % 32);
-                if (colorspace->depth == 16) {
-                    *(((uint16_t *)buffer) + offset) = output_pixel.pixel;
-                } else if (colorspace->depth == 32) {
-                    *(((uint32_t *)buffer) + offset) = output_pixel.pixel;
-                } else if (colorspace->depth == 24) {
-                    memcpy(((uint8_t *)buffer) + offset * 3, &output_pixel.pixel, 3);
-                } else if (colorspace->depth == 8) {
-                    *(((uint8_t *)buffer) + offset) = output_pixel.pixel;
-                } else if (colorspace->depth < 8) {
-                    uint8_t pixels_per_byte = 8 / colorspace->depth;
-
-                    // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
-                    if (!colorspace->pixels_in_byte_share_row) {
-                        uint16_t width = displayio_area_width(area);
-                        uint16_t row = offset / width;
-                        uint16_t col = offset % width;
-                        // Dividing by pixels_per_byte does truncated division even if we multiply it back out.
-                        offset = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * width + row % pixels_per_byte;
-                        // Also useful for validating that the bitpacking worked correctly.
-                        // if (offset > displayio_area_size(area)) {
-                        //     asm("bkpt");
-                        // }
-                    }
-                    uint8_t shift = (offset % pixels_per_byte) * colorspace->depth;
-                    if (colorspace->reverse_pixels_in_byte) {
-                        // Reverse the shift by subtracting it from the leftmost shift.
-                        shift = (pixels_per_byte - 1) * colorspace->depth - shift;
+                continue;
+            }
+            for (int16_t y = y1; y < y2; y++) {
+                int16_t row_start = start + (y - start_y + y_shift) * y_stride; // in pixels
+                for (int16_t x = x1; x < x2; x++) {
+                    // Compute the destination pixel in the buffer and mask based on the transformations.
+                    int16_t offset = row_start + (x - start_x + x_shift) * x_stride; // in pixels
+
+                    // This is super useful for debugging out of range accesses. Uncomment to use.
+                    // if (offset < 0 || offset >= (int32_t) displayio_area_size(area)) {
+                    //     asm("bkpt");
+                    // }
+
+                    if ((mask[offset / 32] & (1 << (offset % 32))) != 0) {
+                        continue;
                     }
-                    ((uint8_t *)buffer)[offset / pixels_per_byte] |= output_pixel.pixel << shift;
+                    mask[offset / 32] |= 1 << (offset % 32);
+                    _write_pixel(colorspace, area, buffer, offset, output_pixel.pixel);
                 }
             }
         }
@@ -608,6 +953,14 @@ void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
     self->moved = false;
     self->full_change = false;
     self->partial_change = false;
+    #if CIRCUITPY_DISPLAYIO_TILE_CACHE
+    if (self->dirty_rows != NULL) {
+        for (uint16_t i = 0; i < self->height_in_tiles; i++) {
+            self->dirty_rows[i].x1 = 0;
+            self->dirty_rows[i].x2 = 0;
+        }
+    }
+    #endif
     if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
         displayio_palette_finish_refresh(self->pixel_shader);
     } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
@@ -628,6 +981,74 @@ void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
     // That way they won't change during a refresh and tear.
 }
 
+// Converts an area relative to the TileGrid into an absolute one.
+static void _transform_dirty_area(displayio_tilegrid_t *self, displayio_area_t *area) {
+    int16_t x = self->x;
+    int16_t y = self->y;
+    if (self->absolute_transform->transpose_xy) {
+        int16_t temp = y;
+        y = x;
+        x = temp;
+    }
+    int16_t x1 = area->x1;
+    int16_t x2 = area->x2;
+    if (self->flip_x) {
+        x1 = self->pixel_width - x1;
+        x2 = self->pixel_width - x2;
+    }
+    int16_t y1 = area->y1;
+    int16_t y2 = area->y2;
+    if (self->flip_y) {
+        y1 = self->pixel_height - y1;
+        y2 = self->pixel_height - y2;
+    }
+    if (self->transpose_xy != self->absolute_transform->transpose_xy) {
+        int16_t temp1 = y1, temp2 = y2;
+        y1 = x1;
+        x1 = temp1;
+        y2 = x2;
+        x2 = temp2;
+    }
+    area->x1 = self->absolute_transform->x + self->absolute_transform->dx * (x + x1);
+    area->y1 = self->absolute_transform->y + self->absolute_transform->dy * (y + y1);
+    area->x2 = self->absolute_transform->x + self->absolute_transform->dx * (x + x2);
+    area->y2 = self->absolute_transform->y + self->absolute_transform->dy * (y + y2);
+    if (area->y2 < area->y1) {
+        int16_t temp = area->y2;
+        area->y2 = area->y1;
+        area->y1 = temp;
+    }
+    if (area->x2 < area->x1) {
+        int16_t temp = area->x2;
+        area->x2 = area->x1;
+        area->x1 = temp;
+    }
+}
+
+#if CIRCUITPY_DISPLAYIO_TILE_CACHE
+// Returns one area per band of consecutive dirty tile rows. Clean rows split bands so a change at
+// the top and one at the bottom don't refresh everything in between.
+static displayio_area_t *_get_dirty_row_areas(displayio_tilegrid_t *self, displayio_area_t *tail) {
+    displayio_area_t *band = NULL;
+    for (uint16_t i = 0; i <= self->height_in_tiles; i++) {
+        displayio_area_t *row = i < self->height_in_tiles ? &self->dirty_rows[i] : NULL;
+        if (row != NULL && !displayio_area_empty(row)) {
+            if (band == NULL) {
+                band = row;
+            } else {
+                displayio_area_union(band, row, band);
+            }
+        } else if (band != NULL) {
+            _transform_dirty_area(self, band);
+            band->next = tail;
+            tail = band;
+            band = NULL;
+        }
+    }
+    return tail;
+}
+#endif
+
 displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *self, displayio_area_t *tail) {
     bool first_draw = self->previous_area.x1 == self->previous_area.x2;
     bool hidden = self->hidden || self->hidden_by_parent;
@@ -651,6 +1072,9 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
         return &self->current_area;
     }
 
+    #if CIRCUITPY_DISPLAYIO_TILE_CACHE
+    bool bitmap_changed = false;
+    #endif
     // If we have an in-memory bitmap, then check it for modifications.
     if (mp_obj_is_type(self->bitmap, &displayio_bitmap_type)) {
         displayio_area_t *refresh_area = displayio_bitmap_get_refresh_areas(self->bitmap, tail);
@@ -660,6 +1084,9 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
             if (self->tiles_in_bitmap == 1) {
                 displayio_area_copy(refresh_area, &self->dirty_area);
                 self->partial_change = true;
+                #if CIRCUITPY_DISPLAYIO_TILE_CACHE
+                bitmap_changed = true;
+                #endif
             } else {
                 self->full_change = true;
             }
@@ -683,47 +1110,12 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
     }
 
     if (self->partial_change) {
-        int16_t x = self->x;
-        int16_t y = self->y;
-        if (self->absolute_transform->transpose_xy) {
-            int16_t temp = y;
-            y = x;
-            x = temp;
-        }
-        int16_t x1 = self->dirty_area.x1;
-        int16_t x2 = self->dirty_area.x2;
-        if (self->flip_x) {
-            x1 = self->pixel_width - x1;
-            x2 = self->pixel_width - x2;
+        #if CIRCUITPY_DISPLAYIO_TILE_CACHE
+        if (self->dirty_rows != NULL && !bitmap_changed) {
+            return _get_dirty_row_areas(self, tail);
         }
-        int16_t y1 = self->dirty_area.y1;
-        int16_t y2 = self->dirty_area.y2;
-        if (self->flip_y) {
-            y1 = self->pixel_height - y1;
-            y2 = self->pixel_height - y2;
-        }
-        if (self->transpose_xy != self->absolute_transform->transpose_xy) {
-            int16_t temp1 = y1, temp2 = y2;
-            y1 = x1;
-            x1 = temp1;
-            y2 = x2;
-            x2 = temp2;
-        }
-        self->dirty_area.x1 = self->absolute_transform->x + self->absolute_transform->dx * (x + x1);
-        self->dirty_area.y1 = self->absolute_transform->y + self->absolute_transform->dy * (y + y1);
-        self->dirty_area.x2 = self->absolute_transform->x + self->absolute_transform->dx * (x + x2);
-        self->dirty_area.y2 = self->absolute_transform->y + self->absolute_transform->dy * (y + y2);
-        if (self->dirty_area.y2 < self->dirty_area.y1) {
-            int16_t temp = self->dirty_area.y2;
-            self->dirty_area.y2 = self->dirty_area.y1;
-            self->dirty_area.y1 = temp;
-        }
-        if (self->dirty_area.x2 < self->dirty_area.x1) {
-            int16_t temp = self->dirty_area.x2;
-            self->dirty_area.x2 = self->dirty_area.x1;
-            self->dirty_area.x1 = temp;
-        }
-
+        #endif
+        _transform_dirty_area(self, &self->dirty_area);
         self->dirty_area.next = tail;
         return &self->dirty_area;
     }
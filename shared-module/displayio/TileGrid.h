@@ -13,6 +13,31 @@
 #include "shared-module/displayio/area.h"
 #include "shared-module/displayio/Palette.h"
 
+#if CIRCUITPY_DISPLAYIO_TILE_CACHE
+typedef struct {
+    uint32_t bitmap_version;
+    uint32_t shader_version;
+    bool valid;
+} displayio_tilegrid_cached_tile_t;
+
+// Every tile of the bitmap, shaded into the colorspace of the display it was last drawn on.
+// Everything lives in the one allocation that starts with this header.
+typedef struct {
+    const _displayio_colorspace_t *colorspace;
+    uint8_t colorspace_grayscale_bit;
+    bool colorspace_grayscale;
+    uint16_t tile_count;
+    uint32_t pixels_per_tile;
+    uint32_t opaque_words_per_tile;
+    // Versions of the bitmap and pixel shader for the fill in progress.
+    uint32_t bitmap_version;
+    uint32_t shader_version;
+    displayio_tilegrid_cached_tile_t *tiles;
+    uint32_t *opaque; // One bit per pixel.
+    uint32_t *pixels;
+} displayio_tilegrid_tile_cache_t;
+#endif
+
 typedef struct {
     mp_obj_base_t base;
     mp_obj_t bitmap;
@@ -35,6 +60,12 @@ typedef struct {
     displayio_area_t dirty_area; // Stored as a relative area until the refresh area is fetched.
     displayio_area_t previous_area; // Stored as an absolute area.
     displayio_area_t current_area; // Stored as an absolute area so it applies across frames.
+    #if CIRCUITPY_DISPLAYIO_TILE_CACHE
+    // One relative dirty area per row of tiles so that changes in rows far apart don't refresh
+    // everything between them. NULL when rows aren't tracked separately.
+    displayio_area_t *dirty_rows;
+    displayio_tilegrid_tile_cache_t *tile_cache;
+    #endif
     bool partial_change : 1;
     bool full_change : 1;
     bool moved : 1;
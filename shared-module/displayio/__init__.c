@@ -19,6 +19,7 @@
 #include "shared-module/displayio/area.h"
 #include "supervisor/shared/display.h"
 #include "supervisor/shared/reload.h"
+#include "supervisor/shared/tick.h"
 
 #include "py/mpconfig.h"
 
@@ -111,6 +112,36 @@ void displayio_background(void) {
 
 }
 
+uint32_t displayio_ticks_until_background(void) {
+    uint64_t now = supervisor_ticks_ms64();
+    uint32_t ticks = UINT32_MAX;
+    for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_LIMIT; i++) {
+        mp_const_obj_t display_type = displays[i].display_base.type;
+        displayio_display_core_t *core = NULL;
+        uint32_t ms_per_frame = 0;
+        if (false) {
+        #if CIRCUITPY_BUSDISPLAY
+        } else if (display_type == &busdisplay_busdisplay_type && displays[i].display.auto_refresh) {
+            core = &displays[i].display.core;
+            ms_per_frame = displays[i].display.native_ms_per_frame;
+        #endif
+        #if CIRCUITPY_FRAMEBUFFERIO
+        } else if (display_type == &framebufferio_framebufferdisplay_type && displays[i].framebuffer_display.auto_refresh) {
+            core = &displays[i].framebuffer_display.core;
+            ms_per_frame = displays[i].framebuffer_display.native_ms_per_frame;
+        #endif
+        }
+        if (core == NULL) {
+            continue;
+        }
+        // The background refreshes once more than ms_per_frame has passed. Ticks are slightly
+        // shorter than ms, so this wakes up a little early at worst.
+        uint64_t due = core->last_refresh + ms_per_frame + 1;
+        ticks = MIN(ticks, due > now ? (uint32_t)MIN(due - now, UINT32_MAX - 1) : 0);
+    }
+    return ticks;
+}
+
 static void common_hal_displayio_release_displays_impl(bool keep_primary) {
     // Release displays before busses so that they can send any final commands to turn the display
     // off properly.
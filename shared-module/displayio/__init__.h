@@ -105,6 +105,8 @@ extern primary_display_t displays[CIRCUITPY_DISPLAY_LIMIT];
 extern displayio_group_t circuitpython_splash;
 
 void displayio_background(void);
+// Ticks until an auto refreshing display is next due, for tickless idle.
+uint32_t displayio_ticks_until_background(void);
 void reset_displays(void);
 void displayio_gc_collect(void);
 
@@ -139,3 +139,50 @@ void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpos
         transformed->x1 = whole->x1 + (y1 - whole->y1);
     }
 }
+
+// Adds area to the count areas already in the array, merging it with any of them whose union
+// needs no more than merge_cost extra pixels than drawing both separately. Overlapping pixels
+// count as extra for the separate case since they would be drawn twice. Once max_count areas
+// are in use, area is merged into the one that grows the least. Returns the new count.
+uint8_t displayio_area_coalesce(displayio_area_t *areas, uint8_t count, uint8_t max_count,
+    const displayio_area_t *area, uint32_t merge_cost) {
+    if (displayio_area_empty(area)) {
+        return count;
+    }
+    displayio_area_t merged;
+    displayio_area_copy(area, &merged);
+    // A merge grows the area, which may make it worth merging with an earlier one.
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (uint8_t i = 0; i < count; i++) {
+            displayio_area_t u;
+            displayio_area_union(&areas[i], &merged, &u);
+            if (displayio_area_size(&u) <= displayio_area_size(&areas[i]) + displayio_area_size(&merged) + merge_cost) {
+                displayio_area_copy(&u, &merged);
+                count--;
+                displayio_area_copy(&areas[count], &areas[i]);
+                changed = true;
+                break;
+            }
+        }
+    }
+    if (count < max_count) {
+        displayio_area_copy(&merged, &areas[count]);
+        areas[count].next = NULL;
+        return count + 1;
+    }
+    uint8_t best = 0;
+    uint32_t best_growth = UINT32_MAX;
+    for (uint8_t i = 0; i < count; i++) {
+        displayio_area_t u;
+        displayio_area_union(&areas[i], &merged, &u);
+        uint32_t growth = displayio_area_size(&u) - displayio_area_size(&areas[i]);
+        if (growth < best_growth) {
+            best = i;
+            best_growth = growth;
+        }
+    }
+    displayio_area_union(&areas[best], &merged, &areas[best]);
+    return count;
+}
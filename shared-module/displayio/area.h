@@ -55,3 +55,5 @@ void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpos
     const displayio_area_t *original,
     const displayio_area_t *whole,
     displayio_area_t *transformed);
+uint8_t displayio_area_coalesce(displayio_area_t *areas, uint8_t count, uint8_t max_count,
+    const displayio_area_t *area, uint32_t merge_cost);
@@ -48,6 +48,10 @@ void displayio_display_bus_construct(displayio_display_bus_t *self,
     self->always_toggle_chip_select = always_toggle_chip_select;
     self->SH1107_addressing = SH1107_addressing;
     self->address_little_endian = address_little_endian;
+    #if CIRCUITPY_BUSDISPLAY_DOUBLE_BUFFER
+    self->send_async = NULL;
+    self->wait_for_send = NULL;
+    #endif
 
     #if CIRCUITPY_PARALLELDISPLAYBUS
     if (mp_obj_is_type(bus, &paralleldisplaybus_parallelbus_type)) {
@@ -57,6 +61,10 @@ void displayio_display_bus_construct(displayio_display_bus_t *self,
         self->send = common_hal_paralleldisplaybus_parallelbus_send;
         self->end_transaction = common_hal_paralleldisplaybus_parallelbus_end_transaction;
         self->collect_ptrs = common_hal_paralleldisplaybus_parallelbus_collect_ptrs;
+        #if CIRCUITPY_BUSDISPLAY_DOUBLE_BUFFER
+        self->send_async = common_hal_paralleldisplaybus_parallelbus_send_async;
+        self->wait_for_send = common_hal_paralleldisplaybus_parallelbus_wait_for_send;
+        #endif
     } else
     #endif
     #if CIRCUITPY_FOURWIRE
@@ -67,6 +75,10 @@ void displayio_display_bus_construct(displayio_display_bus_t *self,
         self->send = common_hal_fourwire_fourwire_send;
         self->end_transaction = common_hal_fourwire_fourwire_end_transaction;
         self->collect_ptrs = common_hal_fourwire_fourwire_collect_ptrs;
+        #if CIRCUITPY_BUSDISPLAY_DOUBLE_BUFFER
+        self->send_async = common_hal_fourwire_fourwire_send_async;
+        self->wait_for_send = common_hal_fourwire_fourwire_wait_for_send;
+        #endif
     } else
     #endif
     #if CIRCUITPY_I2CDISPLAYBUS
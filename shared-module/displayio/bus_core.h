@@ -22,6 +22,11 @@ typedef struct {
     display_bus_send send;
     display_bus_end_transaction end_transaction;
     display_bus_collect_ptrs collect_ptrs;
+    #if CIRCUITPY_BUSDISPLAY_DOUBLE_BUFFER
+    // NULL when the bus can only send synchronously.
+    display_bus_send_async send_async;
+    display_bus_wait_for_send wait_for_send;
+    #endif
     uint16_t ram_width;
     uint16_t ram_height;
     int16_t colstart;
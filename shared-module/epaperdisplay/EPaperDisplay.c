@@ -68,6 +68,7 @@ void common_hal_epaperdisplay_epaperdisplay_construct(epaperdisplay_epaperdispla
     self->refresh_time = refresh_time * 1000;
     self->busy_state = busy_state;
     self->refreshing = false;
+    self->refreshing_partial = false;
     self->milliseconds_per_frame = seconds_per_frame * 1000;
     self->chip_select = chip_select ? CHIP_SELECT_TOGGLE_EVERY_BYTE : CHIP_SELECT_UNTOUCHED;
     self->grayscale = grayscale;
@@ -79,6 +80,9 @@ void common_hal_epaperdisplay_epaperdisplay_construct(epaperdisplay_epaperdispla
     self->stop_sequence_len = stop_sequence_len;
     self->refresh_sequence = refresh_sequence;
     self->refresh_sequence_len = refresh_sequence_len;
+    self->partial_refresh_sequence = NULL;
+    self->partial_refresh_sequence_len = 0;
+    self->partial_refresh_count = 0;
 
     self->busy.base.type = &mp_type_NoneType;
     self->two_byte_sequence_length = two_byte_sequence_length;
@@ -98,6 +102,16 @@ void common_hal_epaperdisplay_epaperdisplay_construct(epaperdisplay_epaperdispla
     common_hal_epaperdisplay_epaperdisplay_set_root_group(self, &circuitpython_splash);
 }
 
+void common_hal_epaperdisplay_epaperdisplay_set_partial_refresh(epaperdisplay_epaperdisplay_obj_t *self,
+    const uint8_t *partial_refresh_sequence, uint16_t partial_refresh_sequence_len,
+    mp_float_t partial_refresh_time, uint16_t full_refresh_interval) {
+    self->partial_refresh_sequence = partial_refresh_sequence;
+    self->partial_refresh_sequence_len = partial_refresh_sequence_len;
+    self->partial_refresh_time = partial_refresh_time * 1000;
+    self->full_refresh_interval = full_refresh_interval;
+    self->partial_refresh_count = 0;
+}
+
 bool common_hal_epaperdisplay_epaperdisplay_set_root_group(epaperdisplay_epaperdisplay_obj_t *self, displayio_group_t *root_group) {
     return displayio_display_core_set_root_group(&self->core, root_group);
 }
@@ -213,12 +227,19 @@ uint32_t common_hal_epaperdisplay_epaperdisplay_get_time_to_refresh(epaperdispla
     return self->milliseconds_per_frame - elapsed_time;
 }
 
-static void epaperdisplay_epaperdisplay_finish_refresh(epaperdisplay_epaperdisplay_obj_t *self) {
+static void epaperdisplay_epaperdisplay_finish_refresh(epaperdisplay_epaperdisplay_obj_t *self, bool partial) {
     // Actually refresh the display now that all pixel RAM has been updated.
-    send_command_sequence(self, false, self->refresh_sequence, self->refresh_sequence_len);
+    if (partial) {
+        send_command_sequence(self, false, self->partial_refresh_sequence, self->partial_refresh_sequence_len);
+        self->partial_refresh_count++;
+    } else {
+        send_command_sequence(self, false, self->refresh_sequence, self->refresh_sequence_len);
+        self->partial_refresh_count = 0;
+    }
 
     supervisor_enable_tick();
     self->refreshing = true;
+    self->refreshing_partial = partial;
 
     displayio_display_core_finish_refresh(&self->core);
 }
@@ -431,7 +452,7 @@ bool common_hal_epaperdisplay_epaperdisplay_refresh(epaperdisplay_epaperdisplay_
     if (self->acep) {
         epaperdisplay_epaperdisplay_start_refresh(self);
         _clean_area(self);
-        epaperdisplay_epaperdisplay_finish_refresh(self);
+        epaperdisplay_epaperdisplay_finish_refresh(self, false);
         while (self->refreshing && !mp_hal_is_interrupted()) {
             RUN_BACKGROUND_TASKS;
         }
@@ -440,12 +461,25 @@ bool common_hal_epaperdisplay_epaperdisplay_refresh(epaperdisplay_epaperdisplay_
         return false;
     }
 
+    // Only the changed areas are written when the panel can refresh part of itself with a
+    // faster waveform. Every so often the whole panel is refreshed to clear the ghosting that
+    // partial refreshes leave behind.
+    bool partial = false;
+    if (self->partial_refresh_sequence != NULL && current_area != &self->core.area) {
+        if (self->partial_refresh_count < self->full_refresh_interval) {
+            partial = true;
+        } else {
+            self->core.area.next = NULL;
+            current_area = &self->core.area;
+        }
+    }
+
     epaperdisplay_epaperdisplay_start_refresh(self);
     while (current_area != NULL) {
         epaperdisplay_epaperdisplay_refresh_area(self, current_area);
         current_area = current_area->next;
     }
-    epaperdisplay_epaperdisplay_finish_refresh(self);
+    epaperdisplay_epaperdisplay_finish_refresh(self, partial);
     return true;
 }
 
@@ -456,7 +490,8 @@ void epaperdisplay_epaperdisplay_background(epaperdisplay_epaperdisplay_obj_t *s
             bool busy = common_hal_digitalio_digitalinout_get_value(&self->busy);
             refresh_done = busy != self->busy_state;
         } else {
-            refresh_done = supervisor_ticks_ms64() - self->core.last_refresh > self->refresh_time;
+            uint16_t refresh_time = self->refreshing_partial ? self->partial_refresh_time : self->refresh_time;
+            refresh_done = supervisor_ticks_ms64() - self->core.last_refresh > refresh_time;
         }
         if (refresh_done) {
             supervisor_disable_tick();
@@ -498,6 +533,7 @@ void epaperdisplay_epaperdisplay_collect_ptrs(epaperdisplay_epaperdisplay_obj_t
     gc_collect_ptr((void *)self->start_sequence);
     gc_collect_ptr((void *)self->stop_sequence);
     gc_collect_ptr((void *)self->refresh_sequence);
+    gc_collect_ptr((void *)self->partial_refresh_sequence);
 }
 
 size_t maybe_refresh_epaperdisplay(void) {
@@ -22,11 +22,18 @@ typedef struct {
     const uint8_t *start_sequence;
     const uint8_t *stop_sequence;
     const uint8_t *refresh_sequence;
+    // Sent instead of refresh_sequence when only the changed window was written.
+    const uint8_t *partial_refresh_sequence;
     uint16_t start_sequence_len;
     uint16_t stop_sequence_len;
     uint16_t refresh_sequence_len;
+    uint16_t partial_refresh_sequence_len;
     uint16_t start_up_time_ms;
     uint16_t refresh_time;
+    uint16_t partial_refresh_time;
+    // Partial refreshes allowed between full ones, and how many have happened since the last.
+    uint16_t full_refresh_interval;
+    uint16_t partial_refresh_count;
     uint16_t write_black_ram_command;
     uint16_t write_color_ram_command;
     uint8_t hue;
@@ -34,6 +41,7 @@ typedef struct {
     bool black_bits_inverted;
     bool color_bits_inverted;
     bool refreshing;
+    bool refreshing_partial;
     bool grayscale;
     bool acep;
     bool two_byte_sequence_length;
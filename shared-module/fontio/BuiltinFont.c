@@ -26,6 +26,23 @@ uint8_t fontio_builtinfont_get_glyph_index(const fontio_builtinfont_t *self, mp_
     if (codepoint >= 0x20 && codepoint <= 0x7e) {
         return codepoint - 0x20;
     }
+    if (self->unicode_codepoints != NULL) {
+        // Binary search the sorted codepoints. Their order matches the glyphs in the bitmap.
+        size_t lo = 0;
+        size_t hi = self->unicode_codepoints_len;
+        while (lo < hi) {
+            size_t mid = (lo + hi) / 2;
+            mp_uint_t potential_c = self->unicode_codepoints[mid];
+            if (potential_c == codepoint) {
+                return 0x7f - 0x20 + mid;
+            } else if (potential_c < codepoint) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return 0xff;
+    }
     // Do a linear search of the mapping for unicode.
     const byte *j = self->unicode_characters;
     uint8_t k = 0;
@@ -19,6 +19,10 @@ typedef struct {
     uint8_t height;
     const byte *unicode_characters;
     uint16_t unicode_characters_len;
+    // unicode_characters as a sorted table of codepoints, or NULL to decode
+    // unicode_characters instead.
+    const uint16_t *unicode_codepoints;
+    uint16_t unicode_codepoints_len;
 } fontio_builtinfont_t;
 
 uint8_t fontio_builtinfont_get_glyph_index(const fontio_builtinfont_t *self, mp_uint_t codepoint);
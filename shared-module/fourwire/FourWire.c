@@ -159,6 +159,24 @@ void common_hal_fourwire_fourwire_send(mp_obj_t obj, display_byte_type_t data_ty
     }
 }
 
+#if CIRCUITPY_BUSDISPLAY_DOUBLE_BUFFER
+void common_hal_fourwire_fourwire_send_async(mp_obj_t obj, const uint8_t *data, uint32_t data_length) {
+    fourwire_fourwire_obj_t *self = MP_OBJ_TO_PTR(obj);
+    if (self->command.base.type == &mp_type_NoneType) {
+        // 9-bit mode repacks the data so it can't be sent from the caller's buffer.
+        common_hal_fourwire_fourwire_send(obj, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED, data, data_length);
+        return;
+    }
+    common_hal_digitalio_digitalinout_set_value(&self->command, true);
+    common_hal_busio_spi_write_async(self->bus, data, data_length);
+}
+
+void common_hal_fourwire_fourwire_wait_for_send(mp_obj_t obj) {
+    fourwire_fourwire_obj_t *self = MP_OBJ_TO_PTR(obj);
+    common_hal_busio_spi_wait_for_async(self->bus);
+}
+#endif
+
 void common_hal_fourwire_fourwire_end_transaction(mp_obj_t obj) {
     fourwire_fourwire_obj_t *self = MP_OBJ_TO_PTR(obj);
     if (self->chip_select.base.type != &mp_type_NoneType) {
@@ -13,6 +13,7 @@
 #include "shared-bindings/time/__init__.h"
 #include "shared-module/displayio/__init__.h"
 #include "shared-module/displayio/display_core.h"
+#include "shared-module/framebufferio/__init__.h"
 #include "supervisor/shared/display.h"
 #include "supervisor/shared/tick.h"
 
@@ -116,9 +117,80 @@ static const displayio_area_t *_get_refresh_areas(framebufferio_framebufferdispl
 }
 
 #define MARK_ROW_DIRTY(r) (dirty_row_bitmask[r / 8] |= (1 << (r & 7)))
-static bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const displayio_area_t *area, uint8_t *dirty_row_bitmask) {
+// Renders straight into the framebuffer, skipping the row buffer, when pixels are whole bytes.
+// Layers only draw pixels that no layer in front of them has drawn and whatever is left is then
+// cleared, so each pixel is written once and a half drawn area is never shown. Returns false
+// when the area has to go through the row buffer instead.
+static bool _refresh_area_direct(framebufferio_framebufferdisplay_obj_t *self, const displayio_area_t *clipped, uint8_t *dirty_row_bitmask) {
+    if (self->core.colorspace.depth < 8) {
+        return false;
+    }
+    uint8_t bytes_per_pixel = self->core.colorspace.depth / 8;
+    // Layers write each pixel as a single value, except 24 bit ones which are done bytewise.
+    uint8_t align = bytes_per_pixel == 3 ? 1 : bytes_per_pixel;
+    uint8_t *buf = (uint8_t *)self->bufinfo.buf, *endbuf = buf + self->bufinfo.len;
+    (void)endbuf; // Hint to compiler that endbuf is "used" even if NDEBUG
+    buf += self->first_pixel_offset;
+    size_t rowstride = self->row_stride;
+    uint8_t *dest = buf + clipped->y1 * rowstride + clipped->x1 * bytes_per_pixel;
+    if ((uintptr_t)dest % align != 0 || rowstride % align != 0) {
+        return false;
+    }
+
+    uint16_t width = displayio_area_width(clipped);
+    size_t rowsize = width * bytes_per_pixel;
+    // Rows that follow each other in memory can be drawn together. Only the mask is on the stack
+    // so it gets the whole area buffer budget.
+    uint16_t rows_per_chunk = 1;
+    if (rowsize == rowstride) {
+        rows_per_chunk = MAX(1, CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE * 8 / width);
+    }
+    uint32_t mask_length = (rows_per_chunk * width / 32) + 1;
+    uint32_t mask[mask_length];
+
+    for (int16_t y = clipped->y1; y < clipped->y2; y += rows_per_chunk) {
+        displayio_area_t chunk = {
+            .x1 = clipped->x1,
+            .y1 = y,
+            .x2 = clipped->x2,
+            .y2 = MIN(y + rows_per_chunk, clipped->y2)
+        };
+        uint8_t *chunk_dest = buf + y * rowstride + clipped->x1 * bytes_per_pixel;
+        assert(chunk_dest >= buf && chunk_dest + (chunk.y2 - chunk.y1 - 1) * rowstride + rowsize <= endbuf);
+
+        memset(mask, 0, mask_length * sizeof(mask[0]));
+        if (!displayio_display_core_fill_area(&self->core, &chunk, mask, (uint32_t *)(void *)chunk_dest)) {
+            uint32_t pixels = displayio_area_size(&chunk);
+            for (uint32_t i = 0; i < pixels; i++) {
+                if ((mask[i / 32] & (1u << (i % 32))) != 0) {
+                    continue;
+                }
+                if (bytes_per_pixel == 2) {
+                    ((uint16_t *)(void *)chunk_dest)[i] = 0;
+                } else if (bytes_per_pixel == 4) {
+                    ((uint32_t *)(void *)chunk_dest)[i] = 0;
+                } else {
+                    memset(chunk_dest + i * bytes_per_pixel, 0, bytes_per_pixel);
+                }
+            }
+        }
+        for (uint16_t i = chunk.y1; i < chunk.y2; i++) {
+            MARK_ROW_DIRTY(i);
+        }
+
+        #if CIRCUITPY_TINYUSB
+        usb_background();
+        #endif
+    }
+    return true;
+}
+
+// The part of the framebuffer that was actually written is left in refreshed.
+static bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const displayio_area_t *area, uint8_t *dirty_row_bitmask, displayio_area_t *refreshed) {
     uint16_t buffer_size = CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE / sizeof(uint32_t); // In uint32_ts
 
+    refreshed->x1 = 0;
+    refreshed->x2 = 0;
     displayio_area_t clipped;
     // Clip the area to the display by overlapping the areas. If there is no overlap then we're done.
     if (!displayio_display_core_clip_area(&self->core, area, &clipped)) {
@@ -132,6 +204,11 @@ static bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const di
         clipped.x1 = (clipped.x1 / div) * div;
         clipped.x2 = ((clipped.x2 + div - 1) / div) * div;
     }
+    displayio_area_copy(&clipped, refreshed);
+
+    if (_refresh_area_direct(self, &clipped, dirty_row_bitmask)) {
+        return true;
+    }
 
     uint16_t rows_per_buffer = displayio_area_height(&clipped);
     uint8_t pixels_per_word = (sizeof(uint32_t) * 8) / self->core.colorspace.depth;
@@ -193,12 +270,20 @@ static bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const di
         uint8_t *src = (uint8_t *)buffer;
         size_t rowsize = (subrectangle.x2 - subrectangle.x1) * self->core.colorspace.depth / 8;
 
-        for (uint16_t i = subrectangle.y1; i < subrectangle.y2; i++) {
-            assert(dest >= buf && dest < endbuf && dest + rowsize <= endbuf);
-            MARK_ROW_DIRTY(i);
-            memcpy(dest, src, rowsize);
-            dest += rowstride;
-            src += rowsize;
+        uint16_t rows = subrectangle.y2 - subrectangle.y1;
+        assert(dest >= buf && dest + (rows - 1) * rowstride + rowsize <= endbuf);
+        if (framebufferio_port_copy_rows(dest, rowstride, src, rowsize, rows)) {
+            for (uint16_t i = subrectangle.y1; i < subrectangle.y2; i++) {
+                MARK_ROW_DIRTY(i);
+            }
+        } else {
+            for (uint16_t i = subrectangle.y1; i < subrectangle.y2; i++) {
+                assert(dest >= buf && dest < endbuf && dest + rowsize <= endbuf);
+                MARK_ROW_DIRTY(i);
+                memcpy(dest, src, rowsize);
+                dest += rowstride;
+                src += rowsize;
+            }
         }
 
         // TODO(tannewt): Make refresh displays faster so we don't starve other
@@ -223,11 +308,23 @@ static void _refresh_display(framebufferio_framebufferdisplay_obj_t *self) {
         uint8_t dirty_row_bitmask[(row_count + 7) / 8];
         memset(dirty_row_bitmask, 0, sizeof(dirty_row_bitmask));
         self->framebuffer_protocol->get_bufinfo(self->framebuffer, &self->bufinfo);
+        // Collect what was written, merging areas that touch, for backends that want it.
+        displayio_area_t dirty_areas[CIRCUITPY_DISPLAY_AREA_MERGE_LIMIT];
+        uint8_t dirty_area_count = 0;
         while (current_area != NULL) {
-            _refresh_area(self, current_area, dirty_row_bitmask);
+            displayio_area_t refreshed;
+            _refresh_area(self, current_area, dirty_row_bitmask, &refreshed);
+            dirty_area_count = displayio_area_coalesce(dirty_areas, dirty_area_count, CIRCUITPY_DISPLAY_AREA_MERGE_LIMIT, &refreshed, 0);
             current_area = current_area->next;
         }
-        self->framebuffer_protocol->swapbuffers(self->framebuffer, dirty_row_bitmask);
+        if (self->framebuffer_protocol->swapbuffers_areas != NULL) {
+            for (uint8_t i = 0; i < dirty_area_count; i++) {
+                dirty_areas[i].next = i + 1 < dirty_area_count ? &dirty_areas[i + 1] : NULL;
+            }
+            self->framebuffer_protocol->swapbuffers_areas(self->framebuffer, dirty_row_bitmask, dirty_area_count > 0 ? dirty_areas : NULL);
+        } else {
+            self->framebuffer_protocol->swapbuffers(self->framebuffer, dirty_row_bitmask);
+        }
     }
     displayio_display_core_finish_refresh(&self->core);
 }
@@ -289,9 +386,9 @@ void common_hal_framebufferio_framebufferdisplay_set_auto_refresh(framebufferio_
     self->first_manual_refresh = !auto_refresh;
     if (auto_refresh != self->auto_refresh) {
         if (auto_refresh) {
-            supervisor_enable_tick();
+            supervisor_enable_tickless();
         } else {
-            supervisor_disable_tick();
+            supervisor_disable_tickless();
         }
     }
     self->auto_refresh = auto_refresh;
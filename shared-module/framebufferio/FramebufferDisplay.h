@@ -54,6 +54,7 @@ typedef mp_float_t (*framebuffer_get_brightness_fun)(mp_obj_t);
 typedef void (*framebuffer_deinit_fun)(mp_obj_t);
 typedef void (*framebuffer_get_bufinfo_fun)(mp_obj_t, mp_buffer_info_t *bufinfo);
 typedef void (*framebuffer_swapbuffers_fun)(mp_obj_t, uint8_t *dirty_row_bitmask);
+typedef void (*framebuffer_swapbuffers_areas_fun)(mp_obj_t, uint8_t *dirty_row_bitmask, const displayio_area_t *dirty_areas);
 
 typedef struct _framebuffer_p_t {
     MP_PROTOCOL_HEAD // MP_QSTR_protocol_framebuffer
@@ -80,4 +81,8 @@ typedef struct _framebuffer_p_t {
     framebuffer_get_brightness_fun get_brightness;
     framebuffer_set_brightness_fun set_brightness;
 
+    // Optional -- called instead of swapbuffers with a list of the changed areas in framebuffer
+    // pixels, for backends that can limit cache writeback or transfers to them
+    framebuffer_swapbuffers_areas_fun swapbuffers_areas;
+
 } framebuffer_p_t;
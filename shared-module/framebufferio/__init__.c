@@ -3,3 +3,10 @@
 // SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
 //
 // SPDX-License-Identifier: MIT
+
+#include "py/mpconfig.h"
+#include "shared-module/framebufferio/__init__.h"
+
+MP_WEAK bool framebufferio_port_copy_rows(uint8_t *dest, size_t dest_stride, const uint8_t *src, size_t row_size, uint16_t rows) {
+    return false;
+}
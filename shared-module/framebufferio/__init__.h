@@ -5,3 +5,12 @@
 // SPDX-License-Identifier: MIT
 
 #pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Ports with a 2D or memory-to-memory DMA engine can override this to copy rendered rows into
+// the framebuffer. It must be finished with src before returning. Returns false to fall back to
+// memcpy.
+bool framebufferio_port_copy_rows(uint8_t *dest, size_t dest_stride, const uint8_t *src, size_t row_size, uint16_t rows);
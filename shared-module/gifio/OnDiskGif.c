@@ -127,11 +127,50 @@ static void GIFDraw(GIFDRAW *pDraw) {
     }
 }
 
-void common_hal_gifio_ondiskgif_construct(gifio_ondiskgif_t *self, pyb_file_obj_t *file, bool use_palette) {
+// Wraps the framebuffer's memory in `bitmap` so frames decode straight into it.
+static void framebuffer_bitmap(gifio_ondiskgif_t *self, displayio_bitmap_t *bitmap) {
+    const framebuffer_p_t *proto = self->framebuffer_protocol;
+    mp_obj_t framebuffer = self->framebuffer;
+    int depth = proto->get_color_depth ? proto->get_color_depth(framebuffer) : 16;
+    int first_pixel_offset = proto->get_first_pixel_offset ? proto->get_first_pixel_offset(framebuffer) : 0;
+    bool reversed = proto->get_reverse_pixels_in_word ? proto->get_reverse_pixels_in_word(framebuffer) : false;
+    if (depth != 16 || first_pixel_offset != 0 || reversed) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_framebuffer);
+    }
+
+    int width = proto->get_width(framebuffer);
+    int height = proto->get_height(framebuffer);
+    int row_stride = proto->get_row_stride ? proto->get_row_stride(framebuffer) : 0;
+    if (row_stride == 0) {
+        row_stride = width * sizeof(uint16_t);
+    }
+    mp_buffer_info_t bufinfo;
+    proto->get_bufinfo(framebuffer, &bufinfo);
+    if (row_stride % sizeof(uint32_t) != 0 || (size_t)row_stride * height > bufinfo.len) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_framebuffer);
+    }
+
+    common_hal_displayio_bitmap_construct_from_buffer(bitmap, width, height, 16, bufinfo.buf, false);
+    bitmap->stride = row_stride / sizeof(uint32_t);
+}
+
+void common_hal_gifio_ondiskgif_construct(gifio_ondiskgif_t *self, pyb_file_obj_t *file, bool use_palette, mp_obj_t framebuffer) {
     self->file = file;
+    self->framebuffer = MP_OBJ_NULL;
+    self->framebuffer_protocol = NULL;
+    if (framebuffer != mp_const_none) {
+        if (use_palette) {
+            mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_use_palette);
+        }
+        self->framebuffer = framebuffer;
+        self->framebuffer_protocol = mp_proto_get_or_throw(MP_QSTR_protocol_framebuffer, framebuffer);
+    }
 
     if (use_palette == true) {
         GIF_begin(&self->gif, GIF_PALETTE_RGB888);
+    } else if (self->framebuffer != MP_OBJ_NULL) {
+        // Framebuffers hold native-endian RGB565, as displayio's refresh writes it.
+        GIF_begin(&self->gif, GIF_PALETTE_RGB565_LE);
     } else {
         GIF_begin(&self->gif, GIF_PALETTE_RGB565_BE);
     }
@@ -170,8 +209,13 @@ void common_hal_gifio_ondiskgif_construct(gifio_ondiskgif_t *self, pyb_file_obj_
     }
 
     displayio_bitmap_t *bitmap = mp_obj_malloc(displayio_bitmap_t, &displayio_bitmap_type);
-    common_hal_displayio_bitmap_construct(bitmap, self->gif.iCanvasWidth, self->gif.iCanvasHeight, bpp);
+    if (self->framebuffer != MP_OBJ_NULL) {
+        framebuffer_bitmap(self, bitmap);
+    } else {
+        common_hal_displayio_bitmap_construct(bitmap, self->gif.iCanvasWidth, self->gif.iCanvasHeight, bpp);
+    }
     self->bitmap = bitmap;
+    self->frame_area = (displayio_area_t) {0};
 
     GIFINFO info;
     GIF_getInfo(&self->gif, &info);
@@ -186,6 +230,8 @@ void common_hal_gifio_ondiskgif_deinit(gifio_ondiskgif_t *self) {
     common_hal_displayio_bitmap_deinit(self->bitmap);
     self->bitmap = NULL;
     self->palette = NULL;
+    self->framebuffer = MP_OBJ_NULL;
+    self->framebuffer_protocol = NULL;
 }
 
 bool common_hal_gifio_ondiskgif_deinited(gifio_ondiskgif_t *self) {
@@ -227,20 +273,68 @@ int32_t common_hal_gifio_ondiskgif_get_max_delay(gifio_ondiskgif_t *self) {
     return self->max_delay;
 }
 
+mp_obj_t common_hal_gifio_ondiskgif_get_frame_rect(gifio_ondiskgif_t *self) {
+    displayio_area_t *area = &self->frame_area;
+    mp_obj_t elems[] = {
+        MP_OBJ_NEW_SMALL_INT(area->x1),
+        MP_OBJ_NEW_SMALL_INT(area->y1),
+        MP_OBJ_NEW_SMALL_INT(displayio_area_width(area)),
+        MP_OBJ_NEW_SMALL_INT(displayio_area_height(area)),
+    };
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(elems), elems);
+}
+
+// Tells the framebuffer which rows changed, the same way a FramebufferDisplay refresh does.
+static void framebuffer_swap(gifio_ondiskgif_t *self) {
+    displayio_area_t *area = &self->frame_area;
+    int height = self->bitmap->height;
+    uint8_t dirty_row_bitmask[(height + 7) / 8];
+    memset(dirty_row_bitmask, 0, sizeof(dirty_row_bitmask));
+    for (int r = area->y1; r < area->y2; r++) {
+        dirty_row_bitmask[r / 8] |= (1 << (r & 7));
+    }
+    if (self->framebuffer_protocol->swapbuffers_areas != NULL) {
+        self->framebuffer_protocol->swapbuffers_areas(self->framebuffer, dirty_row_bitmask, displayio_area_empty(area) ? NULL : area);
+    } else {
+        self->framebuffer_protocol->swapbuffers(self->framebuffer, dirty_row_bitmask);
+    }
+}
+
 uint32_t common_hal_gifio_ondiskgif_next_frame(gifio_ondiskgif_t *self, bool setDirty) {
     int nextDelay = 0;
     int result = 0;
     result = GIF_playFrame(&self->gif, &nextDelay, self);
 
-    if ((result >= 0) && (setDirty)) {
-        displayio_area_t dirty_area = {
-            .x1 = 0,
-            .y1 = 0,
-            .x2 = self->bitmap->width,
-            .y2 = self->bitmap->height,
-        };
+    if (result < 0) {
+        return nextDelay;
+    }
 
-        displayio_bitmap_set_dirty_area(self->bitmap, &dirty_area);
+    // Only the frame's image descriptor rectangle can change, because disposal to the
+    // background color is unsupported and the rest of the canvas keeps the previous frame.
+    // With a palette, color changes are tracked by the palette itself.
+    displayio_area_t frame = {
+        .x1 = self->gif.iX,
+        .y1 = self->gif.iY,
+        .x2 = self->gif.iX + self->gif.iWidth,
+        .y2 = self->gif.iY + self->gif.iHeight,
+        .next = NULL,
+    };
+    displayio_area_t bounds = {
+        .x1 = 0,
+        .y1 = 0,
+        .x2 = self->bitmap->width,
+        .y2 = self->bitmap->height,
+    };
+    if (!displayio_area_compute_overlap(&frame, &bounds, &self->frame_area)) {
+        self->frame_area = (displayio_area_t) {0};
+    }
+    self->frame_area.next = NULL;
+
+    if (setDirty && !displayio_area_empty(&self->frame_area)) {
+        displayio_bitmap_set_dirty_area(self->bitmap, &self->frame_area);
+    }
+    if (self->framebuffer != MP_OBJ_NULL) {
+        framebuffer_swap(self);
     }
 
     return nextDelay;
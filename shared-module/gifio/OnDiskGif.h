@@ -14,6 +14,8 @@
 #include "lib/AnimatedGIF/AnimatedGIF_circuitpy.h"
 #include "shared-module/displayio/Bitmap.h"
 #include "shared-module/displayio/Palette.h"
+#include "shared-module/displayio/area.h"
+#include "shared-module/framebufferio/FramebufferDisplay.h"
 
 #include "extmod/vfs_fat.h"
 
@@ -23,6 +25,9 @@ typedef struct {
     pyb_file_obj_t *file;
     displayio_bitmap_t *bitmap;
     displayio_palette_t *palette;
+    mp_obj_t framebuffer;
+    const framebuffer_p_t *framebuffer_protocol;
+    displayio_area_t frame_area; // last frame's image descriptor, clipped to the bitmap
     int32_t duration;
     int32_t frame_count;
     int32_t min_delay;
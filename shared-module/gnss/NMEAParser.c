@@ -0,0 +1,470 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 CircuitPython contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "py/stream.h"
+#include "shared-bindings/gnss/NMEAParser.h"
+
+// GSA, the longest supported sentence, has 18 fields.
+#define MAX_FIELDS (20)
+
+static const struct {
+    char name[4];
+    uint8_t bit;
+} sentence_types[] = {
+    { "GGA", GNSS_NMEA_GGA },
+    { "GLL", GNSS_NMEA_GLL },
+    { "GSA", GNSS_NMEA_GSA },
+    { "RMC", GNSS_NMEA_RMC },
+};
+
+uint8_t shared_module_gnss_nmea_sentence_type(const char *type, size_t len) {
+    if (len != 3) {
+        return 0;
+    }
+    for (size_t i = 0; i < MP_ARRAY_SIZE(sentence_types); i++) {
+        if (memcmp(type, sentence_types[i].name, 3) == 0) {
+            return sentence_types[i].bit;
+        }
+    }
+    return 0;
+}
+
+void common_hal_gnss_nmeaparser_construct(gnss_nmeaparser_obj_t *self, mp_obj_t stream, uint8_t sentence_mask) {
+    self->stream = stream;
+    self->sentence_mask = sentence_mask;
+    common_hal_gnss_nmeaparser_reset(self);
+}
+
+void common_hal_gnss_nmeaparser_reset(gnss_nmeaparser_obj_t *self) {
+    memset(&self->fix, 0, sizeof(self->fix));
+    self->fix.fix = POSITIONFIX_INVALID;
+    self->sentence_count = 0;
+    self->error_count = 0;
+    self->sentence_len = 0;
+    self->in_sentence = false;
+}
+
+const gnss_nmea_fix_t *common_hal_gnss_nmeaparser_get_fix(gnss_nmeaparser_obj_t *self) {
+    return &self->fix;
+}
+
+uint32_t common_hal_gnss_nmeaparser_get_sentence_count(gnss_nmeaparser_obj_t *self) {
+    return self->sentence_count;
+}
+
+uint32_t common_hal_gnss_nmeaparser_get_error_count(gnss_nmeaparser_obj_t *self) {
+    return self->error_count;
+}
+
+static int hex_value(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    return -1;
+}
+
+static bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+static bool parse_uint(const char *s, uint32_t *out) {
+    if (!*s) {
+        return false;
+    }
+    uint32_t value = 0;
+    for (; *s; s++) {
+        if (!is_digit(*s) || value > 100000000) {
+            return false;
+        }
+        value = value * 10 + (*s - '0');
+    }
+    *out = value;
+    return true;
+}
+
+// Parses a decimal number such as "-12.345" into an integer scaled by
+// 10 ** frac_digits. Digits beyond frac_digits are truncated.
+static bool parse_fixed(const char *s, int frac_digits, int64_t *out) {
+    bool negative = *s == '-';
+    if (negative) {
+        s++;
+    }
+    if (!*s) {
+        return false;
+    }
+    int64_t value = 0;
+    int integer_digits = 0;
+    for (; is_digit(*s); s++) {
+        if (++integer_digits > 10) {
+            return false;
+        }
+        value = value * 10 + (*s - '0');
+    }
+    int digits = 0;
+    if (*s == '.') {
+        for (s++; is_digit(*s); s++) {
+            if (digits < frac_digits) {
+                value = value * 10 + (*s - '0');
+                digits++;
+            }
+        }
+    }
+    if (*s) {
+        return false;
+    }
+    for (; digits < frac_digits; digits++) {
+        value *= 10;
+    }
+    *out = negative ? -value : value;
+    return true;
+}
+
+// Converts "ddmm.mmmm" (or "dddmm.mmmm") plus a hemisphere letter to units of
+// 1e-7 degrees.
+static bool parse_angle(const char *value, const char *hemisphere, int32_t *out) {
+    int64_t v;
+    if (!parse_fixed(value, 7, &v) || v < 0) {
+        return false;
+    }
+    int64_t degrees = v / 1000000000;
+    int64_t minutes_e7 = v % 1000000000;
+    if (degrees > 180 || minutes_e7 >= 600000000) {
+        return false;
+    }
+    int32_t angle = (int32_t)(degrees * 10000000 + minutes_e7 / 60);
+    switch (hemisphere[0]) {
+        case 'S':
+        case 'W':
+            angle = -angle;
+            MP_FALLTHROUGH;
+        case 'N':
+        case 'E':
+            if (hemisphere[1]) {
+                return false;
+            }
+            *out = angle;
+            return true;
+        default:
+            return false;
+    }
+}
+
+static int two_digits(const char *s) {
+    return (s[0] - '0') * 10 + (s[1] - '0');
+}
+
+static bool all_digits(const char *s, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if (!is_digit(s[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// "hhmmss" with optional fractional seconds, which are dropped. An empty
+// field leaves the time unchanged.
+static bool parse_time(const char *s, gnss_nmea_fix_t *fix) {
+    if (!*s) {
+        return true;
+    }
+    if (!all_digits(s, 6) || (s[6] && s[6] != '.')) {
+        return false;
+    }
+    int hour = two_digits(s), minute = two_digits(s + 2), second = two_digits(s + 4);
+    // 60 allows for a leap second.
+    if (hour > 23 || minute > 59 || second > 60) {
+        return false;
+    }
+    fix->hour = hour;
+    fix->minute = minute;
+    fix->second = second;
+    fix->has_time = true;
+    return true;
+}
+
+// "ddmmyy". NMEA only carries two year digits; they are taken to be 20yy.
+static bool parse_date(const char *s, gnss_nmea_fix_t *fix) {
+    if (!*s) {
+        return true;
+    }
+    if (!all_digits(s, 6) || s[6]) {
+        return false;
+    }
+    int day = two_digits(s), month = two_digits(s + 2);
+    if (day < 1 || day > 31 || month < 1 || month > 12) {
+        return false;
+    }
+    fix->day = day;
+    fix->month = month;
+    fix->year = 2000 + two_digits(s + 4);
+    fix->has_date = true;
+    return true;
+}
+
+static bool parse_position(char **fields, gnss_nmea_fix_t *fix) {
+    // An empty position is normal before the receiver has a fix.
+    if (!*fields[0] && !*fields[2]) {
+        return true;
+    }
+    int32_t latitude, longitude;
+    if (!parse_angle(fields[0], fields[1], &latitude) ||
+        !parse_angle(fields[2], fields[3], &longitude)) {
+        return false;
+    }
+    fix->latitude_e7 = latitude;
+    fix->longitude_e7 = longitude;
+    fix->has_position = true;
+    return true;
+}
+
+// GSA's reported 2D/3D mode takes priority; otherwise a fix is 3D when the
+// receiver reports an altitude with it.
+static void set_fix(gnss_nmea_fix_t *fix, bool valid, bool three_d) {
+    if (!valid) {
+        fix->fix = POSITIONFIX_INVALID;
+    } else if (fix->gsa_mode >= 2) {
+        fix->fix = fix->gsa_mode == 3 ? POSITIONFIX_3D : POSITIONFIX_2D;
+    } else {
+        fix->fix = three_d ? POSITIONFIX_3D : POSITIONFIX_2D;
+    }
+}
+
+// $--GGA,time,lat,N/S,lon,E/W,quality,satellites,hdop,altitude,M,...
+static bool parse_gga(char **fields, size_t n_fields, gnss_nmea_fix_t *fix) {
+    if (n_fields < 11) {
+        return false;
+    }
+    uint32_t quality = 0, satellites;
+    if (*fields[6] && !parse_uint(fields[6], &quality)) {
+        return false;
+    }
+    if (!parse_time(fields[1], fix)) {
+        return false;
+    }
+    if (*fields[7]) {
+        if (!parse_uint(fields[7], &satellites) || satellites > 255) {
+            return false;
+        }
+        fix->satellites = satellites;
+        fix->has_satellites = true;
+    }
+    if (quality == 0) {
+        set_fix(fix, false, false);
+        return true;
+    }
+    if (!parse_position(&fields[2], fix)) {
+        return false;
+    }
+    bool has_altitude = false;
+    if (*fields[9]) {
+        int64_t altitude_mm;
+        if (!parse_fixed(fields[9], 3, &altitude_mm) || altitude_mm > INT32_MAX || altitude_mm < INT32_MIN) {
+            return false;
+        }
+        fix->altitude_mm = altitude_mm;
+        fix->has_altitude = has_altitude = true;
+    }
+    set_fix(fix, true, has_altitude);
+    return true;
+}
+
+// RMC and GLL only say whether the fix is valid, so they never upgrade an
+// existing fix or downgrade a 3D one to 2D.
+static void set_fix_from_status(gnss_nmea_fix_t *fix, const char *status) {
+    bool valid = status[0] == 'A';
+    if (!valid || fix->fix == POSITIONFIX_INVALID) {
+        set_fix(fix, valid, false);
+    }
+}
+
+// $--GLL,lat,N/S,lon,E/W,time,status,...
+static bool parse_gll(char **fields, size_t n_fields, gnss_nmea_fix_t *fix) {
+    if (n_fields < 7) {
+        return false;
+    }
+    if (!parse_time(fields[5], fix)) {
+        return false;
+    }
+    if (fields[6][0] == 'A' && !parse_position(&fields[1], fix)) {
+        return false;
+    }
+    set_fix_from_status(fix, fields[6]);
+    return true;
+}
+
+// $--GSA,selection,mode,satellite ids...,pdop,hdop,vdop
+static bool parse_gsa(char **fields, size_t n_fields, gnss_nmea_fix_t *fix) {
+    uint32_t mode;
+    if (n_fields < 3 || !parse_uint(fields[2], &mode) || mode < 1 || mode > 3) {
+        return false;
+    }
+    fix->gsa_mode = mode;
+    set_fix(fix, mode != 1, mode == 3);
+    return true;
+}
+
+// $--RMC,time,status,lat,N/S,lon,E/W,speed,course,date,...
+static bool parse_rmc(char **fields, size_t n_fields, gnss_nmea_fix_t *fix) {
+    if (n_fields < 10) {
+        return false;
+    }
+    if (!parse_time(fields[1], fix) || !parse_date(fields[9], fix)) {
+        return false;
+    }
+    if (fields[2][0] == 'A' && !parse_position(&fields[3], fix)) {
+        return false;
+    }
+    set_fix_from_status(fix, fields[2]);
+    return true;
+}
+
+// Handles one complete sentence between "$" and the line ending. Returns true
+// if it was accepted and applied to the fix.
+static bool process_sentence(gnss_nmeaparser_obj_t *self) {
+    char *body = self->sentence;
+    char *star = strchr(body, '*');
+    if (star == NULL || star[1] == '\0' || star[2] == '\0' || star[3] != '\0') {
+        self->error_count++;
+        return false;
+    }
+    int high = hex_value(star[1]), low = hex_value(star[2]);
+    uint8_t checksum = 0;
+    for (char *p = body; p < star; p++) {
+        checksum ^= *p;
+    }
+    if (high < 0 || low < 0 || checksum != ((high << 4) | low)) {
+        self->error_count++;
+        return false;
+    }
+    *star = '\0';
+
+    // Talker ID then sentence type, e.g. "GPGGA" or "GNRMC". Proprietary
+    // sentences don't follow this layout and are skipped along with
+    // anything not in the filter.
+    char *type_end = strchr(body, ',');
+    if (type_end == NULL || type_end - body != 5 || body[0] == 'P') {
+        return false;
+    }
+    uint8_t type = shared_module_gnss_nmea_sentence_type(body + 2, 3);
+    if (!(type & self->sentence_mask)) {
+        return false;
+    }
+
+    char *fields[MAX_FIELDS];
+    size_t n_fields = 0;
+    for (char *p = body;;) {
+        if (n_fields == MAX_FIELDS) {
+            break;
+        }
+        fields[n_fields++] = p;
+        p = strchr(p, ',');
+        if (p == NULL) {
+            break;
+        }
+        *p++ = '\0';
+    }
+
+    // Parse into a copy so a malformed sentence can't leave a half-updated fix.
+    gnss_nmea_fix_t fix = self->fix;
+    bool ok;
+    switch (type) {
+        case GNSS_NMEA_GGA:
+            ok = parse_gga(fields, n_fields, &fix);
+            break;
+        case GNSS_NMEA_GLL:
+            ok = parse_gll(fields, n_fields, &fix);
+            break;
+        case GNSS_NMEA_GSA:
+            ok = parse_gsa(fields, n_fields, &fix);
+            break;
+        case GNSS_NMEA_RMC:
+        default:
+            ok = parse_rmc(fields, n_fields, &fix);
+            break;
+    }
+    if (!ok) {
+        self->error_count++;
+        return false;
+    }
+    self->fix = fix;
+    self->sentence_count++;
+    return true;
+}
+
+size_t common_hal_gnss_nmeaparser_feed(gnss_nmeaparser_obj_t *self, const uint8_t *data, size_t len) {
+    size_t accepted = 0;
+    for (size_t i = 0; i < len; i++) {
+        char c = data[i];
+        if (c == '$') {
+            self->in_sentence = true;
+            self->sentence_len = 0;
+            continue;
+        }
+        if (!self->in_sentence) {
+            continue;
+        }
+        if (c == '\r' || c == '\n') {
+            self->in_sentence = false;
+            self->sentence[self->sentence_len] = '\0';
+            if (process_sentence(self)) {
+                accepted++;
+            }
+            continue;
+        }
+        // Overlong sentences and binary data (e.g. interleaved UBX frames)
+        // abandon the sentence in progress.
+        if (c < ' ' || c > '~' || self->sentence_len == GNSS_NMEA_MAX_SENTENCE_LENGTH) {
+            self->in_sentence = false;
+            self->error_count++;
+            continue;
+        }
+        self->sentence[self->sentence_len++] = c;
+    }
+    return accepted;
+}
+
+size_t common_hal_gnss_nmeaparser_update(gnss_nmeaparser_obj_t *self) {
+    if (self->stream == mp_const_none) {
+        return 0;
+    }
+    const mp_stream_p_t *stream_p = mp_get_stream(self->stream);
+    size_t accepted = 0;
+    uint8_t buf[1];
+    int errcode;
+    // Only read what the stream says is already buffered, so update() never
+    // waits for the UART timeout.
+    while (true) {
+        mp_uint_t ret = stream_p->ioctl(self->stream, MP_STREAM_POLL, MP_STREAM_POLL_RD, &errcode);
+        if (ret == MP_STREAM_ERROR) {
+            mp_raise_OSError(errcode);
+        }
+        if (!(ret & MP_STREAM_POLL_RD)) {
+            break;
+        }
+        ret = stream_p->read(self->stream, buf, sizeof(buf), &errcode);
+        if (ret == MP_STREAM_ERROR) {
+            if (mp_is_nonblocking_error(errcode)) {
+                break;
+            }
+            mp_raise_OSError(errcode);
+        }
+        if (ret == 0) {
+            break;
+        }
+        accepted += common_hal_gnss_nmeaparser_feed(self, buf, ret);
+    }
+    return accepted;
+}
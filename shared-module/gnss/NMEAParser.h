@@ -0,0 +1,62 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 CircuitPython contributors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+#include "shared-bindings/gnss/PositionFix.h"
+
+// NMEA 0183 limits a sentence to 82 characters including "$" and CR LF.
+#define GNSS_NMEA_MAX_SENTENCE_LENGTH (82)
+
+// Sentence types the parser understands, used as the filter mask.
+enum {
+    GNSS_NMEA_GGA = (1 << 0),
+    GNSS_NMEA_GLL = (1 << 1),
+    GNSS_NMEA_GSA = (1 << 2),
+    GNSS_NMEA_RMC = (1 << 3),
+    GNSS_NMEA_ALL = (1 << 4) - 1,
+};
+
+// The most recent fix, updated in place as sentences arrive. Angles are in
+// units of 1e-7 degrees so that they keep full precision on ports whose
+// mp_float_t is single precision.
+typedef struct {
+    int32_t latitude_e7;
+    int32_t longitude_e7;
+    int32_t altitude_mm;
+    uint16_t year;
+    uint8_t month;
+    uint8_t day;
+    uint8_t hour;
+    uint8_t minute;
+    uint8_t second;
+    uint8_t satellites;
+    gnss_positionfix_t fix;
+    // Fix type reported by GSA, or 0 if none has been seen.
+    uint8_t gsa_mode;
+    bool has_position : 1;
+    bool has_altitude : 1;
+    bool has_time : 1;
+    bool has_date : 1;
+    bool has_satellites : 1;
+} gnss_nmea_fix_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    // Optional byte stream (usually a busio.UART) drained by update().
+    mp_obj_t stream;
+    uint32_t sentence_count;
+    uint32_t error_count;
+    gnss_nmea_fix_t fix;
+    uint8_t sentence_mask;
+    uint8_t sentence_len;
+    bool in_sentence;
+    char sentence[GNSS_NMEA_MAX_SENTENCE_LENGTH + 1];
+} gnss_nmeaparser_obj_t;
+
+// Returns the GNSS_NMEA_* bit for a three letter sentence type, or 0.
+uint8_t shared_module_gnss_nmea_sentence_type(const char *type, size_t len);
@@ -7,11 +7,15 @@
 #pragma once
 
 #include "mbedtls/sha1.h"
+#include "mbedtls/sha256.h"
 
+// The hashes come from mbedtls, so a port whose mbedtls config turns on MBEDTLS_SHA1_ALT or
+// MBEDTLS_SHA256_ALT for its crypto hardware speeds up hashlib as well as ssl.
 typedef struct {
     mp_obj_base_t base;
     union {
         mbedtls_sha1_context sha1;
+        mbedtls_sha256_context sha256;
     };
     // Of MBEDTLS_SSL_HASH_*
     uint8_t hash_type;
@@ -52,6 +52,10 @@ static void check_jresult(JRESULT j) {
     mp_raise_RuntimeError(msg);
 }
 
+MP_WEAK bool jpegio_jpegdecoder_port_decode(jpegio_jpegdecoder_obj_t *self, const uint8_t *data, size_t len, int scale) {
+    return false;
+}
+
 void common_hal_jpegio_jpegdecoder_construct(jpegio_jpegdecoder_obj_t *self) {
     self->data_obj = MP_OBJ_NULL;
 }
@@ -59,6 +63,7 @@ void common_hal_jpegio_jpegdecoder_construct(jpegio_jpegdecoder_obj_t *self) {
 void common_hal_jpegio_jpegdecoder_close(jpegio_jpegdecoder_obj_t *self) {
     self->data_obj = MP_OBJ_NULL;
     memset(&self->bufinfo, 0, sizeof(self->bufinfo));
+    memset(&self->source, 0, sizeof(self->source));
 }
 
 static mp_obj_t common_hal_jpegio_jpegdecoder_decode_common(jpegio_jpegdecoder_obj_t *self, input_func fun) {
@@ -102,6 +107,7 @@ static size_t file_input(JDEC *jd, uint8_t *dest, size_t len) {
 
 mp_obj_t common_hal_jpegio_jpegdecoder_set_source_file(jpegio_jpegdecoder_obj_t *self, mp_obj_t file_obj) {
     self->data_obj = file_obj;
+    memset(&self->source, 0, sizeof(self->source));
     return common_hal_jpegio_jpegdecoder_decode_common(self, file_input);
 }
 
@@ -120,14 +126,14 @@ static size_t buffer_input(JDEC *jd, uint8_t *dest, size_t len) {
 mp_obj_t common_hal_jpegio_jpegdecoder_set_source_buffer(jpegio_jpegdecoder_obj_t *self, mp_obj_t buffer_obj) {
     self->data_obj = buffer_obj;
     mp_get_buffer_raise(buffer_obj, &self->bufinfo, MP_BUFFER_READ);
+    self->source = self->bufinfo;
     return common_hal_jpegio_jpegdecoder_decode_common(self, buffer_input);
 }
 
 #define DECODER_CONTINUE (1)
 #define DECODER_INTERRUPT (0)
-static int bitmap_output(JDEC *jd, void *data, JRECT *rect) {
-    jpegio_jpegdecoder_obj_t *self = CONTAINER_OF(jd, jpegio_jpegdecoder_obj_t, decoder);
-    int src_width = rect->right - rect->left + 1, src_pixel_stride = src_width /* in units of pixels! */, src_height = rect->bottom - rect->top + 1;
+int jpegio_jpegdecoder_output_block(jpegio_jpegdecoder_obj_t *self, void *data, int src_pixel_stride, JRECT *rect) {
+    int src_width = rect->right - rect->left + 1, src_height = rect->bottom - rect->top + 1;
 
     displayio_bitmap_t src = {
         .width = src_width,
@@ -182,7 +188,12 @@ static int bitmap_output(JDEC *jd, void *data, JRECT *rect) {
     assert(y2 <= src_height);
 
     common_hal_bitmaptools_blit(self->dest, &src, x, y, x1, y1, x2, y2, self->skip_source_index, self->skip_source_index_none, self->skip_dest_index, self->skip_dest_index_none);
-    return 1;
+    return DECODER_CONTINUE;
+}
+
+static int bitmap_output(JDEC *jd, void *data, JRECT *rect) {
+    jpegio_jpegdecoder_obj_t *self = CONTAINER_OF(jd, jpegio_jpegdecoder_obj_t, decoder);
+    return jpegio_jpegdecoder_output_block(self, data, rect->right - rect->left + 1, rect);
 }
 
 void common_hal_jpegio_jpegdecoder_decode_into(
@@ -204,6 +215,25 @@ void common_hal_jpegio_jpegdecoder_decode_into(
     self->skip_dest_index_none = skip_dest_index_none;
 
     self->dest = bitmap;
+
+    // Only the part of the source that lands in the bitmap needs IDCT and color conversion,
+    // in scaled coordinates as used by bitmap_output.
+    int roi_x2 = MIN(lim->x2, lim->x1 + bitmap->width - x);
+    int roi_y2 = MIN(lim->y2, lim->y1 + bitmap->height - y);
+    if (roi_x2 <= lim->x1 || roi_y2 <= lim->y1) {
+        common_hal_jpegio_jpegdecoder_close(self);
+        return;
+    }
+    self->decoder.roi.left = lim->x1;
+    self->decoder.roi.top = lim->y1;
+    self->decoder.roi.right = roi_x2 - 1;
+    self->decoder.roi.bottom = roi_y2 - 1;
+
+    if (self->source.buf != NULL && jpegio_jpegdecoder_port_decode(self, self->source.buf, self->source.len, scale)) {
+        common_hal_jpegio_jpegdecoder_close(self);
+        return;
+    }
+
     JRESULT result = jd_decomp(&self->decoder, bitmap_output, scale);
     common_hal_jpegio_jpegdecoder_close(self);
     if (result != JDR_INTR) {
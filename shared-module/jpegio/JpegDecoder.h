@@ -18,6 +18,7 @@ typedef struct jpegio_jpegdecoder_obj {
     byte workspace[TJPGD_WORKSPACE_SIZE];
     mp_obj_t data_obj;
     mp_buffer_info_t bufinfo;
+    mp_buffer_info_t source; // the whole buffer passed to open(), for port decoders
     displayio_bitmap_t *dest;
     uint16_t x, y;
     bitmaptools_rect_t lim;
@@ -25,3 +26,14 @@ typedef struct jpegio_jpegdecoder_obj {
     bool skip_source_index_none, skip_dest_index_none;
     uint8_t scale;
 } jpegio_jpegdecoder_obj_t;
+
+// Blits one block of decoded RGB565 pixels covering `rect` of the (scaled) image into the
+// destination, honoring the decode region and skip indices. Returns 0 once no later block can
+// land in the region, 1 otherwise.
+int jpegio_jpegdecoder_output_block(jpegio_jpegdecoder_obj_t *self, void *data, int src_pixel_stride, JRECT *rect);
+
+// Ports with a JPEG codec can override this to decode a buffer source in hardware. It is
+// called after the header has been parsed and the destination and region have been stored in
+// `self`, and should pass its output to jpegio_jpegdecoder_output_block. Return false to fall
+// back to the software decoder, e.g. for a scale the hardware can't do or a format it rejects.
+bool jpegio_jpegdecoder_port_decode(jpegio_jpegdecoder_obj_t *self, const uint8_t *data, size_t len, int scale);
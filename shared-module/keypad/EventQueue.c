@@ -4,6 +4,7 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include "py/binary.h"
 #include "shared-bindings/keypad/Event.h"
 #include "shared-bindings/keypad/EventQueue.h"
 #include "shared-bindings/supervisor/__init__.h"
@@ -13,28 +14,69 @@
 #define EVENT_PRESSED (1 << 15)
 #define EVENT_KEY_NUM_MASK ((1 << 15) - 1)
 
-#define EVENT_SIZE_BYTES (sizeof(uint16_t) + sizeof(mp_obj_t))
-
 void common_hal_keypad_eventqueue_construct(keypad_eventqueue_obj_t *self, size_t max_events) {
-    // Event queue is 16-bit values.
-    ringbuf_alloc(&self->encoded_events, max_events * EVENT_SIZE_BYTES);
+    self->slots = max_events + 1;
+    self->events = m_malloc(self->slots * sizeof(keypad_eventqueue_entry_t));
+    self->next_read = 0;
+    self->next_write = 0;
     self->overflowed = false;
     self->event_handler = NULL;
 }
 
+static inline size_t next_slot(keypad_eventqueue_obj_t *self, size_t slot) {
+    slot++;
+    return slot == self->slots ? 0 : slot;
+}
+
+// Consumer side. Returns NULL if the queue is empty. The entry stays valid until
+// release_entry() hands the slot back to the producer.
+static const keypad_eventqueue_entry_t *peek_entry(keypad_eventqueue_obj_t *self) {
+    size_t next_read = self->next_read;
+    if (next_read == __atomic_load_n(&self->next_write, __ATOMIC_ACQUIRE)) {
+        return NULL;
+    }
+    return &self->events[next_read];
+}
+
+static void release_entry(keypad_eventqueue_obj_t *self) {
+    __atomic_store_n(&self->next_read, next_slot(self, self->next_read), __ATOMIC_RELEASE);
+}
+
 bool common_hal_keypad_eventqueue_get_into(keypad_eventqueue_obj_t *self, keypad_event_obj_t *event) {
-    int encoded_event = ringbuf_get16(&self->encoded_events);
-    if (encoded_event == -1) {
+    const keypad_eventqueue_entry_t *entry = peek_entry(self);
+    if (entry == NULL) {
         return false;
     }
 
-    mp_obj_t ticks;
-    ringbuf_get_n(&self->encoded_events, (uint8_t *)&ticks, sizeof(ticks));
+    uint16_t encoded_event = entry->encoded_event;
+    mp_obj_t ticks = entry->timestamp;
+    release_entry(self);
     // "Construct" using the existing event.
     common_hal_keypad_event_construct(event, encoded_event & EVENT_KEY_NUM_MASK, encoded_event & EVENT_PRESSED, ticks);
     return true;
 }
 
+size_t common_hal_keypad_eventqueue_get_many_into(keypad_eventqueue_obj_t *self, size_t max_events,
+    mp_buffer_info_t *key_numbers, mp_buffer_info_t *pressed, mp_buffer_info_t *timestamps) {
+    size_t count = 0;
+    const keypad_eventqueue_entry_t *entry;
+    while (count < max_events && (entry = peek_entry(self)) != NULL) {
+        mp_binary_set_val_array_from_int(key_numbers->typecode, key_numbers->buf, count,
+            entry->encoded_event & EVENT_KEY_NUM_MASK);
+        if (pressed) {
+            mp_binary_set_val_array_from_int(pressed->typecode, pressed->buf, count,
+                (entry->encoded_event & EVENT_PRESSED) != 0);
+        }
+        if (timestamps) {
+            mp_binary_set_val_array_from_int(timestamps->typecode, timestamps->buf, count,
+                mp_obj_get_int(entry->timestamp));
+        }
+        release_entry(self);
+        count++;
+    }
+    return count;
+}
+
 mp_obj_t common_hal_keypad_eventqueue_get(keypad_eventqueue_obj_t *self) {
     keypad_event_obj_t *event = mp_obj_malloc(keypad_event_obj_t, &keypad_event_type);
     bool result = common_hal_keypad_eventqueue_get_into(self, event);
@@ -60,12 +102,15 @@ void common_hal_keypad_eventqueue_set_overflowed(keypad_eventqueue_obj_t *self,
 }
 
 void common_hal_keypad_eventqueue_clear(keypad_eventqueue_obj_t *self) {
-    ringbuf_clear(&self->encoded_events);
+    // Only the consumer moves next_read, so this is safe against a concurrent record.
+    __atomic_store_n(&self->next_read, __atomic_load_n(&self->next_write, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
     common_hal_keypad_eventqueue_set_overflowed(self, false);
 }
 
 size_t common_hal_keypad_eventqueue_get_length(keypad_eventqueue_obj_t *self) {
-    return ringbuf_num_filled(&self->encoded_events) / EVENT_SIZE_BYTES;
+    size_t next_write = __atomic_load_n(&self->next_write, __ATOMIC_ACQUIRE);
+    size_t next_read = __atomic_load_n(&self->next_read, __ATOMIC_ACQUIRE);
+    return next_write >= next_read ? next_write - next_read : self->slots - next_read + next_write;
 }
 
 void common_hal_keypad_eventqueue_set_event_handler(keypad_eventqueue_obj_t *self, void (*event_handler)(keypad_eventqueue_obj_t *)) {
@@ -73,7 +118,9 @@ void common_hal_keypad_eventqueue_set_event_handler(keypad_eventqueue_obj_t *sel
 }
 
 bool keypad_eventqueue_record(keypad_eventqueue_obj_t *self, mp_uint_t key_number, bool pressed, mp_obj_t timestamp) {
-    if (ringbuf_num_empty(&self->encoded_events) == 0) {
+    size_t next_write = self->next_write;
+    size_t following = next_slot(self, next_write);
+    if (following == __atomic_load_n(&self->next_read, __ATOMIC_ACQUIRE)) {
         // Queue is full. Set the overflow flag. The caller will decide what else to do.
         common_hal_keypad_eventqueue_set_overflowed(self, true);
         return false;
@@ -83,8 +130,11 @@ bool keypad_eventqueue_record(keypad_eventqueue_obj_t *self, mp_uint_t key_numbe
     if (pressed) {
         encoded_event |= EVENT_PRESSED;
     }
-    ringbuf_put16(&self->encoded_events, encoded_event);
-    ringbuf_put_n(&self->encoded_events, (uint8_t *)&timestamp, sizeof(mp_obj_t));
+    keypad_eventqueue_entry_t *entry = &self->events[next_write];
+    entry->encoded_event = encoded_event;
+    entry->timestamp = timestamp;
+    // Publish the entry only after it is completely written.
+    __atomic_store_n(&self->next_write, following, __ATOMIC_RELEASE);
 
     if (self->event_handler) {
         self->event_handler(self);
@@ -7,13 +7,25 @@
 #pragma once
 
 #include "py/obj.h"
-#include "py/ringbuf.h"
 
 typedef struct _keypad_eventqueue_obj_t keypad_eventqueue_obj_t;
 
+typedef struct {
+    mp_obj_t timestamp;
+    // Key number is lower 15 bits; bit 15 is set for a press.
+    uint16_t encoded_event;
+} keypad_eventqueue_entry_t;
+
+// Single-producer, single-consumer queue. The background scan is the only
+// writer of next_write and the VM is the only writer of next_read, so neither
+// side needs to lock the other out.
 struct _keypad_eventqueue_obj_t {
     mp_obj_base_t base;
-    ringbuf_t encoded_events;
+    keypad_eventqueue_entry_t *events;
+    // One more than max_events, so that a full queue is distinguishable from an empty one.
+    size_t slots;
+    size_t next_read;
+    size_t next_write;
     bool overflowed;
     void (*event_handler)(keypad_eventqueue_obj_t *);
 };
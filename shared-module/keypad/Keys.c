@@ -18,10 +18,12 @@
 
 static void keypad_keys_scan_now(void *self_in, mp_obj_t timestamp);
 static size_t keys_get_key_count(void *self_in);
+static void keys_deregister(void *self_in);
 
 static keypad_scanner_funcs_t keys_funcs = {
     .scan_now = keypad_keys_scan_now,
     .get_key_count = keys_get_key_count,
+    .deregister = keys_deregister,
 };
 
 void common_hal_keypad_keys_construct(keypad_keys_obj_t *self, mp_uint_t num_pins, const mcu_pin_obj_t *pins[], bool value_when_pressed, bool pull, mp_float_t interval, size_t max_events, uint8_t debounce_threshold) {
@@ -61,6 +63,19 @@ void common_hal_keypad_keys_deinit(keypad_keys_obj_t *self) {
     common_hal_keypad_deinit_core(self);
 }
 
+static void keys_deregister(void *self_in) {
+    keypad_keys_obj_t *self = self_in;
+    common_hal_keypad_keys_disable_wakeup(self);
+    self->sleeping = false;
+}
+
+MP_WEAK bool common_hal_keypad_keys_enable_wakeup(keypad_keys_obj_t *self) {
+    return false;
+}
+
+MP_WEAK void common_hal_keypad_keys_disable_wakeup(keypad_keys_obj_t *self) {
+}
+
 size_t keys_get_key_count(void *self_in) {
     keypad_keys_obj_t *self = self_in;
     return self->digitalinouts->len;
@@ -81,4 +96,13 @@ static void keypad_keys_scan_now(void *self_in, mp_obj_t timestamp) {
             keypad_eventqueue_record(self->events, key_number, current, timestamp);
         }
     }
+
+    // Once nothing is pressed, stop scanning until a pin interrupt says something is.
+    if (keypad_all_released((keypad_scanner_obj_t *)self)) {
+        // Sleep first so that an interrupt that fires right away isn't lost.
+        self->sleeping = true;
+        if (!common_hal_keypad_keys_enable_wakeup(self)) {
+            self->sleeping = false;
+        }
+    }
 }
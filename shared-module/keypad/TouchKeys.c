@@ -0,0 +1,134 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 CircuitPython contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/runtime.h"
+
+#if CIRCUITPY_KEYPAD_TOUCHKEYS
+#include "shared-bindings/keypad/EventQueue.h"
+#include "shared-bindings/keypad/TouchKeys.h"
+#include "shared-bindings/keypad/__init__.h"
+#include "shared-bindings/touchio/TouchIn.h"
+
+#define TOUCHKEYS_SCALE_BITS (4)
+// The reading filter moves 1/4 of the way to each new reading.
+#define TOUCHKEYS_FILTER_BITS (2)
+// An untouched baseline creeps up 1/64 of the way per scan, so a slow touch
+// isn't absorbed, but recovers quickly when readings fall below it.
+#define TOUCHKEYS_BASELINE_RISE_BITS (6)
+#define TOUCHKEYS_BASELINE_FALL_BITS (3)
+
+static void keypad_touchkeys_scan_now(void *self_in, mp_obj_t timestamp);
+static size_t touchkeys_get_key_count(void *self_in);
+
+static keypad_scanner_funcs_t touchkeys_funcs = {
+    .scan_now = keypad_touchkeys_scan_now,
+    .get_key_count = touchkeys_get_key_count,
+};
+
+void common_hal_keypad_touchkeys_construct(keypad_touchkeys_obj_t *self, mp_uint_t num_pins, const mcu_pin_obj_t *pins[], digitalio_pull_t pull, uint16_t threshold, mp_float_t interval, size_t max_events, uint8_t debounce_threshold) {
+    mp_obj_t touchins[num_pins];
+    self->pads = m_malloc(num_pins * sizeof(keypad_touchkeys_pad_t));
+
+    for (size_t i = 0; i < num_pins; i++) {
+        touchio_touchin_obj_t *touchin = mp_obj_malloc(touchio_touchin_obj_t, &touchio_touchin_type);
+        common_hal_touchio_touchin_construct(touchin, pins[i], pull);
+        touchins[i] = touchin;
+
+        uint16_t raw = common_hal_touchio_touchin_get_raw_value(touchin);
+        keypad_touchkeys_pad_t *pad = &self->pads[i];
+        pad->baseline = (uint32_t)raw << TOUCHKEYS_SCALE_BITS;
+        pad->filtered = pad->baseline;
+        if (threshold != 0) {
+            pad->threshold = threshold;
+        } else {
+            uint16_t touchin_threshold = common_hal_touchio_touchin_get_threshold(touchin);
+            pad->threshold = touchin_threshold > raw ? touchin_threshold - raw : 1;
+        }
+    }
+
+    self->touchins = mp_obj_new_tuple(num_pins, touchins);
+    self->timestamp = mp_const_none;
+    self->funcs = &touchkeys_funcs;
+
+    keypad_construct_common((keypad_scanner_obj_t *)self, interval, max_events, debounce_threshold);
+}
+
+void common_hal_keypad_touchkeys_deinit(keypad_touchkeys_obj_t *self) {
+    if (common_hal_keypad_deinited(self)) {
+        return;
+    }
+
+    // Remove self from the list of active keypad scanners first.
+    keypad_deregister_scanner((keypad_scanner_obj_t *)self);
+
+    for (size_t key = 0; key < touchkeys_get_key_count(self); key++) {
+        common_hal_touchio_touchin_deinit(self->touchins->items[key]);
+    }
+    self->touchins = MP_ROM_NONE;
+    self->pads = NULL;
+
+    common_hal_keypad_deinit_core(self);
+}
+
+static size_t touchkeys_get_key_count(void *self_in) {
+    keypad_touchkeys_obj_t *self = self_in;
+    return self->touchins->len;
+}
+
+uint16_t common_hal_keypad_touchkeys_get_raw_value(keypad_touchkeys_obj_t *self, size_t key_number) {
+    return self->pads[key_number].filtered >> TOUCHKEYS_SCALE_BITS;
+}
+
+uint16_t common_hal_keypad_touchkeys_get_baseline(keypad_touchkeys_obj_t *self, size_t key_number) {
+    return self->pads[key_number].baseline >> TOUCHKEYS_SCALE_BITS;
+}
+
+static void touchkeys_scan(void *self_in) {
+    keypad_touchkeys_obj_t *self = self_in;
+    // Deinited while the scan was queued.
+    if (common_hal_keypad_deinited(self)) {
+        return;
+    }
+
+    size_t key_count = touchkeys_get_key_count(self);
+    for (mp_uint_t key_number = 0; key_number < key_count; key_number++) {
+        keypad_touchkeys_pad_t *pad = &self->pads[key_number];
+        uint32_t raw = (uint32_t)common_hal_touchio_touchin_get_raw_value(self->touchins->items[key_number]) << TOUCHKEYS_SCALE_BITS;
+        pad->filtered = pad->filtered - (pad->filtered >> TOUCHKEYS_FILTER_BITS) + (raw >> TOUCHKEYS_FILTER_BITS);
+
+        // Release at half the press threshold so a reading hovering at the
+        // threshold doesn't chatter.
+        bool was_pressed = self->debounce_counter[key_number] > 0;
+        uint32_t threshold = (uint32_t)pad->threshold << TOUCHKEYS_SCALE_BITS;
+        if (was_pressed) {
+            threshold /= 2;
+        }
+        const bool current = pad->filtered > pad->baseline + threshold;
+
+        if (!current) {
+            if (pad->filtered > pad->baseline) {
+                pad->baseline += (pad->filtered - pad->baseline) >> TOUCHKEYS_BASELINE_RISE_BITS;
+            } else {
+                pad->baseline -= (pad->baseline - pad->filtered) >> TOUCHKEYS_BASELINE_FALL_BITS;
+            }
+        }
+
+        // Record any transitions.
+        if (keypad_debounce((keypad_scanner_obj_t *)self, key_number, current)) {
+            keypad_eventqueue_record(self->events, key_number, current, self->timestamp);
+        }
+    }
+}
+
+static void keypad_touchkeys_scan_now(void *self_in, mp_obj_t timestamp) {
+    keypad_touchkeys_obj_t *self = self_in;
+    // This may be called from the tick interrupt, which is no place to wait
+    // for pads to charge.
+    self->timestamp = timestamp;
+    background_callback_add(&self->callback, touchkeys_scan, self);
+}
+
+#endif // CIRCUITPY_KEYPAD_TOUCHKEYS
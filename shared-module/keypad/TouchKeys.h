@@ -0,0 +1,33 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 CircuitPython contributors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+#include "py/objtuple.h"
+
+#include "shared-module/keypad/__init__.h"
+#include "shared-module/keypad/EventQueue.h"
+#include "supervisor/background_callback.h"
+
+// Filter state for one pad. baseline and filtered are raw readings scaled by
+// TOUCHKEYS_SCALE so that slow baseline drift isn't lost to rounding.
+typedef struct {
+    uint32_t baseline;
+    uint32_t filtered;
+    // How far above the baseline a reading must be to count as touched.
+    uint16_t threshold;
+} keypad_touchkeys_pad_t;
+
+typedef struct {
+    KEYPAD_SCANNER_COMMON_FIELDS;
+    mp_obj_tuple_t *touchins;
+    keypad_touchkeys_pad_t *pads;
+    // Touch measurements can take a while, so the tick only queues this and
+    // the pads are read from the background.
+    background_callback_t callback;
+    mp_obj_t timestamp;
+} keypad_touchkeys_obj_t;
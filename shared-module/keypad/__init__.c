@@ -37,6 +37,25 @@ void keypad_tick(void) {
     }
 }
 
+uint32_t keypad_ticks_until_scan(void) {
+    if (!supervisor_try_lock(&keypad_scanners_linked_list_lock)) {
+        return 0;
+    }
+    uint64_t now = port_get_raw_ticks(NULL);
+    uint32_t ticks = UINT32_MAX;
+    keypad_scanner_obj_t *scanner = MP_STATE_VM(keypad_scanners_linked_list);
+    while (scanner) {
+        // Sleeping scanners are woken by an interrupt, which ends the idle anyway.
+        if (!scanner->sleeping) {
+            uint64_t next = scanner->next_scan_ticks;
+            ticks = MIN(ticks, next > now ? (uint32_t)MIN(next - now, UINT32_MAX - 1) : 0);
+        }
+        scanner = scanner->next;
+    }
+    supervisor_release_lock(&keypad_scanners_linked_list_lock);
+    return ticks;
+}
+
 void keypad_reset(void) {
     keypad_scanner_obj_t *scanner = MP_STATE_VM(keypad_scanners_linked_list);
     keypad_scanner_obj_t *next = MP_STATE_VM(keypad_scanners_linked_list);
@@ -57,13 +76,17 @@ void keypad_register_scanner(keypad_scanner_obj_t *scanner) {
     supervisor_release_lock(&keypad_scanners_linked_list_lock);
 
     // One more request for ticks.
-    supervisor_enable_tick();
+    supervisor_enable_tickless();
 }
 
 // Remove scanner from the list of active scanners.
 void keypad_deregister_scanner(keypad_scanner_obj_t *scanner) {
+    if (scanner->funcs->deregister) {
+        scanner->funcs->deregister(scanner);
+    }
+
     // One less request for ticks.
-    supervisor_disable_tick();
+    supervisor_disable_tickless();
 
     supervisor_acquire_lock(&keypad_scanners_linked_list_lock);
     if (MP_STATE_VM(keypad_scanners_linked_list) == scanner) {
@@ -98,6 +121,7 @@ void keypad_construct_common(keypad_scanner_obj_t *self, mp_float_t interval, si
     self->debounce_threshold = debounce_threshold;
 
     self->never_reset = false;
+    self->sleeping = false;
 
     // Add self to the list of active keypad scanners.
     keypad_register_scanner(self);
@@ -110,12 +134,26 @@ static void keypad_scan_now(keypad_scanner_obj_t *self, uint64_t now) {
 }
 
 static void keypad_scan_maybe(keypad_scanner_obj_t *self, uint64_t now) {
-    if (now < self->next_scan_ticks) {
+    if (self->sleeping || now < self->next_scan_ticks) {
         return;
     }
     keypad_scan_now(self, now);
 }
 
+void keypad_wake(keypad_scanner_obj_t *self) {
+    self->sleeping = false;
+}
+
+bool keypad_all_released(keypad_scanner_obj_t *self) {
+    size_t key_count = common_hal_keypad_generic_get_key_count(self);
+    for (size_t i = 0; i < key_count; i++) {
+        if (self->debounce_counter[i] != -self->debounce_threshold) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool keypad_debounce(keypad_scanner_obj_t *self, mp_uint_t key_number, bool current) {
     if (current) {
         if ((self->debounce_counter[key_number] < self->debounce_threshold) &&
@@ -141,6 +179,7 @@ void common_hal_keypad_generic_reset(void *self_in) {
     keypad_scanner_obj_t *self = self_in;
     size_t key_count = common_hal_keypad_generic_get_key_count(self);
     memset(self->debounce_counter, -self->debounce_threshold, key_count);
+    self->sleeping = false;
     keypad_scan_now(self, port_get_raw_ticks(NULL));
 }
 
@@ -12,6 +12,8 @@
 typedef struct _keypad_scanner_funcs_t {
     void (*scan_now)(void *self_in, mp_obj_t timestamp);
     size_t (*get_key_count)(void *self_in);
+    // Optional. Called when the scanner stops being scanned.
+    void (*deregister)(void *self_in);
 } keypad_scanner_funcs_t;
 
 // All scanners must begin with these common fields.
@@ -26,7 +28,9 @@ typedef struct _keypad_scanner_funcs_t {
     struct _keypad_eventqueue_obj_t *events; \
     mp_uint_t interval_ticks; \
     uint8_t debounce_threshold; \
-    bool never_reset
+    bool never_reset; \
+    /* Not scanned until keypad_wake(), such as from a pin interrupt. */ \
+    volatile bool sleeping
 
 typedef struct _keypad_scanner_obj_t {
     KEYPAD_SCANNER_COMMON_FIELDS;
@@ -35,12 +39,18 @@ typedef struct _keypad_scanner_obj_t {
 extern supervisor_lock_t keypad_scanners_linked_list_lock;
 
 void keypad_tick(void);
+// Ticks until a scanner is next due, for tickless idle.
+uint32_t keypad_ticks_until_scan(void);
 void keypad_reset(void);
 
 void keypad_register_scanner(keypad_scanner_obj_t *scanner);
 void keypad_deregister_scanner(keypad_scanner_obj_t *scanner);
 void keypad_construct_common(keypad_scanner_obj_t *scanner, mp_float_t interval, size_t max_events, uint8_t debounce_cycles);
 bool keypad_debounce(keypad_scanner_obj_t *self, mp_uint_t key_number, bool current);
+// Whether every key has settled as released.
+bool keypad_all_released(keypad_scanner_obj_t *self);
+// Scan a sleeping scanner again. Safe to call from an interrupt.
+void keypad_wake(keypad_scanner_obj_t *self);
 void keypad_never_reset(keypad_scanner_obj_t *self);
 
 size_t common_hal_keypad_generic_get_key_count(void *scanner);
@@ -48,7 +48,8 @@ static inline void free_memory(lvfontio_ondiskfont_t *self, void *ptr) {
 
 // Forward declarations for helper functions
 static int16_t find_codepoint_slot(lvfontio_ondiskfont_t *self, uint32_t codepoint);
-static uint16_t find_free_slot(lvfontio_ondiskfont_t *self, uint32_t codepoint);
+static uint16_t find_free_slot(lvfontio_ondiskfont_t *self, uint32_t codepoint, uint16_t slots_needed);
+static void evict_slot(lvfontio_ondiskfont_t *self, uint16_t slot);
 static FRESULT read_bits(FIL *file, size_t num_bits, uint8_t *byte_val, uint8_t *remaining_bits, uint32_t *result);
 static FRESULT read_glyph_dimensions(FIL *file, lvfontio_ondiskfont_t *self, uint32_t *advance_width, int32_t *bbox_x, int32_t *bbox_y, uint32_t *bbox_w, uint32_t *bbox_h, uint8_t *byte_val, uint8_t *remaining_bits);
 
@@ -373,8 +374,16 @@ static bool load_glyph_bitmap(FIL *file, lvfontio_ondiskfont_t *self, uint32_t c
     self->codepoints[slot] = codepoint;
     self->reference_counts[slot] = 1;
 
-    // Read bitmap data pixel by pixel
+    // Clear anything left behind by the glyph that used to be here.
     uint16_t x_offset = slot * self->header.default_advance_width;
+    uint16_t slot_width = self->header.default_advance_width * (glyph_advance > self->half_width_px ? 2 : 1);
+    for (uint16_t y = 0; y < self->header.font_size; y++) {
+        for (uint16_t x = x_offset; x < x_offset + slot_width && x < self->bitmap->width; x++) {
+            common_hal_displayio_bitmap_set_pixel(self->bitmap, x, y, 0);
+        }
+    }
+
+    // Read bitmap data pixel by pixel
     uint16_t y_offset = self->header.ascent - bbox_y - bbox_h;
     for (uint16_t y = 0; y < bbox_h; y++) {
         for (uint16_t x = 0; x < bbox_w; x++) {
@@ -419,6 +428,7 @@ void common_hal_lvfontio_ondiskfont_construct(lvfontio_ondiskfont_t *self,
     self->max_glyphs = max_glyphs;
     self->cmap_ranges = NULL;
     self->file_is_open = false;
+    self->use_counter = 0;
 
     // Determine which filesystem to use based on the path
     const char *path_under_mount;
@@ -444,7 +454,7 @@ void common_hal_lvfontio_ondiskfont_construct(lvfontio_ondiskfont_t *self,
     self->file_is_open = true;
 
     // Load font headers
-    size_t max_slots;
+    size_t max_slots = max_glyphs;
     if (!load_font_header(self, &self->file, &max_slots)) {
         f_close(&self->file);
         self->file_is_open = false;
@@ -456,6 +466,7 @@ void common_hal_lvfontio_ondiskfont_construct(lvfontio_ondiskfont_t *self,
     // Cap the number of slots to the number of slots needed by the font. That way
     // small font files don't need a bunch of extra cache space.
     max_glyphs = MIN(max_glyphs, max_slots);
+    self->max_glyphs = max_glyphs;
 
     // Allocate codepoints array. allocate_memory will raise an exception if
     // allocation fails and the VM is active.
@@ -478,6 +489,12 @@ void common_hal_lvfontio_ondiskfont_construct(lvfontio_ondiskfont_t *self,
     // Initialize reference counts to 0
     memset(self->reference_counts, 0, sizeof(uint16_t) * max_glyphs);
 
+    self->last_used = allocate_memory(self, sizeof(uint32_t) * max_glyphs);
+    if (self->last_used == NULL) {
+        return;
+    }
+    memset(self->last_used, 0, sizeof(uint32_t) * max_glyphs);
+
     self->half_width_px = self->header.default_advance_width;
 
     // Create bitmap for glyph cache
@@ -533,6 +550,11 @@ void common_hal_lvfontio_ondiskfont_deinit(lvfontio_ondiskfont_t *self) {
         self->reference_counts = NULL;
     }
 
+    if (self->last_used != NULL) {
+        free_memory(self, self->last_used);
+        self->last_used = NULL;
+    }
+
 
 
     if (self->cmap_ranges != NULL) {
@@ -575,6 +597,7 @@ int16_t common_hal_lvfontio_ondiskfont_cache_glyph(lvfontio_ondiskfont_t *self,
     if (existing_slot >= 0) {
         // Glyph is already cached, increment reference count
         self->reference_counts[existing_slot]++;
+        self->last_used[existing_slot] = ++self->use_counter;
 
         // Check if this is a full-width character by looking for a second slot
         // with the same codepoint right after this one
@@ -664,28 +687,16 @@ int16_t common_hal_lvfontio_ondiskfont_cache_glyph(lvfontio_ondiskfont_t *self,
     uint16_t slots_needed = is_full_width_glyph ? 2 : 1;
 
     // Find an appropriate slot (or consecutive slots for full-width)
-    uint16_t slot = UINT16_MAX;
-
-    if (slots_needed == 1) {
-        // For regular width, find a free slot starting at codepoint's position
-        slot = find_free_slot(self, codepoint);
-    } else {
-        // For full-width, find two consecutive free slots
-        for (uint16_t i = 0; i < self->max_glyphs - 1; i++) {
-            if (self->codepoints[i] == LVFONTIO_INVALID_CODEPOINT &&
-                self->reference_counts[i] == 0 &&
-                self->codepoints[i + 1] == LVFONTIO_INVALID_CODEPOINT &&
-                self->reference_counts[i + 1] == 0) {
-                slot = i;
-                break;
-            }
-        }
-    }
+    uint16_t slot = find_free_slot(self, codepoint, slots_needed);
 
     // Check if we found appropriate slot(s)
     if (slot == UINT16_MAX) {
         return -1; // No slots available
     }
+    for (uint16_t i = 0; i < slots_needed; i++) {
+        evict_slot(self, slot + i);
+        self->last_used[slot + i] = ++self->use_counter;
+    }
 
     // Load glyph into the slot
     if (!load_glyph_bitmap(&self->file, self, codepoint, slot, glyph_advance,
@@ -714,6 +725,20 @@ void common_hal_lvfontio_ondiskfont_release_glyph(lvfontio_ondiskfont_t *self, u
     if (self->reference_counts[slot] > 0) {
         self->reference_counts[slot]--;
     }
+    self->last_used[slot] = ++self->use_counter;
+}
+
+void common_hal_lvfontio_ondiskfont_preload_glyph(lvfontio_ondiskfont_t *self, uint32_t codepoint) {
+    bool is_full_width;
+    int16_t slot = common_hal_lvfontio_ondiskfont_cache_glyph(self, codepoint, &is_full_width);
+    if (slot < 0) {
+        return;
+    }
+    // Only keep it cached, nothing is displaying it yet.
+    common_hal_lvfontio_ondiskfont_release_glyph(self, slot);
+    if (is_full_width) {
+        common_hal_lvfontio_ondiskfont_release_glyph(self, slot + 1);
+    }
 }
 
 static int16_t find_codepoint_slot(lvfontio_ondiskfont_t *self, uint32_t codepoint) {
@@ -727,27 +752,78 @@ static int16_t find_codepoint_slot(lvfontio_ondiskfont_t *self, uint32_t codepoi
     return -1;
 }
 
-static uint16_t find_free_slot(lvfontio_ondiskfont_t *self, uint32_t codepoint) {
-    size_t offset = codepoint % self->max_glyphs;
+// A slot can only be reused when neither it nor the other half of a full-width glyph
+// stored in it is referenced.
+static bool slot_is_evictable(lvfontio_ondiskfont_t *self, uint16_t slot) {
+    if (self->reference_counts[slot] != 0) {
+        return false;
+    }
+    uint32_t codepoint = self->codepoints[slot];
+    if (codepoint == LVFONTIO_INVALID_CODEPOINT) {
+        return true;
+    }
+    if (slot > 0 && self->codepoints[slot - 1] == codepoint && self->reference_counts[slot - 1] != 0) {
+        return false;
+    }
+    if (slot + 1 < self->max_glyphs && self->codepoints[slot + 1] == codepoint && self->reference_counts[slot + 1] != 0) {
+        return false;
+    }
+    return true;
+}
+
+// Forget the glyph in a slot, including the other half of a full-width glyph so it isn't found
+// half overwritten.
+static void evict_slot(lvfontio_ondiskfont_t *self, uint16_t slot) {
+    uint32_t codepoint = self->codepoints[slot];
+    if (codepoint == LVFONTIO_INVALID_CODEPOINT) {
+        return;
+    }
+    if (slot > 0 && self->codepoints[slot - 1] == codepoint) {
+        self->codepoints[slot - 1] = LVFONTIO_INVALID_CODEPOINT;
+    }
+    if (slot + 1 < self->max_glyphs && self->codepoints[slot + 1] == codepoint) {
+        self->codepoints[slot + 1] = LVFONTIO_INVALID_CODEPOINT;
+    }
+    self->codepoints[slot] = LVFONTIO_INVALID_CODEPOINT;
+}
+
+static uint16_t find_free_slot(lvfontio_ondiskfont_t *self, uint32_t codepoint, uint16_t slots_needed) {
+    if (slots_needed > self->max_glyphs) {
+        return UINT16_MAX;
+    }
+    uint16_t slot_count = self->max_glyphs - slots_needed + 1;
+    size_t offset = codepoint % slot_count;
 
     // First look for completely unused slots, starting at the offset
-    for (uint16_t i = 0; i < self->max_glyphs; i++) {
-        int16_t slot = (i + offset) % self->max_glyphs;
-        if (self->codepoints[slot] == LVFONTIO_INVALID_CODEPOINT && self->reference_counts[slot] == 0) {
+    for (uint16_t i = 0; i < slot_count; i++) {
+        uint16_t slot = (i + offset) % slot_count;
+        bool unused = true;
+        for (uint16_t j = 0; j < slots_needed && unused; j++) {
+            unused = self->codepoints[slot + j] == LVFONTIO_INVALID_CODEPOINT && self->reference_counts[slot + j] == 0;
+        }
+        if (unused) {
             return slot;
         }
     }
 
-    // If none found, look for slots with zero reference count, starting at the offset
-    for (uint16_t i = 0; i < self->max_glyphs; i++) {
-        int16_t slot = (i + offset) % self->max_glyphs;
-        if (self->reference_counts[slot] == 0) {
-            return slot;
+    // If none found, evict the least recently used glyphs that nothing references
+    uint16_t best_slot = UINT16_MAX;
+    uint32_t best_age = 0;
+    for (uint16_t slot = 0; slot < slot_count; slot++) {
+        bool evictable = true;
+        uint32_t last_used = 0;
+        for (uint16_t j = 0; j < slots_needed && evictable; j++) {
+            evictable = slot_is_evictable(self, slot + j);
+            last_used = MAX(last_used, self->last_used[slot + j]);
+        }
+        uint32_t age = self->use_counter - last_used;
+        if (evictable && (best_slot == UINT16_MAX || age > best_age)) {
+            best_slot = slot;
+            best_age = age;
         }
     }
 
-    // No slots available
-    return UINT16_MAX;
+    return best_slot;
 }
 
 static FRESULT read_glyph_dimensions(FIL *file, lvfontio_ondiskfont_t *self,
@@ -52,6 +52,9 @@ typedef struct {
     uint32_t *codepoints;
     // Array of reference counts for each glyph slot
     uint16_t *reference_counts; // Use uint16_t to handle higher reference counts
+    // When each slot was last used, so that unreferenced glyphs are evicted least recently used first
+    uint32_t *last_used;
+    uint32_t use_counter;
     // Maximum number of glyphs to cache at once
     uint16_t max_glyphs;
     // Flag indicating whether to use m_malloc (true) or port_malloc (false)
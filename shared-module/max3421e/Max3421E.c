@@ -86,7 +86,7 @@ void common_hal_max3421e_max3421e_deinit(max3421e_max3421e_obj_t *self) {
 void osal_task_delay(uint32_t msec) {
     uint32_t end_time = common_hal_time_monotonic_ms() + msec;
     while (common_hal_time_monotonic_ms() < end_time) {
-        if (tuh_callback.prev != NULL) {
+        if (tuh_callback.queued) {
             tuh_int_handler(CIRCUITPY_USB_MAX3421_INSTANCE, false);
         }
     }
@@ -4,16 +4,97 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <string.h>
+
+#include "py/misc.h"
+#include "shared-bindings/memorymonitor/__init__.h"
 #include "shared-module/memorymonitor/__init__.h"
 #include "shared-module/memorymonitor/AllocationAlarm.h"
 #include "shared-module/memorymonitor/AllocationSize.h"
 
+#include "supervisor/port.h"
+
+// The history lives outside the VM heap so that it can be recorded while the
+// GC is running and read back without allocating.
+static memorymonitor_gc_record_t gc_history[MEMORYMONITOR_GC_HISTORY_LEN];
+static uint32_t gc_count;
+static memorymonitor_gc_record_t gc_current;
+static uint32_t gc_phase_start_us;
+static bool gc_marking;
+static uint32_t gc_stack_borrows;
+static uint32_t gc_stack_rescans;
+
+static uint32_t _ticks_us(void) {
+    uint8_t subticks = 0;
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    // A tick is 1/1024 second and a subtick is 1/32 tick.
+    return (uint32_t)(ticks * 15625 / 16 + subticks * 15625 / 512);
+}
+
 void memorymonitor_track_allocation(size_t block_count) {
     memorymonitor_allocationalarms_allocation(block_count);
     memorymonitor_allocationsizes_track_allocation(block_count);
 }
 
+void memorymonitor_gc_mark_start(void) {
+    gc_current = (memorymonitor_gc_record_t) { 0 };
+    gc_marking = true;
+    gc_phase_start_us = _ticks_us();
+}
+
+void memorymonitor_gc_mark_end(void) {
+    // gc_sweep_all() sweeps without marking first.
+    if (gc_marking) {
+        gc_current.mark_us = _ticks_us() - gc_phase_start_us;
+        gc_marking = false;
+    }
+}
+
+void memorymonitor_gc_sweep_start(void) {
+    gc_phase_start_us = _ticks_us();
+}
+
+void memorymonitor_gc_sweep_end(size_t blocks_freed, size_t free_blocks, size_t max_free) {
+    gc_current.sweep_us = _ticks_us() - gc_phase_start_us;
+    gc_current.blocks_freed = blocks_freed;
+    gc_current.max_free = max_free;
+    gc_current.fragmentation = free_blocks == 0 ? 0 : (uint32_t)(1000 - (uint64_t)max_free * 1000 / free_blocks);
+    gc_history[gc_count % MEMORYMONITOR_GC_HISTORY_LEN] = gc_current;
+    gc_count++;
+}
+
+void memorymonitor_gc_stack_overflow(bool rescan) {
+    if (rescan) {
+        gc_stack_rescans++;
+    } else {
+        gc_stack_borrows++;
+    }
+}
+
+uint32_t common_hal_memorymonitor_gc_count(void) {
+    return gc_count;
+}
+
+size_t common_hal_memorymonitor_gc_history(uint32_t *buf, size_t max_records) {
+    size_t available = MIN(gc_count, MEMORYMONITOR_GC_HISTORY_LEN);
+    size_t n = MIN(available, max_records);
+    // Oldest record first, ending with the most recent collection.
+    for (size_t i = 0; i < n; i++) {
+        size_t index = (gc_count - n + i) % MEMORYMONITOR_GC_HISTORY_LEN;
+        memcpy(buf + i * MEMORYMONITOR_GC_RECORD_FIELDS, &gc_history[index], sizeof(memorymonitor_gc_record_t));
+    }
+    return n;
+}
+
+void common_hal_memorymonitor_gc_stack_overflows(uint32_t *borrows, uint32_t *rescans) {
+    *borrows = gc_stack_borrows;
+    *rescans = gc_stack_rescans;
+}
+
 void memorymonitor_reset(void) {
     memorymonitor_allocationalarms_reset();
     memorymonitor_allocationsizes_reset();
+    gc_count = 0;
+    gc_stack_borrows = 0;
+    gc_stack_rescans = 0;
 }
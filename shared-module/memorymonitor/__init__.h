@@ -6,7 +6,36 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 void memorymonitor_track_allocation(size_t block_count);
 void memorymonitor_reset(void);
+
+// Number of recent garbage collections kept for memorymonitor.gc_history().
+#ifndef MEMORYMONITOR_GC_HISTORY_LEN
+#define MEMORYMONITOR_GC_HISTORY_LEN (8)
+#endif
+
+// One garbage collection. Times are in microseconds, sizes in blocks.
+typedef struct {
+    uint32_t mark_us;
+    uint32_t sweep_us;
+    uint32_t blocks_freed;
+    uint32_t max_free;
+    // 1000 * (1 - max_free / free blocks), 0 when the free space is in one run.
+    uint32_t fragmentation;
+} memorymonitor_gc_record_t;
+
+#define MEMORYMONITOR_GC_RECORD_FIELDS (sizeof(memorymonitor_gc_record_t) / sizeof(uint32_t))
+
+// Called by py/gc.c around each phase of a collection.
+void memorymonitor_gc_mark_start(void);
+void memorymonitor_gc_mark_end(void);
+void memorymonitor_gc_sweep_start(void);
+void memorymonitor_gc_sweep_end(size_t blocks_freed, size_t free_blocks, size_t max_free);
+
+// Called by py/gc.c when the mark stack overflows, with rescan false when
+// marking continued on a borrowed stack and true for each full heap rescan.
+void memorymonitor_gc_stack_overflow(bool rescan);
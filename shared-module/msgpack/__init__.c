@@ -6,6 +6,7 @@
 
 #include <stdio.h>
 #include <inttypes.h>
+#include <string.h>
 
 #include "py/obj.h"
 #include "py/binary.h"
@@ -28,21 +29,37 @@ typedef struct _msgpack_stream_t {
     mp_uint_t (*read)(mp_obj_t obj, void *buf, mp_uint_t size, int *errcode);
     mp_uint_t (*write)(mp_obj_t obj, const void *buf, mp_uint_t size, int *errcode);
     int errcode;
+    // When decoding straight from a buffer, the part of it left to read, and the start of the
+    // buffer's storage, which memoryviews of it point at so that it stays alive.
+    const byte *pos;
+    const byte *end;
+    byte *storage;
 } msgpack_stream_t;
 
 static msgpack_stream_t get_stream(mp_obj_t stream_obj, int flags) {
     const mp_stream_p_t *stream_p = mp_get_stream_raise(stream_obj, flags);
-    msgpack_stream_t s = {stream_obj, stream_p->read, stream_p->write, 0};
+    msgpack_stream_t s = {stream_obj, stream_p->read, stream_p->write, 0, NULL, NULL, NULL};
     return s;
 }
 
 ////////////////////////////////////////////////////////////////
 // readers
 
-static void read(msgpack_stream_t *s, void *buf, mp_uint_t size) {
+static void read_bytes(msgpack_stream_t *s, void *buf, mp_uint_t size) {
     if (size == 0) {
         return;
     }
+    if (s->end != NULL) {
+        if (s->pos == s->end) {
+            mp_raise_msg(&mp_type_EOFError, NULL);
+        }
+        if ((size_t)(s->end - s->pos) < size) {
+            mp_raise_ValueError(MP_ERROR_TEXT("short read"));
+        }
+        memcpy(buf, s->pos, size);
+        s->pos += size;
+        return;
+    }
     mp_uint_t ret = s->read(s->stream_obj, buf, size, &s->errcode);
     if (s->errcode != 0) {
         mp_raise_OSError(s->errcode);
@@ -57,13 +74,13 @@ static void read(msgpack_stream_t *s, void *buf, mp_uint_t size) {
 
 static uint8_t read1(msgpack_stream_t *s) {
     uint8_t res = 0;
-    read(s, &res, 1);
+    read_bytes(s, &res, 1);
     return res;
 }
 
 static uint16_t read2(msgpack_stream_t *s) {
     uint16_t res = 0;
-    read(s, &res, 2);
+    read_bytes(s, &res, 2);
     int n = 1;
     if (*(char *)&n == 1) {
         res = __builtin_bswap16(res);
@@ -73,7 +90,7 @@ static uint16_t read2(msgpack_stream_t *s) {
 
 static uint32_t read4(msgpack_stream_t *s) {
     uint32_t res = 0;
-    read(s, &res, 4);
+    read_bytes(s, &res, 4);
     int n = 1;
     if (*(char *)&n == 1) {
         res = __builtin_bswap32(res);
@@ -83,7 +100,7 @@ static uint32_t read4(msgpack_stream_t *s) {
 
 static uint64_t read8(msgpack_stream_t *s) {
     uint64_t res = 0;
-    read(s, &res, 8);
+    read_bytes(s, &res, 8);
     int n = 1;
     if (*(char *)&n == 1) {
         res = __builtin_bswap64(res);
@@ -110,7 +127,7 @@ static size_t read_size(msgpack_stream_t *s, uint8_t len_index) {
 ////////////////////////////////////////////////////////////////
 // writers
 
-static void write(msgpack_stream_t *s, const void *buf, mp_uint_t size) {
+static void write_bytes(msgpack_stream_t *s, const void *buf, mp_uint_t size) {
     mp_uint_t ret = s->write(s->stream_obj, buf, size, &s->errcode);
     if (s->errcode != 0) {
         mp_raise_OSError(s->errcode);
@@ -121,7 +138,7 @@ static void write(msgpack_stream_t *s, const void *buf, mp_uint_t size) {
 }
 
 static void write1(msgpack_stream_t *s, uint8_t obj) {
-    write(s, &obj, 1);
+    write_bytes(s, &obj, 1);
 }
 
 static void write2(msgpack_stream_t *s, uint16_t obj) {
@@ -129,7 +146,7 @@ static void write2(msgpack_stream_t *s, uint16_t obj) {
     if (*(char *)&n == 1) {
         obj = __builtin_bswap16(obj);
     }
-    write(s, &obj, 2);
+    write_bytes(s, &obj, 2);
 }
 
 static void write4(msgpack_stream_t *s, uint32_t obj) {
@@ -137,7 +154,7 @@ static void write4(msgpack_stream_t *s, uint32_t obj) {
     if (*(char *)&n == 1) {
         obj = __builtin_bswap32(obj);
     }
-    write(s, &obj, 4);
+    write_bytes(s, &obj, 4);
 }
 
 // compute and write msgpack size code (array structures)
@@ -192,7 +209,7 @@ static void pack_int(msgpack_stream_t *s, int32_t x) {
 static void pack_bin(msgpack_stream_t *s, const uint8_t *data, size_t len) {
     write_size(s, 0xc4, len);
     if (len > 0) {
-        write(s, data, len);
+        write_bytes(s, data, len);
     }
 }
 
@@ -212,7 +229,7 @@ static void pack_ext(msgpack_stream_t *s, int8_t code, const uint8_t *data, size
     }
     write1(s, code);    // type byte
     if (len > 0) {
-        write(s, data, len);
+        write_bytes(s, data, len);
     }
 }
 
@@ -223,7 +240,7 @@ static void pack_str(msgpack_stream_t *s, const char *str, size_t len) {
         write_size(s, 0xd9, len);
     }
     if (len > 0) {
-        write(s, str, len);
+        write_bytes(s, str, len);
     }
 }
 
@@ -293,13 +310,12 @@ static void pack(mp_obj_t obj, msgpack_stream_t *s, mp_obj_t default_handler) {
             pack(next->value, s, default_handler);
         }
     } else if (mp_obj_is_float(obj)) {
-        union Float { mp_float_t f;
-                      uint32_t u;
-        };
-        union Float data;
-        data.f = mp_obj_float_get(obj);
+        // Always packed as a 32-bit float, whatever the size of mp_float_t.
+        float f = (float)mp_obj_float_get(obj);
+        uint32_t u;
+        memcpy(&u, &f, sizeof(u));
         write1(s, 0xca);
-        write4(s, data.u);
+        write4(s, u);
     } else if (obj == mp_const_none) {
         write1(s, 0xc0);
     } else if (obj == mp_const_false) {
@@ -326,7 +342,149 @@ static void pack(mp_obj_t obj, msgpack_stream_t *s, mp_obj_t default_handler) {
 
 static mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list);
 
+#if MICROPY_PY_ARRAY
+static uint64_t get_be(const byte *p, size_t size) {
+    uint64_t res = 0;
+    for (size_t i = 0; i < size; i++) {
+        res = (res << 8) | p[i];
+    }
+    return res;
+}
+
+// When decoding from a buffer, an array whose elements are all ints of up to 32 bits, or all
+// floats, becomes an array.array of the smallest type that holds them, instead of a list of
+// objects. Returns MP_OBJ_NULL, without reading anything, for any other array.
+static mp_obj_t unpack_number_array(msgpack_stream_t *s, size_t size) {
+    if (size == 0) {
+        return MP_OBJ_NULL;
+    }
+    // Look through the elements first to choose the type.
+    int64_t min = 0;
+    int64_t max = 0;
+    size_t ints = 0;
+    size_t floats = 0;
+    size_t doubles = 0;
+    const byte *p = s->pos;
+    for (size_t i = 0; i < size; i++) {
+        if (p >= s->end) {
+            return MP_OBJ_NULL;
+        }
+        uint8_t code = *p++;
+        int64_t value = 0;
+        size_t len = 0;
+        if ((code & 0b10000000) == 0 || (code & 0b11100000) == 0b11100000) {
+            value = (int8_t)code;
+        } else if (code == 0xca || code == 0xcb) {
+            len = code == 0xca ? 4 : 8;
+            if (code == 0xca) {
+                floats++;
+            } else {
+                doubles++;
+            }
+        } else if (code == 0xcc || code == 0xcd || code == 0xce || code == 0xd0 || code == 0xd1 || code == 0xd2) {
+            // uint8, uint16, uint32, int8, int16, int32
+            len = 1 << ((code - 0xcc) & 0x3);
+        } else {
+            return MP_OBJ_NULL;
+        }
+        if ((size_t)(s->end - p) < len) {
+            return MP_OBJ_NULL;
+        }
+        if (code >= 0xcc && code <= 0xd2) {
+            uint64_t raw = get_be(p, len);
+            if (code >= 0xd0) {
+                // Sign extend.
+                value = (int64_t)(raw << (64 - 8 * len)) >> (64 - 8 * len);
+            } else {
+                value = raw;
+            }
+        }
+        if (len == 0 || (code >= 0xcc && code <= 0xd2)) {
+            min = ints == 0 || value < min ? value : min;
+            max = ints == 0 || value > max ? value : max;
+            ints++;
+        }
+        p += len;
+    }
+
+    char typecode;
+    if (ints == size) {
+        if (min >= INT8_MIN && max <= INT8_MAX) {
+            typecode = 'b';
+        } else if (min >= 0 && max <= UINT8_MAX) {
+            typecode = 'B';
+        } else if (min >= INT16_MIN && max <= INT16_MAX) {
+            typecode = 'h';
+        } else if (min >= 0 && max <= UINT16_MAX) {
+            typecode = 'H';
+        } else if (min >= INT32_MIN && max <= INT32_MAX) {
+            typecode = 'i';
+        } else {
+            typecode = 'I';
+        }
+    #if MICROPY_PY_BUILTINS_FLOAT
+    } else if (floats + doubles == size) {
+        typecode = doubles > 0 ? 'd' : 'f';
+    #endif
+    } else {
+        return MP_OBJ_NULL;
+    }
+
+    size_t item_size = mp_binary_get_size('@', typecode, NULL);
+    mp_obj_array_t *array = mp_obj_malloc(mp_obj_array_t, &mp_type_array);
+    array->typecode = typecode;
+    array->free = 0;
+    array->len = size;
+    array->items = m_new(byte, item_size * size);
+    for (size_t i = 0; i < size; i++) {
+        uint8_t code = *s->pos++;
+        if (ints == size) {
+            mp_int_t value;
+            if ((code & 0b10000000) == 0 || (code & 0b11100000) == 0b11100000) {
+                value = (int8_t)code;
+            } else {
+                size_t len = 1 << ((code - 0xcc) & 0x3);
+                uint64_t raw = get_be(s->pos, len);
+                value = code >= 0xd0 ? (mp_int_t)((int64_t)(raw << (64 - 8 * len)) >> (64 - 8 * len)) : (mp_int_t)raw;
+                s->pos += len;
+            }
+            mp_binary_set_val_array_from_int(typecode, array->items, i, value);
+        }
+        #if MICROPY_PY_BUILTINS_FLOAT
+        else {
+            uint64_t raw = get_be(s->pos, code == 0xca ? 4 : 8);
+            double value;
+            if (code == 0xca) {
+                uint32_t u = raw;
+                float f;
+                memcpy(&f, &u, sizeof(f));
+                value = f;
+                s->pos += 4;
+            } else {
+                memcpy(&value, &raw, sizeof(value));
+                s->pos += 8;
+            }
+            if (typecode == 'f') {
+                ((float *)array->items)[i] = (float)value;
+            } else {
+                ((double *)array->items)[i] = value;
+            }
+        }
+        #endif
+    }
+    return MP_OBJ_FROM_PTR(array);
+}
+#endif
+
 static mp_obj_t unpack_array_elements(msgpack_stream_t *s, size_t size, mp_obj_t ext_hook, bool use_list) {
+    #if MICROPY_PY_ARRAY
+    if (s->end != NULL) {
+        mp_obj_t array = unpack_number_array(s, size);
+        if (array != MP_OBJ_NULL) {
+            return array;
+        }
+    }
+    #endif
     if (use_list) {
         mp_obj_list_t *t = MP_OBJ_TO_PTR(mp_obj_new_list(size, NULL));
         for (size_t i = 0; i < size; i++) {
@@ -343,15 +501,25 @@ static mp_obj_t unpack_array_elements(msgpack_stream_t *s, size_t size, mp_obj_t
 }
 
 static mp_obj_t unpack_bytes(msgpack_stream_t *s, size_t size) {
+    if (s->end != NULL && s->storage != NULL) {
+        // Refer to the bytes where they are instead of copying them.
+        if ((size_t)(s->end - s->pos) < size) {
+            mp_raise_ValueError(MP_ERROR_TEXT("short read"));
+        }
+        mp_obj_array_t *view = MP_OBJ_TO_PTR(mp_obj_new_memoryview('B', size, s->storage));
+        view->free = s->pos - s->storage;
+        s->pos += size;
+        return MP_OBJ_FROM_PTR(view);
+    }
     vstr_t vstr;
     vstr_init_len(&vstr, size);
     byte *p = (byte *)vstr.buf;
     // read in chunks: (some drivers - e.g. UART) limit the
     // maximum number of bytes that can be read at once
-    // read(s, p, size);
+    // read_bytes(s, p, size);
     while (size > 0) {
         int n = size > 256 ? 256 : size;
-        read(s, p, n);
+        read_bytes(s, p, n);
         size -= n;
         p += n;
     }
@@ -360,7 +528,11 @@ static mp_obj_t unpack_bytes(msgpack_stream_t *s, size_t size) {
 
 static mp_obj_t unpack_ext(msgpack_stream_t *s, size_t size, mp_obj_t ext_hook) {
     int8_t code = read1(s);
+    // ext_hook and ExtType get bytes, even when decoding from a buffer.
+    byte *storage = s->storage;
+    s->storage = NULL;
     mp_obj_t data = unpack_bytes(s, size);
+    s->storage = storage;
     if (ext_hook != mp_const_none) {
         return mp_call_function_2(ext_hook, MP_OBJ_NEW_SMALL_INT(code), data);
     } else {
@@ -382,7 +554,7 @@ static mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
         size_t len = code & 0b11111;
         // allocate on stack; len < 32
         char str[len];
-        read(s, &str, len);
+        read_bytes(s, &str, len);
         return mp_obj_new_str(str, len);
     }
     if ((code & 0b11110000) == 0b10010000) {
@@ -394,7 +566,9 @@ static mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
         size_t len = code & 0b1111;
         mp_obj_dict_t *d = MP_OBJ_TO_PTR(mp_obj_new_dict(len));
         for (size_t i = 0; i < len; i++) {
-            mp_obj_dict_store(d, unpack(s, ext_hook, use_list), unpack(s, ext_hook, use_list));
+            // The key comes first, which the order arguments are evaluated in doesn't guarantee.
+            mp_obj_t key = unpack(s, ext_hook, use_list);
+            mp_obj_dict_store(d, key, unpack(s, ext_hook, use_list));
         }
         return MP_OBJ_FROM_PTR(d);
     }
@@ -428,22 +602,16 @@ static mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
         case 0xd3: // int 64
             return mp_obj_new_int_from_ll((int64_t)read8(s));
         case 0xca: { // float
-            union Float {
-                mp_float_t f;
-                uint32_t u;
-            };
-            union Float data;
-            data.u = read4(s);
-            return mp_obj_new_float(data.f);
+            uint32_t u = read4(s);
+            float f;
+            memcpy(&f, &u, sizeof(f));
+            return mp_obj_new_float_from_f(f);
         }
         case 0xcb: { // double
-            union Double {
-                uint64_t u;
-                double d;
-            };
-            union Double data;
-            data.u = read8(s);
-            return mp_obj_new_float_from_d(data.d);
+            uint64_t u = read8(s);
+            double d;
+            memcpy(&d, &u, sizeof(d));
+            return mp_obj_new_float_from_d(d);
         }
         case 0xd9:
         case 0xda:
@@ -453,7 +621,7 @@ static mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
             vstr_t vstr;
             vstr_init_len(&vstr, size);
             byte *p = (byte *)vstr.buf;
-            read(s, p, size);
+            read_bytes(s, p, size);
             return mp_obj_new_str_from_vstr(&vstr);
         }
         case 0xde:
@@ -462,7 +630,9 @@ static mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
             size_t len = read_size(s, code - 0xde + 1);
             mp_obj_dict_t *d = MP_OBJ_TO_PTR(mp_obj_new_dict(len));
             for (size_t i = 0; i < len; i++) {
-                mp_obj_dict_store(d, unpack(s, ext_hook, use_list), unpack(s, ext_hook, use_list));
+                // The key comes first, which the order arguments are evaluated in doesn't guarantee.
+            mp_obj_t key = unpack(s, ext_hook, use_list);
+            mp_obj_dict_store(d, key, unpack(s, ext_hook, use_list));
             }
             return MP_OBJ_FROM_PTR(d);
         }
@@ -502,3 +672,27 @@ mp_obj_t common_hal_msgpack_unpack(mp_obj_t stream_obj, mp_obj_t ext_hook, bool
     msgpack_stream_t stream = get_stream(stream_obj, MP_STREAM_OP_READ);
     return unpack(&stream, ext_hook, use_list);
 }
+
+mp_obj_t common_hal_msgpack_unpack_from(mp_obj_t buffer_obj, size_t offset, mp_obj_t ext_hook, bool use_list) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_obj, &bufinfo, MP_BUFFER_READ);
+    if (offset > bufinfo.len) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q out of range"), MP_QSTR_offset);
+    }
+    msgpack_stream_t stream = {
+        .pos = (const byte *)bufinfo.buf + offset,
+        .end = (const byte *)bufinfo.buf + bufinfo.len,
+    };
+    // Memoryviews must point at the start of an object's storage to keep it alive. For a
+    // memoryview, that's what it is a view of, and for bytes, bytearray and array, their own.
+    if (mp_obj_is_type(buffer_obj, &mp_type_memoryview)) {
+        stream.storage = ((mp_obj_array_t *)MP_OBJ_TO_PTR(buffer_obj))->items;
+    } else if (mp_obj_is_type(buffer_obj, &mp_type_bytes) || mp_obj_is_type(buffer_obj, &mp_type_bytearray)
+               #if MICROPY_PY_ARRAY
+               || mp_obj_is_type(buffer_obj, &mp_type_array)
+               #endif
+               ) {
+        stream.storage = bufinfo.buf;
+    }
+    return unpack(&stream, ext_hook, use_list);
+}
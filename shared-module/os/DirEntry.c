@@ -0,0 +1,70 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/os/DirEntry.h"
+#include "shared-bindings/os/__init__.h"
+
+#include "extmod/vfs.h"
+#include "py/objstr.h"
+#include "py/objtuple.h"
+#include "py/runtime.h"
+
+mp_obj_t os_direntry_scandir_iternext(mp_obj_t self_in) {
+    os_scandir_iterator_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_obj_t next = mp_iternext(self->iter);
+    if (next == MP_OBJ_STOP_ITERATION) {
+        return next;
+    }
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_get_array(next, &len, &items);
+
+    os_direntry_obj_t *entry = mp_obj_malloc(os_direntry_obj_t, &os_direntry_type);
+    entry->name = items[0];
+    entry->dir = self->dir;
+    if (self->with_stat) {
+        entry->stat = items[1];
+        entry->mode = MP_OBJ_SMALL_INT_VALUE(((mp_obj_tuple_t *)MP_OBJ_TO_PTR(items[1]))->items[0]);
+    } else {
+        entry->stat = MP_OBJ_NULL;
+        entry->mode = mp_obj_get_int(items[1]);
+    }
+    return MP_OBJ_FROM_PTR(entry);
+}
+
+mp_obj_t common_hal_os_direntry_get_name(os_direntry_obj_t *self) {
+    return self->name;
+}
+
+mp_obj_t common_hal_os_direntry_get_path(os_direntry_obj_t *self) {
+    size_t dir_len, name_len;
+    const char *dir = mp_obj_str_get_data(self->dir, &dir_len);
+    const char *name = mp_obj_str_get_data(self->name, &name_len);
+    vstr_t vstr;
+    vstr_init(&vstr, dir_len + 1 + name_len);
+    vstr_add_strn(&vstr, dir, dir_len);
+    if (dir_len > 0 && dir[dir_len - 1] != '/') {
+        vstr_add_char(&vstr, '/');
+    }
+    vstr_add_strn(&vstr, name, name_len);
+    return mp_obj_new_str_from_vstr(&vstr);
+}
+
+bool common_hal_os_direntry_is_dir(os_direntry_obj_t *self) {
+    return (self->mode & MP_S_IFDIR) != 0;
+}
+
+bool common_hal_os_direntry_is_file(os_direntry_obj_t *self) {
+    return (self->mode & MP_S_IFREG) != 0;
+}
+
+mp_obj_t common_hal_os_direntry_stat(os_direntry_obj_t *self) {
+    if (self->stat == MP_OBJ_NULL) {
+        mp_obj_t path = common_hal_os_direntry_get_path(self);
+        self->stat = common_hal_os_stat(mp_obj_str_get_str(path));
+    }
+    return self->stat;
+}
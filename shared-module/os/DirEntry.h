@@ -0,0 +1,28 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+typedef struct {
+    mp_obj_base_t base;
+    mp_obj_t name;
+    mp_obj_t dir; // as given to scandir, joined with name when path is asked for
+    mp_int_t mode;
+    mp_obj_t stat; // MP_OBJ_NULL until it's known
+} os_direntry_obj_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    mp_fun_1_t iternext;
+    mp_obj_t iter; // the filesystem's ilistdir iterator
+    mp_obj_t dir;
+    // The filesystem's iterator gives (name, stat result) instead of ilistdir tuples.
+    bool with_stat;
+} os_scandir_iterator_obj_t;
+
+mp_obj_t os_direntry_scandir_iternext(mp_obj_t self_in);
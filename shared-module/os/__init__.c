@@ -9,11 +9,13 @@
 #include <string.h>
 
 #include "extmod/vfs.h"
+#include "extmod/vfs_fat.h"
 #include "py/mperrno.h"
 #include "py/mpstate.h"
 #include "py/obj.h"
 #include "py/objstr.h"
 #include "py/runtime.h"
+#include "shared-bindings/os/DirEntry.h"
 #include "shared-bindings/os/__init__.h"
 
 // This provides all VFS related OS functions so that ports can share the code
@@ -87,9 +89,9 @@ mp_obj_t common_hal_os_getcwd(void) {
     return mp_vfs_getcwd();
 }
 
-mp_obj_t common_hal_os_listdir(const char *path) {
-    mp_obj_t path_out;
-    mp_vfs_mount_t *vfs = lookup_dir_path(path, &path_out);
+// Like lookup_dir_path, but the root directory is listed from the filesystem mounted at /.
+static mp_vfs_mount_t *lookup_listdir_path(const char *path, mp_obj_t *path_out) {
+    mp_vfs_mount_t *vfs = lookup_dir_path(path, path_out);
     if (vfs == MP_VFS_ROOT) {
         vfs = MP_STATE_VM(vfs_mount_table);
         while (vfs != NULL) {
@@ -98,8 +100,14 @@ mp_obj_t common_hal_os_listdir(const char *path) {
             }
             vfs = vfs->next;
         }
-        path_out = MP_OBJ_NEW_QSTR(MP_QSTR__slash_);
+        *path_out = MP_OBJ_NEW_QSTR(MP_QSTR__slash_);
     }
+    return vfs;
+}
+
+mp_obj_t common_hal_os_listdir(const char *path) {
+    mp_obj_t path_out;
+    mp_vfs_mount_t *vfs = lookup_listdir_path(path, &path_out);
 
     mp_obj_t iter_obj = mp_vfs_proxy_call(vfs, MP_QSTR_ilistdir, 1, &path_out);
 
@@ -113,6 +121,26 @@ mp_obj_t common_hal_os_listdir(const char *path) {
     return dir_list;
 }
 
+mp_obj_t common_hal_os_scandir(const char *path, mp_obj_t dir) {
+    mp_obj_t path_out;
+    mp_vfs_mount_t *vfs = lookup_listdir_path(path, &path_out);
+
+    os_scandir_iterator_obj_t *iter = mp_obj_malloc(os_scandir_iterator_obj_t, &mp_type_polymorph_iter);
+    iter->iternext = os_direntry_scandir_iternext;
+    iter->dir = dir;
+    iter->with_stat = false;
+    #if MICROPY_VFS_FAT
+    // FAT gives everything stat would from the directory entry itself.
+    if (vfs != MP_VFS_NONE && mp_obj_is_type(vfs->obj, &mp_fat_vfs_type)) {
+        iter->with_stat = true;
+        iter->iter = mp_vfs_fat_ilistdir_stat(vfs->obj, path_out);
+        return MP_OBJ_FROM_PTR(iter);
+    }
+    #endif
+    iter->iter = mp_vfs_proxy_call(vfs, MP_QSTR_ilistdir, 1, &path_out);
+    return MP_OBJ_FROM_PTR(iter);
+}
+
 void common_hal_os_mkdir(const char *path) {
     mp_obj_t path_out;
     mp_vfs_mount_t *vfs = lookup_dir_path(path, &path_out);
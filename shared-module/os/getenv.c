@@ -267,6 +267,98 @@ static mp_int_t read_value(file_arg *active_file, vstr_t *buf, bool *quoted) {
     }
 }
 
+// Where the lines that set keys start in settings.toml, so that a lookup can seek to the few
+// lines whose key hashes the same instead of parsing the whole file. It is built by the first
+// lookup, and again once any FAT filesystem has been written to.
+#ifndef CIRCUITPY_OS_GETENV_INDEX_LENGTH
+#define CIRCUITPY_OS_GETENV_INDEX_LENGTH (32)
+#endif
+
+typedef struct {
+    uint32_t offset;
+    uint16_t hash;
+} getenv_index_entry_t;
+
+static struct {
+    // What the index was built from, to check it is still current.
+    FATFS *fs;
+    DWORD sclust;
+    FSIZE_t size;
+    uint32_t write_count;
+    // Where the lines that didn't fit in the index start, or the end of the keys when all did.
+    FSIZE_t resume;
+    uint16_t len;
+    bool valid;
+    getenv_index_entry_t entries[CIRCUITPY_OS_GETENV_INDEX_LENGTH];
+} getenv_index;
+
+static uint16_t key_hash_add(uint16_t hash, uint8_t character) {
+    return (hash * 33) ^ character;
+}
+
+// Whether a key can only be found on a line it was indexed under, which is when it could have
+// been parsed from the file: empty keys and keys with whitespace or '=' in them are matched
+// another way.
+static bool key_is_indexable(const char *key) {
+    if (*key == 0) {
+        return false;
+    }
+    for (; *key; key++) {
+        if (*key == '=' || unichar_isspace(*key)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Reads the whole file the way key_matches() would, recording each line that has a key.
+static void index_file(file_arg *active_file) {
+    getenv_index.fs = active_file->obj.fs;
+    getenv_index.sclust = active_file->obj.sclust;
+    getenv_index.size = f_size(active_file);
+    getenv_index.write_count = mp_vfs_fat_write_count;
+    getenv_index.len = 0;
+    getenv_index.valid = true;
+
+    while (!is_eof(active_file)) {
+        FSIZE_t offset = f_tell(active_file);
+        uint8_t character = consume_whitespace(active_file);
+        if (character == '[' || character == 0) {
+            break;
+        }
+        uint16_t hash = 5381;
+        while (character != 0 && character != '=' && !unichar_isspace(character)) {
+            hash = key_hash_add(hash, character);
+            character = get_next_byte(active_file);
+        }
+        if (unichar_isspace(character)) {
+            character = consume_whitespace(active_file);
+        }
+        if (character == '=') {
+            if (getenv_index.len == CIRCUITPY_OS_GETENV_INDEX_LENGTH) {
+                getenv_index.resume = offset;
+                return;
+            }
+            getenv_index.entries[getenv_index.len++] = (getenv_index_entry_t) {
+                .offset = offset,
+                .hash = hash,
+            };
+        }
+        if (character != '\n') {
+            next_line(active_file);
+        }
+    }
+    getenv_index.resume = getenv_index.size;
+}
+
+static bool index_is_current(file_arg *active_file) {
+    return getenv_index.valid
+           && getenv_index.fs == active_file->obj.fs
+           && getenv_index.sclust == active_file->obj.sclust
+           && getenv_index.size == f_size(active_file)
+           && getenv_index.write_count == mp_vfs_fat_write_count;
+}
+
 static os_getenv_err_t os_getenv_vstr(const char *path, const char *key, vstr_t *buf, bool *quoted) {
     file_arg active_file;
     if (!open_file(path, &active_file)) {
@@ -274,12 +366,34 @@ static os_getenv_err_t os_getenv_vstr(const char *path, const char *key, vstr_t
     }
 
     os_getenv_err_t result = GETENV_ERR_NOT_FOUND;
+    if (strcmp(path, GETENV_PATH) == 0 && key_is_indexable(key)) {
+        if (!index_is_current(&active_file)) {
+            index_file(&active_file);
+        }
+        uint16_t hash = 5381;
+        for (const char *k = key; *k; k++) {
+            hash = key_hash_add(hash, *k);
+        }
+        for (size_t i = 0; i < getenv_index.len; i++) {
+            if (getenv_index.entries[i].hash != hash) {
+                continue;
+            }
+            f_lseek(&active_file, getenv_index.entries[i].offset);
+            if (key_matches(&active_file, key)) {
+                result = read_value(&active_file, buf, quoted);
+                goto done;
+            }
+        }
+        // Only the lines that didn't fit in the index are left to search.
+        f_lseek(&active_file, getenv_index.resume);
+    }
     while (!is_eof(&active_file)) {
         if (key_matches(&active_file, key)) {
             result = read_value(&active_file, buf, quoted);
             break;
         }
     }
+done:
     close_file(&active_file);
     return result;
 }
@@ -18,3 +18,13 @@ MP_WEAK void common_hal_paralleldisplaybus_parallelbus_construct_nonsequential(p
 MP_WEAK void common_hal_paralleldisplaybus_parallelbus_collect_ptrs(mp_obj_t self) {
 
 }
+
+#if CIRCUITPY_BUSDISPLAY_DOUBLE_BUFFER
+// Ports that can't send in the background finish the send before returning.
+MP_WEAK void common_hal_paralleldisplaybus_parallelbus_send_async(mp_obj_t self, const uint8_t *data, uint32_t data_length) {
+    common_hal_paralleldisplaybus_parallelbus_send(self, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED, data, data_length);
+}
+
+MP_WEAK void common_hal_paralleldisplaybus_parallelbus_wait_for_send(mp_obj_t self) {
+}
+#endif
@@ -78,46 +78,63 @@ static mp_obj_t data_type(int type) {
     return mp_obj_new_int(type);
 }
 
-static void quirc_fill_buffer(qrdecoder_qrdecoder_obj_t *self, void *buf, qrio_pixel_policy_t policy) {
-    int width, height;
-    uint8_t *framebuffer = quirc_begin(self->quirc, &width, &height);
-    uint8_t *src = buf;
-
+static inline uint8_t pixel_luma(const uint8_t *src, size_t i, qrio_pixel_policy_t policy) {
     switch (policy) {
-        case QRIO_RGB565: {
-            uint16_t *src16 = buf;
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = (src16[i] >> 3) & 0xfc;
-            }
-            break;
+        case QRIO_RGB565:
+            return (((const uint16_t *)src)[i] >> 3) & 0xfc;
+        case QRIO_RGB565_SWAPPED:
+            return (__builtin_bswap16(((const uint16_t *)src)[i]) >> 3) & 0xfc;
+        case QRIO_EVERY_BYTE:
+            return src[i];
+        case QRIO_ODD_BYTES:
+            return src[2 * i + 1];
+        case QRIO_EVEN_BYTES:
+        default:
+            return src[2 * i];
+    }
+}
+
+// Copies one row of the decoder's image, averaging scale x scale blocks of the frame.
+static void fill_row(uint8_t *dest, const uint8_t *src, size_t row_start, int width, qrio_pixel_policy_t policy, const qrio_frame_layout_t *layout) {
+    int scale = layout->scale;
+    if (scale == 1) {
+        if (policy == QRIO_EVERY_BYTE) {
+            memcpy(dest, src + row_start, width);
+            return;
+        }
+        for (int i = 0; i < width; i++) {
+            dest[i] = pixel_luma(src, row_start + i, policy);
         }
-        case QRIO_RGB565_SWAPPED: {
-            uint16_t *src16 = buf;
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = (__builtin_bswap16(src16[i]) >> 3) & 0xfc;
+        return;
+    }
+    // scale is a power of two, so its square is too.
+    int shift = 2 * __builtin_ctz(scale);
+    for (int i = 0; i < width; i++) {
+        uint32_t sum = 0;
+        size_t block_start = row_start + i * scale;
+        for (int dy = 0; dy < scale; dy++) {
+            for (int dx = 0; dx < scale; dx++) {
+                sum += pixel_luma(src, block_start + dy * layout->stride + dx, policy);
             }
-            break;
         }
-        case QRIO_EVERY_BYTE:
-            memcpy(framebuffer, src, width * height);
-            break;
+        dest[i] = sum >> shift;
+    }
+}
 
-        case QRIO_ODD_BYTES:
-            src++;
-            MP_FALLTHROUGH;
+static void quirc_fill_buffer(qrdecoder_qrdecoder_obj_t *self, void *buf, qrio_pixel_policy_t policy, const qrio_frame_layout_t *layout) {
+    int width, height;
+    uint8_t *framebuffer = quirc_begin(self->quirc, &width, &height);
 
-        case QRIO_EVEN_BYTES:
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = src[2 * i];
-            }
-            break;
+    for (int y = 0; y < height; y++) {
+        size_t row_start = (layout->y + y * layout->scale) * layout->stride + layout->x;
+        fill_row(framebuffer + y * width, buf, row_start, width, policy, layout);
     }
     quirc_end(self->quirc);
 }
 
 
-mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
-    quirc_fill_buffer(self, bufinfo->buf, policy);
+mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy, const qrio_frame_layout_t *layout) {
+    quirc_fill_buffer(self, bufinfo->buf, policy, layout);
     int count = quirc_count(self->quirc);
     mp_obj_t result = mp_obj_new_list(0, NULL);
     for (int i = 0; i < count; i++) {
@@ -137,24 +154,21 @@ mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, co
 }
 
 
-mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
-    quirc_fill_buffer(self, bufinfo->buf, policy);
+mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy, const qrio_frame_layout_t *layout) {
+    quirc_fill_buffer(self, bufinfo->buf, policy, layout);
     int count = quirc_count(self->quirc);
     mp_obj_t result = mp_obj_new_list(0, NULL);
     for (int i = 0; i < count; i++) {
         quirc_extract(self->quirc, i, &self->code);
         mp_obj_t code_obj;
-        mp_obj_t elems[9] = {
-            mp_obj_new_int(self->code.corners[0].x),
-            mp_obj_new_int(self->code.corners[0].y),
-            mp_obj_new_int(self->code.corners[1].x),
-            mp_obj_new_int(self->code.corners[1].y),
-            mp_obj_new_int(self->code.corners[2].x),
-            mp_obj_new_int(self->code.corners[2].y),
-            mp_obj_new_int(self->code.corners[3].x),
-            mp_obj_new_int(self->code.corners[3].y),
-            mp_obj_new_int(self->code.size),
-        };
+        // Report the corners where they are in the frame, so they can be used to pick the
+        // region to decode in the next one.
+        mp_obj_t elems[9];
+        for (int c = 0; c < 4; c++) {
+            elems[2 * c] = mp_obj_new_int(layout->x + self->code.corners[c].x * layout->scale);
+            elems[2 * c + 1] = mp_obj_new_int(layout->y + self->code.corners[c].y * layout->scale);
+        }
+        elems[8] = mp_obj_new_int(self->code.size);
         code_obj = namedtuple_make_new((const mp_obj_type_t *)&qrio_qrposition_type_obj, 9, 0, elems);
         mp_obj_list_append(result, code_obj);
     }
@@ -17,10 +17,20 @@ typedef struct qrio_qrdecoder_obj {
     struct quirc_data data;
 } qrdecoder_qrdecoder_obj_t;
 
+// Where the decoder's image is in a larger frame, such as a camera framebuffer. Each decoder
+// pixel averages a scale x scale block of frame pixels, starting at (x, y). stride is the
+// number of pixels between the starts of frame rows.
+typedef struct {
+    int x;
+    int y;
+    int stride;
+    int scale;
+} qrio_frame_layout_t;
+
 void shared_module_qrio_qrdecoder_construct(qrdecoder_qrdecoder_obj_t *, int width, int height);
 int shared_module_qrio_qrdecoder_get_height(qrdecoder_qrdecoder_obj_t *);
 int shared_module_qrio_qrdecoder_get_width(qrdecoder_qrdecoder_obj_t *);
 void shared_module_qrio_qrdecoder_set_height(qrdecoder_qrdecoder_obj_t *, int height);
 void shared_module_qrio_qrdecoder_set_width(qrdecoder_qrdecoder_obj_t *, int width);
-mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy);
-mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy);
+mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy, const qrio_frame_layout_t *layout);
+mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy, const qrio_frame_layout_t *layout);
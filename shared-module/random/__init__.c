@@ -59,6 +59,43 @@ void shared_modules_random_seed(mp_uint_t seed) {
     yasmarang_dat = 0;
 }
 
+void shared_modules_random_fill_int(void *buf, size_t len, size_t itemsize, mp_int_t lo, uint32_t span) {
+    // The mask is worked out once for the whole buffer rather than per item.
+    uint32_t mask = 1;
+    while ((span & mask) < span) {
+        mask = (mask << 1) | 1;
+    }
+    for (size_t i = 0; i < len; i++) {
+        uint64_t v;
+        if (span == 0) {
+            v = yasmarang();
+            if (itemsize == 8) {
+                v = (v << 32) | yasmarang();
+            }
+        } else {
+            uint32_t r;
+            do {
+                r = yasmarang() & mask;
+            } while (r >= span);
+            v = (uint64_t)(int64_t)lo + r;
+        }
+        switch (itemsize) {
+            case 1:
+                ((uint8_t *)buf)[i] = v;
+                break;
+            case 2:
+                ((uint16_t *)buf)[i] = v;
+                break;
+            case 4:
+                ((uint32_t *)buf)[i] = v;
+                break;
+            default:
+                ((uint64_t *)buf)[i] = v;
+                break;
+        }
+    }
+}
+
 mp_uint_t shared_modules_random_getrandbits(uint8_t n) {
     if (n == 0) {
         return 0;
@@ -113,3 +150,15 @@ mp_float_t shared_modules_random_random(void) {
 mp_float_t shared_modules_random_uniform(mp_float_t a, mp_float_t b) {
     return a + (b - a) * yasmarang_float();
 }
+
+void shared_modules_random_fill_float(void *buf, size_t len, bool is_double, mp_float_t a, mp_float_t b) {
+    mp_float_t scale = b - a;
+    for (size_t i = 0; i < len; i++) {
+        mp_float_t f = a + scale * yasmarang_float();
+        if (is_double) {
+            ((double *)buf)[i] = f;
+        } else {
+            ((float *)buf)[i] = (float)f;
+        }
+    }
+}
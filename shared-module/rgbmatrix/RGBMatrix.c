@@ -216,6 +216,22 @@ void common_hal_rgbmatrix_rgbmatrix_refresh(rgbmatrix_rgbmatrix_obj_t *self) {
     }
 }
 
+// Protomatter re-encodes every bitplane of the whole frame, so skip it when a display refresh
+// didn't write any rows. The displayed buffer already shows the current content.
+void common_hal_rgbmatrix_rgbmatrix_swapbuffers(rgbmatrix_rgbmatrix_obj_t *self, const uint8_t *dirty_row_bitmask) {
+    if (dirty_row_bitmask != NULL) {
+        int height = common_hal_rgbmatrix_rgbmatrix_get_height(self);
+        bool any_dirty = false;
+        for (int i = 0; i < (height + 7) / 8 && !any_dirty; i++) {
+            any_dirty = dirty_row_bitmask[i] != 0;
+        }
+        if (!any_dirty) {
+            return;
+        }
+    }
+    common_hal_rgbmatrix_rgbmatrix_refresh(self);
+}
+
 int common_hal_rgbmatrix_rgbmatrix_get_width(rgbmatrix_rgbmatrix_obj_t *self) {
     return self->width;
 }
@@ -17,6 +17,8 @@
 
 #include "py/mperrno.h"
 
+#include <string.h>
+
 #if 0
 #define DEBUG_PRINT(...) ((void)mp_printf(&mp_plat_print,##__VA_ARGS__))
 #else
@@ -32,6 +34,8 @@
 #define TOKEN_STOP_TRAN (0xFD)
 #define TOKEN_DATA (0xFE)
 
+#define NO_BLOCK (0xffffffff)
+
 static void common_hal_sdcardio_check_for_deinit(sdcardio_sdcard_obj_t *self) {
     if (!self->bus) {
         raise_deinited_error();
@@ -83,7 +87,8 @@ static uint8_t CRC7(const uint8_t *data, uint8_t n) {
     return (crc << 1) | 1;
 }
 
-#define READY_TIMEOUT_NS (300 * 1000 * 1000) // 300ms
+// Long enough for an SDXC card to finish programming a block, which is waited for here.
+#define READY_TIMEOUT_NS (500 * 1000 * 1000) // 500ms
 static int wait_for_ready(sdcardio_sdcard_obj_t *self) {
     uint64_t deadline = common_hal_time_monotonic_ns() + READY_TIMEOUT_NS;
     while (common_hal_time_monotonic_ns() < deadline) {
@@ -119,6 +124,11 @@ static int exit_cmd25(sdcardio_sdcard_obj_t *self) {
     if (self->in_cmd25) {
         DEBUG_PRINT("exit cmd25\n");
         self->in_cmd25 = false;
+        // The last block may still be programming.
+        int r = wait_for_ready(self);
+        if (r < 0) {
+            return r;
+        }
         return cmd_nodata(self, TOKEN_STOP_TRAN, 0);
     }
     return 0;
@@ -302,6 +312,13 @@ mp_rom_error_text_t sdcardio_sdcard_construct(sdcardio_sdcard_obj_t *self, busio
     self->cdv = 512;
     self->sectors = 0;
     self->baudrate = 250000;
+    #if CIRCUITPY_SDCARDIO_CACHE_BLOCKS
+    self->cache_uses = 0;
+    for (size_t i = 0; i < CIRCUITPY_SDCARDIO_CACHE_BLOCKS; i++) {
+        self->cache[i].block = NO_BLOCK;
+        self->cache[i].dirty = false;
+    }
+    #endif
 
     lock_bus_or_throw(self);
     mp_rom_error_text_t result = init_card(self);
@@ -351,12 +368,7 @@ static int readinto(sdcardio_sdcard_obj_t *self, void *buf, size_t size) {
     return 0;
 }
 
-mp_uint_t sdcardio_sdcard_readblocks(mp_obj_t self_in, uint8_t *buf, uint32_t start_block, uint32_t nblocks) {
-    // deinit check is in lock_and_configure_bus()
-    sdcardio_sdcard_obj_t *self = MP_OBJ_TO_PTR(self_in);
-    if (!lock_and_configure_bus(self)) {
-        return MP_EAGAIN;
-    }
+static int read_blocks(sdcardio_sdcard_obj_t *self, uint8_t *buf, uint32_t start_block, uint32_t nblocks) {
     int r = 0;
     size_t buflen = 512 * nblocks;
     if (nblocks == 1) {
@@ -387,7 +399,6 @@ mp_uint_t sdcardio_sdcard_readblocks(mp_obj_t self_in, uint8_t *buf, uint32_t st
             r = single_byte;
         }
     }
-    extraclock_and_unlock_bus(self);
     return r;
 }
 
@@ -399,8 +410,11 @@ int common_hal_sdcardio_sdcard_readblocks(sdcardio_sdcard_obj_t *self, uint32_t
     return sdcardio_sdcard_readblocks(MP_OBJ_FROM_PTR(self), buf->buf, start_block, buf->len / 512);
 }
 
-static int _write(sdcardio_sdcard_obj_t *self, uint8_t token, void *buf, size_t size) {
-    wait_for_ready(self);
+static int _write(sdcardio_sdcard_obj_t *self, uint8_t token, const void *buf, size_t size) {
+    int r = wait_for_ready(self);
+    if (r < 0) {
+        return r;
+    }
 
     uint8_t cmd[2];
     cmd[0] = token;
@@ -435,28 +449,17 @@ static int _write(sdcardio_sdcard_obj_t *self, uint8_t token, void *buf, size_t
         }
     }
 
-    // Wait for the write to finish
-    do {
-        common_hal_busio_spi_read(self->bus, cmd, 1, 0xff);
-    } while (cmd[0] == 0);
-
-    // Success
+    // The card is now busy programming the block. That isn't waited for here, but before the next
+    // command or block, so the VM can get on with other work in the meantime.
     return 0;
 }
 
-mp_uint_t sdcardio_sdcard_writeblocks(mp_obj_t self_in, uint8_t *buf, uint32_t start_block, uint32_t nblocks) {
-    // deinit check is in lock_and_configure_bus()
-    sdcardio_sdcard_obj_t *self = MP_OBJ_TO_PTR(self_in);
-    if (!lock_and_configure_bus(self)) {
-        return MP_EAGAIN;
-    }
-
+static int write_blocks(sdcardio_sdcard_obj_t *self, const uint8_t *buf, uint32_t start_block, uint32_t nblocks) {
     if (!self->in_cmd25 || start_block != self->next_block) {
         DEBUG_PRINT("entering CMD25 at %d\n", (int)start_block);
         //  Use CMD25 to write multiple block
         int r = block_cmd(self, 25, start_block, NULL, 0, true, true);
         if (r < 0) {
-            extraclock_and_unlock_bus(self);
             return r;
         }
         self->in_cmd25 = true;
@@ -464,26 +467,179 @@ mp_uint_t sdcardio_sdcard_writeblocks(mp_obj_t self_in, uint8_t *buf, uint32_t s
 
     self->next_block = start_block;
 
-    uint8_t *ptr = buf;
+    const uint8_t *ptr = buf;
     while (nblocks--) {
         int r = _write(self, TOKEN_CMD25, ptr, 512);
         if (r < 0) {
             self->in_cmd25 = false;
-            extraclock_and_unlock_bus(self);
             return r;
         }
         self->next_block++;
         ptr += 512;
     }
+    return 0;
+}
+
+#if CIRCUITPY_SDCARDIO_CACHE_BLOCKS
+// FAT and directory updates come one block at a time. Holding those until sync means they get
+// written once however often they change, and don't end the CMD25 stream of the file data written
+// in between. Blocks read one at a time are kept too, since they are usually about to be changed.
+
+static sdcardio_cache_entry_t *find_cached_block(sdcardio_sdcard_obj_t *self, uint32_t block) {
+    for (size_t i = 0; i < CIRCUITPY_SDCARDIO_CACHE_BLOCKS; i++) {
+        if (self->cache[i].block == block) {
+            self->cache[i].last_use = ++self->cache_uses;
+            return &self->cache[i];
+        }
+    }
+    return NULL;
+}
 
-    extraclock_and_unlock_bus(self);
+// Frees the least recently used entry, preferring clean ones. Returns NULL when a dirty block
+// couldn't be written out.
+static sdcardio_cache_entry_t *claim_cache_entry(sdcardio_sdcard_obj_t *self) {
+    sdcardio_cache_entry_t *victim = &self->cache[0];
+    for (size_t i = 1; i < CIRCUITPY_SDCARDIO_CACHE_BLOCKS; i++) {
+        sdcardio_cache_entry_t *entry = &self->cache[i];
+        if (entry->dirty != victim->dirty ? !entry->dirty : entry->last_use < victim->last_use) {
+            victim = entry;
+        }
+    }
+    if (victim->dirty) {
+        if (write_blocks(self, victim->data, victim->block, 1) < 0) {
+            return NULL;
+        }
+        victim->dirty = false;
+    }
+    victim->block = NO_BLOCK;
+    victim->last_use = ++self->cache_uses;
+    return victim;
+}
+
+// Writes out the dirty blocks in order, so that runs of them go in one CMD25.
+static int flush_cache(sdcardio_sdcard_obj_t *self) {
+    while (true) {
+        sdcardio_cache_entry_t *next = NULL;
+        for (size_t i = 0; i < CIRCUITPY_SDCARDIO_CACHE_BLOCKS; i++) {
+            sdcardio_cache_entry_t *entry = &self->cache[i];
+            if (entry->dirty && (next == NULL || entry->block < next->block)) {
+                next = entry;
+            }
+        }
+        if (next == NULL) {
+            return 0;
+        }
+        int r = write_blocks(self, next->data, next->block, 1);
+        if (r < 0) {
+            return r;
+        }
+        next->dirty = false;
+    }
+}
+
+static int read_cached_block(sdcardio_sdcard_obj_t *self, uint8_t *buf, uint32_t block) {
+    sdcardio_cache_entry_t *entry = find_cached_block(self, block);
+    if (entry == NULL) {
+        entry = claim_cache_entry(self);
+        if (entry == NULL) {
+            return read_blocks(self, buf, block, 1);
+        }
+        int r = read_blocks(self, entry->data, block, 1);
+        if (r != 0) {
+            return r;
+        }
+        entry->block = block;
+    }
+    memcpy(buf, entry->data, 512);
     return 0;
 }
 
+static int write_cached_block(sdcardio_sdcard_obj_t *self, const uint8_t *buf, uint32_t block) {
+    sdcardio_cache_entry_t *entry = find_cached_block(self, block);
+    if (entry == NULL) {
+        entry = claim_cache_entry(self);
+        if (entry == NULL) {
+            return write_blocks(self, buf, block, 1);
+        }
+        entry->block = block;
+    }
+    memcpy(entry->data, buf, 512);
+    entry->dirty = true;
+    return 0;
+}
+#endif
+
+mp_uint_t sdcardio_sdcard_readblocks(mp_obj_t self_in, uint8_t *buf, uint32_t start_block, uint32_t nblocks) {
+    // deinit check is in lock_and_configure_bus()
+    sdcardio_sdcard_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (!lock_and_configure_bus(self)) {
+        return MP_EAGAIN;
+    }
+    int r;
+    #if CIRCUITPY_SDCARDIO_CACHE_BLOCKS
+    if (nblocks == 1) {
+        r = read_cached_block(self, buf, start_block);
+    } else {
+        r = read_blocks(self, buf, start_block, nblocks);
+        // Blocks that haven't been written out yet are newer than what the card has.
+        for (size_t i = 0; r == 0 && i < CIRCUITPY_SDCARDIO_CACHE_BLOCKS; i++) {
+            sdcardio_cache_entry_t *entry = &self->cache[i];
+            if (entry->dirty && entry->block >= start_block && entry->block - start_block < nblocks) {
+                memcpy(buf + (entry->block - start_block) * 512, entry->data, 512);
+            }
+        }
+    }
+    #else
+    r = read_blocks(self, buf, start_block, nblocks);
+    #endif
+    extraclock_and_unlock_bus(self);
+    return r;
+}
+
+mp_uint_t sdcardio_sdcard_writeblocks(mp_obj_t self_in, uint8_t *buf, uint32_t start_block, uint32_t nblocks) {
+    // deinit check is in lock_and_configure_bus()
+    sdcardio_sdcard_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (!lock_and_configure_bus(self)) {
+        return MP_EAGAIN;
+    }
+    int r;
+    #if CIRCUITPY_SDCARDIO_CACHE_BLOCKS
+    if (nblocks == 1) {
+        r = write_cached_block(self, buf, start_block);
+    } else {
+        // What is written replaces any copies held here.
+        for (size_t i = 0; i < CIRCUITPY_SDCARDIO_CACHE_BLOCKS; i++) {
+            sdcardio_cache_entry_t *entry = &self->cache[i];
+            if (entry->block >= start_block && entry->block - start_block < nblocks) {
+                entry->block = NO_BLOCK;
+                entry->dirty = false;
+            }
+        }
+        r = write_blocks(self, buf, start_block, nblocks);
+    }
+    #else
+    r = write_blocks(self, buf, start_block, nblocks);
+    #endif
+    extraclock_and_unlock_bus(self);
+    return r;
+}
+
 int common_hal_sdcardio_sdcard_sync(sdcardio_sdcard_obj_t *self) {
     // deinit check is in lock_and_configure_bus()
-    lock_and_configure_bus(self);
-    int r = exit_cmd25(self);
+    if (!lock_and_configure_bus(self)) {
+        return -EAGAIN;
+    }
+    int r = 0;
+    #if CIRCUITPY_SDCARDIO_CACHE_BLOCKS
+    r = flush_cache(self);
+    #endif
+    if (r == 0) {
+        r = exit_cmd25(self);
+    }
+    // Written blocks are only safe once the card has finished programming them.
+    if (r == 0) {
+        r = wait_for_ready(self);
+    }
     extraclock_and_unlock_bus(self);
     return r;
 }
@@ -493,10 +649,18 @@ int common_hal_sdcardio_sdcard_writeblocks(sdcardio_sdcard_obj_t *self, uint32_t
     if (buf->len % 512 != 0) {
         mp_raise_ValueError_varg(MP_ERROR_TEXT("Buffer must be a multiple of %d bytes"), 512);
     }
-    lock_and_configure_bus(self);
-    int r = sdcardio_sdcard_writeblocks(MP_OBJ_FROM_PTR(self), buf->buf, start_block, buf->len / 512);
+    return sdcardio_sdcard_writeblocks(MP_OBJ_FROM_PTR(self), buf->buf, start_block, buf->len / 512);
+}
+
+// Whether the card is still programming a block, or the bus is in use, without waiting for either.
+static bool card_busy(sdcardio_sdcard_obj_t *self) {
+    if (!lock_and_configure_bus(self)) {
+        return true;
+    }
+    uint8_t b;
+    common_hal_busio_spi_read(self->bus, &b, 1, 0xff);
     extraclock_and_unlock_bus(self);
-    return r;
+    return b != 0xff;
 }
 
 bool sdcardio_sdcard_ioctl(mp_obj_t self_in, size_t cmd, size_t arg, mp_int_t *out_value) {
@@ -515,6 +679,12 @@ bool sdcardio_sdcard_ioctl(mp_obj_t self_in, size_t cmd, size_t arg, mp_int_t *o
         case MP_BLOCKDEV_IOCTL_BLOCK_SIZE:
             *out_value = 512;
             break;
+        case MP_BLOCKDEV_IOCTL_BLOCK_ERASE:
+            // Blocks are overwritten in place, so littlefs has nothing to erase first.
+            break;
+        case MP_BLOCKDEV_IOCTL_BUSY:
+            *out_value = card_busy(self);
+            break;
         default:
             return false;
     }
@@ -14,6 +14,15 @@
 #include "common-hal/busio/SPI.h"
 #include "common-hal/digitalio/DigitalInOut.h"
 
+#if CIRCUITPY_SDCARDIO_CACHE_BLOCKS
+typedef struct {
+    uint32_t block;
+    uint32_t last_use;
+    bool dirty;
+    uint8_t data[512];
+} sdcardio_cache_entry_t;
+#endif
+
 typedef struct {
     mp_obj_base_t base;
     busio_spi_obj_t *bus;
@@ -23,6 +32,10 @@ typedef struct {
     uint32_t sectors;
     uint32_t next_block;
     bool in_cmd25;
+    #if CIRCUITPY_SDCARDIO_CACHE_BLOCKS
+    uint32_t cache_uses;
+    sdcardio_cache_entry_t cache[CIRCUITPY_SDCARDIO_CACHE_BLOCKS];
+    #endif
 } sdcardio_sdcard_obj_t;
 
 mp_rom_error_text_t sdcardio_sdcard_construct(sdcardio_sdcard_obj_t *self, busio_spi_obj_t *bus, const mcu_pin_obj_t *cs, int baudrate);
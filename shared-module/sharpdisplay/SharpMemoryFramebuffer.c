@@ -139,6 +139,10 @@ void common_hal_sharpdisplay_framebuffer_construct(
     common_hal_sharpdisplay_framebuffer_get_bufinfo(self, NULL);
 }
 
+static bool row_is_dirty(sharpdisplay_framebuffer_obj_t *self, uint8_t *dirty_row_bitmask, int y) {
+    return self->full_refresh || (dirty_row_bitmask[y / 8] & (1 << (y & 7)));
+}
+
 static void common_hal_sharpdisplay_framebuffer_swapbuffers(sharpdisplay_framebuffer_obj_t *self, uint8_t *dirty_row_bitmask) {
     // claim SPI bus
     if (!common_hal_busio_spi_try_lock(self->bus)) {
@@ -155,13 +159,20 @@ static void common_hal_sharpdisplay_framebuffer_swapbuffers(sharpdisplay_framebu
 
     common_hal_busio_spi_write(self->bus, data++, 1);
 
-    // output each changed row
+    // output each run of changed rows. Each row in the buffer already has its
+    // address and trailing dummy byte, so a run goes out as one transfer.
     size_t row_stride = common_hal_sharpdisplay_framebuffer_get_row_stride(self);
-    for (int y = 0; y < self->height; y++) {
-        if (self->full_refresh || (dirty_row_bitmask[y / 8] & (1 << (y & 7)))) {
-            common_hal_busio_spi_write(self->bus, data, row_stride);
+    int y = 0;
+    while (y < self->height) {
+        if (!row_is_dirty(self, dirty_row_bitmask, y)) {
+            y++;
+            continue;
+        }
+        int run_start = y;
+        while (y < self->height && row_is_dirty(self, dirty_row_bitmask, y)) {
+            y++;
         }
-        data += row_stride;
+        common_hal_busio_spi_write(self->bus, data + run_start * row_stride, (y - run_start) * row_stride);
     }
 
     // output a trailing zero
@@ -13,11 +13,68 @@
 #include "lib/mbedtls_config/crt_bundle.h"
 
 void common_hal_ssl_sslcontext_construct(ssl_sslcontext_obj_t *self) {
+    mbedtls_x509_crt_init(&self->cacert);
+    self->cacert_parsed = false;
+    mbedtls_ssl_session_init(&self->session);
+    self->session_hostname = mp_const_none;
     common_hal_ssl_sslcontext_set_default_verify_paths(self);
 }
 
+static void free_ca_chain(ssl_sslcontext_obj_t *self) {
+    mbedtls_x509_crt_free(&self->cacert);
+    mbedtls_x509_crt_init(&self->cacert);
+    self->cacert_parsed = false;
+}
+
+static void free_session(ssl_sslcontext_obj_t *self) {
+    mbedtls_ssl_session_free(&self->session);
+    mbedtls_ssl_session_init(&self->session);
+    self->session_hostname = mp_const_none;
+}
+
+void common_hal_ssl_sslcontext_deinit(ssl_sslcontext_obj_t *self) {
+    free_ca_chain(self);
+    free_session(self);
+}
+
+// Returns the parsed cacert_buf, parsing it the first time. Returns NULL with the mbedtls error in
+// ret when it doesn't parse.
+mbedtls_x509_crt *ssl_sslcontext_get_ca_chain(ssl_sslcontext_obj_t *self, int *ret) {
+    if (!self->cacert_parsed) {
+        *ret = mbedtls_x509_crt_parse(&self->cacert, self->cacert_buf, self->cacert_bytes);
+        if (*ret != 0) {
+            free_ca_chain(self);
+            return NULL;
+        }
+        self->cacert_parsed = true;
+    }
+    *ret = 0;
+    return &self->cacert;
+}
+
+// Offers the saved session to a client connecting to the same host. The server decides whether to
+// resume it, and does a full handshake when it doesn't. Hosts are told apart by name only, so
+// another port of the same host just costs a full handshake too.
+void ssl_sslcontext_resume_session(ssl_sslcontext_obj_t *self, mbedtls_ssl_context *ssl, const char *hostname) {
+    if (self->session_hostname == mp_const_none || strcmp(mp_obj_str_get_str(self->session_hostname), hostname) != 0) {
+        return;
+    }
+    // A session that can't be set just means a full handshake.
+    mbedtls_ssl_set_session(ssl, &self->session);
+}
+
+void ssl_sslcontext_save_session(ssl_sslcontext_obj_t *self, mbedtls_ssl_context *ssl, mp_obj_t hostname) {
+    free_session(self);
+    if (mbedtls_ssl_get_session(ssl, &self->session) != 0) {
+        free_session(self);
+        return;
+    }
+    self->session_hostname = hostname;
+}
+
 void common_hal_ssl_sslcontext_load_verify_locations(ssl_sslcontext_obj_t *self,
     const char *cadata) {
+    free_ca_chain(self);
     self->crt_bundle_attach = NULL;
     self->use_global_ca_store = false;
     self->cacert_buf = (const unsigned char *)cadata;
@@ -25,6 +82,7 @@ void common_hal_ssl_sslcontext_load_verify_locations(ssl_sslcontext_obj_t *self,
 }
 
 void common_hal_ssl_sslcontext_set_default_verify_paths(ssl_sslcontext_obj_t *self) {
+    free_ca_chain(self);
     self->crt_bundle_attach = crt_bundle_attach;
     self->use_global_ca_store = true;
     self->cacert_buf = NULL;
@@ -9,6 +9,7 @@
 
 #include "py/obj.h"
 #include "mbedtls/ssl.h"
+#include "mbedtls/x509_crt.h"
 
 typedef struct {
     mp_obj_base_t base;
@@ -17,4 +18,14 @@ typedef struct {
     size_t cacert_bytes;
     int (*crt_bundle_attach)(mbedtls_ssl_config *conf);
     mp_buffer_info_t cert_buf, key_buf;
+    // cacert_buf parsed by the first socket that needs it, and shared by all of them.
+    mbedtls_x509_crt cacert;
+    bool cacert_parsed;
+    // The session of the last client handshake, which the next socket to the same host resumes.
+    mbedtls_ssl_session session;
+    mp_obj_t session_hostname;
 } ssl_sslcontext_obj_t;
+
+mbedtls_x509_crt *ssl_sslcontext_get_ca_chain(ssl_sslcontext_obj_t *self, int *ret);
+void ssl_sslcontext_resume_session(ssl_sslcontext_obj_t *self, mbedtls_ssl_context *ssl, const char *hostname);
+void ssl_sslcontext_save_session(ssl_sslcontext_obj_t *self, mbedtls_ssl_context *ssl, mp_obj_t hostname);
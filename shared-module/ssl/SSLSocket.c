@@ -222,6 +222,10 @@ ssl_sslsocket_obj_t *common_hal_ssl_sslcontext_wrap_socket(ssl_sslcontext_obj_t
     o->ssl_context = self;
     o->sock_obj = socket;
     o->poll_mask = 0;
+    o->server_hostname = mp_const_none;
+    if (!server_side && server_hostname != NULL) {
+        o->server_hostname = mp_obj_new_str(server_hostname, strlen(server_hostname));
+    }
 
     mp_load_method(socket, MP_QSTR_accept, o->accept_args);
     mp_load_method(socket, MP_QSTR_bind, o->bind_args);
@@ -235,7 +239,6 @@ ssl_sslsocket_obj_t *common_hal_ssl_sslcontext_wrap_socket(ssl_sslcontext_obj_t
 
     mbedtls_ssl_init(&o->ssl);
     mbedtls_ssl_config_init(&o->conf);
-    mbedtls_x509_crt_init(&o->cacert);
     mbedtls_x509_crt_init(&o->cert);
     mbedtls_pk_init(&o->pkey);
     mbedtls_ctr_drbg_init(&o->ctr_drbg);
@@ -263,12 +266,12 @@ ssl_sslsocket_obj_t *common_hal_ssl_sslcontext_wrap_socket(ssl_sslcontext_obj_t
         mbedtls_ssl_conf_authmode(&o->conf, MBEDTLS_SSL_VERIFY_REQUIRED);
         self->crt_bundle_attach(&o->conf);
     } else if (self->cacert_buf && self->cacert_bytes) {
-        ret = mbedtls_x509_crt_parse(&o->cacert, self->cacert_buf, self->cacert_bytes);
-        if (ret != 0) {
+        mbedtls_x509_crt *ca_chain = ssl_sslcontext_get_ca_chain(self, &ret);
+        if (ca_chain == NULL) {
             goto cleanup;
         }
         mbedtls_ssl_conf_authmode(&o->conf, MBEDTLS_SSL_VERIFY_REQUIRED);
-        mbedtls_ssl_conf_ca_chain(&o->conf, &o->cacert, NULL);
+        mbedtls_ssl_conf_ca_chain(&o->conf, ca_chain, NULL);
 
     } else {
         mbedtls_ssl_conf_authmode(&o->conf, MBEDTLS_SSL_VERIFY_NONE);
@@ -288,6 +291,9 @@ ssl_sslsocket_obj_t *common_hal_ssl_sslcontext_wrap_socket(ssl_sslcontext_obj_t
         if (ret != 0) {
             goto cleanup;
         }
+        if (o->server_hostname != mp_const_none) {
+            ssl_sslcontext_resume_session(self, &o->ssl, server_hostname);
+        }
     }
 
     mbedtls_ssl_set_bio(&o->ssl, o, _mbedtls_ssl_send, _mbedtls_ssl_recv, NULL);
@@ -315,7 +321,6 @@ ssl_sslsocket_obj_t *common_hal_ssl_sslcontext_wrap_socket(ssl_sslcontext_obj_t
 cleanup:
     mbedtls_pk_free(&o->pkey);
     mbedtls_x509_crt_free(&o->cert);
-    mbedtls_x509_crt_free(&o->cacert);
     mbedtls_ssl_free(&o->ssl);
     mbedtls_ssl_config_free(&o->conf);
     mbedtls_ctr_drbg_free(&o->ctr_drbg);
@@ -379,7 +384,6 @@ void common_hal_ssl_sslsocket_close(ssl_sslsocket_obj_t *self) {
     ssl_socket_close(self);
     mbedtls_pk_free(&self->pkey);
     mbedtls_x509_crt_free(&self->cert);
-    mbedtls_x509_crt_free(&self->cacert);
     mbedtls_ssl_free(&self->ssl);
     mbedtls_ssl_config_free(&self->conf);
     mbedtls_ctr_drbg_free(&self->ctr_drbg);
@@ -399,13 +403,15 @@ static void do_handshake(ssl_sslsocket_obj_t *self) {
         mp_hal_delay_ms(1);
     }
 
+    if (self->server_hostname != mp_const_none) {
+        ssl_sslcontext_save_session(self->ssl_context, &self->ssl, self->server_hostname);
+    }
     return;
 
 cleanup:
     self->closed = true;
     mbedtls_pk_free(&self->pkey);
     mbedtls_x509_crt_free(&self->cert);
-    mbedtls_x509_crt_free(&self->cacert);
     mbedtls_ssl_free(&self->ssl);
     mbedtls_ssl_config_free(&self->conf);
     mbedtls_ctr_drbg_free(&self->ctr_drbg);
@@ -26,11 +26,12 @@ typedef struct ssl_sslsocket_obj {
     mbedtls_ctr_drbg_context ctr_drbg;
     mbedtls_ssl_context ssl;
     mbedtls_ssl_config conf;
-    mbedtls_x509_crt cacert;
     mbedtls_x509_crt cert;
     mbedtls_pk_context pkey;
     uintptr_t poll_mask;
     bool closed;
+    // The server's name when this is a client, to save its session under after the handshake.
+    mp_obj_t server_hostname;
     mp_obj_t accept_args[2];
     mp_obj_t bind_args[3];
     mp_obj_t close_args[2];
@@ -9,6 +9,7 @@
 #include <string.h>
 
 #include "extmod/vfs.h"
+#include "py/binary.h"
 #include "py/mperrno.h"
 #include "py/mphal.h"
 #include "py/obj.h"
@@ -19,6 +20,11 @@
 #include "supervisor/filesystem.h"
 #include "supervisor/flash.h"
 
+#if CIRCUITPY_STORAGE_MAP_FILE
+#include "extmod/vfs_fat.h"
+#include "py/stream.h"
+#endif
+
 #if CIRCUITPY_USB_DEVICE
 #include "supervisor/usb.h"
 #endif
@@ -173,6 +179,114 @@ mp_obj_t common_hal_storage_getmount(const char *mount_path) {
     return storage_object_from_path(mount_path);
 }
 
+#if CIRCUITPY_STORAGE_MAP_FILE
+// Where the open file's contents can be read in place once it is closed, or NULL.
+static const void *map_file_data(mp_obj_t file, size_t *len) {
+    const mp_stream_p_t *stream = mp_get_stream(file);
+    if (stream->ioctl == NULL) {
+        return NULL;
+    }
+    struct mp_stream_data_ptr_t ptr = { NULL, false };
+    int errcode;
+    mp_uint_t data_len = stream->ioctl(file, MP_STREAM_GET_DATA_PTR, (uintptr_t)&ptr, &errcode);
+    if (data_len == MP_STREAM_ERROR || !ptr.persistent) {
+        return NULL;
+    }
+    *len = data_len;
+    return ptr.data;
+}
+
+static void map_file_check(FRESULT res) {
+    if (res != FR_OK) {
+        mp_raise_OSError(fresult_to_errno_table[res]);
+    }
+}
+
+// Rewrites a FAT file into one run of clusters, through a copy in the root of its filesystem.
+static void map_file_defragment(const char *path) {
+    const char *path_out;
+    mp_vfs_mount_t *vfs = mp_vfs_lookup_path(path, &path_out);
+    if (vfs == MP_VFS_NONE || vfs == MP_VFS_ROOT || !mp_obj_is_type(vfs->obj, &mp_fat_vfs_type)) {
+        return;
+    }
+    fs_user_mount_t *fs = MP_OBJ_TO_PTR(vfs->obj);
+    if (!filesystem_is_writable_by_python(fs)) {
+        mp_raise_OSError(MP_EROFS);
+    }
+
+    static const char temp_path[] = "/.map_file.tmp";
+    FIL src, dest;
+    map_file_check(f_open(&fs->fatfs, &src, path_out, FA_READ));
+    // Rewriting won't help when the file is empty or its filesystem isn't memory mapped.
+    DWORD sector = fs->fatfs.database + (src.obj.sclust - 2) * fs->fatfs.csize;
+    if (f_size(&src) == 0 || mp_vfs_blockdev_get_addr(&fs->blockdev, sector) == NULL) {
+        f_close(&src);
+        return;
+    }
+    FRESULT res = f_open(&fs->fatfs, &dest, temp_path, FA_WRITE | FA_CREATE_ALWAYS);
+    if (res != FR_OK) {
+        f_close(&src);
+        map_file_check(res);
+    }
+    // Allocate every cluster up front, in one run.
+    res = f_expand(&dest, f_size(&src), 1);
+    byte *buf = m_new(byte, FF_MAX_SS);
+    UINT n = FF_MAX_SS;
+    while (res == FR_OK && n == FF_MAX_SS) {
+        UINT written;
+        res = f_read(&src, buf, FF_MAX_SS, &n);
+        if (res == FR_OK && n > 0) {
+            res = f_write(&dest, buf, n, &written);
+            if (res == FR_OK && written != n) {
+                res = FR_DENIED;
+            }
+        }
+    }
+    m_del(byte, buf, FF_MAX_SS);
+    f_close(&src);
+    FRESULT close_res = f_close(&dest);
+    if (res == FR_OK) {
+        res = close_res;
+    }
+    if (res == FR_OK) {
+        res = f_unlink(&fs->fatfs, path_out);
+    }
+    if (res != FR_OK) {
+        f_unlink(&fs->fatfs, temp_path);
+        map_file_check(res);
+    }
+    map_file_check(f_rename(&fs->fatfs, temp_path, path_out));
+}
+
+static mp_obj_t map_file_open(mp_obj_t path) {
+    mp_obj_t args[2] = { path, MP_OBJ_NEW_QSTR(MP_QSTR_rb) };
+    return mp_vfs_open(MP_ARRAY_SIZE(args), args, (mp_map_t *)&mp_const_empty_map);
+}
+
+mp_obj_t common_hal_storage_map_file(mp_obj_t path, char typecode, bool defragment) {
+    size_t item_size = mp_binary_get_size('@', typecode, NULL);
+    mp_obj_t file = map_file_open(path);
+    size_t len;
+    const void *data = map_file_data(file, &len);
+    if (data == NULL && defragment) {
+        mp_stream_close(file);
+        map_file_defragment(mp_obj_str_get_str(path));
+        file = map_file_open(path);
+        data = map_file_data(file, &len);
+    }
+    if (data == NULL) {
+        // Not in one piece or not memory mapped, so use a copy.
+        mp_obj_t contents = mp_call_function_0(mp_load_attr(file, MP_QSTR_read));
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(contents, &bufinfo, MP_BUFFER_READ);
+        data = bufinfo.buf;
+        len = bufinfo.len;
+    }
+    mp_stream_close(file);
+    return mp_obj_new_memoryview(typecode, len / item_size, (void *)data);
+}
+#endif
+
 void common_hal_storage_remount(const char *mount_path, bool readonly, bool disable_concurrent_write_protection) {
     const char *path_under_mount;
     fs_user_mount_t *fs_usermount = filesystem_for_path(mount_path, &path_under_mount);
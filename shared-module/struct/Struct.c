@@ -0,0 +1,104 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "py/binary.h"
+#include "py/runtime.h"
+#include "shared-bindings/struct/__init__.h"
+#include "shared-bindings/struct/Struct.h"
+#include "shared-module/struct/__init__.h"
+
+static size_t parse_ops(const char *fmt, struct_struct_op_t *ops) {
+    size_t num_ops = 0;
+    while (*fmt) {
+        struct_validate_format(*fmt);
+        mp_uint_t count = 1;
+        if (unichar_isdigit(*fmt)) {
+            count = get_fmt_num(&fmt);
+        }
+        if (ops != NULL) {
+            ops[num_ops].code = *fmt;
+            ops[num_ops].count = count;
+        }
+        num_ops++;
+        fmt++;
+    }
+    return num_ops;
+}
+
+mp_obj_t shared_modules_struct_struct_new(mp_obj_t format) {
+    const char *fmt = mp_obj_str_get_str(format);
+    char fmt_type = get_fmt_type(&fmt);
+    size_t num_ops = parse_ops(fmt, NULL);
+
+    struct_struct_obj_t *self = mp_obj_malloc_var(struct_struct_obj_t, ops, struct_struct_op_t, num_ops, &struct_struct_type);
+    self->format = format;
+    self->fmt_type = fmt_type;
+    self->size = shared_modules_struct_calcsize(format);
+    self->num_items = calcsize_items(fmt);
+    self->num_ops = num_ops;
+    parse_ops(fmt, self->ops);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+mp_obj_t shared_modules_struct_struct_get_format(struct_struct_obj_t *self) {
+    return self->format;
+}
+
+mp_uint_t shared_modules_struct_struct_get_size(struct_struct_obj_t *self) {
+    return self->size;
+}
+
+mp_uint_t shared_modules_struct_struct_get_num_items(struct_struct_obj_t *self) {
+    return self->num_items;
+}
+
+void shared_modules_struct_struct_pack_into(struct_struct_obj_t *self, byte *p, size_t n_args, const mp_obj_t *args) {
+    (void)mp_arg_validate_length(n_args, self->num_items, MP_QSTR_values);
+
+    char fmt_type = self->fmt_type;
+    byte *p_base = p;
+    for (size_t i = 0; i < self->num_ops; i++) {
+        const struct_struct_op_t *op = &self->ops[i];
+        if (op->code == 's') {
+            mp_buffer_info_t bufinfo;
+            mp_get_buffer_raise(*args++, &bufinfo, MP_BUFFER_READ);
+            mp_uint_t to_copy = MIN(bufinfo.len, op->count);
+            memcpy(p, bufinfo.buf, to_copy);
+            memset(p + to_copy, 0, op->count - to_copy);
+            p += op->count;
+        } else if (op->code == 'x') {
+            for (mp_uint_t n = op->count; n > 0; n--) {
+                mp_binary_set_val(fmt_type, 'x', MP_OBJ_NEW_SMALL_INT(0), p_base, &p);
+            }
+        } else {
+            for (mp_uint_t n = op->count; n > 0; n--) {
+                mp_binary_set_val(fmt_type, op->code, *args++, p_base, &p);
+            }
+        }
+    }
+}
+
+void shared_modules_struct_struct_unpack_into(struct_struct_obj_t *self, byte *p, mp_obj_t *items) {
+    char fmt_type = self->fmt_type;
+    byte *p_base = p;
+    for (size_t i = 0; i < self->num_ops; i++) {
+        const struct_struct_op_t *op = &self->ops[i];
+        if (op->code == 's') {
+            *items++ = mp_obj_new_bytes(p, op->count);
+            p += op->count;
+        } else {
+            for (mp_uint_t n = op->count; n > 0; n--) {
+                mp_obj_t item = mp_binary_get_val(fmt_type, op->code, p_base, &p);
+                // Pad bytes are not stored.
+                if (op->code != 'x') {
+                    *items++ = item;
+                }
+            }
+        }
+    }
+}
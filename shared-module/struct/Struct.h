@@ -0,0 +1,25 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+typedef struct {
+    char code;
+    // How many times code repeats, or the length of an 's' string.
+    mp_uint_t count;
+} struct_struct_op_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    mp_obj_t format;
+    char fmt_type;
+    mp_uint_t size;
+    mp_uint_t num_items;
+    size_t num_ops;
+    struct_struct_op_t ops[];
+} struct_struct_obj_t;
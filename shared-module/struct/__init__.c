@@ -12,8 +12,9 @@
 #include "py/binary.h"
 #include "py/parsenum.h"
 #include "shared-bindings/struct/__init__.h"
+#include "shared-module/struct/__init__.h"
 
-static void struct_validate_format(char fmt) {
+void struct_validate_format(char fmt) {
     #if MICROPY_NONSTANDARD_TYPECODES
     if (fmt == 'S' || fmt == 'O') {
         mp_raise_RuntimeError(MP_ERROR_TEXT("'S' and 'O' are not supported format types"));
@@ -21,7 +22,7 @@ static void struct_validate_format(char fmt) {
     #endif
 }
 
-static char get_fmt_type(const char **fmt) {
+char get_fmt_type(const char **fmt) {
     char t = **fmt;
     switch (t) {
         case '!':
@@ -40,7 +41,7 @@ static char get_fmt_type(const char **fmt) {
     return t;
 }
 
-static mp_uint_t get_fmt_num(const char **p) {
+mp_uint_t get_fmt_num(const char **p) {
     const char *num = *p;
     uint len = 1;
     while (unichar_isdigit(*++num)) {
@@ -51,7 +52,7 @@ static mp_uint_t get_fmt_num(const char **p) {
     return val;
 }
 
-static mp_uint_t calcsize_items(const char *fmt) {
+mp_uint_t calcsize_items(const char *fmt) {
     mp_uint_t cnt = 0;
     while (*fmt) {
         int num = 1;
@@ -5,6 +5,10 @@
 // SPDX-License-Identifier: MIT
 #pragma once
 
+#include "py/obj.h"
+
+// Format parsing shared with struct.Struct.
+void struct_validate_format(char fmt);
 char get_fmt_type(const char **fmt);
 mp_uint_t get_fmt_num(const char **p);
 mp_uint_t calcsize_items(const char *fmt);
@@ -51,6 +51,7 @@ static void fast_sincos(mp_float_t theta, sincos_result_t *result) {
 mp_obj_t common_hal_synthio_biquad_new(synthio_filter_mode mode) {
     synthio_biquad_t *self = mp_obj_malloc(synthio_biquad_t, &synthio_biquad_type_obj);
     self->mode = mode;
+    self->last_tick = synthio_global_tick - 1;
     return MP_OBJ_FROM_PTR(self);
 }
 
@@ -64,6 +65,7 @@ mp_obj_t common_hal_synthio_biquad_get_Q(synthio_biquad_t *self) {
 
 void common_hal_synthio_biquad_set_Q(synthio_biquad_t *self, mp_obj_t Q) {
     synthio_block_assign_slot(Q, &self->Q, MP_QSTR_Q);
+    self->last_tick = synthio_global_tick - 1;
 }
 
 mp_obj_t common_hal_synthio_biquad_get_A(synthio_biquad_t *self) {
@@ -72,6 +74,7 @@ mp_obj_t common_hal_synthio_biquad_get_A(synthio_biquad_t *self) {
 
 void common_hal_synthio_biquad_set_A(synthio_biquad_t *self, mp_obj_t A) {
     synthio_block_assign_slot(A, &self->A, MP_QSTR_A);
+    self->last_tick = synthio_global_tick - 1;
 }
 
 mp_obj_t common_hal_synthio_biquad_get_frequency(synthio_biquad_t *self) {
@@ -80,6 +83,7 @@ mp_obj_t common_hal_synthio_biquad_get_frequency(synthio_biquad_t *self) {
 
 void common_hal_synthio_biquad_set_frequency(synthio_biquad_t *self, mp_obj_t frequency) {
     synthio_block_assign_slot(frequency, &self->f0, MP_QSTR_frequency);
+    self->last_tick = synthio_global_tick - 1;
 }
 
 static int32_t biquad_scale_arg_float(mp_float_t arg) {
@@ -100,6 +104,11 @@ static int float_equal_or_update(
 void common_hal_synthio_biquad_tick(mp_obj_t self_in) {
     synthio_biquad_t *self = MP_OBJ_TO_PTR(self_in);
 
+    if (self->last_tick == synthio_global_tick) {
+        return;
+    }
+    self->last_tick = synthio_global_tick;
+
     mp_float_t W0 = synthio_block_slot_get(&self->f0) * synthio_global_W_scale;
     mp_float_t Q = synthio_block_slot_get(&self->Q);
     mp_float_t A =
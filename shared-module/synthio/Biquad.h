@@ -16,6 +16,8 @@ typedef struct synthio_biquad {
     mp_obj_base_t base;
     synthio_filter_mode mode;
     synthio_block_slot_t f0, Q, A;
+    // A filter shared by several notes only needs its inputs checked once per block
+    uint8_t last_tick;
     mp_float_t cached_W0, cached_Q, cached_A;
     int32_t a1, a2, b0, b1, b2;
 } synthio_biquad_t;
@@ -93,6 +93,49 @@ mp_obj_t common_hal_synthio_note_get_waveform_obj(synthio_note_obj_t *self) {
     return self->waveform_obj;
 }
 
+// Halving the waveform with a 7-tap half-band filter keeps each level free of harmonics above
+// its own Nyquist frequency (to within the filter's roll-off).
+static void halve_waveform(const int16_t *src, size_t len, int16_t *dst) {
+    for (size_t i = 0; i < len / 2; i++) {
+        size_t j = 2 * i;
+        int32_t adjacent = src[(j + len - 1) % len] + src[(j + 1) % len];
+        int32_t outer = src[(j + len - 3) % len] + src[(j + 3) % len];
+        int32_t value = (16 * src[j] + 9 * adjacent - outer + 16) >> 5;
+        dst[i] = MIN(32767, MAX(-32768, value));
+    }
+}
+
+static void synthio_note_update_mipmap(synthio_note_obj_t *self) {
+    self->mip_levels = 0;
+    self->mip_buf = NULL;
+    size_t len = self->waveform_buf.len;
+    if (!self->band_limited || len == 0) {
+        return;
+    }
+    // Only levels that stay an exact fraction of the waveform are made, so the
+    // oscillator phase can be shared by all of them. The shortest level has 4 samples.
+    uint8_t levels = 0;
+    while (len % 2 == 0 && len / 2 >= 4) {
+        len /= 2;
+        levels++;
+    }
+    if (levels == 0) {
+        return;
+    }
+    len = self->waveform_buf.len;
+    int16_t *mip_buf = m_malloc(len * sizeof(int16_t));
+    const int16_t *src = self->waveform_buf.buf;
+    int16_t *dst = mip_buf;
+    for (uint8_t i = 0; i < levels; i++) {
+        halve_waveform(src, len, dst);
+        src = dst;
+        dst += len / 2;
+        len /= 2;
+    }
+    self->mip_buf = mip_buf;
+    self->mip_levels = levels;
+}
+
 void common_hal_synthio_note_set_waveform(synthio_note_obj_t *self, mp_obj_t waveform_in) {
     if (waveform_in == mp_const_none) {
         memset(&self->waveform_buf, 0, sizeof(self->waveform_buf));
@@ -102,6 +145,30 @@ void common_hal_synthio_note_set_waveform(synthio_note_obj_t *self, mp_obj_t wav
         self->waveform_buf = bufinfo_waveform;
     }
     self->waveform_obj = waveform_in;
+    synthio_note_update_mipmap(self);
+}
+
+bool common_hal_synthio_note_get_band_limited(synthio_note_obj_t *self) {
+    return self->band_limited;
+}
+
+void common_hal_synthio_note_set_band_limited(synthio_note_obj_t *self, bool value_in) {
+    self->band_limited = value_in;
+    synthio_note_update_mipmap(self);
+}
+
+const int16_t *synthio_note_get_mip_level(synthio_note_obj_t *self, uint32_t dds_rate, uint8_t *level) {
+    // Step down while more than one sample of the current level passes per output sample
+    uint8_t i = 0;
+    while (i < self->mip_levels && (dds_rate >> i) > (1 << SYNTHIO_FREQUENCY_SHIFT)) {
+        i++;
+    }
+    *level = i;
+    if (i == 0) {
+        return self->waveform_buf.buf;
+    }
+    size_t len = self->waveform_buf.len;
+    return self->mip_buf + len - (len >> (i - 1));
 }
 
 mp_obj_t common_hal_synthio_note_get_waveform_loop_start(synthio_note_obj_t *self) {
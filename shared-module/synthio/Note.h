@@ -29,6 +29,11 @@ typedef struct synthio_note_obj {
 
     mp_buffer_info_t waveform_buf;
     synthio_block_slot_t waveform_loop_start, waveform_loop_end;
+    // Band-limited copies of the waveform, each half the length of the one before, one after
+    // another. Level 0 is waveform_buf itself.
+    bool band_limited;
+    uint8_t mip_levels;
+    int16_t *mip_buf;
     mp_buffer_info_t ring_waveform_buf;
     synthio_block_slot_t ring_waveform_loop_start, ring_waveform_loop_end;
     synthio_envelope_definition_t envelope_def;
@@ -38,3 +43,5 @@ void synthio_note_recalculate(synthio_note_obj_t *self, int32_t sample_rate);
 uint32_t synthio_note_step(synthio_note_obj_t *self, int32_t sample_rate, int16_t dur, int16_t loudness[2]);
 void synthio_note_start(synthio_note_obj_t *self, int32_t sample_rate);
 bool synthio_note_playing(synthio_note_obj_t *self);
+// Pick the band-limited copy of the waveform to play at dds_rate; level 0 is the waveform itself
+const int16_t *synthio_note_get_mip_level(synthio_note_obj_t *self, uint32_t dds_rate, uint8_t *level);
@@ -49,7 +49,7 @@ audioio_get_buffer_result_t synthio_synthesizer_get_buffer(synthio_synthesizer_o
         if (!synthio_obj_is_block(item)) {
             continue;
         }
-        synthio_block_slot_t slot = { item };
+        synthio_block_slot_t slot = { .obj = item };
         (void)synthio_block_slot_get(&slot);
     }
     return GET_BUFFER_MORE_DATA;
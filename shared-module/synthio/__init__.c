@@ -151,7 +151,45 @@ int16_t synthio_mix_down_sample(int32_t sample, int32_t scale) {
     return sample;
 }
 
-static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *out_buffer32, int16_t dur, int16_t loudness[2]) {
+typedef enum {
+    SYNTH_NOTE_SKIPPED, // too high to play, or silent; nothing to filter or sum
+    SYNTH_NOTE_IN_BUFFER, // rendered into the temporary buffer without loudness applied
+    SYNTH_NOTE_SUMMED, // already added into the output buffer with loudness applied
+} synth_note_result_t;
+
+// Advances a waveform position by dur samples in one step, the same as the per-sample loop would.
+static uint32_t synth_skip_accum(uint32_t accum, uint32_t dds_rate, uint16_t dur, uint32_t offset, uint32_t lim) {
+    if (accum > lim) {
+        accum = accum % lim + offset;
+    }
+    uint64_t next = accum + (uint64_t)dds_rate * dur;
+    if (next > lim) {
+        uint32_t span = lim - offset;
+        next -= (next - lim + span - 1) / span * span;
+    }
+    return (uint32_t)next;
+}
+
+// A band-limited level is short enough that reading it without interpolation would add back
+// the aliasing it removed, so it is read with linear interpolation. The waveform itself is read
+// as it always has been, when interpolate_length is 0.
+__attribute__((always_inline))
+static inline int32_t synth_waveform_value(const int16_t *waveform, uint32_t accum, uint8_t shift, uint32_t interpolate_length) {
+    uint32_t idx = accum >> shift;
+    if (!interpolate_length) {
+        return waveform[idx];
+    }
+    if (idx >= interpolate_length) {
+        idx -= interpolate_length;
+    }
+    uint32_t next = idx + 1 == interpolate_length ? 0 : idx + 1;
+    int32_t frac = (accum >> (shift - 15)) & 0x7fff;
+    return waveform[idx] + (((waveform[next] - waveform[idx]) * frac) >> 15);
+}
+
+// If sum_buffer is not NULL the note may be summed straight into it, skipping the temporary
+// buffer, which is only possible when there's no ring modulation.
+static synth_note_result_t synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *out_buffer32, int32_t *sum_buffer, int16_t dur, int16_t loudness[2]) {
     mp_obj_t note_obj = synth->span.note_obj[chan];
 
     int32_t sample_rate = synth->base.sample_rate;
@@ -162,6 +200,9 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
     uint32_t waveform_start = 0;
     uint32_t waveform_length = synth->waveform_bufinfo.len;
 
+    uint8_t shift = SYNTHIO_FREQUENCY_SHIFT;
+    uint32_t interpolate_length = 0;
+
     uint32_t ring_dds_rate = 0;
     const int16_t *ring_waveform = NULL;
     uint32_t ring_waveform_start = 0;
@@ -187,6 +228,16 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
             waveform_length = (uint32_t)synthio_block_slot_get_limited(&note->waveform_loop_end, waveform_start + 1, waveform_length);
         }
         dds_rate = synthio_frequency_convert_scaled_to_dds((uint64_t)frequency_scaled * (waveform_length - waveform_start), sample_rate);
+        if (note->mip_levels && waveform_start == 0 && waveform_length == note->waveform_buf.len) {
+            // The phase stays in units of the full waveform; a shorter level is indexed by
+            // shifting it further
+            uint8_t level;
+            waveform = synthio_note_get_mip_level(note, dds_rate, &level);
+            shift += level;
+            if (level) {
+                interpolate_length = waveform_length >> level;
+            }
+        }
         if (note->ring_frequency_scaled != 0 && note->ring_waveform_buf.buf) {
             ring_waveform = note->ring_waveform_buf.buf;
             ring_waveform_length = note->ring_waveform_buf.len;
@@ -206,7 +257,17 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
 
     if (dds_rate > lim / 2) {
         // beyond nyquist, can't play note
-        return false;
+        return SYNTH_NOTE_SKIPPED;
+    }
+
+    // A silent note only has to keep its phase
+    if (sum_buffer && loudness[0] == 0 && loudness[1] == 0) {
+        synth->accum[chan] = synth_skip_accum(accum, dds_rate, dur, offset, lim);
+        if (ring_dds_rate && ring_dds_rate <= lim / 2) {
+            synth->ring_accum[chan] = synth_skip_accum(synth->ring_accum[chan], ring_dds_rate, dur,
+                ring_waveform_start << SYNTHIO_FREQUENCY_SHIFT, ring_waveform_length << SYNTHIO_FREQUENCY_SHIFT);
+        }
+        return SYNTH_NOTE_SKIPPED;
     }
 
     // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
@@ -214,6 +275,31 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
         accum = accum % lim + offset;
     }
 
+    if (sum_buffer && !ring_dds_rate) {
+        // No ring modulation, so rendering and applying loudness happen in one pass
+        if (synth->base.channel_count == 1) {
+            for (uint16_t i = 0; i < dur; i++) {
+                accum += dds_rate;
+                if (accum > lim) {
+                    accum = accum - lim + offset;
+                }
+                *sum_buffer++ += (synth_waveform_value(waveform, accum, shift, interpolate_length) * loudness[0]) >> 16;
+            }
+        } else {
+            for (uint16_t i = 0; i < dur; i++) {
+                accum += dds_rate;
+                if (accum > lim) {
+                    accum = accum - lim + offset;
+                }
+                int32_t value = synth_waveform_value(waveform, accum, shift, interpolate_length);
+                *sum_buffer++ += (value * loudness[0]) >> 16;
+                *sum_buffer++ += (value * loudness[1]) >> 16;
+            }
+        }
+        synth->accum[chan] = accum;
+        return SYNTH_NOTE_SUMMED;
+    }
+
     // first, fill with waveform
     for (uint16_t i = 0; i < dur; i++) {
         accum += dds_rate;
@@ -221,16 +307,14 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
         if (accum > lim) {
             accum = accum - lim + offset;
         }
-        int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
-        out_buffer32[i] = waveform[idx];
+        out_buffer32[i] = synth_waveform_value(waveform, accum, shift, interpolate_length);
     }
     synth->accum[chan] = accum;
 
     if (ring_dds_rate) {
         if (ring_dds_rate > lim / 2) {
-            // beyond nyquist, can't play ring (but did synth main sound so
-            // return true)
-            return true;
+            // beyond nyquist, can't play ring (but did synth main sound)
+            return SYNTH_NOTE_IN_BUFFER;
         }
 
         // now modulate by ring and accumulate
@@ -255,7 +339,7 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
         }
         synth->ring_accum[chan] = accum;
     }
-    return true;
+    return SYNTH_NOTE_IN_BUFFER;
 }
 
 static mp_obj_t synthio_synth_get_note_filter(mp_obj_t note_obj) {
@@ -317,13 +401,17 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
 
         int16_t loudness[2] = {synth->envelope_state[chan].level, synth->envelope_state[chan].level};
 
-        if (!synth_note_into_buffer(synth, chan, tmp_buffer32, dur, loudness)) {
-            // for some other reason, such as being above nyquist, note
-            // couldn't be synthed, so don't filter or sum it in
+        // A filtered note has to go through the temporary buffer, and always runs so the
+        // filter state follows the signal
+        mp_obj_t filter_obj = synthio_synth_get_note_filter(note_obj);
+        int32_t *sum_buffer = filter_obj == mp_const_none ? out_buffer32 : NULL;
+        synth_note_result_t result = synth_note_into_buffer(synth, chan, tmp_buffer32, sum_buffer, dur, loudness);
+        if (result != SYNTH_NOTE_IN_BUFFER) {
+            // either summed in already, or for some other reason, such as being above
+            // nyquist, the note couldn't be synthed, so don't filter or sum it in
             continue;
         }
 
-        mp_obj_t filter_obj = synthio_synth_get_note_filter(note_obj);
         if (filter_obj != mp_const_none) {
             synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
             common_hal_synthio_biquad_tick(filter_obj);
@@ -437,6 +525,20 @@ static int find_channel_with_note(synthio_synth_t *synth, mp_obj_t note) {
     return result;
 }
 
+// Every voice is held, so steal the one that has been playing longest
+static int find_oldest_channel(synthio_synth_t *synth) {
+    int result = -1;
+    uint32_t age = 0;
+    for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
+        uint32_t chan_age = synth->note_counter - synth->note_started[chan];
+        if (result == -1 || chan_age > age) {
+            result = chan;
+            age = chan_age;
+        }
+    }
+    return result;
+}
+
 bool synthio_span_change_note(synthio_synth_t *synth, mp_obj_t old_note, mp_obj_t new_note) {
     int channel;
     if (new_note != SYNTHIO_SILENCE && (channel = find_channel_with_note(synth, new_note)) != -1) {
@@ -445,6 +547,9 @@ bool synthio_span_change_note(synthio_synth_t *synth, mp_obj_t old_note, mp_obj_
         return true;
     }
     channel = find_channel_with_note(synth, old_note);
+    if (channel == -1 && old_note == SYNTHIO_SILENCE && new_note != SYNTHIO_SILENCE) {
+        channel = find_oldest_channel(synth);
+    }
     if (channel != -1) {
         if (new_note == SYNTHIO_SILENCE) {
             synthio_envelope_state_release(&synth->envelope_state[channel], synthio_synth_get_note_envelope(synth, old_note));
@@ -452,6 +557,7 @@ bool synthio_span_change_note(synthio_synth_t *synth, mp_obj_t old_note, mp_obj_
             synth->span.note_obj[channel] = new_note;
             synthio_envelope_state_init(&synth->envelope_state[channel], synthio_synth_get_note_envelope(synth, new_note));
             synth->accum[channel] = 0;
+            synth->note_started[channel] = synth->note_counter++;
         }
         return true;
     }
@@ -479,8 +585,8 @@ void shared_bindings_synthio_lfo_tick(uint32_t sample_rate, uint16_t num_samples
 
 mp_float_t synthio_block_slot_get(synthio_block_slot_t *slot) {
     // all numbers (and None!) previously converted to float in synthio_block_assign_slot
-    if (mp_obj_is_float(slot->obj)) {
-        return mp_obj_get_float(slot->obj);
+    if (slot->constant) {
+        return slot->value;
     }
 
     synthio_block_base_t *block = MP_OBJ_TO_PTR(slot->obj);
@@ -515,6 +621,7 @@ int32_t synthio_block_slot_get_scaled(synthio_block_slot_t *lfo_slot, mp_float_t
 bool synthio_block_assign_slot_maybe(mp_obj_t obj, synthio_block_slot_t *slot) {
     if (synthio_obj_is_block(obj)) {
         slot->obj = obj;
+        slot->constant = false;
         return true;
     }
 
@@ -524,6 +631,8 @@ bool synthio_block_assign_slot_maybe(mp_obj_t obj, synthio_block_slot_t *slot) {
     }
 
     slot->obj = mp_obj_new_float(value);
+    slot->constant = true;
+    slot->value = mp_obj_get_float(slot->obj);
     return true;
 }
 
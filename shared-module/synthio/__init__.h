@@ -55,6 +55,9 @@ typedef struct synthio_synth {
     uint32_t accum[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
     uint32_t ring_accum[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
     synthio_envelope_state_t envelope_state[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
+    // When every voice is held, the one with the oldest note_started value is stolen
+    uint32_t note_counter;
+    uint32_t note_started[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
 } synthio_synth_t;
 
 typedef struct {
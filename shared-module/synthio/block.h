@@ -20,6 +20,9 @@ typedef struct synthio_block_base {
 
 typedef struct synthio_block_slot {
     mp_obj_t obj;
+    // A number assigned to the slot is kept here as well, so reading it doesn't touch the heap
+    bool constant;
+    mp_float_t value;
 } synthio_block_slot_t;
 
 typedef struct {
@@ -22,6 +22,9 @@
 
 #include "supervisor/shared/serial.h"
 
+// Most characters printed in one go are drawn with a single tile grid update per this many.
+#define TERMINALIO_WRITE_RUN_LENGTH (32)
+
 uint16_t terminalio_terminal_get_glyph_index(mp_obj_t font, mp_uint_t codepoint, bool *is_full_width) {
     if (is_full_width != NULL) {
         *is_full_width = false;  // Default to not full width
@@ -84,7 +87,8 @@ static void release_current_glyph(displayio_tilegrid_t *tilegrid, mp_obj_t font,
     #endif
 }
 
-static void terminalio_terminal_set_tile(terminalio_terminal_obj_t *self, bool status_bar, mp_uint_t character, bool release_glyphs) {
+// Places a glyph that has already been looked up at the cursor, wrapping as needed.
+static void terminalio_terminal_put_glyph(terminalio_terminal_obj_t *self, bool status_bar, uint16_t new_tile, bool is_full_width, bool release_glyphs) {
     displayio_tilegrid_t *tilegrid = self->scroll_area;
     uint16_t *x = &self->cursor_x;
     uint16_t *y = &self->cursor_y;
@@ -97,15 +101,6 @@ static void terminalio_terminal_set_tile(terminalio_terminal_obj_t *self, bool s
         w = self->status_bar->width_in_tiles;
         h = self->status_bar->height_in_tiles;
     }
-    if (release_glyphs) {
-        release_current_glyph(tilegrid, self->font, *x, *y);
-    }
-    bool is_full_width;
-    uint16_t new_tile = terminalio_terminal_get_glyph_index(self->font, character, &is_full_width);
-    if (new_tile == 0xffff) {
-        // Missing glyph.
-        return;
-    }
     // If there is only half width left, then fill it with a space and wrap to the next line.
     if (is_full_width && *x == w - 1) {
         uint16_t space = terminalio_terminal_get_glyph_index(self->font, ' ', NULL);
@@ -129,6 +124,57 @@ static void terminalio_terminal_set_tile(terminalio_terminal_obj_t *self, bool s
     }
 }
 
+static void terminalio_terminal_set_tile(terminalio_terminal_obj_t *self, bool status_bar, mp_uint_t character, bool release_glyphs) {
+    if (release_glyphs) {
+        if (status_bar) {
+            release_current_glyph(self->status_bar, self->font, self->status_x, self->status_y);
+        } else {
+            release_current_glyph(self->scroll_area, self->font, self->cursor_x, self->cursor_y);
+        }
+    }
+    bool is_full_width;
+    uint16_t new_tile = terminalio_terminal_get_glyph_index(self->font, character, &is_full_width);
+    if (new_tile == 0xffff) {
+        // Missing glyph.
+        return;
+    }
+    terminalio_terminal_put_glyph(self, status_bar, new_tile, is_full_width, release_glyphs);
+}
+
+// Writes a run of printable characters along the cursor row, updating the tile grid once
+// for the whole run instead of once per character. Returns where the run stopped.
+static const byte *terminalio_terminal_write_run(terminalio_terminal_obj_t *self, const byte *i, const byte *end) {
+    displayio_tilegrid_t *tilegrid = self->scroll_area;
+    uint16_t tiles[TERMINALIO_WRITE_RUN_LENGTH];
+    uint16_t count = 0;
+    uint16_t x = self->cursor_x;
+    while (i < end && count < TERMINALIO_WRITE_RUN_LENGTH && x + count < tilegrid->width_in_tiles) {
+        unichar c = utf8_get_char(i);
+        if (c < 0x20) {
+            break;
+        }
+        i = utf8_next_char(i);
+        // The tiles aren't written until the end so this still releases what was shown.
+        release_current_glyph(tilegrid, self->font, x + count, self->cursor_y);
+        bool is_full_width;
+        uint16_t new_tile = terminalio_terminal_get_glyph_index(self->font, c, &is_full_width);
+        if (new_tile == 0xffff) {
+            // Missing glyph.
+            continue;
+        }
+        if (is_full_width) {
+            common_hal_displayio_tilegrid_set_tiles(tilegrid, x, self->cursor_y, tiles, count);
+            self->cursor_x = x + count;
+            terminalio_terminal_put_glyph(self, false, new_tile, true, true);
+            return i;
+        }
+        tiles[count++] = new_tile;
+    }
+    common_hal_displayio_tilegrid_set_tiles(tilegrid, x, self->cursor_y, tiles, count);
+    self->cursor_x = x + count;
+    return i;
+}
+
 // Helper function to set all tiles in a tilegrid with optional glyph release
 static void terminalio_terminal_set_all_tiles(terminalio_terminal_obj_t *self, bool status_bar, mp_uint_t character, bool release_glyphs) {
     uint16_t *x = &self->cursor_x;
@@ -203,6 +249,7 @@ size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, con
     const byte *i = data;
     uint16_t start_y = self->cursor_y;
     while (i < data + len) {
+        const byte *char_start = i;
         unichar c = utf8_get_char(i);
         i = utf8_next_char(i);
         if (self->in_osc_command) {
@@ -407,7 +454,7 @@ size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, con
                 }
             }
         } else {
-            terminalio_terminal_set_tile(self, false, c, true);
+            i = terminalio_terminal_write_run(self, char_start, data + len);
         }
         if (self->cursor_x >= self->scroll_area->width_in_tiles) {
             self->cursor_y++;
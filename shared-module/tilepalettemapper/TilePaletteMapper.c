@@ -70,8 +70,16 @@ void common_hal_tilepalettemapper_tilepalettemapper_set_mapping(tilepalettemappe
     self->needs_refresh = true;
 }
 
-void tilepalettemapper_tilepalettemapper_get_color(tilepalettemapper_tilepalettemapper_t *self, const _displayio_colorspace_t *colorspace, displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color, uint16_t x_tile_index, uint16_t y_tile_index) {
+const uint32_t *tilepalettemapper_tilepalettemapper_get_tile_mapping(tilepalettemapper_tilepalettemapper_t *self, uint16_t x_tile_index, uint16_t y_tile_index) {
     if (x_tile_index >= self->width_in_tiles || y_tile_index >= self->height_in_tiles) {
+        return NULL;
+    }
+    return self->tile_mappings[y_tile_index * self->width_in_tiles + x_tile_index];
+}
+
+void tilepalettemapper_tilepalettemapper_get_color(tilepalettemapper_tilepalettemapper_t *self, const _displayio_colorspace_t *colorspace, displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color, uint16_t x_tile_index, uint16_t y_tile_index) {
+    if (x_tile_index >= self->width_in_tiles || y_tile_index >= self->height_in_tiles ||
+        input_pixel->pixel >= self->input_color_count) {
         if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
             displayio_palette_get_color(self->pixel_shader, colorspace, input_pixel, output_color);
         } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
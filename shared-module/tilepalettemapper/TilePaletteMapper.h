@@ -26,4 +26,8 @@ typedef struct {
 bool tilepalettemapper_tilepalettemapper_needs_refresh(tilepalettemapper_tilepalettemapper_t *self);
 void tilepalettemapper_tilepalettemapper_finish_refresh(tilepalettemapper_tilepalettemapper_t *self);
 
+// The palette indices that colors of the tile at a grid location map to, indexed by input color.
+// NULL outside the mapper's grid, where colors aren't remapped.
+const uint32_t *tilepalettemapper_tilepalettemapper_get_tile_mapping(tilepalettemapper_tilepalettemapper_t *self, uint16_t x_tile_index, uint16_t y_tile_index);
+
 void tilepalettemapper_tilepalettemapper_get_color(tilepalettemapper_tilepalettemapper_t *self, const _displayio_colorspace_t *colorspace, displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color, uint16_t x_tile_index, uint16_t y_tile_index);
@@ -13,6 +13,7 @@
 #include "py/runtime.h"
 #include "shared/runtime/interrupt_char.h"
 #include "shared-bindings/usb/core/__init__.h"
+#include "shared-bindings/usb/core/EndpointStream.h"
 #include "shared-bindings/usb/util/__init__.h"
 #include "shared-module/usb/utf16le.h"
 #include "supervisor/shared/tick.h"
@@ -59,6 +60,9 @@ void common_hal_usb_core_device_deinit(usb_core_device_obj_t *self) {
     }
     size_t open_size = sizeof(self->open_endpoints);
     for (size_t i = 0; i < open_size; i++) {
+        if (self->streams[i] != NULL) {
+            usb_core_endpoint_stream_stop(self->streams[i]);
+        }
         if (self->open_endpoints[i] != 0) {
             tuh_edpt_close(self->device_address, self->open_endpoints[i]);
             self->open_endpoints[i] = 0;
@@ -250,24 +254,24 @@ static size_t _xfer(tuh_xfer_t *xfer, mp_int_t timeout) {
     return 0;
 }
 
-static bool _open_endpoint(usb_core_device_obj_t *self, mp_int_t endpoint) {
-    bool endpoint_open = false;
+int usb_core_device_open_endpoint(usb_core_device_obj_t *self, mp_int_t endpoint, uint16_t *max_packet_size) {
     size_t open_size = sizeof(self->open_endpoints);
+    size_t slot = open_size;
     size_t first_free = open_size;
     for (size_t i = 0; i < open_size; i++) {
         if (self->open_endpoints[i] == endpoint) {
-            endpoint_open = true;
+            slot = i;
         } else if (first_free == open_size && self->open_endpoints[i] == 0) {
             first_free = i;
         }
     }
-    if (endpoint_open) {
-        return true;
+    if (slot < open_size && max_packet_size == NULL) {
+        return slot;
     }
 
     if (self->configuration_descriptor == NULL) {
         mp_raise_usb_core_USBError(MP_ERROR_TEXT("No configuration set"));
-        return false;
+        return -1;
     }
 
     tusb_desc_configuration_t *desc_cfg = (tusb_desc_configuration_t *)self->configuration_descriptor;
@@ -288,19 +292,28 @@ static bool _open_endpoint(usb_core_device_obj_t *self, mp_int_t endpoint) {
         p_desc = tu_desc_next(p_desc);
     }
     if (p_desc >= desc_end) {
-        return false;
+        return -1;
     }
     tusb_desc_endpoint_t const *desc_ep = (tusb_desc_endpoint_t const *)p_desc;
-
-    bool open = tuh_edpt_open(self->device_address, desc_ep);
-    if (open) {
-        self->open_endpoints[first_free] = endpoint;
+    if (max_packet_size != NULL) {
+        *max_packet_size = tu_edpt_packet_size(desc_ep);
     }
-    return open;
+    if (slot < open_size) {
+        return slot;
+    }
+    if (first_free == open_size || !tuh_edpt_open(self->device_address, desc_ep)) {
+        return -1;
+    }
+    self->open_endpoints[first_free] = endpoint;
+    return first_free;
+}
+
+bool usb_core_device_mounted(usb_core_device_obj_t *self) {
+    return (_mounted_devices & (1 << self->device_address)) != 0;
 }
 
 mp_int_t common_hal_usb_core_device_write(usb_core_device_obj_t *self, mp_int_t endpoint, const uint8_t *buffer, mp_int_t len, mp_int_t timeout) {
-    if (!_open_endpoint(self, endpoint)) {
+    if (usb_core_device_open_endpoint(self, endpoint, NULL) < 0) {
         mp_raise_usb_core_USBError(NULL);
         return 0;
     }
@@ -313,7 +326,7 @@ mp_int_t common_hal_usb_core_device_write(usb_core_device_obj_t *self, mp_int_t
 }
 
 mp_int_t common_hal_usb_core_device_read(usb_core_device_obj_t *self, mp_int_t endpoint, uint8_t *buffer, mp_int_t len, mp_int_t timeout) {
-    if (!_open_endpoint(self, endpoint)) {
+    if (usb_core_device_open_endpoint(self, endpoint, NULL) < 0) {
         mp_raise_usb_core_USBError(NULL);
         return 0;
     }
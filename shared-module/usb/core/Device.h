@@ -8,11 +8,21 @@
 
 #include "py/obj.h"
 
+#define USB_CORE_DEVICE_MAX_OPEN_ENDPOINTS (8)
+
 typedef struct {
     mp_obj_base_t base;
     uint8_t device_address;
     uint8_t configuration_index; // not bConfigurationValue
     uint8_t *configuration_descriptor; // Contains the length of the all descriptors.
-    uint8_t open_endpoints[8];
+    uint8_t open_endpoints[USB_CORE_DEVICE_MAX_OPEN_ENDPOINTS];
+    // Streams queueing transfers on the endpoint in the same slot of open_endpoints.
+    struct usb_core_endpoint_stream_obj *streams[USB_CORE_DEVICE_MAX_OPEN_ENDPOINTS];
     uint16_t first_langid;
 } usb_core_device_obj_t;
+
+// Open the endpoint if needed and return its slot in open_endpoints, or -1 if
+// the configuration doesn't have it. The max packet size is stored in
+// max_packet_size when it isn't NULL.
+int usb_core_device_open_endpoint(usb_core_device_obj_t *self, mp_int_t endpoint, uint16_t *max_packet_size);
+bool usb_core_device_mounted(usb_core_device_obj_t *self);
@@ -0,0 +1,182 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 CircuitPython contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/usb/core/EndpointStream.h"
+
+#include "tusb_config.h"
+
+#include "lib/tinyusb/src/host/usbh.h"
+#include "py/mperrno.h"
+#include "py/runtime.h"
+#include "py/stream.h"
+#include "shared-bindings/usb/core/__init__.h"
+
+// Transfers are this many packets at most so that bulk endpoints move data in
+// bigger chunks than one packet per callback.
+#ifndef CIRCUITPY_USB_HOST_STREAM_PACKETS_PER_TRANSFER
+#define CIRCUITPY_USB_HOST_STREAM_PACKETS_PER_TRANSFER (4)
+#endif
+
+static bool _is_in(usb_core_endpoint_stream_obj_t *self) {
+    return tu_edpt_dir(self->endpoint) == TUSB_DIR_IN;
+}
+
+static void _queue_transfer(usb_core_endpoint_stream_obj_t *self);
+
+// Runs from tuh_task() in the background, not in an interrupt.
+static void _transfer_done_cb(tuh_xfer_t *xfer) {
+    usb_core_endpoint_stream_obj_t *self = (usb_core_endpoint_stream_obj_t *)xfer->user_data;
+    self->busy = false;
+    if (xfer->result != XFER_RESULT_SUCCESS) {
+        self->error = xfer->result;
+        return;
+    }
+    if (_is_in(self)) {
+        ringbuf_put_n(&self->ringbuf, self->xfer_buffer, xfer->actual_len);
+    }
+    _queue_transfer(self);
+}
+
+// Keep one transfer queued with TinyUSB for as long as there is room for what
+// it reads or data for it to write.
+static void _queue_transfer(usb_core_endpoint_stream_obj_t *self) {
+    if (self->busy || self->error != 0 || self->xfer_buffer == NULL) {
+        return;
+    }
+    uint32_t len;
+    if (_is_in(self)) {
+        if (ringbuf_num_empty(&self->ringbuf) < self->xfer_size) {
+            return;
+        }
+        len = self->xfer_size;
+    } else {
+        len = ringbuf_get_n(&self->ringbuf, self->xfer_buffer, self->xfer_size);
+        if (len == 0) {
+            return;
+        }
+    }
+    tuh_xfer_t xfer = {
+        .daddr = self->device->device_address,
+        .ep_addr = self->endpoint,
+        .buflen = len,
+        .buffer = self->xfer_buffer,
+        .complete_cb = _transfer_done_cb,
+        .user_data = (uintptr_t)self,
+    };
+    self->busy = true;
+    self->in_flight = len;
+    if (!tuh_edpt_xfer(&xfer)) {
+        self->busy = false;
+        self->error = XFER_RESULT_FAILED;
+    }
+}
+
+void common_hal_usb_core_endpoint_stream_construct(usb_core_endpoint_stream_obj_t *self,
+    usb_core_device_obj_t *device, mp_int_t endpoint, size_t buffer_size) {
+    uint16_t max_packet_size = 0;
+    int slot = usb_core_device_open_endpoint(device, endpoint, &max_packet_size);
+    if (slot < 0 || max_packet_size == 0) {
+        mp_raise_usb_core_USBError(NULL);
+    }
+    if (device->streams[slot] != NULL) {
+        mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q in use"), MP_QSTR_endpoint);
+    }
+    self->device = device;
+    self->endpoint = endpoint;
+    self->xfer_size = max_packet_size * CIRCUITPY_USB_HOST_STREAM_PACKETS_PER_TRANSFER;
+    // Always have room for a whole transfer.
+    buffer_size = MAX(buffer_size, self->xfer_size);
+    self->xfer_buffer = m_malloc(self->xfer_size);
+    if (!ringbuf_alloc(&self->ringbuf, buffer_size)) {
+        m_malloc_fail(buffer_size);
+    }
+    self->busy = false;
+    self->error = 0;
+    device->streams[slot] = self;
+    _queue_transfer(self);
+}
+
+bool common_hal_usb_core_endpoint_stream_deinited(usb_core_endpoint_stream_obj_t *self) {
+    return self->xfer_buffer == NULL;
+}
+
+void usb_core_endpoint_stream_stop(usb_core_endpoint_stream_obj_t *self) {
+    if (self->busy) {
+        tuh_edpt_abort_xfer(self->device->device_address, self->endpoint);
+        self->busy = false;
+    }
+    for (size_t i = 0; i < MP_ARRAY_SIZE(self->device->streams); i++) {
+        if (self->device->streams[i] == self) {
+            self->device->streams[i] = NULL;
+        }
+    }
+    ringbuf_deinit(&self->ringbuf);
+    self->xfer_buffer = NULL;
+}
+
+void common_hal_usb_core_endpoint_stream_deinit(usb_core_endpoint_stream_obj_t *self) {
+    if (common_hal_usb_core_endpoint_stream_deinited(self)) {
+        return;
+    }
+    usb_core_endpoint_stream_stop(self);
+}
+
+static bool _check_error(usb_core_endpoint_stream_obj_t *self, int *errcode) {
+    if (self->error != 0 || !usb_core_device_mounted(self->device)) {
+        *errcode = MP_EIO;
+        return true;
+    }
+    return false;
+}
+
+size_t common_hal_usb_core_endpoint_stream_read(usb_core_endpoint_stream_obj_t *self, uint8_t *data, size_t len, int *errcode) {
+    size_t count = ringbuf_get_n(&self->ringbuf, data, len);
+    // Reading may have made room to queue the next transfer.
+    _queue_transfer(self);
+    if (count == 0) {
+        if (!_check_error(self, errcode)) {
+            *errcode = MP_EAGAIN;
+        }
+        return MP_STREAM_ERROR;
+    }
+    return count;
+}
+
+size_t common_hal_usb_core_endpoint_stream_write(usb_core_endpoint_stream_obj_t *self, const uint8_t *data, size_t len, int *errcode) {
+    if (_check_error(self, errcode)) {
+        return MP_STREAM_ERROR;
+    }
+    size_t count = ringbuf_put_n(&self->ringbuf, data, len);
+    _queue_transfer(self);
+    if (count == 0) {
+        *errcode = MP_EAGAIN;
+        return MP_STREAM_ERROR;
+    }
+    return count;
+}
+
+uint32_t common_hal_usb_core_endpoint_stream_get_in_waiting(usb_core_endpoint_stream_obj_t *self) {
+    return _is_in(self) ? ringbuf_num_filled(&self->ringbuf) : 0;
+}
+
+uint32_t common_hal_usb_core_endpoint_stream_get_out_waiting(usb_core_endpoint_stream_obj_t *self) {
+    if (_is_in(self)) {
+        return 0;
+    }
+    return ringbuf_num_filled(&self->ringbuf) + (self->busy ? self->in_flight : 0);
+}
+
+bool common_hal_usb_core_endpoint_stream_readable(usb_core_endpoint_stream_obj_t *self) {
+    return _is_in(self) && (ringbuf_num_filled(&self->ringbuf) > 0 || self->error != 0);
+}
+
+bool common_hal_usb_core_endpoint_stream_writable(usb_core_endpoint_stream_obj_t *self) {
+    return !_is_in(self) && (ringbuf_num_empty(&self->ringbuf) > 0 || self->error != 0);
+}
+
+mp_int_t common_hal_usb_core_endpoint_stream_get_endpoint(usb_core_endpoint_stream_obj_t *self) {
+    return self->endpoint;
+}
@@ -0,0 +1,32 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 CircuitPython contributors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+#include "py/ringbuf.h"
+#include "shared-module/usb/core/Device.h"
+
+typedef struct usb_core_endpoint_stream_obj {
+    mp_obj_base_t base;
+    usb_core_device_obj_t *device;
+    // Data received but not read yet, or written but not sent yet.
+    ringbuf_t ringbuf;
+    // Staging buffer TinyUSB transfers in and out of. It is a multiple of the
+    // max packet size so a transfer never overruns it.
+    uint8_t *xfer_buffer;
+    uint16_t xfer_size;
+    // Length of the queued transfer.
+    uint16_t in_flight;
+    uint8_t endpoint;
+    // A transfer is queued with TinyUSB.
+    volatile bool busy;
+    // The last transfer failed with this xfer_result_t.
+    volatile uint8_t error;
+} usb_core_endpoint_stream_obj_t;
+
+// Called by Device when it is deinit or the device goes away.
+void usb_core_endpoint_stream_stop(usb_core_endpoint_stream_obj_t *self);
@@ -60,8 +60,12 @@ size_t common_hal_usb_cdc_serial_write(usb_cdc_serial_obj_t *self, const uint8_t
 
     // Write as many bytes as possible immediately.
     // The number of bytes written at once will not be larger than what can fit in the TinyUSB FIFO.
+    // TinyUSB sends each full packet as it fills. Flushing also sends the partial packet left at
+    // the end, which many small writes turn into many small packets.
     uint32_t total_num_written = tud_cdc_n_write(self->idx, data, len);
-    tud_cdc_n_write_flush(self->idx);
+    if (self->auto_flush) {
+        tud_cdc_n_write_flush(self->idx);
+    }
 
     if (wait_forever || wait_for_timeout) {
         // Continue writing the rest of the buffer.
@@ -89,7 +93,9 @@ size_t common_hal_usb_cdc_serial_write(usb_cdc_serial_obj_t *self, const uint8_t
 
             // Try to write another batch of bytes.
             num_written = tud_cdc_n_write(self->idx, data, len);
-            tud_cdc_n_write_flush(self->idx);
+            if (self->auto_flush) {
+                tud_cdc_n_write_flush(self->idx);
+            }
             total_num_written += num_written;
         }
     }
@@ -115,7 +121,21 @@ uint32_t common_hal_usb_cdc_serial_reset_output_buffer(usb_cdc_serial_obj_t *sel
 }
 
 uint32_t common_hal_usb_cdc_serial_flush(usb_cdc_serial_obj_t *self) {
-    return tud_cdc_n_write_flush(self->idx);
+    uint32_t flushed = tud_cdc_n_write_flush(self->idx);
+    // Wait, as long as write_timeout allows, until the host has taken everything.
+    const bool wait_forever = self->write_timeout < 0.0f;
+    uint64_t timeout_ms = float_to_uint64(self->write_timeout * 1000);  // Junk value if write_timeout < 0.
+    uint64_t start_ticks = supervisor_ticks_ms64();
+    while (common_hal_usb_cdc_serial_get_out_waiting(self) > 0 &&
+           tud_cdc_n_connected(self->idx) &&
+           (wait_forever || supervisor_ticks_ms64() - start_ticks <= timeout_ms)) {
+        RUN_BACKGROUND_TASKS;
+        if (mp_hal_is_interrupted()) {
+            break;
+        }
+        tud_cdc_n_write_flush(self->idx);
+    }
+    return flushed;
 }
 
 bool common_hal_usb_cdc_serial_get_connected(usb_cdc_serial_obj_t *self) {
@@ -137,3 +157,11 @@ mp_float_t common_hal_usb_cdc_serial_get_write_timeout(usb_cdc_serial_obj_t *sel
 void common_hal_usb_cdc_serial_set_write_timeout(usb_cdc_serial_obj_t *self, mp_float_t write_timeout) {
     self->write_timeout = write_timeout;
 }
+
+bool common_hal_usb_cdc_serial_get_auto_flush(usb_cdc_serial_obj_t *self) {
+    return self->auto_flush;
+}
+
+void common_hal_usb_cdc_serial_set_auto_flush(usb_cdc_serial_obj_t *self, bool auto_flush) {
+    self->auto_flush = auto_flush;
+}
@@ -13,4 +13,5 @@ typedef struct {
     mp_float_t timeout;       // if negative, wait forever.
     mp_float_t write_timeout; // if negative, wait forever.
     uint8_t idx;              // which CDC device?
+    bool auto_flush;          // send what write() leaves in the FIFO without waiting to fill a packet
 } usb_cdc_serial_obj_t;
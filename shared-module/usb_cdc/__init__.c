@@ -137,12 +137,14 @@ static usb_cdc_serial_obj_t usb_cdc_console_obj = {
     .base.type = &usb_cdc_serial_type,
     .timeout = -1.0f,
     .write_timeout = -1.0f,
+    .auto_flush = true,
 };
 
 static usb_cdc_serial_obj_t usb_cdc_data_obj = {
     .base.type = &usb_cdc_serial_type,
     .timeout = -1.0f,
     .write_timeout = -1.0f,
+    .auto_flush = true,
 };
 
 static bool usb_cdc_console_is_enabled;
@@ -12,6 +12,7 @@
 #include "shared-bindings/usb_hid/Device.h"
 #include "shared-module/usb_hid/__init__.h"
 #include "shared-module/usb_hid/Device.h"
+#include "supervisor/background_callback.h"
 #include "supervisor/shared/tick.h"
 #include "tusb.h"
 
@@ -146,6 +147,79 @@ const usb_hid_device_obj_t usb_hid_device_consumer_control_obj = {
 
 char *custom_usb_hid_interface_name;
 
+#if CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH > 0
+// The size of the IN endpoint. Longer reports are sent on their own, without the queue.
+#define QUEUED_REPORT_MAX_LENGTH (64)
+
+// Reports wait here to be sent as the host polls for them, so that send_report() doesn't wait for
+// the endpoint each time and reports go out back to back. All devices share one endpoint.
+typedef struct {
+    uint8_t report_id;
+    uint8_t len;
+    uint8_t report[QUEUED_REPORT_MAX_LENGTH];
+} queued_report_t;
+
+static queued_report_t report_queue[CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH];
+static uint8_t report_queue_start;
+static uint8_t report_queue_count;
+static background_callback_t report_queue_callback;
+
+static void send_queued_report(void) {
+    if (report_queue_count == 0 || tud_suspended() || !tud_hid_ready()) {
+        return;
+    }
+    queued_report_t *queued = &report_queue[report_queue_start];
+    // The endpoint keeps its own copy, so the entry is free once the report is accepted.
+    if (tud_hid_report(queued->report_id, queued->report, queued->len)) {
+        report_queue_start = (report_queue_start + 1) % CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH;
+        report_queue_count--;
+    }
+}
+
+static void send_queued_report_cb(void *data) {
+    (void)data;
+    send_queued_report();
+}
+
+// Chooses the most recently queued report with the same id, which hasn't been sent yet.
+static queued_report_t *find_queued_report(uint8_t report_id) {
+    for (uint8_t i = report_queue_count; i > 0; i--) {
+        queued_report_t *queued =
+            &report_queue[(report_queue_start + i - 1) % CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH];
+        if (queued->report_id == report_id) {
+            return queued;
+        }
+    }
+    return NULL;
+}
+
+// Invoked when the host has taken a report. This may be in the USB task, not the VM's, so the
+// next report is sent from a background callback.
+void tud_hid_report_complete_cb(uint8_t instance, uint8_t const *report, uint16_t len) {
+    (void)instance;
+    (void)report;
+    (void)len;
+    if (report_queue_count > 0) {
+        background_callback_add(&report_queue_callback, send_queued_report_cb, NULL);
+    }
+}
+#endif
+
+size_t usb_hid_device_reports_queued(void) {
+    #if CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH > 0
+    return report_queue_count;
+    #else
+    return 0;
+    #endif
+}
+
+void usb_hid_device_reset_report_queue(void) {
+    #if CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH > 0
+    report_queue_start = 0;
+    report_queue_count = 0;
+    #endif
+}
+
 static size_t get_report_id_idx(usb_hid_device_obj_t *self, size_t report_id) {
     for (size_t i = 0; i < self->num_report_ids; i++) {
         if (report_id == self->report_ids[i]) {
@@ -199,16 +273,44 @@ uint16_t common_hal_usb_hid_device_get_usage(usb_hid_device_obj_t *self) {
     return self->usage;
 }
 
-void common_hal_usb_hid_device_send_report(usb_hid_device_obj_t *self, uint8_t *report, uint8_t len, uint8_t report_id) {
+void common_hal_usb_hid_device_send_report(usb_hid_device_obj_t *self, uint8_t *report, uint8_t len, uint8_t report_id, bool coalesce) {
     // report_id and len have already been validated for this device.
     size_t id_idx = get_report_id_idx(self, report_id);
 
     mp_arg_validate_length(len, self->in_report_lengths[id_idx], MP_QSTR_report);
 
-    // Wait until interface is ready, timeout = 2 seconds
+    #if CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH > 0
+    if (len <= QUEUED_REPORT_MAX_LENGTH && !tud_suspended()) {
+        queued_report_t *queued = coalesce ? find_queued_report(report_id) : NULL;
+        if (queued == NULL) {
+            // Wait until there is room, timeout = 2 seconds
+            uint64_t end_ticks = supervisor_ticks_ms64() + 2000;
+            while ((supervisor_ticks_ms64() < end_ticks) &&
+                   report_queue_count == CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH) {
+                RUN_BACKGROUND_TASKS;
+                send_queued_report();
+            }
+            if (report_queue_count == CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH) {
+                mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("USB busy"));
+            }
+            queued = &report_queue[(report_queue_start + report_queue_count) % CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH];
+            report_queue_count++;
+        }
+        queued->report_id = report_id;
+        queued->len = len;
+        memcpy(queued->report, report, len);
+        send_queued_report();
+        return;
+    }
+    #endif
+
+    // Wait until interface is ready, and queued reports have been sent, timeout = 2 seconds
     uint64_t end_ticks = supervisor_ticks_ms64() + 2000;
-    while ((supervisor_ticks_ms64() < end_ticks) && !tud_hid_ready()) {
+    while ((supervisor_ticks_ms64() < end_ticks) && (!tud_hid_ready() || usb_hid_device_reports_queued())) {
         RUN_BACKGROUND_TASKS;
+        #if CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH > 0
+        send_queued_report();
+        #endif
     }
 
     if (!tud_suspended()) {
@@ -32,5 +32,7 @@ extern const usb_hid_device_obj_t usb_hid_device_mouse_obj;
 extern const usb_hid_device_obj_t usb_hid_device_consumer_control_obj;
 
 void usb_hid_device_create_report_buffers(usb_hid_device_obj_t *self);
+size_t usb_hid_device_reports_queued(void);
+void usb_hid_device_reset_report_queue(void);
 
 extern char *custom_usb_hid_interface_name;
@@ -45,7 +45,8 @@ static const uint8_t usb_hid_descriptor_template[] = {
 #define HID_IN_ENDPOINT_INDEX (20)
     0x03,        // 21 bmAttributes (Interrupt)
     0x40, 0x00,  // 22,23  wMaxPacketSize 64
-    0x08,        // 24 bInterval 8 (unit depends on device speed)
+    0x08,        // 24 bInterval 8 (unit depends on device speed) [SET AT RUNTIME]
+#define HID_IN_INTERVAL_INDEX (24)
 
     0x07,        // 25 bLength
     0x05,        // 26 bDescriptorType (Endpoint)
@@ -53,7 +54,8 @@ static const uint8_t usb_hid_descriptor_template[] = {
 #define HID_OUT_ENDPOINT_INDEX (27)
     0x03,        // 28 bmAttributes (Interrupt)
     0x40, 0x00,  // 29,30 wMaxPacketSize 64
-    0x08,        // 31 bInterval 8 (unit depends on device speed)
+    0x08,        // 31 bInterval 8 (unit depends on device speed) [SET AT RUNTIME]
+#define HID_OUT_INTERVAL_INDEX (31)
 };
 
 #define MAX_HID_DEVICES 8
@@ -68,6 +70,10 @@ static mp_int_t num_hid_devices;
 // The value is remembered here from boot.py to code.py.
 static uint8_t hid_boot_device;
 
+// bInterval for the endpoints, in the units of the device speed. Like hid_boot_device, this is set
+// by usb_hid.enable() in boot.py and remembered for code.py.
+static uint8_t hid_interval;
+
 // Whether a boot device was requested by a SET_PROTOCOL request from the host.
 static bool hid_boot_device_requested;
 
@@ -135,7 +141,7 @@ void usb_hid_set_defaults(void) {
     hid_boot_device = 0;
     hid_boot_device_requested = false;
     common_hal_usb_hid_enable(
-        CIRCUITPY_USB_HID_ENABLED_DEFAULT ? &default_hid_devices_tuple : mp_const_empty_tuple, 0);
+        CIRCUITPY_USB_HID_ENABLED_DEFAULT ? &default_hid_devices_tuple : mp_const_empty_tuple, 0, 0);
 }
 
 // This is the interface descriptor, not the report descriptor.
@@ -169,6 +175,9 @@ size_t usb_hid_add_descriptor(uint8_t *descriptor_buf, descriptor_counts_t *desc
     descriptor_buf[HID_DESCRIPTOR_LENGTH_INDEX] = report_descriptor_length & 0xFF;
     descriptor_buf[HID_DESCRIPTOR_LENGTH_INDEX + 1] = (report_descriptor_length >> 8);
 
+    descriptor_buf[HID_IN_INTERVAL_INDEX] = hid_interval;
+    descriptor_buf[HID_OUT_INTERVAL_INDEX] = hid_interval;
+
     descriptor_buf[HID_IN_ENDPOINT_INDEX] =
         0x80 | (USB_HID_EP_NUM_IN ? USB_HID_EP_NUM_IN : descriptor_counts->current_endpoint);
     descriptor_counts->num_in_endpoints++;
@@ -200,10 +209,25 @@ static void usb_hid_set_devices_from_hid_devices(void) {
 }
 
 bool common_hal_usb_hid_disable(void) {
-    return common_hal_usb_hid_enable(mp_const_empty_tuple, 0);
+    return common_hal_usb_hid_enable(mp_const_empty_tuple, 0, 0);
+}
+
+// Interrupt endpoints are polled every bInterval frames (1 ms) at full speed, and every
+// 2 ** (bInterval - 1) microframes (125 us) at high speed. Choose the longest interval that is no
+// longer than the one asked for.
+static uint8_t interval_for_us(uint32_t poll_interval_us) {
+    #if USB_HIGHSPEED
+    uint8_t interval = 1;
+    while (interval < 16 && (125u << interval) <= poll_interval_us) {
+        interval++;
+    }
+    return interval;
+    #else
+    return MAX(1, MIN(255, poll_interval_us / 1000));
+    #endif
 }
 
-bool common_hal_usb_hid_enable(const mp_obj_t devices, uint8_t boot_device) {
+bool common_hal_usb_hid_enable(const mp_obj_t devices, uint8_t boot_device, uint32_t poll_interval_us) {
     // We can't change the devices once we're connected.
     if (tud_connected()) {
         return false;
@@ -216,6 +240,8 @@ bool common_hal_usb_hid_enable(const mp_obj_t devices, uint8_t boot_device) {
 
     hid_boot_device = boot_device;
 
+    hid_interval = poll_interval_us == 0 ? 8 : interval_for_us(poll_interval_us);
+
     // Remember the devices in static storage so they live across VMs.
     for (mp_int_t i = 0; i < num_hid_devices; i++) {
         // devices has already been validated to contain only usb_hid_device_obj_t objects.
@@ -244,6 +270,9 @@ void usb_hid_setup_devices(void) {
 
     usb_hid_set_devices_from_hid_devices();
 
+    // Reports queued by the last VM are for devices that may be gone.
+    usb_hid_device_reset_report_queue();
+
     // Create report buffers on the heap.
     for (mp_int_t i = 0; i < num_hid_devices; i++) {
         usb_hid_device_create_report_buffers(&hid_devices[i]);
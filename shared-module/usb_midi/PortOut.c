@@ -4,15 +4,52 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include "py/mperrno.h"
+#include "py/stream.h"
+#include "shared/runtime/interrupt_char.h"
 #include "shared-bindings/usb_midi/PortOut.h"
 #include "shared-module/usb_midi/PortOut.h"
+#include "supervisor/shared/tick.h"
 #include "supervisor/shared/translate/translate.h"
 #include "tusb.h"
 
 size_t common_hal_usb_midi_portout_write(usb_midi_portout_obj_t *self, const uint8_t *data, size_t len, int *errcode) {
-    return tud_midi_stream_write(0, data, len);
+    // TinyUSB packs the events into its FIFO and sends as much of the FIFO as fits in each
+    // transfer, so events written while the host hasn't taken the last transfer go out together.
+    size_t total_num_written = tud_midi_stream_write(0, data, len);
+
+    const bool wait_forever = self->write_timeout < 0.0f;
+    if (self->write_timeout != 0.0f) {
+        // Feed the rest of the buffer in as the host takes what is already queued.
+        // Use special routine to avoid pulling in uint64-float-compatible math routines.
+        uint64_t timeout_ms = float_to_uint64(self->write_timeout * 1000);  // Junk value if write_timeout < 0.
+        uint64_t start_ticks = supervisor_ticks_ms64();
+        while (total_num_written < len && tud_midi_mounted() &&
+               (wait_forever || supervisor_ticks_ms64() - start_ticks <= timeout_ms)) {
+            RUN_BACKGROUND_TASKS;
+            if (mp_hal_is_interrupted()) {
+                break;
+            }
+            total_num_written += tud_midi_stream_write(0, data + total_num_written, len - total_num_written);
+        }
+    }
+
+    // Tell a caller that doesn't wait to try again, rather than that nothing was written.
+    if (total_num_written == 0 && len > 0 && tud_midi_mounted()) {
+        *errcode = MP_EAGAIN;
+        return MP_STREAM_ERROR;
+    }
+    return total_num_written;
 }
 
 bool common_hal_usb_midi_portout_ready_to_tx(usb_midi_portout_obj_t *self) {
     return tud_midi_mounted();
 }
+
+mp_float_t common_hal_usb_midi_portout_get_write_timeout(usb_midi_portout_obj_t *self) {
+    return self->write_timeout;
+}
+
+void common_hal_usb_midi_portout_set_write_timeout(usb_midi_portout_obj_t *self, mp_float_t write_timeout) {
+    self->write_timeout = write_timeout;
+}
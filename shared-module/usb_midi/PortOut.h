@@ -13,4 +13,6 @@
 
 typedef struct  {
     mp_obj_base_t base;
+    // < 0 waits forever.
+    mp_float_t write_timeout;
 } usb_midi_portout_obj_t;
@@ -240,7 +240,8 @@ static const usb_midi_portin_obj_t midi_portin_obj = {
     },
 };
 
-static const usb_midi_portout_obj_t midi_portout_obj = {
+// Not const, because write_timeout can change.
+static usb_midi_portout_obj_t midi_portout_obj = {
     .base = {
         .type = &usb_midi_portout_type,
     }
@@ -261,6 +262,8 @@ void usb_midi_setup_ports(void) {
     // Right now midi_ports_tuple contains no heap objects, but if it does in the future,
     // it will need to be protected against gc.
 
+    midi_portout_obj.write_timeout = 0.0f;
+
     mp_obj_tuple_t *ports = usb_midi_is_enabled ? MP_OBJ_FROM_PTR(&midi_ports_tuple) : mp_const_empty_tuple;
     mp_map_lookup(&usb_midi_module_globals.map, MP_ROM_QSTR(MP_QSTR_ports), MP_MAP_LOOKUP)->value =
         MP_OBJ_FROM_PTR(ports);
@@ -18,8 +18,8 @@ void shared_module_usb_video_uvcframebuffer_get_bufinfo(usb_video_uvcframebuffer
     bufinfo->len = 2 * usb_video_frame_width * usb_video_frame_height;
 }
 
-void shared_module_usb_video_uvcframebuffer_refresh(usb_video_uvcframebuffer_obj_t *self) {
-    shared_module_usb_video_swapbuffers();
+void shared_module_usb_video_uvcframebuffer_refresh(usb_video_uvcframebuffer_obj_t *self, uint8_t *dirty_row_bitmask) {
+    shared_module_usb_video_swapbuffers(dirty_row_bitmask);
 }
 
 int shared_module_usb_video_uvcframebuffer_get_width(usb_video_uvcframebuffer_obj_t *self) {
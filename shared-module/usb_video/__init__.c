@@ -16,7 +16,6 @@
 #include "supervisor/shared/tick.h"
 #include "device/usbd.h"
 
-static bool do_convert = true;
 static unsigned frame_num = 0;
 static unsigned tx_busy = 0;
 static unsigned interval_ms = 1000 / DEFAULT_FRAME_RATE;
@@ -24,11 +23,15 @@ static unsigned interval_ms = 1000 / DEFAULT_FRAME_RATE;
 // TODO must dynamically allocate this, otherwise everyone pays for it
 static uint8_t *frame_buffer_yuyv;
 uint16_t *usb_video_framebuffer_rgb565;
+// One bit per row of the RGB565 framebuffer that changed since it was last converted.
+static uint8_t *dirty_rows;
+// When set, the framebuffer holds YUY2 and is transmitted as-is.
+static bool framebuffer_is_yuyv;
 
 static bool usb_video_is_enabled = false;
 uint16_t usb_video_frame_width, usb_video_frame_height;
 
-bool shared_module_usb_video_enable(mp_int_t frame_width, mp_int_t frame_height) {
+bool shared_module_usb_video_enable(mp_int_t frame_width, mp_int_t frame_height, bool yuyv) {
     if (tud_connected()) {
         return false;
     }
@@ -45,18 +48,30 @@ bool shared_module_usb_video_enable(mp_int_t frame_width, mp_int_t frame_height)
     usb_video_frame_height = frame_height;
 
     size_t framebuffer_size = usb_video_frame_width * usb_video_frame_height * 2;
-    frame_buffer_yuyv = port_malloc(framebuffer_size, false);
+    size_t dirty_rows_size = (usb_video_frame_height + 7) / 8;
     uint32_t *frame_buffer_rgb565_uint32 = port_malloc(framebuffer_size, false);
     usb_video_framebuffer_rgb565 = (uint16_t *)frame_buffer_rgb565_uint32;
+    framebuffer_is_yuyv = yuyv;
+    if (yuyv) {
+        // Transmitted straight from the framebuffer, so no second buffer or conversion.
+        frame_buffer_yuyv = (uint8_t *)usb_video_framebuffer_rgb565;
+    } else {
+        frame_buffer_yuyv = port_malloc(framebuffer_size, false);
+        dirty_rows = port_malloc(dirty_rows_size, false);
+    }
 
-    if (!frame_buffer_yuyv || !usb_video_framebuffer_rgb565) {
-        // this will free either of the buffers allocated just above, in
-        // case one succeeded and the other failed.
+    if (!frame_buffer_yuyv || !usb_video_framebuffer_rgb565 || (!yuyv && !dirty_rows)) {
+        // this will free any of the buffers allocated just above, in
+        // case some succeeded and others failed.
         shared_module_usb_video_disable();
-        m_malloc_fail(2 * framebuffer_size);
+        m_malloc_fail(yuyv ? framebuffer_size : 2 * framebuffer_size + dirty_rows_size);
     }
-    memset(frame_buffer_yuyv, 0, framebuffer_size);
     memset(usb_video_framebuffer_rgb565, 0, framebuffer_size);
+    if (!yuyv) {
+        memset(frame_buffer_yuyv, 0, framebuffer_size);
+        // the zeroed YUY2 buffer isn't black, so convert everything for the first frame
+        memset(dirty_rows, 0xff, dirty_rows_size);
+    }
 
     usb_video_is_enabled = true;
 
@@ -68,10 +83,15 @@ bool shared_module_usb_video_disable(void) {
         return false;
     }
     usb_video_is_enabled = false;
-    port_free(frame_buffer_yuyv);
+    if (!framebuffer_is_yuyv) {
+        port_free(frame_buffer_yuyv);
+    }
     port_free(usb_video_framebuffer_rgb565);
+    port_free(dirty_rows);
     frame_buffer_yuyv = NULL;
     usb_video_framebuffer_rgb565 = NULL;
+    dirty_rows = NULL;
+    framebuffer_is_yuyv = false;
     return true;
 }
 
@@ -87,16 +107,11 @@ size_t usb_video_descriptor_length(void) {
     #endif
 }
 
-static void convert_framebuffer_maybe(void) {
-    if (!do_convert) {
-        return; // new data not ready yet
-    }
-    do_convert = false; // assumes this happens via background, not interrupt
-
-    uint8_t *dest = frame_buffer_yuyv;
-    uint16_t *src = usb_video_framebuffer_rgb565;
+static void convert_row(int row) {
+    uint8_t *dest = frame_buffer_yuyv + row * usb_video_frame_width * 2;
+    uint16_t *src = usb_video_framebuffer_rgb565 + row * usb_video_frame_width;
 
-    for (int i = 0; i < usb_video_frame_width * usb_video_frame_height / 2; i++) {
+    for (int i = 0; i < usb_video_frame_width / 2; i++) {
         uint16_t p1 = IMAGE_GET_RGB565_PIXEL_FAST(src, 0);
         uint16_t p2 = IMAGE_GET_RGB565_PIXEL_FAST(src, 1);
         src += 2;
@@ -116,8 +131,39 @@ static void convert_framebuffer_maybe(void) {
     }
 }
 
-void shared_module_usb_video_swapbuffers(void) {
-    do_convert = true;
+// Converts just the rows swapped in since the last frame, right before the frame is
+// handed to the USB stack, so the YUY2 buffer never changes during a transfer.
+static void convert_framebuffer_maybe(void) {
+    if (framebuffer_is_yuyv) {
+        return;
+    }
+    // assumes this happens via background, not interrupt
+    for (int i = 0; i < (usb_video_frame_height + 7) / 8; i++) {
+        uint8_t bits = dirty_rows[i];
+        if (!bits) {
+            continue;
+        }
+        dirty_rows[i] = 0;
+        for (int row = i * 8; bits; row++, bits >>= 1) {
+            if ((bits & 1) && row < usb_video_frame_height) {
+                convert_row(row);
+            }
+        }
+    }
+}
+
+void shared_module_usb_video_swapbuffers(const uint8_t *dirty_row_bitmask) {
+    if (framebuffer_is_yuyv) {
+        return;
+    }
+    size_t dirty_rows_size = (usb_video_frame_height + 7) / 8;
+    if (dirty_row_bitmask == NULL) {
+        memset(dirty_rows, 0xff, dirty_rows_size);
+        return;
+    }
+    for (size_t i = 0; i < dirty_rows_size; i++) {
+        dirty_rows[i] |= dirty_row_bitmask[i];
+    }
 }
 
 size_t usb_video_add_descriptor(uint8_t *descriptor_buf, descriptor_counts_t *descriptor_counts, uint8_t *current_interface_string) {
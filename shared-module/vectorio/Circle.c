@@ -44,6 +44,39 @@ uint32_t common_hal_vectorio_circle_get_pixel(void *obj, int16_t x, int16_t y) {
     return pythagorasSmallerThanRadius ? self->color_index : 0;
 }
 
+static uint32_t isqrt(uint32_t value) {
+    uint32_t root = 0;
+    uint32_t bit = 1u << 30;
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+// A row of a circle is a single span out to the largest x with x^2 + y^2 <= r^2.
+int common_hal_vectorio_circle_get_spans(void *obj, int16_t y, int16_t x1, int16_t x2, vectorio_span_t *spans) {
+    vectorio_circle_t *self = obj;
+    uint32_t radius = self->radius;
+    uint32_t abs_y = abs(y);
+    if (abs_y > radius) {
+        return 0;
+    }
+    int32_t half_width = isqrt(radius * radius - abs_y * abs_y);
+    spans[0].x1 = MAX(x1, -half_width);
+    spans[0].x2 = MIN(x2, half_width + 1);
+    spans[0].pixel = self->color_index;
+    return spans[0].x1 < spans[0].x2 ? 1 : 0;
+}
+
 
 void common_hal_vectorio_circle_get_area(void *circle, displayio_area_t *out_area) {
     vectorio_circle_t *self = circle;
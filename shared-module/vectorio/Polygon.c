@@ -185,6 +185,85 @@ uint32_t common_hal_vectorio_polygon_get_pixel(void *obj, int16_t x, int16_t y)
     return winding_number == 0 ? 0 : self->color_index;
 }
 
+// Rounds up, for a positive denominator.
+static int32_t ceil_div(int32_t numerator, int32_t denominator) {
+    if (numerator >= 0) {
+        return (numerator + denominator - 1) / denominator;
+    }
+    return -(-numerator / denominator);
+}
+
+// Scanline version of get_pixel. Each edge that crosses row y contributes its winding to
+// every x strictly left of the crossing, which for integer x means every x below the rounded
+// up crossing point. Sorting those thresholds gives the winding number for each run of the
+// row from one pass over the edges.
+int common_hal_vectorio_polygon_get_spans(void *obj, int16_t y, int16_t x1, int16_t x2, vectorio_span_t *spans) {
+    vectorio_polygon_t *self = obj;
+    const uint16_t max_crossings = 2 * VECTORIO_MAX_SPANS;
+    int16_t thresholds[max_crossings];
+    int8_t windings[max_crossings];
+    uint16_t crossings = 0;
+
+    for (uint16_t i = 0; i < self->len; i += 2) {
+        int16_t ex1 = self->points_list[i];
+        int16_t ey1 = self->points_list[i + 1];
+        int16_t ex2 = self->points_list[(i + 2) % self->len];
+        int16_t ey2 = self->points_list[(i + 3) % self->len];
+        int8_t winding;
+        if (ey1 <= y && ey2 > y) {
+            winding = 1;
+        } else if (ey2 <= y && ey1 > y) {
+            winding = -1;
+        } else {
+            continue;
+        }
+        if (crossings == max_crossings) {
+            return -1;
+        }
+        int32_t dy = ey2 - ey1;
+        int32_t numerator = (y - ey1) * (ex2 - ex1);
+        if (dy < 0) {
+            dy = -dy;
+            numerator = -numerator;
+        }
+        int16_t threshold = ex1 + ceil_div(numerator, dy);
+        // Insertion sort; rows rarely cross more than a handful of edges.
+        uint16_t j = crossings;
+        while (j > 0 && thresholds[j - 1] > threshold) {
+            thresholds[j] = thresholds[j - 1];
+            windings[j] = windings[j - 1];
+            j--;
+        }
+        thresholds[j] = threshold;
+        windings[j] = winding;
+        crossings++;
+    }
+
+    // Left of every threshold all the edges count, and they cancel out for a closed polygon.
+    int16_t winding_number = 0;
+    int count = 0;
+    for (uint16_t i = 0; i + 1 < crossings; i++) {
+        winding_number -= windings[i];
+        if (winding_number == 0) {
+            continue;
+        }
+        int16_t start = MAX(x1, thresholds[i]);
+        int16_t end = MIN(x2, thresholds[i + 1]);
+        if (start >= end) {
+            continue;
+        }
+        if (count > 0 && spans[count - 1].x2 == start) {
+            spans[count - 1].x2 = end;
+            continue;
+        }
+        spans[count].x1 = start;
+        spans[count].x2 = end;
+        spans[count].pixel = self->color_index;
+        count++;
+    }
+    return count;
+}
+
 mp_obj_t common_hal_vectorio_polygon_get_draw_protocol(void *polygon) {
     vectorio_polygon_t *self = polygon;
     return self->draw_protocol_instance;
@@ -33,6 +33,17 @@ uint32_t common_hal_vectorio_rectangle_get_pixel(void *obj, int16_t x, int16_t y
     return 0;
 }
 
+int common_hal_vectorio_rectangle_get_spans(void *obj, int16_t y, int16_t x1, int16_t x2, vectorio_span_t *spans) {
+    vectorio_rectangle_t *self = obj;
+    if (y < 0 || y >= self->height) {
+        return 0;
+    }
+    spans[0].x1 = MAX(x1, 0);
+    spans[0].x2 = MIN(x2, self->width);
+    spans[0].pixel = self->color_index;
+    return spans[0].x1 < spans[0].x2 ? 1 : 0;
+}
+
 
 void common_hal_vectorio_rectangle_get_area(void *rectangle, displayio_area_t *out_area) {
     vectorio_rectangle_t *self = rectangle;
@@ -326,6 +326,74 @@ void common_hal_vectorio_vector_shape_set_pixel_shader(vectorio_vector_shape_t *
     common_hal_vectorio_vector_shape_set_dirty(self);
 }
 
+// True if any pixel in [start, end) of the mask hasn't been drawn yet.
+static bool _any_unmasked(const uint32_t *mask, uint16_t start, uint16_t end) {
+    for (uint16_t pixel_index = start; pixel_index < end; pixel_index++) {
+        if ((mask[pixel_index / 32] & (1u << (pixel_index % 32))) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Shades a covered pixel, writes it into the buffer and marks it in the mask. Returns false
+// if the pixel shader made it transparent. prepared_palette is the pixel shader when its colors
+// have already been converted for colorspace.
+static bool _draw_pixel(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, displayio_palette_t *prepared_palette, displayio_input_pixel_t *input_pixel, uint16_t pixel_index, uint16_t linestride_px, uint32_t *mask, uint32_t *buffer) {
+    displayio_output_pixel_t output_pixel;
+    output_pixel.pixel = 0;
+
+    // Pixel is not transparent. Let's pull the pixel value index down to 0-base for more error-resistant palettes.
+    input_pixel->pixel -= 1;
+    output_pixel.opaque = true;
+
+    if (prepared_palette != NULL) {
+        if (input_pixel->pixel >= prepared_palette->color_count || prepared_palette->colors[input_pixel->pixel].transparent) {
+            output_pixel.opaque = false;
+        } else {
+            output_pixel.pixel = prepared_palette->colors[input_pixel->pixel].cached_color;
+        }
+    } else if (self->pixel_shader == mp_const_none) {
+        output_pixel.pixel = input_pixel->pixel;
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        displayio_palette_get_color(self->pixel_shader, colorspace, input_pixel, &output_pixel);
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+        displayio_colorconverter_convert(self->pixel_shader, colorspace, input_pixel, &output_pixel);
+    }
+
+    mask[pixel_index / 32] |= 1u << (pixel_index % 32);
+    if (colorspace->depth == 16) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 16", output_pixel.pixel);
+        *(((uint16_t *)buffer) + pixel_index) = output_pixel.pixel;
+    } else if (colorspace->depth == 32) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 32", output_pixel.pixel);
+        *(((uint32_t *)buffer) + pixel_index) = output_pixel.pixel;
+    } else if (colorspace->depth == 8) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %02x 8", output_pixel.pixel);
+        *(((uint8_t *)buffer) + pixel_index) = output_pixel.pixel;
+    } else if (colorspace->depth < 8) {
+        uint8_t pixels_per_byte = 8 / colorspace->depth;
+        // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
+        if (!colorspace->pixels_in_byte_share_row) {
+            uint16_t row = pixel_index / linestride_px;
+            uint16_t col = pixel_index % linestride_px;
+            pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * linestride_px + row % pixels_per_byte;
+        }
+        uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
+        if (colorspace->reverse_pixels_in_byte) {
+            // Reverse the shift by subtracting it from the leftmost shift.
+            shift = (pixels_per_byte - 1) * colorspace->depth - shift;
+        }
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %2d %d", output_pixel.pixel, colorspace->depth);
+        ((uint8_t *)buffer)[pixel_index / pixels_per_byte] |= output_pixel.pixel << shift;
+    }
+
+    if (!output_pixel.opaque) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel from colorconverter; input area is not fully covered)");
+    }
+    return output_pixel.opaque;
+}
+
 bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
     // Shape areas are relative to 0,0.  This will allow rotation about a known axis.
     //   The consequence is that the area reported by the shape itself is _relative_ to 0,0.
@@ -354,7 +422,6 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
 
     bool full_coverage = displayio_area_equal(area, &overlap);
 
-    uint8_t pixels_per_byte = 8 / colorspace->depth;
     VECTORIO_SHAPE_DEBUG(" xy:(%3d %3d) tform:{x:%d y:%d dx:%d dy:%d scl:%d w:%d h:%d mx:%d my:%d tr:%d}",
         self->x, self->y,
         self->absolute_transform->x, self->absolute_transform->y, self->absolute_transform->dx, self->absolute_transform->dy, self->absolute_transform->scale,
@@ -365,93 +432,97 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
     uint16_t line_dirty_offset_px = (overlap.y1 - area->y1) * linestride_px;
     uint16_t column_dirty_offset_px = overlap.x1 - area->x1;
     VECTORIO_SHAPE_DEBUG(", linestride:%3d line_offset:%3d col_offset:%3d depth:%2d ppb:%2d shape:%s",
-        linestride_px, line_dirty_offset_px, column_dirty_offset_px, colorspace->depth, pixels_per_byte, mp_obj_get_type_str(self->ishape.shape));
+        linestride_px, line_dirty_offset_px, column_dirty_offset_px, colorspace->depth, 8 / colorspace->depth, mp_obj_get_type_str(self->ishape.shape));
 
     displayio_input_pixel_t input_pixel;
-    displayio_output_pixel_t output_pixel;
+
+    displayio_palette_t *prepared_palette = NULL;
+    if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type) &&
+        displayio_palette_prepare_colors(self->pixel_shader, colorspace)) {
+        prepared_palette = self->pixel_shader;
+    }
 
     displayio_area_t shape_area;
     self->ishape.get_area(self->ishape.shape, &shape_area);
 
+    // Screen rows are shape rows unless the transform transposes them. Then the spans for a
+    // row can be drawn directly instead of asking the shape about every pixel.
+    bool use_spans = self->ishape.get_spans != NULL && !self->absolute_transform->transpose_xy;
+    bool mirrored = self->absolute_transform->dx < 1;
+    uint16_t overlap_width = overlap.x2 - overlap.x1;
+    vectorio_span_t spans[VECTORIO_MAX_SPANS];
+
     uint16_t mask_start_px = line_dirty_offset_px;
     for (input_pixel.y = overlap.y1; input_pixel.y < overlap.y2; ++input_pixel.y) {
         mask_start_px += column_dirty_offset_px;
-        for (input_pixel.x = overlap.x1; input_pixel.x < overlap.x2; ++input_pixel.x) {
-            // Check the mask first to see if the pixel has already been set.
-            uint16_t pixel_index = mask_start_px + (input_pixel.x - overlap.x1);
-            uint32_t *mask_doubleword = &(mask[pixel_index / 32]);
-            uint8_t mask_bit = pixel_index % 32;
-            VECTORIO_SHAPE_PIXEL_DEBUG("\n%p pixel_index: %5u mask_bit: %2u mask: "U32_TO_BINARY_FMT, self, pixel_index, mask_bit, U32_TO_BINARY(*mask_doubleword));
-            if ((*mask_doubleword & (1u << mask_bit)) != 0) {
-                VECTORIO_SHAPE_PIXEL_DEBUG(" masked");
-                continue;
+        int span_count = -1;
+        if (use_spans) {
+            int16_t shape_x;
+            int16_t shape_y;
+            screen_to_shape_coordinates(self, overlap.x1, input_pixel.y, &shape_x, &shape_y);
+            // When mirrored, the row is walked backwards through the shape.
+            int16_t shape_x1 = mirrored ? shape_x - overlap_width + 1 : shape_x;
+            span_count = self->ishape.get_spans(self->ishape.shape, shape_y, shape_x1, shape_x1 + overlap_width, spans);
+            uint16_t next_px = 0;
+            for (int i = 0; i < span_count; i++) {
+                const vectorio_span_t *span = &spans[mirrored ? span_count - 1 - i : i];
+                uint16_t span_start = mirrored ? shape_x - span->x2 + 1 : span->x1 - shape_x;
+                uint16_t span_end = mirrored ? shape_x - span->x1 + 1 : span->x2 - shape_x;
+                if (full_coverage && _any_unmasked(mask, mask_start_px + next_px, mask_start_px + span_start)) {
+                    full_coverage = false;
+                }
+                for (uint16_t offset = span_start; offset < span_end; offset++) {
+                    uint16_t pixel_index = mask_start_px + offset;
+                    if ((mask[pixel_index / 32] & (1u << (pixel_index % 32))) != 0) {
+                        continue;
+                    }
+                    input_pixel.x = overlap.x1 + offset;
+                    input_pixel.pixel = span->pixel;
+                    if (!_draw_pixel(self, colorspace, prepared_palette, &input_pixel, pixel_index, linestride_px, mask, buffer)) {
+                        full_coverage = false;
+                    }
+                }
+                next_px = span_end;
             }
-            output_pixel.pixel = 0;
-
-            // Cast input screen coordinates to shape coordinates to pick the pixel to draw
-            int16_t pixel_to_get_x;
-            int16_t pixel_to_get_y;
-            screen_to_shape_coordinates(self, input_pixel.x, input_pixel.y, &pixel_to_get_x, &pixel_to_get_y);
-
-            VECTORIO_SHAPE_PIXEL_DEBUG(" get_pixel %p (%3d, %3d) -> ( %3d, %3d )", self->ishape.shape, input_pixel.x, input_pixel.y, pixel_to_get_x, pixel_to_get_y);
-            #ifdef VECTORIO_PERF
-            uint64_t pre_pixel = common_hal_time_monotonic_ns();
-            #endif
-            input_pixel.pixel = self->ishape.get_pixel(self->ishape.shape, pixel_to_get_x, pixel_to_get_y);
-            #ifdef VECTORIO_PERF
-            uint64_t post_pixel = common_hal_time_monotonic_ns();
-            pixel_time += post_pixel - pre_pixel;
-            #endif
-            VECTORIO_SHAPE_PIXEL_DEBUG(" -> %d", input_pixel.pixel);
-
-            // vectorio shapes use 0 to mean "area is not covered."
-            // We can skip all the rest of the work for this pixel if it's not currently covered by the shape.
-            if (input_pixel.pixel == 0) {
-                VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel; input area is not fully covered)");
+            if (span_count >= 0 && full_coverage && _any_unmasked(mask, mask_start_px + next_px, mask_start_px + overlap_width)) {
                 full_coverage = false;
-            } else {
-                // Pixel is not transparent. Let's pull the pixel value index down to 0-base for more error-resistant palettes.
-                input_pixel.pixel -= 1;
-                output_pixel.opaque = true;
-
-                if (self->pixel_shader == mp_const_none) {
-                    output_pixel.pixel = input_pixel.pixel;
-                } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
-                    displayio_palette_get_color(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
-                } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
-                    displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
+            }
+        }
+        if (span_count < 0) {
+            for (input_pixel.x = overlap.x1; input_pixel.x < overlap.x2; ++input_pixel.x) {
+                // Check the mask first to see if the pixel has already been set.
+                uint16_t pixel_index = mask_start_px + (input_pixel.x - overlap.x1);
+                uint32_t *mask_doubleword = &(mask[pixel_index / 32]);
+                uint8_t mask_bit = pixel_index % 32;
+                VECTORIO_SHAPE_PIXEL_DEBUG("\n%p pixel_index: %5u mask_bit: %2u mask: "U32_TO_BINARY_FMT, self, pixel_index, mask_bit, U32_TO_BINARY(*mask_doubleword));
+                if ((*mask_doubleword & (1u << mask_bit)) != 0) {
+                    VECTORIO_SHAPE_PIXEL_DEBUG(" masked");
+                    continue;
                 }
 
-                // We double-check this to fast-path the case when a pixel is not covered by the shape & not call the color converter unnecessarily.
-                if (!output_pixel.opaque) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel from colorconverter; input area is not fully covered)");
+                // Cast input screen coordinates to shape coordinates to pick the pixel to draw
+                int16_t pixel_to_get_x;
+                int16_t pixel_to_get_y;
+                screen_to_shape_coordinates(self, input_pixel.x, input_pixel.y, &pixel_to_get_x, &pixel_to_get_y);
+
+                VECTORIO_SHAPE_PIXEL_DEBUG(" get_pixel %p (%3d, %3d) -> ( %3d, %3d )", self->ishape.shape, input_pixel.x, input_pixel.y, pixel_to_get_x, pixel_to_get_y);
+                #ifdef VECTORIO_PERF
+                uint64_t pre_pixel = common_hal_time_monotonic_ns();
+                #endif
+                input_pixel.pixel = self->ishape.get_pixel(self->ishape.shape, pixel_to_get_x, pixel_to_get_y);
+                #ifdef VECTORIO_PERF
+                uint64_t post_pixel = common_hal_time_monotonic_ns();
+                pixel_time += post_pixel - pre_pixel;
+                #endif
+                VECTORIO_SHAPE_PIXEL_DEBUG(" -> %d", input_pixel.pixel);
+
+                // vectorio shapes use 0 to mean "area is not covered."
+                // We can skip all the rest of the work for this pixel if it's not currently covered by the shape.
+                if (input_pixel.pixel == 0) {
+                    VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel; input area is not fully covered)");
+                    full_coverage = false;
+                } else if (!_draw_pixel(self, colorspace, prepared_palette, &input_pixel, pixel_index, linestride_px, mask, buffer)) {
                     full_coverage = false;
-                }
-
-                *mask_doubleword |= 1u << mask_bit;
-                if (colorspace->depth == 16) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 16", output_pixel.pixel);
-                    *(((uint16_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth == 32) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 32", output_pixel.pixel);
-                    *(((uint32_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth == 8) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %02x 8", output_pixel.pixel);
-                    *(((uint8_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth < 8) {
-                    // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
-                    if (!colorspace->pixels_in_byte_share_row) {
-                        uint16_t row = pixel_index / linestride_px;
-                        uint16_t col = pixel_index % linestride_px;
-                        pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * linestride_px + row % pixels_per_byte;
-                    }
-                    uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
-                    if (colorspace->reverse_pixels_in_byte) {
-                        // Reverse the shift by subtracting it from the leftmost shift.
-                        shift = (pixels_per_byte - 1) * colorspace->depth - shift;
-                    }
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %2d %d", output_pixel.pixel, colorspace->depth);
-                    ((uint8_t *)buffer)[pixel_index / pixels_per_byte] |= output_pixel.pixel << shift;
                 }
             }
         }
@@ -17,6 +17,20 @@
 typedef void get_area_function(mp_obj_t shape, displayio_area_t *out_area);
 typedef uint32_t get_pixel_function(mp_obj_t shape, int16_t x, int16_t y);
 
+// A run of pixels [x1, x2) on one row that all have the same non-zero pixel value.
+typedef struct {
+    int16_t x1;
+    int16_t x2;
+    uint32_t pixel;
+} vectorio_span_t;
+
+#define VECTORIO_MAX_SPANS (16)
+
+// Fills spans with the runs of row y within [x1, x2), in increasing x order, that get_pixel
+// would return non-zero for. Returns the number of spans, or -1 if the row is too complex
+// for VECTORIO_MAX_SPANS and get_pixel must be used instead.
+typedef int get_spans_function(mp_obj_t shape, int16_t y, int16_t x1, int16_t x2, vectorio_span_t *spans);
+
 // This struct binds a shape's common Shape support functions (its vector shape interface)
 //   to its instance pointer.  We only check at construction time what the type of the
 //   associated shape is and link the correct functions up.
@@ -27,6 +41,7 @@ typedef struct {
     mp_obj_t shape;
     get_area_function *get_area;
     get_pixel_function *get_pixel;
+    get_spans_function *get_spans;
 } vectorio_ishape_t;
 
 typedef struct {
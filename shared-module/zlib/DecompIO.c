@@ -0,0 +1,77 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "py/mperrno.h"
+#include "py/runtime.h"
+#include "py/stream.h"
+
+#include "shared-bindings/zlib/DecompIO.h"
+
+// Called by uzlib when it has used up the input buffer.
+static int read_source(TINF_DATA *decomp) {
+    zlib_decompio_obj_t *self = decomp->self;
+    const mp_stream_p_t *stream = mp_get_stream(self->stream);
+    int error;
+    mp_uint_t len = stream->read(self->stream, self->input, sizeof(self->input), &error);
+    if (len == MP_STREAM_ERROR) {
+        mp_raise_OSError(error);
+    }
+    if (len == 0) {
+        // uzlib only asks for bytes the compressed data still needs.
+        mp_raise_type(&mp_type_EOFError);
+    }
+    decomp->source = self->input + 1;
+    decomp->source_limit = self->input + len;
+    return self->input[0];
+}
+
+void common_hal_zlib_decompio_construct(zlib_decompio_obj_t *self, mp_obj_t stream, mp_int_t wbits) {
+    mp_get_stream_raise(stream, MP_STREAM_OP_READ);
+    self->stream = stream;
+    self->eof = false;
+    memset(&self->decomp, 0, sizeof(self->decomp));
+    self->decomp.self = self;
+    self->decomp.source_read_cb = read_source;
+
+    size_t window_size;
+    if (wbits >= 16) {
+        if (uzlib_gzip_parse_header(&self->decomp) != TINF_OK) {
+            mp_raise_ValueError(MP_ERROR_TEXT("compression header"));
+        }
+        window_size = 1 << (wbits - 16);
+    } else if (wbits >= 0) {
+        // The header says how big a window the data was compressed with.
+        int window_bits = uzlib_zlib_parse_header(&self->decomp);
+        if (window_bits < 0) {
+            mp_raise_ValueError(MP_ERROR_TEXT("compression header"));
+        }
+        window_size = 1 << (window_bits + 8);
+    } else {
+        window_size = 1 << -wbits;
+    }
+
+    self->window = m_new(uint8_t, window_size);
+    uzlib_uncompress_init(&self->decomp, self->window, window_size);
+}
+
+mp_uint_t common_hal_zlib_decompio_read(zlib_decompio_obj_t *self, uint8_t *buf, size_t len, int *errcode) {
+    if (self->eof || len == 0) {
+        return 0;
+    }
+    self->decomp.dest = buf;
+    self->decomp.dest_limit = buf + len;
+    int st = uzlib_uncompress_chksum(&self->decomp);
+    if (st < 0) {
+        *errcode = MP_EINVAL;
+        return MP_STREAM_ERROR;
+    }
+    if (st == TINF_DONE) {
+        self->eof = true;
+    }
+    return self->decomp.dest - buf;
+}
@@ -0,0 +1,24 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "lib/uzlib/uzlib.h"
+
+// Compressed data is read from the source stream this many bytes at a time.
+#define ZLIB_DECOMPIO_INPUT_SIZE (128)
+
+typedef struct {
+    mp_obj_base_t base;
+    mp_obj_t stream;
+    TINF_DATA decomp;
+    // Holds the last window size bytes of output, which is all the history back references can reach.
+    uint8_t *window;
+    bool eof;
+    uint8_t input[ZLIB_DECOMPIO_INPUT_SIZE];
+} zlib_decompio_obj_t;
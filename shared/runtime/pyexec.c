@@ -130,8 +130,15 @@ static int parse_compile_execute(const void *source, mp_parse_input_kind_t input
                 }
                 #endif
 
-                mp_parse_tree_t parse_tree = mp_parse(lex, input_kind);
-                module_fun = mp_compile(&parse_tree, source_name, exec_flags & EXEC_FLAG_IS_REPL);
+                #if MICROPY_PARSE_STREAMING
+                if (input_kind == MP_PARSE_FILE_INPUT) {
+                    module_fun = mp_compile_file_streaming(lex);
+                } else
+                #endif
+                {
+                    mp_parse_tree_t parse_tree = mp_parse(lex, input_kind);
+                    module_fun = mp_compile(&parse_tree, source_name, exec_flags & EXEC_FLAG_IS_REPL);
+                }
                 #else
                 mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("script compilation not supported"));
                 #endif
@@ -292,7 +299,7 @@ static mp_uint_t mp_reader_stdin_readbyte(void *data) {
         if (c == CHAR_CTRL_C) {
             #if MICROPY_KBD_EXCEPTION
             // CIRCUITPY-CHANGE: traceback struct difference
-            MP_STATE_VM(mp_kbd_exception).traceback->data = NULL;
+            MP_STATE_VM(mp_kbd_exception).traceback = (mp_obj_traceback_t *)&mp_const_empty_traceback_obj;
             nlr_raise(MP_OBJ_FROM_PTR(&MP_STATE_VM(mp_kbd_exception)));
             #else
             mp_raise_type(&mp_type_KeyboardInterrupt);
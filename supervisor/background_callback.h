@@ -7,6 +7,8 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 /** Background callbacks are a linked list of tasks to call in the background.
  *
@@ -25,7 +27,14 @@
  * very next background-tasks invocation, leading to a CircuitPython freeze, so
  * don't do that.
  *
- * background_callback_add can be called from interrupt context.
+ * background_callback_add can be called from interrupt context. Where the core has
+ * compare-and-swap it adds the callback without disabling interrupts.
+ *
+ * Each callback belongs to a priority class with its own queue. Real-time callbacks, such as
+ * audio buffer refills, run first and again between every other callback. Housekeeping
+ * callbacks run last, and only for CIRCUITPY_BACKGROUND_CALLBACK_HOUSEKEEPING_TICKS per run
+ * once the first has run; the rest wait for the next run. Callbacks are normal unless added
+ * with background_callback_add_with_priority().
  *
  * If your work isn't triggered by an event, then it may be better implemented
  * using ticks, which runs tasks every millisecond or so. Ticks are enabled with
@@ -34,11 +43,24 @@
  * which includes port_background_tick(), every millisecond.
  */
 typedef void (*background_callback_fun)(void *data);
+
+// Normal is zero so that zero-initialized callbacks get it.
+typedef enum {
+    BACKGROUND_CALLBACK_PRIORITY_NORMAL,
+    BACKGROUND_CALLBACK_PRIORITY_REALTIME,
+    BACKGROUND_CALLBACK_PRIORITY_HOUSEKEEPING,
+    BACKGROUND_CALLBACK_PRIORITY_COUNT,
+} background_callback_priority_t;
+
 typedef struct background_callback {
     background_callback_fun fun;
     void *data;
     struct background_callback *next;
-    struct background_callback *prev;
+    // Set while the callback is waiting to run.
+    volatile uint8_t queued;
+    uint8_t priority;
+    // One more than the index of the stats entry for fun, or zero when it hasn't one yet.
+    uint8_t stats_slot;
 } background_callback_t;
 
 /* Add a background callback for which 'fun' and 'data' were previously set */
@@ -53,6 +75,9 @@ void background_callback_add_core(background_callback_t *cb);
  */
 void background_callback_add(background_callback_t *cb, background_callback_fun fun, void *data);
 
+/* Like background_callback_add, and sets the class the callback is queued in from now on. */
+void background_callback_add_with_priority(background_callback_t *cb, background_callback_fun fun, void *data, background_callback_priority_t priority);
+
 /* Run all background callbacks.  Normally, this is done by the supervisor
  * whenever the list is non-empty */
 void background_callback_run_all(void);
@@ -75,3 +100,19 @@ void background_callback_allow(void);
  * Background callbacks may stop objects from being collected
  */
 void background_callback_gc_collect(void);
+
+/* Calls and time, in 1/32768 second units, that each callback function has taken. The entry with a
+ * NULL fun counts the functions that didn't fit. */
+typedef struct {
+    background_callback_fun fun;
+    uint32_t calls;
+    uint32_t max;
+    uint64_t total;
+} background_callback_stats_t;
+
+/* Returns the stats entries in use and sets *len to their number. */
+const background_callback_stats_t *background_callback_get_stats(size_t *len);
+void background_callback_reset_stats(void);
+
+/* Prints the stats, slowest total first. */
+void background_callback_print_stats(void);
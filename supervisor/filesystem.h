@@ -7,6 +7,7 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #include "extmod/vfs_fat.h"
 
@@ -14,6 +15,12 @@ extern volatile bool filesystem_flush_requested;
 
 void filesystem_background(void);
 void filesystem_tick(void);
+// Ticks until filesystem_tick requests a flush, for tickless idle.
+uint32_t filesystem_ticks_until_flush(void);
+// Counts down ticks that passed without filesystem_tick, such as during tickless idle.
+void filesystem_ticks_passed(uint32_t ticks);
+// Called on every write so that the timed flush waits for writing to pause.
+void filesystem_written(void);
 bool filesystem_init(bool create_allowed, bool force_create);
 void filesystem_flush(void);
 bool filesystem_present(void);
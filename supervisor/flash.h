@@ -22,7 +22,13 @@ uint32_t supervisor_flash_get_block_count(void);
 
 // these return 0 on success, non-zero on error
 mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t num_blocks);
+// Where block_num can be read directly in memory, or NULL if the flash isn't
+// memory mapped. Any cached writes are flushed first.
+const void *supervisor_flash_get_block_address(uint32_t block_num);
 mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t block_num, uint32_t num_blocks);
+// The filesystem no longer needs what these blocks hold, so it doesn't have to be kept when their
+// erase sector is rewritten. It stays readable until then.
+void supervisor_flash_discard_blocks(uint32_t block_num, uint32_t num_blocks);
 
 struct _fs_user_mount_t;
 void supervisor_flash_init_vfs(struct _fs_user_mount_t *vfs);
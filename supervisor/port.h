@@ -90,6 +90,17 @@ void port_wake_main_task(void);
 // default weak implementation is provided that does nothing.
 void port_wake_main_task_from_isr(void);
 
+// Ports with a second core that CircuitPython doesn't otherwise use run
+// supervisor/shared/offload.h work on it. port_offload_start() starts core_main on
+// it and returns false when there is no second core free. core_main calls
+// port_offload_idle() to wait, on the second core, until port_offload_wake() is
+// called, and returns when it is to stop. port_offload_stop() waits for that.
+// Weak implementations for ports without a second core are provided.
+bool port_offload_start(void (*core_main)(void));
+void port_offload_stop(void);
+void port_offload_wake(void);
+void port_offload_idle(void);
+
 // Some ports may use real RTOS tasks besides the background task framework of
 // CircuitPython. Calling this will yield to other tasks and then return to the
 // CircuitPython task when others are done.
@@ -22,8 +22,32 @@ void port_heap_init(void);
 
 void *port_malloc(size_t size, bool dma_capable);
 
+// Allocates from the fastest RAM the port has, such as internal SRAM instead of
+// PSRAM. Free with port_free(). The default is port_malloc().
+void *port_malloc_fast(size_t size);
+
 void port_free(void *ptr);
 
 void *port_realloc(void *ptr, size_t size, bool dma_capable);
 
 size_t port_heap_get_largest_free_size(void);
+
+// Free bytes in the heap, not counting free pool blocks. Compared with
+// port_heap_get_largest_free_size() it shows how fragmented the heap is.
+size_t port_heap_get_free_size(void);
+
+// Fixed size blocks set aside from the heap at boot for the sizes that are
+// allocated and freed most, such as sockets, USB and flash buffers. Keeping them
+// out of the heap stops them from fragmenting it over a long run. Ports use
+// these in their port_malloc(), port_free() and port_realloc() before the heap.
+void port_heap_pool_init(void);
+
+// Returns NULL when no pool is for this size or its pool is used up.
+void *port_heap_pool_malloc(size_t size);
+
+// Returns false when ptr isn't from a pool.
+bool port_heap_pool_free(void *ptr);
+
+// Returns false when *ptr isn't from a pool. Otherwise *ptr is updated like
+// realloc() would return it.
+bool port_heap_pool_realloc(void **ptr, size_t size, bool dma_capable);
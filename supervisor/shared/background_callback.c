@@ -8,13 +8,20 @@
 
 #include "py/gc.h"
 #include "py/mpconfig.h"
+#include "py/mpprint.h"
 #include "supervisor/background_callback.h"
 #include "supervisor/linker.h"
 #include "supervisor/port.h"
 #include "supervisor/shared/tick.h"
 #include "shared-bindings/microcontroller/__init__.h"
 
-static volatile background_callback_t *volatile callback_head, *volatile callback_tail;
+// Each priority class has a stack of newly added callbacks, which interrupts push onto, and a
+// queue of callbacks waiting to run, which only background_callback_run_all touches. New
+// callbacks move from the stack to the end of the queue, in the order they were added, when
+// their class runs.
+static background_callback_t *volatile callback_added[BACKGROUND_CALLBACK_PRIORITY_COUNT];
+static background_callback_t *callback_head[BACKGROUND_CALLBACK_PRIORITY_COUNT];
+static background_callback_t *callback_tail[BACKGROUND_CALLBACK_PRIORITY_COUNT];
 
 #ifndef CALLBACK_CRITICAL_BEGIN
 #define CALLBACK_CRITICAL_BEGIN (common_hal_mcu_disable_interrupts())
@@ -23,25 +30,70 @@ static volatile background_callback_t *volatile callback_head, *volatile callbac
 #define CALLBACK_CRITICAL_END (common_hal_mcu_enable_interrupts())
 #endif
 
+// Add callbacks with compare-and-swap instead of in the critical section, so that adding one
+// from an interrupt doesn't hold off every other interrupt. Cores without it, such as the M0,
+// use the critical section.
+#ifndef CIRCUITPY_BACKGROUND_CALLBACK_LOCK_FREE
+#define CIRCUITPY_BACKGROUND_CALLBACK_LOCK_FREE (__GCC_ATOMIC_POINTER_LOCK_FREE == 2 && __GCC_ATOMIC_CHAR_LOCK_FREE == 2)
+#endif
+
 MP_WEAK void PLACE_IN_ITCM(port_wake_main_task)(void) {
 }
 
-void PLACE_IN_ITCM(background_callback_add_core)(background_callback_t * cb) {
+// Marks the callback queued. Returns false when it already was.
+static inline bool claim(background_callback_t *cb) {
+    #if CIRCUITPY_BACKGROUND_CALLBACK_LOCK_FREE
+    uint8_t expected = 0;
+    return __atomic_compare_exchange_n(&cb->queued, &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+    #else
     CALLBACK_CRITICAL_BEGIN;
-    if (cb->prev || callback_head == cb) {
-        CALLBACK_CRITICAL_END;
+    bool claimed = !cb->queued;
+    cb->queued = 1;
+    CALLBACK_CRITICAL_END;
+    return claimed;
+    #endif
+}
+
+static inline void push(size_t priority, background_callback_t *cb) {
+    #if CIRCUITPY_BACKGROUND_CALLBACK_LOCK_FREE
+    background_callback_t *top = __atomic_load_n(&callback_added[priority], __ATOMIC_RELAXED);
+    do {
+        cb->next = top;
+    } while (!__atomic_compare_exchange_n(&callback_added[priority], &top, cb, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+    #else
+    CALLBACK_CRITICAL_BEGIN;
+    cb->next = callback_added[priority];
+    callback_added[priority] = cb;
+    CALLBACK_CRITICAL_END;
+    #endif
+}
+
+static inline background_callback_t *take_added(size_t priority) {
+    #if CIRCUITPY_BACKGROUND_CALLBACK_LOCK_FREE
+    return __atomic_exchange_n(&callback_added[priority], NULL, __ATOMIC_ACQUIRE);
+    #else
+    CALLBACK_CRITICAL_BEGIN;
+    background_callback_t *top = callback_added[priority];
+    callback_added[priority] = NULL;
+    CALLBACK_CRITICAL_END;
+    return top;
+    #endif
+}
+
+// Lets the callback be queued again.
+static inline void release(background_callback_t *cb) {
+    #if CIRCUITPY_BACKGROUND_CALLBACK_LOCK_FREE
+    __atomic_store_n(&cb->queued, 0, __ATOMIC_RELEASE);
+    #else
+    cb->queued = 0;
+    #endif
+}
+
+void PLACE_IN_ITCM(background_callback_add_core)(background_callback_t * cb) {
+    if (!claim(cb)) {
         return;
     }
-    cb->next = 0;
-    cb->prev = (background_callback_t *)callback_tail;
-    if (callback_tail) {
-        callback_tail->next = cb;
-    }
-    if (!callback_head) {
-        callback_head = cb;
-    }
-    callback_tail = cb;
-    CALLBACK_CRITICAL_END;
+    push(cb->priority, cb);
 
     port_wake_main_task();
 }
@@ -52,39 +104,176 @@ void PLACE_IN_ITCM(background_callback_add)(background_callback_t * cb, backgrou
     background_callback_add_core(cb);
 }
 
+void PLACE_IN_ITCM(background_callback_add_with_priority)(background_callback_t * cb, background_callback_fun fun, void *data, background_callback_priority_t priority) {
+    // A queued callback keeps its old class until it has run. The class is only read when the
+    // callback is pushed, so racing with that is harmless.
+    if (!cb->queued) {
+        cb->priority = priority;
+    }
+    background_callback_add(cb, fun, data);
+}
+
 inline bool background_callback_pending(void) {
-    return callback_head != NULL;
+    for (size_t i = 0; i < BACKGROUND_CALLBACK_PRIORITY_COUNT; i++) {
+        if (callback_added[i] != NULL || callback_head[i] != NULL) {
+            return true;
+        }
+    }
+    return false;
 }
 
 static int background_prevention_count;
 
-void PLACE_IN_ITCM(background_callback_run_all)() {
-    port_background_task();
-    if (!background_callback_pending()) {
-        return;
+#if CIRCUITPY_BACKGROUND_CALLBACK_STATS
+static background_callback_stats_t callback_stats[CIRCUITPY_BACKGROUND_CALLBACK_STATS_LEN];
+static size_t callback_stats_len;
+
+// In 1/32768 second units.
+static uint64_t stats_now(void) {
+    uint8_t subticks;
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    return ticks * 32 + subticks;
+}
+
+static background_callback_stats_t *find_stats(background_callback_t *cb, background_callback_fun fun) {
+    if (cb->stats_slot != 0 && callback_stats[cb->stats_slot - 1].fun == fun) {
+        return &callback_stats[cb->stats_slot - 1];
     }
-    CALLBACK_CRITICAL_BEGIN;
-    if (background_prevention_count) {
-        CALLBACK_CRITICAL_END;
+    // The last entry is kept for the functions that don't get their own.
+    size_t i;
+    for (i = 0; i < callback_stats_len && i < CIRCUITPY_BACKGROUND_CALLBACK_STATS_LEN - 1; i++) {
+        if (callback_stats[i].fun == fun) {
+            break;
+        }
+    }
+    if (i == callback_stats_len) {
+        if (i < CIRCUITPY_BACKGROUND_CALLBACK_STATS_LEN - 1) {
+            callback_stats[i].fun = fun;
+        }
+        callback_stats_len = i + 1;
+    }
+    cb->stats_slot = i + 1;
+    return &callback_stats[i];
+}
+
+const background_callback_stats_t *background_callback_get_stats(size_t *len) {
+    *len = callback_stats_len;
+    return callback_stats;
+}
+
+void background_callback_reset_stats(void) {
+    memset(callback_stats, 0, sizeof(callback_stats));
+    callback_stats_len = 0;
+}
+
+void background_callback_print_stats(void) {
+    if (callback_stats_len == 0) {
         return;
     }
-    ++background_prevention_count;
-    background_callback_t *cb = (background_callback_t *)callback_head;
-    callback_head = NULL;
-    callback_tail = NULL;
+    mp_printf(&mp_plat_print, "\nBackground work:\n");
+    bool printed[CIRCUITPY_BACKGROUND_CALLBACK_STATS_LEN] = { false };
+    for (size_t n = 0; n < callback_stats_len; n++) {
+        size_t slowest = 0;
+        for (size_t i = 0; i < callback_stats_len; i++) {
+            if (!printed[i] && (printed[slowest] || callback_stats[i].total > callback_stats[slowest].total)) {
+                slowest = i;
+            }
+        }
+        printed[slowest] = true;
+        const background_callback_stats_t *stats = &callback_stats[slowest];
+        mp_printf(&mp_plat_print, "  %08x: %u calls, %u ms total, %u us max\n",
+            (unsigned int)(uintptr_t)stats->fun, (unsigned int)stats->calls,
+            (unsigned int)(stats->total * 1000 / 32768), (unsigned int)((uint64_t)stats->max * 1000000 / 32768));
+    }
+}
+#endif
+
+// Moves the newly added callbacks of a class to the end of its queue.
+static void move_added(size_t priority) {
+    background_callback_t *cb = take_added(priority);
+    // The stack has the newest first, so reverse it.
+    background_callback_t *first = NULL;
+    background_callback_t *last = cb;
     while (cb) {
         background_callback_t *next = cb->next;
-        cb->next = cb->prev = NULL;
+        cb->next = first;
+        first = cb;
+        cb = next;
+    }
+    if (!first) {
+        return;
+    }
+    if (callback_tail[priority]) {
+        callback_tail[priority]->next = first;
+    } else {
+        callback_head[priority] = first;
+    }
+    callback_tail[priority] = last;
+}
+
+// Runs the callbacks queued in one class. Ones added while it runs, including callbacks that add
+// themselves again, wait for the next run. Real-time callbacks run first and again before each
+// callback of the other classes. Housekeeping stops once it has used its time.
+static void PLACE_IN_ITCM(run_queue)(size_t priority) {
+    move_added(priority);
+    bool timing = false;
+    uint64_t start = 0;
+    while (callback_head[priority]) {
+        if (priority != BACKGROUND_CALLBACK_PRIORITY_REALTIME) {
+            run_queue(BACKGROUND_CALLBACK_PRIORITY_REALTIME);
+        }
+        background_callback_t *cb = callback_head[priority];
+        callback_head[priority] = cb->next;
+        if (!cb->next) {
+            callback_tail[priority] = NULL;
+        }
+        cb->next = NULL;
         background_callback_fun fun = cb->fun;
         void *data = cb->data;
-        CALLBACK_CRITICAL_END;
-        // Leave the critical section in order to run the callback function
+        #if CIRCUITPY_BACKGROUND_CALLBACK_STATS
+        background_callback_stats_t *stats = fun ? find_stats(cb, fun) : NULL;
+        #endif
+        release(cb);
+        if (priority == BACKGROUND_CALLBACK_PRIORITY_HOUSEKEEPING && !timing) {
+            start = port_get_raw_ticks(NULL);
+            timing = true;
+        }
         if (fun) {
+            #if CIRCUITPY_BACKGROUND_CALLBACK_STATS
+            uint64_t call_start = stats_now();
+            fun(data);
+            uint32_t elapsed = stats_now() - call_start;
+            stats->calls++;
+            stats->total += elapsed;
+            stats->max = MAX(stats->max, elapsed);
+            #else
             fun(data);
+            #endif
+        }
+        if (priority == BACKGROUND_CALLBACK_PRIORITY_HOUSEKEEPING &&
+            port_get_raw_ticks(NULL) - start >= CIRCUITPY_BACKGROUND_CALLBACK_HOUSEKEEPING_TICKS) {
+            return;
         }
-        CALLBACK_CRITICAL_BEGIN;
-        cb = next;
     }
+}
+
+void PLACE_IN_ITCM(background_callback_run_all)() {
+    port_background_task();
+    if (!background_callback_pending()) {
+        return;
+    }
+    CALLBACK_CRITICAL_BEGIN;
+    if (background_prevention_count) {
+        CALLBACK_CRITICAL_END;
+        return;
+    }
+    ++background_prevention_count;
+    CALLBACK_CRITICAL_END;
+    // The queues are only touched here, so the callbacks run outside the critical section.
+    run_queue(BACKGROUND_CALLBACK_PRIORITY_REALTIME);
+    run_queue(BACKGROUND_CALLBACK_PRIORITY_NORMAL);
+    run_queue(BACKGROUND_CALLBACK_PRIORITY_HOUSEKEEPING);
+    CALLBACK_CRITICAL_BEGIN;
     --background_prevention_count;
     CALLBACK_CRITICAL_END;
 }
@@ -102,13 +291,12 @@ void background_callback_allow() {
 }
 
 
-// Filter out queued callbacks if they are allocated on the heap.
-void background_callback_reset() {
+static void reset_queue(size_t priority) {
+    move_added(priority);
     background_callback_t *new_head = NULL;
     background_callback_t **previous_next = &new_head;
     background_callback_t *new_tail = NULL;
-    CALLBACK_CRITICAL_BEGIN;
-    background_callback_t *cb = (background_callback_t *)callback_head;
+    background_callback_t *cb = callback_head[priority];
     while (cb) {
         background_callback_t *next = cb->next;
         cb->next = NULL;
@@ -116,21 +304,27 @@ void background_callback_reset() {
         // reference data on the python heap. The python heap will be disappear
         // soon after this.
         if (gc_ptr_on_heap((void *)cb) || gc_ptr_on_heap(cb->data)) {
-            cb->prev = NULL; // Used to indicate a callback isn't queued.
+            release(cb);
         } else {
             // Set .next of the previous callback.
             *previous_next = cb;
             // Set our .next for the next callback.
             previous_next = &cb->next;
-            // Set our prev to the last callback.
-            cb->prev = new_tail;
             // Now we're the tail of the list.
             new_tail = cb;
         }
         cb = next;
     }
-    callback_head = new_head;
-    callback_tail = new_tail;
+    callback_head[priority] = new_head;
+    callback_tail[priority] = new_tail;
+}
+
+// Filter out queued callbacks if they are allocated on the heap.
+void background_callback_reset() {
+    CALLBACK_CRITICAL_BEGIN;
+    for (size_t i = 0; i < BACKGROUND_CALLBACK_PRIORITY_COUNT; i++) {
+        reset_queue(i);
+    }
     background_prevention_count = 0;
     CALLBACK_CRITICAL_END;
 }
@@ -150,9 +344,19 @@ void background_callback_gc_collect(void) {
     // It's necessary to traverse the whole list here, as the callbacks
     // themselves can be in non-gc memory, and some of the cb->data
     // objects themselves might be in non-gc memory.
-    background_callback_t *cb = (background_callback_t *)callback_head;
-    while (cb) {
-        gc_collect_ptr(cb->data);
-        cb = cb->next;
+    //
+    // Interrupts only push onto the front of the stacks of added callbacks,
+    // so walking them from their current top is safe too.
+    for (size_t i = 0; i < BACKGROUND_CALLBACK_PRIORITY_COUNT; i++) {
+        background_callback_t *cb = callback_added[i];
+        while (cb) {
+            gc_collect_ptr(cb->data);
+            cb = cb->next;
+        }
+        cb = callback_head[i];
+        while (cb) {
+            gc_collect_ptr(cb->data);
+            cb = cb->next;
+        }
     }
 }
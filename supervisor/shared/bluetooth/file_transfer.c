@@ -664,7 +664,8 @@ void supervisor_bluetooth_file_transfer_background(void) {
                 current_state == DELETE ||
                 current_state == MKDIR ||
                 current_state == MOVE) {
-                autoreload_trigger();
+                // The command has finished, so its change is complete.
+                autoreload_trigger_complete();
             }
         }
     }
@@ -12,6 +12,7 @@
 #include "supervisor/port.h"
 #include "supervisor/spi_flash_api.h"
 #include "supervisor/shared/external_flash/common_commands.h"
+#include "supervisor/shared/external_flash/ftl.h"
 #include "extmod/vfs.h"
 #include "extmod/vfs_fat.h"
 #include "py/misc.h"
@@ -22,24 +23,43 @@
 
 #define NO_SECTOR_LOADED 0xFFFFFFFF
 
-// The currently cached sector in the cache, ram or flash based.
-static uint32_t current_sector;
-
 static const external_flash_device possible_devices[] = {EXTERNAL_FLASH_DEVICES};
 #define EXTERNAL_FLASH_DEVICE_COUNT MP_ARRAY_SIZE(possible_devices)
 
 static const external_flash_device *flash_device = NULL;
 
-// Track which blocks (up to 32) in the current sector currently live in the
-// cache.
-static uint32_t dirty_mask;
-
-// Table of pointers to each cached block. Should be zero'd after allocation.
 #define BLOCKS_PER_SECTOR (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE)
 #define PAGES_PER_BLOCK (FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE)
 #define FLASH_CACHE_TABLE_NUM_ENTRIES (BLOCKS_PER_SECTOR * PAGES_PER_BLOCK)
 #define FLASH_CACHE_TABLE_SIZE (FLASH_CACHE_TABLE_NUM_ENTRIES * sizeof (uint8_t *))
-static uint8_t **flash_cache_table = NULL;
+
+// A sector with blocks that have been written but aren't on the flash yet.
+typedef struct {
+    // The cached sector, or NO_SECTOR_LOADED.
+    uint32_t sector;
+    // Track which blocks (up to 32) in the sector currently live in the cache.
+    uint32_t dirty_mask;
+    // When the sector was last written, for least recently used eviction.
+    uint32_t last_use;
+    // Table of pointers to each cached page. Should be zero'd after allocation. When
+    // the first entry has no table, its blocks are cached in the scratch sector instead.
+    uint8_t **flash_cache_table;
+} sector_cache_t;
+
+// Tables are allocated in order as more sectors are needed, so only a prefix has them.
+static sector_cache_t sector_cache[SPI_FLASH_CACHE_SECTORS];
+static uint32_t sector_cache_uses;
+
+#if EXTERNAL_FLASH_FTL
+// Whether blocks go through the translation layer. Devices without an erase command overwrite
+// the rest of a page when programming it, so they are mapped directly.
+static bool use_ftl = false;
+#endif
+
+#if SPI_FLASH_TRACK_DISCARDS
+// One bit for each block, allocated on the first discard and kept from then on.
+static uint32_t *discarded_blocks = NULL;
+#endif
 
 // Wait until both the write enable and write in progress bits have cleared.
 static bool wait_for_flash_ready(void) {
@@ -281,9 +301,18 @@ void supervisor_flash_init(void) {
 
     wait_for_flash_ready();
 
-    current_sector = NO_SECTOR_LOADED;
-    dirty_mask = 0;
-    flash_cache_table = NULL;
+    for (size_t i = 0; i < SPI_FLASH_CACHE_SECTORS; i++) {
+        sector_cache[i].sector = NO_SECTOR_LOADED;
+        sector_cache[i].dirty_mask = 0;
+        sector_cache[i].flash_cache_table = NULL;
+    }
+
+    #if EXTERNAL_FLASH_FTL
+    if (!flash_device->no_erase_cmd) {
+        use_ftl = true;
+        external_flash_ftl_init(flash_device->total_size);
+    }
+    #endif
 }
 
 // The size of each individual block.
@@ -296,25 +325,46 @@ uint32_t supervisor_flash_get_block_count(void) {
     if (flash_device == NULL) {
         return 0;
     }
+    #if EXTERNAL_FLASH_FTL
+    if (use_ftl) {
+        return external_flash_ftl_get_block_count();
+    }
+    #endif
     // We subtract one erase sector size because we may use it as a staging area
     // for writes.
     return (flash_device->total_size - SPI_FLASH_ERASE_SIZE) / FILESYSTEM_BLOCK_SIZE;
 }
 
+// The blocks of a cached sector that weren't written and don't need to be kept either, so
+// they can be left erased.
+static uint32_t unneeded_blocks(sector_cache_t *cache) {
+    uint32_t mask = 0;
+    #if SPI_FLASH_TRACK_DISCARDS
+    if (discarded_blocks != NULL) {
+        uint32_t first_block = cache->sector / FILESYSTEM_BLOCK_SIZE;
+        for (size_t i = 0; i < BLOCKS_PER_SECTOR; i++) {
+            uint32_t block = first_block + i;
+            if (discarded_blocks[block / 32] & (1u << (block % 32))) {
+                mask |= 1 << i;
+            }
+        }
+    }
+    #endif
+    return mask & ~cache->dirty_mask;
+}
+
 // Flush the cache that was written to the scratch portion of flash. Only used
 // when ram is tight.
-static bool flush_scratch_flash(void) {
-    if (current_sector == NO_SECTOR_LOADED) {
-        return true;
-    }
+static bool flush_scratch_flash(sector_cache_t *cache) {
+    uint32_t unneeded = unneeded_blocks(cache);
     // First, copy out any blocks that we haven't touched from the sector we've
     // cached.
     bool copy_to_scratch_ok = true;
     uint32_t scratch_sector = flash_device->total_size - SPI_FLASH_ERASE_SIZE;
     for (size_t i = 0; i < BLOCKS_PER_SECTOR; i++) {
-        if ((dirty_mask & (1 << i)) == 0) {
+        if (((cache->dirty_mask | unneeded) & (1 << i)) == 0) {
             copy_to_scratch_ok = copy_to_scratch_ok &&
-                copy_block(current_sector + i * FILESYSTEM_BLOCK_SIZE,
+                copy_block(cache->sector + i * FILESYSTEM_BLOCK_SIZE,
                 scratch_sector + i * FILESYSTEM_BLOCK_SIZE);
         }
     }
@@ -324,44 +374,47 @@ static bool flush_scratch_flash(void) {
         return false;
     }
     // Second, erase the current sector.
-    erase_sector(current_sector);
+    erase_sector(cache->sector);
     // Finally, copy the new version into it.
     for (size_t i = 0; i < BLOCKS_PER_SECTOR; i++) {
+        if ((unneeded & (1 << i)) != 0) {
+            continue;
+        }
         copy_block(scratch_sector + i * FILESYSTEM_BLOCK_SIZE,
-            current_sector + i * FILESYSTEM_BLOCK_SIZE);
+            cache->sector + i * FILESYSTEM_BLOCK_SIZE);
     }
     return true;
 }
 
 // Free all entries in the partially or completely filled flash_cache_table, and then free the table itself.
-static void release_ram_cache(void) {
-    if (flash_cache_table == NULL) {
+static void release_ram_cache(sector_cache_t *cache) {
+    if (cache->flash_cache_table == NULL) {
         return;
     }
 
     for (size_t i = 0; i < FLASH_CACHE_TABLE_NUM_ENTRIES; i++) {
         // Table may not be completely full. Stop at first NULL entry.
-        if (flash_cache_table[i] == NULL) {
+        if (cache->flash_cache_table[i] == NULL) {
             break;
         }
-        port_free(flash_cache_table[i]);
+        port_free(cache->flash_cache_table[i]);
     }
-    port_free(flash_cache_table);
-    flash_cache_table = NULL;
+    port_free(cache->flash_cache_table);
+    cache->flash_cache_table = NULL;
 }
 
 // Attempts to allocate a new set of page buffers for caching a full sector in
 // ram. Each page is allocated separately so that the GC doesn't need to provide
 // one huge block. We can free it as we write if we want to also.
-static bool allocate_ram_cache(void) {
-    flash_cache_table = port_malloc(FLASH_CACHE_TABLE_SIZE, false);
-    if (flash_cache_table == NULL) {
+static bool allocate_ram_cache(sector_cache_t *cache) {
+    cache->flash_cache_table = port_malloc(FLASH_CACHE_TABLE_SIZE, false);
+    if (cache->flash_cache_table == NULL) {
         // Not enough space even for the cache table.
         return false;
     }
 
     // Clear all the entries so it's easy to find the last entry.
-    memset(flash_cache_table, 0, FLASH_CACHE_TABLE_SIZE);
+    memset(cache->flash_cache_table, 0, FLASH_CACHE_TABLE_SIZE);
 
     bool success = true;
     for (size_t i = 0; i < BLOCKS_PER_SECTOR && success; i++) {
@@ -371,41 +424,30 @@ static bool allocate_ram_cache(void) {
                 success = false;
                 break;
             }
-            flash_cache_table[i * PAGES_PER_BLOCK + j] = page_cache;
+            cache->flash_cache_table[i * PAGES_PER_BLOCK + j] = page_cache;
         }
     }
 
     // We couldn't allocate enough so give back what we got.
     if (!success) {
-        release_ram_cache();
+        release_ram_cache(cache);
     }
     return success;
 }
 
-// Flush the cached sector from ram onto the flash. We'll free the cache unless
-// keep_cache is true.
-static bool flush_ram_cache(bool keep_cache) {
-    if (flash_cache_table == NULL) {
-        // Nothing to flush because there is no cache.
-        return true;
-    }
-
-    if (current_sector == NO_SECTOR_LOADED) {
-        if (!keep_cache) {
-            release_ram_cache();
-        }
-        return true;
-    }
+// Flush the cached sector from ram onto the flash.
+static bool flush_ram_cache(sector_cache_t *cache) {
+    uint32_t unneeded = unneeded_blocks(cache);
     // First, copy out any blocks that we haven't touched from the sector
     // we've cached. If we don't do this we'll erase the data during the sector
     // erase below.
     bool copy_to_ram_ok = true;
     for (size_t i = 0; i < BLOCKS_PER_SECTOR; i++) {
-        if ((dirty_mask & (1 << i)) == 0) {
+        if (((cache->dirty_mask | unneeded) & (1 << i)) == 0) {
             for (size_t j = 0; j < PAGES_PER_BLOCK; j++) {
                 copy_to_ram_ok = read_flash(
-                    current_sector + (i * PAGES_PER_BLOCK + j) * SPI_FLASH_PAGE_SIZE,
-                    flash_cache_table[i * PAGES_PER_BLOCK + j],
+                    cache->sector + (i * PAGES_PER_BLOCK + j) * SPI_FLASH_PAGE_SIZE,
+                    cache->flash_cache_table[i * PAGES_PER_BLOCK + j],
                     SPI_FLASH_PAGE_SIZE);
                 if (!copy_to_ram_ok) {
                     break;
@@ -421,40 +463,52 @@ static bool flush_ram_cache(bool keep_cache) {
         return false;
     }
     // Second, erase the current sector.
-    erase_sector(current_sector);
+    erase_sector(cache->sector);
     // Lastly, write all the data in ram that we've cached.
     for (size_t i = 0; i < BLOCKS_PER_SECTOR; i++) {
+        if ((unneeded & (1 << i)) != 0) {
+            continue;
+        }
         for (size_t j = 0; j < PAGES_PER_BLOCK; j++) {
-            write_flash(current_sector + (i * PAGES_PER_BLOCK + j) * SPI_FLASH_PAGE_SIZE,
-                flash_cache_table[i * PAGES_PER_BLOCK + j],
+            write_flash(cache->sector + (i * PAGES_PER_BLOCK + j) * SPI_FLASH_PAGE_SIZE,
+                cache->flash_cache_table[i * PAGES_PER_BLOCK + j],
                 SPI_FLASH_PAGE_SIZE);
         }
     }
-    // We're done with the cache for now so give it back.
-    if (!keep_cache) {
-        release_ram_cache();
-    }
     return true;
 }
 
-// Delegates to the correct flash flush method depending on the existing cache.
-// TODO Don't blink the status indicator if we don't actually do any writing (hard to tell right now).
-static void spi_flash_flush_keep_cache(bool keep_cache) {
+// Writes out one cached sector, from ram or the scratch sector, and leaves the entry
+// empty. The status indicator is only lit while a sector is actually written.
+static void flush_sector(sector_cache_t *cache) {
+    if (cache->sector == NO_SECTOR_LOADED) {
+        return;
+    }
     #ifdef MICROPY_HW_LED_MSC
     port_pin_set_output_level(MICROPY_HW_LED_MSC, true);
     #endif
-    // If we've cached to the flash itself flush from there.
-    if (flash_cache_table == NULL) {
-        flush_scratch_flash();
+    if (cache->flash_cache_table == NULL) {
+        flush_scratch_flash(cache);
     } else {
-        flush_ram_cache(keep_cache);
+        flush_ram_cache(cache);
     }
-    current_sector = NO_SECTOR_LOADED;
+    cache->sector = NO_SECTOR_LOADED;
+    cache->dirty_mask = 0;
     #ifdef MICROPY_HW_LED_MSC
     port_pin_set_output_level(MICROPY_HW_LED_MSC, false);
     #endif
 }
 
+// Flushes every cached sector. The ram is given back unless keep_cache is true.
+static void spi_flash_flush_keep_cache(bool keep_cache) {
+    for (size_t i = 0; i < SPI_FLASH_CACHE_SECTORS; i++) {
+        flush_sector(&sector_cache[i]);
+        if (!keep_cache) {
+            release_ram_cache(&sector_cache[i]);
+        }
+    }
+}
+
 void supervisor_external_flash_flush(void) {
     spi_flash_flush_keep_cache(true);
 }
@@ -463,6 +517,49 @@ void supervisor_flash_release_cache(void) {
     spi_flash_flush_keep_cache(false);
 }
 
+static sector_cache_t *find_cached_sector(uint32_t sector) {
+    for (size_t i = 0; i < SPI_FLASH_CACHE_SECTORS; i++) {
+        if (sector_cache[i].sector == sector) {
+            return &sector_cache[i];
+        }
+    }
+    return NULL;
+}
+
+// Finds room to cache another sector. An entry without a sector is used first, allocating
+// ram for it if needed, and otherwise the least recently written sector is flushed. When
+// there isn't ram for even one sector, the only entry is cached in the scratch sector.
+static sector_cache_t *cache_sector(uint32_t sector) {
+    sector_cache_t *cache = &sector_cache[0];
+    if (cache->flash_cache_table == NULL) {
+        // The scratch sector only holds one sector, so it is written out before ram is tried.
+        flush_sector(cache);
+        if (!allocate_ram_cache(cache)) {
+            erase_sector(flash_device->total_size - SPI_FLASH_ERASE_SIZE);
+            wait_for_flash_ready();
+            cache->sector = sector;
+            return cache;
+        }
+    }
+    sector_cache_t *oldest = cache;
+    for (size_t i = 0; i < SPI_FLASH_CACHE_SECTORS; i++) {
+        cache = &sector_cache[i];
+        if (cache->flash_cache_table == NULL && !allocate_ram_cache(cache)) {
+            break;
+        }
+        if (cache->sector == NO_SECTOR_LOADED) {
+            oldest = cache;
+            break;
+        }
+        if (cache->last_use < oldest->last_use) {
+            oldest = cache;
+        }
+    }
+    flush_sector(oldest);
+    oldest->sector = sector;
+    return oldest;
+}
+
 static int32_t convert_block_to_flash_addr(uint32_t block) {
     if (0 <= block && block < supervisor_flash_get_block_count()) {
         // a block in partition 1
@@ -483,12 +580,13 @@ static bool external_flash_read_block(uint8_t *dest, uint32_t block) {
     uint32_t this_sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
     size_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % BLOCKS_PER_SECTOR;
     uint32_t mask = 1 << (block_index);
-    // We're reading from the currently cached sector.
-    if (current_sector == this_sector && (mask & dirty_mask) > 0) {
-        if (flash_cache_table != NULL) {
+    sector_cache_t *cache = find_cached_sector(this_sector);
+    // We're reading from a cached sector.
+    if (cache != NULL && (mask & cache->dirty_mask) > 0) {
+        if (cache->flash_cache_table != NULL) {
             for (int i = 0; i < PAGES_PER_BLOCK; i++) {
                 memcpy(dest + i * SPI_FLASH_PAGE_SIZE,
-                    flash_cache_table[block_index * PAGES_PER_BLOCK + i],
+                    cache->flash_cache_table[block_index * PAGES_PER_BLOCK + i],
                     SPI_FLASH_PAGE_SIZE);
             }
             return true;
@@ -513,29 +611,32 @@ static bool external_flash_write_block(const uint8_t *data, uint32_t block) {
     uint32_t this_sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
     size_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % BLOCKS_PER_SECTOR;
     uint32_t mask = 1 << (block_index);
-    // Flush the cache if we're moving onto a sector or we're writing the
-    // same block again.
-    if (current_sector != this_sector || (mask & dirty_mask) > 0) {
+    #if SPI_FLASH_TRACK_DISCARDS
+    if (discarded_blocks != NULL) {
+        discarded_blocks[block / 32] &= ~(1u << (block % 32));
+    }
+    #endif
+    sector_cache_t *cache = find_cached_sector(this_sector);
+    // A block in ram can simply be replaced, but one in the scratch sector can't be
+    // written again without an erase so the sector is flushed first.
+    if (cache != NULL && cache->flash_cache_table == NULL && (mask & cache->dirty_mask) > 0) {
+        flush_sector(cache);
+        cache = NULL;
+    }
+    if (cache == NULL) {
         // Check to see if we'd write to an erased page. In that case we
         // can write directly.
         if (page_erased(address)) {
             return write_flash(address, data, FILESYSTEM_BLOCK_SIZE);
         }
-        if (current_sector != NO_SECTOR_LOADED) {
-            supervisor_flash_flush();
-        }
-        if (flash_cache_table == NULL && !allocate_ram_cache()) {
-            erase_sector(flash_device->total_size - SPI_FLASH_ERASE_SIZE);
-            wait_for_flash_ready();
-        }
-        current_sector = this_sector;
-        dirty_mask = 0;
+        cache = cache_sector(this_sector);
     }
-    dirty_mask |= mask;
+    cache->dirty_mask |= mask;
+    cache->last_use = ++sector_cache_uses;
     // Copy the block to the appropriate cache.
-    if (flash_cache_table != NULL) {
+    if (cache->flash_cache_table != NULL) {
         for (int i = 0; i < PAGES_PER_BLOCK; i++) {
-            memcpy(flash_cache_table[block_index * PAGES_PER_BLOCK + i],
+            memcpy(cache->flash_cache_table[block_index * PAGES_PER_BLOCK + i],
                 data + i * SPI_FLASH_PAGE_SIZE,
                 SPI_FLASH_PAGE_SIZE);
         }
@@ -547,6 +648,16 @@ static bool external_flash_write_block(const uint8_t *data, uint32_t block) {
 }
 
 mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t num_blocks) {
+    #if EXTERNAL_FLASH_FTL
+    if (use_ftl) {
+        for (size_t i = 0; i < num_blocks; i++) {
+            if (!external_flash_ftl_read_block(dest + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
+                return 1; // error
+            }
+        }
+        return 0; // success
+    }
+    #endif
     for (size_t i = 0; i < num_blocks; i++) {
         if (!external_flash_read_block(dest + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
             return 1; // error
@@ -556,6 +667,16 @@ mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block_num, uint32
 }
 
 mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t block_num, uint32_t num_blocks) {
+    #if EXTERNAL_FLASH_FTL
+    if (use_ftl) {
+        for (size_t i = 0; i < num_blocks; i++) {
+            if (!external_flash_ftl_write_block(src + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
+                return 1; // error
+            }
+        }
+        return 0; // success
+    }
+    #endif
     for (size_t i = 0; i < num_blocks; i++) {
         if (!external_flash_write_block(src + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
             return 1; // error
@@ -564,5 +685,54 @@ mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t block_num,
     return 0; // success
 }
 
+#if SPI_FLASH_TRACK_DISCARDS || EXTERNAL_FLASH_FTL
+void supervisor_flash_discard_blocks(uint32_t block_num, uint32_t num_blocks) {
+    #if EXTERNAL_FLASH_FTL
+    if (use_ftl) {
+        for (uint32_t i = 0; i < num_blocks; i++) {
+            external_flash_ftl_discard_block(block_num + i);
+        }
+        return;
+    }
+    #endif
+    #if SPI_FLASH_TRACK_DISCARDS
+    uint32_t block_count = supervisor_flash_get_block_count();
+    if (discarded_blocks == NULL) {
+        size_t size = (block_count + 31) / 32 * sizeof(uint32_t);
+        discarded_blocks = port_malloc(size, false);
+        if (discarded_blocks == NULL) {
+            // Discards are only hints, so they are dropped without the ram to track them.
+            return;
+        }
+        memset(discarded_blocks, 0, size);
+    }
+    for (uint32_t block = block_num; block < block_num + num_blocks && block < block_count; block++) {
+        discarded_blocks[block / 32] |= 1u << (block % 32);
+        // A copy in ram doesn't need writing out any more. One in the scratch sector stays
+        // dirty, since it can't be written again without an erase.
+        uint32_t address = block * FILESYSTEM_BLOCK_SIZE;
+        sector_cache_t *cache = find_cached_sector(address & ~(SPI_FLASH_ERASE_SIZE - 1));
+        if (cache != NULL && cache->flash_cache_table != NULL) {
+            cache->dirty_mask &= ~(1 << ((address / FILESYSTEM_BLOCK_SIZE) % BLOCKS_PER_SECTOR));
+        }
+    }
+    #endif
+}
+#endif
+
+#if EXTERNAL_FLASH_FTL
+bool external_flash_raw_read(uint32_t address, uint8_t *data, uint32_t length) {
+    return read_flash(address, data, length);
+}
+
+bool external_flash_raw_write(uint32_t address, const uint8_t *data, uint32_t length) {
+    return write_flash(address, data, length);
+}
+
+bool external_flash_raw_erase(uint32_t sector_address) {
+    return erase_sector(sector_address) && wait_for_flash_ready();
+}
+#endif
+
 void MP_WEAK external_flash_setup(void) {
 }
@@ -24,6 +24,18 @@
 #define SPI_FLASH_MAX_BAUDRATE 8000000
 #endif
 
+// The most erase sectors that are written back from ram at once. Fewer are used when ram is
+// short.
+#ifndef SPI_FLASH_CACHE_SECTORS
+#define SPI_FLASH_CACHE_SECTORS (4)
+#endif
+
+// Remember blocks the filesystem has freed, at one bit per block, so that they aren't copied
+// when their sector is rewritten.
+#ifndef SPI_FLASH_TRACK_DISCARDS
+#define SPI_FLASH_TRACK_DISCARDS (1)
+#endif
+
 void supervisor_external_flash_flush(void);
 
 // Configure anything that needs to get set up before the external flash
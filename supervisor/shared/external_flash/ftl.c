@@ -0,0 +1,352 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "supervisor/shared/external_flash/ftl.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "py/misc.h"
+#include "supervisor/port.h"
+#include "supervisor/shared/external_flash/external_flash.h"
+
+// Each erase sector starts with a header, padded to a block, followed by one slot for each block
+// it holds. The header has the sector's sequence number, which grows every time a sector is
+// started, and the logical block stored in each slot. A slot is only tagged once its data is
+// programmed, so a write cut off by power loss leaves the last copy of the block in use. Copies
+// that are replaced or discarded have their tag cleared afterwards, so they don't come back and
+// take up space after a reset. Where power was lost before that, the copy in the latest slot is
+// current.
+#define FTL_MAGIC (0x4c544643) // "CFTL"
+#define SLOTS_PER_SECTOR (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE - 1)
+// Sectors that storage doesn't count, so garbage collection always has room to work in.
+#define SPARE_SECTORS (2)
+
+#define FREE_SECTOR (0xff)
+#define NO_SLOT (0xffff)
+#define NO_SECTOR (0xffffffff)
+
+// Programming only clears bits and erasing only sets them, so a value stored with its complement
+// can't be cut off part way and still look valid.
+typedef struct {
+    uint32_t magic;
+    uint32_t sequence;
+    uint32_t sequence_complement;
+    // The block number in the low half and its complement in the high half.
+    uint32_t tags[SLOTS_PER_SECTOR];
+} ftl_header_t;
+
+static uint32_t sector_count;
+static uint32_t block_count;
+// The slot holding each logical block, numbered across all sectors, or NO_SLOT.
+static uint16_t *block_map;
+// How many current blocks each sector holds, or FREE_SECTOR once it can be erased and reused.
+static uint8_t *live_blocks;
+static uint32_t free_sectors;
+// The sector being filled and its next slot.
+static uint32_t open_sector;
+static uint32_t next_slot;
+static uint32_t last_opened;
+static uint32_t next_sequence;
+
+static uint32_t tag_for(uint32_t block) {
+    return block | ((~block & 0xffff) << 16);
+}
+
+static bool tag_valid(uint32_t tag) {
+    return (tag >> 16) == (~tag & 0xffff);
+}
+
+static uint32_t slot_address(uint32_t slot) {
+    return (slot / SLOTS_PER_SECTOR) * SPI_FLASH_ERASE_SIZE + (slot % SLOTS_PER_SECTOR + 1) * FILESYSTEM_BLOCK_SIZE;
+}
+
+// Drops the copy of a block in slot. A sector without current blocks is free again, unless it is
+// still being filled.
+static void release_slot(uint16_t slot) {
+    uint32_t sector = slot / SLOTS_PER_SECTOR;
+    live_blocks[sector]--;
+    if (live_blocks[sector] == 0 && sector != open_sector) {
+        live_blocks[sector] = FREE_SECTOR;
+        free_sectors++;
+    }
+}
+
+static void close_open_sector(void) {
+    if (open_sector == NO_SECTOR) {
+        return;
+    }
+    uint32_t sector = open_sector;
+    open_sector = NO_SECTOR;
+    if (live_blocks[sector] == 0) {
+        live_blocks[sector] = FREE_SECTOR;
+        free_sectors++;
+    }
+}
+
+// Sectors are used in turn, which spreads erases over the whole flash.
+static bool open_next_sector(void) {
+    close_open_sector();
+    for (uint32_t i = 1; i <= sector_count; i++) {
+        uint32_t sector = (last_opened + i) % sector_count;
+        if (live_blocks[sector] != FREE_SECTOR) {
+            continue;
+        }
+        ftl_header_t header;
+        memset(&header, 0xff, sizeof(header));
+        header.magic = FTL_MAGIC;
+        header.sequence = next_sequence;
+        header.sequence_complement = ~next_sequence;
+        next_sequence++;
+        if (!external_flash_raw_erase(sector * SPI_FLASH_ERASE_SIZE)) {
+            return false;
+        }
+        uint8_t page[SPI_FLASH_PAGE_SIZE];
+        memset(page, 0xff, sizeof(page));
+        memcpy(page, &header, sizeof(header));
+        if (!external_flash_raw_write(sector * SPI_FLASH_ERASE_SIZE, page, sizeof(page))) {
+            return false;
+        }
+        live_blocks[sector] = 0;
+        free_sectors--;
+        open_sector = sector;
+        next_slot = 0;
+        last_opened = sector;
+        return true;
+    }
+    return false;
+}
+
+// Programs the tag of a slot. The rest of the header page is written as ones, which leaves what
+// is already there alone.
+static bool write_tag(uint32_t slot, uint32_t tag) {
+    uint8_t page[SPI_FLASH_PAGE_SIZE];
+    memset(page, 0xff, sizeof(page));
+    memcpy(page + offsetof(ftl_header_t, tags) + (slot % SLOTS_PER_SECTOR) * sizeof(uint32_t), &tag, sizeof(tag));
+    return external_flash_raw_write((slot / SLOTS_PER_SECTOR) * SPI_FLASH_ERASE_SIZE, page, sizeof(page));
+}
+
+// Appends a copy of block to the open sector, with its data from a buffer or an existing slot.
+static bool append_block(uint32_t block, const uint8_t *data, uint16_t from_slot) {
+    if (open_sector == NO_SECTOR || next_slot == SLOTS_PER_SECTOR) {
+        if (!open_next_sector()) {
+            return false;
+        }
+    }
+    uint16_t slot = open_sector * SLOTS_PER_SECTOR + next_slot;
+    next_slot++;
+    uint32_t address = slot_address(slot);
+    if (data != NULL) {
+        if (!external_flash_raw_write(address, data, FILESYSTEM_BLOCK_SIZE)) {
+            return false;
+        }
+    } else {
+        // Copy page by page to minimize RAM buffer.
+        uint8_t page[SPI_FLASH_PAGE_SIZE];
+        uint32_t from_address = slot_address(from_slot);
+        for (uint32_t i = 0; i < FILESYSTEM_BLOCK_SIZE; i += SPI_FLASH_PAGE_SIZE) {
+            if (!external_flash_raw_read(from_address + i, page, sizeof(page)) ||
+                !external_flash_raw_write(address + i, page, sizeof(page))) {
+                return false;
+            }
+        }
+    }
+    if (!write_tag(slot, tag_for(block))) {
+        return false;
+    }
+    if (block_map[block] != NO_SLOT) {
+        write_tag(block_map[block], 0);
+        release_slot(block_map[block]);
+    }
+    block_map[block] = slot;
+    live_blocks[open_sector]++;
+    return true;
+}
+
+static uint32_t open_room(void) {
+    return open_sector == NO_SECTOR ? 0 : SLOTS_PER_SECTOR - next_slot;
+}
+
+// Moves the current blocks out of the full sector that has fewest, which frees it. Without a free
+// sector, they must fit in what is left of the open one.
+static bool collect_garbage(void) {
+    uint32_t room = open_room();
+    uint32_t victim = NO_SECTOR;
+    for (uint32_t sector = 0; sector < sector_count; sector++) {
+        if (sector == open_sector || live_blocks[sector] == FREE_SECTOR ||
+            (free_sectors == 0 && live_blocks[sector] > room)) {
+            continue;
+        }
+        if (victim == NO_SECTOR || live_blocks[sector] < live_blocks[victim]) {
+            victim = sector;
+        }
+    }
+    if (victim == NO_SECTOR) {
+        return false;
+    }
+    ftl_header_t header;
+    if (!external_flash_raw_read(victim * SPI_FLASH_ERASE_SIZE, (uint8_t *)&header, sizeof(header))) {
+        return false;
+    }
+    for (uint32_t i = 0; i < SLOTS_PER_SECTOR && live_blocks[victim] != FREE_SECTOR; i++) {
+        uint32_t tag = header.tags[i];
+        uint16_t slot = victim * SLOTS_PER_SECTOR + i;
+        if (tag_valid(tag) && (tag & 0xffff) < block_count && block_map[tag & 0xffff] == slot) {
+            if (!append_block(tag & 0xffff, NULL, slot)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool slot_erased(uint32_t slot) {
+    uint8_t page[SPI_FLASH_PAGE_SIZE];
+    uint32_t address = slot_address(slot);
+    for (uint32_t i = 0; i < FILESYSTEM_BLOCK_SIZE; i += SPI_FLASH_PAGE_SIZE) {
+        if (!external_flash_raw_read(address + i, page, sizeof(page))) {
+            return false;
+        }
+        for (size_t j = 0; j < sizeof(page); j++) {
+            if (page[j] != 0xff) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool external_flash_ftl_init(uint32_t flash_size) {
+    sector_count = MIN(flash_size / SPI_FLASH_ERASE_SIZE, NO_SLOT / SLOTS_PER_SECTOR);
+    block_count = 0;
+    if (sector_count <= SPARE_SECTORS) {
+        return false;
+    }
+    uint32_t blocks = (sector_count - SPARE_SECTORS) * SLOTS_PER_SECTOR;
+    block_map = port_malloc(blocks * sizeof(uint16_t), false);
+    live_blocks = port_malloc(sector_count, false);
+    // Only needed to choose between copies while scanning.
+    uint32_t *sequences = port_malloc(sector_count * sizeof(uint32_t), false);
+    if (block_map == NULL || live_blocks == NULL || sequences == NULL) {
+        port_free(block_map);
+        port_free(live_blocks);
+        port_free(sequences);
+        block_map = NULL;
+        live_blocks = NULL;
+        return false;
+    }
+    block_count = blocks;
+    memset(block_map, 0xff, blocks * sizeof(uint16_t));
+    memset(live_blocks, FREE_SECTOR, sector_count);
+    free_sectors = sector_count;
+    open_sector = NO_SECTOR;
+    next_sequence = 0;
+    last_opened = sector_count - 1;
+
+    for (uint32_t sector = 0; sector < sector_count; sector++) {
+        ftl_header_t header;
+        if (!external_flash_raw_read(sector * SPI_FLASH_ERASE_SIZE, (uint8_t *)&header, sizeof(header)) ||
+            header.magic != FTL_MAGIC || header.sequence_complement != ~header.sequence) {
+            continue;
+        }
+        sequences[sector] = header.sequence;
+        live_blocks[sector] = 0;
+        free_sectors--;
+        if (header.sequence >= next_sequence) {
+            next_sequence = header.sequence + 1;
+            last_opened = sector;
+        }
+        for (uint32_t i = 0; i < SLOTS_PER_SECTOR; i++) {
+            uint32_t tag = header.tags[i];
+            uint32_t block = tag & 0xffff;
+            if (!tag_valid(tag) || block >= block_count) {
+                continue;
+            }
+            uint16_t slot = sector * SLOTS_PER_SECTOR + i;
+            uint16_t current = block_map[block];
+            if (current != NO_SLOT) {
+                uint32_t current_sector = current / SLOTS_PER_SECTOR;
+                if (current_sector != sector && sequences[current_sector] > header.sequence) {
+                    write_tag(slot, 0);
+                    continue;
+                }
+                write_tag(current, 0);
+                live_blocks[current_sector]--;
+            }
+            block_map[block] = slot;
+            live_blocks[sector]++;
+        }
+    }
+    port_free(sequences);
+
+    // Carry on filling the latest sector after its last used slot. A slot that was programmed
+    // without being tagged, or tagged part way, is skipped since it can't be programmed again.
+    if (live_blocks[last_opened] != FREE_SECTOR) {
+        ftl_header_t header;
+        if (!external_flash_raw_read(last_opened * SPI_FLASH_ERASE_SIZE, (uint8_t *)&header, sizeof(header))) {
+            return false;
+        }
+        uint32_t slot = SLOTS_PER_SECTOR;
+        while (slot > 0 && header.tags[slot - 1] == 0xffffffff &&
+               slot_erased(last_opened * SLOTS_PER_SECTOR + slot - 1)) {
+            slot--;
+        }
+        if (slot < SLOTS_PER_SECTOR) {
+            open_sector = last_opened;
+            next_slot = slot;
+        }
+    }
+    for (uint32_t sector = 0; sector < sector_count; sector++) {
+        if (live_blocks[sector] == 0 && sector != open_sector) {
+            live_blocks[sector] = FREE_SECTOR;
+            free_sectors++;
+        }
+    }
+    return true;
+}
+
+uint32_t external_flash_ftl_get_block_count(void) {
+    return block_count;
+}
+
+bool external_flash_ftl_read_block(uint8_t *dest, uint32_t block) {
+    if (block >= block_count) {
+        return false;
+    }
+    if (block_map[block] == NO_SLOT) {
+        // Never written, so read it as erased flash.
+        memset(dest, 0xff, FILESYSTEM_BLOCK_SIZE);
+        return true;
+    }
+    return external_flash_raw_read(slot_address(block_map[block]), dest, FILESYSTEM_BLOCK_SIZE);
+}
+
+bool external_flash_ftl_write_block(const uint8_t *data, uint32_t block) {
+    if (block >= block_count) {
+        return false;
+    }
+    // New data may only take the last free sector's place once garbage collection has moved a
+    // sector's blocks into it, so there is always a sector to collect into, even after power is
+    // lost part way through. There are always SPARE_SECTORS sectors of space that isn't current
+    // data, so the sector collected has room left over.
+    for (uint32_t i = 0; i < sector_count; i++) {
+        if (free_sectors > 1 || (free_sectors == 1 && open_room() > 0)) {
+            break;
+        }
+        if (!collect_garbage()) {
+            return false;
+        }
+    }
+    return append_block(block, data, NO_SLOT);
+}
+
+void external_flash_ftl_discard_block(uint32_t block) {
+    if (block < block_count && block_map[block] != NO_SLOT) {
+        write_tag(block_map[block], 0);
+        release_slot(block_map[block]);
+        block_map[block] = NO_SLOT;
+    }
+}
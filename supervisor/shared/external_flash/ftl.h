@@ -0,0 +1,30 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// A log structured translation layer between filesystem blocks and external flash, enabled with
+// EXTERNAL_FLASH_FTL. Every write goes to the next free slot of the sector being filled instead
+// of rewriting its erase sector in place, so small random writes don't erase anything most of the
+// time and the FAT doesn't wear out the sectors it lives in. Writes reach the flash before they
+// return, so there is nothing to flush.
+//
+// The flash holds a different format with this on, so the filesystem is recreated the first time.
+
+// Rebuilds the block map from the flash, which is flash_size bytes long. Returns false when there
+// isn't the ram for it, and then no blocks are available.
+bool external_flash_ftl_init(uint32_t flash_size);
+uint32_t external_flash_ftl_get_block_count(void);
+bool external_flash_ftl_read_block(uint8_t *dest, uint32_t block);
+bool external_flash_ftl_write_block(const uint8_t *data, uint32_t block);
+void external_flash_ftl_discard_block(uint32_t block);
+
+// Raw access to the flash for the translation layer, provided by external_flash.c.
+bool external_flash_raw_read(uint32_t address, uint8_t *data, uint32_t length);
+bool external_flash_raw_write(uint32_t address, const uint8_t *data, uint32_t length);
+bool external_flash_raw_erase(uint32_t sector_address);
@@ -29,10 +29,13 @@ static fs_user_mount_t _saves_usermount;
 
 static volatile uint32_t filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
 volatile bool filesystem_flush_requested = false;
+// How long the current flush has been put off by writes that kept coming.
+static uint32_t filesystem_flush_deferred_ms = 0;
 
 void filesystem_background(void) {
     if (filesystem_flush_requested) {
         filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
+        filesystem_flush_deferred_ms = 0;
         // Flush but keep caches
         supervisor_flash_flush();
         filesystem_flush_requested = false;
@@ -52,6 +55,38 @@ inline void filesystem_tick(void) {
     }
 }
 
+uint32_t filesystem_ticks_until_flush(void) {
+    if (filesystem_flush_interval_ms == 0) {
+        return UINT32_MAX;
+    }
+    return filesystem_flush_interval_ms;
+}
+
+void filesystem_ticks_passed(uint32_t ticks) {
+    if (filesystem_flush_interval_ms == 0) {
+        return;
+    }
+    // Leave the next filesystem_tick to request the flush.
+    if (ticks >= filesystem_flush_interval_ms) {
+        filesystem_flush_interval_ms = 1;
+    } else {
+        filesystem_flush_interval_ms -= ticks;
+    }
+}
+
+void filesystem_written(void) {
+    if (filesystem_flush_interval_ms == 0 || filesystem_flush_requested) {
+        return;
+    }
+    // Restart the countdown so that a burst of writes is flushed once, after it ends, but
+    // never put the flush off by more than two extra intervals.
+    uint32_t elapsed = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS - filesystem_flush_interval_ms;
+    if (filesystem_flush_deferred_ms + elapsed < 2 * CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS) {
+        filesystem_flush_deferred_ms += elapsed;
+        filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
+    }
+}
+
 
 __attribute__((unused)) // this function MAY be unused
 static void make_empty_file(FATFS *fatfs, const char *path) {
@@ -228,6 +263,7 @@ bool filesystem_init(bool create_allowed, bool force_create) {
 void PLACE_IN_ITCM(filesystem_flush)(void) {
     // Reset interval before next flush.
     filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
+    filesystem_flush_deferred_ms = 0;
     supervisor_flash_flush();
     // Don't keep caches because this is called when starting or stopping the VM.
     supervisor_flash_release_cache();
@@ -9,6 +9,7 @@
 #include "py/runtime.h"
 #include "lib/oofatfs/diskio.h"
 #include "lib/oofatfs/ff.h"
+#include "supervisor/filesystem.h"
 #include "supervisor/flash.h"
 #include "supervisor/shared/tick.h"
 
@@ -60,12 +61,47 @@ static bool flash_ioctl(mp_obj_t self_in, size_t cmd, size_t arg, mp_int_t *out_
         case MP_BLOCKDEV_IOCTL_BLOCK_SIZE:
             *out_value = self->block_size;
             break;
+        case MP_BLOCKDEV_IOCTL_BLOCK_ADDR: {
+            // The fake MBR isn't in flash.
+            if (arg < PART1_START_BLOCK) {
+                return false;
+            }
+            uint32_t block_num = arg - PART1_START_BLOCK;
+            #if CIRCUITPY_SAVES_PARTITION_SIZE > 0
+            block_num += self->offset / self->block_size;
+            #endif
+            const void *addr = supervisor_flash_get_block_address(block_num);
+            if (addr == NULL) {
+                return false;
+            }
+            *out_value = (uintptr_t)addr;
+            break;
+        }
+        case MP_BLOCKDEV_IOCTL_BLOCK_ERASE: {
+            // Only a hint from the filesystem, so the fake MBR is left alone.
+            if (arg < PART1_START_BLOCK) {
+                break;
+            }
+            uint32_t block_num = arg - PART1_START_BLOCK;
+            #if CIRCUITPY_SAVES_PARTITION_SIZE > 0
+            block_num += self->offset / self->block_size;
+            #endif
+            supervisor_flash_discard_blocks(block_num, 1);
+            break;
+        }
         default:
             return false;
     }
     return true;
 }
 
+MP_WEAK const void *supervisor_flash_get_block_address(uint32_t block_num) {
+    return NULL;
+}
+
+MP_WEAK void supervisor_flash_discard_blocks(uint32_t block_num, uint32_t num_blocks) {
+}
+
 static mp_obj_t supervisor_flash_obj_ioctl(mp_obj_t self, mp_obj_t cmd_in, mp_obj_t arg_in) {
     mp_int_t cmd = mp_obj_get_int(cmd_in);
     mp_int_t arg = mp_obj_get_int(arg_in);
@@ -161,9 +197,10 @@ static mp_uint_t flash_write_blocks(mp_obj_t self_in, const uint8_t *src, uint32
     } else {
         if (!filesystem_dirty) {
             // Turn on ticks so that we can flush after a period of time elapses.
-            supervisor_enable_tick();
+            supervisor_enable_tickless();
             filesystem_dirty = true;
         }
+        filesystem_written();
         block_num -= PART1_START_BLOCK;
         #if CIRCUITPY_SAVES_PARTITION_SIZE > 0
         mp_vfs_blockdev_t *self = (mp_vfs_blockdev_t *)self_in;
@@ -181,7 +218,7 @@ void PLACE_IN_ITCM(supervisor_flash_flush)(void) {
     #endif
     // Turn off ticks now that our filesystem has been flushed.
     if (filesystem_dirty) {
-        supervisor_disable_tick();
+        supervisor_disable_tickless();
     }
     filesystem_dirty = false;
 }
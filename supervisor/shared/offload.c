@@ -0,0 +1,104 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "supervisor/shared/offload.h"
+
+#include "py/mpconfig.h"
+#include "supervisor/linker.h"
+#include "supervisor/port.h"
+
+// Must be a power of two.
+#ifndef CIRCUITPY_OFFLOAD_QUEUE_LENGTH
+#define CIRCUITPY_OFFLOAD_QUEUE_LENGTH (8)
+#endif
+
+typedef struct {
+    supervisor_offload_fun_t fun;
+    void *arg;
+} offload_work_t;
+
+// A queue with one writer, the main core, which moves _submitted, and one reader, the second
+// core, which moves _finished, so neither needs a lock. Both only count up, and tickets are the
+// value _submitted reaches with the work.
+static offload_work_t _queue[CIRCUITPY_OFFLOAD_QUEUE_LENGTH];
+static volatile uint32_t _submitted;
+static volatile uint32_t _finished;
+static volatile bool _running;
+
+// Runs on the second core, from RAM so that it can wait while the flash is written.
+static void PLACE_IN_ITCM(offload_core_main)(void) {
+    while (__atomic_load_n(&_running, __ATOMIC_ACQUIRE)) {
+        uint32_t finished = _finished;
+        if (finished == __atomic_load_n(&_submitted, __ATOMIC_ACQUIRE)) {
+            port_offload_idle();
+            continue;
+        }
+        offload_work_t *work = &_queue[finished % CIRCUITPY_OFFLOAD_QUEUE_LENGTH];
+        work->fun(work->arg);
+        __atomic_store_n(&_finished, finished + 1, __ATOMIC_RELEASE);
+        port_wake_main_task();
+    }
+}
+
+bool supervisor_offload_start(void) {
+    if (_running) {
+        return true;
+    }
+    _submitted = 0;
+    _finished = 0;
+    __atomic_store_n(&_running, true, __ATOMIC_RELEASE);
+    if (!port_offload_start(offload_core_main)) {
+        _running = false;
+        return false;
+    }
+    return true;
+}
+
+void supervisor_offload_stop(void) {
+    if (!_running) {
+        return;
+    }
+    supervisor_offload_wait_all();
+    __atomic_store_n(&_running, false, __ATOMIC_RELEASE);
+    port_offload_wake();
+    port_offload_stop();
+}
+
+bool supervisor_offload_running(void) {
+    return _running;
+}
+
+uint32_t supervisor_offload_submit(supervisor_offload_fun_t fun, void *arg) {
+    uint32_t submitted = _submitted;
+    if (!_running) {
+        fun(arg);
+        // Nothing is queued, so keep the two counts equal.
+        _finished = submitted + 1;
+        _submitted = submitted + 1;
+        return submitted + 1;
+    }
+    while (submitted - __atomic_load_n(&_finished, __ATOMIC_ACQUIRE) >= CIRCUITPY_OFFLOAD_QUEUE_LENGTH) {
+    }
+    offload_work_t *work = &_queue[submitted % CIRCUITPY_OFFLOAD_QUEUE_LENGTH];
+    work->fun = fun;
+    work->arg = arg;
+    __atomic_store_n(&_submitted, submitted + 1, __ATOMIC_RELEASE);
+    port_offload_wake();
+    return submitted + 1;
+}
+
+bool supervisor_offload_done(uint32_t ticket) {
+    return (int32_t)(__atomic_load_n(&_finished, __ATOMIC_ACQUIRE) - ticket) >= 0;
+}
+
+void supervisor_offload_wait(uint32_t ticket) {
+    while (!supervisor_offload_done(ticket)) {
+    }
+}
+
+void supervisor_offload_wait_all(void) {
+    supervisor_offload_wait(_submitted);
+}
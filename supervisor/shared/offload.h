@@ -0,0 +1,36 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Runs native work, such as audio synthesis, rasterizing or DSP, on a second core that
+// CircuitPython otherwise leaves idle. Work is a function and an argument, queued from the main
+// core and run in the order queued. It runs alongside the VM, so it must not allocate, use Python
+// objects, raise, or call into anything that isn't safe to use from two cores at once. Buffers it
+// works on must stay allocated until it has finished. Work queued when there is no second core,
+// or before supervisor_offload_start(), runs before supervisor_offload_submit() returns.
+
+typedef void (*supervisor_offload_fun_t)(void *arg);
+
+// Starts the second core running queued work. Returns false when there is no second core free,
+// such as when usb_host or picodvi use it on the RP2 chips.
+bool supervisor_offload_start(void);
+// Waits for queued work and stops the second core. Called when the VM finishes.
+void supervisor_offload_stop(void);
+bool supervisor_offload_running(void);
+
+// Queues work and returns a ticket for it. Waits for room while the queue is full.
+uint32_t supervisor_offload_submit(supervisor_offload_fun_t fun, void *arg);
+// True once the work with ticket, and all queued before it, has finished.
+bool supervisor_offload_done(uint32_t ticket);
+// Spins until the work with ticket has finished. This doesn't run background tasks so that
+// background tasks themselves can wait.
+void supervisor_offload_wait(uint32_t ticket);
+// Spins until all queued work has finished, such as before the flash is written.
+void supervisor_offload_wait_all(void);
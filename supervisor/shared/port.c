@@ -28,6 +28,19 @@ MP_WEAK void port_wake_main_task_from_isr(void) {
 MP_WEAK void port_yield(void) {
 }
 
+MP_WEAK bool port_offload_start(void (*core_main)(void)) {
+    return false;
+}
+
+MP_WEAK void port_offload_stop(void) {
+}
+
+MP_WEAK void port_offload_wake(void) {
+}
+
+MP_WEAK void port_offload_idle(void) {
+}
+
 MP_WEAK void port_boot_info(void) {
 }
 
@@ -39,15 +52,35 @@ MP_WEAK void port_heap_init(void) {
 }
 
 MP_WEAK void *port_malloc(size_t size, bool dma_capable) {
+    #if CIRCUITPY_PORT_HEAP_POOLS
+    void *pooled = port_heap_pool_malloc(size);
+    if (pooled != NULL) {
+        return pooled;
+    }
+    #endif
     void *block = tlsf_malloc(heap, size);
     return block;
 }
 
+MP_WEAK void *port_malloc_fast(size_t size) {
+    return port_malloc(size, false);
+}
+
 MP_WEAK void port_free(void *ptr) {
+    #if CIRCUITPY_PORT_HEAP_POOLS
+    if (port_heap_pool_free(ptr)) {
+        return;
+    }
+    #endif
     tlsf_free(heap, ptr);
 }
 
 MP_WEAK void *port_realloc(void *ptr, size_t size, bool dma_capable) {
+    #if CIRCUITPY_PORT_HEAP_POOLS
+    if (port_heap_pool_realloc(&ptr, size, dma_capable)) {
+        return ptr;
+    }
+    #endif
     return tlsf_realloc(heap, ptr, size);
 }
 
@@ -66,6 +99,20 @@ MP_WEAK size_t port_heap_get_largest_free_size(void) {
     return tlsf_fit_size(heap, max_size);
 }
 
+static bool free_size_walker(void *ptr, size_t size, int used, void *user) {
+    size_t *free_size = (size_t *)user;
+    if (!used) {
+        *free_size += size;
+    }
+    return true;
+}
+
+MP_WEAK size_t port_heap_get_free_size(void) {
+    size_t free_size = 0;
+    tlsf_walk_pool(tlsf_get_pool(heap), free_size_walker, &free_size);
+    return free_size;
+}
+
 MP_WEAK bool port_boot_button_pressed(void) {
     #if defined(CIRCUITPY_BOOT_BUTTON)
     // Init/deinit the boot button every time in case it is used for LEDs.
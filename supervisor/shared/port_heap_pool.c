@@ -0,0 +1,114 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "supervisor/port_heap.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "py/mpconfig.h"
+#include "py/misc.h"
+
+#if CIRCUITPY_PORT_HEAP_POOLS
+
+// The free mask has a bit per block.
+#define MAX_POOL_COUNT (32)
+
+#if CIRCUITPY_PORT_HEAP_POOL_64_COUNT > MAX_POOL_COUNT || \
+    CIRCUITPY_PORT_HEAP_POOL_512_COUNT > MAX_POOL_COUNT || \
+    CIRCUITPY_PORT_HEAP_POOL_4096_COUNT > MAX_POOL_COUNT
+#error "Port heap pools can have at most 32 blocks each"
+#endif
+
+typedef struct {
+    uint16_t block_size;
+    uint8_t count;
+    uint8_t *start;
+    uint32_t free_mask;
+} port_heap_pool_t;
+
+static port_heap_pool_t pools[] = {
+    { .block_size = 64, .count = CIRCUITPY_PORT_HEAP_POOL_64_COUNT },
+    { .block_size = 512, .count = CIRCUITPY_PORT_HEAP_POOL_512_COUNT },
+    { .block_size = 4096, .count = CIRCUITPY_PORT_HEAP_POOL_4096_COUNT },
+};
+
+void port_heap_pool_init(void) {
+    for (size_t i = 0; i < MP_ARRAY_SIZE(pools); i++) {
+        port_heap_pool_t *pool = &pools[i];
+        if (pool->count == 0 || pool->start != NULL) {
+            continue;
+        }
+        // Pools are DMA capable so that any allocation can use them.
+        pool->start = port_malloc(pool->block_size * pool->count, true);
+        if (pool->start != NULL) {
+            pool->free_mask = pool->count == 32 ? UINT32_MAX : (1u << pool->count) - 1;
+        }
+    }
+}
+
+void *port_heap_pool_malloc(size_t size) {
+    for (size_t i = 0; i < MP_ARRAY_SIZE(pools); i++) {
+        port_heap_pool_t *pool = &pools[i];
+        // Leave much smaller allocations to the heap so the blocks aren't wasted on them.
+        if (size > pool->block_size || size <= pool->block_size / 2) {
+            continue;
+        }
+        if (pool->free_mask == 0) {
+            return NULL;
+        }
+        size_t index = __builtin_ctz(pool->free_mask);
+        pool->free_mask &= ~(1u << index);
+        return pool->start + index * pool->block_size;
+    }
+    return NULL;
+}
+
+static port_heap_pool_t *find_pool(void *ptr, size_t *index) {
+    uint8_t *p = ptr;
+    for (size_t i = 0; i < MP_ARRAY_SIZE(pools); i++) {
+        port_heap_pool_t *pool = &pools[i];
+        if (pool->start != NULL && p >= pool->start && p < pool->start + pool->block_size * pool->count) {
+            *index = (p - pool->start) / pool->block_size;
+            return pool;
+        }
+    }
+    return NULL;
+}
+
+bool port_heap_pool_free(void *ptr) {
+    size_t index;
+    port_heap_pool_t *pool = find_pool(ptr, &index);
+    if (pool == NULL) {
+        return false;
+    }
+    pool->free_mask |= 1u << index;
+    return true;
+}
+
+bool port_heap_pool_realloc(void **ptr, size_t size, bool dma_capable) {
+    size_t index;
+    port_heap_pool_t *pool = find_pool(*ptr, &index);
+    if (pool == NULL) {
+        return false;
+    }
+    if (size == 0) {
+        pool->free_mask |= 1u << index;
+        *ptr = NULL;
+    } else if (size > pool->block_size) {
+        void *new_ptr = port_malloc(size, dma_capable);
+        if (new_ptr == NULL) {
+            *ptr = NULL;
+            return true;
+        }
+        memcpy(new_ptr, *ptr, pool->block_size);
+        pool->free_mask |= 1u << index;
+        *ptr = new_ptr;
+    }
+    return true;
+}
+
+#endif
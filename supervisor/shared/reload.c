@@ -22,6 +22,9 @@ static uint32_t autoreload_suspended = 0;
 
 volatile uint32_t last_autoreload_trigger = 0;
 
+// How long after last_autoreload_trigger the reload happens.
+static uint32_t autoreload_delay_ms = CIRCUITPY_AUTORELOAD_DELAY_MS;
+
 void reload_initiate(supervisor_run_reason_t run_reason) {
     supervisor_set_run_reason(run_reason);
 
@@ -60,11 +63,27 @@ inline bool autoreload_is_enabled() {
     return autoreload_enabled;
 }
 
-void autoreload_trigger() {
+static uint32_t ms_since_trigger(void) {
+    uint32_t now = supervisor_ticks_ms32();
+    if (now >= last_autoreload_trigger) {
+        return now - last_autoreload_trigger;
+    }
+    return now + (0xffffffff - last_autoreload_trigger);
+}
+
+static void trigger(uint32_t delay_ms) {
     if (!autoreload_enabled || autoreload_suspended != 0) {
         return;
     }
     bool reload_initiated = autoreload_pending();
+    // A shorter delay doesn't cut short the wait for an earlier trigger.
+    if (reload_initiated) {
+        uint32_t elapsed = ms_since_trigger();
+        if (autoreload_delay_ms > elapsed) {
+            delay_ms = MAX(delay_ms, autoreload_delay_ms - elapsed);
+        }
+    }
+    autoreload_delay_ms = delay_ms;
     last_autoreload_trigger = supervisor_ticks_ms32();
     // Guard against the rare time that ticks is 0;
     if (last_autoreload_trigger == 0) {
@@ -78,19 +97,28 @@ void autoreload_trigger() {
     }
 }
 
+void autoreload_trigger() {
+    trigger(CIRCUITPY_AUTORELOAD_DELAY_MS);
+}
+
+void autoreload_trigger_complete() {
+    trigger(CIRCUITPY_AUTORELOAD_COMPLETE_DELAY_MS);
+}
+
 bool autoreload_ready() {
     if (last_autoreload_trigger == 0 || autoreload_suspended != 0) {
         return false;
     }
     // Wait for autoreload interval before reloading
-    uint32_t now = supervisor_ticks_ms32();
-    uint32_t diff;
-    if (now >= last_autoreload_trigger) {
-        diff = now - last_autoreload_trigger;
-    } else {
-        diff = now + (0xffffffff - last_autoreload_trigger);
+    return ms_since_trigger() > autoreload_delay_ms;
+}
+
+uint32_t autoreload_ms_until_ready(void) {
+    if (last_autoreload_trigger == 0 || autoreload_suspended != 0) {
+        return UINT32_MAX;
     }
-    return diff > CIRCUITPY_AUTORELOAD_DELAY_MS;
+    uint32_t elapsed = ms_since_trigger();
+    return elapsed > autoreload_delay_ms ? 0 : autoreload_delay_ms - elapsed;
 }
 
 bool autoreload_pending(void) {
@@ -35,9 +35,15 @@ bool autoreload_is_enabled(void);
 
 // Start the autoreload process.
 void autoreload_trigger(void);
+// Start the autoreload process after a write that is known to be complete, which waits
+// CIRCUITPY_AUTORELOAD_COMPLETE_DELAY_MS instead of CIRCUITPY_AUTORELOAD_DELAY_MS.
+void autoreload_trigger_complete(void);
 // True when the autoreload should occur. (A trigger happened and the delay has
 // passed.)
 bool autoreload_ready(void);
+// Milliseconds until autoreload_ready() could become true, or UINT32_MAX when no reload is
+// waiting.
+uint32_t autoreload_ms_until_ready(void);
 // Reset the autoreload timer in preparation for another trigger. Call when the
 // last trigger starts being executed.
 void autoreload_reset(void);
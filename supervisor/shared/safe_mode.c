@@ -11,6 +11,7 @@
 #include "shared-bindings/microcontroller/Processor.h"
 #include "shared-bindings/microcontroller/ResetReason.h"
 
+#include "supervisor/background_callback.h"
 #include "supervisor/linker.h"
 #include "supervisor/shared/rgb_led_colors.h"
 #include "supervisor/shared/serial.h"
@@ -106,6 +107,7 @@ void __attribute__((noinline, )) PLACE_IN_ITCM(reset_into_safe_mode)(safe_mode_t
     }
 
     safe_mode_on_next_reset(reason);
+    serial_flush_output();
     reset_cpu();
 }
 
@@ -203,4 +205,8 @@ void print_safe_mode_message(safe_mode_t reason) {
 
     // Always tell user how to get out of safe mode.
     serial_write_compressed(MP_ERROR_TEXT("\nPress reset to exit safe mode.\n"));
+
+    #if CIRCUITPY_BACKGROUND_CALLBACK_STATS
+    background_callback_print_stats();
+    #endif
 }
@@ -11,8 +11,10 @@
 #include "py/mphal.h"
 #include "py/mpprint.h"
 
+#include "supervisor/background_callback.h"
 #include "supervisor/shared/cpu.h"
 #include "supervisor/shared/display.h"
+#include "supervisor/shared/tick.h"
 #include "shared-bindings/terminalio/Terminal.h"
 #include "supervisor/shared/serial.h"
 #include "shared-bindings/microcontroller/Pin.h"
@@ -145,6 +147,8 @@ static size_t console_uart_write(const char *str, size_t len) {
 
 static void console_uart_write_cb(void *env, const char *str, size_t len) {
     (void)env;
+    // Keep debug output in order with console output that hasn't been sent yet.
+    serial_flush_output();
     console_uart_write(str, len);
 }
 
@@ -377,28 +381,11 @@ uint32_t serial_bytes_available(void) {
     return count;
 }
 
-uint32_t serial_write_substring(const char *text, uint32_t length) {
-    if (length == 0) {
-        return 0;
-    }
-
-    // See https://github.com/micropython/micropython/pull/11850 for the motivation for returning
-    // the number of chars written.
-
-    // Assume that unless otherwise reported, we sent all that we got.
+// Sends console output to the consoles that take it in batches. Returns how much of it the console
+// UART took, when there is one.
+static uint32_t console_sinks_write(const char *text, uint32_t length) {
     uint32_t length_sent = length;
 
-    #if CIRCUITPY_TERMINALIO
-    int errcode;
-    if (!_serial_display_write_disabled) {
-        length_sent = common_hal_terminalio_terminal_write(&supervisor_terminal, (const uint8_t *)text, length, &errcode);
-    }
-    #endif
-
-    if (_serial_console_write_disabled) {
-        return length_sent;
-    }
-
     #if CIRCUITPY_USB_DEVICE && CIRCUITPY_USB_VENDOR
     if (tud_vendor_connected()) {
         length_sent = tud_vendor_write(text, length);
@@ -413,13 +400,9 @@ uint32_t serial_write_substring(const char *text, uint32_t length) {
     ble_serial_write(text, length);
     #endif
 
-    #if CIRCUITPY_WEB_WORKFLOW
-    websocket_write(text, length);
-    #endif
-
     #if CIRCUITPY_USB_DEVICE && CIRCUITPY_USB_CDC
     if (!usb_cdc_console_enabled()) {
-        return length;
+        return length_sent;
     }
     #endif
 
@@ -430,18 +413,119 @@ uint32_t serial_write_substring(const char *text, uint32_t length) {
         _first_write_done = true;
     }
     uint32_t count = 0;
+    #if CIRCUITPY_CONSOLE_USB_CDC_DROP_MS > 0
+    uint64_t progress_ms = supervisor_ticks_ms64();
+    #endif
     if (tud_cdc_connected()) {
         while (count < length) {
-            count += tud_cdc_write(text + count, length - count);
+            uint32_t written = tud_cdc_write(text + count, length - count);
+            count += written;
             // If we're in an interrupt, then don't wait for more room. Queue up what we can.
             if (cpu_interrupt_active()) {
                 break;
             }
+            #if CIRCUITPY_CONSOLE_USB_CDC_DROP_MS > 0
+            // Drop the rest rather than stall everything on a host that isn't reading.
+            if (written > 0) {
+                progress_ms = supervisor_ticks_ms64();
+            } else if (supervisor_ticks_ms64() - progress_ms >= CIRCUITPY_CONSOLE_USB_CDC_DROP_MS) {
+                break;
+            }
+            #endif
             usb_background();
         }
     }
     #endif
 
+    return length_sent;
+}
+
+#if CIRCUITPY_CONSOLE_BUFFER_SIZE > 0
+// Output for the batched consoles collects here. It is sent at each newline, when the buffer is
+// full, and from a background callback for a partial line such as a prompt. Each write otherwise
+// pays for a USB transfer, a BLE packet and a console UART timestamp of its own, and print()
+// writes in many small pieces.
+static char _console_buffer[CIRCUITPY_CONSOLE_BUFFER_SIZE];
+static size_t _console_buffer_len;
+static bool _console_buffer_sending;
+static background_callback_t _console_buffer_callback;
+
+static void console_buffer_send(void) {
+    // A console may run background tasks while it waits, and they may write and send too.
+    if (_console_buffer_len == 0 || _console_buffer_sending || cpu_interrupt_active()) {
+        return;
+    }
+    _console_buffer_sending = true;
+    console_sinks_write(_console_buffer, _console_buffer_len);
+    _console_buffer_len = 0;
+    _console_buffer_sending = false;
+}
+
+static void console_buffer_send_cb(void *data) {
+    (void)data;
+    console_buffer_send();
+}
+#endif
+
+void serial_flush_output(void) {
+    #if CIRCUITPY_CONSOLE_BUFFER_SIZE > 0
+    console_buffer_send();
+    #endif
+}
+
+uint32_t serial_write_substring(const char *text, uint32_t length) {
+    if (length == 0) {
+        return 0;
+    }
+
+    // See https://github.com/micropython/micropython/pull/11850 for the motivation for returning
+    // the number of chars written.
+
+    // Assume that unless otherwise reported, we sent all that we got.
+    uint32_t length_sent = length;
+
+    #if CIRCUITPY_TERMINALIO
+    int errcode;
+    if (!_serial_display_write_disabled) {
+        length_sent = common_hal_terminalio_terminal_write(&supervisor_terminal, (const uint8_t *)text, length, &errcode);
+    }
+    #endif
+
+    if (_serial_console_write_disabled) {
+        return length_sent;
+    }
+
+    #if CIRCUITPY_CONSOLE_BUFFER_SIZE > 0
+    // Interrupts can't wait for the buffer, and neither can anything that won't fit in it.
+    if (cpu_interrupt_active() || _console_buffer_sending || length > CIRCUITPY_CONSOLE_BUFFER_SIZE) {
+        console_buffer_send();
+        length_sent = console_sinks_write(text, length);
+    } else {
+        if (_console_buffer_len + length > CIRCUITPY_CONSOLE_BUFFER_SIZE) {
+            console_buffer_send();
+        }
+        memcpy(_console_buffer + _console_buffer_len, text, length);
+        _console_buffer_len += length;
+        if (memchr(text, '\n', length) != NULL) {
+            console_buffer_send();
+        } else {
+            background_callback_add(&_console_buffer_callback, console_buffer_send_cb, NULL);
+        }
+    }
+    #else
+    length_sent = console_sinks_write(text, length);
+    #endif
+
+    #if CIRCUITPY_WEB_WORKFLOW
+    websocket_write(text, length);
+    #endif
+
+    #if CIRCUITPY_USB_DEVICE && CIRCUITPY_USB_CDC
+    if (!usb_cdc_console_enabled()) {
+        return length;
+    }
+    #endif
+
     board_serial_write_substring(text, length);
 
     #if CIRCUITPY_PORT_SERIAL
@@ -29,6 +29,10 @@
 
 #include "shared-bindings/microcontroller/__init__.h"
 
+#if MICROPY_PY_MICROPYTHON_PROFILE
+#include "py/profile.h"
+#endif
+
 #if CIRCUITPY_WATCHDOG
 #include "shared-bindings/watchdog/__init__.h"
 #define WATCHDOG_EXCEPTION_CHECK() (MP_STATE_VM(mp_pending_exception) == &mp_watchdog_timeout_exception)
@@ -44,6 +48,9 @@ static volatile uint64_t last_finished_tick = 0;
 
 static volatile size_t tick_enable_count = 0;
 
+// How many of tick_enable_count only need the tick by the time they report.
+static volatile size_t tickless_enable_count = 0;
+
 static void supervisor_background_tick(void *unused) {
     port_start_background_tick();
 
@@ -73,6 +80,10 @@ bool supervisor_background_ticks_ok(void) {
 }
 
 void supervisor_tick(void) {
+    #if MICROPY_PY_MICROPYTHON_PROFILE
+    mp_prof_sample();
+    #endif
+
     #if CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS > 0
     filesystem_tick();
     #endif
@@ -113,9 +124,8 @@ void mp_hal_delay_ms(mp_uint_t delay_ms) {
         if (remaining < 1) {
             break;
         }
-        port_interrupt_after_ticks(remaining);
         // Idle until an interrupt happens.
-        port_idle_until_interrupt();
+        supervisor_idle_until_interrupt(remaining);
         remaining = end_tick - port_get_raw_ticks(NULL);
     }
 }
@@ -139,3 +149,99 @@ void supervisor_disable_tick(void) {
     }
     common_hal_mcu_enable_interrupts();
 }
+
+void supervisor_enable_tickless(void) {
+    common_hal_mcu_disable_interrupts();
+    tickless_enable_count++;
+    common_hal_mcu_enable_interrupts();
+    supervisor_enable_tick();
+}
+
+void supervisor_disable_tickless(void) {
+    common_hal_mcu_disable_interrupts();
+    if (tickless_enable_count > 0) {
+        tickless_enable_count--;
+    }
+    common_hal_mcu_enable_interrupts();
+    supervisor_disable_tick();
+}
+
+#if CIRCUITPY_TICKLESS_IDLE
+// Ticks until one of the tickless users needs supervisor_tick to run, or UINT32_MAX when none
+// of them does until an interrupt.
+static uint32_t ticks_until_needed(void) {
+    uint32_t ticks = UINT32_MAX;
+    #if CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS > 0
+    ticks = MIN(ticks, filesystem_ticks_until_flush());
+    #endif
+    #if CIRCUITPY_KEYPAD
+    ticks = MIN(ticks, keypad_ticks_until_scan());
+    #endif
+    #if CIRCUITPY_DISPLAYIO
+    ticks = MIN(ticks, displayio_ticks_until_background());
+    #endif
+    return ticks;
+}
+#endif
+
+void supervisor_idle_until_interrupt(uint32_t ticks) {
+    #if CIRCUITPY_TICKLESS_IDLE
+    // Stop the tick while idle when everyone using it can say when they next need it, and wake
+    // up for the earliest of them instead of every tick.
+    if (tick_enable_count > 0 && tick_enable_count == tickless_enable_count) {
+        uint32_t needed = ticks_until_needed();
+        // Sleeping for one tick or less saves nothing.
+        if (needed > 1) {
+            if (ticks == 0 || needed < ticks) {
+                ticks = needed;
+            }
+            common_hal_mcu_disable_interrupts();
+            port_disable_tick();
+            common_hal_mcu_enable_interrupts();
+            uint64_t start = port_get_raw_ticks(NULL);
+            if (ticks != UINT32_MAX) {
+                port_interrupt_after_ticks(ticks);
+            }
+            port_idle_until_interrupt();
+            uint32_t elapsed = port_get_raw_ticks(NULL) - start;
+            common_hal_mcu_disable_interrupts();
+            if (tick_enable_count > 0) {
+                port_enable_tick();
+            }
+            common_hal_mcu_enable_interrupts();
+            // Catch up on the ticks that were skipped.
+            #if CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS > 0
+            filesystem_ticks_passed(elapsed);
+            #else
+            (void)elapsed;
+            #endif
+            supervisor_tick();
+            return;
+        }
+    }
+    #endif
+    if (ticks != 0) {
+        port_interrupt_after_ticks(ticks);
+    }
+    port_idle_until_interrupt();
+}
+
+void supervisor_event_wait_ms(uint32_t timeout_ms) {
+    if (timeout_ms == 0 || mp_hal_is_interrupted()) {
+        return;
+    }
+    timeout_ms = MIN(timeout_ms, CIRCUITPY_EVENT_WAIT_MAX_MS);
+    // Round up so that a wait for the last millisecond doesn't spin.
+    supervisor_idle_until_interrupt((timeout_ms * 1024 + 999) / 1000);
+}
+
+#if MICROPY_PY_MICROPYTHON_PROFILE
+// The profiler samples from supervisor_tick(), which only runs while enabled.
+void mp_prof_sample_timer(bool enable) {
+    if (enable) {
+        supervisor_enable_tick();
+    } else {
+        supervisor_disable_tick();
+    }
+}
+#endif
@@ -36,6 +36,28 @@ extern uint64_t supervisor_ticks_ms64(void);
 extern void supervisor_enable_tick(void);
 extern void supervisor_disable_tick(void);
 
+/** @brief Like supervisor_enable_tick, for users that don't need every tick
+ *
+ * Their next deadline must be reported by ticks_until_needed() in tick.c. While only
+ * these users have the tick enabled, supervisor_idle_until_interrupt stops it and wakes
+ * up at the earliest deadline instead.
+ */
+extern void supervisor_enable_tickless(void);
+extern void supervisor_disable_tickless(void);
+
+/** @brief Idle until an interrupt, or until ticks have passed when it isn't zero
+ *
+ * With CIRCUITPY_TICKLESS_IDLE, the tick is stopped while idle when it isn't needed before then.
+ */
+extern void supervisor_idle_until_interrupt(uint32_t ticks);
+
+/** @brief Idle until an interrupt or until timeout_ms have passed, for up to CIRCUITPY_EVENT_WAIT_MAX_MS
+ *
+ * This is MICROPY_INTERNAL_WFE, which select.poll() and so asyncio wait with. A timeout_ms of
+ * UINT32_MAX waits as long as it may.
+ */
+extern void supervisor_event_wait_ms(uint32_t timeout_ms);
+
 /**
  * @brief Return true if tick-based background tasks ran within the last 1s
  *
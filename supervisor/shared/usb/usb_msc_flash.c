@@ -16,6 +16,7 @@
 #include "py/mpstate.h"
 
 #include "shared-module/storage/__init__.h"
+#include "supervisor/background_callback.h"
 #include "supervisor/filesystem.h"
 #include "supervisor/shared/reload.h"
 
@@ -45,6 +46,108 @@ static bool ejected[LUN_COUNT] = { [0 ... (LUN_COUNT - 1)] = true};
 static bool eject_once[LUN_COUNT] = { [0 ... (LUN_COUNT - 1)] = false};
 static bool locked[LUN_COUNT] = { [0 ... (LUN_COUNT - 1)] = false};
 
+#if CIRCUITPY_USB_MSC_WRITE_QUEUE_LENGTH > 0
+// Writes from the host are copied here and written to the filesystem from a background
+// callback, so that the next transfer arrives while the last one is programmed.
+typedef struct {
+    fs_user_mount_t *vfs;
+    uint32_t lba;
+    uint32_t block_count;
+} queued_write_t;
+
+static queued_write_t write_queue[CIRCUITPY_USB_MSC_WRITE_QUEUE_LENGTH];
+static uint32_t write_queue_data[CIRCUITPY_USB_MSC_WRITE_QUEUE_LENGTH][CFG_TUD_MSC_BUFSIZE / sizeof(uint32_t)];
+static size_t write_queue_head;
+static size_t write_queue_count;
+static background_callback_t write_queue_callback;
+
+static void write_queue_pop(void) {
+    queued_write_t *write = &write_queue[write_queue_head];
+    disk_write(write->vfs, (uint8_t *)write_queue_data[write_queue_head], write->lba, write->block_count);
+    write_queue_head = (write_queue_head + 1) % CIRCUITPY_USB_MSC_WRITE_QUEUE_LENGTH;
+    write_queue_count--;
+}
+
+static void write_queue_background(void *unused) {
+    (void)unused;
+    // One write at a time so that USB is serviced in between.
+    if (write_queue_count > 0) {
+        write_queue_pop();
+    }
+    if (write_queue_count > 0) {
+        background_callback_add(&write_queue_callback, write_queue_background, NULL);
+    }
+}
+
+static void write_queue_push(fs_user_mount_t *vfs, uint8_t *buffer, uint32_t lba, uint32_t block_count) {
+    // Returning 0 to TinyUSB would make it retry at once without running background tasks,
+    // so when the queue is full the host waits for the oldest write instead.
+    if (write_queue_count == CIRCUITPY_USB_MSC_WRITE_QUEUE_LENGTH) {
+        write_queue_pop();
+    }
+    size_t tail = (write_queue_head + write_queue_count) % CIRCUITPY_USB_MSC_WRITE_QUEUE_LENGTH;
+    write_queue[tail].vfs = vfs;
+    write_queue[tail].lba = lba;
+    write_queue[tail].block_count = block_count;
+    memcpy(write_queue_data[tail], buffer, block_count * MSC_FLASH_BLOCK_SIZE);
+    write_queue_count++;
+    background_callback_add(&write_queue_callback, write_queue_background, NULL);
+}
+#endif
+
+// The number of blocks on each disk, so that it isn't asked for on every read.
+static fs_user_mount_t *block_count_vfs[LUN_COUNT];
+static uint32_t block_count_cache[LUN_COUNT];
+
+static uint32_t get_block_count(uint8_t lun, fs_user_mount_t *vfs) {
+    if (block_count_vfs[lun] != vfs) {
+        disk_ioctl(vfs, GET_SECTOR_COUNT, &block_count_cache[lun]);
+        block_count_vfs[lun] = vfs;
+    }
+    return block_count_cache[lun];
+}
+
+static void forget_block_counts(void) {
+    for (uint8_t i = 0; i < LUN_COUNT; i++) {
+        block_count_vfs[i] = NULL;
+    }
+}
+
+#if CIRCUITPY_USB_MSC_READ_AHEAD
+// Once the host reads two chunks in a row, the chunk after them is read from a background
+// callback while the last one is sent.
+static uint32_t read_ahead_data[CFG_TUD_MSC_BUFSIZE / sizeof(uint32_t)];
+static fs_user_mount_t *read_ahead_vfs;
+static uint32_t read_ahead_lba;
+static uint32_t read_ahead_block_count;
+static bool read_ahead_ready;
+static uint32_t next_read_lba;
+static background_callback_t read_ahead_callback;
+
+static void read_ahead_background(void *unused) {
+    (void)unused;
+    if (read_ahead_vfs != NULL && !read_ahead_ready) {
+        read_ahead_ready = disk_read(read_ahead_vfs, (uint8_t *)read_ahead_data, read_ahead_lba, read_ahead_block_count) == RES_OK;
+    }
+}
+#endif
+
+static void read_ahead_cancel(void) {
+    #if CIRCUITPY_USB_MSC_READ_AHEAD
+    read_ahead_vfs = NULL;
+    read_ahead_ready = false;
+    #endif
+}
+
+// Finishes any writes still queued so that the disks are up to date.
+static void write_queue_drain(void) {
+    #if CIRCUITPY_USB_MSC_WRITE_QUEUE_LENGTH > 0
+    while (write_queue_count > 0) {
+        write_queue_pop();
+    }
+    #endif
+}
+
 #include "tusb.h"
 
 static const uint8_t usb_msc_descriptor_template[] = {
@@ -154,6 +257,8 @@ static fs_user_mount_t *get_vfs(int lun) {
 }
 
 static void _usb_msc_uneject(void) {
+    forget_block_counts();
+    read_ahead_cancel();
     for (uint8_t i = 0; i < LUN_COUNT; i++) {
         ejected[i] = false;
         locked[i] = false;
@@ -165,6 +270,9 @@ void usb_msc_mount(void) {
 }
 
 void usb_msc_umount(void) {
+    write_queue_drain();
+    forget_block_counts();
+    read_ahead_cancel();
     for (uint8_t i = 0; i < LUN_COUNT; i++) {
         fs_user_mount_t *vfs = get_vfs(i);
         if (vfs == NULL) {
@@ -184,12 +292,50 @@ void usb_msc_remount(fs_user_mount_t *fs_mount) {
         ejected[i] = false;
         eject_once[i] = true;
     }
+    forget_block_counts();
+    read_ahead_cancel();
 }
 
 uint8_t tud_msc_get_maxlun_cb(void) {
     return LUN_COUNT;
 }
 
+#define SCSI_CMD_UNMAP (0x42)
+
+// The host no longer needs the blocks in each descriptor of the parameter list, so they are
+// trimmed like clusters freed by FatFS.
+static int32_t unmap_blocks(uint8_t lun, const uint8_t *params, uint16_t bufsize) {
+    fs_user_mount_t *vfs = get_vfs(lun);
+    if (vfs == NULL || !locked[lun]) {
+        // Set 0x27 for write protected.
+        tud_msc_set_sense(lun, SCSI_SENSE_DATA_PROTECT, 0x27, 0x00);
+        return -1;
+    }
+    write_queue_drain();
+    read_ahead_cancel();
+
+    uint32_t disk_block_count = get_block_count(lun, vfs);
+    uint32_t params_length = bufsize < 8 ? bufsize : MIN(bufsize, 8u + ((params[2] << 8) | params[3]));
+    for (uint32_t i = 8; i + 16 <= params_length; i += 16) {
+        const uint8_t *descriptor = params + i;
+        // Only 32 bit block addresses are used, as for READ10 and WRITE10.
+        uint32_t lba_high = (descriptor[0] << 24) | (descriptor[1] << 16) | (descriptor[2] << 8) | descriptor[3];
+        uint32_t lba = (descriptor[4] << 24) | (descriptor[5] << 16) | (descriptor[6] << 8) | descriptor[7];
+        uint32_t count = (descriptor[8] << 24) | (descriptor[9] << 16) | (descriptor[10] << 8) | descriptor[11];
+        if (count == 0) {
+            continue;
+        }
+        if (lba_high != 0 || lba >= disk_block_count || count > disk_block_count - lba) {
+            // Set 0x21 for logical block address out of range.
+            tud_msc_set_sense(lun, SCSI_SENSE_ILLEGAL_REQUEST, 0x21, 0x00);
+            return -1;
+        }
+        DWORD range[2] = { lba, lba + count - 1 };
+        disk_ioctl(vfs, CTRL_TRIM, range);
+    }
+    return bufsize;
+}
+
 // Callback invoked when received an SCSI command not in built-in list below
 // - READ_CAPACITY10, READ_FORMAT_CAPACITY, INQUIRY, TEST_UNIT_READY, START_STOP_UNIT, MODE_SENSE6, REQUEST_SENSE
 // - READ10 and WRITE10 have their own callbacks
@@ -203,6 +349,10 @@ int32_t tud_msc_scsi_cb(uint8_t lun, const uint8_t scsi_cmd[16], void *buffer, u
             resplen = 0;
             break;
 
+        case SCSI_CMD_UNMAP:
+            resplen = unmap_blocks(lun, buffer, bufsize);
+            break;
+
         default:
             // Set Sense = Invalid Command Operation
             tud_msc_set_sense(lun, SCSI_SENSE_ILLEGAL_REQUEST, 0x20, 0x00);
@@ -227,7 +377,9 @@ int32_t tud_msc_scsi_cb(uint8_t lun, const uint8_t scsi_cmd[16], void *buffer, u
 
 void tud_msc_capacity_cb(uint8_t lun, uint32_t *block_count, uint16_t *block_size) {
     fs_user_mount_t *vfs = get_vfs(lun);
-    disk_ioctl(vfs, GET_SECTOR_COUNT, block_count);
+    // Always asked for again, since the host does this when it finds new media.
+    block_count_vfs[lun] = NULL;
+    *block_count = get_block_count(lun, vfs);
     disk_ioctl(vfs, GET_SECTOR_SIZE, block_size);
 }
 
@@ -259,14 +411,32 @@ int32_t tud_msc_read10_cb(uint8_t lun, uint32_t lba, uint32_t offset, void *buff
     const uint32_t block_count = bufsize / MSC_FLASH_BLOCK_SIZE;
 
     fs_user_mount_t *vfs = get_vfs(lun);
-    uint32_t disk_block_count;
-    disk_ioctl(vfs, GET_SECTOR_COUNT, &disk_block_count);
+    uint32_t disk_block_count = get_block_count(lun, vfs);
 
     if (lba + block_count > disk_block_count) {
         return -1;
     }
 
+    write_queue_drain();
+    #if CIRCUITPY_USB_MSC_READ_AHEAD
+    if (read_ahead_ready && read_ahead_vfs == vfs && read_ahead_lba == lba && block_count <= read_ahead_block_count) {
+        memcpy(buffer, read_ahead_data, block_count * MSC_FLASH_BLOCK_SIZE);
+    } else {
+        disk_read(vfs, buffer, lba, block_count);
+    }
+    read_ahead_cancel();
+    // The read ahead is only safe while USB has the disk locked, since nothing else can change
+    // it then.
+    if (lba == next_read_lba && locked[lun] && lba + block_count < disk_block_count) {
+        read_ahead_vfs = vfs;
+        read_ahead_lba = lba + block_count;
+        read_ahead_block_count = MIN(block_count, disk_block_count - read_ahead_lba);
+        background_callback_add(&read_ahead_callback, read_ahead_background, NULL);
+    }
+    next_read_lba = lba + block_count;
+    #else
     disk_read(vfs, buffer, lba, block_count);
+    #endif
 
     return block_count * MSC_FLASH_BLOCK_SIZE;
 }
@@ -281,7 +451,12 @@ int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t *
     const uint32_t block_count = bufsize / MSC_FLASH_BLOCK_SIZE;
 
     fs_user_mount_t *vfs = get_vfs(lun);
+    read_ahead_cancel();
+    #if CIRCUITPY_USB_MSC_WRITE_QUEUE_LENGTH > 0
+    write_queue_push(vfs, buffer, lba, block_count);
+    #else
     disk_write(vfs, buffer, lba, block_count);
+    #endif
     // Since by getting here we assume the mount is read-only to
     // MicroPython let's update the cached FatFs sector if it's the one
     // we just wrote.
@@ -306,6 +481,17 @@ int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t *
 void tud_msc_write10_complete_cb(uint8_t lun) {
     (void)lun;
 
+    // The status has gone to the host, so the rest of the command can be written now.
+    write_queue_drain();
+    #if CIRCUITPY_SDCARDIO && CIRCUITPY_SDCARDIO_CACHE_BLOCKS
+    // The card holds single block writes back until it is synced, and the host may not tell it to.
+    if (lun == SDCARD_LUN) {
+        fs_user_mount_t *vfs = get_vfs(lun);
+        if (vfs != NULL) {
+            disk_ioctl(vfs, CTRL_SYNC, NULL);
+        }
+    }
+    #endif
     // This write is complete; initiate an autoreload.
     autoreload_resume(AUTORELOAD_SUSPEND_USB);
     autoreload_trigger();
@@ -331,6 +517,9 @@ bool tud_msc_test_unit_ready_cb(uint8_t lun) {
     #if CIRCUITPY_SDCARDIO
     if (lun == SDCARD_LUN) {
         automount_sd_card();
+        // A new card may be mounted where the last one was.
+        block_count_vfs[lun] = NULL;
+        read_ahead_cancel();
     }
     #endif
 
@@ -362,6 +551,8 @@ bool tud_msc_start_stop_cb(uint8_t lun, uint8_t power_condition, bool start, boo
     if (load_eject) {
         if (!start) {
             // Eject but first flush.
+            write_queue_drain();
+            read_ahead_cancel();
             if (disk_ioctl(current_mount, CTRL_SYNC, NULL) != RES_OK) {
                 return false;
             } else {
@@ -376,6 +567,7 @@ bool tud_msc_start_stop_cb(uint8_t lun, uint8_t power_condition, bool start, boo
     } else {
         if (!start) {
             // Stop the unit but don't eject.
+            write_queue_drain();
             if (disk_ioctl(current_mount, CTRL_SYNC, NULL) != RES_OK) {
                 return false;
             }
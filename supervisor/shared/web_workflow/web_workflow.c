@@ -68,6 +68,7 @@ typedef struct {
     char header_value[256];
     char origin[64];        // We store the origin so we can reply back with it.
     char host[64];          // We store the host to check against origin.
+    char if_none_match[12]; // ETag the client has cached, which fits those of the static files.
     size_t content_length;
     size_t offset;
     uint64_t timestamp_ms;
@@ -79,6 +80,14 @@ typedef struct {
     bool json;
     bool websocket;
     bool new_socket;
+    // False once the client sends "Connection: close".
+    bool keep_alive;
+    // A single byte range from the Range header. range_end is inclusive, or the number of bytes at
+    // the end of the file when range_suffix is set.
+    bool range;
+    bool range_suffix;
+    uint32_t range_start;
+    uint32_t range_end;
     uint32_t websocket_version;
     // RFC6455 for websockets says this header should be 24 base64 characters long.
     char websocket_key[24 + 1];
@@ -101,9 +110,20 @@ static mp_int_t web_api_port = 80;
 
 static socketpool_socketpool_obj_t pool;
 static socketpool_socket_obj_t listening;
-static socketpool_socket_obj_t active;
 
-static _request active_request;
+// Each connection parses its own request, so one waiting on the network doesn't hold up the others.
+// A connection stays open between requests until its slot is needed for a new one.
+typedef struct {
+    socketpool_socket_obj_t socket;
+    _request request;
+} _connection;
+
+static _connection connections[CIRCUITPY_WEB_WORKFLOW_CONNECTIONS];
+// New clients are accepted here first, so that an idle connection is only closed for a real one.
+static socketpool_socket_obj_t accepting;
+
+// Set when a finished request should cause a reload once no other request is in progress.
+static bool _reload_when_idle = false;
 
 static char _api_password[64];
 static char web_instance_name[50];
@@ -310,7 +330,10 @@ bool supervisor_start_web_workflow(void) {
         common_hal_socketpool_socketpool_construct(&pool, &common_hal_wifi_radio_obj);
 
         socketpool_socket_reset(&listening);
-        socketpool_socket_reset(&active);
+        socketpool_socket_reset(&accepting);
+        for (size_t i = 0; i < MP_ARRAY_SIZE(connections); i++) {
+            socketpool_socket_reset(&connections[i].socket);
+        }
 
         websocket_init();
     }
@@ -318,8 +341,10 @@ bool supervisor_start_web_workflow(void) {
     initialized = pool.base.type == &socketpool_socketpool_type;
 
     if (initialized) {
-        if (!common_hal_socketpool_socket_get_closed(&active)) {
-            common_hal_socketpool_socket_close(&active);
+        for (size_t i = 0; i < MP_ARRAY_SIZE(connections); i++) {
+            if (!common_hal_socketpool_socket_get_closed(&connections[i].socket)) {
+                common_hal_socketpool_socket_close(&connections[i].socket);
+            }
         }
 
         #if CIRCUITPY_MDNS
@@ -346,7 +371,7 @@ bool supervisor_start_web_workflow(void) {
             common_hal_socketpool_socket_settimeout(&listening, 0);
             // Bind to any ip. (Not checking for failures)
             common_hal_socketpool_socket_bind(&listening, "", 0, web_api_port);
-            common_hal_socketpool_socket_listen(&listening, 1);
+            common_hal_socketpool_socket_listen(&listening, CIRCUITPY_WEB_WORKFLOW_CONNECTIONS);
         }
         // Wake polling thread (maybe)
         socketpool_socket_poll_resume();
@@ -736,12 +761,50 @@ static void _reply_directory_json(socketpool_socket_obj_t *socket, _request *req
     _send_chunk(socket, "");
 }
 
+static void _reply_range_not_satisfiable(socketpool_socket_obj_t *socket, _request *request, uint32_t total_length) {
+    _send_str(socket, "HTTP/1.1 416 Range Not Satisfiable\r\n");
+    mp_print_t _socket_print = {socket, _print_raw};
+    mp_printf(&_socket_print, "Content-Range: bytes */%u\r\n", total_length);
+    _send_str(socket, "Content-Length: 0\r\n");
+    _cors_header(socket, request);
+    _send_final_str(socket, "\r\n");
+}
+
+#if CIRCUITPY_WEB_WORKFLOW_FILE_BUFFER_SIZE > 0
+static uint8_t _file_buffer[CIRCUITPY_WEB_WORKFLOW_FILE_BUFFER_SIZE];
+#endif
+
 static void _reply_with_file(socketpool_socket_obj_t *socket, _request *request, const char *filename, FIL *active_file) {
     uint32_t total_length = f_size(active_file);
+    uint32_t start = 0;
+    uint32_t length = total_length;
+    if (request->range) {
+        if (request->range_suffix) {
+            if (request->range_end == 0) {
+                _reply_range_not_satisfiable(socket, request, total_length);
+                return;
+            }
+            start = total_length - MIN(request->range_end, total_length);
+        } else {
+            if (request->range_start >= total_length) {
+                _reply_range_not_satisfiable(socket, request, total_length);
+                return;
+            }
+            start = request->range_start;
+        }
+        uint32_t end = request->range_suffix ? total_length - 1 : MIN(request->range_end, total_length - 1);
+        length = end - start + 1;
+    }
 
-    _send_str(socket, "HTTP/1.1 200 OK\r\n");
     mp_print_t _socket_print = {socket, _print_raw};
-    mp_printf(&_socket_print, "Content-Length: %d\r\n", total_length);
+    if (request->range) {
+        _send_str(socket, "HTTP/1.1 206 Partial Content\r\n");
+        mp_printf(&_socket_print, "Content-Range: bytes %u-%u/%u\r\n", start, start + length - 1, total_length);
+    } else {
+        _send_str(socket, "HTTP/1.1 200 OK\r\n");
+    }
+    mp_printf(&_socket_print, "Content-Length: %d\r\n", length);
+    _send_str(socket, "Accept-Ranges: bytes\r\n");
     // TODO: Make this a table to save space.
     if (_endswith(filename, ".txt") || _endswith(filename, ".py") || _endswith(filename, ".toml")) {
         _send_strs(socket, "Content-Type:", "text/plain", ";charset=UTF-8\r\n", NULL);
@@ -757,42 +820,44 @@ static void _reply_with_file(socketpool_socket_obj_t *socket, _request *request,
     _cors_header(socket, request);
     _send_str(socket, "\r\n");
 
-    uint32_t total_read = 0;
-    int nodelay_ok = -1;
-    while (total_read < total_length) {
-        uint8_t data_buffer[64];
-        size_t quantity_read;
-        f_read(active_file, data_buffer, 64, &quantity_read);
-        total_read += quantity_read;
-        // When getting near the end of the file, disable Nagle's combining algorithm so that
-        // data is sent immediately.
-        if (total_length - total_read < 64) {
-            int nodelay = 1;
-            // Returns 0 when it works.
-            nodelay_ok = common_hal_socketpool_socket_setsockopt(socket, SOCKETPOOL_IPPROTO_TCP, SOCKETPOOL_TCP_NODELAY, &nodelay, sizeof(nodelay));
+    uint32_t total_sent = 0;
+    #if MICROPY_VFS_FAT_FILE_DATA
+    // A file in one piece on memory-mapped flash is sent from where it is.
+    const uint8_t *mapped = mp_vfs_fat_file_data(active_file);
+    if (mapped != NULL) {
+        web_workflow_send_raw(socket, true, mapped + start, length);
+        if (common_hal_socketpool_socket_get_connected(socket)) {
+            total_sent = length;
         }
-        uint32_t send_offset = 0;
-        while (send_offset < quantity_read) {
-            int sent = socketpool_socket_send(socket, data_buffer + send_offset, quantity_read - send_offset);
-            if (sent < 0) {
-                if (sent == -MP_EAGAIN) {
-                    sent = 0;
-                } else {
-                    break;
-                }
+    }
+    #else
+    const uint8_t *mapped = NULL;
+    #endif
+
+    if (mapped == NULL) {
+        #if CIRCUITPY_WEB_WORKFLOW_FILE_BUFFER_SIZE > 0
+        uint8_t *data_buffer = _file_buffer;
+        const size_t buffer_size = sizeof(_file_buffer);
+        #else
+        uint8_t data_buffer[64];
+        const size_t buffer_size = sizeof(data_buffer);
+        #endif
+        f_lseek(active_file, start);
+        while (total_sent < length && common_hal_socketpool_socket_get_connected(socket)) {
+            // Whole sectors are read by FatFS straight into the buffer, so keep reads aligned to them.
+            size_t to_read = MIN(buffer_size - (f_tell(active_file) % FF_MIN_SS) % buffer_size, length - total_sent);
+            size_t quantity_read;
+            if (f_read(active_file, data_buffer, to_read, &quantity_read) != FR_OK || quantity_read == 0) {
+                break;
             }
-            send_offset += sent;
+            total_sent += quantity_read;
+            // Send the end of the file immediately instead of waiting to combine it with more.
+            web_workflow_send_raw(socket, total_sent == length, data_buffer, quantity_read);
         }
     }
-    if (total_read < total_length) {
+    if (total_sent < length) {
         socketpool_socket_close(socket);
     }
-
-    // Re-enable Nagle's algorithm when done sending.
-    if (nodelay_ok == 0) {
-        int nodelay = 0;
-        nodelay_ok = common_hal_socketpool_socket_setsockopt(socket, SOCKETPOOL_IPPROTO_TCP, SOCKETPOOL_TCP_NODELAY, &nodelay, sizeof(nodelay));
-    }
 }
 
 static void _reply_with_devices_json(socketpool_socket_obj_t *socket, _request *request) {
@@ -946,8 +1011,10 @@ static void _discard_incoming(socketpool_socket_obj_t *socket, size_t amount) {
         uint8_t bytes[64];
         size_t read_len = MIN(sizeof(bytes), amount - discarded);
         int len = socketpool_socket_recv_into(socket, bytes, read_len);
-        if (len < 0) {
+        if (len <= 0) {
             if (len == -MP_EAGAIN) {
+                // Yield so that network code can run.
+                port_yield();
                 continue;
             }
             break;
@@ -1025,26 +1092,44 @@ static void _write_file_and_reply(socketpool_socket_obj_t *socket, _request *req
     f_truncate(&active_file);
     f_rewind(&active_file);
 
+    #if CIRCUITPY_WEB_WORKFLOW_FILE_BUFFER_SIZE > 0
+    uint8_t *data_buffer = _file_buffer;
+    const size_t buffer_size = sizeof(_file_buffer);
+    #else
+    uint8_t data_buffer[64];
+    const size_t buffer_size = sizeof(data_buffer);
+    #endif
     size_t total_read = 0;
     bool error = false;
     while (total_read < request->content_length && !error) {
-        uint8_t bytes[64];
-        size_t read_len = MIN(sizeof(bytes), request->content_length - total_read);
-        int len = socketpool_socket_recv_into(socket, bytes, read_len);
-        if (len < 0) {
-            if (len == -MP_EAGAIN) {
-                continue;
+        // Fill the whole buffer before writing it so that every write starts on a sector boundary
+        // and FatFS programs whole sectors straight from it. The network stack keeps receiving
+        // into its own buffers while the flash is written.
+        size_t to_read = MIN(buffer_size, request->content_length - total_read);
+        size_t filled = 0;
+        while (filled < to_read) {
+            int len = socketpool_socket_recv_into(socket, data_buffer + filled, to_read - filled);
+            if (len <= 0) {
+                if (len == -MP_EAGAIN) {
+                    // Yield so that network code can run.
+                    port_yield();
+                    continue;
+                }
+                error = true;
+                break;
             }
-            error = true;
+            filled += len;
+        }
+        if (error) {
             break;
         }
-        total_read += len;
         UINT actual;
-        f_write(&active_file, bytes, len, &actual);
-        if (actual < (UINT)len) {
+        f_write(&active_file, data_buffer, filled, &actual);
+        if (actual < filled) {
             error = true;
             break;
         }
+        total_read += filled;
     }
 
     f_close(&active_file);
@@ -1061,7 +1146,7 @@ static void _write_file_and_reply(socketpool_socket_obj_t *socket, _request *req
     }
 }
 
-#define STATIC_FILE(filename) extern uint32_t filename##_length; extern uint8_t filename[]; extern const char *filename##_content_type;
+#define STATIC_FILE(filename) extern uint32_t filename##_length; extern uint8_t filename[]; extern const char *filename##_content_type; extern const char *filename##_etag;
 
 STATIC_FILE(code_html);
 STATIC_FILE(directory_html);
@@ -1075,7 +1160,17 @@ STATIC_FILE(serial_html);
 STATIC_FILE(serial_js);
 STATIC_FILE(blinka_32x32_ico);
 
-static void _reply_static(socketpool_socket_obj_t *socket, _request *request, const uint8_t *response, size_t response_len, const char *content_type) {
+// Static files are stored gzipped at build time. They are sent with an ETag so the browser can
+// keep its copy until the firmware changes them, and must check each time it uses it.
+static void _reply_static(socketpool_socket_obj_t *socket, _request *request, const uint8_t *response, size_t response_len, const char *content_type, const char *etag) {
+    if (strcmp(request->if_none_match, etag) == 0) {
+        _send_strs(socket,
+            "HTTP/1.1 304 Not Modified\r\n",
+            "ETag: ", etag, "\r\n",
+            "Cache-Control: no-cache\r\n",
+            "\r\n", NULL);
+        return;
+    }
     uint32_t total_length = response_len;
     char encoded_len[10];
     snprintf(encoded_len, sizeof(encoded_len), "%" PRIu32, total_length);
@@ -1085,11 +1180,13 @@ static void _reply_static(socketpool_socket_obj_t *socket, _request *request, co
         "Content-Encoding: gzip\r\n",
         "Content-Length: ", encoded_len, "\r\n",
         "Content-Type: ", content_type, "\r\n",
+        "ETag: ", etag, "\r\n",
+        "Cache-Control: no-cache\r\n",
         "\r\n", NULL);
     web_workflow_send_raw(socket, true, response, response_len);
 }
 
-#define _REPLY_STATIC(socket, request, filename) _reply_static(socket, request, filename, filename##_length, filename##_content_type)
+#define _REPLY_STATIC(socket, request, filename) _reply_static(socket, request, filename, filename##_length, filename##_content_type, filename##_etag)
 
 static void _reply_websocket_upgrade(socketpool_socket_obj_t *socket, _request *request) {
     // Compute accept key
@@ -1388,6 +1485,7 @@ static void _reset_request(_request *request) {
     request->state = STATE_METHOD;
     request->origin[0] = '\0';
     request->host[0] = '\0';
+    request->if_none_match[0] = '\0';
     request->content_length = 0;
     request->offset = 0;
     request->timestamp_ms = 0;
@@ -1399,6 +1497,56 @@ static void _reset_request(_request *request) {
     request->expect = false;
     request->json = false;
     request->websocket = false;
+    request->keep_alive = true;
+    request->range = false;
+}
+
+// Autoreload stays suspended until every connection is between requests.
+static void _request_finished(bool reload) {
+    _reload_when_idle |= reload;
+    for (size_t i = 0; i < MP_ARRAY_SIZE(connections); i++) {
+        if (connections[i].request.in_progress) {
+            return;
+        }
+    }
+    autoreload_resume(AUTORELOAD_SUSPEND_WEB);
+    if (_reload_when_idle) {
+        _reload_when_idle = false;
+        // Every request has been received in full, so the files are complete.
+        autoreload_trigger_complete();
+    }
+}
+
+// Only a single range is used. Anything else, such as several ranges, is ignored so that the whole
+// file is sent.
+static void _parse_range(_request *request, const char *value) {
+    const char *prefix = "bytes=";
+    if (strncmp(value, prefix, strlen(prefix)) != 0 || strchr(value, ',') != NULL) {
+        return;
+    }
+    const char *p = value + strlen(prefix);
+    char *end;
+    if (*p == '-') {
+        request->range_suffix = true;
+        request->range_end = strtoul(p + 1, &end, 10);
+        request->range = end != p + 1 && *end == '\0';
+        return;
+    }
+    request->range_suffix = false;
+    request->range_start = strtoul(p, &end, 10);
+    if (end == p || *end != '-') {
+        return;
+    }
+    p = end + 1;
+    if (*p == '\0') {
+        request->range_end = UINT32_MAX;
+    } else {
+        request->range_end = strtoul(p, &end, 10);
+        if (*end != '\0' || request->range_end < request->range_start) {
+            return;
+        }
+    }
+    request->range = true;
 }
 
 static void _process_request(socketpool_socket_obj_t *socket, _request *request) {
@@ -1415,6 +1563,7 @@ static void _process_request(socketpool_socket_obj_t *socket, _request *request)
                 // Disconnect - clear 'in-progress'
                 _reset_request(request);
                 common_hal_socketpool_socket_close(socket);
+                _request_finished(false);
             }
             break;
         }
@@ -1518,6 +1667,13 @@ static void _process_request(socketpool_socket_obj_t *socket, _request *request)
                         strcpy(request->websocket_key, request->header_value);
                     } else if (strcasecmp(request->header_key, "X-Destination") == 0) {
                         strcpy(request->destination, request->header_value);
+                    } else if (strcasecmp(request->header_key, "Range") == 0) {
+                        _parse_range(request, request->header_value);
+                    } else if (strcasecmp(request->header_key, "If-None-Match") == 0 &&
+                               strlen(request->header_value) < sizeof(request->if_none_match)) {
+                        strcpy(request->if_none_match, request->header_value);
+                    } else if (strcasecmp(request->header_key, "Connection") == 0) {
+                        request->keep_alive = strcasecmp(request->header_value, "close") != 0;
                     }
                 } else if (request->offset > sizeof(request->header_value) - 1) {
                     // Skip methods that are too long.
@@ -1545,12 +1701,15 @@ static void _process_request(socketpool_socket_obj_t *socket, _request *request)
         return;
     }
     bool reload = _reply(socket, request);
+    // Keep the connection for another request unless the client is done with it or part of a body
+    // may be left unread, as when a PUT is refused before its content is read. Redirects and errors
+    // aren't sent with a length, so they end the connection too.
+    bool keep_alive = request->keep_alive && !error && !request->redirect && request->content_length == 0;
     _reset_request(request);
-    common_hal_socketpool_socket_close(socket);
-    autoreload_resume(AUTORELOAD_SUSPEND_WEB);
-    if (reload) {
-        autoreload_trigger();
+    if (!keep_alive) {
+        common_hal_socketpool_socket_close(socket);
     }
+    _request_finished(reload);
 }
 
 static bool supervisor_filesystem_access_could_block(void) {
@@ -1574,46 +1733,66 @@ static bool supervisor_filesystem_access_could_block(void) {
     return false;
 }
 
+// A slot for a new connection: a free one, or else one idle between requests.
+static _connection *_connection_for_accept(void) {
+    _connection *idle = NULL;
+    for (size_t i = 0; i < MP_ARRAY_SIZE(connections); i++) {
+        _connection *connection = &connections[i];
+        if (!common_hal_socketpool_socket_get_connected(&connection->socket)) {
+            return connection;
+        }
+        if (idle == NULL && !connection->request.in_progress && !connection->request.new_socket) {
+            idle = connection;
+        }
+    }
+    return idle;
+}
+
 void supervisor_web_workflow_background(void *data) {
     // If "/sd" is mounted AND shared with a display, access could block.
     // We don't have a good way to defer a filesystem action way down inside _process_request
     // when this happens, so just postpone if there's a chance of blocking. (#8980)
     while (!supervisor_filesystem_access_could_block()) {
-        // If we have a request in progress, continue working on it. Do this first
-        // so that we can accept another socket after finishing this request.
-        if (common_hal_socketpool_socket_get_connected(&active)) {
-            _process_request(&active, &active_request);
-            if (active_request.in_progress) {
-                break;
-            }
-        } else {
-            // Close the active socket if necessary
-            if (!common_hal_socketpool_socket_get_closed(&active)) {
-                common_hal_socketpool_socket_close(&active);
+        // Continue the requests in progress first so that finished connections can take
+        // another socket.
+        for (size_t i = 0; i < MP_ARRAY_SIZE(connections); i++) {
+            _connection *connection = &connections[i];
+            if (common_hal_socketpool_socket_get_connected(&connection->socket)) {
+                _process_request(&connection->socket, &connection->request);
+            } else if (!common_hal_socketpool_socket_get_closed(&connection->socket)) {
+                // Close the socket if necessary
+                common_hal_socketpool_socket_close(&connection->socket);
+                if (connection->request.in_progress) {
+                    _reset_request(&connection->request);
+                    _request_finished(false);
+                }
             }
         }
         // Otherwise, see if we have another socket to accept.
-        if ((!common_hal_socketpool_socket_get_connected(&active) ||
-             (!active_request.in_progress && !active_request.new_socket)) &&
-            !common_hal_socketpool_socket_get_closed(&listening)) {
-            if (!common_hal_socketpool_socket_get_closed(&active)) {
-                common_hal_socketpool_socket_close(&active);
-            }
-            int newsoc = socketpool_socket_accept(&listening, NULL, &active);
-            if (newsoc == -EBADF) {
-                common_hal_socketpool_socket_close(&listening);
-                break;
-            }
-            if (newsoc > 0) {
-                common_hal_socketpool_socket_settimeout(&active, 0);
-                _reset_request(&active_request);
-                // Mark new sockets, otherwise we may accept another before the first
-                // could start its request.
-                active_request.new_socket = true;
-                continue;
-            }
+        if (common_hal_socketpool_socket_get_closed(&listening)) {
+            break;
+        }
+        _connection *connection = _connection_for_accept();
+        if (connection == NULL) {
             break;
         }
+        int newsoc = socketpool_socket_accept(&listening, NULL, &accepting);
+        if (newsoc == -EBADF) {
+            common_hal_socketpool_socket_close(&listening);
+            break;
+        }
+        if (newsoc > 0) {
+            if (!common_hal_socketpool_socket_get_closed(&connection->socket)) {
+                common_hal_socketpool_socket_close(&connection->socket);
+            }
+            socketpool_socket_move(&accepting, &connection->socket);
+            common_hal_socketpool_socket_settimeout(&connection->socket, 0);
+            _reset_request(&connection->request);
+            // Mark new sockets, otherwise we may replace one before it could start its request.
+            connection->request.new_socket = true;
+            continue;
+        }
+        break;
     }
 
     // Let the websocket code run.
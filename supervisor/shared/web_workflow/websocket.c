@@ -10,7 +10,9 @@
 #include "py/runtime.h"
 #include "shared/runtime/interrupt_char.h"
 #include "shared-bindings/socketpool/SocketPool.h"
+#include "supervisor/shared/tick.h"
 #include "supervisor/shared/web_workflow/web_workflow.h"
+#include "supervisor/workflow.h"
 
 #if CIRCUITPY_STATUS_BAR
 #include "supervisor/shared/status_bar.h"
@@ -34,6 +36,15 @@ static uint8_t _buf[16];
 // make sure background is not called recursively
 static bool in_web_background = false;
 
+// Serial output is collected into one frame until it's full or the oldest byte has waited
+// WEBSOCKET_FLUSH_MS, so that many small writes don't each become a frame. The first four bytes
+// are room for the frame header in front of the payload.
+#define WEBSOCKET_FLUSH_MS (5)
+#define WEBSOCKET_HEADER_ROOM (4)
+static uint8_t _outgoing[WEBSOCKET_HEADER_ROOM + CIRCUITPY_WEB_WORKFLOW_WEBSOCKET_BUFFER_SIZE];
+static size_t _outgoing_len = 0;
+static uint32_t _outgoing_since_ms;
+
 static _websocket cp_serial;
 
 void websocket_init(void) {
@@ -51,6 +62,7 @@ void websocket_handoff(socketpool_socket_obj_t *socket) {
     cp_serial.opcode = 0;
     cp_serial.frame_index = 0;
     cp_serial.frame_len = 2;
+    _outgoing_len = 0;
 
     #if CIRCUITPY_STATUS_BAR
     // Send the title bar for the new client.
@@ -141,23 +153,28 @@ static void _read_next_frame_header(void) {
     }
 }
 
-static bool _read_next_payload_byte(uint8_t *c) {
+// Reads up to len bytes of text payload into buf at once and unmasks them.
+static size_t _read_payload(uint8_t *buf, size_t len) {
     _read_next_frame_header();
-    if (cp_serial.opcode == 0x1 &&
-        cp_serial.frame_index >= cp_serial.frame_len &&
-        cp_serial.payload_remaining > 0) {
-        if (_read_byte(c)) {
-            uint8_t mask_offset = (cp_serial.frame_index - cp_serial.frame_len) % 4;
-            *c ^= cp_serial.mask[mask_offset];
-            cp_serial.frame_index++;
-            cp_serial.payload_remaining--;
-            if (cp_serial.payload_remaining == 0) {
-                cp_serial.frame_index = 0;
-            }
-            return true;
-        }
+    if (cp_serial.opcode != 0x1 ||
+        cp_serial.frame_index < cp_serial.frame_len ||
+        cp_serial.payload_remaining == 0) {
+        return 0;
+    }
+    int read = socketpool_socket_recv_into(&cp_serial.socket, buf, MIN(len, cp_serial.payload_remaining));
+    if (read < 1) {
+        return 0;
     }
-    return false;
+    size_t mask_offset = cp_serial.frame_index - cp_serial.frame_len;
+    for (int i = 0; i < read; i++) {
+        buf[i] ^= cp_serial.mask[(mask_offset + i) % 4];
+    }
+    cp_serial.frame_index += read;
+    cp_serial.payload_remaining -= read;
+    if (cp_serial.payload_remaining == 0) {
+        cp_serial.frame_index = 0;
+    }
+    return read;
 }
 
 uint32_t websocket_available(void) {
@@ -208,11 +225,51 @@ static void _websocket_send(_websocket *ws, const char *text, size_t len) {
         extended_len[3] = len & 0xff;
         web_workflow_send_raw(&ws->socket, false, extended_len, 4);
     }
-    web_workflow_send_raw(&ws->socket, false, (const uint8_t *)text, len);
+    web_workflow_send_raw(&ws->socket, true, (const uint8_t *)text, len);
+}
+
+// Sends the collected output as one frame, with its header written into the room in front of it.
+static void _flush_outgoing(void) {
+    if (_outgoing_len == 0) {
+        return;
+    }
+    size_t len = _outgoing_len;
+    _outgoing_len = 0;
+    if (!websocket_connected()) {
+        return;
+    }
+    uint8_t *frame = _outgoing + WEBSOCKET_HEADER_ROOM;
+    if (len <= 125) {
+        frame -= 2;
+        frame[1] = len;
+    } else {
+        frame -= 4;
+        frame[1] = 126;
+        frame[2] = (len >> 8) & 0xff;
+        frame[3] = len & 0xff;
+    }
+    frame[0] = 1 << 7 | 1; // Final text frame
+    web_workflow_send_raw(&cp_serial.socket, true, frame, _outgoing + WEBSOCKET_HEADER_ROOM + len - frame);
 }
 
 void websocket_write(const char *text, size_t len) {
-    _websocket_send(&cp_serial, text, len);
+    if (!websocket_connected()) {
+        return;
+    }
+    if (_outgoing_len + len > CIRCUITPY_WEB_WORKFLOW_WEBSOCKET_BUFFER_SIZE) {
+        _flush_outgoing();
+    }
+    if (len > CIRCUITPY_WEB_WORKFLOW_WEBSOCKET_BUFFER_SIZE) {
+        _websocket_send(&cp_serial, text, len);
+        return;
+    }
+    if (_outgoing_len == 0) {
+        _outgoing_since_ms = supervisor_ticks_ms32();
+        // Make sure the background task comes around to send it.
+        supervisor_workflow_request_background();
+    }
+    memcpy(_outgoing + WEBSOCKET_HEADER_ROOM + _outgoing_len, text, len);
+    _outgoing_len += len;
 }
 
 void websocket_background(void) {
@@ -223,15 +280,26 @@ void websocket_background(void) {
         return;
     }
     in_web_background = true;
-    uint8_t c;
+    if (_outgoing_len > 0) {
+        if (supervisor_ticks_ms32() - _outgoing_since_ms >= WEBSOCKET_FLUSH_MS) {
+            _flush_outgoing();
+        } else {
+            // Come back once it's due.
+            supervisor_workflow_request_background();
+        }
+    }
+    uint8_t incoming[sizeof(_buf)];
+    size_t len;
     while (ringbuf_num_empty(&_incoming_ringbuf) > 0 &&
-           _read_next_payload_byte(&c)) {
-        if (c == mp_interrupt_char) {
-            ringbuf_clear(&_incoming_ringbuf);
-            mp_sched_keyboard_interrupt();
-            continue;
+           (len = _read_payload(incoming, ringbuf_num_empty(&_incoming_ringbuf))) > 0) {
+        for (size_t i = 0; i < len; i++) {
+            if (incoming[i] == mp_interrupt_char) {
+                ringbuf_clear(&_incoming_ringbuf);
+                mp_sched_keyboard_interrupt();
+                continue;
+            }
+            ringbuf_put(&_incoming_ringbuf, incoming[i]);
         }
-        ringbuf_put(&_incoming_ringbuf, c);
     }
     in_web_background = false;
 }
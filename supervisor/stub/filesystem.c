@@ -15,6 +15,10 @@ void filesystem_tick(void) {
     return;
 }
 
+void filesystem_written(void) {
+    return;
+}
+
 bool filesystem_init(bool create_allowed, bool force_create) {
     (void)create_allowed;
     (void)force_create;
@@ -9,7 +9,9 @@ SRC_SUPERVISOR = \
 	supervisor/shared/flash.c \
 	supervisor/shared/lock.c \
 	supervisor/shared/micropython.c \
+	supervisor/shared/offload.c \
 	supervisor/shared/port.c \
+	supervisor/shared/port_heap_pool.c \
 	supervisor/shared/reload.c \
 	supervisor/shared/safe_mode.c \
 	supervisor/shared/serial.c \
@@ -62,6 +64,10 @@ CFLAGS += -DSPI_FLASH_FILESYSTEM=$(SPI_FLASH_FILESYSTEM)
 DISABLE_FILESYSTEM ?= 0
 CFLAGS += -DDISABLE_FILESYSTEM=$(DISABLE_FILESYSTEM)
 
+# Put a wear leveling translation layer between the filesystem and external flash.
+EXTERNAL_FLASH_FTL ?= 0
+CFLAGS += -DEXTERNAL_FLASH_FTL=$(EXTERNAL_FLASH_FTL)
+
 ifeq ($(DISABLE_FILESYSTEM),1)
 SRC_SUPERVISOR += supervisor/stub/filesystem.c
 else
@@ -81,6 +87,9 @@ else
   CFLAGS += -DEXTERNAL_FLASH_DEVICES=$(EXTERNAL_FLASH_DEVICES) \
 
   SRC_SUPERVISOR += supervisor/shared/external_flash/external_flash.c
+  ifeq ($(EXTERNAL_FLASH_FTL),1)
+    SRC_SUPERVISOR += supervisor/shared/external_flash/ftl.c
+  endif
   ifeq ($(SPI_FLASH_FILESYSTEM),1)
     SRC_SUPERVISOR += supervisor/shared/external_flash/spi_flash.c
   endif
@@ -0,0 +1,60 @@
+# test that repeated lookups from the same site see changes to the names
+
+import sys
+
+
+def get_g():
+    return g
+
+
+g = 1
+print(get_g())
+g = 2
+print(get_g())
+del g
+try:
+    get_g()
+except NameError:
+    print("NameError")
+
+
+# a global shadowing a builtin after the site found the builtin
+def get_len():
+    return len
+
+
+print(get_len() is len)
+len = 5
+print(get_len())
+del len
+print(get_len()(""))
+
+
+class A:
+    def __init__(self, x):
+        self.x = x
+
+
+def get_x(a):
+    return a.x
+
+
+a, b = A(1), A(2)
+for o in (a, b, a):
+    print(get_x(o))
+b.y = 3
+del b.x
+try:
+    get_x(b)
+except AttributeError:
+    print("AttributeError")
+b.x = 4
+print(get_x(b))
+
+
+def module_attr():
+    return sys.maxsize > 0
+
+
+print(module_attr())
+print(module_attr())
@@ -0,0 +1,57 @@
+# test exec of source with many top-level statements
+
+# nothing runs if a later statement has a syntax error
+try:
+    exec("print('not run')\nx = 1\ndef f():\n    return x\nx = (\n")
+except SyntaxError:
+    print("SyntaxError")
+
+# nothing runs if a later statement has an indentation error
+try:
+    exec("print('not run')\nif 1:\n    pass\n  pass\n")
+except IndentationError:
+    print("IndentationError")
+
+# statements see names defined by earlier ones
+g = {}
+exec(
+    """
+import sys
+x = 1
+y = 2; z = 3
+
+
+def f(a):
+    return a + x + y + z
+
+
+class A:
+    n = f(10)
+
+    def m(self):
+        return self.n + len(sys.argv) * 0
+
+
+for i in range(3):
+    x += i
+if x > 1:
+    w = "big"
+else:
+    w = "small"
+r = [f(i) for i in range(2)]
+""",
+    g,
+)
+print(g["x"], g["w"], g["r"], g["A"]().m())
+
+# an exception stops the statements that follow it
+g = {}
+try:
+    exec("a = 1\nb = 1 // 0\nc = 1\n", g)
+except ZeroDivisionError:
+    print("ZeroDivisionError", "a" in g, "c" in g)
+
+# blank lines, comments, and an empty source
+exec("\n\n# comment\n\n")
+exec("")
+exec("\nprint('last')")
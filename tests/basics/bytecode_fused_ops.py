@@ -0,0 +1,114 @@
+# test code patterns that the bytecode emitter may fuse into single opcodes
+
+
+class A:
+    def __init__(self, x):
+        self.x = x
+        self.y = [x]
+
+    def get(self):
+        return self.x
+
+    def bump(self, n):
+        self.x += n
+        self.y.append(self.get())
+        return self.x
+
+
+a = A(1)
+print(a.get(), a.bump(2), a.bump(-5), a.y)
+
+
+# self as a plain first argument, not in a class
+def set_attr(o, v):
+    o.x = v
+    return o.x
+
+
+print(set_attr(a, 10), a.x)
+
+
+# in-place ops on locals with small int constants
+def counters(n):
+    i = 0
+    j = 100
+    k = 7
+    while i < n:
+        i += 1
+        j -= 3
+        k = k * 2
+        k = k % 1000
+    s = "a"
+    s += "b"
+    f = 1.5
+    f += 1
+    l = [1]
+    l += [2]
+    return i, j, k, s, f, l
+
+
+print(counters(10))
+
+
+# results that overflow a small int
+def overflow(x):
+    x += 1
+    y = x
+    y -= 1
+    z = -x
+    z -= 2
+    return x, y, z
+
+
+print(overflow(0x3FFFFFFF))
+print(overflow(0x7FFFFFFFFFFFFFFF))
+
+
+# an unbound local reaches the fused opcode
+def unbound(flag):
+    if flag:
+        v = 1
+    v += 1
+    return v
+
+
+print(unbound(True))
+try:
+    unbound(False)
+except NameError:
+    print("NameError")
+
+
+def unbound_self(flag):
+    if flag:
+        del flag
+    return flag.x
+
+
+try:
+    unbound_self(True)
+except NameError:
+    print("NameError")
+
+
+# a jump target between the loaded local and the op must not be fused over
+def loop(n):
+    x = 0
+    for _ in range(n):
+        x = x + 2
+    return x
+
+
+print(loop(5))
+
+
+# an exception from the op leaves the local as it was
+def raises():
+    x = None
+    try:
+        x += 1
+    except TypeError:
+        print("TypeError", x)
+
+
+raises()
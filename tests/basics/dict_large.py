@@ -0,0 +1,62 @@
+# test dicts large enough to grow past the small hash table sizes
+
+
+def check(d, n):
+    print(len(d), all(d[i] == i * 2 for i in range(n)), all(d["k%d" % i] == i for i in range(n)))
+
+
+# grow one key at a time, with int and str keys
+d = {}
+for i in range(200):
+    d[i] = i * 2
+    d["k%d" % i] = i
+check(d, 200)
+print(sorted(d.values())[-3:], 200 in d, "k200" in d)
+
+# delete most of the keys, then add them back
+for i in range(150):
+    del d[i]
+    d.pop("k%d" % i)
+print(len(d), 0 in d, 149 in d, 150 in d, d.get("k10"), d.get("k160"))
+for i in range(150):
+    d[i] = i * 2
+    d["k%d" % i] = i
+check(d, 200)
+
+# repeatedly delete and re-add the same key
+for _ in range(1000):
+    d.pop(5)
+    d[5] = 10
+check(d, 200)
+
+# copy, compare, update
+d2 = d.copy()
+print(d2 == d, len(d2))
+d2["new"] = 1
+print(d2 == d, "new" in d, "new" in d2)
+d3 = {}
+d3.update(d)
+print(d3 == d)
+
+# iterate and pop everything
+print(sorted(k for k in d if isinstance(k, int)) == list(range(200)))
+n = 0
+while d:
+    d.popitem()
+    n += 1
+print(n, len(d), d)
+d[1] = 2
+print(d)
+
+# values that compare equal across types
+d = {i: i for i in range(50)}
+d[True] = "t"
+d[1.0] = "f"
+print(len(d), d[1])
+
+# clear and reuse
+d.clear()
+print(len(d))
+for i in range(40):
+    d[str(i)] = i
+print(len(d), d["39"], sum(d.values()))
@@ -0,0 +1,28 @@
+# test interning and looking up many names that aren't known at build time
+
+
+class A:
+    pass
+
+
+a = A()
+names = ["attr_%d_%s" % (i, "x" * (i % 7)) for i in range(3000)]
+for i, name in enumerate(names):
+    setattr(a, name, i)
+
+# look the names up again from freshly built strings
+ok = True
+for i in range(3000):
+    name = "attr_%d_%s" % (i, "x" * (i % 7))
+    if getattr(a, name) != i:
+        ok = False
+print(ok)
+
+# names that were never interned
+print(hasattr(a, "attr_3000_"), hasattr(a, "attr_0_x"))
+
+# the compiler interns identifiers too
+src = "\n".join("v_%d = %d" % (i, i) for i in range(500))
+g = {}
+exec(src + "\nresult = v_0 + v_250 + v_499", g)
+print(g["result"], len([k for k in g if k.startswith("v_")]))
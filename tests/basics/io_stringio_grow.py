@@ -0,0 +1,25 @@
+# test building up a StringIO and BytesIO a piece at a time
+
+import io
+
+s = io.StringIO()
+for i in range(2000):
+    s.write("line %d\n" % i)
+v = s.getvalue()
+print(len(v), v[:14], v[-20:])
+
+# writing after a seek back, and after a seek past the end
+s.seek(5)
+s.write("X" * 3)
+s.seek(0, 2)
+s.write("end")
+v = s.getvalue()
+print(len(v), v[:14], v[-10:])
+
+b = io.BytesIO()
+for i in range(1000):
+    b.write(bytes([i & 0xFF]) * (i % 7))
+b.seek(b.tell() + 10)
+b.write(b"!")
+v = b.getvalue()
+print(len(v), v[:10], v[-12:])
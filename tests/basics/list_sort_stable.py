@@ -0,0 +1,41 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+
+# test that sort is stable, with runs that are ascending, descending and short
+data = [(i * 7) % 10 for i in range(100)] + list(range(50)) + list(range(50, 0, -1))
+pairs = [(v, i) for i, v in enumerate(data)]
+print(sorted(pairs, key=lambda p: p[0]) == sorted(pairs))
+print(sorted(pairs, key=lambda p: p[0], reverse=True) == sorted(pairs, key=lambda p: (-p[0], p[1])))
+
+# equal elements keep their order in descending runs and with reverse
+l = [(1, "a"), (1, "b"), (0, "c"), (0, "d")]
+print(sorted(l, key=lambda p: p[0]))
+print(sorted(l, key=lambda p: p[0], reverse=True))
+
+# key is called once for each element
+count = 0
+
+
+def key(x):
+    global count
+    count += 1
+    return -x
+
+
+l = list(range(300))
+l.sort(key=key)
+print(count, l[0], l[-1])
+
+# already sorted and reverse sorted lists
+for l in (list(range(1000)), list(range(1000, 0, -1))):
+    l.sort()
+    print(l[0], l[-1], l == sorted(l))
+
+# an exception while sorting leaves every element in the list
+l = [(i * 37) % 101 for i in range(101)]
+l[50] = None
+expected = sorted(x for x in l if x is not None)
+try:
+    l.sort()
+except TypeError:
+    print("TypeError")
+print(len(l), l.count(None), sorted(x for x in l if x is not None) == expected)
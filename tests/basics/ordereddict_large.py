@@ -0,0 +1,38 @@
+# test OrderedDicts large enough to grow past the small table sizes
+try:
+    from collections import OrderedDict
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+d = OrderedDict()
+for i in range(100):
+    d["k%d" % (99 - i)] = i
+print(len(d), list(d.keys())[:3], list(d.values())[-3:])
+print(d["k0"], d["k99"], "k100" in d)
+
+# deletions keep the remaining order
+for i in range(0, 100, 3):
+    del d["k%d" % i]
+print(len(d), list(d.keys())[:4], list(d.keys())[-4:])
+
+# new keys go at the end, re-added keys too
+d["k0"] = "x"
+d["new"] = "y"
+print(list(d.items())[-2:])
+
+d.move_to_end("k98")
+print(list(d.keys())[-1], d["k98"])
+d.move_to_end("k97", last=False)
+print(list(d.keys())[0], d["k97"])
+print(d.popitem(), d.popitem(), len(d))
+
+# copy keeps the order
+d2 = d.copy()
+print(list(d2.keys()) == list(d.keys()), d2 == d)
+
+# clear and refill in order
+d.clear()
+for i in range(30):
+    d[i] = -i
+print(list(d.keys()) == list(range(30)), d[29])
@@ -0,0 +1,12 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+# find, split and friends with needles that match partially, repeatedly or at the ends
+
+for h in ["", "a", "ab,cd,,ef,", ",,", "aaaa", "abcabcab", "xyz"]:
+    for n in ["", "a", ",", "ab", "abc", "cab", ",,", "xyz", "zz"]:
+        print(repr(h), repr(n), h.find(n), h.rfind(n), n in h, h.count(n))
+        print(h.replace(n or "q", "_"))
+        if n:
+            print(h.split(n), h.split(n, 1), h.rsplit(n, 0), h.rsplit(n, 1), h.rsplit(n, 2))
+            print(h.partition(n), h.rpartition(n))
+            b = h.encode()
+            print(b.find(n.encode(), 1), b.rfind(n.encode(), 1, 3), b.split(n.encode()))
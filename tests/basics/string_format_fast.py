@@ -0,0 +1,33 @@
+# test str.format fields that are printed straight into the output
+
+
+class A:
+    def __str__(self):
+        return "str-A"
+
+    def __repr__(self):
+        return "repr-A"
+
+
+# fields without a format spec
+print("{} {!s} {!r}".format(A(), A(), A()))
+print("{} {} {} {}".format(1, -2.5, True, None))
+print("{}|{!r}|{}".format("abc", "abc", b"xy"))
+print("{0}{1}{0}".format("a", "b"))
+print("{x}{y!r}".format(x=[1, 2], y=(3,)))
+print("{:}".format(True), "{:d}".format(True))
+
+# a conversion together with a format spec
+print("{!r:>10}|{!s:<8}|".format(A(), A()))
+
+# format specs copied to the stack, and ones too long for it
+print("{:>12.3f}|{:^9}|{:+05d}".format(3.14159, "mid", 42))
+print("{:*<40}|".format("x"))
+print("{:040.10f}|".format(1.5))
+
+# nested fields in the format spec
+print("{:{}}|{:>{w}}|{:{fill}^{w}}|".format("a", 5, "b", "c", w=6, fill="-"))
+
+# output longer than the initial size
+print("{}".format("y" * 100))
+print("{}{}{}".format("z" * 50, 123456789, "w" * 50))
@@ -0,0 +1,165 @@
+# Replays scripted scene changes on a displayio.HeadlessDisplay and reports
+# how much work each one took. Run it with the unix coverage build:
+#
+#   ports/unix/build-coverage/micropython tests/circuitpython-manual/displayio/headless_bench.py [width height [color_depth]]
+#
+# Each scene prints its name, the number of refreshes, the mean time per
+# refresh in microseconds, and the pixels shaded and bytes "sent" in total.
+# Pixels and bytes only change when the rendering does, so they can be compared
+# exactly between builds. Times are for comparing builds on the same machine.
+
+import sys
+
+import bitmaptools
+import displayio
+import vectorio
+
+args = [int(a) for a in sys.argv[1:]]
+WIDTH = args[0] if len(args) > 0 else 320
+HEIGHT = args[1] if len(args) > 1 else 240
+DEPTH = args[2] if len(args) > 2 else 16
+FRAMES = 50
+
+display = displayio.HeadlessDisplay(WIDTH, HEIGHT, color_depth=DEPTH)
+
+palette = displayio.Palette(8)
+for i, color in enumerate(
+    (0x000000, 0xFFFFFF, 0xFF0000, 0x00FF00, 0x0000FF, 0xFFFF00, 0x00FFFF, 0xFF00FF)
+):
+    palette[i] = color
+palette.make_transparent(0)
+
+
+def report(name):
+    count = display.refresh_count
+    mean = display.refresh_time // count if count else 0
+    print(
+        "{:<16} {:>4} {:>8} {:>10} {:>10}".format(
+            name, count, mean, display.pixels_shaded, display.bytes_sent
+        )
+    )
+    display.reset_stats()
+
+
+def scene_full_redraw(root):
+    background = displayio.Bitmap(WIDTH, HEIGHT, 8)
+    for y in range(0, HEIGHT, 8):
+        bitmaptools.fill_region(background, 0, y, WIDTH, min(y + 8, HEIGHT), 1 + (y // 8) % 7)
+    root.append(displayio.TileGrid(background, pixel_shader=palette))
+    for _ in range(FRAMES):
+        display.root_group = None
+        display.root_group = root
+        display.refresh()
+
+
+def scene_sprites(root):
+    sheet = displayio.Bitmap(64, 16, 8)
+    for i in range(4):
+        bitmaptools.fill_region(sheet, i * 16 + 2, 2, i * 16 + 14, 14, 2 + i)
+    sprites = []
+    for i in range(8):
+        sprite = displayio.TileGrid(
+            sheet, pixel_shader=palette, tile_width=16, tile_height=16, x=i * 20, y=i * 10
+        )
+        sprite[0] = i % 4
+        root.append(sprite)
+        sprites.append(sprite)
+    display.refresh()
+    display.reset_stats()
+    for frame in range(FRAMES):
+        for i, sprite in enumerate(sprites):
+            sprite.x = (sprite.x + 1 + i) % (WIDTH - 16)
+            sprite[0] = (frame + i) % 4
+        display.refresh()
+
+
+def scene_vectorio(root):
+    shapes = [
+        vectorio.Circle(pixel_shader=palette, radius=20, x=40, y=40, color_index=2),
+        vectorio.Rectangle(pixel_shader=palette, width=50, height=30, x=100, y=60, color_index=3),
+        vectorio.Polygon(
+            pixel_shader=palette, points=[(0, 0), (40, 10), (20, 40)], x=160, y=100, color_index=4
+        ),
+    ]
+    for shape in shapes:
+        root.append(shape)
+    display.refresh()
+    display.reset_stats()
+    for frame in range(FRAMES):
+        for i, shape in enumerate(shapes):
+            shape.x = (shape.x + 2 + i) % (WIDTH - 40)
+            shape.y = (shape.y + 1) % (HEIGHT - 40)
+        display.refresh()
+
+
+def scene_palette(root):
+    bitmap = displayio.Bitmap(WIDTH // 2, HEIGHT // 2, 8)
+    bitmaptools.fill_region(bitmap, 0, 0, WIDTH // 2, HEIGHT // 2, 5)
+    root.append(displayio.TileGrid(bitmap, pixel_shader=palette, x=WIDTH // 4, y=HEIGHT // 4))
+    display.refresh()
+    display.reset_stats()
+    for frame in range(FRAMES):
+        palette[5] = (frame * 0x050301) & 0xFFFFFF
+        display.refresh()
+    palette[5] = 0xFFFF00
+
+
+def scene_scroll(root):
+    bitmap = displayio.Bitmap(WIDTH, HEIGHT // 4, 8)
+    scratch = displayio.Bitmap(WIDTH, HEIGHT // 4, 8)
+    for x in range(0, WIDTH, 10):
+        bitmaptools.fill_region(bitmap, x, 0, x + 5, HEIGHT // 4, 1 + (x // 10) % 7)
+    root.append(displayio.TileGrid(bitmap, pixel_shader=palette, y=HEIGHT // 3))
+    display.refresh()
+    display.reset_stats()
+    for _ in range(FRAMES):
+        bitmaptools.blit(scratch, bitmap, 0, 0, x1=1, x2=WIDTH)
+        bitmaptools.blit(scratch, bitmap, WIDTH - 1, 0, x1=0, x2=1)
+        bitmaptools.blit(bitmap, scratch, 0, 0)
+        display.refresh()
+
+
+def scene_text(root):
+    glyphs = displayio.Bitmap(8 * 16, 8, 2)
+    for i in range(16):
+        for j in range(i % 8):
+            glyphs[i * 8 + j, j] = 1
+    columns = WIDTH // 8
+    rows = HEIGHT // 8
+    text = displayio.TileGrid(
+        glyphs,
+        pixel_shader=palette,
+        width=columns,
+        height=rows,
+        tile_width=8,
+        tile_height=8,
+    )
+    root.append(text)
+    display.refresh()
+    display.reset_stats()
+    for frame in range(FRAMES):
+        row = frame % rows
+        for column in range(columns):
+            text[column, row] = (frame + column) % 16
+        display.refresh()
+
+
+print("{}x{} {} bits per pixel, {} frames per scene".format(WIDTH, HEIGHT, DEPTH, FRAMES))
+print(
+    "{:<16} {:>4} {:>8} {:>10} {:>10}".format("scene", "refr", "us/refr", "pixels", "bytes")
+)
+for scene in (
+    scene_full_redraw,
+    scene_sprites,
+    scene_vectorio,
+    scene_palette,
+    scene_scroll,
+    scene_text,
+):
+    root = displayio.Group()
+    display.root_group = root
+    display.refresh()
+    display.reset_stats()
+    scene(root)
+    report(scene.__name__[6:])
+    display.root_group = None
@@ -0,0 +1,65 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+import array
+import arrayops
+
+# integer results saturate instead of wrapping
+a = array.array("h", [1000, -1000, 30000, -30000, 5])
+arrayops.add(a, 10000)
+print(list(a))
+arrayops.mul(a, array.array("h", [2, 2, 2, 2, -3]))
+print(list(a))
+arrayops.scale(a, 0.5, 1)
+print(list(a))
+arrayops.clip(a, -100, 20000)
+print(list(a))
+print(arrayops.sum(a), arrayops.dot(a, a), arrayops.min(a), arrayops.max(a))
+
+u = array.array("I", [0xFFFFFFFF, 5])
+arrayops.add(u, 1 << 40)
+print(list(u))
+arrayops.add(u, -(1 << 70))
+print(list(u))
+print(arrayops.dot(array.array("I", [0xFFFFFFFF] * 3), array.array("I", [0xFFFFFFFF] * 3)))
+
+ba = bytearray(b"\x01\x02\xff")
+arrayops.add(ba, 1)
+print(list(ba))
+
+# floats
+f = array.array("f", [0.5, -1.5, 2.0])
+arrayops.mul(f, f)
+print(list(f), arrayops.sum(f), arrayops.max(f))
+arrayops.scale(f, 2.0, -1.0)
+arrayops.clip(f, 0, 3.0)
+print(list(f))
+d = array.array("d", [1.5, 2.5])
+arrayops.add(d, array.array("d", [1.0, 2.0]))
+print(list(d), arrayops.dot(d, d))
+
+# slices of memoryviews work in place
+m = memoryview(array.array("H", range(10)))
+arrayops.add(m[2:5], 100)
+print(list(m))
+
+# convert rounds and saturates
+b = array.array("b", bytes(6))
+arrayops.convert(b, array.array("f", [0.4, 1.6, -2.5, 300.0, -1e9, 7.0]))
+print(list(b))
+h = array.array("h", [0] * 3)
+arrayops.convert(h, array.array("i", [-(1 << 20), 1234, 1 << 20]))
+print(list(h))
+f = array.array("f", [0.0] * 3)
+arrayops.convert(f, h)
+print(list(f))
+
+for bad in (
+    lambda: arrayops.add(array.array("h", [0] * 3), array.array("H", [0] * 3)),
+    lambda: arrayops.add(array.array("h", [0] * 3), array.array("h", [0] * 4)),
+    lambda: arrayops.convert(array.array("h", [0] * 3), array.array("f", [0] * 2)),
+    lambda: arrayops.min(array.array("f")),
+    lambda: arrayops.add(array.array("h", [0, 0]), 1.5),
+):
+    try:
+        bad()
+    except (TypeError, ValueError) as e:
+        print(type(e).__name__, e)
@@ -0,0 +1,51 @@
+import array
+from audiocore import RawSample, Resampler, get_buffer, reset_buffer
+
+
+def dump(sample, count=3):
+    for _ in range(count):
+        result, data = get_buffer(sample)
+        print(result, list(data))
+        if result == 0:
+            break
+
+
+ramp = RawSample(array.array("h", [0, 1000, 2000, 3000, 4000, 5000, 6000, 7000]), sample_rate=8000)
+
+print("up x2")
+up = Resampler(ramp, sample_rate=16000, buffer_size=16)
+print(up.sample_rate, up.bits_per_sample, up.channel_count, up.sample is ramp)
+dump(up)
+
+print("reset")
+reset_buffer(up)
+dump(up, 1)
+
+print("down /2")
+dump(Resampler(ramp, sample_rate=4000, buffer_size=16))
+
+print("x3/2")
+dump(Resampler(ramp, sample_rate=12000, buffer_size=32))
+
+print("stereo")
+stereo = RawSample(array.array("h", [0, -100, 100, -200, 200, -300]), channel_count=2, sample_rate=1000)
+dump(Resampler(stereo, sample_rate=2000, buffer_size=64))
+
+print("unsigned 8 bit")
+u8 = RawSample(array.array("B", [128, 192, 255, 64]), sample_rate=1000)
+dump(Resampler(u8, sample_rate=2000, buffer_size=64))
+
+print("rate change")
+r = Resampler(ramp, sample_rate=8000, buffer_size=8)
+dump(r, 1)
+r.sample_rate = 16000
+dump(r, 1)
+
+try:
+    Resampler(ramp, sample_rate=0)
+except ValueError as e:
+    print("ValueError")
+try:
+    Resampler(1, sample_rate=8000)
+except TypeError as e:
+    print("TypeError")
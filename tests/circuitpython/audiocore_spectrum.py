@@ -0,0 +1,73 @@
+import array
+import math
+from audiocore import RawSample, SpectrumAnalyzer, get_buffer, reset_buffer
+
+
+def tone(bin, size, amplitude=32767, channel_count=1):
+    return array.array(
+        "h",
+        [
+            int(amplitude * math.sin(2 * math.pi * bin * (i // channel_count) / size))
+            for i in range(size * channel_count)
+        ],
+    )
+
+
+def peaks(bins):
+    top = sorted(range(len(bins)), key=lambda k: (-bins[k], k))[:2]
+    return [(k, bins[k] // 1024) for k in sorted(top)]
+
+
+bins = array.array("H", [0] * 32)
+
+print("mono")
+data = tone(5, 64)
+analyzer = SpectrumAnalyzer(RawSample(data, sample_rate=8000), fft_size=64)
+print(analyzer.fft_size, analyzer.sample_rate, analyzer.channel_count, analyzer.bits_per_sample)
+print(analyzer.read(bins), max(bins))
+result, block = get_buffer(analyzer)
+print(result, bytes(block) == bytes(data))
+print(analyzer.read(bins), peaks(bins))
+print(analyzer.read(bins))
+
+print("loop")
+reset_buffer(analyzer)
+get_buffer(analyzer)
+print(analyzer.read(bins), peaks(bins))
+
+print("two tones")
+mixed = array.array("h", [a // 2 + b // 2 for a, b in zip(tone(3, 64), tone(12, 64))])
+analyzer = SpectrumAnalyzer(RawSample(mixed, sample_rate=8000), fft_size=64)
+get_buffer(analyzer)
+analyzer.read(bins)
+print(peaks(bins))
+
+print("stereo")
+analyzer = SpectrumAnalyzer(RawSample(tone(7, 64, channel_count=2), channel_count=2, sample_rate=8000), fft_size=64)
+get_buffer(analyzer)
+print(analyzer.read(bins), peaks(bins))
+
+print("unsigned 8 bit")
+u8 = array.array("B", [128 + int(127 * math.sin(2 * math.pi * 9 * i / 64)) for i in range(64)])
+analyzer = SpectrumAnalyzer(RawSample(u8, sample_rate=8000), fft_size=64)
+get_buffer(analyzer)
+print(analyzer.read(bins), peaks(bins))
+
+print("partial block")
+analyzer = SpectrumAnalyzer(RawSample(tone(2, 32), sample_rate=8000), fft_size=64)
+get_buffer(analyzer)
+print(analyzer.read(bins))
+reset_buffer(analyzer)
+get_buffer(analyzer)
+print(analyzer.read(bins))
+
+for size in (8, 100, 2048):
+    try:
+        SpectrumAnalyzer(RawSample(data, sample_rate=8000), fft_size=size)
+    except ValueError:
+        print("ValueError", size)
+for buffer in (array.array("h", [0] * 32), array.array("H", [0] * 16)):
+    try:
+        SpectrumAnalyzer(RawSample(data, sample_rate=8000), fft_size=64).read(buffer)
+    except ValueError:
+        print("ValueError")
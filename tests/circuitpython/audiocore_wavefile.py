@@ -0,0 +1,83 @@
+import array
+import os
+import struct
+from audiocore import WaveFile, get_buffer, reset_buffer
+
+
+# Sparse, so the volume can be big enough for multi-sector clusters.
+class RAMFS:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.blocks = blocks
+        self.data = {}
+        self.reads = []
+
+    def readblocks(self, n, buf):
+        self.reads.append(len(buf) // self.SEC_SIZE)
+        for i in range(len(buf) // self.SEC_SIZE):
+            block = self.data.get(n + i, bytes(self.SEC_SIZE))
+            buf[i * self.SEC_SIZE : (i + 1) * self.SEC_SIZE] = block
+        return 0
+
+    def writeblocks(self, n, buf):
+        for i in range(len(buf) // self.SEC_SIZE):
+            self.data[n + i] = bytes(buf[i * self.SEC_SIZE : (i + 1) * self.SEC_SIZE])
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return self.blocks
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+bdev = RAMFS(8192)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/ramdisk")
+os.chdir("/ramdisk")
+
+samples = array.array("h", [(i * 37) % 65536 - 32768 for i in range(5000)])
+data = bytes(samples)
+with open("ramp.wav", "wb") as f:
+    f.write(b"RIFF")
+    f.write(struct.pack("<I", 36 + len(data)))
+    f.write(b"WAVEfmt ")
+    f.write(struct.pack("<IHHIIHH", 16, 1, 1, 8000, 16000, 2, 16))
+    f.write(b"data")
+    f.write(struct.pack("<I", len(data)))
+    f.write(data)
+
+
+def play(wave):
+    lengths = []
+    out = bytearray()
+    while True:
+        result, block = get_buffer(wave)
+        lengths.append(len(block))
+        out.extend(block)
+        if result != 1:
+            break
+    print(lengths, out[: len(data)] == data)
+
+
+for size in (512, 4096):
+    print("buffer", size)
+    bdev.reads = []
+    wave = WaveFile("ramp.wav", bytearray(size))
+    print("opened", bdev.reads[-1:])
+    bdev.reads = []
+    result, block = get_buffer(wave)
+    print("first block", len(block), bdev.reads)
+    reset_buffer(wave)
+    play(wave)
+    print("loop")
+    reset_buffer(wave)
+    bdev.reads = []
+    play(wave)
+    print("reads", bdev.reads)
+
+try:
+    WaveFile("ramp.wav", bytearray(32770))
+except ValueError:
+    print("ValueError")
@@ -0,0 +1,83 @@
+import array
+import audiodelays
+import audiofilters
+import audiofx
+import synthio
+from audiocore import RawSample, get_buffer
+
+# A chain plays exactly what the same effects playing each other would, while the sample plays.
+# Unsigned 16-bit is left out because the effects on their own take it as signed.
+FORMATS = (
+    ("h", 16, True, 1),
+    ("h", 16, True, 2),
+    ("b", 8, True, 2),
+    ("B", 8, False, 1),
+)
+
+
+def make_sample(typecode, bits, signed, channel_count):
+    full = 1 << (bits - 1)
+    values = [((i * 2654435761) >> 7) % (2 * full) - full for i in range(200 * channel_count)]
+    if not signed:
+        values = [v + full for v in values]
+    return RawSample(array.array(typecode, values), channel_count=channel_count, sample_rate=8000)
+
+
+def make_effects(bits, signed, channel_count):
+    settings = dict(
+        buffer_size=128,
+        sample_rate=8000,
+        bits_per_sample=bits,
+        samples_signed=signed,
+        channel_count=channel_count,
+    )
+    return (
+        audiodelays.Echo(max_delay_ms=40, delay_ms=20, decay=0.5, mix=0.5, freq_shift=False, **settings),
+        audiodelays.Chorus(max_delay_ms=20, delay_ms=10, voices=3, mix=0.4, **settings),
+        audiodelays.PitchShift(semitones=3, mix=0.6, window=128, overlap=16, **settings),
+        audiofilters.Filter(filter=synthio.Biquad(synthio.FilterMode.LOW_PASS, 1000), mix=0.8, **settings),
+        audiofilters.Distortion(drive=0.5, pre_gain=6, mode=audiofilters.DistortionMode.OVERDRIVE, **settings),
+    )
+
+
+for typecode, bits, signed, channel_count in FORMATS:
+    nested = make_effects(bits, signed, channel_count)
+    nested[0].play(make_sample(typecode, bits, signed, channel_count), loop=True)
+    for i in range(1, len(nested)):
+        nested[i].play(nested[i - 1])
+
+    chain = audiofx.Chain(make_effects(bits, signed, channel_count), buffer_size=128)
+    chain.play(make_sample(typecode, bits, signed, channel_count), loop=True)
+    print(typecode, chain.sample_rate, chain.bits_per_sample, chain.channel_count)
+
+    matches = 0
+    for _ in range(16):
+        matches += get_buffer(nested[-1])[1] == get_buffer(chain)[1]
+    print("matching buffers", matches)
+
+# The effects keep running on silence once the sample ends, so the echo rings out.
+echo = audiodelays.Echo(max_delay_ms=20, delay_ms=10, decay=0.5, mix=0.5, freq_shift=False, buffer_size=64)
+chain = audiofx.Chain([echo], buffer_size=64)
+print(len(chain.effects), chain.effects[0] is echo, chain.playing)
+chain.play(RawSample(array.array("h", [10000] * 8), sample_rate=8000))
+print(chain.playing)
+result, data = get_buffer(chain)
+print(result, chain.playing, list(data)[:10])
+print([max(get_buffer(chain)[1]) for _ in range(12)])
+
+try:
+    audiofx.Chain([])
+except ValueError:
+    print("ValueError")
+try:
+    audiofx.Chain([echo, RawSample(array.array("h", [0]))])
+except TypeError:
+    print("TypeError")
+try:
+    audiofx.Chain([echo, audiofilters.Filter(channel_count=2)])
+except ValueError:
+    print("ValueError")
+try:
+    chain.play(RawSample(array.array("h", [0]), sample_rate=16000))
+except ValueError:
+    print("ValueError")
@@ -0,0 +1,43 @@
+import array
+import audiomixer
+from audiocore import RawSample, get_buffer
+
+# Every mix-down kernel: each sample format, at full, partial and zero level, as
+# the first voice and mixed onto others, with saturation at both ends.
+FORMATS = (
+    ("h", 16, True),
+    ("H", 16, False),
+    ("b", 8, True),
+    ("B", 8, False),
+)
+
+
+def make_data(typecode, bits, signed, phase):
+    full = 1 << (bits - 1)
+    values = [full - 1, -full, full // 2, -full // 2, 1000 >> (16 - bits), -7, 0, full // 3]
+    values = values[phase:] + values[:phase]
+    if not signed:
+        values = [v + full for v in values]
+    return array.array(typecode, values)
+
+
+for typecode, bits, signed in FORMATS:
+    for channel_count in (1, 2):
+        for levels in ((1.0,), (0.5,), (0.0,), (1.0, 1.0), (0.75, 0.3, 0.0), (0.0, 0.6)):
+            mixer = audiomixer.Mixer(
+                voice_count=len(levels),
+                buffer_size=64,
+                channel_count=channel_count,
+                bits_per_sample=bits,
+                samples_signed=signed,
+                sample_rate=8000,
+            )
+            for v, level in enumerate(levels):
+                sample = RawSample(
+                    make_data(typecode, bits, signed, v * 3),
+                    channel_count=channel_count,
+                    sample_rate=8000,
+                )
+                mixer.voice[v].level = level
+                mixer.voice[v].play(sample, loop=True)
+            print(typecode, channel_count, levels, list(get_buffer(mixer)[1]))
@@ -0,0 +1,55 @@
+# Blits between bitmaps of the same depth copy whole rows at a time.
+import displayio
+import bitmaptools
+
+
+def show(bmp):
+    for y in range(bmp.height):
+        print("".join("%x" % bmp[x, y] for x in range(bmp.width)))
+    print()
+
+
+for bits in (1, 2, 4, 8, 16):
+    print("bits", bits)
+    top = min((1 << bits) - 1, 15)
+    src = displayio.Bitmap(11, 5, 1 << bits)
+    for y in range(src.height):
+        for x in range(src.width):
+            src[x, y] = (x + y * 3) % (top + 1)
+
+    # Aligned, unaligned and clipped copies.
+    for x, y, x1, y1, x2, y2 in (
+        (0, 0, 0, 0, 11, 5),
+        (3, 1, 1, 0, 9, 4),
+        (8, 2, 0, 0, 11, 5),
+        (12, 5, 0, 0, 11, 5),
+    ):
+        dest = displayio.Bitmap(13, 6, 1 << bits)
+        dest.fill(top)
+        bitmaptools.blit(dest, src, x, y, x1=x1, y1=y1, x2=x2, y2=y2)
+        show(dest)
+
+    # Skipping a source index.
+    dest = displayio.Bitmap(13, 6, 1 << bits)
+    dest.fill(top)
+    bitmaptools.blit(dest, src, 1, 1, skip_source_index=1)
+    show(dest)
+
+    # Overlapping copies within one bitmap, in each direction.
+    for x, y, skip in ((2, 1, None), (0, 0, None), (2, 1, 0), (1, 0, 0)):
+        bmp = displayio.Bitmap(11, 5, 1 << bits)
+        for yy in range(bmp.height):
+            for xx in range(bmp.width):
+                bmp[xx, yy] = src[xx, yy]
+        if x == 0 and y == 0:
+            bitmaptools.blit(bmp, bmp, 0, 0, x1=2, y1=1, x2=10, y2=5, skip_source_index=skip)
+        else:
+            bitmaptools.blit(bmp, bmp, x, y, x1=0, y1=0, x2=8, y2=4, skip_source_index=skip)
+        show(bmp)
+
+# Different depths still work.
+src = displayio.Bitmap(5, 3, 4)
+src.fill(3)
+dest = displayio.Bitmap(7, 4, 256)
+bitmaptools.blit(dest, src, 1, 1)
+show(dest)
@@ -0,0 +1,41 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+import io
+import bitmaptools
+import displayio
+
+
+def load(width, height, bits, data, **kwargs):
+    b = displayio.Bitmap(width, height, 1 << bits)
+    bitmaptools.readinto(b, io.BytesIO(bytes(data)), bits, **kwargs)
+    return [[b[x, y] for x in range(width)] for y in range(height)]
+
+
+# 16 bit rows that fill the bitmap's stride are read in one go.
+print(load(2, 2, 16, range(8), element_size=2))
+print(load(2, 2, 16, range(8), element_size=2, swap_bytes_in_element=True))
+print(load(2, 2, 16, range(8), element_size=2, reverse_rows=True))
+
+# 3 pixels wide leaves the rows shorter than the stride.
+print(load(3, 2, 16, range(12), element_size=2, swap_bytes_in_element=True))
+print(load(3, 2, 8, range(6)))
+print(load(3, 2, 8, range(8), element_size=4, swap_bytes_in_element=True))
+
+# Sub-byte pixels only match the bitmap's packing when reversed.
+print(load(8, 2, 1, [0b10110001, 0b01000000], reverse_pixels_in_element=True))
+print(load(8, 2, 1, [0b10110001, 0b01000000]))
+print(load(4, 1, 4, [0x12, 0x34], reverse_pixels_in_element=True))
+print(load(4, 1, 4, [0x12, 0x34]))
+
+# The bitmap depth differs from the file's.
+b = displayio.Bitmap(2, 1, 256)
+bitmaptools.readinto(b, io.BytesIO(bytes([0x12, 0x34, 0x56, 0x78])), 16, element_size=2)
+print(b[0, 0], b[1, 0])
+
+try:
+    load(2, 2, 16, range(6), element_size=2)
+except EOFError:
+    print("EOFError")
+try:
+    load(3, 2, 16, range(10), element_size=2)
+except EOFError:
+    print("EOFError")
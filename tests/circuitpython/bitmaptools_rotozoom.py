@@ -0,0 +1,41 @@
+import bitmaptools
+import math
+from displayio import Bitmap
+
+
+def show(bmp):
+    for y in range(bmp.height):
+        print("".join("%x" % bmp[x, y] for x in range(bmp.width)))
+    print()
+
+
+src = Bitmap(6, 4, 16)
+for y in range(src.height):
+    for x in range(src.width):
+        src[x, y] = 1 + x + y * 3 % 9
+
+for angle, scale in ((0, 1), (0, 2), (0, 0.5), (math.pi, 1), (0.4, 1.5)):
+    print(angle, scale)
+    dest = Bitmap(14, 10, 16)
+    bitmaptools.rotozoom(dest, src, angle=angle, scale=scale)
+    show(dest)
+
+# Clipped on both sides, with a skipped index.
+dest = Bitmap(14, 10, 16)
+dest.fill(15)
+bitmaptools.rotozoom(
+    dest,
+    src,
+    ox=3,
+    oy=2,
+    px=3,
+    py=2,
+    angle=0,
+    scale=2,
+    source_clip0=(1, 1),
+    source_clip1=(5, 4),
+    dest_clip0=(0, 0),
+    dest_clip1=(12, 9),
+    skip_index=4,
+)
+show(dest)
@@ -0,0 +1,57 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+try:
+    import bitops
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+import array
+
+
+def reference(elements, bits, plane_stride):
+    out = bytearray((bits - 1) * plane_stride + len(elements) // 8)
+    for p in range(bits):
+        for i, e in enumerate(elements):
+            if e >> (bits - 1 - p) & 1:
+                out[p * plane_stride + i // 8] |= 0x80 >> (i % 8)
+    return out
+
+
+def check(typecode, bits, values, plane_stride=None):
+    elements = array.array(typecode, values)
+    stride = len(elements) // 8 if plane_stride is None else plane_stride
+    expected = reference(elements, bits, stride)
+    out = bytearray(len(expected))
+    if plane_stride is None:
+        result = bitops.bit_planes(elements, out)
+    else:
+        result = bitops.bit_planes(elements, out, plane_stride=plane_stride)
+    print(typecode, result is out, out == expected)
+
+
+check("B", 8, [0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01])
+check("B", 8, [(i * 37 + 11) & 0xFF for i in range(32)])
+# RGB565: red MSB ends up in plane 0, blue LSB in plane 15.
+rgb565 = [0xF800, 0x07E0, 0x001F, 0xFFFF, 0x0000, 0x8001, 0x1234, 0xFEDC] * 2
+check("H", 16, rgb565)
+check("H", 16, rgb565, plane_stride=5)
+check("I", 32, [(i * 0x9E3779B1) & 0xFFFFFFFF for i in range(16)])
+
+out = bytearray(16)
+bitops.bit_planes(array.array("H", [0xF800] * 8), out)
+print(list(out))
+
+try:
+    bitops.bit_planes(bytearray(7), bytearray(7))
+except ValueError as e:
+    print(e)
+
+try:
+    bitops.bit_planes(bytearray(8), bytearray(7))
+except ValueError as e:
+    print(e)
+
+try:
+    bitops.bit_planes(bytearray(16), bytearray(16), plane_stride=1)
+except ValueError as e:
+    print(e)
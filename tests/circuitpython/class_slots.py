@@ -0,0 +1,124 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+
+# Test __slots__ on classes.
+
+
+class Point:
+    __slots__ = ("x", "y")
+
+    def __init__(self, x, y):
+        self.x = x
+        self.y = y
+
+    def length2(self):
+        return self.x * self.x + self.y * self.y
+
+
+p = Point(3, 4)
+print(p.x, p.y, p.length2())
+p.x = 5
+print(p.x)
+
+try:
+    p.z = 1
+except AttributeError:
+    print("AttributeError")
+
+# a slot that hasn't been set yet
+try:
+    Point.__new__(Point).x
+except AttributeError:
+    print("AttributeError")
+
+# deleting a slot and setting it again
+del p.y
+try:
+    p.y
+except AttributeError:
+    print("AttributeError")
+p.y = 7
+print(p.y)
+
+
+# slots of a base class are inherited
+class Point3(Point):
+    __slots__ = ("z",)
+
+    def __init__(self, x, y, z):
+        super().__init__(x, y)
+        self.z = z
+
+
+q = Point3(1, 2, 3)
+print(q.x, q.y, q.z)
+try:
+    q.w = 1
+except AttributeError:
+    print("AttributeError")
+print(isinstance(q, Point))
+
+
+# a subclass without __slots__ isn't restricted
+class Free(Point):
+    pass
+
+
+f = Free(1, 2)
+f.other = 3
+print(f.other)
+
+
+# a single string names one slot
+class One:
+    __slots__ = "value"
+
+
+o = One()
+o.value = 10
+print(o.value)
+try:
+    o.other = 1
+except AttributeError:
+    print("AttributeError")
+
+
+# a __dict__ slot allows any attribute
+class WithDict:
+    __slots__ = ("a", "__dict__")
+
+
+w = WithDict()
+w.a = 1
+w.b = 2
+print(w.a, w.b)
+
+
+# properties and methods still work with slots
+class Temperature:
+    __slots__ = ["_celsius"]
+
+    def __init__(self, celsius):
+        self._celsius = celsius
+
+    @property
+    def fahrenheit(self):
+        return self._celsius * 9 // 5 + 32
+
+    @fahrenheit.setter
+    def fahrenheit(self, value):
+        self._celsius = (value - 32) * 5 // 9
+
+
+t = Temperature(100)
+print(t.fahrenheit)
+t.fahrenheit = 32
+print(t._celsius)
+
+# slot names must be strings
+try:
+
+    class Bad:
+        __slots__ = (1,)
+
+except TypeError:
+    print("TypeError")
@@ -0,0 +1,49 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+
+# Test constant folding of float and str expressions, and of constant conditional expressions.
+# Folded results must match what the same expressions give at runtime.
+
+try:
+    float
+except NameError:
+    print("SKIP")
+    raise SystemExit
+
+from micropython import const
+
+HALF = 1 / 2
+SCALE = 1.5 * 4
+NEG = -0.25
+PREFIX = const("sensor_")
+NAME = PREFIX + "temperature"
+
+one = 1
+two = 2
+print(HALF, one / two)
+print(SCALE, 1.5 * 4)
+print(NEG, -(0.25))
+print(1 + 2.5 - 0.5, 3 * 0.5, 10 / 4, 2.0 * 3)
+print(0.1 + 0.2, 1 / 3)
+print(-1.5, +2.5, -(1.0 + 1))
+print(NAME, len(NAME))
+print("a" + "b" + "c")
+print("x" * 40 + "y" + "z" * 40 == ("x" * 40) + "yz" * 1 + "z" * 39)
+
+# division by zero and other errors still happen at runtime
+try:
+    1.0 / 0
+except ZeroDivisionError:
+    print("ZeroDivisionError")
+try:
+    "a" + 1
+except TypeError:
+    print("TypeError")
+try:
+    "a" - "b"
+except TypeError:
+    print("TypeError")
+
+# conditional expressions with constant conditions
+print(1 if True else 2, 1 if False else 2)
+print(1 if const(1) else 2, (lambda: 3) if False else 4)
+print([x for x in range(3)] if 1 else None)
@@ -0,0 +1,60 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+
+# Test the ring buffer operations of collections.deque.
+
+try:
+    from collections import deque
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+d = deque((), 5)
+print(d.maxlen)
+
+# bulk extend with wraparound
+d.extend([1, 2, 3])
+d.popleft()
+d.popleft()
+d.extend((4, 5, 6))
+print(list(d), len(d))
+
+# bulk extend that overflows keeps the last items
+d.extend([7, 8])
+print(list(d), d[0], d[-1])
+d.extend(list(range(20)))
+print(list(d), len(d))
+d.extend(range(100, 103))
+print(list(d))
+
+# indexing across the end of the ring
+d = deque((), 4)
+for i in range(6):
+    d.append(i)
+print([d[i] for i in range(len(d))], [d[-i] for i in range(1, len(d) + 1)])
+d[3] = 99
+print(list(d))
+
+# extendleft
+d = deque([1, 2], 5)
+d.extendleft([3, 4, 5, 6])
+print(list(d))
+
+# rotate
+d = deque(range(6), 8)
+d.rotate()
+print(list(d))
+d.rotate(2)
+print(list(d))
+d.rotate(-3)
+print(list(d))
+d.rotate(5)
+print(list(d))
+d.rotate(-13)
+print(list(d))
+deque((), 3).rotate(4)
+
+# clear
+d.clear()
+print(list(d), len(d), bool(d))
+d.append(1)
+print(list(d))
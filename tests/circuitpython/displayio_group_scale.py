@@ -0,0 +1,88 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+try:
+    from displayio import Bitmap, ColorConverter, Group, HeadlessDisplay, Palette, TileGrid
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+# A scaled group must look exactly like the same picture upscaled by hand.
+W = 7
+H = 5
+
+palette = Palette(4)
+for i, color in enumerate((0x000000, 0xFF0000, 0x00FF00, 0x0000FF)):
+    palette[i] = color
+palette.make_transparent(3)
+
+indexed = Bitmap(W, H, 4)
+rgb = Bitmap(W, H, 65536)
+for y in range(H):
+    for x in range(W):
+        indexed[x, y] = (x * 3 + y) % 4
+        rgb[x, y] = (x * 0x0843 + y * 0x1100) & 0xFFFF
+
+display = HeadlessDisplay(48, 32)
+background = Bitmap(48, 32, 1)
+background_palette = Palette(1)
+background_palette[0] = 0x202020
+
+
+def render(grid, scale):
+    root = Group()
+    root.append(TileGrid(background, pixel_shader=background_palette))
+    group = Group(scale=scale, x=3, y=2)
+    group.append(grid)
+    root.append(group)
+    display.root_group = root
+    display.refresh()
+    return bytes(display.framebuffer)
+
+
+def upscaled(source, scale):
+    big = Bitmap(source.width * scale, source.height * scale, 65536)
+    for y in range(big.height):
+        for x in range(big.width):
+            big[x, y] = source[x // scale, y // scale]
+    return big
+
+
+def grid_for(source, shader, **kwargs):
+    grid = TileGrid(source, pixel_shader=shader)
+    for name, value in kwargs.items():
+        setattr(grid, name, value)
+    return grid
+
+
+def check(source, shader, scale, **kwargs):
+    scaled = render(grid_for(source, shader, **kwargs), scale)
+    reference = render(grid_for(upscaled(source, scale), shader, **kwargs), 1)
+    return scaled == reference
+
+
+converter = ColorConverter()
+for scale in (1, 2, 3):
+    print(scale, check(rgb, converter, scale), check(indexed, palette, scale))
+
+print(check(rgb, converter, 2, flip_x=True))
+print(check(rgb, converter, 3, transpose_xy=True))
+print(check(indexed, palette, 2, flip_y=True))
+
+# Redrawing only a changed pixel matches a full render.
+grid = TileGrid(rgb, pixel_shader=converter)
+render(grid, 3)
+rgb[2, 1] = 0xFFFF
+display.refresh()
+partial = bytes(display.framebuffer)
+print(partial == render(TileGrid(upscaled(rgb, 3), pixel_shader=converter), 1))
+
+# Dithering follows the bitmap pixel so every display pixel of a block matches.
+dither = ColorConverter(dither=True)
+frame = render(TileGrid(rgb, pixel_shader=dither), 3)
+blocks_match = True
+for y in range(H * 3):
+    for x in range(W * 3):
+        here = ((2 + y) * 48 + 3 + x) * 2
+        corner = ((2 + y - y % 3) * 48 + 3 + x - x % 3) * 2
+        if frame[here : here + 2] != frame[corner : corner + 2]:
+            blocks_match = False
+print(blocks_match)
@@ -0,0 +1,93 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+
+try:
+    from displayio import Bitmap, Group, HeadlessDisplay, Palette, TileGrid
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+import vectorio
+
+
+def stats(display):
+    print(display.refresh_count, display.pixels_shaded, display.bytes_sent)
+    display.reset_stats()
+
+
+def checksum(display):
+    fb = display.framebuffer
+    total = 0
+    for i in range(len(fb)):
+        total = (total * 31 + fb[i]) & 0xFFFFFF
+    return total
+
+
+palette = Palette(3)
+palette[0] = 0x000000
+palette[1] = 0xFF0000
+palette[2] = 0x00FF00
+
+display = HeadlessDisplay(64, 32)
+print(display.width, display.height, len(display.framebuffer))
+
+group = Group()
+display.root_group = group
+bitmap = Bitmap(16, 16, 3)
+bitmap.fill(1)
+tile = TileGrid(bitmap, pixel_shader=palette, x=4, y=4)
+group.append(tile)
+
+# Setting the root group redraws everything.
+display.refresh()
+stats(display)
+fb = display.framebuffer
+print(hex(fb[0] | fb[1] << 8), hex(fb[(4 * 64 + 4) * 2] | fb[(4 * 64 + 4) * 2 + 1] << 8))
+
+# Nothing changed.
+display.refresh()
+stats(display)
+
+# A single pixel.
+bitmap[3, 3] = 2
+display.refresh()
+stats(display)
+
+# Moving a layer redraws where it was and where it is.
+tile.x = 40
+display.refresh()
+stats(display)
+
+circle = vectorio.Circle(pixel_shader=palette, radius=5, x=20, y=20, color_index=2)
+group.append(circle)
+display.refresh()
+stats(display)
+print(hex(checksum(display)))
+
+# A second display can't share the group until the first lets go of it.
+other = HeadlessDisplay(8, 8, color_depth=1)
+try:
+    other.root_group = group
+except ValueError as e:
+    print("ValueError", e)
+display.root_group = None
+display.refresh()
+stats(display)
+print(max(display.framebuffer))
+
+other.root_group = group
+other.refresh()
+stats(other)
+print(list(other.framebuffer))
+
+for depth in (2, 4, 8, 24, 32):
+    d = HeadlessDisplay(10, 3, color_depth=depth)
+    g = Group()
+    g.append(TileGrid(bitmap, pixel_shader=palette))
+    d.root_group = g
+    d.refresh()
+    print(depth, len(d.framebuffer), d.pixels_shaded, d.bytes_sent, hex(checksum(d)))
+
+try:
+    HeadlessDisplay(8, 8, color_depth=3)
+except ValueError as e:
+    print("ValueError", e)
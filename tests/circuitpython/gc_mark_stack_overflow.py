@@ -0,0 +1,56 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+
+# Data that overflows the GC mark stack must survive collection, whether it's
+# marked on a borrowed stack or by rescanning the heap.
+import gc
+
+
+def make_tree(depth, width):
+    if depth == 0:
+        return [bytearray(8) for _ in range(width)]
+    return [make_tree(depth - 1, width) for _ in range(width)]
+
+
+def count(node):
+    if isinstance(node, bytearray):
+        return 1
+    return sum(count(child) for child in node)
+
+
+# Many siblings pending at once.
+wide = [[i] for i in range(1000)]
+
+# A deep chain where every node also holds a fresh object.
+chain = None
+for i in range(500):
+    chain = (chain, [i])
+
+tree = make_tree(3, 6)
+
+for _ in range(3):
+    gc.collect()
+    # Reuse the freed memory so that anything wrongly freed gets overwritten.
+    junk = [bytearray(16) for _ in range(200)]
+    del junk
+
+print(sum(x[0] for x in wide))
+n = 0
+total = 0
+while chain is not None:
+    chain, item = chain
+    total += item[0]
+    n += 1
+print(n, total)
+print(count(tree))
+
+# Nearly full heap: little free memory to borrow.
+hog = []
+try:
+    while True:
+        hog.append(bytearray(256))
+except MemoryError:
+    pass
+gc.collect()
+hog = None
+gc.collect()
+print(sum(x[0] for x in wide), count(tree))
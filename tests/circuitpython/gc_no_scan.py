@@ -0,0 +1,39 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+
+# Array data holds no heap pointers, so a value in it that happens to be an
+# object's address mustn't keep the object alive.
+import array
+import gc
+
+
+def make_victim(addresses, size):
+    victim = bytearray(size)
+    addresses[0] = id(victim)
+
+
+def is_freed(typecode):
+    size = 32768
+    addresses = array.array(typecode, [0])
+    gc.collect()
+    before = gc.mem_free()
+    make_victim(addresses, size)
+    # Scrub any copies of the pointer left on the stack.
+    make_victim(array.array(typecode, [0]), 16)
+    gc.collect()
+    return gc.mem_free() > before - size // 2
+
+
+print(is_freed("P"))
+
+# Data of object arrays is still scanned.
+try:
+    objects = array.array("O", [None])
+except ValueError:
+    objects = None
+if objects is not None:
+    objects[0] = [1, 2, 3]
+    gc.collect()
+    [bytearray(16) for _ in range(100)]
+    print(objects[0])
+else:
+    print([1, 2, 3])
@@ -90,3 +90,13 @@ run_test(f"noeol", b"noeol=3")
 
 for content in content_bad:
     run_test("key", content)
+
+# Test more keys than are indexed, repeated keys, and keys that aren't indexed
+content_many = b"".join(b"many%d = %d\n" % (i, i) for i in range(40)) + b"many3 = 33\n"
+for key in ("many0", "many3", "many31", "many32", "many39", "many40", "many 1", ""):
+    run_test(key, content_many)
+
+# Test that a changed file is read again
+run_test("changed", b'changed = "before"\n')
+run_test("changed", b'changed = "after"\n')
+run_test("changed", b'other = "after"\n')
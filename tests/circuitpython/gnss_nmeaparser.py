@@ -0,0 +1,90 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+
+try:
+    import gnss
+
+    gnss.NMEAParser
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+def sentence(body):
+    checksum = 0
+    for c in body:
+        checksum ^= ord(c)
+    return "${}*{:02X}\r\n".format(body, checksum).encode()
+
+
+def show(p):
+    print(
+        p.fix,
+        None if p.latitude is None else round(p.latitude, 5),
+        None if p.longitude is None else round(p.longitude, 5),
+        p.altitude,
+        p.satellites,
+        p.timestamp and tuple(p.timestamp)[:6],
+        p.sentence_count,
+        p.error_count,
+    )
+
+
+p = gnss.NMEAParser()
+show(p)
+
+# No fix yet: time is known but the position isn't
+print(p.feed(sentence("GPGGA,120000.00,,,,,0,00,99.99,,,,,,")))
+show(p)
+
+gga = sentence("GNGGA,123519.00,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,")
+rmc = sentence("GNRMC,123520.00,A,4807.039,N,01131.001,E,0.02,,230324,,,A")
+print(p.feed(gga + rmc))
+show(p)
+
+# Southern and western hemispheres, split across feed() calls
+gll = sentence("GPGLL,3351.486,S,15112.510,W,123521.00,A,A")
+print(p.feed(gll[:10]), p.feed(gll[10:]))
+show(p)
+
+# GSA's 2D mode takes priority over GGA's altitude
+print(p.feed(sentence("GPGSA,A,2,04,05,,,,,,,,,,,2.5,1.3,2.1") + gga))
+show(p)
+
+# Bad checksum, missing checksum, overlong and binary data are counted and dropped
+bad = bytearray(gga)
+bad[10] ^= 1
+print(p.feed(bad))
+print(p.feed(b"$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,\r\n"))
+print(p.feed(b"$GPGGA," + b"1" * 100 + b"\r\n"))
+print(p.feed(b"$GP\xb5\x62GGA\r\n"))
+# Malformed fields leave the fix unchanged
+print(p.feed(sentence("GPGGA,123519,48x7.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,")))
+show(p)
+
+# Unknown and proprietary sentences are ignored without being errors
+print(p.feed(sentence("GPGSV,3,1,11,03,03,111,00") + sentence("PUBX,00,123519.00")))
+show(p)
+
+# Loss of fix
+print(p.feed(sentence("GPRMC,123522.00,V,,,,,,,230324,,,N")))
+show(p)
+
+p.reset()
+show(p)
+
+# Sentence filter
+p = gnss.NMEAParser(sentences=("RMC",))
+print(p.feed(gga + rmc))
+show(p)
+
+try:
+    gnss.NMEAParser(sentences=("XYZ",))
+except ValueError as e:
+    print("ValueError")
+
+try:
+    gnss.NMEAParser(1)
+except OSError as e:
+    print("OSError")
+
+print(gnss.NMEAParser().update())
@@ -0,0 +1,58 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+
+# Test heapq.PriorityQueue.
+
+try:
+    from heapq import PriorityQueue
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+q = PriorityQueue()
+print(len(q), bool(q))
+
+for priority, item in ((5, "e"), (1, "a"), (3, "c"), (2, "b"), (4, "d")):
+    q.push(priority, item)
+print(len(q), bool(q), q.peek(), q.peek_priority())
+print([q.pop() for _ in range(len(q))])
+
+# equal priorities come out in the order they were pushed, and the items
+# are never compared
+q = PriorityQueue(4)
+for i in range(10):
+    q.push(i % 3, [i])
+print([q.pop() for _ in range(len(q))])
+
+# float, negative and mixed priorities
+q.push(1.5, "x")
+q.push(-2, "y")
+q.push(0.25, "z")
+q.push(10**30, "big")
+q.push(-(10**30), "small")
+while q:
+    print(q.peek_priority(), q.pop())
+
+# many items
+import random
+
+q = PriorityQueue()
+values = [random.getrandbits(16) for _ in range(200)]
+for v in values:
+    q.push(v, v)
+out = [q.pop() for _ in range(len(q))]
+print(out == sorted(values))
+
+q.push(1, "a")
+q.clear()
+print(len(q))
+
+for f in (q.pop, q.peek, q.peek_priority):
+    try:
+        f()
+    except IndexError:
+        print("IndexError")
+
+try:
+    PriorityQueue(-1)
+except ValueError:
+    print("ValueError")
@@ -127,6 +127,9 @@ test(content, scale=3, x=8, y=12)
 test(content, scale=3, x1=8, y1=12)
 test(content, scale=3, x2=16, y2=16)
 test(content, scale=3, x=12, y=16, x1=8, y1=12, x2=16, y2=16)
+test(content, scale=0, x1=100, y1=90, x2=180, y2=150)
+test(content, scale=0, x=200, y=210, x1=30, y1=40)
+test(content, scale=1, x=10, y=20, x1=50, y1=60, x2=70, y2=100)
 
 print("color key")
 test(content, scale=0, skip_source_index=0x4529, fill=0)
@@ -0,0 +1,53 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+
+# Test random.fill.
+
+import random
+
+try:
+    random.fill
+    from array import array
+except (AttributeError, ImportError):
+    print("SKIP")
+    raise SystemExit
+
+random.seed(1)
+
+# integer ranges
+for typecode, lo, hi in (("b", -3, 3), ("B", 10, 20), ("h", -10, 10), ("H", 0, 1), ("i", 5, 6), ("I", 0, 7)):
+    a = array(typecode, [0] * 400)
+    random.fill(a, lo, hi)
+    print(typecode, min(a) >= lo, max(a) < hi, len(set(a)) == hi - lo)
+
+# only lo given, and the whole range of the type
+b = bytearray(1000)
+random.fill(b, 250)
+print(min(b) >= 250, len(set(b)) == 6)
+random.fill(b)
+print(len(set(b)) > 200)
+a = array("h", [0] * 1000)
+random.fill(a)
+print(min(a) < -10000, max(a) > 10000)
+
+# floats
+a = array("f", [0] * 1000)
+random.fill(a)
+print(min(a) >= 0, max(a) < 1, max(a) - min(a) > 0.9)
+random.fill(a, -5, 5)
+print(min(a) >= -5, max(a) < 5, min(a) < -4, max(a) > 4)
+
+# a memoryview fills the underlying buffer
+b = bytearray(10)
+random.fill(memoryview(b)[2:4], 1, 2)
+print(list(b))
+
+# bad arguments
+for args in ((bytearray(4), 256), (bytearray(4), -1), (bytearray(4), 5, 5), (array("b", [0]), 0, 200)):
+    try:
+        random.fill(*args)
+    except ValueError:
+        print("ValueError")
+try:
+    random.fill(b"read only")
+except TypeError:
+    print("TypeError")
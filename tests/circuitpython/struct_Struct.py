@@ -0,0 +1,52 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+import struct
+
+s = struct.Struct("<HbxI2s")
+print(s.format, s.size, s.size == struct.calcsize(s.format))
+
+packed = s.pack(0x1234, -2, 0xDEADBEEF, b"ab")
+print(packed, packed == struct.pack(s.format, 0x1234, -2, 0xDEADBEEF, b"ab"))
+print(s.unpack(packed))
+
+buf = bytearray(12)
+s.pack_into(buf, 2, 1, 2, 3, b"z")
+print(buf)
+print(s.unpack_from(buf, 2))
+print(s.unpack_from(buf, -10))
+
+items = [None] * 4
+s.unpack_from_into(items, buf, 2)
+print(items)
+
+three = struct.Struct(">3B")
+print(three.unpack(b"\x01\x02\x03"))
+
+try:
+    s.unpack(buf)
+except RuntimeError as e:
+    print("RuntimeError")
+
+try:
+    s.unpack_from(buf, 4)
+except RuntimeError as e:
+    print("RuntimeError")
+
+try:
+    s.pack(1, 2)
+except ValueError as e:
+    print("ValueError")
+
+try:
+    s.unpack_from_into([0] * 3, buf)
+except ValueError as e:
+    print("ValueError")
+
+try:
+    s.unpack_from_into((0, 0, 0, 0), buf)
+except TypeError as e:
+    print("TypeError")
+
+try:
+    struct.Struct("<Hz")
+except ValueError as e:
+    print("ValueError")
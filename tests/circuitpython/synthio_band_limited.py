@@ -0,0 +1,50 @@
+import array
+import math
+from audiocore import get_buffer
+from synthio import Note, Synthesizer
+
+saw = array.array("h", [-32000 + i * 250 for i in range(256)])
+
+
+def render(note, blocks=4):
+    synth = Synthesizer(sample_rate=16000)
+    synth.press(note)
+    samples = []
+    for _ in range(blocks):
+        samples.extend(get_buffer(synth)[1])
+    return samples
+
+
+def magnitude(samples, frequency, sample_rate=16000):
+    re = im = 0.0
+    for n, v in enumerate(samples):
+        a = 2 * math.pi * frequency * n / sample_rate
+        re += v * math.cos(a)
+        im += v * math.sin(a)
+    return math.sqrt(re * re + im * im)
+
+
+def aliasing(samples):
+    # The harmonics of a 3kHz saw above 8kHz fold back to these frequencies
+    aliases = sum(magnitude(samples, f) for f in (1000, 2000, 4000, 5000, 7000))
+    return aliases / magnitude(samples, 3000)
+
+
+# A low note plays the waveform itself, so it is unchanged.
+print(render(Note(50, waveform=saw)) == render(Note(50, waveform=saw, band_limited=True)))
+
+# A high note plays a shorter copy, with much less aliasing.
+plain = aliasing(render(Note(3000, waveform=saw)))
+limited = aliasing(render(Note(3000, waveform=saw, band_limited=True)))
+print(plain > 0.5, limited < 0.3)
+
+# The property can be changed after construction, and a looped note uses the waveform itself.
+note = Note(3000, waveform=saw)
+note.band_limited = True
+print(note.band_limited, render(note) == render(Note(3000, waveform=saw, band_limited=True)))
+looped = Note(3000, waveform=saw, waveform_loop_end=128, band_limited=True)
+print(render(looped) == render(Note(3000, waveform=saw, waveform_loop_end=128)))
+
+# A waveform with an odd length has no copies.
+odd = array.array("h", saw[:255])
+print(render(Note(3000, waveform=odd, band_limited=True)) == render(Note(3000, waveform=odd)))
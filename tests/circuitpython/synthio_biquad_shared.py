@@ -0,0 +1,29 @@
+import array
+import random
+from audiocore import get_buffer
+from synthio import Biquad, FilterMode, LFO, Note, Synthesizer
+
+random.seed(43)
+white_noise = array.array("h", [random.randint(-32000, 32000) for i in range(600)])
+
+
+def level(synth):
+    buf = get_buffer(synth)[1]
+    return sum(abs(v) for v in buf) // len(buf)
+
+
+# One filter shared by two notes, with its frequency changed between blocks by
+# assignment and by an LFO.
+synth = Synthesizer(sample_rate=8192)
+b = Biquad(FilterMode.LOW_PASS, 200, Q=0.7)
+synth.press((Note(100, filter=b, waveform=white_noise), Note(150, filter=b, waveform=white_noise)))
+for frequency in (200, 200, 2000, 2000, 50):
+    b.frequency = frequency
+    print(frequency, level(synth))
+
+b.frequency = LFO(array.array("h", [-32767, 32767]), offset=1500, scale=1400, rate=4, once=True)
+for _ in range(6):
+    print("lfo", level(synth))
+
+b.Q = 3
+print("Q", level(synth))
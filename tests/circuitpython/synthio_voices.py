@@ -0,0 +1,53 @@
+import array
+from audiocore import get_buffer
+from synthio import Biquad, FilterMode, LFO, Note, Synthesizer
+
+saw = array.array("h", [-32000 + i * 1000 for i in range(64)])
+
+
+def checksum(synth, blocks=3):
+    total = 0
+    for _ in range(blocks):
+        for i, v in enumerate(get_buffer(synth)[1]):
+            total = (total * 31 + v * (i + 1)) & 0xFFFFFFF
+    return total
+
+
+# Plain, panned, ring modulated, filtered, silent and amplitude-modulated notes
+# mixed together, in mono and stereo.
+for channel_count in (1, 2):
+    synth = Synthesizer(sample_rate=8000, channel_count=channel_count, waveform=saw)
+    silent = Note(330, amplitude=0, ring_frequency=50)
+    notes = (
+        Note(220),
+        Note(440, panning=-0.5, waveform=saw),
+        Note(110, ring_frequency=35, ring_waveform=saw),
+        Note(550, filter=Biquad(FilterMode.LOW_PASS, 800)),
+        silent,
+        Note(660, amplitude=LFO(rate=2)),
+        67,
+    )
+    synth.press(notes)
+    print(channel_count, checksum(synth))
+    # The silent note kept its phase, so it sounds the same as one that played all along
+    silent.amplitude = 0.8
+    print(channel_count, checksum(synth))
+
+# With every voice held, pressing another note steals the oldest one.
+synth = Synthesizer(sample_rate=8000)
+notes = [Note(100 + i * 10) for i in range(synth.max_polyphony)]
+for n in notes:
+    synth.press(n)
+extra = Note(1000)
+synth.press(extra)
+pressed = synth.pressed
+print(len(pressed) == synth.max_polyphony, notes[0] in pressed, notes[1] in pressed, extra in pressed)
+synth.press(Note(1100))
+pressed = synth.pressed
+print(notes[1] in pressed, notes[2] in pressed)
+
+# A released note is reused before any held note is stolen.
+synth.release(notes[5])
+synth.press(Note(1200))
+pressed = synth.pressed
+print(notes[2] in pressed, notes[5] in pressed)
@@ -0,0 +1,83 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+try:
+    from displayio import Bitmap, Group, HeadlessDisplay, Palette, TileGrid
+    from tilepalettemapper import TilePaletteMapper
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+# A 4x3 grid of 4x4 tiles, each a gradient of the three input colors, with
+# every grid location recolored differently.
+TILE = 4
+COLS = 4
+ROWS = 3
+
+palette = Palette(6)
+for i, color in enumerate((0x000000, 0xFF0000, 0x00FF00, 0x0000FF, 0xFFFF00, 0x00FFFF)):
+    palette[i] = color
+palette.make_transparent(5)
+
+source = Bitmap(TILE, TILE, 3)
+for y in range(TILE):
+    for x in range(TILE):
+        source[x, y] = (x + y) % 3
+
+
+def mapping_for(location):
+    return [(location + i) % 6 for i in range(3)]
+
+
+display = HeadlessDisplay(32, 16)
+
+
+def render(root):
+    display.root_group = root
+    display.refresh()
+    return bytes(display.framebuffer)
+
+
+def mapped_group():
+    mapper = TilePaletteMapper(palette, 3, COLS, ROWS)
+    for location in range(COLS * ROWS):
+        mapper[location] = mapping_for(location)
+    grid = TileGrid(source, pixel_shader=mapper, width=COLS, height=ROWS, tile_width=TILE, tile_height=TILE, x=3, y=1)
+    group = Group()
+    group.append(grid)
+    return group, mapper
+
+
+# The same picture drawn from a pre-remapped bitmap through the palette alone.
+def reference_group():
+    remapped = Bitmap(COLS * TILE, ROWS * TILE, 6)
+    for ty in range(ROWS):
+        for tx in range(COLS):
+            mapping = mapping_for(ty * COLS + tx)
+            for y in range(TILE):
+                for x in range(TILE):
+                    remapped[tx * TILE + x, ty * TILE + y] = mapping[source[x, y]]
+    group = Group()
+    group.append(TileGrid(remapped, pixel_shader=palette, x=3, y=1))
+    return group
+
+
+group, mapper = mapped_group()
+expected = render(reference_group())
+print(render(group) == expected)
+
+# Scaled up.
+group.scale = 2
+ref = reference_group()
+ref.scale = 2
+print(render(group) == render(ref))
+
+# Changing a palette color is picked up without touching the mapper.
+group.scale = 1
+palette[1] = 0x123456
+print(render(group) == render(reference_group()))
+
+# Changing one mapping.
+mapper[5] = [4, 4, 4]
+fb = render(group)
+# Location 5 is tile (1, 1), drawn at x=3+4, y=1+4. Yellow is 0xFFE0 in RGB565.
+offset = ((1 + TILE) * 32 + 3 + TILE) * 2
+print(hex(fb[offset] | fb[offset + 1] << 8))
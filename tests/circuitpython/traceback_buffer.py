@@ -0,0 +1,48 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+
+# Tracebacks that were recorded in the traceback buffer must stay intact once
+# the exception is caught, however many exceptions are raised afterwards.
+import io
+import sys
+
+
+def fail(depth):
+    if depth == 0:
+        raise ValueError("deep")
+    fail(depth - 1)
+
+
+def frames(exc):
+    buf = io.StringIO()
+    sys.print_exception(exc, buf)
+    lines = buf.getvalue().split("\n")
+    return sum(1 for line in lines if line.strip().startswith("File")), lines[-2]
+
+
+def catch(depth):
+    try:
+        fail(depth)
+    except ValueError as e:
+        return e
+
+
+shallow = catch(2)
+deep = catch(20)
+
+# Reuse the buffer many times, including exceptions caught by C code.
+for i in range(50):
+    catch(i % 12)
+    hasattr(shallow, "missing")
+
+print(frames(shallow))
+print(frames(deep))
+
+# An exception that reaches the top of a call from C before being caught.
+try:
+    list(map(fail, [3]))
+except ValueError as e:
+    print(frames(e))
+
+# The traceback object is still usable from Python.
+print(deep.__traceback__ is not None)
+print(frames(catch(5)))
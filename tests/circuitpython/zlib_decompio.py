@@ -0,0 +1,42 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+import io
+import zlib
+
+# "hello world " * 50 and some lines, compressed by CPython.
+ZLIB = b'x\x9c\xcbH\xcd\xc9\xc9W(\xcf/\xcaIQ\xc8\x18e\x8f\xb2\xa9\xc4\x06\x00\x86I\xe09'
+GZIP = b'\x1f\x8b\x08\x00\x00\x00\x00\x00\x00\x03\xcbH\xcd\xc9\xc9W(\xcf/\xcaIQ\xc8\x18e\x8f\xb2\xa9\xc4\x06\x00\r.\xad%X\x02\x00\x00'
+RAW = b'\xcbH\xcd\xc9\xc9W(\xcf/\xcaIQ\xc8\x18e\x8f\xb2\xa9\xc4\x06\x00'
+LINES = b'x\x9c\xcb\xc9\xccKU0\xe4\xca\x01QF\\\xa9y)\x000\x8c\x05?'
+expected = b"hello world " * 50
+
+print(zlib.DecompIO(io.BytesIO(ZLIB)).read() == expected)
+print(zlib.DecompIO(io.BytesIO(GZIP), 31).read() == expected)
+print(zlib.DecompIO(io.BytesIO(RAW), -9).read() == expected)
+
+# Read in small pieces.
+d = zlib.DecompIO(io.BytesIO(ZLIB))
+buf = bytearray(7)
+out = b""
+while n := d.readinto(buf):
+    out += buf[:n]
+print(out == expected)
+print(d.read(), d.readinto(buf))
+
+d = zlib.DecompIO(io.BytesIO(LINES))
+print(d.readline(), d.readline(), d.read())
+
+try:
+    zlib.DecompIO(io.BytesIO(b"not compressed"))
+except ValueError as e:
+    print("ValueError", e)
+
+try:
+    zlib.DecompIO(io.BytesIO(RAW), -20)
+except ValueError:
+    print("ValueError wbits")
+
+# Data cut short.
+try:
+    zlib.DecompIO(io.BytesIO(ZLIB[:10])).read()
+except EOFError:
+    print("EOFError")
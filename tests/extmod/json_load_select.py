@@ -0,0 +1,57 @@
+# CIRCUITPY-CHANGE: test json.load(..., select=...)
+try:
+    from io import StringIO
+    import json
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+try:
+    json.loads("1", select=())
+except TypeError:
+    print("SKIP")
+    raise SystemExit
+
+doc = """{
+  "a": {"b": [{"c": 1, "d": [2, 3]}, {"c": "x\\"y"}], "e": null},
+  "f": [true, false, -1.5e3, {"g": "skip me"}],
+  "h": "tail"
+}"""
+
+
+def show(result):
+    print(sorted(result.items()))
+
+
+show(json.loads(doc, select=("a.b[0].c", "h")))
+show(json.loads(doc, select=("a.b[1].c", "a.e", "f[2]")))
+show(json.loads(doc, select=("a.b[0].d", "a.b[0].d[1]")))
+show(json.loads(doc, select=("f[3].g",)))
+show(json.loads(doc, select=("missing", "a.b[5]", "a.b.c")))
+show(json.loads("[1, {\"a\": 2}]", select=("",)))
+show(json.loads("[1, [2, 3]]", select=("[1][0]",)))
+show(json.loads("5", select=("a",)))
+
+# load() from a stream, stopping after the first document
+show(json.load(StringIO(doc + "trailing"), select=("a.e", "h")))
+
+# the document is still checked
+for bad in ('{"a": [1, 2}', '{"a": "unterminated'):
+    try:
+        json.loads(bad, select=("a",))
+    except ValueError:
+        print("ValueError")
+
+# including the values that are skipped
+for bad in ("xyz", "[nul]", "1.2.3", "-", "1e", "truex", "[1, fals]"):
+    try:
+        json.loads('{"a": %s, "b": 3}' % bad, select=("b",))
+    except ValueError:
+        print("ValueError")
+show(json.loads('{"a": [true, false, null, -0.5E+2, 10, 1.], "b": 3}', select=("b",)))
+
+for bad in ("a..b", "a[", "a[x]", "a.", "[-1]"):
+    try:
+        json.loads(doc, select=(bad,))
+    except ValueError:
+        print("ValueError")
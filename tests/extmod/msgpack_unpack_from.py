@@ -0,0 +1,49 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+try:
+    import msgpack
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+# bin is a view of the buffer
+data = bytearray(b"\x00\x00\xc4\x03abc")
+view = msgpack.unpack_from(data, 2)
+print(type(view).__name__, bytes(view))
+data[4] = ord("X")
+print(bytes(view))
+print(bytes(msgpack.unpack_from(memoryview(data)[2:])))
+
+# arrays of numbers become array.array of the smallest type
+print(msgpack.unpack_from(b"\x93\x01\x7f\xff"))
+print(msgpack.unpack_from(b"\x92\x00\xcc\xff"))
+print(msgpack.unpack_from(b"\x92\xd1\xff\x00\xd0\x80"))
+print(msgpack.unpack_from(b"\x91\xce\xff\xff\xff\xff"))
+print(msgpack.unpack_from(b"\x92\xca\x3f\xc0\x00\x00\xca\x40\x20\x00\x00"))
+
+# scalar floats round trip through pack
+import io
+
+for x in (0.5, -2.25, 1e10):
+    b = io.BytesIO()
+    msgpack.pack(x, b)
+    print(b.getvalue(), msgpack.unpack_from(b.getvalue()) == x)
+print(msgpack.unpack_from(b"\xca\x3f\xc0\x00\x00"))
+print(msgpack.unpack_from(b"\xcb\x3f\xf8\x00\x00\x00\x00\x00\x00"))
+
+# anything else is decoded as by unpack
+print(msgpack.unpack_from(b"\x92\x01\xa1a"))
+print(msgpack.unpack_from(b"\x92\x01\xa1a", use_list=False))
+print(msgpack.unpack_from(b"\x90"))
+print(msgpack.unpack_from(b"\x81\xa1a\xc4\x01b")["a"] == b"b")
+print(msgpack.unpack_from(b"\xc7\x02\x05ab", ext_hook=lambda code, data: (code, data)))
+
+for buf in (b"", b"\x92\x01\xcd\x01"):
+    try:
+        msgpack.unpack_from(buf)
+    except (EOFError, ValueError) as e:
+        print(type(e).__name__)
+
+try:
+    msgpack.unpack_from(b"\x01", 2)
+except ValueError:
+    print("ValueError")
@@ -0,0 +1,48 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+# Test matching subjects long enough to use the Pike VM, where it is enabled.
+
+try:
+    import re
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+line = "2024-05-01 12:34:56 WARN [sensor] temperature=23.5 humidity=41 status=ok"
+
+
+def print_groups(m):
+    if m is None:
+        print(None)
+    else:
+        print([m.group(i) for i in range(4)])
+
+
+print_groups(re.match(r"(\d+)-(\d+)-(\d+)", line))
+print_groups(re.search(r"(\w+)=(\d+)\.?(\d*)", line))
+print_groups(re.search(r"\[(\w+)\] (.*)=(.*)", line))
+print_groups(re.search(r"\[(\w+)\] (.*?)=(.*?) ", line))
+print_groups(re.search(r"(ERROR|WARN|INFO) (\[)(s[a-z]+)", line))
+print_groups(re.search(r"(x+)(y)(z)", line))
+print_groups(re.match(r"(2024)(-)(06)", line))
+print_groups(re.search(r"(s\w+)(=)(ok)$", line))
+print_groups(re.search(r"^(\d+)(-)(\d+)", line))
+print_groups(re.search(r"([^ ]+) ([^ ]+) (W[A-Z]+)", line))
+print_groups(re.search(r"(a|ab)(c|bcd)(d*)", "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxabcd"))
+print_groups(re.search(b"(\\w+)(=)(\\w+)", line.encode()))
+
+print(re.compile(" ").split(line))
+print(re.sub(r"(\w+)=", r"<\1>", line))
+print(re.sub(r"\d", "#", line, 5))
+
+# A subject much longer than the backtracking matcher could recurse through
+long_line = "a" * 2000 + "b"
+m = re.match(".*b", long_line)
+print(len(m.group(0)))
+print(re.search("(a+)b", long_line).group(1) == "a" * 2000)
+
+# Reusing module level patterns
+for i in range(10):
+    print(re.match("[a-z]+", "abc%d" % i).group(0), re.match(b"[a-z]+", b"xyz").group(0))
+for i in range(10):
+    print(re.search("(%d)" % (i % 7), "0123456789").group(1), end=" ")
+print()
@@ -0,0 +1,61 @@
+# CIRCUITPY-CHANGE: FAT files poll as not ready while their block device is busy
+import os
+
+try:
+    import select
+
+    os.VfsFat
+    select.poll
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+        self.busy = False
+
+    def readblocks(self, n, buf):
+        buf[:] = self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)]
+        return 0
+
+    def writeblocks(self, n, buf):
+        self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)] = buf
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+        if op == 8:  # MP_BLOCKDEV_IOCTL_BUSY
+            return self.busy
+
+
+try:
+    bdev = RAMBlockDevice(50)
+    os.VfsFat.mkfs(bdev)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+fs = os.VfsFat(bdev)
+f = fs.open("/data.bin", "wb")
+
+poller = select.poll()
+poller.register(f, select.POLLIN | select.POLLOUT)
+print(poller.poll(0) == [(f, select.POLLIN | select.POLLOUT)])
+
+bdev.busy = True
+print(poller.poll(0))
+
+bdev.busy = False
+poller.modify(f, select.POLLOUT)
+print(poller.poll(0) == [(f, select.POLLOUT)])
+
+f.write(b"hello")
+f.close()
+print(fs.open("/data.bin", "rb").read())
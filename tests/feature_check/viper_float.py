@@ -0,0 +1,9 @@
+# check if the viper float type is supported, which needs a VFP unit
+
+
+@micropython.viper
+def f(x: float) -> float:
+    return x
+
+
+print("viper_float")
@@ -0,0 +1,13 @@
+# test constants used by later top-level statements of the same source
+
+exec(
+    """
+from micropython import const
+_A = const(1)
+B = const(_A + 1)
+def f():
+    return _A + B
+print(_A, B, f())
+print("_A" in globals(), "B" in globals())
+"""
+)
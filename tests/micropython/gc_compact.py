@@ -0,0 +1,34 @@
+# test gc.compact() keeps moved buffers intact
+
+import gc
+
+try:
+    gc.compact
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+import array
+
+# Leave holes below some large buffers.
+small = [bytearray(32) for _ in range(64)]
+big = bytearray(range(256)) * 8
+arr = array.array("i", range(300))
+view_owner = bytearray(b"abcd") * 200
+view = memoryview(view_owner)
+small = None
+
+print(isinstance(gc.compact(), int))
+print(big == bytearray(range(256)) * 8)
+print(sum(arr), len(arr))
+arr.append(1)
+print(arr[-2:])
+
+# Buffers also referenced from a memoryview stay put and remain shared.
+view[0] = ord("z")
+print(view_owner[:8], len(view_owner))
+
+# Compacting again with nothing new to move is harmless.
+gc.compact()
+big[0] = 255
+print(big[:4], len(big))
@@ -0,0 +1,27 @@
+# test allocations of mixed sizes in a fragmented heap stay intact across collections
+
+import gc
+
+# fill the heap with objects of different lengths, then drop every other one
+objs = [bytearray([i & 0xFF]) * (1 + (i * 7) % 97) for i in range(200)]
+for i in range(0, len(objs), 2):
+    objs[i] = None
+gc.collect()
+
+# allocate into the holes with a range of sizes
+new = [bytearray([0x80 | (i & 0x7F)]) * (1 + (i * 13) % 211) for i in range(100)]
+gc.collect()
+
+ok = True
+for i in range(1, len(objs), 2):
+    b = objs[i]
+    ok = ok and len(b) == 1 + (i * 7) % 97 and b == bytearray([i & 0xFF]) * len(b)
+for i, b in enumerate(new):
+    ok = ok and len(b) == 1 + (i * 13) % 211 and b == bytearray([0x80 | (i & 0x7F)]) * len(b)
+print(ok)
+
+# free everything and check that a large block can be allocated again
+objs = new = b = None
+gc.collect()
+big = bytearray(4096)
+print(len(big))
@@ -0,0 +1,90 @@
+# Test that imported .py files are cached as compiled code in __pycache__
+
+try:
+    import os, sys
+
+    os.mkdir
+    os.listdir
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+# We need a directory for testing that doesn't already exist.
+temp_dir = "micropy_pycache_dir"
+try:
+    os.stat(temp_dir)
+    print("SKIP")
+    raise SystemExit
+except OSError:
+    pass
+
+os.mkdir(temp_dir)
+sys.path.insert(0, temp_dir)
+
+
+def write(name, data):
+    with open(temp_dir + "/" + name, "w") as f:
+        f.write(data)
+
+
+def load():
+    sys.modules.pop("cached_mod", None)
+    import cached_mod
+
+    return cached_mod
+
+
+def cleanup():
+    sys.path.pop(0)
+    for d in (temp_dir + "/__pycache__", temp_dir):
+        try:
+            for name in os.listdir(d):
+                if name != "__pycache__":
+                    os.remove(d + "/" + name)
+            os.rmdir(d)
+        except OSError:
+            pass
+
+
+write("cached_mod.py", "x = 1\ndef f():\n    return x + 1\n")
+mod = load()
+if "__pycache__" not in os.listdir(temp_dir):
+    cleanup()
+    print("SKIP")
+    raise SystemExit
+
+print(mod.x, mod.f(), mod.__file__)
+print(os.listdir(temp_dir + "/__pycache__"))
+
+# the second import comes from the cache
+mod = load()
+print(mod.x, mod.f(), mod.__file__)
+
+# a source rewritten at once with the same size is recompiled
+write("cached_mod.py", "x = 2\ndef f():\n    return x + 1\n")
+mod = load()
+print(mod.x, mod.f())
+
+# a changed source is recompiled
+write("cached_mod.py", "x = 100\ndef f():\n    return x + 1\n")
+mod = load()
+print(mod.x, mod.f())
+mod = load()
+print(mod.x, mod.f())
+
+# a cache file that doesn't match is ignored and rewritten
+write("__pycache__/cached_mod.mpy", "junk")
+mod = load()
+print(mod.x, mod.f())
+mod = load()
+print(mod.x, mod.f())
+
+# syntax errors aren't hidden by the cache
+write("cached_mod.py", "x = (\n")
+try:
+    load()
+except SyntaxError:
+    print("SyntaxError")
+
+cleanup()
+print(temp_dir in os.listdir())
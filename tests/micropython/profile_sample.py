@@ -0,0 +1,60 @@
+# test the sampling profiler
+
+import micropython
+
+try:
+    import io
+
+    micropython.profile_start
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+def leaf(n):
+    x = 0
+    for i in range(n):
+        x += i * i
+    return x
+
+
+def outer():
+    while True:
+        leaf(1000)
+        if counts()[0]:
+            break
+
+
+def counts():
+    buf = io.StringIO()
+    micropython.profile_dump(buf)
+    lines = buf.getvalue().splitlines()
+    hot = 0
+    for line in lines:
+        stack, n = line.rsplit(" ", 1)
+        if "leaf (" in stack and "outer (" in stack:
+            hot += int(n)
+    return hot, lines
+
+
+# nothing recorded before the first start
+print(counts()[1])
+
+micropython.profile_start()
+outer()
+micropython.profile_stop()
+
+# samples were taken in leaf, called from outer, in folded-stack format
+hot, lines = counts()
+print(hot > 0)
+for line in lines:
+    if "leaf (" in line:
+        frames = line.rsplit(" ", 1)[0].split(";")
+        print(frames[-2].startswith("outer ("), frames[-1].startswith("leaf ("))
+        break
+
+# counts are kept after stopping, and cleared on the next start
+print(counts()[0] == hot)
+micropython.profile_start()
+micropython.profile_stop()
+print(counts()[0])
@@ -0,0 +1,52 @@
+# test the float and ptrf types, only available when emitting for a VFP unit
+
+try:
+    import array
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+@micropython.viper
+def arith(a: float, b: float) -> float:
+    return (a + b) * a - b / float(2)
+
+
+@micropython.viper
+def comp(a: float, b: float) -> int:
+    r = 0
+    if a < b:
+        r |= 1
+    if a > b:
+        r |= 2
+    if a == b:
+        r |= 4
+    if a <= b:
+        r |= 8
+    if a >= b:
+        r |= 16
+    if a != b:
+        r |= 32
+    return r
+
+
+@micropython.viper
+def casts(x: int, y: uint, z) -> int:
+    f = float(x) + float(y) + float(z)
+    return int(-f) + int(uint(f))
+
+
+@micropython.viper
+def scale(buf: ptrf, n: int, k: float) -> float:
+    total = float(0)
+    for i in range(n):
+        buf[i] *= k
+        total += buf[i]
+    return total
+
+
+print(arith(1.5, 2.0), arith(-4.0, 0.5))
+print(comp(1.0, 2.0), comp(2.0, 1.0), comp(1.0, 1.0), comp(1.0, float("nan")))
+print(casts(3, 4, 0.5))
+a = array.array("f", [1.0, 2.5, -0.25])
+print(scale(a, len(a), 2.0), list(a))
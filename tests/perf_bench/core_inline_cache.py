@@ -0,0 +1,56 @@
+# This tests the performance of repeated global, module attribute and instance
+# attribute lookups from the same sites, as in a tight filter update loop.
+
+import math
+
+GAIN = 0.02
+BIAS = 0.5
+
+
+class Filter:
+    def __init__(self):
+        self.angle = 0.0
+        self.rate = 0.0
+        self.alpha = 0.98
+
+    def update(self, gyro, accel):
+        self.rate = gyro - BIAS
+        self.angle = self.alpha * (self.angle + self.rate * GAIN) + (1 - self.alpha) * math.atan2(
+            accel, 1.0
+        )
+        return self.angle
+
+
+def test(niter):
+    f = Filter()
+    total = 0.0
+    for i in range(niter):
+        total += f.update(i % 7 * 0.1, i % 5 * 0.2)
+    return int(total * 1000)
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (100,),
+    (50, 10): (200,),
+    (100, 10): (500,),
+    (500, 10): (2000,),
+    (1000, 10): (5000,),
+    (5000, 10): (20000,),
+}
+
+
+def bm_setup(params):
+    (niter,) = params
+    state = None
+
+    def run():
+        nonlocal state
+        state = test(niter)
+
+    def result():
+        return niter, state
+
+    return run, result
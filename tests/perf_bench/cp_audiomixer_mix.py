@@ -0,0 +1,69 @@
+# This tests the performance of mixing looped samples with audiomixer.Mixer.
+# It needs audiocore.get_buffer, which is only in builds with
+# CIRCUITPY_AUDIOCORE_DEBUG.
+
+try:
+    import array
+    import audiomixer
+    from audiocore import RawSample, get_buffer
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+SAMPLE_RATE = 22050
+
+
+def make_mixer(n_voices):
+    mixer = audiomixer.Mixer(
+        voice_count=n_voices,
+        buffer_size=1024,
+        channel_count=1,
+        bits_per_sample=16,
+        samples_signed=True,
+        sample_rate=SAMPLE_RATE,
+    )
+    for v in range(n_voices):
+        # A square-ish wave with a different period for each voice.
+        period = 20 + v * 7
+        data = array.array(
+            "h", [(8000 if i < period // 2 else -8000) + v * 100 for i in range(period)]
+        )
+        sample = RawSample(data, sample_rate=SAMPLE_RATE)
+        mixer.voice[v].level = 1 / (v + 1)
+        mixer.voice[v].play(sample, loop=True)
+    return mixer
+
+
+def test(niter, mixer):
+    buf = None
+    for _ in range(niter):
+        buf = get_buffer(mixer)[1]
+    return any(buf)
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (16, 2),
+    (50, 10): (32, 2),
+    (100, 10): (64, 4),
+    (500, 10): (256, 4),
+    (1000, 10): (512, 4),
+    (5000, 10): (2048, 4),
+}
+
+
+def bm_setup(params):
+    niter, n_voices = params
+    mixer = make_mixer(n_voices)
+    state = None
+
+    def run():
+        nonlocal state
+        state = test(niter, mixer)
+
+    def result():
+        return niter * n_voices, state
+
+    return run, result
@@ -0,0 +1,83 @@
+# This tests the performance of an 8-voice audiomixer.Mixer in each sample
+# format, with voices at full, partial and zero level.
+# It needs audiocore.get_buffer, which is only in builds with
+# CIRCUITPY_AUDIOCORE_DEBUG.
+
+try:
+    import array
+    import audiomixer
+    from audiocore import RawSample, get_buffer
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+SAMPLE_RATE = 22050
+N_VOICES = 8
+FORMATS = (
+    ("h", 16, True, 2),
+    ("H", 16, False, 2),
+    ("b", 8, True, 2),
+    ("B", 8, False, 1),
+)
+
+
+def make_mixer(typecode, bits, signed, channel_count):
+    mixer = audiomixer.Mixer(
+        voice_count=N_VOICES,
+        buffer_size=1024,
+        channel_count=channel_count,
+        bits_per_sample=bits,
+        samples_signed=signed,
+        sample_rate=SAMPLE_RATE,
+    )
+    amplitude = 1 << (bits - 3)
+    offset = 0 if signed else 1 << (bits - 1)
+    for v in range(N_VOICES):
+        period = (20 + v * 7) * channel_count
+        data = array.array(
+            typecode,
+            [(amplitude if i < period // 2 else -amplitude) + offset for i in range(period)],
+        )
+        sample = RawSample(data, channel_count=channel_count, sample_rate=SAMPLE_RATE)
+        # Full, partial and silent voices each take a different path.
+        mixer.voice[v].level = (1.0, 0.5, 0.0, 0.25)[v % 4]
+        mixer.voice[v].play(sample, loop=True)
+    return mixer
+
+
+def test(niter, mixers):
+    result = []
+    for mixer in mixers:
+        buf = None
+        for _ in range(niter):
+            buf = get_buffer(mixer)[1]
+        result.append(any(buf))
+    return result
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (2,),
+    (50, 10): (4,),
+    (100, 10): (8,),
+    (500, 10): (32,),
+    (1000, 10): (64,),
+    (5000, 10): (256,),
+}
+
+
+def bm_setup(params):
+    (niter,) = params
+    mixers = [make_mixer(*f) for f in FORMATS]
+    state = None
+
+    def run():
+        nonlocal state
+        state = test(niter, mixers)
+
+    def result():
+        return niter * N_VOICES * len(FORMATS), state
+
+    return run, result
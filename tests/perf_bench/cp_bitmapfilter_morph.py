@@ -0,0 +1,95 @@
+# This tests the performance of bitmapfilter.morph, a convolution over an RGB565
+# displayio.Bitmap, with 3x3 and 5x5 kernels.  Some of the filtered pixels are
+# checked against a Python version of the filter.
+
+try:
+    import bitmapfilter
+    from displayio import Bitmap
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+BLUR3 = (1, 2, 1, 2, 4, 2, 1, 2, 1)
+BLUR5 = (1, 4, 6, 4, 1, 4, 16, 24, 16, 4, 6, 24, 36, 24, 6, 4, 16, 24, 16, 4, 1, 4, 6, 4, 1)
+
+
+def make_source(width, height):
+    b = Bitmap(width, height, 65535)
+    for y in range(height):
+        for x in range(width):
+            r = (x * 7 + y) & 31
+            g = (x + y * 5) & 63
+            b_ = (x * y) & 31
+            # Bitmap values hold RGB565 pixels with their bytes swapped.
+            pixel = (r << 11) | (g << 5) | b_
+            b[x, y] = ((pixel & 0xFF) << 8) | (pixel >> 8)
+    return b
+
+
+def copy(dest, source):
+    memoryview(dest)[:] = memoryview(source)
+
+
+def reference_pixel(source, weights, x, y):
+    # Inner pixels only, so there is no edge clamping to model.
+    n = int(len(weights) ** 0.5)
+    k = n // 2
+    acc = [0, 0, 0]
+    for j in range(n):
+        for i in range(n):
+            v = source[x + i - k, y + j - k]
+            pixel = ((v & 0xFF) << 8) | (v >> 8)
+            w = weights[j * n + i]
+            acc[0] += w * (pixel >> 11)
+            acc[1] += w * ((pixel >> 5) & 63)
+            acc[2] += w * (pixel & 31)
+    m = round(65536 / sum(weights))
+    r = min(31, (acc[0] * m) >> 16)
+    g = min(63, (acc[1] * m) >> 16)
+    b = min(31, (acc[2] * m) >> 16)
+    pixel = (r << 11) | (g << 5) | b
+    return ((pixel & 0xFF) << 8) | (pixel >> 8)
+
+
+def test(niter, dest, source, weights):
+    for _ in range(niter):
+        copy(dest, source)
+        bitmapfilter.morph(dest, weights=weights)
+
+
+def check(dest, source, weights):
+    k = int(len(weights) ** 0.5) // 2
+    for y in range(k, source.height - k, 7):
+        for x in range(k, source.width - k, 5):
+            if dest[x, y] != reference_pixel(source, weights, x, y):
+                return False
+    return True
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (1, 32, 24),
+    (50, 10): (1, 64, 48),
+    (100, 10): (1, 160, 120),
+    (500, 10): (2, 320, 240),
+    (1000, 10): (4, 320, 240),
+    (5000, 10): (16, 320, 240),
+}
+
+
+def bm_setup(params):
+    niter, width, height = params
+    source = make_source(width, height)
+    dest = Bitmap(width, height, 65535)
+
+    def run():
+        test(niter, dest, source, BLUR3)
+        test(niter, dest, source, BLUR5)
+
+    def result():
+        # Only the last run, with the 5x5 kernel, is left to check.
+        return niter * 2 * width * height, check(dest, source, BLUR5)
+
+    return run, result
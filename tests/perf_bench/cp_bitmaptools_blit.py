@@ -0,0 +1,85 @@
+# This tests the performance of bitmaptools.blit, as used to draw sprites into
+# a displayio.Bitmap.  The result is checked against a Python version of blit.
+
+try:
+    import bitmaptools
+    from displayio import Bitmap
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+SIZE = 96
+SPRITE = 24
+N_COLORS = 16
+
+
+def make_sprite():
+    sprite = Bitmap(SPRITE, SPRITE, N_COLORS)
+    for y in range(SPRITE):
+        for x in range(SPRITE):
+            # Colour 0 is transparent, so leave a hole in the middle.
+            if abs(x - SPRITE // 2) + abs(y - SPRITE // 2) > 4:
+                sprite[x, y] = (x * 3 + y * 5) % N_COLORS
+    return sprite
+
+
+def positions(n):
+    # Some sprites are clipped by the right and bottom edges of the destination.
+    return [((k * 37) % SIZE, (k * 23) % SIZE) for k in range(n)]
+
+
+def test(niter, dest, sprite, pos):
+    for _ in range(niter):
+        dest.fill(1)
+        for x, y in pos:
+            bitmaptools.blit(dest, sprite, x, y, skip_source_index=0)
+
+
+def reference(sprite, pos):
+    dest = [[1] * SIZE for _ in range(SIZE)]
+    for x0, y0 in pos:
+        for sy in range(SPRITE):
+            for sx in range(SPRITE):
+                x = x0 + sx
+                y = y0 + sy
+                c = sprite[sx, sy]
+                if 0 <= x < SIZE and 0 <= y < SIZE and c != 0:
+                    dest[y][x] = c
+    return dest
+
+
+def check(dest, sprite, pos):
+    expected = reference(sprite, pos)
+    for y in range(SIZE):
+        for x in range(SIZE):
+            if dest[x, y] != expected[y][x]:
+                return False
+    return True
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (2, 8),
+    (50, 10): (4, 8),
+    (100, 10): (10, 16),
+    (500, 10): (40, 16),
+    (1000, 10): (100, 16),
+    (5000, 10): (400, 16),
+}
+
+
+def bm_setup(params):
+    niter, n_sprites = params
+    dest = Bitmap(SIZE, SIZE, N_COLORS)
+    sprite = make_sprite()
+    pos = positions(n_sprites)
+
+    def run():
+        test(niter, dest, sprite, pos)
+
+    def result():
+        return niter * n_sprites, check(dest, sprite, pos)
+
+    return run, result
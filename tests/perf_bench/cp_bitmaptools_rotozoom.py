@@ -0,0 +1,62 @@
+# This tests the performance of bitmaptools.rotozoom, as used to draw a rotated
+# and scaled image into a displayio.Bitmap.
+
+try:
+    import bitmaptools
+    from displayio import Bitmap
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+SIZE = 96
+SOURCE = 32
+N_COLORS = 16
+
+
+def make_source():
+    source = Bitmap(SOURCE, SOURCE, N_COLORS)
+    for y in range(SOURCE):
+        for x in range(SOURCE):
+            source[x, y] = (x // 4 + y // 4 * 3) % N_COLORS
+    return source
+
+
+def test(niter, dest, source):
+    for i in range(niter):
+        dest.fill(0)
+        for k in range(4):
+            bitmaptools.rotozoom(
+                dest,
+                source,
+                ox=SIZE // 4 + k % 2 * SIZE // 2,
+                oy=SIZE // 4 + k // 2 * SIZE // 2,
+                angle=0.1 * (i % 32) + 0.7 * k,
+                scale=0.75 + 0.25 * k,
+                skip_index=0,
+            )
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (2,),
+    (50, 10): (4,),
+    (100, 10): (10,),
+    (500, 10): (40,),
+    (1000, 10): (100,),
+    (5000, 10): (400,),
+}
+
+
+def bm_setup(params):
+    (niter,) = params
+    dest = Bitmap(SIZE, SIZE, N_COLORS)
+    source = make_source()
+
+    def run():
+        test(niter, dest, source)
+
+    # The pixels depend on how the target rounds floats, so leave the result
+    # unchecked.
+    return run, lambda: (niter * 4, None)
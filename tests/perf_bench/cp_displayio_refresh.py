@@ -0,0 +1,102 @@
+# This tests the performance of refreshing a display that shows a displayio
+# Group of TileGrids, as in a game that moves sprites over a tiled background.
+# It draws over the board's built-in display, and is skipped if there isn't
+# one.
+
+try:
+    import board
+    import displayio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+display = getattr(board, "DISPLAY", None)
+if display is None:
+    print("SKIP")
+    raise SystemExit
+
+TILE = 16
+N_TILES = 4
+N_COLORS = 8
+
+
+def make_tiles():
+    bitmap = displayio.Bitmap(TILE * N_TILES, TILE, N_COLORS)
+    for t in range(N_TILES):
+        for y in range(TILE):
+            for x in range(TILE):
+                bitmap[t * TILE + x, y] = (t + x // 4 + y // 4) % N_COLORS
+    palette = displayio.Palette(N_COLORS)
+    for i in range(N_COLORS):
+        palette[i] = (i * 0x24) << 16 | (255 - i * 0x24) << 8 | (i * 0x13)
+    return bitmap, palette
+
+
+def make_group(n_sprites):
+    bitmap, palette = make_tiles()
+    cols = display.width // TILE
+    rows = display.height // TILE
+    background = displayio.TileGrid(
+        bitmap, pixel_shader=palette, width=cols, height=rows, tile_width=TILE, tile_height=TILE
+    )
+    for y in range(rows):
+        for x in range(cols):
+            background[x, y] = (x + y) % N_TILES
+    group = displayio.Group()
+    group.append(background)
+    sprites = []
+    for i in range(n_sprites):
+        sprite = displayio.TileGrid(
+            bitmap,
+            pixel_shader=palette,
+            tile_width=TILE,
+            tile_height=TILE,
+            default_tile=i % N_TILES,
+        )
+        sprites.append(sprite)
+        group.append(sprite)
+    return group, background, sprites
+
+
+def test(niter, group, background, sprites):
+    cols = background.width
+    rows = background.height
+    max_x = display.width - TILE
+    max_y = display.height - TILE
+    old_group = display.root_group
+    old_auto_refresh = display.auto_refresh
+    display.auto_refresh = False
+    display.root_group = group
+    try:
+        for i in range(niter):
+            for k, sprite in enumerate(sprites):
+                sprite.x = (i * (k + 1) * 3) % max_x
+                sprite.y = (i * 2 + k * 11) % max_y
+            background[i % cols, i // cols % rows] = i % N_TILES
+            display.refresh()
+    finally:
+        display.root_group = old_group
+        display.auto_refresh = old_auto_refresh
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (5, 2),
+    (50, 10): (10, 4),
+    (100, 10): (20, 8),
+    (500, 10): (50, 8),
+    (1000, 10): (100, 8),
+}
+
+
+def bm_setup(params):
+    niter, n_sprites = params
+    group, background, sprites = make_group(n_sprites)
+
+    def run():
+        test(niter, group, background, sprites)
+
+    # The output is on the display, so there is no result to check.
+    return run, lambda: (niter, None)
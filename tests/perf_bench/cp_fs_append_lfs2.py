@@ -0,0 +1,79 @@
+# This tests the performance of appending records to a log file and flushing
+# after each one, on littlefs. cp_fs_append_fat.py does the same on FAT.
+# The result is how many bytes reached the block device, which is what wears
+# out flash.
+
+try:
+    import storage as vfs
+except ImportError:
+    try:
+        import vfs
+    except ImportError:
+        import os as vfs
+
+if not hasattr(vfs, "VfsLfs2"):
+    print("SKIP")
+    raise SystemExit
+
+BLOCK_SIZE = 512
+BLOCK_COUNT = 256
+RECORD = b"00001234,21.50,40.25,1013.2\n"
+
+
+class RAMBlockDevice:
+    def __init__(self):
+        self.data = bytearray(BLOCK_SIZE * BLOCK_COUNT)
+        self.bytes_written = 0
+
+    def readblocks(self, block, buf, off=0):
+        addr = block * BLOCK_SIZE + off
+        buf[:] = memoryview(self.data)[addr : addr + len(buf)]
+
+    def writeblocks(self, block, buf, off=0):
+        addr = block * BLOCK_SIZE + off
+        self.data[addr : addr + len(buf)] = buf
+        self.bytes_written += len(buf)
+
+    def ioctl(self, op, arg):
+        if op == 4:  # block count
+            return BLOCK_COUNT
+        if op == 5:  # block size
+            return BLOCK_SIZE
+        if op == 6:  # erase block
+            return 0
+
+
+def test(fs, n_records):
+    with fs.open("/log.csv", "w") as f:
+        for _ in range(n_records):
+            f.write(RECORD)
+            f.flush()
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (20,),
+    (50, 10): (40,),
+    (100, 10): (100,),
+    (500, 10): (400,),
+    (1000, 10): (1000,),
+    (5000, 10): (2000,),
+}
+
+
+def bm_setup(params):
+    (n_records,) = params
+    bdev = RAMBlockDevice()
+    vfs.VfsLfs2.mkfs(bdev)
+    fs = vfs.VfsLfs2(bdev)
+    bdev.bytes_written = 0
+
+    def run():
+        test(fs, n_records)
+
+    def result():
+        return n_records, bdev.bytes_written
+
+    return run, result
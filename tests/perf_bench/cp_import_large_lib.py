@@ -0,0 +1,140 @@
+# This tests the performance of importing a large driver library from .py
+# source, which is how most CircuitPython libraries are used during development.
+# The source is served from a read-only filesystem, so nothing is cached.
+
+import sys, io
+
+try:
+    import storage as vfs
+except ImportError:
+    try:
+        import vfs
+    except ImportError:
+        import os as vfs
+
+if not hasattr(vfs, "mount") or not hasattr(io, "IOBase"):
+    print("SKIP")
+    raise SystemExit
+
+N_REGISTERS = 48
+
+
+def make_source():
+    lines = [
+        '"""Driver for a made-up I2C sensor with many registers."""',
+        "from micropython import const",
+        "",
+    ]
+    for i in range(N_REGISTERS):
+        lines.append("_REG_%d = const(0x%02x)" % (i, i))
+    lines += [
+        "",
+        "REGISTERS = {",
+    ]
+    for i in range(N_REGISTERS):
+        lines.append('    "reg%d": _REG_%d,' % (i, i))
+    lines += [
+        "}",
+        "",
+        "",
+        "class Sensor:",
+        "    def __init__(self, i2c, address=0x42):",
+        "        self._i2c = i2c",
+        "        self._address = address",
+        "        self._buf = bytearray(2)",
+        "",
+        "    def _read(self, reg):",
+        "        self._buf[0] = reg",
+        "        return self._buf[1]",
+        "",
+        "    def _write(self, reg, value):",
+        "        self._buf[0] = reg",
+        "        self._buf[1] = value & 0xFF",
+        "",
+    ]
+    for i in range(N_REGISTERS):
+        lines += [
+            "    @property",
+            "    def reg%d(self):" % i,
+            '        """The value of register %d."""' % i,
+            "        return self._read(_REG_%d)" % i,
+            "",
+            "    @reg%d.setter" % i,
+            "    def reg%d(self, value):" % i,
+            "        if not 0 <= value <= 255:",
+            '            raise ValueError("reg%d must be a byte")' % i,
+            "        self._write(_REG_%d, value)" % i,
+            "",
+        ]
+    lines.append("result = len(REGISTERS) + len([n for n in dir(Sensor) if n.startswith('reg')])")
+    return "\n".join(lines).encode()
+
+
+file_data = make_source()
+
+
+class File(io.IOBase):
+    def __init__(self):
+        self.off = 0
+
+    def ioctl(self, request, arg):
+        return 0
+
+    def readinto(self, buf):
+        buf[:] = memoryview(file_data)[self.off : self.off + len(buf)]
+        self.off += len(buf)
+        return len(buf)
+
+
+class FS:
+    def mount(self, readonly, mkfs):
+        pass
+
+    def chdir(self, path):
+        pass
+
+    def stat(self, path):
+        if path == "/__injected_lib.py":
+            return (0x8000, 0, 0, 0, 0, 0, len(file_data), 0, 0, 0)
+        else:
+            raise OSError(-2)  # ENOENT
+
+    def mkdir(self, path):
+        raise OSError(30)  # EROFS
+
+    def open(self, path, mode):
+        if "w" in mode:
+            raise OSError(30)  # EROFS
+        return File()
+
+
+def mount():
+    vfs.mount(FS(), "/__remote")
+    sys.path.insert(0, "/__remote")
+
+
+def test(niter):
+    global result
+    for _ in range(niter):
+        sys.modules.pop("__injected_lib", None)
+        module = __import__("__injected_lib")
+    result = module.result
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (1,),
+    (50, 10): (2,),
+    (100, 10): (4,),
+    (500, 10): (10,),
+    (1000, 10): (20,),
+    (5000, 10): (100,),
+}
+
+
+def bm_setup(params):
+    (niter,) = params
+    mount()
+    return lambda: test(niter), lambda: (niter, result)
@@ -0,0 +1,58 @@
+# This tests the performance of encoding and decoding JSON documents like those
+# exchanged with web APIs and kept in settings files.
+
+import json
+
+
+def make_doc(n_readings):
+    return {
+        "device": {"name": "feather-sensor", "id": 4711, "enabled": True, "location": None},
+        "units": ["C", "%", "hPa", "lux"],
+        "readings": [
+            {
+                "t": 1700000000 + i * 60,
+                "temperature": 20.5 + (i % 8) * 0.25,
+                "humidity": 40 + i % 13,
+                "pressure": 1013.5 - (i % 5) * 0.5,
+                "tags": ["ok", "cal"] if i % 3 else ["ok"],
+                "note": 'line "%d"\n' % i,
+            }
+            for i in range(n_readings)
+        ],
+    }
+
+
+def test(niter, doc):
+    same = True
+    for _ in range(niter):
+        text = json.dumps(doc)
+        same = same and json.loads(text) == doc
+    return same
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (20, 4),
+    (50, 10): (40, 4),
+    (100, 10): (50, 10),
+    (500, 10): (200, 10),
+    (1000, 10): (500, 10),
+    (5000, 10): (2000, 10),
+}
+
+
+def bm_setup(params):
+    niter, n_readings = params
+    doc = make_doc(n_readings)
+    state = None
+
+    def run():
+        nonlocal state
+        state = test(niter, doc)
+
+    def result():
+        return niter * n_readings, state
+
+    return run, result
@@ -0,0 +1,64 @@
+# This tests the performance of packing and unpacking msgpack messages, as
+# used for compact messages between boards.
+
+try:
+    import io
+    import msgpack
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+def make_message(n_readings):
+    return {
+        "device": {"name": "feather-sensor", "id": 4711, "enabled": True, "location": None},
+        "units": ["C", "%", "hPa", "lux"],
+        "readings": [
+            {
+                "t": 1700000000 + i * 60,
+                "temperature": 20.5 + (i % 8) * 0.25,
+                "humidity": 40 + i % 13,
+                "raw": bytes(range(i % 8, i % 8 + 8)),
+                "tags": ["ok", "cal"] if i % 3 else ["ok"],
+            }
+            for i in range(n_readings)
+        ],
+    }
+
+
+def test(niter, message):
+    same = True
+    for _ in range(niter):
+        stream = io.BytesIO()
+        msgpack.pack(message, stream)
+        stream.seek(0)
+        same = same and msgpack.unpack(stream) == message
+    return same
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (20, 4),
+    (50, 10): (40, 4),
+    (100, 10): (50, 10),
+    (500, 10): (200, 10),
+    (1000, 10): (500, 10),
+    (5000, 10): (2000, 10),
+}
+
+
+def bm_setup(params):
+    niter, n_readings = params
+    message = make_message(n_readings)
+    state = None
+
+    def run():
+        nonlocal state
+        state = test(niter, message)
+
+    def result():
+        return niter * n_readings, state
+
+    return run, result
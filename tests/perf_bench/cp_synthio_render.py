@@ -0,0 +1,71 @@
+# This tests the performance of rendering synthio voices, with envelopes, a
+# custom waveform and LFOs, into sample buffers.  It needs audiocore.get_buffer,
+# which is only in builds with CIRCUITPY_AUDIOCORE_DEBUG.
+
+try:
+    import array
+    import synthio
+    from audiocore import get_buffer
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+def make_synth(n_notes):
+    # A triangle wave.
+    waveform = array.array(
+        "h", [i * 4096 - 32768 if i < 16 else 32767 - (i - 16) * 4096 for i in range(32)]
+    )
+    envelope = synthio.Envelope(
+        attack_time=0.01, decay_time=0.05, release_time=0.1, attack_level=1, sustain_level=0.6
+    )
+    synth = synthio.Synthesizer(sample_rate=22050, waveform=waveform, envelope=envelope)
+    notes = []
+    for i in range(n_notes):
+        note = synthio.Note(frequency=synthio.midi_to_hz(48 + i * 5))
+        note.bend = synthio.LFO(rate=4 + i, scale=0.02)
+        note.amplitude = synthio.LFO(rate=1 + i, scale=0.2, offset=0.7)
+        notes.append(note)
+    return synth, notes
+
+
+def test(niter, synth, notes):
+    buf = None
+    synth.press(notes)
+    for i in range(niter):
+        buf = get_buffer(synth)[1]
+        if i % 16 == 15:
+            # Retrigger one note, to also run the envelope's attack and release.
+            note = notes[i // 16 % len(notes)]
+            synth.release(note)
+            synth.press(note)
+    synth.release_all()
+    return any(buf)
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (16, 2),
+    (50, 10): (32, 2),
+    (100, 10): (64, 4),
+    (500, 10): (256, 4),
+    (1000, 10): (512, 4),
+    (5000, 10): (2048, 4),
+}
+
+
+def bm_setup(params):
+    niter, n_notes = params
+    synth, notes = make_synth(n_notes)
+    state = None
+
+    def run():
+        nonlocal state
+        state = test(niter, synth, notes)
+
+    def result():
+        return niter * n_notes, state
+
+    return run, result
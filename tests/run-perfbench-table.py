@@ -4,6 +4,7 @@
 # The MIT License (MIT)
 # Copyright (c) 2019 Damien P. George
 
+import csv
 import os
 import subprocess
 import sys
@@ -29,6 +30,19 @@ PYTHON_TRUTH = CPYTHON3
 
 BENCH_SCRIPT_DIR = "perf_bench/"
 
+# Columns of the --csv output, which -t and -s can also read
+CSV_FIELDS = (
+    "test",
+    "N",
+    "M",
+    "time",
+    "time_sd_percent",
+    "score",
+    "score_sd_percent",
+    "runtime",
+    "runtime_sd_percent",
+)
+
 
 def compute_stats(lst):
     avg = 0
@@ -91,6 +105,8 @@ def run_feature_test(target, test):
 def run_benchmark_on_target(target, script, run_command=None):
     output, err, runtime_us = run_script_on_target(target, script, run_command)
     if err is None:
+        if output == "SKIP":
+            return -1, -1, "SKIP", runtime_us
         time, norm, result = output.split(None, 2)
         try:
             return int(time), int(norm), result, runtime_us
@@ -100,7 +116,7 @@ def run_benchmark_on_target(target, script, run_command=None):
         return -1, -1, "CRASH: %r" % err, runtime_us
 
 
-def run_benchmarks(console, target, param_n, param_m, n_average, test_list):
+def run_benchmarks(console, target, param_n, param_m, n_average, test_list, csv_rows):
     skip_complex = run_feature_test(target, "complex") != "complex"
     skip_native = run_feature_test(target, "native_check") != "native"
 
@@ -164,13 +180,22 @@ def run_benchmarks(console, target, param_n, param_m, n_average, test_list):
 
         # Check result against truth if needed
         if error is None and result_out != "None":
-            _, _, result_exp, _ = run_benchmark_on_target(PYTHON_TRUTH, test_script, bm_run)
+            test_file_expected = test_file + ".exp"
+            if os.path.isfile(test_file_expected):
+                # Expected result is given by a file, so read that in
+                with open(test_file_expected) as f:
+                    result_exp = f.read().strip()
+            else:
+                # Run CPython to work out the expected result
+                _, _, result_exp, _ = run_benchmark_on_target(PYTHON_TRUTH, test_script, bm_run)
             if result_out != result_exp:
                 error = "FAIL truth"
 
         if error is not None:
             print(test_file, error)
-            if error == "no matching params":
+            if error.startswith("SKIP"):
+                table.add_row(test_file, *(["skip"] * 3))
+            elif error == "no matching params":
                 table.add_row(test_file, *([None] * 3))
             else:
                 table.add_row(test_file, *(["error"] * 3))
@@ -189,6 +214,19 @@ def run_benchmarks(console, target, param_n, param_m, n_average, test_list):
                 f"{s_avg:.2f}±{100 * s_sd / s_avg:.1f}%",
                 f"{r_avg:.2f}±{100 * r_sd / r_avg:.1f}%",
             )
+            csv_rows.append(
+                (
+                    test_file,
+                    param_n,
+                    param_m,
+                    f"{t_avg:.2f}",
+                    f"{100 * t_sd / t_avg:.4f}",
+                    f"{s_avg:.2f}",
+                    f"{100 * s_sd / s_avg:.4f}",
+                    f"{r_avg:.2f}",
+                    f"{100 * r_sd / r_avg:.4f}",
+                )
+            )
             if 0:
                 print("  times: ", times)
                 print("  scores:", scores)
@@ -197,8 +235,25 @@ def run_benchmarks(console, target, param_n, param_m, n_average, test_list):
     live.stop()
 
 
+def parse_csv_output(f):
+    # Only the time and score columns are compared, so that the output of
+    # run-perfbench.py --csv can be read too
+    n = m = None
+    data = []
+    for row in csv.DictReader(f):
+        n = int(row["N"])
+        m = int(row["M"])
+        data.append((row["test"],) + tuple(float(row[field]) for field in CSV_FIELDS[3:7]))
+    return n, m, data
+
+
 def parse_output(filename):
     with open(filename) as f:
+        # Results written with --csv
+        if f.readline().startswith(CSV_FIELDS[0] + ","):
+            f.seek(0)
+            return parse_csv_output(f)
+        f.seek(0)
         params = f.readline()
         n, m, _ = params.strip().split()
         n = int(n.split("=")[1])
@@ -276,6 +331,7 @@ def main():
     cmd_parser.add_argument(
         "--emit", default="bytecode", help="MicroPython emitter to use (bytecode or native)"
     )
+    cmd_parser.add_argument("--csv", help="also write the results to the given CSV file")
     cmd_parser.add_argument("N", nargs=1, help="N parameter (approximate target CPU frequency)")
     cmd_parser.add_argument("M", nargs=1, help="M parameter (approximate target heap in kbytes)")
     cmd_parser.add_argument("files", nargs="*", help="input test files")
@@ -314,7 +370,14 @@ def main():
     console = Console()
     print("N={} M={} n_average={}".format(N, M, n_average))
 
-    run_benchmarks(console, target, N, M, n_average, tests)
+    csv_rows = []
+    run_benchmarks(console, target, N, M, n_average, tests, csv_rows)
+
+    if args.csv:
+        with open(args.csv, "w", newline="") as f:
+            writer = csv.writer(f)
+            writer.writerow(CSV_FIELDS)
+            writer.writerows(csv_rows)
 
     if isinstance(target, pyboard.Pyboard):
         target.exit_raw_repl()
@@ -4,6 +4,7 @@
 # The MIT License (MIT)
 # Copyright (c) 2019 Damien P. George
 
+import csv
 import os
 import subprocess
 import sys
@@ -29,6 +30,9 @@ PYTHON_TRUTH = CPYTHON3
 
 BENCH_SCRIPT_DIR = "perf_bench/"
 
+# CIRCUITPY-CHANGE: columns of the --csv output, which -t and -s can also read
+CSV_FIELDS = ("test", "N", "M", "time", "time_sd_percent", "score", "score_sd_percent")
+
 
 def compute_stats(lst):
     avg = 0
@@ -89,7 +93,7 @@ def run_benchmark_on_target(target, script):
         return -1, -1, "CRASH: %r" % err
 
 
-def run_benchmarks(args, target, param_n, param_m, n_average, test_list):
+def run_benchmarks(args, target, param_n, param_m, n_average, test_list, csv_rows):
     skip_complex = run_feature_test(target, "complex") != "complex"
     skip_native = run_feature_test(target, "native_check") != "native"
     target_had_error = False
@@ -173,6 +177,18 @@ def run_benchmarks(args, target, param_n, param_m, n_average, test_list):
                     t_avg, 100 * t_sd / t_avg, s_avg, 100 * s_sd / s_avg
                 )
             )
+            # CIRCUITPY-CHANGE
+            csv_rows.append(
+                (
+                    test_file,
+                    param_n,
+                    param_m,
+                    "{:.2f}".format(t_avg),
+                    "{:.4f}".format(100 * t_sd / t_avg),
+                    "{:.2f}".format(s_avg),
+                    "{:.4f}".format(100 * s_sd / s_avg),
+                )
+            )
             if 0:
                 print("  times: ", times)
                 print("  scores:", scores)
@@ -182,8 +198,24 @@ def run_benchmarks(args, target, param_n, param_m, n_average, test_list):
     return target_had_error
 
 
+# CIRCUITPY-CHANGE
+def parse_csv_output(f):
+    n = m = None
+    data = []
+    for row in csv.DictReader(f):
+        n = int(row["N"])
+        m = int(row["M"])
+        data.append((row["test"],) + tuple(float(row[field]) for field in CSV_FIELDS[3:]))
+    return n, m, data
+
+
 def parse_output(filename):
     with open(filename) as f:
+        # CIRCUITPY-CHANGE: also read the output of --csv
+        if f.readline().startswith(CSV_FIELDS[0] + ","):
+            f.seek(0)
+            return parse_csv_output(f)
+        f.seek(0)
         params = f.readline()
         n, m, _ = params.strip().split()
         n = int(n.split("=")[1])
@@ -264,6 +296,8 @@ def main():
     cmd_parser.add_argument("--heapsize", help="heapsize to use (use default if not specified)")
     cmd_parser.add_argument("--via-mpy", action="store_true", help="compile code to .mpy first")
     cmd_parser.add_argument("--mpy-cross-flags", default="", help="flags to pass to mpy-cross")
+    # CIRCUITPY-CHANGE
+    cmd_parser.add_argument("--csv", help="also write the results to the given CSV file")
     cmd_parser.add_argument(
         "N", nargs=1, help="N parameter (approximate target CPU frequency in MHz)"
     )
@@ -307,7 +341,15 @@ def main():
 
     print("N={} M={} n_average={}".format(N, M, n_average))
 
-    target_had_error = run_benchmarks(args, target, N, M, n_average, tests)
+    csv_rows = []
+    target_had_error = run_benchmarks(args, target, N, M, n_average, tests, csv_rows)
+
+    # CIRCUITPY-CHANGE
+    if args.csv:
+        with open(args.csv, "w", newline="") as f:
+            writer = csv.writer(f)
+            writer.writerow(CSV_FIELDS)
+            writer.writerows(csv_rows)
 
     if isinstance(target, pyboard.Pyboard):
         target.exit_raw_repl()
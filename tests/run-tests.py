@@ -538,6 +538,11 @@ def run_tests(pyb, tests, args, result_dir, num_threads=1):
             skip_tests.add("inlineasm/asmit.py")
             skip_tests.add("inlineasm/asmspecialregs.py")
 
+        # Check if viper has the float type, and skip such tests if it doesn't
+        output = run_feature_check(pyb, args, "viper_float.py")
+        if output != b"viper_float\n":
+            skip_tests.add("micropython/viper_float.py")
+
         # Check if emacs repl is supported, and skip such tests if it's not
         t = run_feature_check(pyb, args, "repl_emacs_check.py")
         if "True" not in str(t, "ascii"):
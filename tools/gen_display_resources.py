@@ -349,6 +349,32 @@ displayio_bitmap_t supervisor_terminal_font_bitmap = {{
 )
 
 
+# filtered_characters is sorted, so the extra characters are in codepoint order and a
+# codepoint's position in this table is its glyph offset. Fonts with characters beyond
+# the BMP fall back to searching unicode_characters.
+codepoints = [ord(c) for c in extra_characters]
+if codepoints and max(codepoints) <= 0xFFFF:
+    c_file.write(
+        """\
+static const uint16_t supervisor_terminal_font_codepoints[{}] = {{
+""".format(len(codepoints))
+    )
+    for i, codepoint in enumerate(codepoints):
+        c_file.write("0x{:04x}, ".format(codepoint))
+        if (i + 1) % 8 == 0:
+            c_file.write("\n")
+    if len(codepoints) % 8 != 0:
+        c_file.write("\n")
+    c_file.write(
+        """\
+};
+"""
+    )
+    codepoints_ref = "supervisor_terminal_font_codepoints"
+else:
+    codepoints_ref = "NULL"
+    codepoints = []
+
 c_file.write(
     """\
 const fontio_builtinfont_t supervisor_terminal_font = {{
@@ -357,9 +383,18 @@ const fontio_builtinfont_t supervisor_terminal_font = {{
     .width = {},
     .height = {},
     .unicode_characters = (const uint8_t*) "{}",
-    .unicode_characters_len = {}
+    .unicode_characters_len = {},
+    .unicode_codepoints = {},
+    .unicode_codepoints_len = {}
 }};
-""".format(tile_x, tile_y, extra_characters, len(extra_characters.encode("utf-8")))
+""".format(
+        tile_x,
+        tile_y,
+        extra_characters,
+        len(extra_characters.encode("utf-8")),
+        codepoints_ref,
+        len(codepoints),
+    )
 )
 
 c_file.write(
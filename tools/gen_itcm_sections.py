@@ -0,0 +1,122 @@
+"""Picks the hottest functions from a profile and prints a linker script fragment that places them
+in ITCM. The mimxrt10xx port includes the fragment when it is given as ITCM_SECTIONS.
+
+Profiles can be:
+* Chrome trace json from tools/swo_function_trace.py, from a build with CIRCUITPY_SWO_TRACE = 1.
+  Functions are weighted by the time spent in them, not counting what they call, and only
+  functions that ran from flash ("F:") are counted.
+* Folded stacks, one "outer;inner;leaf count" per line. The leaf is weighted by the count.
+
+Functions are chosen by weight per byte until the budget is used up. Function sizes come from the
+ELF of the build the fragment is for, which should be built with the same settings except for
+CIRCUITPY_SWO_TRACE. The space left in ITCM is in the memory usage printed when it links.
+
+pip install pyelftools
+python tools/gen_itcm_sections.py --budget 8192 build-metro_m7_1011/firmware.elf trace.json > itcm.ld
+make BOARD=metro_m7_1011 ITCM_SECTIONS=$PWD/itcm.ld
+"""
+
+import argparse
+import collections
+import json
+import sys
+
+from elftools.elf.elffile import ELFFile
+
+
+def load_chrome_trace(f, weights):
+    times = collections.Counter()
+    text = f.read().strip()
+    # swo_function_trace.py leaves a trailing comma and no closing bracket when it is stopped.
+    if text.endswith(","):
+        text = text[:-1]
+    if not text.endswith("]"):
+        text += "]"
+    stack = []
+    last_ts = 0
+    for event in json.loads(text):
+        ph = event.get("ph")
+        if ph not in ("B", "E"):
+            continue
+        ts = event["ts"]
+        if stack:
+            times[stack[-1]] += ts - last_ts
+        last_ts = ts
+        if ph == "B":
+            stack.append(event["name"])
+        elif stack:
+            stack.pop()
+    # Only code that ran from flash can be moved.
+    for name, time in times.items():
+        if name.startswith("F:"):
+            weights[name[2:]] += time
+
+
+def load_folded(f, weights):
+    for line in f:
+        line = line.strip()
+        if not line:
+            continue
+        stack, _, count = line.rpartition(" ")
+        weights[stack.split(";")[-1]] += int(count)
+
+
+def flash_functions(elf_path):
+    """Returns the size of each function in .text, adding up static functions with the same name."""
+    sizes = collections.Counter()
+    with open(elf_path, "rb") as f:
+        elf = ELFFile(f)
+        text_index = None
+        for i, section in enumerate(elf.iter_sections()):
+            if section.name == ".text":
+                text_index = i
+        symtab = elf.get_section_by_name(".symtab")
+        for symbol in symtab.iter_symbols():
+            if (
+                symbol["st_info"]["type"] == "STT_FUNC"
+                and symbol["st_shndx"] == text_index
+                and symbol["st_size"] > 0
+            ):
+                sizes[symbol.name] += symbol["st_size"]
+    return sizes
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--budget", type=int, default=8192, help="bytes of ITCM to fill")
+    parser.add_argument("elf")
+    parser.add_argument("profiles", nargs="+")
+    args = parser.parse_args()
+
+    weights = collections.Counter()
+    for path in args.profiles:
+        with open(path) as f:
+            if path.endswith(".json"):
+                load_chrome_trace(f, weights)
+            else:
+                load_folded(f, weights)
+
+    sizes = flash_functions(args.elf)
+    candidates = [name for name in weights if name in sizes and weights[name] > 0]
+    candidates.sort(key=lambda name: weights[name] / sizes[name], reverse=True)
+
+    total_weight = sum(weights.values()) or 1
+    used = 0
+    placed_weight = 0
+    print(f"/* Generated by tools/gen_itcm_sections.py from {' '.join(args.profiles)} */")
+    for name in candidates:
+        # Leave room for each function's alignment.
+        size = (sizes[name] + 3) & ~3
+        if used + size > args.budget:
+            continue
+        used += size
+        placed_weight += weights[name]
+        print(f"*(.text.{name})")
+    print(
+        f"{used} bytes cover {100 * placed_weight / total_weight:.1f}% of the profile",
+        file=sys.stderr,
+    )
+
+
+if __name__ == "__main__":
+    main()
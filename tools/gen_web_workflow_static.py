@@ -8,6 +8,7 @@ import minify_html
 import jsmin
 import mimetypes
 import pathlib
+import zlib
 
 parser = argparse.ArgumentParser(description="Generate displayio resources.")
 parser.add_argument("--output_c_file", type=argparse.FileType("w"), required=True)
@@ -32,7 +33,9 @@ for f in args.files:
         uncompressed = jsmin.jsmin(uncompressed.decode("utf-8"), quote_chars="'\"`").encode(
             "utf-8"
         )
-    compressed = gzip.compress(uncompressed)
+    # A fixed mtime keeps the output, and so its ETag, the same from build to build.
+    compressed = gzip.compress(uncompressed, mtime=0)
+    etag = f"{zlib.crc32(compressed):08x}"
     clen = len(compressed)
     compressed = ", ".join([hex(x) for x in compressed])
     mime = mimetypes.guess_type(f.name)[0]
@@ -41,4 +44,5 @@ for f in args.files:
     c_file.write(f"// Original length: {ulen} Compressed length: {clen}\n")
     c_file.write(f"const uint32_t {variable}_length = {clen};\n")
     c_file.write(f'const char* {variable}_content_type = "{mime}";\n')
+    c_file.write(f'const char* {variable}_etag = "\\"{etag}\\"";\n')
     c_file.write(f"const uint8_t {variable}[{clen}] = {{{compressed}}};\n\n")
@@ -137,6 +137,12 @@ def main():
     )
     cmd_parser.add_argument("-v", "--var", action="append", help="variables to substitute")
     cmd_parser.add_argument("--mpy-tool-flags", default="", help="flags to pass to mpy-tool")
+    # CIRCUITPY-CHANGE
+    cmd_parser.add_argument(
+        "--mpy-cross-native-flags",
+        default="",
+        help="extra flags to pass to mpy-cross for modules frozen as native code",
+    )
     cmd_parser.add_argument("files", nargs="+", help="input manifest list")
     args = cmd_parser.parse_args()
 
@@ -192,6 +198,10 @@ def main():
             if result.timestamp >= ts_outfile:
                 print("MPY", result.target_path)
                 mkdir(outfile)
+                # CIRCUITPY-CHANGE: modules frozen as native code
+                extra_args = args.mpy_cross_flags.split()
+                if result.native:
+                    extra_args += ["-X", "emit=native"] + args.mpy_cross_native_flags.split()
                 # Add __version__ to the end of the file before compiling.
                 with manifestfile.tagged_py_file(result.full_path, result.metadata) as tagged_path:
                     try:
@@ -201,7 +211,7 @@ def main():
                             src_path=result.target_path,
                             opt=result.opt,
                             mpy_cross=MPY_CROSS,
-                            extra_args=args.mpy_cross_flags.split(),
+                            extra_args=extra_args,
                         )
                     except mpy_cross.CrossCompileError as ex:
                         print("error compiling {}:".format(result.target_path))
@@ -90,6 +90,8 @@ ManifestOutput = namedtuple(
         "kind",  # KIND_*.
         "metadata",  # Metadata for the containing package.
         "opt",  # Optimisation level (or None).
+        # CIRCUITPY-CHANGE
+        "native",  # Compile with the native emitter instead of to bytecode.
     ],
 )
 
@@ -256,7 +258,8 @@ class ManifestFile:
             except Exception as er:
                 raise ManifestFileError("Error in manifest: {}".format(er))
 
-    def _add_file(self, full_path, target_path, kind=KIND_AUTO, opt=None):
+    # CIRCUITPY-CHANGE: native
+    def _add_file(self, full_path, target_path, kind=KIND_AUTO, opt=None, native=False):
         # Check file exists and get timestamp.
         try:
             stat = os.stat(full_path)
@@ -284,11 +287,21 @@ class ManifestFile:
 
         self._manifest_files.append(
             ManifestOutput(
-                FILE_TYPE_LOCAL, full_path, target_path, timestamp, kind, self._metadata[-1], opt
+                FILE_TYPE_LOCAL,
+                full_path,
+                target_path,
+                timestamp,
+                kind,
+                self._metadata[-1],
+                opt,
+                native,
             )
         )
 
-    def _search(self, base_path, package_path, files, exts, kind, opt=None, strict=False):
+    # CIRCUITPY-CHANGE: native
+    def _search(
+        self, base_path, package_path, files, exts, kind, opt=None, strict=False, native=False
+    ):
         base_path = self._resolve_path(base_path)
 
         if files is not None:
@@ -296,7 +309,9 @@ class ManifestFile:
             for file in files:
                 if package_path:
                     file = os.path.join(package_path, file)
-                self._add_file(os.path.join(base_path, file), file, kind=kind, opt=opt)
+                self._add_file(
+                    os.path.join(base_path, file), file, kind=kind, opt=opt, native=native
+                )
         else:
             if base_path:
                 prev_cwd = os.getcwd()
@@ -313,6 +328,7 @@ class ManifestFile:
                             file,
                             kind=kind,
                             opt=opt,
+                            native=native,
                         )
                     elif strict:
                         raise ManifestFileError("Unexpected file type")
@@ -502,15 +518,16 @@ class ManifestFile:
         # TODO: version None
         self._add_file(os.path.join(base_path, module_path), module_path, opt=opt)
 
-    def _freeze_internal(self, path, script, exts, kind, opt):
+    # CIRCUITPY-CHANGE: native
+    def _freeze_internal(self, path, script, exts, kind, opt, native=False):
         if script is None:
-            self._search(path, None, None, exts=exts, kind=kind, opt=opt)
+            self._search(path, None, None, exts=exts, kind=kind, opt=opt, native=native)
         elif isinstance(script, str) and os.path.isdir(os.path.join(path, script)):
-            self._search(path, script, None, exts=exts, kind=kind, opt=opt)
+            self._search(path, script, None, exts=exts, kind=kind, opt=opt, native=native)
         elif not isinstance(script, str):
-            self._search(path, None, script, exts=exts, kind=kind, opt=opt)
+            self._search(path, None, script, exts=exts, kind=kind, opt=opt, native=native)
         else:
-            self._search(path, None, (script,), exts=exts, kind=kind, opt=opt)
+            self._search(path, None, (script,), exts=exts, kind=kind, opt=opt, native=native)
 
     def freeze(self, path, script=None, opt=None):
         """
@@ -558,12 +575,18 @@ class ManifestFile:
         """
         self._search(path, None, None, exts=(".py",), kind=KIND_FREEZE_AS_STR)
 
-    def freeze_as_mpy(self, path, script=None, opt=None):
+    # CIRCUITPY-CHANGE: native
+    def freeze_as_mpy(self, path, script=None, opt=None, native=False):
         """
         Freeze the input (see above) by first compiling the .py scripts to
         .mpy files, then freezing the resulting .mpy files.
+
+        If `native` is true the scripts are compiled with the native emitter,
+        for the architecture given to mpy-cross by the build.
         """
-        self._freeze_internal(path, script, exts=(".py",), kind=KIND_FREEZE_AS_MPY, opt=opt)
+        self._freeze_internal(
+            path, script, exts=(".py",), kind=KIND_FREEZE_AS_MPY, opt=opt, native=native
+        )
 
     def freeze_mpy(self, path, script=None, opt=None):
         """
@@ -92,6 +92,8 @@ class Config:
     MICROPY_LONGINT_IMPL_NONE = 0
     MICROPY_LONGINT_IMPL_LONGLONG = 1
     MICROPY_LONGINT_IMPL_MPZ = 2
+    # CIRCUITPY-CHANGE: set when any input .mpy uses fused opcodes
+    bc_fused_ops = False
 
 
 config = Config()
@@ -114,6 +116,9 @@ MP_NATIVE_ARCH_ARMV7EMDP = 8
 MP_NATIVE_ARCH_XTENSA = 9
 MP_NATIVE_ARCH_XTENSAWIN = 10
 
+# CIRCUITPY-CHANGE: flag in the small-int-bits header byte
+MPY_FEATURE_FUSED_OPS = 0x80
+
 MP_PERSISTENT_OBJ_FUN_TABLE = 0
 MP_PERSISTENT_OBJ_NONE = 1
 MP_PERSISTENT_OBJ_FALSE = 2
@@ -191,9 +196,9 @@ class Opcode:
     # fmt: off
     # Load, Store, Delete, Import, Make, Build, Unpack, Call, Jump, Exception, For, sTack, Return, Yield, Op
     MP_BC_BASE_RESERVED               = (0x00) # ----------------
-    MP_BC_BASE_QSTR_O                 = (0x10) # LLLLLLSSSDDII---
+    MP_BC_BASE_QSTR_O                 = (0x10) # LLLLLLSSSDDIILLS
     MP_BC_BASE_VINT_E                 = (0x20) # MMLLLLSSDDBBBBBB
-    MP_BC_BASE_VINT_O                 = (0x30) # UUMMCCCC--------
+    MP_BC_BASE_VINT_O                 = (0x30) # UUMMCCCCB-------
     MP_BC_BASE_JUMP_E                 = (0x40) # J-JJJJJEEEEF----
     MP_BC_BASE_BYTE_O                 = (0x50) # LLLLSSDTTTTTEEFF
     MP_BC_BASE_BYTE_E                 = (0x60) # --BREEEYYI------
@@ -296,6 +301,11 @@ class Opcode:
     MP_BC_IMPORT_NAME                 = (MP_BC_BASE_QSTR_O + 0x0b) # qstr
     MP_BC_IMPORT_FROM                 = (MP_BC_BASE_QSTR_O + 0x0c) # qstr
     MP_BC_IMPORT_STAR                 = (MP_BC_BASE_BYTE_E + 0x09)
+    # CIRCUITPY-CHANGE: fused opcodes
+    MP_BC_LOAD_FAST_0_ATTR            = (MP_BC_BASE_QSTR_O + 0x0d) # qstr
+    MP_BC_LOAD_FAST_0_METHOD          = (MP_BC_BASE_QSTR_O + 0x0e) # qstr
+    MP_BC_STORE_ATTR_FAST_0           = (MP_BC_BASE_QSTR_O + 0x0f) # qstr
+    MP_BC_BINARY_OP_LOCAL_SMALL_INT   = (MP_BC_BASE_VINT_O + 0x08) # uint
     # fmt: on
 
     # Create sets of related opcodes.
@@ -1367,7 +1377,10 @@ def read_mpy(filename):
                 config.native_arch = mpy_native_arch
             elif config.native_arch != mpy_native_arch:
                 raise MPYReadError(filename, "native architecture mismatch")
-        config.mp_small_int_bits = header[3]
+        # CIRCUITPY-CHANGE: the top bit flags fused opcodes
+        config.mp_small_int_bits = header[3] & ~MPY_FEATURE_FUSED_OPS
+        if header[3] & MPY_FEATURE_FUSED_OPS:
+            config.bc_fused_ops = True
 
         # Read number of qstrs, and number of objects.
         n_qstr = reader.read_uint()
@@ -1446,6 +1459,13 @@ def freeze_mpy(firmware_qstr_idents, compiled_modules):
         print("#endif")
         print()
 
+    # CIRCUITPY-CHANGE
+    if config.bc_fused_ops:
+        print("#if !MICROPY_BC_FUSED_OPS")
+        print('#error "frozen bytecode uses fused opcodes; enable MICROPY_BC_FUSED_OPS"')
+        print("#endif")
+        print()
+
     print("#if MICROPY_PY_BUILTINS_FLOAT")
     print("typedef struct _mp_obj_float_t {")
     print("    mp_obj_base_t base;")
@@ -1710,6 +1730,9 @@ def merge_mpy(compiled_modules, output_file):
         header[1] = config.MPY_VERSION
         header[2] = config.native_arch << 2 | config.MPY_SUB_VERSION if config.native_arch else 0
         header[3] = config.mp_small_int_bits
+        # CIRCUITPY-CHANGE
+        if config.bc_fused_ops:
+            header[3] |= MPY_FEATURE_FUSED_OPS
         merged_mpy.extend(header)
 
         n_qstr = 0